@@ -72,11 +72,37 @@ const big = Buffer.from('308203560201000282010100ebec69b74460e4e82f2bf927'
   const msg = Buffer.from('31260986ee940fa71d2c4cc7c00d4b1e'
                         + 'c2131b24f2b6243f48c2cbd3b7b82ea3', 'hex');
   const sig = dsa.sign(msg, key);
+  const signer = dsa.signerCreate(key);
 
   assert(dsa.privateKeyVerify(key));
   assert(dsa.verify(msg, sig, pub));
 
+  bench('dsa sign', rounds, () => {
+    dsa.sign(msg, key);
+  });
+
+  bench('dsa sign (keyed)', rounds, () => {
+    dsa.signPrepared(msg, signer);
+  });
+
   bench('dsa verify', rounds, () => {
     dsa.verify(msg, sig, pub);
   });
 }
+
+{
+  const rounds = 100 * mul;
+  const key = big;
+  const msg = Buffer.alloc(32, 0xaa);
+  const signer = dsa.signerCreate(key);
+
+  assert(dsa.privateKeyVerify(key));
+
+  bench('dsa-2048 sign', rounds, () => {
+    dsa.sign(msg, key);
+  });
+
+  bench('dsa-2048 sign (keyed)', rounds, () => {
+    dsa.signPrepared(msg, signer);
+  });
+}
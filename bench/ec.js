@@ -6,9 +6,26 @@ const p256 = require('../lib/p256');
 const p521 = require('../lib/p521');
 const ed25519 = require('../lib/ed25519');
 const ed448 = require('../lib/ed448');
+const schnorr = require('../lib/schnorr');
 const x25519 = require('../lib/x25519');
 const x448 = require('../lib/x448');
 const mul = secp256k1.native ? 10 : 1;
+const sizes = [16, 64, 256, 1024, 4096, 8192];
+
+function makeBatch(ec, size, sign) {
+  const batch = [];
+
+  for (let i = 0; i < size; i++) {
+    const key = ec.privateKeyGenerate();
+    const pub = ec.publicKeyCreate(key);
+    const msg = Buffer.alloc(32, i & 0xff);
+    const sig = sign(msg, key);
+
+    batch.push([msg, sig, pub]);
+  }
+
+  return batch;
+}
 
 {
   const rounds = 1000 * mul;
@@ -60,10 +77,27 @@ const mul = secp256k1.native ? 10 : 1;
                         + 'fdc793fbfa400ee3292b33fe32d114bf', 'hex');
   const sig = p256.sign(msg, key);
 
+  const pool = p256.noncePoolCreate(rounds, 0);
+  const signer = p256.signerCreate(key);
+
   bench('p256 pubkey', rounds, () => {
     p256.publicKeyCreate(key);
   });
 
+  bench('p256 sign', rounds, () => {
+    p256.sign(msg, key);
+  });
+
+  p256.noncePoolFill(pool);
+
+  bench('p256 sign (pooled)', rounds, () => {
+    p256.signPooled(msg, key, pool);
+  });
+
+  bench('p256 sign (keyed)', rounds, () => {
+    p256.signPrepared(msg, signer);
+  });
+
   bench('p256 verify', rounds, () => {
     p256.verify(msg, sig, pub);
   });
@@ -133,10 +167,20 @@ const mul = secp256k1.native ? 10 : 1;
                         + '771e60698bdd9e321bc99e9c7f64e2a5', 'hex');
   const sig = ed25519.sign(msg, key);
 
+  const signer = ed25519.signerCreate(key);
+
   bench('ed25519 pubkey', rounds, () => {
     ed25519.publicKeyCreate(key);
   });
 
+  bench('ed25519 sign', rounds, () => {
+    ed25519.sign(msg, key);
+  });
+
+  bench('ed25519 sign (prepared)', rounds, () => {
+    ed25519.signPrepared(msg, signer);
+  });
+
   bench('ed25519 verify', rounds, () => {
     ed25519.verify(msg, sig, pub);
   });
@@ -174,9 +218,23 @@ const mul = secp256k1.native ? 10 : 1;
     ed448.publicKeyCreate(key);
   });
 
+  const signer = ed448.signerCreate(key);
+
+  bench('ed448 sign', rounds, () => {
+    ed448.sign(msg, key);
+  });
+
+  bench('ed448 sign (prepared)', rounds, () => {
+    ed448.signPrepared(msg, signer);
+  });
+
   bench('ed448 verify', rounds, () => {
     ed448.verify(msg, sig, pub);
   });
+
+  bench('ed448 verify (cofactor)', rounds, () => {
+    ed448.verifySingle(msg, sig, pub);
+  });
 }
 
 {
@@ -216,3 +274,30 @@ const mul = secp256k1.native ? 10 : 1;
     x448.derive(pub, key);
   });
 }
+
+for (const size of sizes) {
+  const rounds = Math.max(1, Math.floor(256 * mul / size));
+  const batch = makeBatch(schnorr, size, (m, k) => schnorr.sign(m, k));
+
+  bench(`schnorr verify batch (${size})`, rounds, () => {
+    schnorr.verifyBatch(batch);
+  });
+}
+
+for (const size of sizes) {
+  const rounds = Math.max(1, Math.floor(256 * mul / size));
+  const batch = makeBatch(ed25519, size, (m, k) => ed25519.sign(m, k));
+
+  bench(`ed25519 verify batch (${size})`, rounds, () => {
+    ed25519.verifyBatch(batch);
+  });
+}
+
+for (const size of sizes) {
+  const rounds = Math.max(1, Math.floor(64 * mul / size));
+  const batch = makeBatch(ed448, size, (m, k) => ed448.sign(m, k));
+
+  bench(`ed448 verify batch (${size})`, rounds, () => {
+    ed448.verifyBatch(batch);
+  });
+}
@@ -0,0 +1,85 @@
+'use strict';
+
+const bench = require('./bench');
+const p256 = require('../lib/p256');
+const p384 = require('../lib/p384');
+const p521 = require('../lib/p521');
+const ed25519 = require('../lib/ed25519');
+const ed448 = require('../lib/ed448');
+const mul = p256.native ? 10 : 1;
+
+// Operations below are dominated by a single
+// field or scalar inversion (plus a square root
+// in the case of the uniform mappings).
+
+for (const ec of [p256, p384, p521]) {
+  const rounds = 1000 * mul;
+  const name = ec.id.toLowerCase();
+  const key = ec.privateKeyGenerate();
+  const bytes = Buffer.alloc(ec.size, 0xaa);
+
+  bench(`${name} scalar invert`, rounds, () => {
+    ec.privateKeyInvert(key);
+  });
+
+  bench(`${name} pubkey from uniform`, rounds, () => {
+    ec.publicKeyFromUniform(bytes);
+  });
+}
+
+for (const ec of [ed25519, ed448]) {
+  const rounds = 1000 * mul;
+  const name = ec.id.toLowerCase();
+  const scalar = ec.scalarGenerate();
+  const pub = ec.publicKeyCreate(ec.privateKeyGenerate());
+
+  bench(`${name} scalar invert`, rounds, () => {
+    ec.scalarInvert(scalar);
+  });
+
+  bench(`${name} pubkey convert`, rounds, () => {
+    ec.publicKeyConvert(pub);
+  });
+}
+
+// Both inverters on otherwise identical
+// contexts (the default is per build).
+if (p256.native === 2) {
+  for (const ec of [p256, p384, p521]) {
+    const rounds = 1000 * mul;
+    const name = ec.id.toLowerCase();
+    const key = ec.privateKeyGenerate();
+    const bytes = Buffer.alloc(ec.size, 0xaa);
+
+    for (const path of ['chain', 'safegcd']) {
+      const other = new ec.constructor(ec.id, false, path);
+
+      bench(`${name} scalar invert (${path})`, rounds, () => {
+        other.privateKeyInvert(key);
+      });
+
+      bench(`${name} pubkey from uniform (${path})`, rounds, () => {
+        other.publicKeyFromUniform(bytes);
+      });
+    }
+  }
+
+  for (const ec of [ed25519, ed448]) {
+    const rounds = 1000 * mul;
+    const name = ec.id.toLowerCase();
+    const scalar = ec.scalarGenerate();
+    const pub = ec.publicKeyCreate(ec.privateKeyGenerate());
+
+    for (const path of ['chain', 'safegcd']) {
+      const other = new ec.constructor(ec.id, false, path);
+
+      bench(`${name} scalar invert (${path})`, rounds, () => {
+        other.scalarInvert(scalar);
+      });
+
+      bench(`${name} pubkey convert (${path})`, rounds, () => {
+        other.publicKeyConvert(pub);
+      });
+    }
+  }
+}
@@ -1,7 +1,11 @@
 'use strict';
 
 const bench = require('./bench');
+const rng = require('../lib/random');
 const secp256k1 = require('../lib/secp256k1');
+const p256 = require('../lib/p256');
+const ed25519 = require('../lib/ed25519');
+const x25519 = require('../lib/x25519');
 const mul = secp256k1.native ? 10 : 1;
 
 {
@@ -32,3 +36,35 @@ const mul = secp256k1.native ? 10 : 1;
     secp256k1.publicKeyToHash(pub);
   });
 }
+
+for (const curve of [secp256k1, p256, ed25519, x25519]) {
+  const size = 64;
+  const rounds = 16 * mul;
+  const name = curve.id.toLowerCase();
+  const len = (curve.bits + 7) >>> 3;
+  const uniforms = [];
+  const hashes = [];
+
+  for (let i = 0; i < size; i++) {
+    uniforms.push(rng.randomBytes(len));
+    hashes.push(rng.randomBytes(len * 2));
+  }
+
+  bench(`${name} pubkey from uniform (${size})`, rounds, () => {
+    for (const bytes of uniforms)
+      curve.publicKeyFromUniform(bytes);
+  });
+
+  bench(`${name} pubkey from uniform batch (${size})`, rounds, () => {
+    curve.publicKeyFromUniformBatch(uniforms);
+  });
+
+  bench(`${name} pubkey from hash (${size})`, rounds, () => {
+    for (const bytes of hashes)
+      curve.publicKeyFromHash(bytes);
+  });
+
+  bench(`${name} pubkey from hash batch (${size})`, rounds, () => {
+    curve.publicKeyFromHashBatch(hashes);
+  });
+}
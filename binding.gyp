@@ -1,6 +1,8 @@
 {
   "variables": {
-    "with_secp256k1%": "true"
+    "with_secp256k1%": "true",
+    "with_secp256k1_static%": "true",
+    "torsion_fixed_width%": ""
   },
   "targets": [
     {
@@ -74,6 +76,11 @@
           "defines": [
             "TORSION_HAVE_PTHREAD"
           ]
+        }],
+        ["torsion_fixed_width != ''", {
+          "defines": [
+            "TORSION_FIXED_WIDTH=<(torsion_fixed_width)"
+          ]
         }]
       ]
     },
@@ -152,6 +159,11 @@
             "WORDS_BIGENDIAN=1"
           ]
         }],
+        ["with_secp256k1_static == 'true'", {
+          "defines": [
+            "USE_ECMULT_STATIC_PRECOMPUTATION=1"
+          ]
+        }],
         ["target_arch == 'x64' and OS != 'win'", {
           "defines": [
             "HAVE___INT128=1",
@@ -15,6 +15,10 @@
 #include "scalar.h"
 #include "ecmult.h"
 
+#ifdef USE_ECMULT_STATIC_PRECOMPUTATION
+#include "ecmult_static_pre_g.h"
+#endif
+
 #if defined(EXHAUSTIVE_TEST_ORDER)
 /* We need to lower these values for exhaustive tests because
  * the tables cannot have infinities in them (this breaks the
@@ -311,12 +315,16 @@ static void secp256k1_ecmult_odd_multiples_table_storage_var(const int n, secp25
     } \
 } while(0)
 
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
 static const size_t SECP256K1_ECMULT_CONTEXT_PREALLOCATED_SIZE =
     ROUND_TO_ALIGN(sizeof((*((secp256k1_ecmult_context*) NULL)->pre_g)[0]) * ECMULT_TABLE_SIZE(WINDOW_G))
 #ifdef USE_ENDOMORPHISM
     + ROUND_TO_ALIGN(sizeof((*((secp256k1_ecmult_context*) NULL)->pre_g_128)[0]) * ECMULT_TABLE_SIZE(WINDOW_G))
 #endif
     ;
+#else
+static const size_t SECP256K1_ECMULT_CONTEXT_PREALLOCATED_SIZE = 0;
+#endif
 
 static void secp256k1_ecmult_context_init(secp256k1_ecmult_context *ctx) {
     ctx->pre_g = NULL;
@@ -326,13 +334,16 @@ static void secp256k1_ecmult_context_init(secp256k1_ecmult_context *ctx) {
 }
 
 static void secp256k1_ecmult_context_build(secp256k1_ecmult_context *ctx, void **prealloc) {
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
     secp256k1_gej gj;
     void* const base = *prealloc;
     size_t const prealloc_size = SECP256K1_ECMULT_CONTEXT_PREALLOCATED_SIZE;
+#endif
 
     if (ctx->pre_g != NULL) {
         return;
     }
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
 
     /* get the generator */
     secp256k1_gej_set_ge(&gj, &secp256k1_ge_const_g);
@@ -365,9 +376,17 @@ static void secp256k1_ecmult_context_build(secp256k1_ecmult_context *ctx, void *
         secp256k1_ecmult_odd_multiples_table_storage_var(ECMULT_TABLE_SIZE(WINDOW_G), *ctx->pre_g_128, &g_128j);
     }
 #endif
+#else
+    (void)prealloc;
+    ctx->pre_g = (secp256k1_ge_storage (*)[])secp256k1_pre_g;
+#ifdef USE_ENDOMORPHISM
+    ctx->pre_g_128 = (secp256k1_ge_storage (*)[])secp256k1_pre_g_128;
+#endif
+#endif
 }
 
 static void secp256k1_ecmult_context_finalize_memcpy(secp256k1_ecmult_context *dst, const secp256k1_ecmult_context *src) {
+#ifndef USE_ECMULT_STATIC_PRECOMPUTATION
     if (src->pre_g != NULL) {
         /* We cast to void* first to suppress a -Wcast-align warning. */
         dst->pre_g = (secp256k1_ge_storage (*)[])(void*)((unsigned char*)dst + ((unsigned char*)(src->pre_g) - (unsigned char*)src));
@@ -377,6 +396,9 @@ static void secp256k1_ecmult_context_finalize_memcpy(secp256k1_ecmult_context *d
         dst->pre_g_128 = (secp256k1_ge_storage (*)[])(void*)((unsigned char*)dst + ((unsigned char*)(src->pre_g_128) - (unsigned char*)src));
     }
 #endif
+#else
+    (void)dst, (void)src;
+#endif
 }
 
 static int secp256k1_ecmult_context_is_built(const secp256k1_ecmult_context *ctx) {
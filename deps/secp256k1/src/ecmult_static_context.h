@@ -0,0 +1,2198 @@
+/*!
+ * ecmult_static_context.h - ecmult_gen tables
+ * Generated by scripts/secp256k1-tables.js. Do not edit.
+ */
+
+#ifndef SECP256K1_ECMULT_STATIC_CONTEXT_H
+#define SECP256K1_ECMULT_STATIC_CONTEXT_H
+
+#include "group.h"
+
+#define SC SECP256K1_GE_STORAGE_CONST
+
+#if ECMULT_GEN_PREC_N != 64 || ECMULT_GEN_PREC_G != 16
+#  error "Invalid ECMULT_GEN_PREC_BITS for static tables."
+#endif
+
+static const secp256k1_ge_storage secp256k1_ecmult_static_context[ECMULT_GEN_PREC_N][ECMULT_GEN_PREC_G] = {
+  {
+    SC(0x3a9ed373UL, 0x6eed3eecUL, 0x9aeb5ac0UL, 0x21b54652UL, 0x56817b1fUL, 0x08de6cd0UL, 0xfbcee548UL, 0xba044bb5UL,
+       0x7bcc5928UL, 0xbdc9c023UL, 0xdfc663b8UL, 0x9e4f6969UL, 0xab751798UL, 0x8e600ec1UL, 0xd242010cUL, 0x45c7974aUL),
+    SC(0xe44d7675UL, 0xc3cb2857UL, 0x4e133c01UL, 0xa74f4afcUL, 0x5ce684f8UL, 0x4a789711UL, 0x603f7c4fUL, 0x50abef58UL,
+       0x25bcb62fUL, 0xfe2e2ce2UL, 0x196ad86cUL, 0x0a006e20UL, 0x8c64d21bUL, 0xb25320a3UL, 0xb5574b9cUL, 0x1e1bfb4bUL),
+    SC(0x6ada98a4UL, 0x8118166fUL, 0xe7082591UL, 0xd6cda51eUL, 0x914b60b1UL, 0x49696270UL, 0x3350249bUL, 0xee8d4770UL,
+       0xc234dfadUL, 0xf3847877UL, 0xa0a7bcdaUL, 0x112dba85UL, 0x1cdddf00UL, 0x084d0c07UL, 0x00df1d1aUL, 0xa3ec3aebUL),
+    SC(0x00a94ae8UL, 0x63264dfbUL, 0xb910ea95UL, 0x4ce9ca7eUL, 0x4f86f92dUL, 0x9f3a95d1UL, 0xed61552aUL, 0x7a3f5743UL,
+       0x7f53f7f1UL, 0x6ad2d08fUL, 0x15e73314UL, 0x06d80467UL, 0x41557acfUL, 0x19556c0fUL, 0xed7117ceUL, 0x37040823UL),
+    SC(0xb692c750UL, 0xd23d3674UL, 0xc351e3b7UL, 0xe1a8a87bUL, 0x14a5df81UL, 0x852eaf35UL, 0x209d0ec5UL, 0x6e22a2cfUL,
+       0xb18c4f17UL, 0x252db89fUL, 0x838de32fUL, 0xb3340ea2UL, 0xbb961a39UL, 0x54b38c47UL, 0xf9a8219cUL, 0x4820a0cbUL),
+    SC(0x691fc741UL, 0x80e75b55UL, 0x47b375f1UL, 0x1bf60abeUL, 0x451d27deUL, 0x1743a436UL, 0x5f8e4bacUL, 0xad421c09UL,
+       0x8eb5fd9dUL, 0xf3c03240UL, 0x6cebf370UL, 0x8125955fUL, 0xbf2ef703UL, 0x475d3fd6UL, 0x1a0291b6UL, 0x69b52d9dUL),
+    SC(0x703b5f14UL, 0xa7d82473UL, 0x1196b52fUL, 0xae9ca8cbUL, 0xb245b004UL, 0x7a9928d7UL, 0xd0c42f33UL, 0x391411dcUL,
+       0x5ed74eaaUL, 0x49f276c0UL, 0x4d61f31bUL, 0x6da4137cUL, 0xbde5673dUL, 0x8e3f815dUL, 0xefea7951UL, 0x0f88585cUL),
+    SC(0x29b8ec47UL, 0xd241eda1UL, 0xe51bbb1eUL, 0x3928444cUL, 0x3747b4feUL, 0x7cecb365UL, 0x2bbc4587UL, 0x2f504875UL,
+       0x88693238UL, 0x8562f8bfUL, 0xf7d72324UL, 0x062ebc54UL, 0x6b93a95fUL, 0x77936b02UL, 0xeb1cd6a7UL, 0xd4199bcbUL),
+    SC(0x444a07adUL, 0xe81916c9UL, 0x32bdeec2UL, 0x21c556c4UL, 0x6b7f6491UL, 0x0e99b479UL, 0x2cfec82fUL, 0x4ec17910UL,
+       0x2e084c2fUL, 0xeead5200UL, 0x77c151b6UL, 0xeff9375aUL, 0x713b9d15UL, 0x5306708dUL, 0xb3f538e1UL, 0x08eb18cfUL),
+    SC(0xe0dd618bUL, 0x226ceddcUL, 0xf560527eUL, 0x20b4fe58UL, 0x0e5fcf28UL, 0x39911ea6UL, 0xc3e8a4a7UL, 0xe15f9121UL,
+       0xa063a157UL, 0x3377bbbfUL, 0x1b9a5ebeUL, 0xafbe11aaUL, 0x660c1e65UL, 0xdf1392b8UL, 0x97205858UL, 0x3c86a3fcUL),
+    SC(0x9b99461aUL, 0x2e8360f2UL, 0xf2ba0bb8UL, 0xbcaeb699UL, 0x159e0652UL, 0x69d9042aUL, 0xfa0c4e30UL, 0xa7b6f30dUL,
+       0x3fe7fe04UL, 0x3cb45303UL, 0x3d4f5560UL, 0x7d41cd76UL, 0x9036a49bUL, 0x82912350UL, 0x6d8b9995UL, 0x254154fdUL),
+    SC(0x504da3a9UL, 0xd9d9c81bUL, 0xc2065398UL, 0x4ed28cb1UL, 0xb5beec9bUL, 0x6ce5dfb6UL, 0xcea94e54UL, 0xfdff044bUL,
+       0xcbd40d1eUL, 0x858133c9UL, 0xcd20b9e4UL, 0x0ff9fe94UL, 0xf7cc9579UL, 0x39e6df49UL, 0x7a6bd702UL, 0x797f96cfUL),
+    SC(0xddec0aacUL, 0x1ebce6aaUL, 0xad6300d5UL, 0x60f0e503UL, 0x829f0bc6UL, 0x479641f9UL, 0x0b19d9f6UL, 0x484376fbUL,
+       0x332ff5b1UL, 0xfc83085eUL, 0x736736bfUL, 0x3c265e4cUL, 0x8f80925eUL, 0x6f38479dUL, 0x6563bc34UL, 0x0e5faea1UL),
+    SC(0xdc530cebUL, 0xb82c246eUL, 0x41c522f1UL, 0xd2571d31UL, 0x4b14edf3UL, 0x91577a2bUL, 0x64e42172UL, 0xb23562c1UL,
+       0x563ddd93UL, 0x857d6529UL, 0x8b81de24UL, 0x19e5cedeUL, 0x07a4c5b7UL, 0xa2fe98f6UL, 0x9efb8906UL, 0x6f32a98aUL),
+    SC(0x7604d60fUL, 0x418dd132UL, 0x78058942UL, 0xfb2d2153UL, 0xc0a2bfebUL, 0xe83c5011UL, 0xa451bcb1UL, 0x58db0773UL,
+       0x38be14aeUL, 0xd9e1c404UL, 0x63ef92bdUL, 0xd62c599aUL, 0xb37625a8UL, 0x182a3763UL, 0x4fa2de90UL, 0x535d50a9UL),
+    SC(0xcb896744UL, 0x77b20829UL, 0xf5e2bd42UL, 0x8852c70bUL, 0x91cbd0afUL, 0x0cadf219UL, 0xa69727b4UL, 0xcbec8d7aUL,
+       0x5710d17aUL, 0x20ea0dffUL, 0x980d3f06UL, 0x38d8b910UL, 0xb8940d00UL, 0xdd4a323fUL, 0xd777d942UL, 0x213e1093UL)
+  },
+  {
+    SC(0x1b8462ebUL, 0x1ccdf7b2UL, 0xb8372f2fUL, 0xcec1f479UL, 0xab07c09fUL, 0xcb26d6c3UL, 0x0965ec73UL, 0x4d654f81UL,
+       0x062f6755UL, 0xb4a7891dUL, 0x55de6427UL, 0xfbc37d33UL, 0xe4eea418UL, 0xa2c04392UL, 0xa3d11807UL, 0x0ccc9025UL),
+    SC(0xf6fa4c02UL, 0x1b697e93UL, 0xae34145bUL, 0x481a3ac7UL, 0x462343dcUL, 0x6022040fUL, 0x834dd9d2UL, 0x00c69b5dUL,
+       0x5de5e04bUL, 0x351f9928UL, 0xb84abaedUL, 0xd3319e61UL, 0xea91fc59UL, 0x8d6fcac3UL, 0x401d1ae7UL, 0x0c08943eUL),
+    SC(0xcf805a58UL, 0xd8f9b414UL, 0xaa73cd0cUL, 0xe545c9afUL, 0x3f7d6543UL, 0x8ae57688UL, 0x81d30866UL, 0xe81242d4UL,
+       0xf455c617UL, 0x99a2ca5cUL, 0xfac3eb6fUL, 0x23282774UL, 0x7c9e914eUL, 0xfce447adUL, 0x8fd71ffcUL, 0x4fc3306bUL),
+    SC(0x48dbd9a5UL, 0x88d1f02dUL, 0x6eacc5a6UL, 0x36c0fb4fUL, 0xde87eb44UL, 0x11329442UL, 0x1265b0ffUL, 0x0a72e473UL,
+       0x9a206d25UL, 0x5dc1d916UL, 0xe3b1e301UL, 0xcab1bd91UL, 0xea29eb7eUL, 0x979c0b84UL, 0x608ed770UL, 0x4af325d0UL),
+    SC(0xceb3637bUL, 0x28997733UL, 0xad6ef0ddUL, 0x05004e32UL, 0x9c87981bUL, 0xe6d811a3UL, 0x88804884UL, 0x652780d4UL,
+       0x6aed5e97UL, 0xc0e836b2UL, 0x73a309fcUL, 0x5d389779UL, 0x1f6f0bc9UL, 0x246921efUL, 0x5fa9767fUL, 0xdacac3f5UL),
+    SC(0x8940dca2UL, 0x52ebefadUL, 0x61db720bUL, 0xe709c749UL, 0x7302b5e1UL, 0xa4174893UL, 0x9626910cUL, 0x43708a18UL,
+       0xe1b0d7beUL, 0x1e36c585UL, 0x8bc6125fUL, 0x7fd5c423UL, 0x5e643f7fUL, 0x11668026UL, 0xc1536e9dUL, 0xf6305efdUL),
+    SC(0xaa33c3cbUL, 0xbb97cceeUL, 0x5b8f452fUL, 0x6a615900UL, 0x392d78f5UL, 0xb8c1f022UL, 0x05266b8cUL, 0xcb3449e0UL,
+       0xe9ba50b4UL, 0x7d3e3279UL, 0x2253e925UL, 0x5261f2f8UL, 0x263c30dcUL, 0xe613ea9eUL, 0x737c3b92UL, 0x8c8e3eefUL),
+    SC(0x39f3965dUL, 0xb455a466UL, 0x930e5e82UL, 0xef214452UL, 0xef5c9019UL, 0xbd805fe9UL, 0x67fd362dUL, 0x193a1b2aUL,
+       0x8f69a32bUL, 0x35bd6f1bUL, 0xc5ada308UL, 0xf61550b1UL, 0x534c07b0UL, 0x1a3465f0UL, 0x0564ed6dUL, 0xa8f443c1UL),
+    SC(0x6725d4a6UL, 0xa827fef7UL, 0xa0fb0214UL, 0x900f526cUL, 0xe23cc0b4UL, 0xa6e291d0UL, 0xccb96ad9UL, 0xe77393cdUL,
+       0x69f91bacUL, 0xb09facddUL, 0xb55fb70eUL, 0x68164028UL, 0xa8cf1bbcUL, 0x207653c2UL, 0xd898992fUL, 0x89244f35UL),
+    SC(0x03b71b2fUL, 0x84d355f4UL, 0xd246a57eUL, 0xb235e396UL, 0xee236c57UL, 0xd6ab3a46UL, 0xf89b5d3cUL, 0x1a911c1aUL,
+       0x7616be06UL, 0x059e5b42UL, 0x9f105499UL, 0x38d17654UL, 0xc605f81aUL, 0xe4bdf2b7UL, 0xb9c1817bUL, 0xc8db03b3UL),
+    SC(0xa346e9c5UL, 0xd8cc2ce1UL, 0x1a733026UL, 0x3136d92cUL, 0x925f1b22UL, 0xb27d3037UL, 0xd9c4b109UL, 0x9a06ecb6UL,
+       0x4a3fd930UL, 0x054f0cfaUL, 0x6799e236UL, 0xadd0f928UL, 0x6e45b77dUL, 0xcef57797UL, 0x7dcdac63UL, 0x485c4f00UL),
+    SC(0x8e3c768aUL, 0xee07f0aaUL, 0x3eaa43e3UL, 0xf6986805UL, 0xb7829c50UL, 0xd67861c0UL, 0xc75ab390UL, 0x5a6fb794UL,
+       0x33d3c292UL, 0x7a9e9c54UL, 0xa671788aUL, 0xfc0ec58dUL, 0xcc2a0574UL, 0xa172665eUL, 0x347690d7UL, 0x50de0acdUL),
+    SC(0xb231176eUL, 0xd39a928fUL, 0x76a60397UL, 0x79643e94UL, 0xd5e75d17UL, 0x238487beUL, 0xf9b38b60UL, 0x748711c3UL,
+       0x3ae1ccaeUL, 0x204fb13dUL, 0x74705b0bUL, 0x8a0689ebUL, 0xaea16e8eUL, 0xc2f3d5dbUL, 0x177609ecUL, 0x64027f0dUL),
+    SC(0x8afbe02eUL, 0x161ed971UL, 0x44075da2UL, 0xcea389b2UL, 0xf53562d2UL, 0xdc771d3fUL, 0x9405259cUL, 0xfe4232daUL,
+       0xe2c16621UL, 0xf38a0831UL, 0xd2839585UL, 0x9cbceb53UL, 0x254398efUL, 0xb58308ccUL, 0x0bcf3d79UL, 0xee0af228UL),
+    SC(0x01a263c8UL, 0xc2c9080bUL, 0xb0d4d61aUL, 0xbb5d6b55UL, 0xe6a7f520UL, 0x80ef3f36UL, 0x706e685dUL, 0x7a527957UL,
+       0x3925a458UL, 0x779c3c25UL, 0x7b546b99UL, 0x7399a56cUL, 0xb3c0b9caUL, 0x0f6c77f9UL, 0xc41b708dUL, 0xf831253eUL),
+    SC(0x35d88ae9UL, 0xb1d3ee59UL, 0xfe79c24eUL, 0xde6cad1fUL, 0x6d822f57UL, 0x708ee54cUL, 0x26e7495bUL, 0x357e92c6UL,
+       0xde74f353UL, 0xd8115188UL, 0x724c2a32UL, 0x39b18661UL, 0x6b8f7951UL, 0x34aefc75UL, 0x8e724a30UL, 0x8be7f31eUL)
+  },
+  {
+    SC(0x6ae991deUL, 0x18418b49UL, 0x0160194fUL, 0xa735eb72UL, 0xc299b987UL, 0x1981a4f9UL, 0xaa717ad2UL, 0x0bcdcf13UL,
+       0x7ee8011aUL, 0x40f384f2UL, 0xe50add2dUL, 0x97005173UL, 0x2787cc7cUL, 0x89dafb66UL, 0x301bc94dUL, 0x024b913fUL),
+    SC(0x22165bceUL, 0xe76e1594UL, 0x5b9041e5UL, 0xccdee553UL, 0xeba60e4fUL, 0x1ece2d9fUL, 0xe0ad7440UL, 0x565f2665UL,
+       0xfe8f383bUL, 0xbae7e284UL, 0xd1d890bdUL, 0x569ab7b3UL, 0xebe5f1bbUL, 0xb60ee19eUL, 0x8e8de65fUL, 0x88f3ab96UL),
+    SC(0xa2600e0eUL, 0x9265b7d8UL, 0x0fcc46a5UL, 0x51872122UL, 0x66ad5334UL, 0x4ddedbf3UL, 0xac8cdf2aUL, 0xb86f2b8eUL,
+       0xd00f90a0UL, 0x97fe3863UL, 0xb4854dceUL, 0xfa5a36e7UL, 0x3f94015eUL, 0xf892303fUL, 0x2e5cb2c7UL, 0x0aefbf15UL),
+    SC(0x38758ff9UL, 0x5cefa7c1UL, 0xb7a2443aUL, 0xba29b65bUL, 0xaee1fa81UL, 0x5ed49595UL, 0xa4ec760fUL, 0xb995df1dUL,
+       0x43bc94bfUL, 0xdfff3c59UL, 0x7a6e41c0UL, 0x52194d41UL, 0xc1601b91UL, 0x0792f42aUL, 0x6872ded2UL, 0xa5e8f4cfUL),
+    SC(0x57122897UL, 0xd98019aeUL, 0xa6dcbe99UL, 0x49682895UL, 0xc95471e8UL, 0xd53680acUL, 0x49927e23UL, 0x16abfd27UL,
+       0xc30cb105UL, 0xd9edc36cUL, 0x9e237e93UL, 0x2edd6befUL, 0x3d553d67UL, 0xfec3a37bUL, 0xfbe0ef56UL, 0x00a3cb6cUL),
+    SC(0x7b7247c7UL, 0x73470f13UL, 0x2477c974UL, 0x7820ce4dUL, 0x51dde95bUL, 0xdd14923dUL, 0xe31dfb13UL, 0x5a8aacdfUL,
+       0x2e7054f4UL, 0xa33361a7UL, 0xa4282bb2UL, 0x7e738884UL, 0x3a91b211UL, 0x3f71e160UL, 0x60fb2235UL, 0x6b40ffc1UL),
+    SC(0x1d3f0661UL, 0x13c271dbUL, 0x374adce9UL, 0xef0c444dUL, 0x4ffbc1b2UL, 0xa34b9c91UL, 0x55986371UL, 0x52376f68UL,
+       0x1a4c07f3UL, 0xe3752c71UL, 0xf772c55bUL, 0xd269f3aeUL, 0xa9cb40a1UL, 0xac8a96b3UL, 0x7387cd1cUL, 0xbf22e864UL),
+    SC(0x456ada98UL, 0x2bcfa52aUL, 0x55018711UL, 0x6926b843UL, 0x82754297UL, 0x9af5c113UL, 0x8af21e1eUL, 0x3b625071UL,
+       0xa7141c4cUL, 0x673e441eUL, 0xf67ccf99UL, 0x53a7a6a6UL, 0x03a77432UL, 0x76261717UL, 0x021f581bUL, 0x2893243cUL),
+    SC(0xb898efaeUL, 0x8582d8deUL, 0xb315220cUL, 0xdc79d2bcUL, 0x1a221072UL, 0x300e0971UL, 0xc4a610f4UL, 0x7f6b70dcUL,
+       0x8da8b020UL, 0x8d674418UL, 0x5620db55UL, 0xfa3cd928UL, 0xbe672c5cUL, 0x22897030UL, 0xbb5a5957UL, 0x037758a8UL),
+    SC(0xb732f7e6UL, 0x9280227dUL, 0xc1f56e84UL, 0x07e72989UL, 0xb834be6bUL, 0xf04e2e3dUL, 0xca8553b5UL, 0xded18493UL,
+       0x9157298aUL, 0x5ff6e6e4UL, 0xd705efcfUL, 0x7601f33fUL, 0x76cd2a64UL, 0x6118103dUL, 0x98fa000bUL, 0x8ff9ad99UL),
+    SC(0x9601ce19UL, 0x964403b6UL, 0xa58d1d51UL, 0xbe876199UL, 0xd63755efUL, 0x91bd657aUL, 0xfbfac3efUL, 0xc85c78d0UL,
+       0xdf06aeb0UL, 0x517ae1daUL, 0xff3a48bdUL, 0x7ecceaf5UL, 0xb10ac9d9UL, 0x067e7ef4UL, 0x520593cfUL, 0xd7502058UL),
+    SC(0xa95814ecUL, 0x11446773UL, 0x36258a94UL, 0x56670207UL, 0xd068d8aeUL, 0x19ada794UL, 0x52210f2dUL, 0x0bd67bc5UL,
+       0x29d7e4b3UL, 0x5e5a4300UL, 0x6297f9c1UL, 0xf71a6a26UL, 0x118693ceUL, 0xfc738feaUL, 0xccf1b873UL, 0x339617b3UL),
+    SC(0xd3533330UL, 0xc6afe33bUL, 0xae921c0fUL, 0x558fe47dUL, 0xb97e7711UL, 0xce98c884UL, 0x03abe894UL, 0x320e8926UL,
+       0xe1be0b16UL, 0x72f8ea16UL, 0xb59a6b9aUL, 0x20c27621UL, 0xe63854cbUL, 0x4efde5d8UL, 0xd1da8929UL, 0x4f777383UL),
+    SC(0x4f05f649UL, 0xe8ec9fe9UL, 0xf675957fUL, 0x7454a89eUL, 0xc020feeaUL, 0x217782bbUL, 0x43bbed43UL, 0xb0a62881UL,
+       0xdde64c2bUL, 0x255d8518UL, 0xda7461c6UL, 0xb160286cUL, 0x5222baa5UL, 0x483fd5cfUL, 0xdade9ae4UL, 0x96432904UL),
+    SC(0x1a06ead0UL, 0x5ef3dcc1UL, 0xa9080234UL, 0xb6158fe5UL, 0x681cc5caUL, 0xacebbbf2UL, 0xc336ecdfUL, 0x3505768bUL,
+       0x63661e6eUL, 0x816bad91UL, 0x1c7bd073UL, 0x0a15b185UL, 0xc4c7b7b0UL, 0xae440dd7UL, 0x40a54286UL, 0x3a86721fUL),
+    SC(0xe2b163f9UL, 0xf1b6ad48UL, 0xe8bea9d3UL, 0x0b199cfeUL, 0x378fbd2cUL, 0x8f005cdcUL, 0xe5959154UL, 0xb2eca0e7UL,
+       0x30759d6cUL, 0xf55f7f15UL, 0xa156a705UL, 0x1f702294UL, 0x072b9544UL, 0xba73fa40UL, 0x27839cd5UL, 0x67147083UL)
+  },
+  {
+    SC(0x64850a04UL, 0x76870a44UL, 0x2cfa57e0UL, 0x4e4707f7UL, 0xeccc5e99UL, 0x12dbcb07UL, 0x3b457317UL, 0x717f5686UL,
+       0x7c5facd2UL, 0x91a6defbUL, 0xa1837cb9UL, 0x3bcbd0f5UL, 0xbc37572eUL, 0x68ccb2a0UL, 0xc062a155UL, 0x46656fccUL),
+    SC(0x4afd2a50UL, 0xf79b1403UL, 0x844523a7UL, 0xe88e0156UL, 0xf77f7856UL, 0x8668ac7cUL, 0x79d2160fUL, 0xcac27acdUL,
+       0x40346549UL, 0xfb5b8450UL, 0x0165c2a4UL, 0xc47665beUL, 0xb1d31f73UL, 0x1cd758ceUL, 0x6c8f2b17UL, 0x37a832d1UL),
+    SC(0xf4132840UL, 0x9cd5ac7dUL, 0x7a0c92f2UL, 0x5e39eb57UL, 0xb8fcfbd5UL, 0xd535ec00UL, 0xa281d3d5UL, 0x1275199bUL,
+       0x6b66ce56UL, 0x99a92cf1UL, 0x08f635a0UL, 0x7441f0c1UL, 0x3561c8d4UL, 0xcb0075f8UL, 0x8a1596daUL, 0xb6da6d29UL),
+    SC(0x1a6c66d3UL, 0x1a54ae12UL, 0x59b709b4UL, 0xc70fb434UL, 0xf3347d11UL, 0x7921ce06UL, 0xfd4f0dbeUL, 0xd211e4f4UL,
+       0xb6438faeUL, 0x74524dbeUL, 0x2d03e27cUL, 0x8af409adUL, 0x67af8eb6UL, 0x84760c85UL, 0x1e81c6afUL, 0xa4cb004eUL),
+    SC(0x3afe6f2eUL, 0x8b5f1cf4UL, 0x20ba1dc9UL, 0xf527c662UL, 0xa3af94c3UL, 0x9d0e726eUL, 0xb7942a2fUL, 0xc9c1a91dUL,
+       0x0892cde5UL, 0xf1420590UL, 0xff801f3fUL, 0x08ec2aceUL, 0x69f0dd74UL, 0x031ca7e7UL, 0xaed14c37UL, 0xc2c12492UL),
+    SC(0x28afcf30UL, 0xa1f5079dUL, 0xe6f340bcUL, 0x9e616ce0UL, 0x7a89b67dUL, 0x4e7f0dc0UL, 0x6f54fe9eUL, 0xd17f1519UL,
+       0xb7cc26ecUL, 0x9a25b585UL, 0x33a43369UL, 0x40b6bdc0UL, 0xc2462e39UL, 0x2246a863UL, 0xe67bdefeUL, 0x1ae51be1UL),
+    SC(0x13980996UL, 0xaf67f2e4UL, 0x6dc5f389UL, 0xd0269d1fUL, 0x39a9341dUL, 0x05e941e6UL, 0xb4ff7bdbUL, 0xea54cb65UL,
+       0x37a37717UL, 0xd206b584UL, 0x9eb79193UL, 0x96ff5af0UL, 0x449f3164UL, 0x4c9eb31cUL, 0x00f27d8aUL, 0xbe66c741UL),
+    SC(0xb7b75484UL, 0x8966d79bUL, 0xaa10ad77UL, 0x4c447872UL, 0xdc4c78dbUL, 0x84a58b9bUL, 0xa112f5caUL, 0x77630babUL,
+       0xca5111f1UL, 0x55becf6fUL, 0x1a546463UL, 0x8a417af3UL, 0x2c72cfaaUL, 0xda56f86cUL, 0xd7654c06UL, 0xbc8fdff3UL),
+    SC(0xb957ab6aUL, 0x0c7d7692UL, 0x65adf169UL, 0x492b00ebUL, 0x4d8a351dUL, 0x1f189d24UL, 0x3e66453fUL, 0x17696dcbUL,
+       0x47474297UL, 0x433f0297UL, 0x231e0d7fUL, 0xe51f1846UL, 0x3af3e463UL, 0xe071859eUL, 0xd6b12b05UL, 0x2191b839UL),
+    SC(0x53f2395bUL, 0xaf57e626UL, 0xf977deadUL, 0xda52c4a3UL, 0xf8b98701UL, 0xf57eb79aUL, 0x735e73b4UL, 0x4d4be4b5UL,
+       0x1a31bf14UL, 0x36b5dcfdUL, 0x5dc24ff2UL, 0xab5fc7e1UL, 0x015940bfUL, 0x12ae40b3UL, 0x073859ceUL, 0x5e26d55bUL),
+    SC(0x31f8493dUL, 0x8a81860aUL, 0x3762fbdbUL, 0x5b623358UL, 0xaf37ca99UL, 0x3ce1bdfdUL, 0x91f41acfUL, 0x5d8502ceUL,
+       0x1b231e3dUL, 0x9604e28fUL, 0x65d06f18UL, 0x10931210UL, 0x3a4cfba3UL, 0x95c6d856UL, 0xecc374beUL, 0x556a296bUL),
+    SC(0x77da894fUL, 0xef83a273UL, 0x22138b96UL, 0x64df3b02UL, 0xfdb5bf02UL, 0x4963a103UL, 0x1000ab37UL, 0xa821460fUL,
+       0x86cdc4bcUL, 0x3269d02fUL, 0xd3e97843UL, 0xfd2c9dfaUL, 0xc9ad2d99UL, 0xf7503222UL, 0x0ac4c4daUL, 0x5394809cUL),
+    SC(0xd222a486UL, 0xcdb8a4a2UL, 0x8c1030c4UL, 0x039b512fUL, 0xf849033fUL, 0xcc844e08UL, 0xfcfd8748UL, 0x1f68430aUL,
+       0x2d7d7e4aUL, 0x281ba28bUL, 0x75f2d966UL, 0x1d25a46fUL, 0x5ded9066UL, 0x7422a92cUL, 0x0bfcb1f1UL, 0x797b7e02UL),
+    SC(0xe4431b98UL, 0x21cfaa43UL, 0x8a8dee6dUL, 0xb7a19a38UL, 0x729622c7UL, 0x67cdc941UL, 0x789a6b78UL, 0xc7a2ae4dUL,
+       0x770e652eUL, 0xde9172c3UL, 0x4f50ed14UL, 0xbd8f83b0UL, 0x720ee2f5UL, 0x08717fc8UL, 0xa07de08dUL, 0x5f8ac400UL),
+    SC(0x01bb4bf1UL, 0x01a1fb6bUL, 0x78093ad1UL, 0x5fe5408bUL, 0xf9e1477cUL, 0x3844e243UL, 0xa14c37b4UL, 0xf394254bUL,
+       0xd9cf3fa3UL, 0x25a0ad1eUL, 0xfef984c5UL, 0x8cbe25d2UL, 0xf88f3051UL, 0x788cbd42UL, 0xa8f71791UL, 0x5229e944UL),
+    SC(0xa8fc65feUL, 0xe4df466bUL, 0xd6651ce5UL, 0x7ef030f8UL, 0x701e364dUL, 0xf1de5334UL, 0x92938856UL, 0xdeb74235UL,
+       0xb4c7da06UL, 0x4f7bcc17UL, 0xb3308c1bUL, 0xe7924317UL, 0xfc02c53aUL, 0x0808b47bUL, 0xd87700ceUL, 0x1adffc97UL)
+  },
+  {
+    SC(0x92133195UL, 0xa4fd0c59UL, 0x7e0cf65eUL, 0x8ce1d939UL, 0xe333f7a8UL, 0x441523aaUL, 0x31e339e1UL, 0x2ae51e8dUL,
+       0x0556a388UL, 0x7a7d579eUL, 0x87de7f49UL, 0x8c54bf24UL, 0x2ca4b8a2UL, 0x8b959e21UL, 0xceec4555UL, 0xb8fabccfUL),
+    SC(0x1badb614UL, 0x6a647a09UL, 0x894f60d1UL, 0x6544e992UL, 0x6da742d0UL, 0x032df02dUL, 0xea347ffbUL, 0xdd52f93bUL,
+       0x6927c950UL, 0x828e5449UL, 0xbafee29dUL, 0xe9977bdcUL, 0xcd6a0185UL, 0x3d3ef286UL, 0xd9854f9aUL, 0x75f5d4acUL),
+    SC(0xdbec52adUL, 0x5b8257f8UL, 0xf41612a2UL, 0x70047e4aUL, 0x715853a5UL, 0xf22091e3UL, 0x496a238eUL, 0xcf61379fUL,
+       0x1ed383f7UL, 0xdccbdff5UL, 0xbebe8f0cUL, 0x235767dcUL, 0xee220fa9UL, 0x8d1b5ef9UL, 0x6aba5ad7UL, 0x87b46252UL),
+    SC(0x5d2fc0e9UL, 0xa5b1a743UL, 0x131b4b16UL, 0x088d504dUL, 0x76422862UL, 0x942de800UL, 0x6c6d3611UL, 0x3443999eUL,
+       0xf7f89299UL, 0x64793634UL, 0x4156dce3UL, 0xca77c2bbUL, 0x40536f50UL, 0x60afd3b0UL, 0xa3b37d3dUL, 0x869dc11dUL),
+    SC(0x761a1b70UL, 0x83db07d7UL, 0x340fb1bdUL, 0xd5309ee0UL, 0xe9e05bf5UL, 0x6fc34a53UL, 0xb6034365UL, 0xffd91ac0UL,
+       0x82b1fac0UL, 0x3d382fd0UL, 0x109e45b5UL, 0x8a07638bUL, 0x1ce9ff2bUL, 0xf45d3cd9UL, 0x50843b69UL, 0x43c75c7aUL),
+    SC(0xea397afeUL, 0x9dcad2b9UL, 0x4ad000d1UL, 0x7abc4e5bUL, 0x739e4132UL, 0x997a7898UL, 0x3c6c5c29UL, 0xebf7222fUL,
+       0x24a87ba3UL, 0x411ca610UL, 0x5a696969UL, 0xf86ab751UL, 0x2c61e189UL, 0x5ff4ad18UL, 0x7193b5efUL, 0x7d8d2034UL),
+    SC(0x3dc03137UL, 0x8776b2baUL, 0x83a8124eUL, 0x821de26dUL, 0x1a52855dUL, 0xd610eec2UL, 0xd5c7eec5UL, 0x09c92e81UL,
+       0xb774a839UL, 0x6ad7b7adUL, 0x9e6275ebUL, 0x2731ad84UL, 0x271fb8b4UL, 0x6c3e12dfUL, 0xb74fe942UL, 0xe6dcd35bUL),
+    SC(0x49b98bedUL, 0xac9bbbbbUL, 0x75f4f3feUL, 0x310af59bUL, 0x1ec779cdUL, 0x41b75982UL, 0x6a929bcbUL, 0xd40ada85UL,
+       0xc09f3d79UL, 0x3b143720UL, 0xdbc1d04aUL, 0x4d559f35UL, 0xc650d372UL, 0x12668736UL, 0x1d824a9cUL, 0xb100630eUL),
+    SC(0x786555cdUL, 0x2c6344d5UL, 0x7f819963UL, 0x1ee8536aUL, 0xba3ed77eUL, 0x088501a2UL, 0x20df332eUL, 0xb41c9aeaUL,
+       0xf3e046a0UL, 0x3ea9d39bUL, 0x31377a11UL, 0xdcf7c2bbUL, 0x13ff138fUL, 0xf021902aUL, 0x4f927e3fUL, 0xf48a60c8UL),
+    SC(0x413259f7UL, 0x3ac4366cUL, 0x1385e7a3UL, 0x79f54796UL, 0x4b6295c1UL, 0x298fdb7eUL, 0x6046f711UL, 0x44ee3055UL,
+       0xa7a62864UL, 0x4717b82fUL, 0xb3fbb73fUL, 0xfae2318fUL, 0x985f1923UL, 0x7df110fbUL, 0x260434bbUL, 0x81bfb4ddUL),
+    SC(0x64922735UL, 0xde394c7cUL, 0x1d42e1efUL, 0xd8a19ef6UL, 0x0ef34e69UL, 0xdc12bce7UL, 0xc320f748UL, 0x3993bce2UL,
+       0x84bc17d5UL, 0x5711e228UL, 0x7e81ccaaUL, 0x9625c73cUL, 0x60923b0aUL, 0xf266b70aUL, 0x435b1c11UL, 0xe7d29fffUL),
+    SC(0x32d0955aUL, 0xc57511dbUL, 0x5f27606bUL, 0x67cdef94UL, 0xa001bdc2UL, 0xcc228bf2UL, 0x951f5426UL, 0x69d6dd51UL,
+       0x7f9bb41cUL, 0xd62d5863UL, 0xc2dfecdfUL, 0x8e3cc9c5UL, 0xd104abf4UL, 0x56b9030aUL, 0x552ed607UL, 0x73719520UL),
+    SC(0x2428069dUL, 0xb3ff968bUL, 0xd1559c74UL, 0xc3f38f17UL, 0xe725340bUL, 0xe956e6b6UL, 0xe6ae3a70UL, 0x4fe8af4aUL,
+       0x1f074994UL, 0xb487ca2cUL, 0x9bf222ecUL, 0x41cb54b1UL, 0xbac8dd57UL, 0x50e47f00UL, 0x59ee74a5UL, 0x01de0fb4UL),
+    SC(0xa7f35a96UL, 0xab880ce6UL, 0xb4e3c5baUL, 0x6502af7eUL, 0xcf00c685UL, 0xb260fe0cUL, 0x380ff875UL, 0x2bcb3e34UL,
+       0x7d47fcf3UL, 0xed09412bUL, 0xed9fc737UL, 0x212b6289UL, 0x8b415372UL, 0xc9338673UL, 0xa14e7f42UL, 0x7b4ac9d3UL),
+    SC(0xab624defUL, 0xee301bebUL, 0x96d2626aUL, 0x88a9adbbUL, 0x665f9e83UL, 0xf85640f3UL, 0x79e4ee7dUL, 0x0c9282b2UL,
+       0x4dd486c4UL, 0x3525c5d4UL, 0x668c5fb2UL, 0x7d03c985UL, 0xdf69a344UL, 0x62187396UL, 0xed9b360dUL, 0xfde32f72UL),
+    SC(0x0f6b26f3UL, 0xcb13dfe9UL, 0xdca461c8UL, 0x5b480140UL, 0xdf4a0c0eUL, 0xb1d2f5d7UL, 0x58de5173UL, 0xeb4c4746UL,
+       0xa5ab6d87UL, 0xe6852ce6UL, 0x9965a774UL, 0xccb94676UL, 0xa440d1d0UL, 0xc8b02f54UL, 0x21c11bdcUL, 0xb8406cfaUL)
+  },
+  {
+    SC(0xae5fb021UL, 0xe9256cc0UL, 0x6236d667UL, 0xb76b9bdfUL, 0x304a4683UL, 0xd2916ffeUL, 0x489cf019UL, 0x6b4c5683UL,
+       0xe768366bUL, 0x5c8d36b6UL, 0x18e45550UL, 0xd57493e2UL, 0x41fed17dUL, 0x12627e37UL, 0xb29b4b74UL, 0xd3603696UL),
+    SC(0xa4e569c7UL, 0x5d717debUL, 0x360a18b9UL, 0x5bc0fc36UL, 0xaf132603UL, 0xb74f3e0bUL, 0x1bca3e31UL, 0x14c28e64UL,
+       0xa70e832cUL, 0xe3d8d514UL, 0x84136fbaUL, 0x9f81a2d7UL, 0x8ab65b93UL, 0xdc9f9080UL, 0x1fcf3712UL, 0x74340130UL),
+    SC(0x2e7c85c5UL, 0x7e68056cUL, 0xe10ae193UL, 0x66807434UL, 0xc048a046UL, 0x430d2087UL, 0x92fc9b01UL, 0xdbe06508UL,
+       0x8c3f82a0UL, 0xb8cb5022UL, 0xdc7b04aaUL, 0x06445b06UL, 0xd251f9edUL, 0xbee00246UL, 0xc33785deUL, 0x979140ebUL),
+    SC(0xfadbb0f0UL, 0xb4bd864bUL, 0x73527365UL, 0x6455cc26UL, 0x71251519UL, 0x6c63dec4UL, 0x41052585UL, 0xfa86eb52UL,
+       0xbcc086d7UL, 0x54f08f77UL, 0x1888bef7UL, 0x4bd3bf9eUL, 0x35f8498aUL, 0xaa7cddbaUL, 0xacd63f0fUL, 0xef676738UL),
+    SC(0x4aa439c5UL, 0x2a0dd24dUL, 0xc5f72b14UL, 0x9a39e991UL, 0x6dbcd4bcUL, 0x4619fd34UL, 0x94012a4dUL, 0x430a2b0eUL,
+       0x5482d41cUL, 0x7fda4591UL, 0x4150d653UL, 0x2173b658UL, 0xb5a06046UL, 0x8270fc7cUL, 0x2ea19d58UL, 0x7b96e9fdUL),
+    SC(0x2e1c9639UL, 0x537015afUL, 0x7de6bd50UL, 0xe2697661UL, 0x8ac633e5UL, 0xf1946af5UL, 0x34bdbc5cUL, 0x9797aa4fUL,
+       0xb6a39518UL, 0xc607d0d2UL, 0x94a36682UL, 0xf4f6493bUL, 0xc80f1624UL, 0x792fec2eUL, 0xe971f080UL, 0x37dc6dcdUL),
+    SC(0x63f28872UL, 0x6d86ffbeUL, 0x28a516e4UL, 0x75f67972UL, 0xe6266038UL, 0x3be45c0fUL, 0xd22e9a6dUL, 0xd5d240edUL,
+       0xf62ca816UL, 0x0059ac13UL, 0x10854091UL, 0xc7851bc0UL, 0x4d315466UL, 0xb6187327UL, 0x3af16f9fUL, 0x68597dc7UL),
+    SC(0x576c051bUL, 0x2f4d2aceUL, 0xca5c067eUL, 0x290a4d5fUL, 0x0d8f9b6fUL, 0x19d4652aUL, 0x449fc1d6UL, 0x9d4b762dUL,
+       0xa2b94a16UL, 0x903d80d3UL, 0xf965c43fUL, 0xb751dc44UL, 0x690f18fdUL, 0xbf3e29f7UL, 0xe21b855aUL, 0x837664bdUL),
+    SC(0x876afd3dUL, 0x8466f7eaUL, 0xeed3ee7cUL, 0xe809528fUL, 0xc4b392c9UL, 0xefcc1f9eUL, 0x753b4dd9UL, 0x0b84722eUL,
+       0xe4453b1fUL, 0xc3fcd636UL, 0xb2c9bf97UL, 0x6816b60cUL, 0x246e254aUL, 0x67bf2e59UL, 0x22f835afUL, 0x103c1107UL),
+    SC(0x5a2ca063UL, 0x6453a00dUL, 0xb8cd6f60UL, 0x3434f0d8UL, 0x8642c119UL, 0xb6302766UL, 0x8ee67dc7UL, 0xc10c9e3bUL,
+       0x17be303eUL, 0x40bdb2d5UL, 0x9dfe354bUL, 0xe58a387bUL, 0x0ff64112UL, 0x3f6a13b2UL, 0x080876a7UL, 0x24c4d601UL),
+    SC(0x46fbb84cUL, 0xd08ce9d4UL, 0x073e3b00UL, 0xf5ba4cc2UL, 0xf10fb84bUL, 0xea34a8f2UL, 0xde114c31UL, 0x8616def2UL,
+       0x62410bd7UL, 0x2ffda863UL, 0x2400747dUL, 0x1984d1f7UL, 0xda285e9cUL, 0x592729bbUL, 0xad9cee72UL, 0xd266fc78UL),
+    SC(0x417f7895UL, 0xe2bc2999UL, 0x469ce63bUL, 0x66cc9bbcUL, 0x4581b42eUL, 0xc62171a8UL, 0xac32bdd5UL, 0x23435283UL,
+       0x1a5e10efUL, 0x826f058aUL, 0x175fa5d5UL, 0x21594182UL, 0xa61a5a07UL, 0x406e1f00UL, 0x396935beUL, 0xf78c9ef8UL),
+    SC(0x916866c2UL, 0xf33c0942UL, 0xc8f12e54UL, 0x8771645cUL, 0xe1581ee8UL, 0x06f58a90UL, 0x67ededc6UL, 0xb70e93b4UL,
+       0xc7945f0bUL, 0xd100c3a4UL, 0xd624e527UL, 0xea9a8d9fUL, 0xcedc9934UL, 0xf903955bUL, 0xaba58be3UL, 0x0c23819bUL),
+    SC(0xc3630c36UL, 0xacc78b38UL, 0x8c5e8604UL, 0x8110f113UL, 0x3638c78bUL, 0xfad169d9UL, 0xd25d66fbUL, 0x0728ed4bUL,
+       0x5788b6d1UL, 0x7c74f601UL, 0xe2bf5d77UL, 0xeec182adUL, 0x1d9b2a89UL, 0x06da8962UL, 0xf9887bdbUL, 0x5a6918e0UL),
+    SC(0x64fd5fe6UL, 0xcf91f11cUL, 0x970692cdUL, 0xd2ba6bd3UL, 0x4d17faa7UL, 0x77ace6dbUL, 0xd161e63bUL, 0x93a0ee19UL,
+       0x37ce3afeUL, 0xf75712c3UL, 0x301e4c97UL, 0x6456ad79UL, 0xe09326b2UL, 0x28b23e10UL, 0xb033bc53UL, 0xa6efd060UL),
+    SC(0x2ff8f0e0UL, 0x5d514fe5UL, 0x766bc683UL, 0xf82af019UL, 0x471a173bUL, 0xb0e2ccb7UL, 0x53eb45a5UL, 0x08047041UL,
+       0x9a13b872UL, 0xe26b58d8UL, 0x68e1db1dUL, 0x7391afc1UL, 0xece8e410UL, 0xa4bc3f42UL, 0xdcae2b27UL, 0xec9a6e98UL)
+  },
+  {
+    SC(0x782d5c9aUL, 0xd970322eUL, 0xdeff2e7bUL, 0x57844184UL, 0xc589a4daUL, 0xc042fcf3UL, 0x86c1a9f8UL, 0x26c1babbUL,
+       0x27bba565UL, 0x405cb392UL, 0x64762d97UL, 0xcbaff552UL, 0x1bc38b20UL, 0x56afe313UL, 0x556542d3UL, 0xf200eb06UL),
+    SC(0x69040dabUL, 0x81af8b4bUL, 0x0759b852UL, 0x40c16380UL, 0xcc2bc3a5UL, 0xbc8e9e68UL, 0x7cee93a3UL, 0x352d8055UL,
+       0xe48d161eUL, 0x0b63c619UL, 0x26c78402UL, 0x528ad5a7UL, 0x19a7fef4UL, 0x4c03b933UL, 0x37d51bfaUL, 0xec497817UL),
+    SC(0xd00d4407UL, 0xf7a1bc4aUL, 0x57ce72b3UL, 0x6fba7d8eUL, 0xca4f2303UL, 0x292c2ebfUL, 0x6940b34fUL, 0xfd98aafaUL,
+       0xebdee075UL, 0x32ccf753UL, 0x1806337bUL, 0x54a36a53UL, 0x1641fb80UL, 0x64d928acUL, 0x5a3626bfUL, 0xe16dba4fUL),
+    SC(0x9a3ab165UL, 0x66f8c8abUL, 0x7b3d0d5fUL, 0x7a3ec7bfUL, 0x3cb69c0fUL, 0x31346486UL, 0x10c552f8UL, 0x17a4abe2UL,
+       0x7eafa760UL, 0x7fb4cea0UL, 0xdedcfb1bUL, 0x1c16ebb9UL, 0x8904a79eUL, 0x37395aa3UL, 0x1ced5c71UL, 0xfc8c7774UL),
+    SC(0xf9028f3fUL, 0x4f5752a9UL, 0x9ce55412UL, 0x876c7067UL, 0xa199a338UL, 0x1d707bb9UL, 0x03d2fc44UL, 0xb165d000UL,
+       0xa7346d7bUL, 0x6ea796e3UL, 0x2a19f104UL, 0x34a7e0d7UL, 0xb7e90326UL, 0x81374d05UL, 0x9b81badbUL, 0x4dd651daUL),
+    SC(0xe7bd1e16UL, 0x60174f67UL, 0x13a8db0dUL, 0x2bf88a45UL, 0x275a44e2UL, 0x9a461c1dUL, 0xcc6dc5c4UL, 0xfd2b5c0fUL,
+       0x9732850bUL, 0x41082c88UL, 0x5ab49289UL, 0xfe11094fUL, 0xc26bf80dUL, 0x1b0998c5UL, 0x1ce63cdeUL, 0xd7bad0fdUL),
+    SC(0xd8b88e20UL, 0xee8db21eUL, 0x28bd271bUL, 0x46d77769UL, 0xb446994fUL, 0x5eb35ea8UL, 0xd0613b29UL, 0x067f8c1aUL,
+       0x8b9905cfUL, 0x547475e5UL, 0x838e9191UL, 0x388b1c64UL, 0x25fea463UL, 0x1e4ef825UL, 0xe84e2226UL, 0x2888d0b7UL),
+    SC(0x3dfae04aUL, 0x180749e7UL, 0xe6949aa5UL, 0x600ebe40UL, 0xaf61d644UL, 0xab5446ddUL, 0x4b3334ddUL, 0x0f9bd7ceUL,
+       0x963fb79aUL, 0xa952447dUL, 0xe274666fUL, 0x16c08a2fUL, 0xd5864825UL, 0x78b870deUL, 0xafbd98c6UL, 0xadf4cca4UL),
+    SC(0x04e0f4c4UL, 0xb4905983UL, 0xe12cf9cdUL, 0x7dbcdf18UL, 0xdb9782b7UL, 0xd4ea7e11UL, 0x00280d1fUL, 0x7bc01e53UL,
+       0x03305aebUL, 0x9b5f23afUL, 0xbf1c759cUL, 0x14a811a0UL, 0x1bc3a5aaUL, 0x19e26176UL, 0x71690393UL, 0xf3318bc6UL),
+    SC(0xd74e6ecdUL, 0x72453ee3UL, 0xf68fc29fUL, 0xf0de5b36UL, 0x82c295dfUL, 0x2fc568a9UL, 0xd68ad747UL, 0xd4409b77UL,
+       0x46dfc1afUL, 0x00819ee0UL, 0xfd04e0cbUL, 0x1af0835bUL, 0xe8f6e53fUL, 0x1ed28d67UL, 0x6c0c172bUL, 0x2e56a74aUL),
+    SC(0xd1ef8f37UL, 0x78dfe4bcUL, 0x83c48c4fUL, 0xe9aeb917UL, 0x34320f2bUL, 0xa86630e5UL, 0x28f735d4UL, 0xfd78fc68UL,
+       0x6cc62683UL, 0x1e417caaUL, 0x9bdafef9UL, 0x92c7267aUL, 0xe7ace1a9UL, 0x27d225e2UL, 0xa5000b97UL, 0xc45007c1UL),
+    SC(0x64457682UL, 0x4f541ec7UL, 0xd8ba1964UL, 0x32146322UL, 0x3d1bd634UL, 0x5cd09f03UL, 0xa91aff2eUL, 0xb9502b15UL,
+       0x236ca78eUL, 0xbec84846UL, 0x74c43c52UL, 0x55e2cb76UL, 0xb41b01daUL, 0xded4dedeUL, 0x1a99e1b5UL, 0x8fe80638UL),
+    SC(0xf557af63UL, 0xf3d8437cUL, 0x1c48619cUL, 0x4bad3e7fUL, 0xd92c6ff6UL, 0x63b86121UL, 0x55bba4b7UL, 0xefbf350cUL,
+       0xefe2dfeaUL, 0x62a12ffeUL, 0x5e4208b8UL, 0xe5af4f07UL, 0x13f8de73UL, 0x824502e6UL, 0x94b08d34UL, 0xd1d92e2fUL),
+    SC(0xf45ade55UL, 0x84070898UL, 0x1d244e7eUL, 0xa546a34dUL, 0x85fb1164UL, 0x5ea86188UL, 0x43d753d4UL, 0x2baa1ecbUL,
+       0x0ec25cb2UL, 0x6574f472UL, 0x69a90070UL, 0x3eff9a68UL, 0x770ffa2aUL, 0x7b12efa1UL, 0xdcd81ce3UL, 0x56a46978UL),
+    SC(0xe3169959UL, 0x74f4127dUL, 0xe9002439UL, 0x582f9790UL, 0x6047bb58UL, 0xd4bfdf74UL, 0x3b6ebea5UL, 0xb5663d65UL,
+       0xcf7afc59UL, 0xefac3d94UL, 0x88260d14UL, 0xa3e252e0UL, 0xb51345bcUL, 0xd3e07c1dUL, 0x0b07ec4eUL, 0x28b6d60eUL),
+    SC(0xbc9112f0UL, 0x137446bdUL, 0x1a218167UL, 0x72b6afd7UL, 0x65b19569UL, 0x90f8e53aUL, 0xf8db935cUL, 0x2a88686bUL,
+       0x0a74e4d7UL, 0x1e24d149UL, 0x1667dcedUL, 0xbd7f58abUL, 0x851d685bUL, 0x1c29e38dUL, 0x6c9e613dUL, 0xb65b7864UL)
+  },
+  {
+    SC(0xebc119d3UL, 0x8e794efaUL, 0x0085fcbdUL, 0x5affac35UL, 0xf73c7428UL, 0x590ede0fUL, 0x6365f1eaUL, 0x87c65b4bUL,
+       0x183a9992UL, 0x3911b1b1UL, 0xcd9b0feaUL, 0x3667b6e1UL, 0x52af7499UL, 0x8d32beb3UL, 0xd2ecb91dUL, 0xaf6e8a06UL),
+    SC(0x7ce4a044UL, 0xe4656f8cUL, 0x687bc693UL, 0x1c6fcca1UL, 0x95322643UL, 0x000db41dUL, 0x8407d880UL, 0x4d6b6cb0UL,
+       0x14fe83faUL, 0xeb944cd6UL, 0xdab9e7b6UL, 0x279ebde1UL, 0x6ce1028eUL, 0x5df74c77UL, 0x7e6e00ddUL, 0x55f69465UL),
+    SC(0x5226b60eUL, 0x0b344786UL, 0xbf572e3eUL, 0x33e5aa14UL, 0x6ee6feafUL, 0x35c3a2b7UL, 0x22118560UL, 0x0183cadbUL,
+       0xcb650e9cUL, 0xe4f93861UL, 0x0cdb700dUL, 0x13557323UL, 0x8a7d7686UL, 0xe22943f6UL, 0x433dab6dUL, 0x96253b10UL),
+    SC(0x21c0342bUL, 0x9a723249UL, 0xae7193feUL, 0xaa00baf6UL, 0x0beeb376UL, 0x1f1bb125UL, 0x7d0d9549UL, 0xd46b403bUL,
+       0x5b2dfee9UL, 0x4a67c6a4UL, 0x0def4f55UL, 0xa14af716UL, 0xab1be308UL, 0xecac6042UL, 0xf86679a2UL, 0x1f5114a0UL),
+    SC(0x82e97dbfUL, 0xf1d0d9bcUL, 0x65797145UL, 0x7c5aad62UL, 0xea75753fUL, 0xdf9d3e15UL, 0xefcd3ba0UL, 0x285d3476UL,
+       0x7f67ccc2UL, 0xf0aa795aUL, 0x890d9a30UL, 0x6838b9d3UL, 0xc64c1371UL, 0x75b0ab05UL, 0x68622b3cUL, 0x0fdc8d25UL),
+    SC(0x6c02ace6UL, 0x1f479fbfUL, 0x11059054UL, 0xd8dc5761UL, 0xca0a97a0UL, 0x22e520c4UL, 0x08aa2f32UL, 0x448b7392UL,
+       0x4e57f208UL, 0xceed832aUL, 0x3626f347UL, 0xf8a30956UL, 0x13a17e57UL, 0xb0159ca5UL, 0x33143166UL, 0x77b91469UL),
+    SC(0x8a367826UL, 0xe40db24eUL, 0x28fe31c2UL, 0xfe24151cUL, 0x8e4702b2UL, 0x43a99d86UL, 0x5448d83bUL, 0x0cf49a6fUL,
+       0xb2bf6c78UL, 0x299dc024UL, 0x2fc66392UL, 0xcf6c5097UL, 0x42a05f15UL, 0x0935c835UL, 0x3944e66bUL, 0xbbb87c26UL),
+    SC(0xc1c3921aUL, 0x14f64598UL, 0x11aa70c3UL, 0xf756e689UL, 0x82233a48UL, 0x588bdfb7UL, 0x84348459UL, 0x19125af6UL,
+       0x6f7109d9UL, 0x47dabea5UL, 0xda858a4cUL, 0x75ba6c3fUL, 0x162ad404UL, 0x15e7ab46UL, 0x7247963eUL, 0x8f4a1326UL),
+    SC(0xebedcd5aUL, 0xe0f0005bUL, 0x2eb70d40UL, 0x4a1bd4a5UL, 0xf0537c48UL, 0xe8f6149cUL, 0x0c042f9aUL, 0x773c75c5UL,
+       0x2b7103daUL, 0xd29bb9d2UL, 0xc07def6eUL, 0x1094fa50UL, 0xea70f7c0UL, 0x4f609b4cUL, 0xbee0d576UL, 0x57e506d6UL),
+    SC(0xbda6fac6UL, 0x99e09a50UL, 0xee0131c1UL, 0xefaaec6cUL, 0x7cde205cUL, 0xd3b55c83UL, 0x176d20c7UL, 0x80678bc2UL,
+       0x881c023cUL, 0x86b948edUL, 0x31a5cdffUL, 0x8f3f985eUL, 0xcfec9111UL, 0x627d813fUL, 0x177afa76UL, 0x89a16f89UL),
+    SC(0xf6d335acUL, 0x66fc71a8UL, 0x319eaa38UL, 0x3eeb7fb7UL, 0x41118280UL, 0x531434f9UL, 0xcb0b364eUL, 0x90babd42UL,
+       0xb14c40c7UL, 0x8846262bUL, 0xe117735aUL, 0x30a3185bUL, 0x49f8852dUL, 0x2e3aa8f3UL, 0x3dba4806UL, 0xea7ff2cbUL),
+    SC(0x0c5588c4UL, 0xfcaa5c53UL, 0x79f910feUL, 0x9bfa1224UL, 0xfd20aaccUL, 0xf1efdb2dUL, 0x07ba87c5UL, 0x3615ddbcUL,
+       0xe60ac5b9UL, 0xfa96e150UL, 0x057378c1UL, 0x11f384bcUL, 0x16fb32a0UL, 0xa0482f26UL, 0x603aca30UL, 0xed1315fdUL),
+    SC(0xdb88be26UL, 0xbbab7b99UL, 0xf0f20c61UL, 0x40ac77b0UL, 0x28afd465UL, 0xaa4d1294UL, 0x9011a47bUL, 0xb1d87f89UL,
+       0xe126d612UL, 0x91ef9a77UL, 0xe90a8522UL, 0xee6e7dfdUL, 0xfbfbc2a9UL, 0x90986da5UL, 0x65919317UL, 0xdd4ebd1aUL),
+    SC(0x1150279eUL, 0xe9c0323bUL, 0xb122c2daUL, 0x6e8b28edUL, 0x5e5b02a2UL, 0x162067baUL, 0x67f5aff5UL, 0xe99214fcUL,
+       0x74d876d8UL, 0x4d00e091UL, 0xef0aeaf9UL, 0x5aefda58UL, 0xf3da4d52UL, 0x51b2b28eUL, 0xcec41a23UL, 0x4b420401UL),
+    SC(0x1bfe1d76UL, 0x43526f3aUL, 0xe0799982UL, 0x69f9679aUL, 0x9a54f1eeUL, 0xbdad1f6cUL, 0x9c8e096bUL, 0x6e771023UL,
+       0xad94d693UL, 0x961644ceUL, 0xa37ee705UL, 0xe06b4b5bUL, 0x32c17011UL, 0x7aba021dUL, 0x6cf48746UL, 0xd8637dc0UL),
+    SC(0x928b3e6fUL, 0xa0e6c2c5UL, 0x896f6eb3UL, 0x972fe96fUL, 0x7e446782UL, 0x50d313d1UL, 0x54ffd666UL, 0x2b43a615UL,
+       0x50f2d7d5UL, 0xfa221867UL, 0x03f18540UL, 0xf2f7b513UL, 0xb6b4875bUL, 0x9ed4a5baUL, 0x73de7800UL, 0x37f842d8UL)
+  },
+  {
+    SC(0xbc4bb9a6UL, 0x292aa09fUL, 0x5c66dc9bUL, 0x667c4642UL, 0x6b08211fUL, 0xa9a80f5eUL, 0x00f3f17bUL, 0x21f275deUL,
+       0x5d0e0492UL, 0x39a862ecUL, 0xb9649572UL, 0x6f11bc09UL, 0xcebd9f29UL, 0xd9407ab3UL, 0x1603054dUL, 0xd9b76b07UL),
+    SC(0xbf330f50UL, 0xa9c015fdUL, 0x8ff93153UL, 0x561ecb91UL, 0x27b84420UL, 0x62fadf17UL, 0x3dec27e2UL, 0x00a5f7b0UL,
+       0x931f0891UL, 0x94aefbf5UL, 0x9c530d74UL, 0x8ccf5a5dUL, 0x83f3fb1fUL, 0xcd9043eeUL, 0xebf50994UL, 0xd8ec1248UL),
+    SC(0x033db24eUL, 0x0b1ba1a5UL, 0xcbe2832eUL, 0x50d877c8UL, 0xa4fea4d3UL, 0xe63d7c71UL, 0xfe8cf9eaUL, 0x9fcd1cc5UL,
+       0x8b0db6a2UL, 0x37555121UL, 0xec8a2ed0UL, 0xe8f80dfdUL, 0x37082a0aUL, 0x883d3fb7UL, 0xd7d2dbd4UL, 0x07c01f6cUL),
+    SC(0xeefd96d2UL, 0x1d6639dbUL, 0x6a7f3a79UL, 0x26f5bcd6UL, 0x618e6ae1UL, 0x70551973UL, 0x7dfca216UL, 0x565513d3UL,
+       0xd7644dcfUL, 0x0e46715cUL, 0x1821babfUL, 0x5ab153bfUL, 0xa80d20a1UL, 0x252718b9UL, 0xb72f299dUL, 0x21ba7218UL),
+    SC(0x48c08093UL, 0xfc737bb5UL, 0x70a31154UL, 0x0290f709UL, 0x3467c915UL, 0xc4afcf6dUL, 0xae372e42UL, 0x3ed69815UL,
+       0x29581f74UL, 0x659462b1UL, 0x3951d930UL, 0xa8912e33UL, 0xa2928e34UL, 0x5e3563feUL, 0xf88b42d2UL, 0x28af2f26UL),
+    SC(0x68c61ae5UL, 0x015c1ebbUL, 0xd395febaUL, 0x8661a967UL, 0x162dcbacUL, 0x5cb13303UL, 0x9a354c11UL, 0xee217267UL,
+       0x9db2d6cbUL, 0x0b3880abUL, 0xddf58293UL, 0x7f76ad7aUL, 0x70fb1c58UL, 0xd2eb9a5cUL, 0x468331b4UL, 0x55c5ece9UL),
+    SC(0x99afe669UL, 0xbaf69344UL, 0x16b388b8UL, 0x30b97e80UL, 0x86886c62UL, 0x86870e7fUL, 0x058d6efcUL, 0x377ded78UL,
+       0xa684a9dcUL, 0x84881a2fUL, 0xbc340b96UL, 0x4180a966UL, 0xd00aa5ceUL, 0x513693e7UL, 0x9052795dUL, 0x74f08f7cUL),
+    SC(0x3e893680UL, 0xb103cb80UL, 0xe6a4eadcUL, 0xabdd4eedUL, 0x6fd53341UL, 0xd08d6d78UL, 0x85fde37aUL, 0x49621bdbUL,
+       0xd342db6aUL, 0xa942396fUL, 0x76b79de6UL, 0xa6d48943UL, 0x2beb59ecUL, 0x4d1d6399UL, 0x09244bd1UL, 0x731a6855UL),
+    SC(0xe19eee8cUL, 0x7206fe64UL, 0x0a217e60UL, 0xc791c834UL, 0xde7cecf4UL, 0x3ae1cf42UL, 0xb697941bUL, 0xc556252bUL,
+       0xcf79152bUL, 0x76b0ef1fUL, 0xabd36175UL, 0x48701716UL, 0x32ffe2a1UL, 0x57b006ccUL, 0x4fceb313UL, 0x17be8fd8UL),
+    SC(0x50d544c9UL, 0xb3a10831UL, 0xe325dbcfUL, 0x6b13c6ceUL, 0xa06ba82fUL, 0xec3e5b9fUL, 0x9442101aUL, 0xa4c64d46UL,
+       0xa89b1cfbUL, 0x169019acUL, 0x19785c9bUL, 0x8fd27f1fUL, 0x177adcc6UL, 0xc9b995b3UL, 0x43b373f5UL, 0xcd82c9cbUL),
+    SC(0xe34ff94cUL, 0x729ca264UL, 0x1cd51264UL, 0x1eea2aa7UL, 0xebb5c577UL, 0x71bd1900UL, 0x86a02aeaUL, 0x7cc2c1b3UL,
+       0x454dd58fUL, 0x0c46f61cUL, 0x30efbfe8UL, 0x49c7b2eeUL, 0xb1a99bbeUL, 0x6c8a4f6eUL, 0xc0063a46UL, 0xa1f63f86UL),
+    SC(0x50a5b0a6UL, 0x919974b8UL, 0x14c10ffcUL, 0x8c6233f2UL, 0x843840a5UL, 0x834ff5b6UL, 0x75134ee8UL, 0x4f40a716UL,
+       0x6cbafa57UL, 0xec555bd5UL, 0x2f656a95UL, 0x3d592aafUL, 0xe963d403UL, 0x40a7540bUL, 0x644855faUL, 0x7c94c3adUL),
+    SC(0x0b5f7dfcUL, 0x438a381dUL, 0x0edfb576UL, 0xaa62f2e2UL, 0x12264e1dUL, 0x8222bea4UL, 0xf71ba06aUL, 0xb2b6f0ccUL,
+       0x396484f5UL, 0x3a14cd16UL, 0x58813612UL, 0x2fc55f7eUL, 0x89c4fcabUL, 0x06d73e5aUL, 0xfdeffadcUL, 0x3c9f9b0dUL),
+    SC(0x4e2a7b73UL, 0x1bba01ceUL, 0x68f4becfUL, 0x34ab78b4UL, 0x3c89f711UL, 0x3214fc8fUL, 0xba3e19e6UL, 0xa449b7f2UL,
+       0x0aa85874UL, 0xbca558b2UL, 0x0e674623UL, 0x3e0ab93dUL, 0x04ec34ebUL, 0x6998f0dfUL, 0x3f153126UL, 0x93739077UL),
+    SC(0x3835d447UL, 0xf4da18c2UL, 0x1fea247cUL, 0x9ff3436dUL, 0xbd60878cUL, 0xdd347f4cUL, 0xca1168f7UL, 0xae189eceUL,
+       0xdf5da21fUL, 0xf6a6add7UL, 0x17e53e6aUL, 0xff0220d8UL, 0x9b1e71a1UL, 0x30339194UL, 0x081bbec2UL, 0x40414a1cUL),
+    SC(0x82452834UL, 0xe84617feUL, 0xd7d32149UL, 0x6abdcc54UL, 0x2af5fa13UL, 0x8f55faa7UL, 0xc2245cdcUL, 0x48c89f06UL,
+       0xc01d6da3UL, 0x96b923c7UL, 0x290dbd1aUL, 0x6c16a69dUL, 0x8a872638UL, 0x04f6285aUL, 0xf589a0d0UL, 0x20e892acUL)
+  },
+  {
+    SC(0xc8e595d2UL, 0x666f4913UL, 0x1f375b67UL, 0x81b9113aUL, 0x0d0760e5UL, 0x9477ca17UL, 0x8863828bUL, 0x307488f0UL,
+       0xa82cf2a9UL, 0xd823af13UL, 0x5c23a04bUL, 0xbc12dd81UL, 0x2c352a48UL, 0x27e19030UL, 0x8e089d9dUL, 0x9c316596UL),
+    SC(0x026da38bUL, 0x1bfa8363UL, 0x6be480cbUL, 0x0684ee5cUL, 0x70957f93UL, 0x7f9a2d57UL, 0x3ec75396UL, 0xbfee49faUL,
+       0x9763277dUL, 0xf3c228b8UL, 0x515bd08eUL, 0xb29dffccUL, 0xeac8e3aeUL, 0x786a9655UL, 0x5fc1be21UL, 0xcdd20d47UL),
+    SC(0x52063926UL, 0x34d12242UL, 0xb2ff32c7UL, 0xd0a8bb47UL, 0xfbbd005aUL, 0xbf7f92ceUL, 0x078808a5UL, 0x7b1cbe55UL,
+       0x0d0cfa8eUL, 0x49b45823UL, 0x881819ffUL, 0xfdbb6d2fUL, 0x5c65f35fUL, 0x3572e13bUL, 0xff7af252UL, 0x95efe81eUL),
+    SC(0xaf61f7dcUL, 0x8ceb2277UL, 0xdb16412eUL, 0xdc469b2bUL, 0xf0e188acUL, 0x89c72bcfUL, 0x20654379UL, 0x716115f7UL,
+       0x524b9b25UL, 0x925b793aUL, 0x8bdb8e06UL, 0x83cdb414UL, 0xdb0f6dfbUL, 0xe7e06274UL, 0xd61ef87aUL, 0x13493b66UL),
+    SC(0x39e53a5fUL, 0xf553d89bUL, 0xdcbd6688UL, 0x9eabd7d3UL, 0x8c5fc6baUL, 0x24618d98UL, 0x88bb6e42UL, 0x92658f06UL,
+       0xae8439bbUL, 0x6d32531cUL, 0x45ac510eUL, 0x20f1c7d2UL, 0xb8dc70a6UL, 0x65c11f2cUL, 0xcda73603UL, 0x97c6580cUL),
+    SC(0xb687e250UL, 0x531efb00UL, 0xf7e12690UL, 0x659bfe25UL, 0x429ea2e6UL, 0xf1dec5ebUL, 0x74bbd1e4UL, 0x89a95e31UL,
+       0x1033e5b7UL, 0x9c0adb6dUL, 0x0c0f12ffUL, 0xafc5d81bUL, 0x54d7930fUL, 0xf6190decUL, 0x737bbb3eUL, 0xc4c774baUL),
+    SC(0x4c17f5ecUL, 0x34cdd368UL, 0xdbb62f20UL, 0xc3b86483UL, 0x24e99e0eUL, 0x95a7e624UL, 0x64cabe76UL, 0x222981a9UL,
+       0x1e37e3dfUL, 0xb690b574UL, 0xa11c9803UL, 0xf1cb5618UL, 0xce4a0331UL, 0xe17c5cb5UL, 0x4873ed6dUL, 0xde217019UL),
+    SC(0xbb7c4b21UL, 0x77b77a9fUL, 0x8f78c2e6UL, 0x25bb943eUL, 0x9d05dbedUL, 0xabdbe02eUL, 0x497e5dabUL, 0xc31dc477UL,
+       0x0a5f38fbUL, 0x7ebbe67aUL, 0x869b90d1UL, 0xaa4fbaf5UL, 0xcd7173b0UL, 0x46cf3c5cUL, 0xb31a272cUL, 0xc0693c82UL),
+    SC(0x3b18ce78UL, 0x6688a74aUL, 0x7256c067UL, 0xa412aa59UL, 0x45fbb506UL, 0xfbf801b8UL, 0x61734ab6UL, 0x400744c8UL,
+       0xd4f01881UL, 0x47809cf6UL, 0x5226529bUL, 0xacf6e81bUL, 0x7fdb609eUL, 0x3eee050dUL, 0xec0f3140UL, 0x2308ae20UL),
+    SC(0xb671371eUL, 0x2f0b770dUL, 0x0af8fb77UL, 0x6a64948cUL, 0x1481cba2UL, 0xafd1a3c1UL, 0xbd233946UL, 0xe34c86afUL,
+       0x4a58dda7UL, 0xee794384UL, 0x0496c539UL, 0x7ccfaef9UL, 0x0fd75d05UL, 0xc551e26dUL, 0x2ac631e0UL, 0x3d124fecUL),
+    SC(0xcaa559f1UL, 0xb0afb30bUL, 0xd62ede02UL, 0xa9e28a9dUL, 0x8bbb437dUL, 0xe9a8963cUL, 0x37e25898UL, 0x428b845cUL,
+       0xf73a14efUL, 0x2078cc23UL, 0x92b99742UL, 0x9dce6a50UL, 0x5682bdb8UL, 0xc2b5e587UL, 0x31786814UL, 0x9c777411UL),
+    SC(0x2676f258UL, 0xa761c508UL, 0x5176ceedUL, 0xa95cf9eaUL, 0x4d6640dfUL, 0xa2c4abc3UL, 0xe4954225UL, 0xc23acf9fUL,
+       0xfdc42fdfUL, 0xb1636050UL, 0x67786940UL, 0x3aea320fUL, 0x8ec1e8faUL, 0xb9033c3fUL, 0x2b919f50UL, 0xfac0271bUL),
+    SC(0xce17ef68UL, 0xf6c7b456UL, 0x4cab6be5UL, 0x22495389UL, 0x874f296eUL, 0xb62d552bUL, 0x6d621607UL, 0x192005e9UL,
+       0x94fd30c8UL, 0x71add5fbUL, 0x5161b468UL, 0xab60d254UL, 0x472339c5UL, 0x2668437eUL, 0x7e172ec4UL, 0x957d00c3UL),
+    SC(0x042fca34UL, 0xdf3ec118UL, 0x417d8d18UL, 0x04e507f2UL, 0x91d402aaUL, 0x32c00b5bUL, 0xa1dee38eUL, 0x7fb0cc35UL,
+       0xa046e52aUL, 0xfb7eaf45UL, 0xbb3205e9UL, 0x56e0e780UL, 0x977bff46UL, 0xea65633cUL, 0xcb0cd2b4UL, 0xa3aeb2aaUL),
+    SC(0x99926617UL, 0xc15dcd0cUL, 0x95ff4903UL, 0xed9d6050UL, 0xad0e1982UL, 0x84a3c9f9UL, 0x6a24ed55UL, 0x45641b13UL,
+       0x64437785UL, 0xafc882ebUL, 0x4a78844dUL, 0x14d79cc7UL, 0xcead217aUL, 0x3cdba8e8UL, 0x473374e3UL, 0x4d416b56UL),
+    SC(0x3d4751a6UL, 0x99a8e88cUL, 0x0aff3dafUL, 0x3ddcebb2UL, 0x63f0d56eUL, 0x6d305245UL, 0x4c16b0c6UL, 0xf80e0d93UL,
+       0x162f562dUL, 0x32595699UL, 0x0172a5c6UL, 0x4ba2dd35UL, 0x11bc5430UL, 0xf21495d1UL, 0x2ae9f6a0UL, 0x638c613aUL)
+  },
+  {
+    SC(0x49e7429bUL, 0xe0d97bf9UL, 0x3f17e9a8UL, 0x53fedb6aUL, 0xa9bc6eddUL, 0x8e85f44bUL, 0x9d2f1469UL, 0xb2d3b178UL,
+       0xff9e5dfcUL, 0x2746679eUL, 0x9826039dUL, 0x578bac31UL, 0xc08fbaacUL, 0xa075214cUL, 0x0073c50fUL, 0x74568fffUL),
+    SC(0x1d1c9798UL, 0x3eef36d2UL, 0x75478b94UL, 0xecd3e172UL, 0xa39e49c7UL, 0x1c79f932UL, 0x2077f410UL, 0xe1a9d0aeUL,
+       0x5d8d6ec8UL, 0xaef80d94UL, 0x3e75ab6fUL, 0x68408d84UL, 0x6cf94216UL, 0xaf6e06efUL, 0xdd7e9e72UL, 0x4abcd7b4UL),
+    SC(0x60f8ca6dUL, 0x1d60f524UL, 0x8d582e8bUL, 0xea2fb8a0UL, 0xdd2ddb3fUL, 0x49bedc03UL, 0x5d24973eUL, 0xaead0b41UL,
+       0x7c4e8b11UL, 0xb0e8b135UL, 0xbedc60ccUL, 0xfd540dabUL, 0xda868d50UL, 0x78386acaUL, 0x117bb71eUL, 0xe108fc51UL),
+    SC(0xc6f57fa7UL, 0x6d2ce583UL, 0x415e0366UL, 0x9136b21cUL, 0x0725126eUL, 0x56187c79UL, 0x577949d0UL, 0x797e196cUL,
+       0x2772eb6dUL, 0x94a50849UL, 0xe58cf22aUL, 0xeaf1e35dUL, 0x6e2bf171UL, 0xf180a44fUL, 0x42cd8659UL, 0x41ac2348UL),
+    SC(0x3766f2fcUL, 0x83c96803UL, 0xe590fb7bUL, 0xceb842a0UL, 0x08cd5602UL, 0xe57cd00bUL, 0x5a6e340aUL, 0x361a7daaUL,
+       0xee3e9d18UL, 0xda86e137UL, 0x27560281UL, 0x8806fc26UL, 0x199514fbUL, 0x98c76526UL, 0x54c85842UL, 0x649ed048UL),
+    SC(0x20de0b0aUL, 0x6b2200b1UL, 0xa89499bcUL, 0x05cf2dadUL, 0x07dbb6c2UL, 0xe9805259UL, 0x21c5e6a7UL, 0x29c40cffUL,
+       0xb680c2e3UL, 0x33083337UL, 0x3fefd833UL, 0x68986b50UL, 0xd2a28319UL, 0x9912a092UL, 0xfbed8b5bUL, 0x01f22663UL),
+    SC(0xd2f06c3aUL, 0xadd7cdb5UL, 0xac606876UL, 0xe4093fadUL, 0x8c626408UL, 0xab6e6dd1UL, 0xead7ec93UL, 0x4e0a1088UL,
+       0x990df428UL, 0x517d791fUL, 0xad749267UL, 0x7666dbe0UL, 0x6b71436cUL, 0x5112295eUL, 0xab7bfb74UL, 0xb4cc89fbUL),
+    SC(0xc583dce0UL, 0x0f9c32b0UL, 0xd8c87a9aUL, 0xdc7dd093UL, 0xd12037a6UL, 0xec162d5eUL, 0x22ba72ffUL, 0xbeae41e1UL,
+       0xd9390ef4UL, 0x9f7f10fdUL, 0x7b8641bbUL, 0xf2ae8388UL, 0xed08cc19UL, 0x3d1e6a13UL, 0x81d8c198UL, 0x42025aebUL),
+    SC(0x80f61ba8UL, 0xa99d2081UL, 0xf0652a9eUL, 0xa25b8d23UL, 0x716d55aaUL, 0xc9355891UL, 0x9a4b4d43UL, 0x1e967f58UL,
+       0xb8df023eUL, 0x56eb796aUL, 0xe70296b2UL, 0xb47dea6eUL, 0xd74ac4b1UL, 0x99fa132dUL, 0xc9c464f0UL, 0xddac27e2UL),
+    SC(0x4ae1535cUL, 0xdba6c272UL, 0x6e78dae3UL, 0xbc651f16UL, 0xcdf6634fUL, 0x95584886UL, 0x899c829eUL, 0xdf12201cUL,
+       0xef66789aUL, 0x13b7244bUL, 0xced52d30UL, 0xc9af6613UL, 0x55d66a9aUL, 0x9efd3a40UL, 0x703d38bfUL, 0xc69c7c75UL),
+    SC(0x2143bc02UL, 0xb46d41b8UL, 0x766db211UL, 0x61ed21efUL, 0x005b0973UL, 0xb7cebb00UL, 0xbeb89b71UL, 0x4a6e16d7UL,
+       0x7dcb12cbUL, 0x137dd6e6UL, 0x96791345UL, 0x69e25e2dUL, 0x57cbed88UL, 0xce39aff0UL, 0x3d57ec3bUL, 0x85160feaUL),
+    SC(0x5c0b84bcUL, 0xca8945d3UL, 0xa2356c68UL, 0xafb8d1e5UL, 0xd45357b6UL, 0xb37e5afdUL, 0xc2b00e6dUL, 0x1f6c5eabUL,
+       0x1608a492UL, 0xbfb97a7eUL, 0x746218c5UL, 0x0f673078UL, 0xc70f5880UL, 0xde8df87fUL, 0x8aa5bfb9UL, 0x89b43ee8UL),
+    SC(0xf6cc5210UL, 0xfa45c072UL, 0xcb95e88dUL, 0xca93b9e3UL, 0xf7b35e98UL, 0x13c29976UL, 0x2ed9364fUL, 0x08c021e3UL,
+       0xae959f0bUL, 0x5ce17592UL, 0x5046e320UL, 0xf86d9751UL, 0xa6ec37a3UL, 0xa773e5efUL, 0xc4681ebbUL, 0xf5aa1baaUL),
+    SC(0xd4df71daUL, 0x5f272934UL, 0x08653f60UL, 0xbb02deb6UL, 0x0c314943UL, 0xf50cc5ecUL, 0xe4974aceUL, 0xb5b4d0acUL,
+       0x17caf288UL, 0xb3286dbeUL, 0x2e8d0616UL, 0xdf592027UL, 0xbaf3e59fUL, 0x1e52fe51UL, 0x9644cf5bUL, 0x66443c35UL),
+    SC(0x44e8227eUL, 0x177bb9c1UL, 0x5aab6cd9UL, 0xd987ef1aUL, 0x0af087d4UL, 0xbb2672afUL, 0x1a8d5412UL, 0xa7d6cb59UL,
+       0x4b9b2602UL, 0x152e1152UL, 0x92fb191fUL, 0x2cbbec91UL, 0x5ecea9e9UL, 0xed75121dUL, 0x05cc7a88UL, 0x069527cdUL),
+    SC(0x97f092f2UL, 0x75d1ec04UL, 0x96f6b14cUL, 0x10a280f7UL, 0x25c9e4a5UL, 0xd16afe2aUL, 0x3f0837b5UL, 0x422bc5dbUL,
+       0x12f04418UL, 0xc131046aUL, 0xe5c7ed64UL, 0xf69d6a8fUL, 0xd3a3d35eUL, 0x30dd273eUL, 0x72ff16dfUL, 0xa866822aUL)
+  },
+  {
+    SC(0x9a1db7bfUL, 0x53241ed1UL, 0xdf8d3ea0UL, 0xf70c0b26UL, 0x76b43ebcUL, 0xbcb4622aUL, 0x09704b0aUL, 0x3067400aUL,
+       0xe3638ad2UL, 0x95740505UL, 0x455b2e1eUL, 0xd495c57aUL, 0x54ed8e8fUL, 0xc647a6b9UL, 0xc69b7dd0UL, 0x715cef52UL),
+    SC(0x5aa4d7d3UL, 0x745f341aUL, 0xc2869a8fUL, 0xce1e2a96UL, 0xe25e49f7UL, 0x1e5cf140UL, 0xc0ad884fUL, 0x47d8ae86UL,
+       0x9f03a2baUL, 0x989bd4b5UL, 0x9361448fUL, 0xabe607abUL, 0x210d3887UL, 0x8da85782UL, 0x260937f5UL, 0x9910d8d1UL),
+    SC(0x91910df2UL, 0x7ca6ab42UL, 0x017ddcf1UL, 0xd7efbfffUL, 0xe69eb9cbUL, 0x24a6648eUL, 0x3aa7d738UL, 0xc76290f7UL,
+       0xe99691b1UL, 0x0d883491UL, 0xe79e957bUL, 0x4c65f975UL, 0x601aa5a3UL, 0xb056ebbfUL, 0xabea6c7cUL, 0xd7b9ff2fUL),
+    SC(0xb5b7792fUL, 0x99303195UL, 0x4024caa9UL, 0xe08bfc16UL, 0x53f535feUL, 0x7bc3e34cUL, 0x8491864fUL, 0x74f48799UL,
+       0x6cade2ceUL, 0x595b6714UL, 0x5d376b7dUL, 0x7b435a3aUL, 0x76b15912UL, 0x6340f6aaUL, 0x68ae15beUL, 0x26a159ceUL),
+    SC(0x8b54ad71UL, 0x6c724ad7UL, 0xe47e5efbUL, 0xe6b7c93fUL, 0x8923e7fbUL, 0x8517ce0eUL, 0x6f732486UL, 0xf37ba1afUL,
+       0xfb8aa95fUL, 0x4a6e3522UL, 0x371cdaf4UL, 0x0461f4d6UL, 0x8a45481cUL, 0xda065f7fUL, 0xa697487eUL, 0xfb8ea80cUL),
+    SC(0xb4896855UL, 0xb2614337UL, 0x8c5842efUL, 0xb7dfded9UL, 0xba6c80fdUL, 0x2eb154f7UL, 0xe83c4734UL, 0xed7dba2bUL,
+       0x30e20644UL, 0xfd8a9a81UL, 0x9c622641UL, 0xb525647eUL, 0xae35b892UL, 0x91410141UL, 0x1a5df15dUL, 0x36c4efb1UL),
+    SC(0x5bc3cc33UL, 0x89816b7fUL, 0x414a473aUL, 0x2deae3e5UL, 0xad3e7803UL, 0xb7532f36UL, 0xd2b31598UL, 0x7c35d6abUL,
+       0x4dfe0f94UL, 0x86d1ecf9UL, 0x7de9b0a9UL, 0x3e437f49UL, 0xc015b9a7UL, 0x677aa2a2UL, 0x74868a4dUL, 0x512c2ef0UL),
+    SC(0x230bee0bUL, 0x5eaaf145UL, 0xf18ec782UL, 0x1e861f12UL, 0x26cec876UL, 0xa50ac94aUL, 0x4a88ed64UL, 0x4a3f7d34UL,
+       0x331778b7UL, 0xd638cc22UL, 0x269a7a3eUL, 0xabd0c393UL, 0x0f7e08d0UL, 0xdc761da6UL, 0x25b70b5eUL, 0x14f18c26UL),
+    SC(0x8f55920fUL, 0xc479e736UL, 0x3000b33fUL, 0xebbb1559UL, 0xd41a5873UL, 0x93429368UL, 0x78a6156aUL, 0xd476b8bfUL,
+       0x94fbaab6UL, 0x7a49ff13UL, 0x2435b28eUL, 0xdf7253afUL, 0x43420841UL, 0xb721221eUL, 0xb5606a48UL, 0x3061e441UL),
+    SC(0xd64edeb3UL, 0x709907c3UL, 0x761afdeaUL, 0xf9b431faUL, 0x7c0d5912UL, 0x8a603410UL, 0x39e89346UL, 0x1561b7fbUL,
+       0xd64ce942UL, 0xeda3a553UL, 0x82c22d7eUL, 0xf9b20c61UL, 0xba09fb35UL, 0x4401fddaUL, 0xc054e891UL, 0x15134b9dUL),
+    SC(0xab22f920UL, 0xa97eaefaUL, 0x25e46069UL, 0x1123f499UL, 0x7b3a78e9UL, 0xaf738ad2UL, 0x266c6c98UL, 0x4b5fb63eUL,
+       0x27f41b98UL, 0xa05a5599UL, 0x0eb82b0cUL, 0x37a9a70aUL, 0xf19df223UL, 0x5254816fUL, 0x1b9411b2UL, 0x0052b77dUL),
+    SC(0x3a409fc6UL, 0xf4a19839UL, 0xc6bd2187UL, 0x5e2f9b1dUL, 0x5e10ca36UL, 0x5711a0b5UL, 0x67084612UL, 0xebe049d6UL,
+       0x21006d4eUL, 0x399d55a1UL, 0x6a7c136eUL, 0xb192543bUL, 0x36e73785UL, 0x36506555UL, 0xe9c5fea9UL, 0x3e5bf265UL),
+    SC(0x057305b7UL, 0x07613e53UL, 0x635ea239UL, 0xc9e35edcUL, 0x1a2a1680UL, 0xfdf58358UL, 0x093cb226UL, 0xc0f11f50UL,
+       0xb3316b71UL, 0x954f5a14UL, 0xacfe28bcUL, 0x9e90c27cUL, 0x715204e5UL, 0x9db9a74eUL, 0xa5b5cecdUL, 0x02f43aefUL),
+    SC(0xd5c78499UL, 0x3727b6d6UL, 0x18bc7b22UL, 0x4b1da72bUL, 0x01cd9122UL, 0x81e8e58bUL, 0xcf2dd698UL, 0xb400cfa2UL,
+       0xd1aab246UL, 0xfc2da7beUL, 0xde9d90cbUL, 0x2c438d65UL, 0x310b4785UL, 0xece43715UL, 0xdd3a1a65UL, 0xc8abca8aUL),
+    SC(0x13a05a02UL, 0x7191a7f3UL, 0xeeb453c2UL, 0x8b76afb5UL, 0x150bc141UL, 0x20b90f50UL, 0xdbd0d218UL, 0x15453e2eUL,
+       0x94ab710aUL, 0x3736322aUL, 0xed6b4443UL, 0xabcdce44UL, 0xa8556a3fUL, 0x85f9d3a3UL, 0x701dde54UL, 0x52aa3927UL),
+    SC(0x3e6033feUL, 0x9fc41a9dUL, 0x6037d9e7UL, 0xef11fdb6UL, 0x93d1af71UL, 0x237d3983UL, 0x2da15f12UL, 0xaa080ff5UL,
+       0x763af526UL, 0xe9187e31UL, 0x89955a60UL, 0xb3914307UL, 0x99ed7de9UL, 0x00e41b6cUL, 0x039d8ae8UL, 0x748af8f7UL)
+  },
+  {
+    SC(0x50cd2e16UL, 0x997d7d45UL, 0x98bb2d9bUL, 0x61aceaffUL, 0x5ad5f38cUL, 0x8286a0e1UL, 0xd08055adUL, 0x726c7800UL,
+       0x0dd19c3bUL, 0xc08b8d97UL, 0x088f9de1UL, 0x5941f5faUL, 0x6402bbbbUL, 0x5fdc708bUL, 0xcfc08844UL, 0xeb23733bUL),
+    SC(0x4e83070cUL, 0xe3eba290UL, 0xc6cd520cUL, 0xdcb4252bUL, 0x9098270aUL, 0x55fd47fdUL, 0xeedf36daUL, 0xb1706d47UL,
+       0x561a3822UL, 0xcd94b2a4UL, 0x1f30bac8UL, 0x695e05b7UL, 0x69de8ae7UL, 0x4241d2efUL, 0xf084922dUL, 0xccaf09efUL),
+    SC(0x4cb0754eUL, 0x6863546fUL, 0x0afe0bfaUL, 0xedc94c15UL, 0x6d9ac68eUL, 0xdb700281UL, 0x2a24933cUL, 0xa0a30401UL,
+       0x6cf6ab8eUL, 0x306e4400UL, 0x427b7820UL, 0x52534566UL, 0x52d2bc98UL, 0x2510c84eUL, 0x43b4ec61UL, 0x3194c402UL),
+    SC(0xa3689f89UL, 0xd4874967UL, 0x1b205a89UL, 0x8e6c092aUL, 0xb0cdbe2dUL, 0xf1530bf1UL, 0x99201a3aUL, 0x6b0e3da5UL,
+       0x5a58acbbUL, 0xe6ad1676UL, 0xa328e193UL, 0x30c3297bUL, 0x81e52e9aUL, 0x4abfcd4fUL, 0x7e0bdc2dUL, 0x543bdf61UL),
+    SC(0x79617bb3UL, 0xc57e2db9UL, 0xb2978984UL, 0x2544e9ffUL, 0x61055023UL, 0x80faa2c1UL, 0x9db34d60UL, 0xb6cc0c8aUL,
+       0xe63a05beUL, 0xbe1da5f1UL, 0xb74450d3UL, 0x60092dbaUL, 0x29122671UL, 0x6e07280aUL, 0xd78a1f17UL, 0x05daa191UL),
+    SC(0x6a474afbUL, 0x415121c9UL, 0x38c73c20UL, 0x27a5fc93UL, 0xf7e8ea81UL, 0xd7df1144UL, 0xa50b1c66UL, 0x5be0d8cbUL,
+       0x5c643389UL, 0xaf9fd383UL, 0xb7d71966UL, 0xd251dc20UL, 0xdb8b0d22UL, 0x8aa94a04UL, 0x289ee8d8UL, 0x247877feUL),
+    SC(0x7bbcb86aUL, 0xebb40626UL, 0xce142507UL, 0xb8cf0801UL, 0x2f706862UL, 0x7a46c76bUL, 0xfb8eb115UL, 0xbe4163ceUL,
+       0xb18769a0UL, 0x735707daUL, 0x4b1d7a1cUL, 0x7690f190UL, 0x2a3a1f30UL, 0x67d54f8eUL, 0x188f8a41UL, 0x3826ade0UL),
+    SC(0x5caeb262UL, 0x447b4224UL, 0x19f66418UL, 0x4899762eUL, 0x2e2a6b9fUL, 0xf8aaccaeUL, 0xa29fc3f4UL, 0x68a1b645UL,
+       0xb894f2dfUL, 0x20dec514UL, 0x2792de69UL, 0x86a9582fUL, 0xd6e1e3e0UL, 0xfd97c5e8UL, 0x9798624bUL, 0x9d6e2236UL),
+    SC(0xa8ec4087UL, 0xe144437cUL, 0x3acf2ab9UL, 0x3f339415UL, 0x74e79f9fUL, 0xcd48bc47UL, 0xcace25b0UL, 0x4d4e451bUL,
+       0xef3ce687UL, 0x12f91e5fUL, 0xb38ccc98UL, 0x5c0641f9UL, 0xd57a6ac2UL, 0xb72f8814UL, 0x3e85e128UL, 0xc7012a4bUL),
+    SC(0x724a5b27UL, 0x5dc8ff8aUL, 0xe10b34e3UL, 0x5d05a592UL, 0xc50904e3UL, 0x32153a20UL, 0x78809bc7UL, 0x5d69ed79UL,
+       0x488b7096UL, 0xf471a9f8UL, 0x583a9b68UL, 0x3119a211UL, 0x6ede4c52UL, 0xbf817b27UL, 0x123488d2UL, 0x9ecb8328UL),
+    SC(0x1d1ab819UL, 0x80b10336UL, 0x75e10627UL, 0xb7293cb7UL, 0x7f31cd83UL, 0xad1a043bUL, 0xae9aceb4UL, 0xaa0a7463UL,
+       0xcfd42f33UL, 0xc57814a7UL, 0xacbb3f08UL, 0xdd882a4aUL, 0xc572412cUL, 0x8502e82fUL, 0xa3180452UL, 0x7d2e0151UL),
+    SC(0x98b12e59UL, 0x8166e430UL, 0xea43d632UL, 0xf8a4b981UL, 0xf3745420UL, 0x6d1233e6UL, 0xf9c8756aUL, 0x47dcf4d2UL,
+       0x4f65841aUL, 0xb8f18241UL, 0xa46eac62UL, 0xb875173dUL, 0x350c78daUL, 0x6d6af3dbUL, 0xd9fb9bbcUL, 0x77f33b96UL),
+    SC(0x58dab35dUL, 0x9ec4e48dUL, 0x6a7e619bUL, 0xe926ec2cUL, 0x45f67be3UL, 0x3d89bde2UL, 0x38963966UL, 0xc96b3270UL,
+       0xe5d0aaabUL, 0x06191f65UL, 0xe6340837UL, 0x747339b5UL, 0xacd35b86UL, 0x823e06afUL, 0x85eb54c8UL, 0x7f926564UL),
+    SC(0x41dfb55aUL, 0xcad77bbfUL, 0x80435b8bUL, 0x7f2366e3UL, 0xf41e64f4UL, 0x74bd9895UL, 0xdfe86e8bUL, 0x50abfb83UL,
+       0x147a71bbUL, 0x3809c321UL, 0xd960ef5dUL, 0x9f767bdeUL, 0x7873efa5UL, 0xc590e799UL, 0xdb46d8baUL, 0x8c1dd2cdUL),
+    SC(0xd739d1a4UL, 0x0072dadcUL, 0xeb59a120UL, 0x3b8de564UL, 0x5d5c1e1cUL, 0x5ee96ebdUL, 0x533442e0UL, 0xde0c8684UL,
+       0x610f527dUL, 0x8cc0ddb6UL, 0xcb17e24aUL, 0x51aba4abUL, 0x5ab0d8aaUL, 0x09ebd61cUL, 0x5d26cf93UL, 0x30a18293UL),
+    SC(0xf887ab66UL, 0xed92339eUL, 0x8fc9d8eaUL, 0x1af72d3cUL, 0x06426ba1UL, 0x0a8be283UL, 0xe2457a97UL, 0x342dfb4fUL,
+       0x94de30b5UL, 0x04e69b56UL, 0xfefae855UL, 0x51fd5a5fUL, 0x111671f9UL, 0xc5a733f1UL, 0x1ef7464dUL, 0x88d5d66eUL)
+  },
+  {
+    SC(0x4bd266bdUL, 0x4a730879UL, 0xcb06d8dcUL, 0xbd8e5854UL, 0xc50b6221UL, 0xd83e0a10UL, 0x3afcb2a9UL, 0xa64cca67UL,
+       0xa4654a1dUL, 0x835a51f0UL, 0x5a877200UL, 0x1768c549UL, 0x909212e5UL, 0x78e3b1d1UL, 0xdf935959UL, 0x93650863UL),
+    SC(0x015fce59UL, 0xbb77b091UL, 0x90e5c39bUL, 0xae696127UL, 0x4d51068dUL, 0xea51ce52UL, 0x6c8525e7UL, 0xb1ee3d1eUL,
+       0xb55eb928UL, 0x92ae639eUL, 0xda63a4a6UL, 0xf14fc6f0UL, 0xee2450b1UL, 0x94df32daUL, 0x9a1004a8UL, 0x699797a8UL),
+    SC(0xd3e5b06eUL, 0x7648321eUL, 0x4fe95ed8UL, 0xe1316474UL, 0x43996e1eUL, 0x2cff5283UL, 0x26783ba9UL, 0x1906cf7bUL,
+       0x2ad6127aUL, 0x9e45be65UL, 0x26ccdf8aUL, 0x460cd441UL, 0xcebb5689UL, 0x9f3cfd41UL, 0x02aae39eUL, 0xc838b2c5UL),
+    SC(0x114032d6UL, 0x8e474d1bUL, 0xa9fc40c2UL, 0xf22f5b1dUL, 0x6d12b9ddUL, 0x9cbc286dUL, 0x38274501UL, 0x218c54b7UL,
+       0x9dd3d787UL, 0x0706a063UL, 0x0c0d81bfUL, 0xd1cecb6cUL, 0xb7b5b446UL, 0x6d7c955dUL, 0x22cf05e0UL, 0x822a9ef1UL),
+    SC(0xa230cd33UL, 0x6bb82fcaUL, 0xbee35435UL, 0xdd0d560fUL, 0xd286785aUL, 0xf5425cd9UL, 0xa4c9abdcUL, 0x0819e58cUL,
+       0x57d99f9cUL, 0xaef9cf3dUL, 0xfa66dfb8UL, 0xbedeec77UL, 0xe21746b4UL, 0x027e4869UL, 0x39cdd8afUL, 0x5a9182d0UL),
+    SC(0x593e3646UL, 0x546aafcbUL, 0xfc8a293cUL, 0x6cf0530eUL, 0x5f1f2639UL, 0x2f3ac2b0UL, 0xb136583fUL, 0x02981e8eUL,
+       0x15c4b596UL, 0x6589f9ebUL, 0x5fe0d0a4UL, 0x91e768adUL, 0xfc7f5283UL, 0x875bfcd4UL, 0x3b698a3bUL, 0x4f268b43UL),
+    SC(0x37729a9cUL, 0x3ad25a03UL, 0xe1cb6fbfUL, 0xff486df7UL, 0xd518809fUL, 0x66099d27UL, 0xd203dab3UL, 0x3d33dec5UL,
+       0xdfcbd1b3UL, 0x07905c99UL, 0x021269caUL, 0x283405c5UL, 0x208ef5ebUL, 0xe96c0801UL, 0xf8868631UL, 0x69ba2c23UL),
+    SC(0x46d8c723UL, 0xf0b889bbUL, 0x3272389fUL, 0xba3ba57eUL, 0xd30d701fUL, 0x07f730d0UL, 0xc7ebc34bUL, 0x8212cb9dUL,
+       0xbc41f981UL, 0x2017d9e1UL, 0x1e4e2277UL, 0x92b6e804UL, 0x6318776aUL, 0xd552960fUL, 0x0c751c36UL, 0xc6d00a2fUL),
+    SC(0xfe29d8c8UL, 0xfd38be9fUL, 0xc316c2b5UL, 0xab74dc69UL, 0xffbcc390UL, 0x1e59df52UL, 0x66aa345bUL, 0x6b1408a3UL,
+       0x338ea0c3UL, 0xf80e4400UL, 0x53858842UL, 0x936562f2UL, 0x8b9ea4eaUL, 0x31540868UL, 0x11e87150UL, 0x89e9e304UL),
+    SC(0x99ddf18dUL, 0xcc6505b3UL, 0x78a4cbb4UL, 0xf45bea9eUL, 0x44726ec1UL, 0xcd51397aUL, 0xd536dad7UL, 0xb1b3ca2fUL,
+       0xfa8e8ab4UL, 0xb6071958UL, 0xc237e5edUL, 0x5e0c0962UL, 0x61825572UL, 0x3411bcf9UL, 0x8e923b1fUL, 0xe748ce4aUL),
+    SC(0x14c9fbd4UL, 0x0a0fe77fUL, 0x1f518efdUL, 0x13dd7eb0UL, 0xcb7695f8UL, 0x219db1beUL, 0xd4e76feeUL, 0x813a34ddUL,
+       0x991011d6UL, 0xf67f3e84UL, 0xa54c2357UL, 0x9897dff5UL, 0xf2a58cd7UL, 0x40bffbf0UL, 0xa876a611UL, 0x535f2540UL),
+    SC(0x3cc95333UL, 0x2788684fUL, 0xbbea85eeUL, 0xf49a2ae7UL, 0x51d5e29cUL, 0x48642a5dUL, 0x45236baeUL, 0xa122e5ddUL,
+       0x2ed99469UL, 0x8084af0cUL, 0x44e7c819UL, 0xcdeaf311UL, 0x72f08aa8UL, 0xee70644fUL, 0xffa2dbbfUL, 0xbf9c0bd6UL),
+    SC(0x9fd0c95eUL, 0xf60c6831UL, 0x959f2b44UL, 0x5a15a366UL, 0x6463425cUL, 0x3a64d213UL, 0xb014edadUL, 0xbd22e711UL,
+       0x8bf7b7d7UL, 0x50558a66UL, 0x4481df71UL, 0x2c14fe8cUL, 0x9411d8e7UL, 0x13fa61f0UL, 0xfcaac1c9UL, 0x2c1990b7UL),
+    SC(0xb23e3552UL, 0x9d02bd4fUL, 0xbd847080UL, 0xa5e9dc69UL, 0x964b324dUL, 0xe16af0a8UL, 0x857f46e0UL, 0xad9f32f8UL,
+       0xf3b98226UL, 0xf77e4393UL, 0xdc35409eUL, 0x69269fe5UL, 0x957a3e74UL, 0xe5e5d7c1UL, 0xec11c4b7UL, 0x3f5ae025UL),
+    SC(0x9b674b33UL, 0xb7bac25eUL, 0x88896436UL, 0xb6c80decUL, 0xbe8cc797UL, 0xfd34603fUL, 0xa4007318UL, 0x415b95abUL,
+       0x50811d7bUL, 0xbf49c464UL, 0xde0b274eUL, 0x2acb4decUL, 0x5786043eUL, 0x6bbded6fUL, 0x13d0e131UL, 0xc3b223eaUL),
+    SC(0x2cdcffd1UL, 0xac351cd5UL, 0x21216262UL, 0x9a401b63UL, 0x2f4f9c64UL, 0x9fd0e250UL, 0x2adbd66bUL, 0x003a0855UL,
+       0x54ca3d4bUL, 0x6043a79aUL, 0x66cfb5b7UL, 0x37127ee5UL, 0xc0a3e0fbUL, 0xa4214052UL, 0x6da020b0UL, 0xc757f73eUL)
+  },
+  {
+    SC(0x0217de5bUL, 0x0a47e8deUL, 0xcb9d8dc3UL, 0xdc8fcfd8UL, 0x203c514bUL, 0xb9d7bb5eUL, 0xfb03584bUL, 0xaa1baaffUL,
+       0xc77bddc0UL, 0x3af15e63UL, 0x912e51c7UL, 0x19bd8186UL, 0x67f999edUL, 0x9bd801b8UL, 0x11bc289bUL, 0xf12864edUL),
+    SC(0x799812b7UL, 0xd79876fcUL, 0x7290c3dcUL, 0x18fc6ea7UL, 0x1d224373UL, 0x2e79d17cUL, 0x9737a47fUL, 0x29fa8502UL,
+       0x4118e843UL, 0x99b5d024UL, 0xa82002f2UL, 0x7e791cf5UL, 0xbadd2e5dUL, 0x98ae1f30UL, 0x6d98ea6cUL, 0xd1d9b4feUL),
+    SC(0x8be7f251UL, 0x78840efbUL, 0xdf56c470UL, 0xc4db43dcUL, 0x54bae1e2UL, 0x7cab2bfbUL, 0xc7a6641fUL, 0xe34f00adUL,
+       0x06db39adUL, 0xc7ad2102UL, 0x90c29073UL, 0xe48225aaUL, 0x6d51f27dUL, 0xd97c0b0fUL, 0xe241f9feUL, 0x0dbe1564UL),
+    SC(0xbcba249fUL, 0x59646b10UL, 0x4f6aba48UL, 0x1e886117UL, 0xbe0fd815UL, 0xa6220e4fUL, 0xf5a08eb6UL, 0xac16c612UL,
+       0xe8d84c45UL, 0x88ce9926UL, 0x99b2d6feUL, 0x5ead0615UL, 0x4b32a372UL, 0x209e06d0UL, 0xc3d8c42fUL, 0xa0e22b86UL),
+    SC(0xae1a61b5UL, 0xdeed4d8aUL, 0x915b94caUL, 0x72aeddbeUL, 0x2c725ca2UL, 0x86311610UL, 0x476d94e0UL, 0x73fb1415UL,
+       0xe1f62c42UL, 0xefb2da24UL, 0x47b3b5f0UL, 0x0834617eUL, 0xe06078f6UL, 0x78ebf4a3UL, 0xd38c45c2UL, 0xf384e1b2UL),
+    SC(0xa1e069e7UL, 0x74cdf680UL, 0x41c5aea5UL, 0x39552c4eUL, 0xbfefd4b6UL, 0x3869db9eUL, 0xc5532b09UL, 0xe8370996UL,
+       0xcc1216a0UL, 0xcea149c1UL, 0xf19ffcf0UL, 0xeea82feaUL, 0x29fa7f3eUL, 0x0b19d5ebUL, 0x7307904dUL, 0xa38652daUL),
+    SC(0xe6433844UL, 0x64b7b1ceUL, 0xbdbbaa01UL, 0xaea053cbUL, 0xa36e0cbfUL, 0xe1c9a652UL, 0x8c714a45UL, 0x006b6b66UL,
+       0x022f16bbUL, 0x17b781e4UL, 0x47fc81d5UL, 0x1ad5ec9fUL, 0xc158b069UL, 0x7c446bdfUL, 0x52da86eeUL, 0x6b4ebe8aUL),
+    SC(0xaccfa38aUL, 0x10f8d4c2UL, 0xf8342e29UL, 0x272f7c54UL, 0x73d10562UL, 0x82653714UL, 0x8b67a26cUL, 0x5735ab9fUL,
+       0xac0e6829UL, 0x1043396cUL, 0xbe583305UL, 0x106514aeUL, 0x354532acUL, 0x5ead4594UL, 0xdd5a6d4eUL, 0x332cec1eUL),
+    SC(0x0d201c17UL, 0xa1e9efb1UL, 0x7bc1c655UL, 0x48c100e2UL, 0x450614aaUL, 0xb45b8125UL, 0x9f2f7e31UL, 0x04cfc924UL,
+       0x4677a168UL, 0x1eae4650UL, 0x5c5d6c94UL, 0xa6984480UL, 0x43f3793dUL, 0xab496ba0UL, 0xab86064eUL, 0x8b48ae23UL),
+    SC(0x6612ab47UL, 0xb35d942aUL, 0x098427ffUL, 0xba59b78bUL, 0xfe44437eUL, 0xb87442a7UL, 0x794e3274UL, 0x89c3b335UL,
+       0xcd540fdaUL, 0x9abe6c72UL, 0xe298eddbUL, 0x6d8c5a3eUL, 0xc0953effUL, 0x4a61cc54UL, 0x22d01ff5UL, 0xf7329785UL),
+    SC(0x35b1b6b9UL, 0x0ce9d1a9UL, 0x802dd987UL, 0x745c615bUL, 0x87a96a83UL, 0xd1b2465cUL, 0xcc9f82f0UL, 0x1c73571dUL,
+       0xeee3f5ceUL, 0xaa7961deUL, 0xdbb80107UL, 0x36e6758cUL, 0xe9cc8b0dUL, 0x58a6dedfUL, 0xecec9f2cUL, 0x7a73865aUL),
+    SC(0xc798e22aUL, 0x59e65aa5UL, 0x6647a86eUL, 0xf9a91e80UL, 0x98cb97e1UL, 0x81e07b4dUL, 0xc3fdd428UL, 0xdfc3b1b2UL,
+       0x45f881a3UL, 0x1b10db23UL, 0xca93210eUL, 0x22398cf4UL, 0x081a6a61UL, 0x06496fb5UL, 0xab82b456UL, 0x7f99a392UL),
+    SC(0x039d9dd1UL, 0x955b77dcUL, 0x4f4d7436UL, 0x9d7785a9UL, 0xc8ebfbc3UL, 0xd359f15dUL, 0x8d38d8f3UL, 0x1097a2d2UL,
+       0x64040f85UL, 0x819c8a31UL, 0x94dc8ab4UL, 0x5d794fd0UL, 0xdadb6826UL, 0x70de6629UL, 0x5afaaa1eUL, 0xc669126dUL),
+    SC(0xa9168a3eUL, 0xd48f2332UL, 0x48bd4a53UL, 0xdd37e37bUL, 0xd24b6284UL, 0xa2522671UL, 0xc6494bf5UL, 0x84738bf1UL,
+       0x6ec107edUL, 0x6f749a16UL, 0x27a57227UL, 0x4d7bcf8fUL, 0x8ff71417UL, 0x7d38f6cfUL, 0x64040ca3UL, 0x3292bf65UL),
+    SC(0x88b92b0fUL, 0x67c3524cUL, 0x3d7b04a5UL, 0xbf539b2aUL, 0xa244f3deUL, 0x64867754UL, 0xbad51192UL, 0x0292a6f3UL,
+       0xf65e55f8UL, 0xf9239573UL, 0xd77176aeUL, 0xc976c545UL, 0xa0e4668fUL, 0x8c2f2fb6UL, 0xcb2499aeUL, 0x94af11edUL),
+    SC(0x6c7ef071UL, 0xc8f4b0ccUL, 0x67e66561UL, 0x38d5354dUL, 0xfe5c9edcUL, 0x05cea2ebUL, 0xa43a5751UL, 0x317da5eaUL,
+       0x40894203UL, 0x7cf76552UL, 0x33da385dUL, 0x43e1bd8fUL, 0xcb871737UL, 0xc4b7f044UL, 0xa44042a3UL, 0x34d4bb6cUL)
+  },
+  {
+    SC(0x761cab41UL, 0x3916a1f5UL, 0xe131f337UL, 0xe9023519UL, 0x6199f789UL, 0x87ef390bUL, 0x3f2d8bfaUL, 0xb0e9bbc6UL,
+       0xf10272dfUL, 0xf7e91c40UL, 0x3565da85UL, 0x17fd3011UL, 0xbde7b797UL, 0x0526d3c3UL, 0xf00fb28eUL, 0xf26dbd91UL),
+    SC(0x0a6bf4e6UL, 0x9cb5faaaUL, 0x8b1308d2UL, 0xda8e2adaUL, 0x516b5f18UL, 0x733156ddUL, 0x2de04cb9UL, 0xab1b0e9cUL,
+       0xb84be8fdUL, 0x2ac4b2f4UL, 0x2934490dUL, 0x2c7de2a7UL, 0x8be093eaUL, 0x907bab1cUL, 0x94681e51UL, 0x3ba7f4e3UL),
+    SC(0x4d280f0dUL, 0x190ce936UL, 0x011ad117UL, 0xad7ca092UL, 0xd61fc8cfUL, 0xdb1fc752UL, 0x05788c7dUL, 0x9cc97535UL,
+       0xf20a17ecUL, 0xc8fdbfb0UL, 0x2db3b21aUL, 0xacd35527UL, 0x25a7aa8cUL, 0xd20a6e23UL, 0xbcdeca87UL, 0xa6fc2112UL),
+    SC(0xfc0fecbcUL, 0xc71d83d7UL, 0xc888c451UL, 0xf862474fUL, 0x02538e8aUL, 0x800c8a93UL, 0xf4c30be8UL, 0xef98e709UL,
+       0x3e809271UL, 0x356b87adUL, 0x87d15888UL, 0x26b055cdUL, 0x6ec7e44dUL, 0x3c9e404cUL, 0xa27a473aUL, 0x8cd093cfUL),
+    SC(0xc3746b0dUL, 0xf41e4a85UL, 0xbe3bbe25UL, 0xc1d64961UL, 0xf80ed512UL, 0x8ad3c3d6UL, 0x2cc5b9f9UL, 0xb231dabdUL,
+       0x382a6d3dUL, 0xd970f8d4UL, 0xabe3a72fUL, 0x58f0cbd5UL, 0x033dfb21UL, 0xb92571e0UL, 0x19a0ed82UL, 0x55974b77UL),
+    SC(0xe5749369UL, 0xb1e25400UL, 0x2927cc8dUL, 0x03b15b5aUL, 0xdad570b2UL, 0xcc6ab264UL, 0xa8af3de5UL, 0xfcd9a458UL,
+       0x38cc0e66UL, 0xe5b86153UL, 0x1b8b7abaUL, 0xc266235bUL, 0xfd34833fUL, 0x9b0a18efUL, 0x9ac361cbUL, 0x407d774eUL),
+    SC(0xd3463d82UL, 0x0782ece5UL, 0x999dee44UL, 0xcca08ccbUL, 0x1d908f11UL, 0x7f19d0e1UL, 0x93f42e86UL, 0x505470ceUL,
+       0xebb2cfb1UL, 0x0f948fa0UL, 0x4204c39cUL, 0xcd3c12fcUL, 0x06379418UL, 0x33e9ba07UL, 0xcd714715UL, 0x268e8c85UL),
+    SC(0x09c88be4UL, 0x50bee26fUL, 0x14afddd2UL, 0x80e247c7UL, 0x7d07dadeUL, 0x81c55945UL, 0x4091d1a5UL, 0x6acc28e1UL,
+       0x1a943839UL, 0x793d91cbUL, 0x865a3213UL, 0x4d4ef1cbUL, 0x927a90a5UL, 0xe9da30c6UL, 0xc88d72cbUL, 0x001fef79UL),
+    SC(0x77d8a57eUL, 0x81ff4149UL, 0x8703d289UL, 0x0c6d2d6fUL, 0x209ba69eUL, 0x99350060UL, 0x0d8e53d5UL, 0xeb3709a9UL,
+       0x6b692badUL, 0xab736bc8UL, 0xccc1362cUL, 0x24f05260UL, 0x05c3d2b0UL, 0x23deacf4UL, 0x641c56f5UL, 0xc2b79fa3UL),
+    SC(0x64ad7f39UL, 0xa9e7027aUL, 0x051eaadeUL, 0x8ce6650eUL, 0x2141e655UL, 0x0b443fe8UL, 0xf67afbf1UL, 0x7c970189UL,
+       0xa730c9ceUL, 0xacb21c6bUL, 0xba834441UL, 0x9f417a6dUL, 0x47ca382aUL, 0x904e432eUL, 0x3fc2235cUL, 0x222acd1bUL),
+    SC(0x6f1c3296UL, 0x67d9cbeeUL, 0x07c44cdfUL, 0xe5614882UL, 0x1ab9ca61UL, 0x1731c1a8UL, 0x28520698UL, 0x07f94609UL,
+       0xecd182d9UL, 0x00eed899UL, 0xf9b8e5f4UL, 0x71e5805fUL, 0xef716180UL, 0xb8d1499cUL, 0x082f6186UL, 0xd09a0338UL),
+    SC(0x8116e0e6UL, 0x75ee5fe6UL, 0xf0bc86c6UL, 0xc3830977UL, 0xa4432546UL, 0x4d027ebaUL, 0xfa242f13UL, 0xabe10e55UL,
+       0x8cae3d9fUL, 0xaf3e4b04UL, 0xf9555752UL, 0x074eb60bUL, 0x1ccd5f10UL, 0x8b3e52e6UL, 0x47871a5aUL, 0x001671fdUL),
+    SC(0x01593b19UL, 0x7dd26caeUL, 0xe667733eUL, 0xd4b564f0UL, 0xff212f26UL, 0x1bd6e81cUL, 0x61acabe7UL, 0x37b62f8bUL,
+       0x3c9d3e7bUL, 0x52301084UL, 0x7a5c2f2aUL, 0x39cb68d2UL, 0xb9a88605UL, 0xa12cfb39UL, 0xfa790749UL, 0x7107b746UL),
+    SC(0x4bde92f9UL, 0x1335891aUL, 0x001f40ffUL, 0xe4310cb4UL, 0x10e2b172UL, 0x27223f80UL, 0x672b313aUL, 0x184c9a26UL,
+       0xc24904b1UL, 0xc5d83c4bUL, 0x31748a87UL, 0x576880f2UL, 0x073719eaUL, 0x4413f945UL, 0xe8233811UL, 0x5282347bUL),
+    SC(0xe04ce78eUL, 0xb61966caUL, 0xccaad985UL, 0x376f23dcUL, 0x7f4e5c22UL, 0x7bbba119UL, 0xa99911ccUL, 0xb7fe0674UL,
+       0x0f5e3beeUL, 0x098daaa6UL, 0x1f45a2deUL, 0x6e95e919UL, 0x68f33ecfUL, 0x4a71be8cUL, 0x8fe5d925UL, 0x92e43989UL),
+    SC(0xe30ce87dUL, 0x35b2a79bUL, 0xac96ede0UL, 0xc3b632e5UL, 0x506b5b86UL, 0x22a0c483UL, 0xc4a6038dUL, 0xd846d191UL,
+       0xd92e324cUL, 0xc5d9a340UL, 0xe69050bfUL, 0x198063b5UL, 0xe4fddd9cUL, 0xa3e466b6UL, 0x9fd00831UL, 0x3eb13453UL)
+  },
+  {
+    SC(0x60b01067UL, 0x25cf781dUL, 0xe78ba725UL, 0x40508697UL, 0x3f2ff6ecUL, 0x01511515UL, 0x06e19384UL, 0x1fddda7aUL,
+       0x624ccf87UL, 0xf0ec21b9UL, 0x082efbc4UL, 0x6d4db878UL, 0x5d20fb8eUL, 0xdfe663fcUL, 0x46660bb7UL, 0x098c96ebUL),
+    SC(0x3e169750UL, 0xb508233aUL, 0x580f67daUL, 0x55ddf909UL, 0xa6bdedb7UL, 0x7a7c8a6aUL, 0xca262be3UL, 0xd6e77a93UL,
+       0xd8e9c3e8UL, 0x733dd591UL, 0x722f7020UL, 0xa361b2daUL, 0xe6a4e71bUL, 0x7001f1caUL, 0x2ac8c89cUL, 0x1b56fcaeUL),
+    SC(0xa502b4a5UL, 0x7f7da399UL, 0x710ced24UL, 0x5452f975UL, 0x314b44c5UL, 0x2c6c1625UL, 0x3e4c183cUL, 0xd53f18b1UL,
+       0x814e29d1UL, 0x67240f5fUL, 0x2a7a406cUL, 0xbc0e4980UL, 0x69def56dUL, 0xc7e1c16bUL, 0x2a67a903UL, 0x59400c37UL),
+    SC(0x710d4fa6UL, 0xd7e2ef8eUL, 0x373a011dUL, 0xf28b2a15UL, 0x88e9810dUL, 0xc1c74a69UL, 0x3b3e5de6UL, 0x4bbba781UL,
+       0xc39916e4UL, 0x231ac0bcUL, 0x90d1c25fUL, 0x6768b4a6UL, 0xcb3efcc9UL, 0x99b42dc1UL, 0x27065953UL, 0xbfb3b307UL),
+    SC(0x9735e24dUL, 0x98430f34UL, 0x7dba7882UL, 0x9de4888dUL, 0x1557f650UL, 0xca2ae2a1UL, 0x48394c36UL, 0x9b4931aeUL,
+       0x9b5e03ffUL, 0x0c52da7aUL, 0x4119c4e0UL, 0xc86aadc8UL, 0xeb3172a5UL, 0xfc430cb8UL, 0xac121fd3UL, 0xd2949b02UL),
+    SC(0x03eac990UL, 0xf2b5a7b9UL, 0x7ad3c31bUL, 0x830576f3UL, 0xebe86f15UL, 0xefc78a0eUL, 0xce51e592UL, 0x190710aaUL,
+       0x2e75c1c1UL, 0x786110a9UL, 0x785a21c4UL, 0xd72576b0UL, 0x9fcddea0UL, 0xb1828f8bUL, 0x4a7eb45fUL, 0x8d0f7081UL),
+    SC(0xa797ac71UL, 0xb5c615abUL, 0x52e5341dUL, 0x5420684aUL, 0x7ed20dd6UL, 0xb7cfd205UL, 0x2ef23b45UL, 0x7302d01dUL,
+       0x32fdc8e5UL, 0xeee8870eUL, 0x6bd9ee55UL, 0x821bf2d5UL, 0x30798606UL, 0x85f4c9ceUL, 0x4534b4e1UL, 0x525e782aUL),
+    SC(0xe9b05915UL, 0x1e029c34UL, 0x7c30a260UL, 0x138378e0UL, 0xa609051cUL, 0x33b2da36UL, 0x3dce9dc4UL, 0x19b2deb5UL,
+       0x5494d79fUL, 0x9edc31b3UL, 0x9259c82cUL, 0x14f6c757UL, 0xbe0159ddUL, 0xc79a8797UL, 0x95af6150UL, 0x484d8683UL),
+    SC(0x8ed4c8afUL, 0x27fa4013UL, 0xa9d9826eUL, 0xbecd79a1UL, 0x30cb2014UL, 0x96e583d2UL, 0xe2d80eabUL, 0x573a5eeeUL,
+       0x04bd35c5UL, 0xcf78a79cUL, 0xd5568968UL, 0x0fb1043bUL, 0xc8cb021fUL, 0xb5729fafUL, 0x509a09d8UL, 0xb82e10c2UL),
+    SC(0x14230106UL, 0x2f11cd2fUL, 0x0b0e8abeUL, 0x5a76a7c4UL, 0x2eb3f019UL, 0xab8503f3UL, 0xafa0bab4UL, 0x487a4928UL,
+       0x480dbfebUL, 0x2b36a3d3UL, 0x4cdfd029UL, 0xdfe3a42dUL, 0x6297724aUL, 0x15be840bUL, 0xff197fa6UL, 0xef5f594aUL),
+    SC(0x425fb125UL, 0xe156d90cUL, 0x31dea3daUL, 0x6ce5f3f0UL, 0x2d1d78d5UL, 0x9ec17c65UL, 0xe89c3817UL, 0xd10df34eUL,
+       0x2e2a12cbUL, 0x0d621042UL, 0x8cc2ce77UL, 0xdf2ec8ccUL, 0xec1a8a8aUL, 0x9a2a2a3dUL, 0xb537f1b2UL, 0x13ca871bUL),
+    SC(0xb54496c9UL, 0x57e6e359UL, 0x88118db8UL, 0x26be100bUL, 0xaffc546bUL, 0x511aaa43UL, 0x6be0f72bUL, 0x2072d698UL,
+       0x04174ec3UL, 0xab8c5709UL, 0x581d797aUL, 0x831c341bUL, 0x131d94f4UL, 0x25715984UL, 0x7c6b95daUL, 0xe42d6ac2UL),
+    SC(0xedb85684UL, 0x1b5c164eUL, 0xeed9b5d5UL, 0x740972d5UL, 0x0781922cUL, 0xe9d365c1UL, 0x24475785UL, 0x2d4c6602UL,
+       0x56eedd35UL, 0xdbb97163UL, 0xdf4f95d2UL, 0xdc106a63UL, 0x114e3f44UL, 0x1cfb2d74UL, 0xc57a51f9UL, 0x87eebfbaUL),
+    SC(0x0de82ceaUL, 0xe7a0a2c0UL, 0x32db9642UL, 0x49b47662UL, 0x201721eaUL, 0x754aefd5UL, 0xb304d7ccUL, 0xab3ab426UL,
+       0x08f533e0UL, 0x81b88901UL, 0xebcd8547UL, 0x003ade77UL, 0x776ccbe1UL, 0xfb1d2ca7UL, 0xb038c205UL, 0xbe8a915dUL),
+    SC(0x7e74f42fUL, 0xe8d3e772UL, 0x43d11177UL, 0xed249ea7UL, 0x2e87ec05UL, 0xcfb5af22UL, 0x2de3120fUL, 0x022b8214UL,
+       0x2978928fUL, 0xca85867eUL, 0xc9563f6dUL, 0x5e044fa4UL, 0x2eb480f0UL, 0xe2ca86eaUL, 0xacacb1d6UL, 0x66bfc426UL),
+    SC(0x995857b7UL, 0x8066f2b1UL, 0x473eeaccUL, 0xfadafb7fUL, 0x36fdc5d9UL, 0x1ab5fd0bUL, 0x3ac55be3UL, 0x91935876UL,
+       0x631de25eUL, 0x51831901UL, 0xaaa62ca9UL, 0x0391ae54UL, 0x7dda101fUL, 0x26ac6fa7UL, 0x3396f885UL, 0x3b9fb916UL)
+  },
+  {
+    SC(0xa707efc4UL, 0x89165c75UL, 0x7edcea3cUL, 0xce729b44UL, 0x91f04142UL, 0x3fc6ea9aUL, 0x704f52dfUL, 0x0c8a0650UL,
+       0xf2e7657cUL, 0x6c618494UL, 0xc01c5a90UL, 0xd06b625bUL, 0xc9416d63UL, 0xf7b8f809UL, 0xdda5076fUL, 0x74fa2c92UL),
+    SC(0xe670a33eUL, 0x75e7d765UL, 0x9dbc17efUL, 0xa0466808UL, 0x3c57e661UL, 0x975e8197UL, 0x84ed85c6UL, 0x838bdc7dUL,
+       0xdf5e73e7UL, 0x4a1f7445UL, 0xd140fc7cUL, 0xeee1038dUL, 0x333590d3UL, 0x6626d5bdUL, 0x0bdf399eUL, 0x9d9b1843UL),
+    SC(0x751a8413UL, 0x11be980aUL, 0x5a884850UL, 0xc9101021UL, 0x393634c4UL, 0x862d6806UL, 0x2b1e6855UL, 0x2fb42d9bUL,
+       0x26a416baUL, 0xafadc235UL, 0x425ce35fUL, 0xd72e17b8UL, 0x6d13228aUL, 0xac64f30bUL, 0x5cab853cUL, 0x1d80a1bfUL),
+    SC(0xf044f2afUL, 0x6d6842d5UL, 0x946ad6dfUL, 0x43784921UL, 0x47c45378UL, 0x721d1e39UL, 0xccdbc033UL, 0xeb0d07f9UL,
+       0x68e474b7UL, 0xe3b1a102UL, 0xefecbe4aUL, 0xa20134afUL, 0x9f3ddcfcUL, 0x45213188UL, 0x744f7816UL, 0xf381f942UL),
+    SC(0x24208410UL, 0xf23c4fd9UL, 0x042fca91UL, 0x94b5da3eUL, 0xde46e511UL, 0x7b0446f6UL, 0xe92eae4dUL, 0xbfadef52UL,
+       0xb17efefcUL, 0xca0bb9a5UL, 0x1544f8fcUL, 0x15474328UL, 0x84d79be4UL, 0xbb7cc122UL, 0x9aa5d66eUL, 0x450c4849UL),
+    SC(0x6aee88eeUL, 0x018046ceUL, 0x6399c111UL, 0x2ed2e9d1UL, 0x05ae30b0UL, 0x663b75d6UL, 0xa20baa10UL, 0x57a0287fUL,
+       0x44155fadUL, 0x94ff97afUL, 0xff36d407UL, 0x4f0273a5UL, 0xadaefee4UL, 0xe2c48bd5UL, 0xbb1973fbUL, 0x53d65d20UL),
+    SC(0xb112113bUL, 0x921501f6UL, 0x208ace14UL, 0x74cd923eUL, 0xc4ed6cb1UL, 0x1b1fbdf1UL, 0x02786f43UL, 0x6d2efb0dUL,
+       0xd63f1ebbUL, 0xf305ae31UL, 0x2b0fe166UL, 0x23a9cabcUL, 0x0b7c7b76UL, 0x1e62c8a0UL, 0x3eb2388bUL, 0x5635cdb5UL),
+    SC(0x74cc4471UL, 0x707dd64cUL, 0xbc0688c2UL, 0x1d15d3e6UL, 0x863adbcdUL, 0x3b6a0a08UL, 0x78556ed0UL, 0x239ae027UL,
+       0x43c03176UL, 0x1fcf3c22UL, 0x3a7e70caUL, 0x9e27690bUL, 0x53f8b3d5UL, 0xa3782461UL, 0x6d41fdd0UL, 0x7202ee6bUL),
+    SC(0xa23a0d76UL, 0xd391daddUL, 0x23e1654dUL, 0xa654f0ffUL, 0xeb8eb983UL, 0xfb4162c9UL, 0xa9956c12UL, 0xfb77d5cbUL,
+       0x66e0fc9dUL, 0x311c830aUL, 0x003a2229UL, 0xfc4f82e7UL, 0x43592058UL, 0x536a9e7cUL, 0x722a037fUL, 0xf87f1363UL),
+    SC(0xea0c9f05UL, 0x6e39f66bUL, 0x5ab9f833UL, 0x5c8e4655UL, 0xf4ec160cUL, 0x7accf824UL, 0xaa1b5dbfUL, 0x2fc1f8c2UL,
+       0xcbffc05dUL, 0x64ebfc35UL, 0x7df2966dUL, 0xa170fd7aUL, 0xa5861376UL, 0xf8d7f3abUL, 0x6c004671UL, 0xe0dc812aUL),
+    SC(0xea4ba4c9UL, 0x2c8b511aUL, 0x9559c223UL, 0xabb33c27UL, 0x22cec491UL, 0xe48cd519UL, 0x74b3355fUL, 0x04e42cb7UL,
+       0x4a4db6d6UL, 0xf426d463UL, 0x4d6717e3UL, 0xd3b6ab71UL, 0x88ba832eUL, 0x8a18a4e0UL, 0x4f17a698UL, 0xbae7a41bUL),
+    SC(0x939ad0a1UL, 0xa64da497UL, 0x1a6ff2a0UL, 0xa709c485UL, 0x30d752adUL, 0x0a954c8aUL, 0xf632f969UL, 0x95561aabUL,
+       0x9a763429UL, 0x5ffe700eUL, 0xe36d1d65UL, 0xf53ecbdbUL, 0x92bca222UL, 0xe5e2ccb1UL, 0x55cf3a5fUL, 0xc751149cUL),
+    SC(0xf2548d26UL, 0xae82f5d4UL, 0x38ac89c9UL, 0xf8a5f974UL, 0x4632ce26UL, 0x08fa7f62UL, 0x9446a19eUL, 0x2f7c8cf2UL,
+       0x7e584e28UL, 0xb1590b83UL, 0x31ae2228UL, 0x81eb28d5UL, 0x14ac4360UL, 0xb60aff7cUL, 0xd5061606UL, 0xc5cf4014UL),
+    SC(0xa4156dedUL, 0xfa8d19adUL, 0x6471653bUL, 0x42342986UL, 0x74f4f87eUL, 0xa9258de7UL, 0x6ad54fa6UL, 0xf3b986efUL,
+       0xec77cd09UL, 0x0b77e2caUL, 0xc7b4ad0fUL, 0x5e05004aUL, 0x593cef18UL, 0x6c57145bUL, 0x3f9510a4UL, 0x24ca5ab9UL),
+    SC(0x12575248UL, 0xe8aba15dUL, 0x28a06860UL, 0xb5a03e0aUL, 0x942e33b7UL, 0xe5099128UL, 0xda2ee781UL, 0x98333c51UL,
+       0xbd3aa2dfUL, 0xcf99aa06UL, 0x593a3c9aUL, 0x3d22dee6UL, 0xbdcbafd4UL, 0x414a47bcUL, 0x38916a19UL, 0x7c2c2025UL),
+    SC(0xb4262622UL, 0x5bb55310UL, 0x903f5f23UL, 0x3b0591b9UL, 0xadb2a909UL, 0xe09cac82UL, 0x503ee54aUL, 0x64372572UL,
+       0x997ac9a4UL, 0xf1a21373UL, 0x121255caUL, 0x9b622decUL, 0x2b4e7652UL, 0x89731f03UL, 0x37fe5d94UL, 0x24402685UL)
+  },
+  {
+    SC(0x6efd8760UL, 0xaed4f239UL, 0x0bd97a00UL, 0x063794c4UL, 0xef14acc9UL, 0xf5b94862UL, 0x4c7f8b51UL, 0x3ff35278UL,
+       0x74acac29UL, 0x694c5307UL, 0xaa221b37UL, 0xf2ea068aUL, 0xa269fcd3UL, 0xc6d85aafUL, 0xa8c8eac1UL, 0x17d7f997UL),
+    SC(0xda759133UL, 0x159b8d93UL, 0xd75c9aafUL, 0x616d87dfUL, 0x8f7dcebcUL, 0xa518d4caUL, 0xda418b7eUL, 0x39a264eeUL,
+       0x8ad545aeUL, 0x37548bc6UL, 0x1702d08fUL, 0x8de7a2c4UL, 0x3b3392f2UL, 0x3b44b186UL, 0xfe1592e9UL, 0x2f102577UL),
+    SC(0x29bc8d55UL, 0xfaa61a53UL, 0x643e8a7aUL, 0x8f8c039cUL, 0xbb808abbUL, 0x08ec4a96UL, 0xb294e4e7UL, 0xa5a1fd2bUL,
+       0x4a170217UL, 0x07131ba3UL, 0x275bb1bdUL, 0x797809ceUL, 0xcee979a1UL, 0xd2f161b6UL, 0x8b632622UL, 0x2f92100aUL),
+    SC(0x0c15e640UL, 0xb71ed510UL, 0x37d92f02UL, 0x7de2ffb6UL, 0x03524e1cUL, 0x208a6722UL, 0xaadbffe5UL, 0x977de2aaUL,
+       0xb208b26bUL, 0x0eeeb6d6UL, 0x1d783e21UL, 0x35e71c04UL, 0x1ab78e0fUL, 0x96315560UL, 0xd3729c6bUL, 0xcf69c6f0UL),
+    SC(0x9a738ad5UL, 0x89e86d47UL, 0x84abc74aUL, 0xad4c781fUL, 0x72ad7fa4UL, 0x91654392UL, 0x510ae297UL, 0x4464c1c0UL,
+       0x234423bdUL, 0x6b770214UL, 0x7e157d65UL, 0xe35cab77UL, 0x62794253UL, 0xc3e82487UL, 0x8a4fe726UL, 0x6105ad55UL),
+    SC(0x3692b32aUL, 0x5be3acc5UL, 0x3320e434UL, 0x42c8d1b3UL, 0x235d0635UL, 0x49a493e2UL, 0xe4a33b49UL, 0xf02f5504UL,
+       0xac61c2ceUL, 0x38ac1b0eUL, 0x7b3c5d80UL, 0xce988759UL, 0x18e9ff5dUL, 0x669f61cbUL, 0xb285ad07UL, 0x6d436ee7UL),
+    SC(0xdd501ea1UL, 0x3aaa02ceUL, 0x619171ddUL, 0x04270fdaUL, 0xaa164f14UL, 0xc90302c0UL, 0x5a3e10c5UL, 0xbcafaf5fUL,
+       0x20ba19c0UL, 0x8561667bUL, 0xd24c59a5UL, 0xa812fb32UL, 0x972f9231UL, 0x19a4d42dUL, 0x48aca05dUL, 0x9fdfb61eUL),
+    SC(0xf7e3ec26UL, 0x257636eeUL, 0x74eb2c22UL, 0xdc9da3d1UL, 0x4d6cd511UL, 0xa6c34d18UL, 0xa59e3d52UL, 0xb2099502UL,
+       0xa2a302d3UL, 0x50790316UL, 0x0f99cd37UL, 0x66e61ea4UL, 0x8b9b3a92UL, 0xeab54f08UL, 0xdbd6a061UL, 0x5f495eb5UL),
+    SC(0x281dac89UL, 0x3afdc45fUL, 0x4dba86a3UL, 0xfc5b863aUL, 0x23f55d97UL, 0xe49137daUL, 0xc7a31f64UL, 0xa0621a04UL,
+       0x12f9a757UL, 0xc8ebf05cUL, 0x8bf34270UL, 0x77c6d2faUL, 0x852aee99UL, 0xaf3d4ff0UL, 0x9c6522d7UL, 0x5becb9b6UL),
+    SC(0x8de33df6UL, 0x91ab87b2UL, 0x09e36c69UL, 0x687cc788UL, 0xdbe100bcUL, 0x8be07786UL, 0x0892aae4UL, 0xe44d5834UL,
+       0x1a9c323dUL, 0x65aca9dcUL, 0x8a11b116UL, 0x4fb2ad88UL, 0xb8625f61UL, 0x72efdcabUL, 0x88da47e0UL, 0x7cc74bd1UL),
+    SC(0xf2b7d303UL, 0x6342168dUL, 0x75c1ab90UL, 0xc7045095UL, 0xd8f415ccUL, 0x96a86154UL, 0x97425cbdUL, 0xe4067750UL,
+       0xebd266e0UL, 0x7a10d930UL, 0x80241d0aUL, 0x218eb94dUL, 0x51596e36UL, 0x953ae60cUL, 0x25fff023UL, 0x25920883UL),
+    SC(0x8148dcc3UL, 0xda9ce438UL, 0x07edd33fUL, 0x484f6bc3UL, 0x6ebf7b2bUL, 0x5d5c88afUL, 0xc22542f8UL, 0x5c943a95UL,
+       0x591a62f9UL, 0x9796dd71UL, 0xcb18f64aUL, 0x08e30d6eUL, 0x9ab8336bUL, 0xe9c3a684UL, 0xecf891c0UL, 0x3c6e836aUL),
+    SC(0xff688510UL, 0xeccb5b50UL, 0x957de634UL, 0xe4324f21UL, 0x5cadab7bUL, 0x93bf0dc5UL, 0xce94736eUL, 0xa93cde8aUL,
+       0x37d46d44UL, 0xe61fc958UL, 0x6b0da8acUL, 0x2023bcf5UL, 0x75f8a9c7UL, 0x9d30c993UL, 0xe3d9a650UL, 0x0764e1ceUL),
+    SC(0xeeec9568UL, 0x1a66969aUL, 0xe524bd76UL, 0x580efde7UL, 0x99302202UL, 0x16aa7549UL, 0xd39a98b2UL, 0x59d717e1UL,
+       0x64c4db73UL, 0x487b23fdUL, 0xab74b50eUL, 0x53fc8d1dUL, 0x336db703UL, 0x444b5844UL, 0xb0d8756bUL, 0xb84c289cUL),
+    SC(0x3b2616e9UL, 0xb51808efUL, 0x430e714bUL, 0xceb9a747UL, 0xaed9e31aUL, 0xa9caf6c3UL, 0xd57c1565UL, 0xcd9b7f88UL,
+       0xe6b4bdaaUL, 0xaa1ea551UL, 0x4af2705cUL, 0x47f07417UL, 0xb2a03befUL, 0x2b406760UL, 0xe86765f7UL, 0x23cb0438UL),
+    SC(0x5f0eef38UL, 0xc87db43fUL, 0x6498709dUL, 0x48c445a1UL, 0xac50b40dUL, 0xf882ecb9UL, 0x414a56e2UL, 0xec927ad0UL,
+       0x8197f585UL, 0x73b0c534UL, 0x49c04d6aUL, 0xb0baca10UL, 0x3c97d9c3UL, 0x9a61dafdUL, 0xfc793c5fUL, 0xdf7104afUL)
+  },
+  {
+    SC(0x2def7e67UL, 0x7906cf3fUL, 0x3677e7b6UL, 0x01b0a8f8UL, 0x985fbd9bUL, 0x23265ea7UL, 0x18a5c16eUL, 0x0139f0a8UL,
+       0x650a89bbUL, 0xdf8c8326UL, 0xd364fae7UL, 0x558de827UL, 0xa529780cUL, 0x9b7bf8f1UL, 0xc6925632UL, 0x7c59c74cUL),
+    SC(0x170634adUL, 0xde4863bbUL, 0x3090218eUL, 0x543c310eUL, 0x9bef094eUL, 0x94003fb7UL, 0x5f89b076UL, 0x757f8900UL,
+       0xb708e4e9UL, 0xcdb53954UL, 0x2bd573f6UL, 0xeee4774bUL, 0xad2cd18aUL, 0xab0b0157UL, 0xdd1d3aa3UL, 0xaff70dd4UL),
+    SC(0xcaf1623eUL, 0x21907368UL, 0x7d3a686aUL, 0x7d48f9b9UL, 0x953fda37UL, 0x3f68ceeeUL, 0x66b5647cUL, 0xba9ac0c8UL,
+       0x95ec09e2UL, 0x533a173eUL, 0x1773b047UL, 0xa0702977UL, 0x3167a96cUL, 0xc7a2bb42UL, 0x074ecfd4UL, 0x9b1b7948UL),
+    SC(0xdd21377bUL, 0x234e31e2UL, 0x7a42e856UL, 0x305186d6UL, 0x33eda53eUL, 0x5bdfb93bUL, 0xf83159abUL, 0x9cd37bf2UL,
+       0x27a40d9dUL, 0x9bb0437cUL, 0xc079c24eUL, 0xe3a8a10bUL, 0xc54c8af7UL, 0x6dda2e35UL, 0xab61e260UL, 0xddf6feafUL),
+    SC(0x5d6d3e69UL, 0x3865d2b8UL, 0x4c0061c8UL, 0xfc85da28UL, 0xedd6ab37UL, 0x0bb6bc5dUL, 0x00eaef0dUL, 0x6ed7d0a8UL,
+       0xbb15835fUL, 0xe6074d1dUL, 0xc05e4840UL, 0xa22532afUL, 0xb33a1131UL, 0x80073cceUL, 0x17b77822UL, 0x33dde5ceUL),
+    SC(0x3df62006UL, 0x31fbdf0dUL, 0x8ae7d924UL, 0x370927caUL, 0xf27587a0UL, 0xd7bce798UL, 0xe6556a8cUL, 0x62f108edUL,
+       0xc4aa6712UL, 0x405c44e9UL, 0x389e0a03UL, 0x952ce263UL, 0xc073b849UL, 0x0ec66cb7UL, 0xb9e203e4UL, 0x12017771UL),
+    SC(0xd49653b7UL, 0x639eeba7UL, 0xe9d82b1aUL, 0x61b0e1c5UL, 0x1363337cUL, 0xeed06916UL, 0x47f81c25UL, 0xb2f71e6bUL,
+       0xf1411513UL, 0x77e6553bUL, 0x66221284UL, 0x3f390c4dUL, 0xef25b316UL, 0xe1123b19UL, 0xa5f77c97UL, 0xb4559e79UL),
+    SC(0xfb4a40b9UL, 0x77153349UL, 0x3d316d3fUL, 0x2688f6acUL, 0x32b63e35UL, 0x6f8fcc17UL, 0xca1a9008UL, 0xb9a90745UL,
+       0xd49d6d04UL, 0x0ba60238UL, 0x5cca34c2UL, 0x6e5e3ea2UL, 0x8396a459UL, 0xc9f54478UL, 0xf1e93e94UL, 0xfd3545e4UL),
+    SC(0x02b5f9b4UL, 0x512e7676UL, 0x82d7f93bUL, 0x39027d9cUL, 0x4d2788c4UL, 0xb587dd66UL, 0x8e7e2a49UL, 0x2d1fa3adUL,
+       0x507b76a7UL, 0x33682d56UL, 0x6a2773f5UL, 0xc3cda342UL, 0x2152e9c4UL, 0x09c204aaUL, 0xbd015dc3UL, 0x9c9469f6UL),
+    SC(0x055e1a77UL, 0x2c3406b7UL, 0xb300e7deUL, 0xd35ff44dUL, 0x76fbb312UL, 0x7859c80fUL, 0x841bd730UL, 0x45c0c006UL,
+       0xf7f2b9f4UL, 0x07c2ec8dUL, 0x9b476229UL, 0xec773a2dUL, 0x7316b391UL, 0x8f98d540UL, 0xe110d196UL, 0x58cdd0c3UL),
+    SC(0x0269a6adUL, 0xe6e25392UL, 0x021f59cdUL, 0x10456fe1UL, 0xb5e3a756UL, 0x1e13e578UL, 0x3cc6b7c6UL, 0x0ef145acUL,
+       0x3827d2beUL, 0x094cde1fUL, 0xded8306aUL, 0x6619b933UL, 0xac2515cbUL, 0x45cffd75UL, 0x267caff4UL, 0x1e76d6caUL),
+    SC(0x0e48e1e7UL, 0x87d48c62UL, 0x8e85040eUL, 0x2c836be9UL, 0xcfb20d10UL, 0x51a251ccUL, 0x9e46b589UL, 0x485a29f8UL,
+       0xaee94719UL, 0xb64713a1UL, 0xff2f2402UL, 0xec6a19c1UL, 0x4df12f40UL, 0x6214c49aUL, 0xd9b00234UL, 0x4325730cUL),
+    SC(0x07612f9eUL, 0x0691cd23UL, 0x0701a213UL, 0x79582527UL, 0xd658be1fUL, 0x526c220eUL, 0xda6fc536UL, 0xb3f7780dUL,
+       0xa21538eeUL, 0xe80268c9UL, 0xab6dbe6dUL, 0x1890c4f2UL, 0x99aa8dd9UL, 0x82e9978cUL, 0xb6ea37edUL, 0x53308c10UL),
+    SC(0x34761addUL, 0x2f2dfb4aUL, 0x06adf1f0UL, 0x81aff3c5UL, 0x1faef7cbUL, 0xbc1a989fUL, 0x3e23afbaUL, 0x288c11efUL,
+       0x50c8b3b2UL, 0x9424d319UL, 0x08d55c10UL, 0x3976f312UL, 0xbfa480eeUL, 0x9e93caf4UL, 0xb75fa97eUL, 0x1517d3a1UL),
+    SC(0x8e57bcd4UL, 0x5c8e9789UL, 0x624ad4b3UL, 0x8a9d5be8UL, 0xbcac139eUL, 0xa0abc310UL, 0xa1c272b2UL, 0x35942e69UL,
+       0x8daf7fa3UL, 0x43dd401bUL, 0xc8aef9d9UL, 0xc102b577UL, 0x28535818UL, 0x3e379de4UL, 0x5e5ce268UL, 0xe9f9b548UL),
+    SC(0xb9c35f36UL, 0x2b93a8fdUL, 0x021c9307UL, 0x091c659bUL, 0x270fbe0cUL, 0x965c8de8UL, 0xb5b45ff1UL, 0xe4c8eadbUL,
+       0x2e506d1fUL, 0xa9fdb177UL, 0x0e0a818dUL, 0xb40d8f67UL, 0x2b5ef2abUL, 0x072f051eUL, 0x8f6eee9bUL, 0xfc74b9e8UL)
+  },
+  {
+    SC(0x9705d56fUL, 0xf75c7d2cUL, 0xbacc47a4UL, 0xa6cf8b10UL, 0x300c688cUL, 0x0fdbd1b1UL, 0x528f41b9UL, 0x652d49faUL,
+       0xc53f7f11UL, 0x896f2edbUL, 0xfc957dd7UL, 0x2cc90856UL, 0xc5df9d86UL, 0x43e42489UL, 0x70182843UL, 0x84201b98UL),
+    SC(0x1fb0f8f5UL, 0xce10e878UL, 0xabf40518UL, 0x116bbc18UL, 0x0ee77a22UL, 0xf701108eUL, 0x0a8c4f9fUL, 0xf6562080UL,
+       0x8f761286UL, 0x34089abeUL, 0xb48bae3bUL, 0x882019c0UL, 0x9bcc5386UL, 0x20fa98ddUL, 0x4a3710a1UL, 0xe4e9bb46UL),
+    SC(0x4a807b29UL, 0x3b312ca6UL, 0xacb43f49UL, 0x6436b137UL, 0x036748bcUL, 0x15c48dcbUL, 0x7dd35e75UL, 0xfd2a5668UL,
+       0x6115f059UL, 0xe21f7257UL, 0xc8888959UL, 0xd1401db4UL, 0xc77a0086UL, 0x34cc2206UL, 0xe8a8d4baUL, 0x1540def8UL),
+    SC(0x288ab400UL, 0x5444930cUL, 0x15410269UL, 0x9757d7feUL, 0xb8410241UL, 0x38c45db6UL, 0xd6a628c8UL, 0xe0100ad6UL,
+       0xbed94f18UL, 0x78f4b61bUL, 0xc0b557d3UL, 0xcecd946aUL, 0xf9d105d7UL, 0xa298cb73UL, 0xfccbddd2UL, 0x4210cf48UL),
+    SC(0x22a7d3c8UL, 0x85001932UL, 0x985e9543UL, 0x1e470770UL, 0xf664ffd8UL, 0xe4593acaUL, 0x7c93a7d0UL, 0x9fe01b93UL,
+       0x65172aa0UL, 0x9a61749dUL, 0xd0695269UL, 0x4a15696aUL, 0x947c8b37UL, 0x7ab24041UL, 0xd76aa7c8UL, 0x03055290UL),
+    SC(0x4470823bUL, 0xbbf22c97UL, 0x7602d166UL, 0xdc895df0UL, 0xa562a732UL, 0xf905ea78UL, 0x416a74a1UL, 0xeb0f35fdUL,
+       0x01b1eeffUL, 0x736ef902UL, 0xaff3980cUL, 0x36b47ce0UL, 0xc7611f5fUL, 0xcb83658fUL, 0x7c5bc15bUL, 0xc6e35414UL),
+    SC(0xbf345a75UL, 0xc16ba113UL, 0xa4255ce6UL, 0xcd485235UL, 0xd7b71b8cUL, 0x11fd0d49UL, 0x1bff369eUL, 0x0240aaaaUL,
+       0x8a8b2999UL, 0xe06ffa8dUL, 0x89932713UL, 0x0b1bb5c5UL, 0x6837bf51UL, 0xaea390baUL, 0x9579f2e5UL, 0x566e7c1eUL),
+    SC(0x9ca5d558UL, 0x2737e890UL, 0xf9a7dbafUL, 0xd921177fUL, 0x459d791dUL, 0x21f9993cUL, 0x481594feUL, 0xb9aa7112UL,
+       0x808fbe3fUL, 0xcc3e80d3UL, 0x0f6e2703UL, 0xf55b32adUL, 0xcc1ee8e9UL, 0x6fdd0250UL, 0xd7373b15UL, 0x083918a6UL),
+    SC(0x4d3b878dUL, 0xac7d1878UL, 0xa2cb8ef1UL, 0x029c488fUL, 0x59f26f1cUL, 0xd56d5476UL, 0x7b008e47UL, 0x0eb7a293UL,
+       0x0ea8ade6UL, 0xa46ce8f9UL, 0x4602d631UL, 0xe0147981UL, 0x3422eb50UL, 0xe87cddd6UL, 0x792a1ee6UL, 0x2c338f40UL),
+    SC(0x2bef9f5cUL, 0xaccfea49UL, 0x697aac36UL, 0x24c7db8aUL, 0x62f03620UL, 0x109f1cceUL, 0xfc46af89UL, 0x25489a69UL,
+       0xb39a88a0UL, 0xd7d59b29UL, 0xb7773984UL, 0x53e6eb2fUL, 0x7b557171UL, 0x20de3625UL, 0xa917853aUL, 0xed1f8d83UL),
+    SC(0x74a0d8dcUL, 0x415a228fUL, 0x3bfa9533UL, 0xe7d4e544UL, 0xf03551c4UL, 0xd55b0d2fUL, 0xfd524d17UL, 0x835c3132UL,
+       0xd3c7c720UL, 0xc44b1742UL, 0x49c2d9adUL, 0x3e9c5f9cUL, 0xeb174ba1UL, 0xbcecab7bUL, 0x5816cba9UL, 0x9057b5c3UL),
+    SC(0x33b23068UL, 0x27e030cfUL, 0xf0673254UL, 0xee13b94eUL, 0x6d7377d5UL, 0xfb8c9a83UL, 0xed50e9ebUL, 0x4ac6d5f3UL,
+       0xb0116426UL, 0xca9fc25cUL, 0xa4f9834dUL, 0x6d8974daUL, 0x1571a54eUL, 0x1f507696UL, 0x879ecac2UL, 0x5f23b095UL),
+    SC(0xa45a4cb8UL, 0x24d90134UL, 0x5ea541f0UL, 0x6896387aUL, 0x12711d70UL, 0x6f07a850UL, 0x69478780UL, 0x2e49a474UL,
+       0xbb236a74UL, 0x96161e43UL, 0xf708abb8UL, 0x80e3d0a7UL, 0xa6354a33UL, 0xcb760bccUL, 0x593bc8c8UL, 0x07c8f433UL),
+    SC(0xfba31e01UL, 0x2f38c223UL, 0x3750fb25UL, 0x085c2c33UL, 0x4fe3afb0UL, 0x36b17fedUL, 0x5e8d513dUL, 0x552dc2b7UL,
+       0xd6d8f5c2UL, 0x745b2c90UL, 0xd5c201f5UL, 0x524f2b0dUL, 0x49020ae2UL, 0x4eca8e21UL, 0xb95cebdfUL, 0xaf25e5c6UL),
+    SC(0x8a5bf15fUL, 0xe026e897UL, 0x190ee896UL, 0xf79927a8UL, 0xa8658d05UL, 0xf9a0f6a6UL, 0x79ac8971UL, 0x4ca26fbbUL,
+       0x639849f2UL, 0x41d99df9UL, 0xd217d702UL, 0x4e6c5bf2UL, 0x9e44b7adUL, 0x63e0b091UL, 0xbd235d45UL, 0x4cb07ebcUL),
+    SC(0x43daf5b8UL, 0x4f1706faUL, 0xcdbfab46UL, 0xe4ee5188UL, 0xb8697efeUL, 0xf6d1274aUL, 0x77af6bf7UL, 0xb1ae23f7UL,
+       0xd2fae1e8UL, 0x721553b7UL, 0xe63130aaUL, 0x76f61e96UL, 0xa34e60bcUL, 0xfe7bdb8dUL, 0x6879a39eUL, 0xdb08d8a0UL)
+  },
+  {
+    SC(0x5b27aec1UL, 0xc644f0a9UL, 0xba7f6486UL, 0x9a960ea6UL, 0x028343abUL, 0xda3feab2UL, 0x4a2d6addUL, 0x754866a2UL,
+       0x3d1f365cUL, 0x2aee6c1eUL, 0xab2f1879UL, 0x429b6275UL, 0x5d1bac85UL, 0x2998ef25UL, 0x8a914bfcUL, 0xca280b43UL),
+    SC(0x472e2d82UL, 0x220169b4UL, 0xe249b18bUL, 0xee3d0188UL, 0x70b91ff8UL, 0x77fa9f64UL, 0x9a23ca43UL, 0xa5aa9271UL,
+       0x908226fcUL, 0x2704e162UL, 0xc96297f7UL, 0x6af76d80UL, 0x32b7845eUL, 0x9b998466UL, 0xcd106e37UL, 0x1a61feb1UL),
+    SC(0xe9d0d14bUL, 0x3cdd4531UL, 0xf8125e83UL, 0xdc3ddfdaUL, 0x18d64976UL, 0xbb4521aeUL, 0x83a9d9aaUL, 0x8609b431UL,
+       0xe1f950aaUL, 0x821f586aUL, 0x91988d6eUL, 0xe3ca4db1UL, 0x1574041dUL, 0x00140c64UL, 0x2ba9a1adUL, 0xcd1c52eaUL),
+    SC(0xe47190c1UL, 0xf5fa4910UL, 0x6160e301UL, 0x69e8a087UL, 0x76a9e996UL, 0xaebef7d8UL, 0x2b1d7248UL, 0x7d38ac4dUL,
+       0x50abab42UL, 0xdea32fa5UL, 0xaf0d65cbUL, 0x3dd950f1UL, 0xd2e54bdaUL, 0x47d990eeUL, 0x9fd9cf49UL, 0xcc552d1bUL),
+    SC(0xdd7cc010UL, 0xb8c93c99UL, 0x084c19b2UL, 0x37aa2b6fUL, 0x1e51c765UL, 0x7b93bb9eUL, 0xe4d0ea60UL, 0x2d6dae8bUL,
+       0x9f2773e8UL, 0x15aa182dUL, 0xf6ee5e70UL, 0x8af9e8ccUL, 0x6ed5f82bUL, 0x994633b5UL, 0x545ff889UL, 0xc5503e5eUL),
+    SC(0x6e4656b5UL, 0xaa8f321dUL, 0x80a46a7eUL, 0x721ab22dUL, 0xf5216f9bUL, 0x602aa74aUL, 0x84de050bUL, 0xa3851d8dUL,
+       0x170a272eUL, 0xf646cd5bUL, 0x0e3c1d9dUL, 0x14e19601UL, 0x2f7b140aUL, 0x136b509eUL, 0x580c4800UL, 0x07c0fa08UL),
+    SC(0xd0cccf87UL, 0x813d74c1UL, 0xe0ef5315UL, 0x2a2e82a8UL, 0x9d6729bbUL, 0x23c8f450UL, 0xd1e5af64UL, 0x4b7f6341UL,
+       0xb5c903e9UL, 0xdc51b73bUL, 0x5cfaed20UL, 0xb9986f80UL, 0xb19aed65UL, 0xd11e624cUL, 0x53162315UL, 0x2ab2cb5eUL),
+    SC(0x87f7d90eUL, 0x8f519af2UL, 0x34262929UL, 0xc4801bdbUL, 0xfe472f0eUL, 0x3eb746a0UL, 0xcfdde906UL, 0x1697a540UL,
+       0x36b97cecUL, 0xb6a1766dUL, 0xb349034eUL, 0xa980f0d3UL, 0x00cc653bUL, 0x5ae732f3UL, 0xe9868d37UL, 0x1343db0fUL),
+    SC(0xfeacbc45UL, 0x43a59a7aUL, 0x3fe37bdfUL, 0x5f05885aUL, 0xa38cc3aeUL, 0x68e423d9UL, 0xe90da9dfUL, 0x15569f45UL,
+       0xf1aaa0e4UL, 0x230faf54UL, 0xc1a394c4UL, 0xfab80639UL, 0x184d42bdUL, 0x62fe74faUL, 0xd2b9d8deUL, 0x2bd13779UL),
+    SC(0xdb4aad1aUL, 0x7d5b51f4UL, 0xbe47fe0aUL, 0xd8b14711UL, 0xe03e0283UL, 0x3076470eUL, 0x7291f310UL, 0x0bb88b65UL,
+       0x51b5928eUL, 0x9e6adc38UL, 0xbe8e5e7fUL, 0xa93336eaUL, 0x4ae1f65dUL, 0xde69b73cUL, 0x62e04384UL, 0xfcca96d2UL),
+    SC(0xf6a6bd4dUL, 0x3f763afcUL, 0x721fd2d9UL, 0xed42d34fUL, 0x0df38bc9UL, 0x4fec069aUL, 0x8f8aeb76UL, 0x8b23f74bUL,
+       0xd513f993UL, 0xf97d6fccUL, 0x9a7fcd74UL, 0x0458dc00UL, 0x437fb611UL, 0xb7e09b9eUL, 0xa9e85c93UL, 0x1facecb7UL),
+    SC(0x982457c5UL, 0x6c22522dUL, 0xe0d10fa0UL, 0x64a0f8e1UL, 0x52fe9924UL, 0x6f20a794UL, 0x81df8facUL, 0x8fc08ab7UL,
+       0x2e080ddeUL, 0xa66a3e43UL, 0xaf44f9eeUL, 0xbbb9962fUL, 0x16110b33UL, 0xb0e9d83eUL, 0x38333aafUL, 0x89be29c6UL),
+    SC(0x2cd27cb8UL, 0xd3646f0dUL, 0xa549cf0eUL, 0x94e70cbdUL, 0xc40082dfUL, 0xb4a04456UL, 0x47579397UL, 0xe3e12d91UL,
+       0xc17377cbUL, 0xe2ab57d1UL, 0x1d6c5cbdUL, 0xc5fef865UL, 0x440dd8ebUL, 0xcb5cec53UL, 0x124872dcUL, 0xa49409e1UL),
+    SC(0x6f34f416UL, 0x2a190923UL, 0x8a2b5561UL, 0x54a056e4UL, 0x9549d6f1UL, 0x72929ab4UL, 0x0fb49175UL, 0xb7da0cb1UL,
+       0x2a0ff98fUL, 0x98422e19UL, 0xe394f868UL, 0x7f2eb9d6UL, 0xdbf7129cUL, 0xc98df378UL, 0x31895799UL, 0x445a5211UL),
+    SC(0x3190285dUL, 0xd898dd64UL, 0x770729cfUL, 0x25f59339UL, 0xeee3971fUL, 0x16b08450UL, 0xa87c9916UL, 0xefb1adcaUL,
+       0x5423d919UL, 0x1eb4bf71UL, 0xfa55c153UL, 0x161ec8a0UL, 0x6f5930bcUL, 0x17ad25f9UL, 0x39f229d9UL, 0x8af5382dUL),
+    SC(0x3a150c48UL, 0xd4c56e7eUL, 0x9d910864UL, 0x29b43219UL, 0x9c95881aUL, 0xd481e0d1UL, 0x59aaee93UL, 0xb19ceb72UL,
+       0x290d1c34UL, 0xf241d3b4UL, 0xf7bcd618UL, 0xf585578eUL, 0x7d17a89bUL, 0x9be52eeaUL, 0x41020f37UL, 0xe1f521f2UL)
+  },
+  {
+    SC(0x53512a21UL, 0x4a659914UL, 0x82cc157fUL, 0xda02880fUL, 0x7c4ff9e6UL, 0x47a93136UL, 0xc1e55725UL, 0x9ce7132fUL,
+       0x3ccac75bUL, 0x13cc40faUL, 0x5ab2e017UL, 0x80f55f2eUL, 0xb8e6a7e7UL, 0x22b2e6b1UL, 0x13a28316UL, 0x0b3c99d3UL),
+    SC(0x941512ffUL, 0x09ddbed5UL, 0x13d60b50UL, 0x1f3425e5UL, 0xd210fab7UL, 0xf30b2ffdUL, 0xdb6bb10dUL, 0xb102cfa4UL,
+       0xce038b23UL, 0x257413b9UL, 0xf3bb957eUL, 0x43b25747UL, 0x49fdb5c7UL, 0xa975667cUL, 0x72de28a4UL, 0x46cf4572UL),
+    SC(0xcc2210ecUL, 0xee7d9560UL, 0x753ef5c9UL, 0x01ff9590UL, 0x230ea13dUL, 0x8416d73eUL, 0x47332720UL, 0xecc63f9eUL,
+       0xcc800501UL, 0xdadde2a4UL, 0x152ff67fUL, 0x9d430ed8UL, 0x3ae15e7aUL, 0xe5bb493fUL, 0x95d41167UL, 0x327eea9eUL),
+    SC(0x384629d5UL, 0x414c9230UL, 0x60077a1dUL, 0xe52fb3eeUL, 0xed883b32UL, 0x46d6f21fUL, 0xe18285c9UL, 0x2b1562abUL,
+       0x9aa889f0UL, 0xf0bb4632UL, 0x7ff7ffabUL, 0xbeb7eb30UL, 0xd8730560UL, 0xedc85521UL, 0x425d7f6bUL, 0x372b2272UL),
+    SC(0x1ff9dac3UL, 0xa65aafa9UL, 0x08693a45UL, 0x3ac3ee51UL, 0x915cf4eaUL, 0x1651a456UL, 0xb1a03aa0UL, 0x250e9d97UL,
+       0x9245a361UL, 0xa7831503UL, 0xbe192d77UL, 0x2f592cb1UL, 0xf9129287UL, 0x9ccfc15fUL, 0x494eb437UL, 0x9edafcbbUL),
+    SC(0x0448f1c1UL, 0xdb9f6274UL, 0xe49511a6UL, 0x026ad249UL, 0xe2c0b808UL, 0x1939a383UL, 0x609bdabcUL, 0xdd94ade5UL,
+       0x6c142261UL, 0x2a8a6cf4UL, 0x1d4bf7acUL, 0x8e6e7c87UL, 0x2dc33b72UL, 0xa87ef595UL, 0xe9e0ba72UL, 0xc68fecb7UL),
+    SC(0xc6b5006eUL, 0x08fabf0cUL, 0xd3e72c2bUL, 0x45368021UL, 0xb6e53820UL, 0x59fcbca0UL, 0x3da03181UL, 0xb72e6eb7UL,
+       0xc579f919UL, 0xcb4bb266UL, 0xa527a446UL, 0x80dc9300UL, 0x629ac1b7UL, 0x4a5ed005UL, 0xf5c455eeUL, 0xbfd5aea7UL),
+    SC(0xf4d156aeUL, 0xda9f6e55UL, 0xf455080dUL, 0x35fc507aUL, 0xbcd2b23fUL, 0xde6d893bUL, 0x5ba039dbUL, 0x27493953UL,
+       0x7d45e992UL, 0xa2d4b8ccUL, 0x41c2849cUL, 0x34e785b4UL, 0x8fdb39c2UL, 0xe715328eUL, 0x9f7690a7UL, 0x31bb5e66UL),
+    SC(0xbd72705eUL, 0x9d2a78f5UL, 0x6d39be16UL, 0x0b1aae55UL, 0xda527752UL, 0xc3ada8adUL, 0x3f715d37UL, 0x7e3784e4UL,
+       0x05b5f856UL, 0x7559fc2dUL, 0xb7088120UL, 0x9e71be70UL, 0xdb2a4404UL, 0xe9076084UL, 0x7f4d7bd4UL, 0xe2aeb3c7UL),
+    SC(0x9c6bce85UL, 0x191030ffUL, 0xc60b2b07UL, 0xc8187f79UL, 0x249fc982UL, 0x47508c9fUL, 0x02797da3UL, 0xc21c06fbUL,
+       0xdd7be1e8UL, 0x86931a24UL, 0x925e899bUL, 0x347a81cdUL, 0x85eb17bcUL, 0xb73f9caeUL, 0x1097935bUL, 0x462d0937UL),
+    SC(0x1a357743UL, 0x84feeda0UL, 0x405e9e16UL, 0x28657462UL, 0x218f4b2aUL, 0x7921ed05UL, 0xdccabcc6UL, 0x6fe5aeb9UL,
+       0x8e44029fUL, 0x7b28b880UL, 0x9640e5c6UL, 0x60131513UL, 0xe283ef66UL, 0x983770ceUL, 0x686aa706UL, 0x81b1aaa4UL),
+    SC(0xd1908dd7UL, 0xf1b5eaa2UL, 0xa1f9f066UL, 0x00683db7UL, 0xb3ce644fUL, 0x77a839f1UL, 0x488c90a1UL, 0xe372f18fUL,
+       0xa221de7cUL, 0x15bf27f4UL, 0xff71f3eeUL, 0xfb068463UL, 0x079d09aaUL, 0x3b6e8b82UL, 0xbbe9eac6UL, 0x08c00738UL),
+    SC(0xb7be7d12UL, 0x1e964ddaUL, 0x820fb389UL, 0x2f9e99aaUL, 0x36e8dc2eUL, 0x7498ea80UL, 0x34af4397UL, 0xffb82b91UL,
+       0x88813b9eUL, 0xc333a6c4UL, 0x78b627faUL, 0xafe0a657UL, 0xdcf449ceUL, 0x3a5adaa5UL, 0x662a81b0UL, 0x68b8f5eaUL),
+    SC(0x6a66cc8dUL, 0x27ad7843UL, 0xea1a9b74UL, 0x373e413aUL, 0x1b3b23a5UL, 0xfd25a58dUL, 0x6b75a231UL, 0xb97538e7UL,
+       0xafb5aa7fUL, 0xf3cbdd2cUL, 0xa4dc9694UL, 0xe56141d1UL, 0x85550285UL, 0x8dd6c89cUL, 0x7938be2cUL, 0x0a2856c4UL),
+    SC(0x2b1e7d33UL, 0xb7d1ff91UL, 0xac03cd10UL, 0xf3756e9aUL, 0xd39d358fUL, 0x2f63c2fcUL, 0xe89df693UL, 0x05e16d3eUL,
+       0xd42588b3UL, 0xd1b1fdeeUL, 0xb860b4aaUL, 0xd0ded901UL, 0xbae1bb87UL, 0x681fc257UL, 0xe843ab8aUL, 0x76280692UL),
+    SC(0xf7745d72UL, 0x07b747b4UL, 0xe9d6e7c7UL, 0x1242705dUL, 0x140ed4c4UL, 0xd43d28cfUL, 0xa0a8afc5UL, 0x37ac932cUL,
+       0xf640180bUL, 0x06b8b0ebUL, 0xc94c8931UL, 0x2f897e5dUL, 0x1ecf427dUL, 0x7c86d2d0UL, 0x772ed63dUL, 0xf4cc3444UL)
+  },
+  {
+    SC(0x0534e9d8UL, 0xbea140bbUL, 0x4970b516UL, 0xc42f2677UL, 0xdc413f42UL, 0x9b7c56deUL, 0xe261f60dUL, 0xec68f9d8UL,
+       0xe55aff90UL, 0x1098b0a9UL, 0xea377acdUL, 0xb62dc479UL, 0xda109514UL, 0x2654107aUL, 0x28c68e9fUL, 0x073b1cbaUL),
+    SC(0xf0e363fcUL, 0x4c8761adUL, 0xbf4245e2UL, 0xb151a7d4UL, 0x335c9856UL, 0xbdb9fb2cUL, 0x1e53fc76UL, 0x28a9a69bUL,
+       0x4629a699UL, 0x3f8753b8UL, 0x6d2190f6UL, 0x505e009fUL, 0x6fe56739UL, 0x9dc77507UL, 0xa1cd4cb8UL, 0x920b0cedUL),
+    SC(0xa28116fcUL, 0x5e3541e8UL, 0x08ffe043UL, 0x160a97caUL, 0xb1d6e898UL, 0xb6a3acf4UL, 0xd150860eUL, 0x5bb6a1c2UL,
+       0xe43aec5dUL, 0x22795bcfUL, 0x7979e260UL, 0xde7da3fcUL, 0x46023dfeUL, 0x8db4851cUL, 0x165a2fb3UL, 0x47c204e8UL),
+    SC(0xcf6eca04UL, 0x328af9f8UL, 0xe461b6e8UL, 0x9251f94bUL, 0x3156a63bUL, 0xd440d6c2UL, 0xb6dee5c8UL, 0x7ead5b29UL,
+       0x1dcf90f5UL, 0x9bcd5c0fUL, 0x362de1f6UL, 0x1b7a93d0UL, 0x6ab64659UL, 0x7f77bf94UL, 0xb8bed972UL, 0x9f096f2dUL),
+    SC(0x44bcd74bUL, 0x2cdc4b13UL, 0xf48e3cbfUL, 0xb005bf74UL, 0xbd114fe0UL, 0x5c2661adUL, 0x046642f8UL, 0x7e952fd3UL,
+       0x8873b17bUL, 0x67848110UL, 0xfd200c6cUL, 0x0bba0782UL, 0x34dadccdUL, 0x70dd83bdUL, 0xcafbca31UL, 0xdf373440UL),
+    SC(0x2dd5eabaUL, 0xe7cbff44UL, 0xd2e56df0UL, 0x14fe3577UL, 0xefbe6df3UL, 0x57b870caUL, 0xfcf5bfa3UL, 0x78d35cf3UL,
+       0x6922806aUL, 0x4ed044ebUL, 0xd711f510UL, 0xe7c5c846UL, 0xce892189UL, 0xba4479d3UL, 0x7ee95a8aUL, 0x11983756UL),
+    SC(0x98294f63UL, 0x5eac3fdfUL, 0xf8e07f53UL, 0xd24e650fUL, 0x02e470b0UL, 0x6be9193fUL, 0x1463f1baUL, 0xc37bcf5dUL,
+       0x06a03eceUL, 0x4f397658UL, 0xf232bde5UL, 0x71f33a4bUL, 0xa8058641UL, 0xe301c99fUL, 0xe1df978cUL, 0x74236a47UL),
+    SC(0xc68b7c67UL, 0x36003c06UL, 0xd29ed03bUL, 0x2faedf60UL, 0x5ef705f0UL, 0xf1172166UL, 0xb63bdcc5UL, 0x437bcf0fUL,
+       0xa62dfd76UL, 0xc1df5d72UL, 0x680eaf7dUL, 0x51359a63UL, 0x82ce005dUL, 0xfac432e0UL, 0x672f63cbUL, 0xcc4367aaUL),
+    SC(0x10da4eb6UL, 0x72c088beUL, 0xd2d4a28eUL, 0x3e48efb5UL, 0xf4a456beUL, 0xb501183aUL, 0x816615ccUL, 0xf23b598aUL,
+       0xab798e69UL, 0x026e55ebUL, 0xc0435828UL, 0xa8006356UL, 0x5cc6ea48UL, 0x892f748aUL, 0xa6ed1685UL, 0x36a3bec7UL),
+    SC(0x24363000UL, 0xa821cc76UL, 0x4bb2c552UL, 0x03c37457UL, 0x9462263eUL, 0xdf791598UL, 0xcf7ab8f0UL, 0x89178ea1UL,
+       0xc6d07d19UL, 0xd53ffbddUL, 0xf367f46aUL, 0x6fffd5acUL, 0xe2236f63UL, 0x26fb18cbUL, 0x3a7d543bUL, 0x9f193b01UL),
+    SC(0x459ff583UL, 0x3501bc72UL, 0x13c135c9UL, 0xbe63ef4bUL, 0xfe99b731UL, 0x917dd475UL, 0xb356fd72UL, 0x21705c8dUL,
+       0x9c3ef5e7UL, 0x4483e1a7UL, 0x42316df0UL, 0x9f313a10UL, 0x17858e7fUL, 0xef432763UL, 0xdf139b4cUL, 0x548aa325UL),
+    SC(0x43e3d2c8UL, 0x44b6ec8bUL, 0xb5ffc06bUL, 0xd2a48ad4UL, 0x39893fc6UL, 0xa9748cceUL, 0xe55adc76UL, 0xd616b503UL,
+       0x62efde43UL, 0xb6525e9dUL, 0x6de6a7f9UL, 0x8831e194UL, 0x09296aebUL, 0x7ffe715bUL, 0x4a064166UL, 0xc18144f2UL),
+    SC(0x8d6eb1ecUL, 0x05abe1d6UL, 0x2ecf6a0cUL, 0xe1283a22UL, 0xe1259cd9UL, 0x4ae96c8bUL, 0x1fa03521UL, 0x8439f798UL,
+       0x09b7e03fUL, 0xf50082ebUL, 0x38098a19UL, 0xc417c4b2UL, 0x74432e47UL, 0x79faa37aUL, 0x2ed5e43fUL, 0x0daaed45UL),
+    SC(0xfbaf2899UL, 0x4a9ebe2fUL, 0xcbd854caUL, 0xd1beddc6UL, 0x7ea94f73UL, 0x321f3006UL, 0x7d75b327UL, 0xbf25b65fUL,
+       0x184a40f0UL, 0x777c4a8cUL, 0x6614f8a4UL, 0xd5ffd514UL, 0x3215c0eaUL, 0x9caef82dUL, 0xc20285e0UL, 0x4477cd77UL),
+    SC(0xc58395d4UL, 0x623cf0cfUL, 0x8c7b0abfUL, 0x686f71f8UL, 0x6c0b1977UL, 0x44ddd642UL, 0x7a1c05f0UL, 0x1e9f938dUL,
+       0x1d8eef66UL, 0x7d5b8ecdUL, 0xaf794b8fUL, 0x2bd30b17UL, 0x966de31dUL, 0x83ba46e9UL, 0x73fb4a2bUL, 0x914b06bdUL),
+    SC(0x40c74e1fUL, 0xf01ae64dUL, 0x85f958deUL, 0x6d1faf97UL, 0x6169b00fUL, 0xaef64c9fUL, 0x23c5cdbaUL, 0x5e17d294UL,
+       0xb21a6ec2UL, 0x1b409a69UL, 0xf8f6987cUL, 0x1b1705f2UL, 0x47781843UL, 0x73ae5695UL, 0x14b46951UL, 0x48448e6eUL)
+  },
+  {
+    SC(0xdd7503a2UL, 0x0a3e15e7UL, 0x39eb9b1fUL, 0x856d6e33UL, 0xbe4890b2UL, 0xf40cfea8UL, 0x1bdf516cUL, 0x0b942731UL,
+       0xca9cd04eUL, 0xc3789ab4UL, 0x5088b819UL, 0x953e08a0UL, 0x0b8adb8bUL, 0xb2b6f7c8UL, 0x661a2d3bUL, 0x83a54c77UL),
+    SC(0xa1df11b5UL, 0x743dccf0UL, 0x90fba9afUL, 0xbc699089UL, 0xbc923e16UL, 0x96a7841eUL, 0x5dd338dcUL, 0xa8aea428UL,
+       0x49a697c0UL, 0x45f6232cUL, 0xd0d7d5d9UL, 0xc7e33701UL, 0x758e6a12UL, 0x9a9a50d1UL, 0xf173beb4UL, 0x5b9b601aUL),
+    SC(0xfd7b2a1fUL, 0xcce0c2deUL, 0xe11c9f85UL, 0x0c245f43UL, 0x1b9aed6fUL, 0xa542d401UL, 0x4677236fUL, 0x4381b927UL,
+       0x77bc8fa0UL, 0x5639307cUL, 0x463fd419UL, 0xa784dcddUL, 0xbe1bed1bUL, 0xbe42c315UL, 0xdcbf9d24UL, 0xa5c7dc1bUL),
+    SC(0x07962833UL, 0xc1cad761UL, 0xfc1ecf60UL, 0x62ab6f9bUL, 0xb11cf765UL, 0x2c5c2aa9UL, 0xe4db18c0UL, 0x544ec275UL,
+       0x7a8bb3e8UL, 0x209f1876UL, 0xd3452f6fUL, 0x40c3cab9UL, 0xf7166dcaUL, 0x160e0f51UL, 0xafc35302UL, 0x75740cc1UL),
+    SC(0xbc8ea787UL, 0x2f386ed9UL, 0x24197d6fUL, 0xcde66dadUL, 0x0043b1bcUL, 0x390ea517UL, 0xade69780UL, 0xbeaf444cUL,
+       0x12f31c87UL, 0x9b69c7a3UL, 0xbed748dbUL, 0x6c0dc465UL, 0x3a0c1cfaUL, 0xe4cc7b97UL, 0xc00abbefUL, 0x1b86fdebUL),
+    SC(0x0eb4a5a9UL, 0x5957f070UL, 0x73fd04fbUL, 0x4f1d9403UL, 0xade11ac6UL, 0x62f2db35UL, 0x23a3c16eUL, 0x4a34c040UL,
+       0x277d8694UL, 0xe598912dUL, 0x7b1266f0UL, 0x493d9141UL, 0xfebe0f46UL, 0xbb69eb24UL, 0xc8be701dUL, 0x9e8c6f74UL),
+    SC(0x391bb04bUL, 0xb3b924d4UL, 0xbc548329UL, 0x64368cbdUL, 0x7cbc1a79UL, 0xc3410cf6UL, 0x63565b9eUL, 0xe62c5d44UL,
+       0x951554f5UL, 0xfc6b8ff6UL, 0x40a0aa39UL, 0x039929e9UL, 0x41db1056UL, 0xd05bf87bUL, 0xded15a32UL, 0xf06197f0UL),
+    SC(0x4b6a608dUL, 0xbaa71d6aUL, 0x0e20f543UL, 0xf4a5041cUL, 0xa06ab5a8UL, 0xcfe0b331UL, 0x6a6702b8UL, 0x46212ea1UL,
+       0xf3c31e22UL, 0xbb3a2f28UL, 0xbf1f0594UL, 0x4f798603UL, 0x107cb301UL, 0x06bca7eaUL, 0x0a8b863bUL, 0x5f85954eUL),
+    SC(0xa560f348UL, 0xba8b5a1eUL, 0x885158c2UL, 0xa4e94464UL, 0x01bbc59fUL, 0x3fbf4851UL, 0x3216f4a6UL, 0xcfbdf8aeUL,
+       0x98568f29UL, 0xeccead17UL, 0x257e558bUL, 0xb3835772UL, 0x5af94f69UL, 0x42b943a4UL, 0x36a95824UL, 0x0b92c529UL),
+    SC(0x2356a93fUL, 0xc5cd70f5UL, 0xf5fde88eUL, 0x6744efe3UL, 0xd0d713f0UL, 0x31f228a5UL, 0x1cbe2c3aUL, 0x4baf7107UL,
+       0x59adb751UL, 0x7111910fUL, 0x09e1a690UL, 0x139b10d6UL, 0xf30c311aUL, 0x4ab6b82eUL, 0xd1ba7077UL, 0x3a4994ebUL),
+    SC(0xf7fefa64UL, 0xad63903eUL, 0x66705d88UL, 0xd5df718fUL, 0x59b7e9e1UL, 0xf9180d21UL, 0x647b2a73UL, 0x06e2f1d6UL,
+       0x30b5d8feUL, 0x5393f9f3UL, 0xb68dde98UL, 0x1adfc77cUL, 0xcb3953f6UL, 0x7fbb3445UL, 0x52fafe72UL, 0xb9453532UL),
+    SC(0x73d5d8d0UL, 0x95d6c533UL, 0x60914bcfUL, 0x5b279c5fUL, 0xf20145e4UL, 0xe0ba1ee9UL, 0x468c2edcUL, 0xb59ee4e9UL,
+       0x56df32f6UL, 0xdad0b462UL, 0x487d2b25UL, 0x79dc14d8UL, 0x34ef8705UL, 0xd5efa77fUL, 0x1f371bb7UL, 0x641ff145UL),
+    SC(0xa1d772f9UL, 0x04377b24UL, 0xc98933e8UL, 0x47dcb51fUL, 0x7a982940UL, 0xd205e4e3UL, 0xc31c2cadUL, 0x9b90e410UL,
+       0x617a72d2UL, 0xea1b82b5UL, 0x775f13faUL, 0x01086eb6UL, 0x2827572fUL, 0xf6182101UL, 0x3cfe60d2UL, 0x7df6aadfUL),
+    SC(0x28725dfaUL, 0xad66c6afUL, 0x5f980f25UL, 0x653ea5d5UL, 0x116fcc37UL, 0xbe615037UL, 0x48d71033UL, 0xffd322c0UL,
+       0x67f3cd88UL, 0x1ba30b09UL, 0x3bbc1a25UL, 0x34826f06UL, 0x90b149e3UL, 0x964e313dUL, 0xe3706f60UL, 0x31dd6c0aUL),
+    SC(0x38573246UL, 0xddba2c47UL, 0xa9d85ac8UL, 0xc3a13ec8UL, 0x4133da2aUL, 0xcf6434edUL, 0x98acf5a6UL, 0x084d89baUL,
+       0xe97fde8eUL, 0x6b2c1395UL, 0xa9f242a6UL, 0x8fa989c9UL, 0x5dabd2f2UL, 0xab830949UL, 0x4c100a1eUL, 0xfab317cbUL),
+    SC(0xe69ebccaUL, 0x426dc9cbUL, 0x474c5f03UL, 0x5b6e6245UL, 0xcb18fad5UL, 0x2d990ad9UL, 0x6d29ea8bUL, 0xe032c220UL,
+       0x322ac73bUL, 0x0d7c6a5bUL, 0x89f3926bUL, 0x82578f6eUL, 0xa6fc83deUL, 0xa11da204UL, 0xe15bad7bUL, 0x51ab70a7UL)
+  },
+  {
+    SC(0xc8116b60UL, 0x1f8d72c6UL, 0x24957215UL, 0x46b844f6UL, 0xbf6bae0bUL, 0x07575a77UL, 0xf1f6c6c2UL, 0x5524fa2bUL,
+       0xb7477ca6UL, 0xde2004dfUL, 0x34882c65UL, 0x3a46821bUL, 0x53372f13UL, 0xed822cbfUL, 0x40c20bd9UL, 0xddd1d6bdUL),
+    SC(0xdb0d3761UL, 0xc6b76d0fUL, 0x4b3f6423UL, 0xdaa1acefUL, 0x19d01f9dUL, 0xc6230840UL, 0x0c4ef120UL, 0x9e4f80e7UL,
+       0x2ea359b1UL, 0xf19e5d6cUL, 0xe8360c04UL, 0x12ca60b7UL, 0xa43939caUL, 0x36fc873aUL, 0x7a80a884UL, 0x90d3d359UL),
+    SC(0xa4539230UL, 0xa9c0b4ffUL, 0x65e2a8e6UL, 0x47490c1eUL, 0x752706bcUL, 0xece59a96UL, 0xf2581cabUL, 0x1b430bf2UL,
+       0x9c80b433UL, 0xf87ca7b0UL, 0x3662b22dUL, 0x73a99e91UL, 0xa8c63fa4UL, 0x9fd3b8b1UL, 0xb17d669dUL, 0x0aaa9604UL),
+    SC(0xa77cbd99UL, 0x8019c652UL, 0x07ad38d8UL, 0xf8be3ce2UL, 0xdfaeda98UL, 0xd378cc3bUL, 0x7f86e291UL, 0x15a56adfUL,
+       0x3d5ef26bUL, 0x0d797de9UL, 0x6f8a0d9eUL, 0xd14a5209UL, 0xffe8964dUL, 0x2bb768ceUL, 0xbc0c3422UL, 0x85eacf77UL),
+    SC(0x2b99d5faUL, 0xa416b572UL, 0xc796d92aUL, 0xba9ad7d4UL, 0x5b020faeUL, 0x95aee14dUL, 0xf114489dUL, 0x0cdbff30UL,
+       0x4b89c70aUL, 0x74e07b43UL, 0xcbf503d8UL, 0x86954759UL, 0x9c3862caUL, 0x32bf168eUL, 0x20a913c7UL, 0x4fdfd266UL),
+    SC(0xa007a8e7UL, 0x0a60dd06UL, 0x6d11f1e7UL, 0x4912eb12UL, 0x91908cd9UL, 0xa3fe6a8fUL, 0x53393040UL, 0xf9c6fa52UL,
+       0x24b8c6a0UL, 0x6160c947UL, 0x61645355UL, 0xea365434UL, 0x323c1d9bUL, 0x2858f650UL, 0x5526497bUL, 0x0d148873UL),
+    SC(0x07f3f4e9UL, 0x24fba80bUL, 0x702f3252UL, 0x64186077UL, 0x2879a2e0UL, 0xcf86c721UL, 0x0cb97c5aUL, 0xcc1403f0UL,
+       0xfa6c055aUL, 0x4eaa3651UL, 0x3746385eUL, 0x0c69170fUL, 0xf3a1ce56UL, 0xd9c06440UL, 0xe49bca94UL, 0xe97220dbUL),
+    SC(0x70f9b6fbUL, 0xc3c4a20eUL, 0x69c75791UL, 0x02289936UL, 0x4da614a4UL, 0xdd49002bUL, 0x291767ccUL, 0x304309d0UL,
+       0x5becf8f7UL, 0x3c414163UL, 0x6aecfb98UL, 0x161da5a1UL, 0xddb08885UL, 0x545d946eUL, 0xc4f2f39dUL, 0x66b15165UL),
+    SC(0xffd34a18UL, 0xcb7a72a9UL, 0x19b97602UL, 0x2110dd29UL, 0x484b3fbeUL, 0x084ee3c9UL, 0x0046b370UL, 0xf710d86cUL,
+       0xb03c2cf3UL, 0x84b6502eUL, 0x0f519c55UL, 0xb40f0037UL, 0xcab3e513UL, 0x2304243bUL, 0x0f8e7117UL, 0xcb4d4bdfUL),
+    SC(0xef8bb54cUL, 0xc1fb8d0dUL, 0x7be9f5c6UL, 0x85dcc465UL, 0x9ce9d874UL, 0xbb1f860dUL, 0x60bd0954UL, 0xd751cf7aUL,
+       0x79216699UL, 0x1efe79eeUL, 0x0bd5232cUL, 0x687af3eeUL, 0x854c85f0UL, 0xcc61888eUL, 0xc2981689UL, 0xb03060fbUL),
+    SC(0xd1cb47caUL, 0xc6b4609bUL, 0x3e7e8f00UL, 0x76519a77UL, 0x9d8f4494UL, 0xbaada6bbUL, 0x43d3a034UL, 0x5c3e93b5UL,
+       0xa8bfd148UL, 0xa40922ceUL, 0x1a2a3383UL, 0x0ce323c5UL, 0x32041c5bUL, 0xf89917d8UL, 0x41c79867UL, 0xd6efdf49UL),
+    SC(0xed2c9d96UL, 0x38443a38UL, 0x9a00241eUL, 0xce1edea5UL, 0x4ba0561dUL, 0xa084d166UL, 0x9054b486UL, 0x89bcaf5cUL,
+       0xf81239d9UL, 0xad7a2fe4UL, 0x5a9ba8daUL, 0x9aa306c0UL, 0x3d22d79cUL, 0xc80f7953UL, 0x53c13a90UL, 0xc81d0505UL),
+    SC(0xd7174d31UL, 0x4126e219UL, 0x817fa00dUL, 0x140990ddUL, 0x43cbebb6UL, 0x81c45d9fUL, 0xc5e0deadUL, 0xd8135ef1UL,
+       0x38093e9aUL, 0xba7a7223UL, 0x06a5e8a8UL, 0x6ad4ee9aUL, 0xa5cbd614UL, 0xda2543eaUL, 0x34021578UL, 0x8938fcdcUL),
+    SC(0x41dbba9aUL, 0x0b52c3f9UL, 0x98ecc1cdUL, 0xaea6a093UL, 0xce702077UL, 0x8e5ac6a8UL, 0x91be5bb5UL, 0x00f73cb8UL,
+       0x5ef35b31UL, 0x829851dfUL, 0x7c3a2304UL, 0x5777b6e6UL, 0x89e79e3aUL, 0xa06c7b73UL, 0xf3bd47dcUL, 0xfff8dc99UL),
+    SC(0xf9ab0480UL, 0xd24efbbcUL, 0x026f1d2fUL, 0xf09db463UL, 0xf3d50993UL, 0xaf39d822UL, 0x085efa32UL, 0x97c73b6cUL,
+       0x40a5a11cUL, 0xc647b069UL, 0x04536d4cUL, 0xe154a58aUL, 0xdb0cbaefUL, 0x77b24591UL, 0xbb39020bUL, 0xff9c72eeUL),
+    SC(0xe59e905eUL, 0xfe97f343UL, 0x7bc6ef6fUL, 0xb8e06ed4UL, 0x1eeb5666UL, 0xc3bf72f8UL, 0x5fcd3fe6UL, 0xd0f68928UL,
+       0x028faea3UL, 0x4fd42596UL, 0xc3880cf2UL, 0x74987c2fUL, 0x2f228442UL, 0x5666ebdbUL, 0xe357d9f5UL, 0xe8886c4cUL)
+  },
+  {
+    SC(0xe7ff8d5cUL, 0x83bd5846UL, 0x05c967b5UL, 0x37ac0f36UL, 0xb9ffe9d2UL, 0x0fc7531eUL, 0xef183cb1UL, 0x7369c066UL,
+       0x9a9c3c4bUL, 0xe482031bUL, 0xf6dc69faUL, 0x843ea90eUL, 0xde165479UL, 0x26ba201bUL, 0x5f05b00aUL, 0xdbcc30a8UL),
+    SC(0x92932066UL, 0x093f2280UL, 0x8bc088ebUL, 0x8b50cf83UL, 0x93c0a33fUL, 0x5149976dUL, 0x27b837b1UL, 0x2e769b6aUL,
+       0x07d86f6aUL, 0x418b04f5UL, 0x2d01b933UL, 0x428d1ec3UL, 0xce62d349UL, 0x693d267fUL, 0x48cb005bUL, 0x1499aa0dUL),
+    SC(0x10e4d4ccUL, 0xb8efba85UL, 0x37dcb831UL, 0xc6badf34UL, 0x85a3184dUL, 0xb571fa59UL, 0x55e3ed98UL, 0x80fa8e63UL,
+       0x270a80d8UL, 0xed085cedUL, 0xf4dcac74UL, 0x481a75b0UL, 0xb42775bdUL, 0x9a844a9eUL, 0xe2de9be3UL, 0x92781c96UL),
+    SC(0x763ae8eaUL, 0x0212d756UL, 0xec3e6a55UL, 0x9ea9575fUL, 0xee67ca83UL, 0x9e61e61aUL, 0x99315231UL, 0x304eb9e8UL,
+       0x4e1d3eb9UL, 0xd1a49677UL, 0x6d1619afUL, 0x8acc9b35UL, 0xc6135fd6UL, 0x0bf82845UL, 0x5eb55a73UL, 0x6137d0c0UL),
+    SC(0x76ff82efUL, 0x27ad0b4cUL, 0x157d0b24UL, 0xd89aaed3UL, 0xea654fb5UL, 0xe0492304UL, 0xab02b214UL, 0x81eb7574UL,
+       0x701384feUL, 0xe57f56cfUL, 0x62930a9aUL, 0x0e1b5977UL, 0x8071d8c1UL, 0xc07746e1UL, 0xb1b6e94bUL, 0x1cece9e0UL),
+    SC(0x0fca9c2eUL, 0xb84ac3d7UL, 0x7a32396fUL, 0xa0a1763fUL, 0x7483aef7UL, 0x2b171608UL, 0xe34bf24fUL, 0x2c0e3ba5UL,
+       0x8678a539UL, 0xd5b12652UL, 0x78f2feffUL, 0xbac321a4UL, 0xce2acaa3UL, 0xd0983d29UL, 0x027e9e90UL, 0x1d46dedeUL),
+    SC(0xa75ffbd9UL, 0x4ccc3e8cUL, 0x93a54e06UL, 0xe4b5fb2fUL, 0x4410db28UL, 0xb980283aUL, 0x51ce071eUL, 0x83572733UL,
+       0xb0151288UL, 0xec977854UL, 0xaaff4ae1UL, 0x18b65289UL, 0xef356df5UL, 0x1beabbd5UL, 0x77054a42UL, 0xda145fb9UL),
+    SC(0x178095a7UL, 0x416460bcUL, 0xc42fd250UL, 0x472e6d1eUL, 0x3db37a73UL, 0x5bdc0012UL, 0xe52c4ca8UL, 0xcf65d4bdUL,
+       0xb9c37e8cUL, 0xa7cce01cUL, 0x9adeadd5UL, 0x15759eceUL, 0x60776e72UL, 0x992b7c9aUL, 0xc23b24a1UL, 0xadde790cUL),
+    SC(0x8969a958UL, 0x1ebfb858UL, 0xcac5b7f4UL, 0x88c56e0aUL, 0x966947d1UL, 0xadaae934UL, 0x6db4041fUL, 0x4f8823a1UL,
+       0x5c1ce169UL, 0xfa336433UL, 0x1aa72a02UL, 0xe543cf69UL, 0x9ebdbfaeUL, 0x2cc00ec0UL, 0xf83d6f09UL, 0x8e78fe3dUL),
+    SC(0xa7e28d50UL, 0xeb9a52e9UL, 0xe18edd59UL, 0x6b291fceUL, 0x7024e915UL, 0xe7ab8119UL, 0x2cf4642fUL, 0x7c54d8a8UL,
+       0xe35bb3fbUL, 0xd67ec191UL, 0xb3a752f0UL, 0x58428c1eUL, 0xa92c2c8bUL, 0x07e84223UL, 0x363b15ceUL, 0x28435dbfUL),
+    SC(0x7a6542c5UL, 0x2560ba89UL, 0xece8a01dUL, 0x0e9c9acbUL, 0xe534ea36UL, 0x48186e75UL, 0x3bd214d4UL, 0xcc8826b9UL,
+       0xeb9a65b5UL, 0xe5d3cfefUL, 0x50f0876cUL, 0xc9277014UL, 0xaf67ef01UL, 0xb21fe8f7UL, 0x13aa8661UL, 0xf6be4c9dUL),
+    SC(0x0459ff50UL, 0xf27af905UL, 0xa415ed85UL, 0x26564031UL, 0x8e3a8b5fUL, 0x11aa25b8UL, 0xb0c27cbeUL, 0x83448bf1UL,
+       0x4d86fd56UL, 0xe083330bUL, 0x9053b2fcUL, 0x88cf532dUL, 0x7672912bUL, 0xdb7c2429UL, 0x34c8be24UL, 0x40be22a7UL),
+    SC(0xe28b9febUL, 0x67173d65UL, 0x78a8e38dUL, 0x0fdfa8a8UL, 0xe71bb840UL, 0xb1d97046UL, 0x456a7abaUL, 0xb1bdb4aeUL,
+       0x9c8712b5UL, 0xd2d7e596UL, 0xd42e088bUL, 0x801cf20bUL, 0x7f6dba46UL, 0x8438032bUL, 0x0c4b25d4UL, 0xdfc5daf3UL),
+    SC(0x3c313413UL, 0x6261f337UL, 0xe5b2b81aUL, 0x6641acf3UL, 0x4458c82bUL, 0x524b88abUL, 0x844387a8UL, 0x6acde303UL,
+       0xc1948e72UL, 0x3e2481f5UL, 0xf0898fedUL, 0x9c1def3fUL, 0x8f88f0f1UL, 0xb58cbc9cUL, 0x69992a09UL, 0x4fdf128eUL),
+    SC(0x77774800UL, 0x3a50c6feUL, 0x65a5772dUL, 0x1e01b8beUL, 0xd8acdfa7UL, 0xda1cc233UL, 0xebe2620dUL, 0x11b570cfUL,
+       0x96522ec4UL, 0x23bd6dbfUL, 0x45969c79UL, 0x15494f6fUL, 0xbc4a41f8UL, 0xb99dd400UL, 0xb7f9b59bUL, 0x8b45e279UL),
+    SC(0xf491ac54UL, 0x4678dc86UL, 0x05ce81d7UL, 0x60465bb3UL, 0x791c9c38UL, 0xa7f98016UL, 0x3de914abUL, 0x4f488f23UL,
+       0x9e62efdeUL, 0xf5eee54aUL, 0xab244604UL, 0xa3357af2UL, 0x729e8252UL, 0xa04f006bUL, 0xf0d61d7fUL, 0x05f13437UL)
+  },
+  {
+    SC(0xd8f08d18UL, 0xece61855UL, 0x5b06a3b5UL, 0x0ac8e7cfUL, 0xa6375446UL, 0xcbc7c8dbUL, 0xad924f78UL, 0x69e7f00eUL,
+       0x46a91d23UL, 0x910957ebUL, 0xdb830624UL, 0x73839954UL, 0x2cea0570UL, 0x2f67a09dUL, 0xd7d19217UL, 0x0646606eUL),
+    SC(0xb1238187UL, 0x25e216c6UL, 0x631d4b98UL, 0xd8d3c743UL, 0x753529f2UL, 0x8e02bf80UL, 0xd1e9119aUL, 0xf92d8b50UL,
+       0x487f7171UL, 0x60b8993fUL, 0xa90edd77UL, 0x3f7c1026UL, 0xb5961881UL, 0x895ad804UL, 0x51b66d8bUL, 0xd300e0f5UL),
+    SC(0xb2ff5766UL, 0x4b8079c6UL, 0x03c5651dUL, 0xe0b2fd47UL, 0x80d1a18cUL, 0x60d78c24UL, 0xb2c57809UL, 0x9429a552UL,
+       0xc7ad3672UL, 0x6d7e0618UL, 0xeb506d65UL, 0xc055a7ffUL, 0xcba848f4UL, 0x9b69dcc9UL, 0xc02a85d1UL, 0x5dd8ef90UL),
+    SC(0x901272b2UL, 0xbbabc0b6UL, 0x12dba006UL, 0x1d4e8ffbUL, 0xe177c070UL, 0x043f6ec6UL, 0x2b437bffUL, 0x9970685cUL,
+       0xad7c1faeUL, 0x4b80cd30UL, 0xc45516caUL, 0xe3433e8aUL, 0x2d3272a5UL, 0x79e4335cUL, 0x22e452a1UL, 0x845326a5UL),
+    SC(0x1d5740edUL, 0x37452eb5UL, 0xc645f8e3UL, 0xcbc4969eUL, 0x0a6f419aUL, 0xfc0e4662UL, 0x8b017587UL, 0xa6871ad0UL,
+       0xc7a6436eUL, 0xb66d164aUL, 0x685a1b96UL, 0x3387519fUL, 0xb4179d38UL, 0x40f2be68UL, 0x28c9cd1fUL, 0x8780bb86UL),
+    SC(0x21f0eeadUL, 0xca362d40UL, 0x1abae7b9UL, 0x2edccf19UL, 0x70bd8c0cUL, 0x035ffdc2UL, 0x76820d7cUL, 0x478ef1d5UL,
+       0xd3073714UL, 0x5d577587UL, 0xdb806eeeUL, 0xb9dc40eeUL, 0x191f4b68UL, 0x1c488f64UL, 0xfee83a32UL, 0xd1034ef6UL),
+    SC(0x0bebf44eUL, 0x4cdbb310UL, 0x16e0e43fUL, 0xb183ebd7UL, 0x263515ccUL, 0x489fbce1UL, 0x90cc104bUL, 0x55225481UL,
+       0xf7ace0d5UL, 0x3dcdb783UL, 0xe10513cfUL, 0x2e6c5c63UL, 0xc60efb67UL, 0xfa0bc316UL, 0xde0e571fUL, 0xd399f519UL),
+    SC(0x078f6920UL, 0xe94f8d53UL, 0x3dbcd31dUL, 0xaaec5e94UL, 0x76919efcUL, 0xddff1eeaUL, 0x4e79e1b4UL, 0x3dfeb4f9UL,
+       0x5696bc3cUL, 0x0c8dfd0cUL, 0x490250c6UL, 0x4263da19UL, 0x36454caeUL, 0x88f653c4UL, 0x2f9004afUL, 0x10eba182UL),
+    SC(0x4a2d9099UL, 0x949f854aUL, 0xe13ef6d8UL, 0xa0179957UL, 0xa47fe355UL, 0x92ed0ab5UL, 0xb22994daUL, 0x3e616e20UL,
+       0xc922bf45UL, 0x8feafa64UL, 0x66e31c20UL, 0xd99584b6UL, 0xab390f2eUL, 0x5b97009bUL, 0x5254d229UL, 0xd2ea57e3UL),
+    SC(0x762eb751UL, 0x35672a8cUL, 0x26fac373UL, 0xaf7c7396UL, 0x70b8c0f3UL, 0x336bc099UL, 0x0aa1f02aUL, 0x7e804df1UL,
+       0xedfa83d0UL, 0x6cec4971UL, 0x6cf3d1e7UL, 0xfd2fcf3bUL, 0x7e2143ffUL, 0x8e67a5faUL, 0xc24f14daUL, 0xb3ee01a2UL),
+    SC(0x00fa4621UL, 0x897c70c6UL, 0x8b62619fUL, 0xc040d058UL, 0xcc68275fUL, 0x91b4efb7UL, 0xb4f902abUL, 0x3059b822UL,
+       0x8c1c575dUL, 0xd6066045UL, 0x9aa7908dUL, 0x2246e846UL, 0x103d887dUL, 0x3b7549fcUL, 0xb4ab9f6eUL, 0xe1181a55UL),
+    SC(0x6a61b260UL, 0x3d77f92aUL, 0xc4df3f3dUL, 0x30000179UL, 0xe6f0fa59UL, 0xa6570233UL, 0x1ccd0dadUL, 0x6a146ed0UL,
+       0x416c09feUL, 0x711b40d3UL, 0x92723f10UL, 0x688fbd1fUL, 0xe30131ecUL, 0xe8a0a547UL, 0x9acaa8b2UL, 0xae8e335aUL),
+    SC(0x8a80bd6dUL, 0x316dbad9UL, 0x41c345a2UL, 0x6f3f7ed1UL, 0x738934d3UL, 0xf00efd65UL, 0xedc54fbeUL, 0x9d38d48eUL,
+       0x82bf1bc2UL, 0x468b4ffeUL, 0x11561406UL, 0x2a2f9ab4UL, 0x71d40e72UL, 0xa2f1a40cUL, 0x8c573013UL, 0x05a86228UL),
+    SC(0x174daec7UL, 0x77872ecfUL, 0x46832a7aUL, 0xce3c1d5fUL, 0x47304048UL, 0xc9cf1248UL, 0x124c2ecaUL, 0x3438a110UL,
+       0xbe42dc6fUL, 0xb61964adUL, 0x59083c98UL, 0x0e459ea4UL, 0xdb3298f2UL, 0xea8c8379UL, 0xbe76859bUL, 0x958b6f3cUL),
+    SC(0xe11397daUL, 0x68e78b89UL, 0xc8f30102UL, 0xf779e014UL, 0xf572f9b3UL, 0xa5d33cccUL, 0xb74c2234UL, 0xba9d294cUL,
+       0xbff23953UL, 0xfd62c1deUL, 0xa4dcf767UL, 0x924e5448UL, 0xe6529bd3UL, 0x85a1acdcUL, 0x3efc0e8dUL, 0x864fb9ccUL),
+    SC(0x009f883fUL, 0x27e68e8bUL, 0x201d6ad5UL, 0x28a04a8aUL, 0xfce8b706UL, 0xa4d6f2e4UL, 0x5d07c4abUL, 0x8b0dd96fUL,
+       0x0965ecfdUL, 0x1563f640UL, 0x97f42529UL, 0x305be630UL, 0x12f9edccUL, 0x82ab67acUL, 0x9bee6979UL, 0xb91ad5f3UL)
+  },
+  {
+    SC(0xca3c008eUL, 0xcf9efd5fUL, 0x75cc1035UL, 0xf9edaa7cUL, 0x46b17d25UL, 0x9895b0e3UL, 0xb3523b6eUL, 0xeee9daafUL,
+       0xa676aea9UL, 0x003ce9bbUL, 0x128ffc34UL, 0xdeb96b0fUL, 0x72179d28UL, 0x77406d04UL, 0x6d0c8b5cUL, 0x3572f4d2UL),
+    SC(0x59d2d70aUL, 0x2e90a652UL, 0x54e06cebUL, 0x3793db1bUL, 0xa78e9b4dUL, 0x0e043a3dUL, 0xc5773b9eUL, 0x4c200ea1UL,
+       0x80d83c03UL, 0x05aa47aeUL, 0x956ded05UL, 0xcab59b97UL, 0x4f25c32dUL, 0x9d6aeca1UL, 0x32603249UL, 0xb6d360b3UL),
+    SC(0x04d9ba25UL, 0xf51de6acUL, 0x3b63b60fUL, 0x576354a3UL, 0x40d89e09UL, 0x51af3e9fUL, 0x8d8eba83UL, 0xc00160e0UL,
+       0x0218deeaUL, 0xf7a87a13UL, 0xf7ca36ffUL, 0xb4f85923UL, 0x30ed0337UL, 0x2665c688UL, 0xe3632048UL, 0x97dfdcb3UL),
+    SC(0x41093dc4UL, 0xcd6c91ffUL, 0x067df50fUL, 0x11031e3cUL, 0x56d8e078UL, 0x961e74f3UL, 0xbf01b010UL, 0x564e732bUL,
+       0xb836ff47UL, 0x2e29fdb9UL, 0xc75a4a68UL, 0xa3277d9dUL, 0xd4568f0eUL, 0x43333765UL, 0xa7246fc1UL, 0x69d6c074UL),
+    SC(0x8a37aecfUL, 0x7a111e82UL, 0x21bd8aa4UL, 0x0756974eUL, 0xadbfc33cUL, 0x9bd6268bUL, 0x247270e2UL, 0x642c8abeUL,
+       0x06a9cf7fUL, 0xd48bd71fUL, 0xd7f2dbf2UL, 0x1564737aUL, 0x2acff559UL, 0x9aa3da27UL, 0x925b6140UL, 0x3e940bfdUL),
+    SC(0x7b893836UL, 0xb2777ef4UL, 0x2e4a2addUL, 0xc50bfe33UL, 0x37f7c75bUL, 0xf0acdb03UL, 0x1829e372UL, 0x129aa8b1UL,
+       0x31b64a8eUL, 0xfe772afcUL, 0xeb8f631fUL, 0x0b3a4b39UL, 0x39ca4a47UL, 0x859a0fc8UL, 0x59165c5eUL, 0xd8fc0331UL),
+    SC(0x2f493e24UL, 0x6425e2b0UL, 0xfa036211UL, 0x5352d455UL, 0x8357a2d5UL, 0x0b838ad4UL, 0x232cf6e4UL, 0xe4b7dc85UL,
+       0x9cc11b9bUL, 0x5c3a4da1UL, 0xfdb1a119UL, 0x0aa5a546UL, 0x47cf86f6UL, 0xb5bea9f2UL, 0xa9b6814dUL, 0x6158fc63UL),
+    SC(0x5622f09fUL, 0xc50ac0ebUL, 0x2a1fffc6UL, 0x76604755UL, 0x9d3a5046UL, 0x54956aaaUL, 0x640515e7UL, 0x91000316UL,
+       0x33e375dbUL, 0x350fc408UL, 0xfff91c09UL, 0xfd6ec673UL, 0x4c12f5e4UL, 0x46348864UL, 0xb0586d8fUL, 0xfd1205dfUL),
+    SC(0xfbe24d9dUL, 0x29eead5bUL, 0x72952323UL, 0xdf6e8b87UL, 0x322d570cUL, 0x37dd2191UL, 0x690e9119UL, 0x8a5b65c9UL,
+       0xca77d605UL, 0xfa1c71bbUL, 0xacc38061UL, 0xf4b04768UL, 0xe93ccbfdUL, 0xdd626796UL, 0xdebaf531UL, 0x6c17e89eUL),
+    SC(0x1c324df0UL, 0x4c5d8f9aUL, 0x7cf6980fUL, 0x7239d5dcUL, 0x94f49053UL, 0x5ef06925UL, 0x6341ad0eUL, 0x5099baafUL,
+       0x97611701UL, 0xe282fde9UL, 0x9263c30bUL, 0x9439c244UL, 0xb0fc4844UL, 0xa61c905bUL, 0x0fc03d98UL, 0xf81d025aUL),
+    SC(0xf40508e2UL, 0x4252b801UL, 0xf4b34d4eUL, 0x2941673fUL, 0xbe39a018UL, 0x2d9e6b4aUL, 0xe0fe3052UL, 0xda22d16aUL,
+       0x5477f0f3UL, 0xf55f1571UL, 0x8e070280UL, 0xf3e5cc80UL, 0xaf79dc14UL, 0x9954c40aUL, 0x8c1aa63cUL, 0xf1b52686UL),
+    SC(0xfcd09f44UL, 0xebf12a38UL, 0x8f12f1acUL, 0x1bcb6856UL, 0x0217030aUL, 0x903dde22UL, 0x5dd25986UL, 0x2ada9b71UL,
+       0x7d5fc263UL, 0x6dec7d82UL, 0x167f40a1UL, 0xcf00cf9aUL, 0xfb82a10cUL, 0xa293c64eUL, 0x8ff4b616UL, 0x1f9f9d9aUL),
+    SC(0x666675ccUL, 0x1d4084e5UL, 0xf4ac65eeUL, 0x71fef1eaUL, 0x66fb7b1bUL, 0xf348d980UL, 0xb11f711bUL, 0xfbfa2517UL,
+       0x93f65e6dUL, 0x4038c57cUL, 0x3e04a0abUL, 0x0b3b1a45UL, 0x4050098aUL, 0x7199635aUL, 0xce8c8617UL, 0xe14c6870UL),
+    SC(0x8bacd663UL, 0x9b1d1f4cUL, 0x2038c96fUL, 0xbfabb232UL, 0x87aa6574UL, 0x13b3b0eeUL, 0x5aaac2cdUL, 0xb8d629fcUL,
+       0x50aef7a4UL, 0xfdbf85bcUL, 0xe0876914UL, 0xed1692f7UL, 0x7f8854eaUL, 0xa07022c0UL, 0x46fe359cUL, 0xe87284a8UL),
+    SC(0xefa17098UL, 0xda4d08ccUL, 0xf879897bUL, 0xca2b4e3fUL, 0xe19f1668UL, 0x04428ae3UL, 0x94a37f37UL, 0xcb678d10UL,
+       0xc43b0e05UL, 0x584ee017UL, 0x80956297UL, 0x1c7602c8UL, 0x3784c807UL, 0xa88b6c51UL, 0x7f25105eUL, 0xd16596aeUL),
+    SC(0x6c8eb955UL, 0x0497f33fUL, 0xa1c0f1a9UL, 0xa4f5017fUL, 0x3f2613c3UL, 0x3ab944b3UL, 0xabee9171UL, 0x0d35f582UL,
+       0x9e647007UL, 0x0dd811c9UL, 0xbc1b907cUL, 0xe1cc70a4UL, 0xae07722dUL, 0x4dff6f06UL, 0xd77f5937UL, 0x009250d8UL)
+  },
+  {
+    SC(0x8a4e9691UL, 0x3533875dUL, 0xb8559500UL, 0x65c90785UL, 0xa78233acUL, 0xef24113cUL, 0xf6ed543aUL, 0xe6a40024UL,
+       0x057d9444UL, 0x8d091df9UL, 0x602e6c7fUL, 0xc3f88934UL, 0xd45a7c76UL, 0x18da574bUL, 0x4d4c15a6UL, 0x6925bcf4UL),
+    SC(0x0d25026cUL, 0x0edd7663UL, 0x2a256452UL, 0xc6585ec2UL, 0xe8c475f6UL, 0x247f621cUL, 0xc4438bdeUL, 0xb4a49ca3UL,
+       0x4f8ab8c9UL, 0xbf340f6dUL, 0xc38a4830UL, 0x3e114ac7UL, 0x9406baafUL, 0x583533c3UL, 0xbf6cc0d3UL, 0xb529ed36UL),
+    SC(0x7bb1335aUL, 0x3340e2d2UL, 0xed2e88b0UL, 0x5daf002eUL, 0x6a903241UL, 0xe142f9d4UL, 0xe48d585cUL, 0xa9cff8d3UL,
+       0xeb65860eUL, 0xc2a34d44UL, 0x1f1677e3UL, 0xf3cb2bb3UL, 0x9d0761eeUL, 0x200dcaacUL, 0x68f683f8UL, 0x7066bdc4UL),
+    SC(0x809ab901UL, 0x4a3ca64fUL, 0x7dac499dUL, 0xfbe84b51UL, 0x6566f9b7UL, 0xf504fd24UL, 0x681fb9b0UL, 0xbe3a54a7UL,
+       0x326d607fUL, 0xe41037f1UL, 0xbc1a4d56UL, 0x4db58169UL, 0xc637e902UL, 0x99d52c37UL, 0xd625862dUL, 0xfaeee076UL),
+    SC(0x1fe79a30UL, 0xe681a701UL, 0x9c437773UL, 0x1c99f7adUL, 0xb4b6a52eUL, 0x289baf55UL, 0xe67bc468UL, 0x3a20b65fUL,
+       0x0b4843afUL, 0x94698c22UL, 0xee928995UL, 0x61418205UL, 0xa745912fUL, 0x3b0b11b8UL, 0xb3a3cf5aUL, 0x3008aa6dUL),
+    SC(0xfb9ae54cUL, 0xb674e5e9UL, 0xccb900f5UL, 0x53d9cc06UL, 0x0949a6ebUL, 0x076bcb6dUL, 0xe7c8cf34UL, 0xa6352936UL,
+       0x3d2ecabcUL, 0x841d29b0UL, 0xb81ea46aUL, 0x7b061c92UL, 0x103c6036UL, 0x5e9ce032UL, 0x286243cbUL, 0x91000b69UL),
+    SC(0xd93164cfUL, 0xff3d386cUL, 0x7d340da2UL, 0x31479b7bUL, 0x5167472dUL, 0xa111e9bcUL, 0x287be7e0UL, 0xbbc06cebUL,
+       0x563ac770UL, 0xb23ac56cUL, 0xba093d88UL, 0x017e1a8aUL, 0x47c9b607UL, 0xeb773284UL, 0x1c8b0c6dUL, 0xf9cd9a9eUL),
+    SC(0x3bc57534UL, 0x178dcfb7UL, 0xb80906b3UL, 0x009db964UL, 0x7e989039UL, 0x1e13c2c9UL, 0xf82d7b63UL, 0x2a1b3367UL,
+       0x5eb2254fUL, 0xf7547cddUL, 0x745ca32fUL, 0xe3ac49dcUL, 0x2dadd808UL, 0x558b7905UL, 0x71a46132UL, 0xd0293e09UL),
+    SC(0x69c24addUL, 0xb825c48aUL, 0xab10d0d8UL, 0x36d2f4ffUL, 0x79535742UL, 0xf07bcff5UL, 0xcfd568a2UL, 0xce28c8e4UL,
+       0xa0465fd2UL, 0xfd1f7924UL, 0x0e60a96fUL, 0x472059e2UL, 0x4df02324UL, 0x07bc79e7UL, 0x11f64d8dUL, 0xa477dc06UL),
+    SC(0x76d9304fUL, 0x8dcde85eUL, 0x9a331a6aUL, 0xbc066d5bUL, 0x72ce9fc3UL, 0xa3e65614UL, 0x37c376deUL, 0xf6aea72cUL,
+       0x6a31a164UL, 0xaf370f6dUL, 0x02ba9729UL, 0xfd2a7e5fUL, 0x69d62729UL, 0xbcecf340UL, 0x48feb388UL, 0x541e40d8UL),
+    SC(0xf45517e4UL, 0x13d15400UL, 0x29e1bf03UL, 0xaecbededUL, 0x9da08531UL, 0x65a38956UL, 0x79ca08efUL, 0x8d7c8011UL,
+       0x7cb4b383UL, 0x62f330f2UL, 0xbc54d555UL, 0xdb060911UL, 0x0d7a0383UL, 0xeda89b65UL, 0x913cac4dUL, 0x4098a1d1UL),
+    SC(0x2e3b0113UL, 0x818930dcUL, 0xf9e6d0cbUL, 0xd59032b5UL, 0xe0aa1da8UL, 0x1cd95f3cUL, 0x1dfc8520UL, 0x51135a12UL,
+       0x22f9bbbcUL, 0xe023e03bUL, 0xd00f1c73UL, 0xd2aeb9d6UL, 0x96de61faUL, 0x47f5f6faUL, 0x31a5f269UL, 0xb4029c5eUL),
+    SC(0x11c85357UL, 0x5073bac2UL, 0x51a5f7e1UL, 0x41aef0b2UL, 0x8fa240fcUL, 0xe8045f2aUL, 0xe6fbe0b1UL, 0xcf99d9daUL,
+       0xee8a317fUL, 0x78545477UL, 0x732e325bUL, 0x4695f5deUL, 0xb3bde843UL, 0x11fb7fdeUL, 0x1a0e1cabUL, 0xd8bc1c16UL),
+    SC(0xf3cef221UL, 0x8bfdda19UL, 0x99885c8dUL, 0xee2e16a8UL, 0xb53921e4UL, 0x6045de20UL, 0x94775856UL, 0x9f2c84d8UL,
+       0xa95ecfc8UL, 0xe058dbe2UL, 0xd57144adUL, 0xe65ac41bUL, 0x0b27cf4fUL, 0x83150b13UL, 0xf7f80878UL, 0x81b98480UL),
+    SC(0xb537bcd3UL, 0x3bb129b1UL, 0xdb277096UL, 0xafa2f42dUL, 0xd63662cfUL, 0x849a5c0eUL, 0xf7438443UL, 0xfd8d0e4cUL,
+       0x76cf0b80UL, 0x461e8984UL, 0xbba8d8bbUL, 0xf926ad96UL, 0x6a7e9684UL, 0xf09e4fbdUL, 0x45657e65UL, 0xd45ab69cUL),
+    SC(0x4ca9dcbdUL, 0xfc4ccc48UL, 0x62c1b2eaUL, 0xcb624698UL, 0x40c3a0b3UL, 0x95bbf084UL, 0x9dfcc410UL, 0xb89c3718UL,
+       0xbe50d6f0UL, 0x845daab8UL, 0xcb857c24UL, 0xfa995624UL, 0xdbf8c938UL, 0xdbd982a4UL, 0x85e66d4bUL, 0x1db2c765UL)
+  },
+  {
+    SC(0x458f8dbfUL, 0x9cef8cbcUL, 0x5d2046c7UL, 0x42ca6297UL, 0x0e8fc76aUL, 0x0ad22fd3UL, 0xaf4f9a8eUL, 0x2173d857UL,
+       0x57074c8fUL, 0x14a36b5fUL, 0x06924517UL, 0x6e3dc7b6UL, 0x4d12a08dUL, 0x08d00565UL, 0xe70e0ca1UL, 0x56f29820UL),
+    SC(0xd4e74c10UL, 0x91365cdeUL, 0x4cf5168fUL, 0xf4f523a4UL, 0x1fe85d27UL, 0x0d50d2b8UL, 0x76218259UL, 0x10c3d5a2UL,
+       0xed9fd256UL, 0x43ca55e9UL, 0x53a209e7UL, 0x5fd7e965UL, 0x7706855fUL, 0xd47d7053UL, 0xca9718ddUL, 0xa834c691UL),
+    SC(0xf992b772UL, 0x821fc43eUL, 0x61771037UL, 0xacd07e54UL, 0x96f61845UL, 0xd5915056UL, 0x5babc86fUL, 0x11a766d9UL,
+       0x8a8806f1UL, 0xcf24eb13UL, 0xe7b8cf1cUL, 0x25d550b7UL, 0x4aca323bUL, 0xe3026382UL, 0xe0dab78bUL, 0x217a9f98UL),
+    SC(0x1e9971abUL, 0x68dfe587UL, 0xfe0f4612UL, 0xac8bc090UL, 0x5c2daef8UL, 0x616dfa6cUL, 0xb7505e04UL, 0x424f74c0UL,
+       0x4e9c2118UL, 0x6214b25eUL, 0x6bca1e61UL, 0x57ae70a2UL, 0x5fcbddd4UL, 0x7690acd0UL, 0xe537110fUL, 0xc08918b5UL),
+    SC(0xff3717b5UL, 0x0f433f50UL, 0x09a4480cUL, 0x80e6d115UL, 0xc41767afUL, 0x2fe6f0d8UL, 0x679798ddUL, 0xcebfa8b6UL,
+       0x4e443023UL, 0xe6bec3ddUL, 0xf82b217bUL, 0xd1c0c235UL, 0x278d6fa7UL, 0x8209e009UL, 0x4c716c71UL, 0x163ef474UL),
+    SC(0x4dd0d667UL, 0xf0d72439UL, 0xb3d3adecUL, 0x15bf05e8UL, 0x129a1218UL, 0xa8d7c645UL, 0x307aefdcUL, 0x616cbb0fUL,
+       0xaa592262UL, 0x93fc13e9UL, 0xa11bf634UL, 0x56d81d7fUL, 0xfc503f33UL, 0x3a523af5UL, 0x1b1e9a9aUL, 0x921a95ceUL),
+    SC(0xc5475eacUL, 0x51e02585UL, 0x9916ff52UL, 0xefac5c35UL, 0xbf9b1b43UL, 0xbd88e949UL, 0x8807d772UL, 0xf9e23b1cUL,
+       0x2daa42efUL, 0x55198235UL, 0xe8c4137aUL, 0xd13bed86UL, 0xd994fd1cUL, 0x480ccbeaUL, 0x89c1c545UL, 0xcc26fb27UL),
+    SC(0x588d521fUL, 0x6f9d2c44UL, 0xe2ee47dbUL, 0xc05ea3fcUL, 0x517d1d69UL, 0x7c66a3a8UL, 0xa62c72b8UL, 0x645a6a87UL,
+       0x24749bc7UL, 0x3d997052UL, 0x3eea9809UL, 0x66701cd4UL, 0xdb072ff2UL, 0xd9284255UL, 0xe4f8c22aUL, 0xafd75504UL),
+    SC(0xd597241fUL, 0x0298a7b8UL, 0xa1139b92UL, 0xa8bde9b3UL, 0xf91ea694UL, 0xc450c808UL, 0xe15df89aUL, 0xfeafe70eUL,
+       0x5d17b691UL, 0xccb6cc27UL, 0x79337e2cUL, 0x08906b73UL, 0x83876759UL, 0xabf728afUL, 0xc6889182UL, 0xbf8301efUL),
+    SC(0x5d2d98dbUL, 0xc2d6a0f0UL, 0x1cb8e201UL, 0x516f65daUL, 0x0b43e704UL, 0x78b0e5d7UL, 0xdeedde32UL, 0x71614c03UL,
+       0xc46181b4UL, 0xd08d0555UL, 0x7b031d3dUL, 0xe5966ba3UL, 0x6534c010UL, 0x48875986UL, 0x93584851UL, 0x80ae7c53UL),
+    SC(0xdceeb9b3UL, 0x6e8e802dUL, 0xf2ee9664UL, 0xb3654b46UL, 0x741ae546UL, 0x6031162aUL, 0xc83bb6daUL, 0x098bae12UL,
+       0xbf6e5152UL, 0x53aeaf52UL, 0x8ec5a0e1UL, 0x0de1f156UL, 0xd64c9123UL, 0x236178cdUL, 0xee9b2c3cUL, 0x3e2710c2UL),
+    SC(0xd4984e63UL, 0x4d173439UL, 0x0e212d2eUL, 0x2e8da9d0UL, 0xd00d14f9UL, 0x1c1d22ceUL, 0xc37a537aUL, 0xf3b0788dUL,
+       0xc72c5356UL, 0x63000ff1UL, 0x9b17ebd4UL, 0xbe15230bUL, 0x56528fafUL, 0xc9622b2bUL, 0x15e88318UL, 0x4a5c359fUL),
+    SC(0x13ccca15UL, 0x0767ae67UL, 0xad5a1b60UL, 0x036bf0e3UL, 0xe617d537UL, 0xadc87238UL, 0xbe522265UL, 0xb8fb813fUL,
+       0xac7d0ed8UL, 0x2f30ba14UL, 0xa4817fa0UL, 0x9dcac107UL, 0x3f3abde0UL, 0x41da268bUL, 0xc3bc9b61UL, 0x38df6fceUL),
+    SC(0xd891e13dUL, 0x678ebe25UL, 0xc129de51UL, 0x7925ddeaUL, 0x0c89ad77UL, 0x4503bee0UL, 0xd3be486bUL, 0x002ed397UL,
+       0x9a9b4d6bUL, 0x62180606UL, 0x9c6b5d9cUL, 0x5f14701fUL, 0xbbc8c436UL, 0x9d148d40UL, 0xdac50a58UL, 0x4e87736bUL),
+    SC(0xb6c1f018UL, 0x2bcc65b2UL, 0xbe194313UL, 0x9b2d61d4UL, 0x20dbc415UL, 0xbecf5c44UL, 0x356b3687UL, 0x47c215c2UL,
+       0xb7bae889UL, 0xfab9f1a2UL, 0x6050d82dUL, 0xb983a6b8UL, 0xc7edf242UL, 0x69de609eUL, 0x0d963e0bUL, 0x9230f79eUL),
+    SC(0x853be70fUL, 0xc6df02bfUL, 0x271ad18aUL, 0x6e94e277UL, 0x53810df4UL, 0x0602276cUL, 0xc5b0e9d6UL, 0x2f55e587UL,
+       0xbfef4966UL, 0x5addf7bdUL, 0xefe505b0UL, 0x368be840UL, 0x6fa2bcbfUL, 0x316be956UL, 0x53d2dbe8UL, 0xc3db190cUL)
+  },
+  {
+    SC(0xd2fff4deUL, 0x9ecfdbd2UL, 0xdd99ebaeUL, 0xd038415bUL, 0x19b6c44cUL, 0x9717926cUL, 0x09e9a668UL, 0x3fdfd377UL,
+       0xa7e8ef8bUL, 0x89877e3cUL, 0xcca566ccUL, 0x7b7dd537UL, 0x0d157cabUL, 0x121d1623UL, 0xb6880567UL, 0xac66fa8bUL),
+    SC(0xf88cac5bUL, 0x7ef229e6UL, 0x1a12c335UL, 0x1603b853UL, 0x4911e6e6UL, 0x0644dff0UL, 0x16924cbeUL, 0x53aa97f6UL,
+       0xe853d434UL, 0xc1dad0b5UL, 0x4871e881UL, 0x21673a90UL, 0x71182684UL, 0x12f3362cUL, 0xe43486ffUL, 0x61307196UL),
+    SC(0x7e61ed71UL, 0x5dde7b01UL, 0xf1baabafUL, 0xbc1db38aUL, 0x8074c3ebUL, 0xca665c4fUL, 0xd70cf352UL, 0x624d3d38UL,
+       0x70bb8d04UL, 0xab22e016UL, 0x1c5836dcUL, 0xf08e2c3cUL, 0x36ce3f67UL, 0xf49e0a5bUL, 0x99e21b5cUL, 0xc6ed9069UL),
+    SC(0x9df9045eUL, 0x7deba246UL, 0x11e8fe62UL, 0xfb323077UL, 0xdd495d3fUL, 0x8ebbe4dbUL, 0x384baeebUL, 0xaa6b88fcUL,
+       0x4d5f0bf9UL, 0xf5cef832UL, 0xaec0ae94UL, 0xf204d1b5UL, 0x18554378UL, 0x440675daUL, 0x8bb2d91aUL, 0x8fcd5960UL),
+    SC(0x5d134cdeUL, 0xd16d21c0UL, 0x02bf962eUL, 0x7f12f2d6UL, 0x4e91586cUL, 0x8070bfa2UL, 0x61499eddUL, 0xe00b2a57UL,
+       0xb7b6bc8aUL, 0x54e118e8UL, 0x8cbdafc9UL, 0x325fc6e9UL, 0x125b46c3UL, 0x66c85501UL, 0x33561f0cUL, 0x49c962beUL),
+    SC(0xa565c3cdUL, 0x2dfe5f28UL, 0x4c98abadUL, 0x82bd1a61UL, 0x76bdbb7aUL, 0x4ee51f80UL, 0x29782d13UL, 0x849f32e0UL,
+       0x59ce572aUL, 0xff34600dUL, 0x26ac0c17UL, 0x4b5b508aUL, 0x81e1a9f2UL, 0x7f3ada66UL, 0x44234439UL, 0x63ea61a3UL),
+    SC(0x08bb4ebaUL, 0x3d2b83f9UL, 0xd6bdde6fUL, 0x82253b2aUL, 0x717cb133UL, 0xf0a7512aUL, 0x0ddfbd29UL, 0xc6b271abUL,
+       0xf0a0bcafUL, 0x14311a27UL, 0xda09d57dUL, 0xce87ea6cUL, 0xb2156be9UL, 0x59982e18UL, 0x5c92e64bUL, 0x861f4ed1UL),
+    SC(0x8b93bf92UL, 0xa0f791b0UL, 0xe60e4a33UL, 0x8ecc5919UL, 0x6fcb8f55UL, 0xb7cd886fUL, 0xcb71d66eUL, 0x519333c8UL,
+       0x77e26206UL, 0x945f5dc6UL, 0xca3e3075UL, 0x5834eb21UL, 0x5c3111c1UL, 0x4bc0b424UL, 0x319d7d50UL, 0xf42dbb8aUL),
+    SC(0xb8a91ab4UL, 0xeab1e465UL, 0xe9ce0f05UL, 0xb9cd5cc9UL, 0xd7bd5ca0UL, 0x29018129UL, 0x7a2d2142UL, 0xa3269d49UL,
+       0x35eabe73UL, 0x94dbc74cUL, 0xe174be38UL, 0x81b56b3cUL, 0xd2ef6a16UL, 0x4a7f92a3UL, 0x17034917UL, 0x239aa67cUL),
+    SC(0x26f3e105UL, 0x9bc8f39aUL, 0xb56cbfceUL, 0xcc7f8cfbUL, 0xead6cf57UL, 0xca4d6d4fUL, 0x61653fbeUL, 0x1934e2baUL,
+       0x7a970b03UL, 0xa86755dfUL, 0xf2465be1UL, 0xba1634cbUL, 0xdfad7486UL, 0xed7a8a57UL, 0xb236ae0aUL, 0x022993b3UL),
+    SC(0xb1775563UL, 0x68b77fe5UL, 0x896d8eeaUL, 0xe8631deeUL, 0x788d6b7dUL, 0xb5fe84cfUL, 0x66782308UL, 0x3c0536c8UL,
+       0xed42a54eUL, 0x36509460UL, 0xecaa422dUL, 0xfade0836UL, 0x8d96dfe7UL, 0xce4b0af2UL, 0xfac64b84UL, 0x0a49c4a8UL),
+    SC(0x7e8f9d20UL, 0x9b9ae3e0UL, 0xd8bcc4cdUL, 0x8f678d77UL, 0x0b9ddde2UL, 0xf85b811dUL, 0x63558dc9UL, 0xb82b4c2aUL,
+       0x317ca8e7UL, 0x697667a0UL, 0x1d60345aUL, 0xacc9eec1UL, 0x57533739UL, 0x683a3610UL, 0xbaee81d7UL, 0xbbb2afe6UL),
+    SC(0x0ada7a37UL, 0xa54998fcUL, 0xab666fcbUL, 0x78189cbaUL, 0xf07ac132UL, 0xd0ddb59eUL, 0x26a959edUL, 0x2281689dUL,
+       0xca658fbaUL, 0xd7ef940eUL, 0x61e0bd3eUL, 0x41e04863UL, 0xcfae0703UL, 0xf997fe20UL, 0xb6c4ff96UL, 0xc1a6d53cUL),
+    SC(0x093023c4UL, 0xec822347UL, 0x55893d89UL, 0x0497ebceUL, 0xc0a884adUL, 0xe93a5ee2UL, 0x23514127UL, 0xfefbd7e9UL,
+       0xcbb91515UL, 0xe8ce6330UL, 0x55ab91dfUL, 0x96ec77e8UL, 0x52a5ce34UL, 0xf0fe3a08UL, 0x315c30c8UL, 0x660ec7c2UL),
+    SC(0xf70d11bfUL, 0x4b476adaUL, 0xa3329b90UL, 0xe5673313UL, 0x2107c27aUL, 0xda354d4fUL, 0x53ca0913UL, 0x117f3efcUL,
+       0x38fe645cUL, 0x7adb5944UL, 0xcf396af1UL, 0x3bcf69c9UL, 0xf952f55aUL, 0x57274f05UL, 0xa88e5ba9UL, 0x51b64064UL),
+    SC(0x111c1a35UL, 0xfab368adUL, 0xe90c5384UL, 0xb0412268UL, 0xa1a8f8d3UL, 0x49662a83UL, 0x4aa7c0d9UL, 0x830a307cUL,
+       0xbc8cf412UL, 0x238469b5UL, 0x7a316a27UL, 0x1fe4ba42UL, 0xf3fa6a62UL, 0x0efe1e12UL, 0x54f20f61UL, 0x8c0eead0UL)
+  },
+  {
+    SC(0xb3b5422fUL, 0x1361ce5cUL, 0xbf7cc061UL, 0x3c78aa88UL, 0xa02683eeUL, 0xcddeaaf3UL, 0x0f5516cbUL, 0x291632e0UL,
+       0x1790cb50UL, 0xcc2c760aUL, 0xc7c2e97cUL, 0xc44aff29UL, 0x86c73be5UL, 0x59a88180UL, 0x8d036e7aUL, 0x94347156UL),
+    SC(0xa7087c6eUL, 0x3cc50e11UL, 0x5e42e86fUL, 0x855fc0bbUL, 0x8a0deae8UL, 0x4c1f92baUL, 0x370152e7UL, 0x69d7e73fUL,
+       0x86a61264UL, 0xc5ea922bUL, 0xcf1dd751UL, 0xb5296539UL, 0xbc2c41b1UL, 0x29d3881fUL, 0x02affabeUL, 0x51f6d1d3UL),
+    SC(0x53ef19dbUL, 0x13d761c4UL, 0x995bce5aUL, 0x55365036UL, 0xdef1321fUL, 0xe0b393b7UL, 0x41b55b86UL, 0x8ecc9ba7UL,
+       0x7a7d9ef6UL, 0x61ec075dUL, 0x19e719acUL, 0x56f028bdUL, 0x403609efUL, 0xccc39881UL, 0x189673aeUL, 0x0010ec05UL),
+    SC(0x09ea51d5UL, 0x4cec52d8UL, 0x58f8c082UL, 0xe4362b84UL, 0x6a83e0f2UL, 0x9c99df32UL, 0x30c9a2d8UL, 0xe5269818UL,
+       0x41305f7fUL, 0xa9535eaeUL, 0xfe7316d7UL, 0x6ae49d92UL, 0x47667649UL, 0x5776c712UL, 0x214b8fbdUL, 0xf0c80cbaUL),
+    SC(0x9c0db1acUL, 0xfa10880fUL, 0xd4da60e8UL, 0x0a8a7c6eUL, 0xb4117f37UL, 0x80394e83UL, 0xfb591307UL, 0x14dc6460UL,
+       0x55b73b4eUL, 0x80091775UL, 0x1e680a18UL, 0x6df01b67UL, 0xcf0b38ccUL, 0xe10bc0f4UL, 0xdc98e0beUL, 0x7b5c5a24UL),
+    SC(0x9734eb47UL, 0x0f47f2b5UL, 0x04edad15UL, 0x791b890fUL, 0x64794567UL, 0xdf7b4866UL, 0xb8ccde2fUL, 0x9890cc38UL,
+       0x9bd277e7UL, 0x7cecded5UL, 0x9dfa120aUL, 0xf6bf322aUL, 0x910e972aUL, 0x57543940UL, 0xb74098fbUL, 0xaf5be122UL),
+    SC(0x38aceb92UL, 0x95b480d2UL, 0x1ab23f0fUL, 0xc2ffa615UL, 0xee4f6903UL, 0x32aae091UL, 0x596d0aecUL, 0xa99e5efdUL,
+       0x8a3c1050UL, 0x4ca2b73eUL, 0xc5249f9aUL, 0x6edf0b67UL, 0x065a8b02UL, 0x4e8ee2d4UL, 0xe90dd3a3UL, 0xa8e3c4b7UL),
+    SC(0x0bc517f6UL, 0x0658a0f2UL, 0xec9bb49bUL, 0x19573f9bUL, 0x7c74a37cUL, 0xc3f40c99UL, 0x7c31db21UL, 0x170fb0e8UL,
+       0xb0dad7b6UL, 0x18e1e061UL, 0x902ad53eUL, 0xa00d3cd2UL, 0xe9a7821fUL, 0x172caac3UL, 0x3c1fc1efUL, 0xfbbd3c65UL),
+    SC(0x6726e4bdUL, 0x5ea071e7UL, 0x43bdafd2UL, 0x2fc7153fUL, 0x49e36504UL, 0xe8482db4UL, 0x9d64f995UL, 0xb8b073dbUL,
+       0x7cdfdb2aUL, 0x6a42f050UL, 0x841631d9UL, 0x779802c7UL, 0x3ccb6844UL, 0x1ad48508UL, 0x6598f6acUL, 0xf91533abUL),
+    SC(0xb586e330UL, 0xa91d81edUL, 0xd9b972e3UL, 0xd7a33c6aUL, 0xb01019e5UL, 0x6f809583UL, 0x767370f9UL, 0x2803be7dUL,
+       0x8bea5cdcUL, 0x619dd2b0UL, 0x185a3242UL, 0x1fa7dec3UL, 0x662cda7aUL, 0x9f1302d4UL, 0xffcdd31fUL, 0x5959628aUL),
+    SC(0x6a713584UL, 0xe0d2fe01UL, 0x64ab5ec1UL, 0xf31f2798UL, 0xfb85518dUL, 0x7f91d512UL, 0xd4380e11UL, 0x3d3fd132UL,
+       0x3a864153UL, 0x4be74fa9UL, 0x6bceb551UL, 0x15d2b3f0UL, 0x59fc61cdUL, 0x54a046e8UL, 0xd6216f2cUL, 0x3cfe61d8UL),
+    SC(0x2919d598UL, 0x7a521f25UL, 0x5dcdfb55UL, 0x3e5a707fUL, 0x696f3aaeUL, 0x47226585UL, 0x248abd19UL, 0x39519f38UL,
+       0xbef08437UL, 0x9a346d56UL, 0x7c800354UL, 0xe85aa596UL, 0x6a0e2b03UL, 0x91efb233UL, 0x7d4a2df8UL, 0x9d14e9bcUL),
+    SC(0x78bd9c63UL, 0x35fe26f8UL, 0x68d85fd2UL, 0x6ad879deUL, 0xf582e074UL, 0x0fdf2b20UL, 0xf6bde782UL, 0xcced7a14UL,
+       0xa5b6404cUL, 0xcd6059afUL, 0x2722b328UL, 0x0acc60b6UL, 0x87759410UL, 0x161c25c0UL, 0x6866a6d6UL, 0x89a26877UL),
+    SC(0x0fecdabdUL, 0x1951afa1UL, 0x406297f6UL, 0x9ea98463UL, 0x54e14a30UL, 0xdec4e3deUL, 0x8ee107abUL, 0x43f7e32cUL,
+       0xd3095b1eUL, 0x5d01e350UL, 0x2a90289eUL, 0xc508eab2UL, 0xee888bb9UL, 0xfc72b16aUL, 0x8625a42eUL, 0x23ffec30UL),
+    SC(0x0e97f6e7UL, 0x5ca07704UL, 0xdca90e57UL, 0xaaa27502UL, 0xe1a1293eUL, 0xd99e6126UL, 0x0d03c00fUL, 0x53bad532UL,
+       0xe07fe66dUL, 0x9a2543dfUL, 0x5b618336UL, 0xf75b0907UL, 0x83c7d74cUL, 0xd63d8914UL, 0x22524339UL, 0x1f598b91UL),
+    SC(0xf7270282UL, 0x7f520388UL, 0x5412f3c7UL, 0x9fdfc9eaUL, 0xda219679UL, 0xe78d089cUL, 0x4c1117ceUL, 0xd990c5e6UL,
+       0x9711ff7bUL, 0x04223c8bUL, 0xf9aaed68UL, 0xf70090b8UL, 0x1f8163b6UL, 0x7429ba7bUL, 0xa59ac7deUL, 0xec2412a5UL)
+  },
+  {
+    SC(0x2e01d33aUL, 0xc10caa03UL, 0xab514f75UL, 0x46226f67UL, 0x69a08f01UL, 0x56017b64UL, 0xa2436a34UL, 0x447bfdbeUL,
+       0xf5bd77a1UL, 0x2c61f2efUL, 0x60a8c937UL, 0xcf29e1e6UL, 0x882b12c0UL, 0x3e7a7763UL, 0xf1ea498eUL, 0x09207836UL),
+    SC(0x7eab2720UL, 0xb4dcdc09UL, 0x08d85ef3UL, 0x0869bb07UL, 0x9640ab46UL, 0x2d6b186bUL, 0x88f92426UL, 0xac563a0eUL,
+       0xa8a15397UL, 0x96e48ddeUL, 0x8137ce65UL, 0xc55c6369UL, 0x766b5df6UL, 0x7dd0a6a0UL, 0x6d4bdcdaUL, 0xa0c4c70cUL),
+    SC(0xe6a98f52UL, 0xeeb51268UL, 0x91c4c6dfUL, 0x0b6ae474UL, 0x6cbcf21aUL, 0x7352035eUL, 0x6bb479d3UL, 0x25a64de2UL,
+       0x61c7b668UL, 0xe144fb16UL, 0xe72f06ffUL, 0x71167211UL, 0x06f6ec90UL, 0x4c6ca901UL, 0x61a71b16UL, 0x0f176e0eUL),
+    SC(0x33cca5f8UL, 0xbde4431eUL, 0x40c3af09UL, 0x2242f429UL, 0x2dcb47acUL, 0x8b4954f7UL, 0x3dd25ddaUL, 0xd572594eUL,
+       0x5c23241dUL, 0x46ad4994UL, 0x1fc84c2aUL, 0x9aa42bceUL, 0x1ee4f3d1UL, 0xcba680eeUL, 0x8760cd37UL, 0xe9924160UL),
+    SC(0xe5daf317UL, 0xa0024ea5UL, 0x26bc1939UL, 0x7a54d0e3UL, 0xff325e60UL, 0x3ef6a0dbUL, 0x4ba1b366UL, 0xe1f65c23UL,
+       0x8d70ed47UL, 0x6895c5ffUL, 0xec487a26UL, 0xb7a3fb0dUL, 0x73a32e8aUL, 0xa4a80db0UL, 0xca00ac83UL, 0x4371957eUL),
+    SC(0x6131d574UL, 0x7439ceacUL, 0xe77bc0d0UL, 0xb49981a8UL, 0x4e3033e0UL, 0x185b63b8UL, 0xa6ea9ddaUL, 0xcb45e7efUL,
+       0x06e01f69UL, 0xcbe2af0dUL, 0xa1826d6cUL, 0xab34121dUL, 0x6ab457fbUL, 0x770f7450UL, 0xc366010eUL, 0x20dbee4aUL),
+    SC(0x8a7a6e0cUL, 0x5deeaa35UL, 0xf13a9bd1UL, 0x51c737baUL, 0xbbac2fc1UL, 0x924318e5UL, 0x8b71bb4aUL, 0x87ececbeUL,
+       0x92fdb178UL, 0xb2834b39UL, 0x07dfba6bUL, 0x69e8ec68UL, 0xe8db5368UL, 0x546c54f4UL, 0xa1ecec8fUL, 0xe4e0c351UL),
+    SC(0x585670f1UL, 0xf244de6bUL, 0xfa6c9b23UL, 0x6f034fc9UL, 0x47e7075aUL, 0x59c7ddb7UL, 0xf744e6d4UL, 0xaf423e9eUL,
+       0x0d337bcfUL, 0x822decf2UL, 0x3ebd7101UL, 0x6b54dfe0UL, 0x8dad6082UL, 0x4a6307cbUL, 0xf0ed140cUL, 0x3bb14a59UL),
+    SC(0x75a87820UL, 0x7db72c1dUL, 0x355cf92eUL, 0xa74b3b78UL, 0xfdc5c56bUL, 0x88c698b3UL, 0x7eb94e2cUL, 0xf02d6dbdUL,
+       0x88595a5eUL, 0xe6444a98UL, 0x3647cd80UL, 0xcade49ccUL, 0x92a764d8UL, 0xf710ba67UL, 0x63e012d6UL, 0xb12e5d6fUL),
+    SC(0xb6dd4054UL, 0x943d57abUL, 0x3ec4897aUL, 0x8f755e9bUL, 0x42c3aec6UL, 0x7860e182UL, 0x804490e1UL, 0x91b342a9UL,
+       0xdc70eca6UL, 0x9f7d62a5UL, 0x8bdfbd97UL, 0xdc0e2b83UL, 0x18d1f890UL, 0x97e8494dUL, 0x9632e3dbUL, 0xc6168783UL),
+    SC(0xfdd92a7fUL, 0x566e855cUL, 0xcc134e03UL, 0x8b5eed94UL, 0x39023e36UL, 0x7985a077UL, 0x875b150bUL, 0x01663143UL,
+       0xee7b815bUL, 0x19e1fea3UL, 0xfbe2d687UL, 0xb3611895UL, 0x48407e6fUL, 0xb4136865UL, 0xcb2df984UL, 0xfccd893aUL),
+    SC(0x20734455UL, 0x8b2ee591UL, 0x756fa103UL, 0x2859a08fUL, 0x9218b547UL, 0xca7b67b7UL, 0x266bf648UL, 0x25209de6UL,
+       0xb389f394UL, 0x2c3edb68UL, 0x468dc1e3UL, 0x73ca3649UL, 0xee0f0bc3UL, 0x78b8da6fUL, 0xaee8f4c3UL, 0x90867040UL),
+    SC(0x1d29060bUL, 0x7b0f6884UL, 0x2ca58992UL, 0x48e6dc57UL, 0xf491248eUL, 0x3851bdd9UL, 0x80837ee4UL, 0xa777f4e5UL,
+       0xa3ec51c7UL, 0x888554b4UL, 0x1b21b6dcUL, 0xda472271UL, 0x8e5e70e5UL, 0x8d7bb22cUL, 0xb8045fe2UL, 0x2a9ca251UL),
+    SC(0x324ff1e6UL, 0x4d1ef0bbUL, 0x0e5439a5UL, 0xa3642ed1UL, 0xf97b7ad6UL, 0xdfeb6c7cUL, 0x9af9400fUL, 0xf414cca0UL,
+       0x9810fef5UL, 0x762b6517UL, 0x5bb1469eUL, 0x9ae69f94UL, 0x68dbce8bUL, 0x00131a7eUL, 0x6859461bUL, 0x25581d94UL),
+    SC(0xee2e5e82UL, 0xe7106cbfUL, 0x47093a31UL, 0xe88fdccaUL, 0x5e00957cUL, 0x1020f858UL, 0xbcaeba82UL, 0xf21c5b31UL,
+       0xd75b0c29UL, 0xe9360215UL, 0x7a8d0359UL, 0x991b5991UL, 0x8bb17a64UL, 0x6bc27e9dUL, 0x4e5d2a27UL, 0x3d4b43e5UL),
+    SC(0xa2b27628UL, 0xaae04348UL, 0x72814af1UL, 0x392c5872UL, 0x1b787dceUL, 0x6a78256fUL, 0x3af5fb33UL, 0x43fd9fd7UL,
+       0xd2ac734bUL, 0x639aa92eUL, 0x40362fb6UL, 0x042bd3deUL, 0x9272c6deUL, 0x81cd3c56UL, 0xc802db25UL, 0x1e20622eUL)
+  },
+  {
+    SC(0x934807e3UL, 0x60b79e08UL, 0xd1e28924UL, 0x2478db59UL, 0x0331c171UL, 0x6366f421UL, 0xeda4417bUL, 0xc0699286UL,
+       0xf7f83c26UL, 0x50e7a77eUL, 0x2f760e68UL, 0x7f475858UL, 0xb2c2d770UL, 0x195c199dUL, 0x33a84324UL, 0xe23f02efUL),
+    SC(0x73da18c8UL, 0x09bfd61cUL, 0xb2b6cf49UL, 0xf776d53bUL, 0xff85de5fUL, 0x796bd870UL, 0xefd66099UL, 0xa97ef7b6UL,
+       0xfe5b0c10UL, 0x1c109bf4UL, 0x5112ec0cUL, 0x205c1fdfUL, 0x06feae62UL, 0xe907c57aUL, 0xc4c960beUL, 0x22dffc8bUL),
+    SC(0x19239b6eUL, 0xd7dfedf2UL, 0x6b926ff6UL, 0x72905d85UL, 0x01b0b39bUL, 0xa20d0ac9UL, 0xd24dff81UL, 0x9aa44b0cUL,
+       0x68108879UL, 0x65ac0e8bUL, 0xe19a9febUL, 0x70980400UL, 0xfed7d280UL, 0xa75f1990UL, 0x65b911d6UL, 0x39a734abUL),
+    SC(0xe03b6633UL, 0x7b60f200UL, 0x38d28ed4UL, 0x01cbe30dUL, 0xc84afc0fUL, 0x1bcbb14dUL, 0x40b73636UL, 0x2ac08147UL,
+       0xe3dcfe11UL, 0x5065cd9fUL, 0xf7ef8225UL, 0xe9ee3685UL, 0xfdc1c8e0UL, 0x66306022UL, 0xca5aa599UL, 0x977db560UL),
+    SC(0x7f1744cbUL, 0xeb8020dbUL, 0x13d21f53UL, 0x81e7dfdfUL, 0xb98624acUL, 0xab4bfbb9UL, 0x1dec9f5aUL, 0xef410ec8UL,
+       0xfea6fc12UL, 0x7ea0ebd1UL, 0xbb3772c9UL, 0x499bfde8UL, 0xcec1cc40UL, 0xe33b2e1fUL, 0xa4fddf45UL, 0xd03ce9eeUL),
+    SC(0xb1d67d78UL, 0x0979a525UL, 0x2093be3dUL, 0xcf10125eUL, 0xdf13734aUL, 0xeda07905UL, 0xad2fce0cUL, 0x11015bc0UL,
+       0x9d6872cfUL, 0xb685ca9bUL, 0x042e808cUL, 0x08f854daUL, 0xed0c3939UL, 0x40ccbd82UL, 0x49856e84UL, 0xca2c9de6UL),
+    SC(0xcc9c4e59UL, 0xfdb57cafUL, 0xbbdb63b2UL, 0xf9c8d283UL, 0x5d332666UL, 0x096beeccUL, 0x28d8c28bUL, 0x2bbd4df6UL,
+       0xa8aa77ceUL, 0xfbdc1413UL, 0x8d9889e3UL, 0x55338948UL, 0x82a8c56aUL, 0x3c80516dUL, 0x321d38aeUL, 0x027c55aeUL),
+    SC(0xc0a0db13UL, 0x6f2dd096UL, 0x412fec0fUL, 0x6fb2652fUL, 0x63346063UL, 0x559525fcUL, 0x01da8c67UL, 0x12e1bc30UL,
+       0x3b6257a4UL, 0x13efda21UL, 0x623c63f0UL, 0xd78668d6UL, 0x93dad095UL, 0x8653942bUL, 0x20b8bf3eUL, 0xecf8d542UL),
+    SC(0x72abfdc9UL, 0xeb47ad36UL, 0x86fc6428UL, 0x42d99247UL, 0xd6331a5cUL, 0x113f3f04UL, 0xb5ada07cUL, 0xdcf7b706UL,
+       0x79cbfce7UL, 0x65d63523UL, 0xc7b02011UL, 0xaf3135b3UL, 0xa67be602UL, 0xc8e87754UL, 0x53c45f6eUL, 0x8538ba70UL),
+    SC(0x085670d7UL, 0x4dbf0d13UL, 0x4c0ebe98UL, 0x7f88972fUL, 0x82fea44fUL, 0xda5bee6eUL, 0x8c865ba3UL, 0x6010e45dUL,
+       0x8a7b053eUL, 0x0f8336fbUL, 0xa9e198c6UL, 0xb8b7707cUL, 0x20fa2224UL, 0x0a5d239aUL, 0x7e40acc3UL, 0x699d7bdcUL),
+    SC(0x21c37875UL, 0xd3577979UL, 0x8693da88UL, 0x85d2e0a0UL, 0x5faee58dUL, 0x0ea74b21UL, 0x782ad05cUL, 0x7108f56aUL,
+       0x30f8e75fUL, 0x6f7caecbUL, 0xebf8353fUL, 0xf06264ddUL, 0x7b5638f7UL, 0xfbe48e70UL, 0xc76b0704UL, 0x6ac2e3bcUL),
+    SC(0xf73ef2dbUL, 0x94358b7aUL, 0xee9b7046UL, 0x8a345c4aUL, 0x94845bf8UL, 0x0daee156UL, 0xf5fa9332UL, 0x0c9c2cb5UL,
+       0xcdc5fde9UL, 0x995563fcUL, 0x612e8e6dUL, 0xbcd21863UL, 0xf8e83162UL, 0x4d3a85b4UL, 0x09a3d750UL, 0x0665c635UL),
+    SC(0x72a27f5eUL, 0x12944a7eUL, 0x6406cbceUL, 0xdd90c43aUL, 0xbc6c1016UL, 0x3fc0d325UL, 0xf3dbac3aUL, 0x156a2767UL,
+       0xe09d85ecUL, 0x963ebce6UL, 0x26cd0f2fUL, 0x16d882feUL, 0x488d7bd0UL, 0x9888a2e5UL, 0xff05f570UL, 0x86206a9fUL),
+    SC(0x1e6f7788UL, 0x61257d8fUL, 0xca81902bUL, 0x394d9815UL, 0x26f5a703UL, 0x688c0636UL, 0xa51853bdUL, 0x85f05eadUL,
+       0xa10cb6b5UL, 0xe935cb46UL, 0xcb1239a1UL, 0x03d08c85UL, 0xbb387812UL, 0x9c21af4cUL, 0x5781c345UL, 0xf8a3ec5fUL),
+    SC(0xec27394bUL, 0x44d9f24dUL, 0x59384965UL, 0x4c3d3662UL, 0xa9a45cf9UL, 0xcfa23557UL, 0x9320c4bfUL, 0x1e1dfc17UL,
+       0xd28e9133UL, 0x89c41173UL, 0x89b8b665UL, 0xb7ec1f7dUL, 0xb2cfbb6cUL, 0x9ff7363fUL, 0x01f26948UL, 0x517a12a2UL),
+    SC(0xe27482feUL, 0x5e305f85UL, 0xa4ecdc26UL, 0x22f25c06UL, 0xac7f82d6UL, 0x230b8c8eUL, 0x4d8bff9aUL, 0x8a78db10UL,
+       0xe426cac3UL, 0xb02eda3cUL, 0x1b1f90e8UL, 0x076f9770UL, 0x29ed1623UL, 0x62df1ae6UL, 0xe68986acUL, 0xc346d7d1UL)
+  },
+  {
+    SC(0xaccea070UL, 0xaa6709bfUL, 0xefd88be4UL, 0xbef1d485UL, 0xa0da83e7UL, 0xac9a1eb0UL, 0xeda8387eUL, 0xb9fe666bUL,
+       0x93fc1c9dUL, 0xfed8fff9UL, 0x60ef750eUL, 0x94dd2342UL, 0x5fa08c3dUL, 0x8eda3eeeUL, 0x07f51381UL, 0x196080e3UL),
+    SC(0x163e8e65UL, 0xfb6e7ca8UL, 0x585fc072UL, 0x3750bf68UL, 0xfea588deUL, 0x5e713e7fUL, 0x9538dbf1UL, 0x1524dac8UL,
+       0x1217686bUL, 0x7ff2f144UL, 0x88d5c121UL, 0x0df15026UL, 0xb6757b8dUL, 0xe72b1303UL, 0xb830f516UL, 0x4b4cf3c8UL),
+    SC(0x7bc1be5dUL, 0x358d6d0cUL, 0xa42ebfa3UL, 0x7d208024UL, 0xd3b2451dUL, 0xfa0dd7ddUL, 0xd6c43159UL, 0x76483b08UL,
+       0x42dbc796UL, 0x2228db1bUL, 0x8268dfa0UL, 0x2725fc82UL, 0x5814a893UL, 0xdbabd144UL, 0xec5a1cc0UL, 0xfd8e31c3UL),
+    SC(0x6fd5e39cUL, 0x872cdd15UL, 0x19df9822UL, 0x6a0f84b9UL, 0xa5cce99aUL, 0xb72d3d54UL, 0x27e24d24UL, 0xd8b9655fUL,
+       0x07969aadUL, 0x162d6db9UL, 0x973d2f9fUL, 0xa1475ccfUL, 0x39eddbe1UL, 0xa205e28fUL, 0x54594ed0UL, 0x108136fbUL),
+    SC(0xd65d659cUL, 0xadf25d7dUL, 0x6ce5fd2bUL, 0xe8794007UL, 0x6a4ef262UL, 0x7284bc70UL, 0xc4557021UL, 0x4239e812UL,
+       0xc1092daaUL, 0x39ab1efeUL, 0x480823f0UL, 0x6038e5b0UL, 0x35e1d2ccUL, 0x1caa879eUL, 0x01b7d057UL, 0x8dcdd241UL),
+    SC(0x754ebd39UL, 0x5f6a7a88UL, 0xb051016cUL, 0x3631ab36UL, 0x68733921UL, 0xb9b95386UL, 0xd924f6b7UL, 0xaaac42dfUL,
+       0x95a20483UL, 0x80e9a9adUL, 0x6b165cceUL, 0xdb441b6dUL, 0x0e439ef5UL, 0x92802fb7UL, 0xe314387aUL, 0x94b2624dUL),
+    SC(0x67340806UL, 0xfe427a46UL, 0x0b9c3939UL, 0x3dc5c7e6UL, 0x680f5a3aUL, 0x275c1008UL, 0x408a2a11UL, 0xec43e2d8UL,
+       0xee7e2b49UL, 0xb9e508a4UL, 0xe7a3b6f4UL, 0x72ec3a51UL, 0xb4bca79bUL, 0x897b08faUL, 0xe9ba77d2UL, 0x90a0b4e8UL),
+    SC(0xef822b5aUL, 0x2746c477UL, 0x4f4089efUL, 0xa33f39e4UL, 0x2e4e3675UL, 0x69cb95c9UL, 0xa6b75148UL, 0xc0e76e86UL,
+       0x9784c76cUL, 0x6d35e6fcUL, 0x0aeb97deUL, 0x6daf3401UL, 0x4e594b81UL, 0xc862e8f5UL, 0xcd197e08UL, 0x3a180888UL),
+    SC(0x639bf346UL, 0xfe9a3915UL, 0x5a718e2cUL, 0xc4191bbaUL, 0x4985c628UL, 0xb5d504e2UL, 0xde39a421UL, 0xae0b0415UL,
+       0xd1bb783bUL, 0x4bd96366UL, 0xc4e9f82fUL, 0xe6544bceUL, 0x0df39cbfUL, 0x592a4aa4UL, 0x7695182bUL, 0xb632c443UL),
+    SC(0x5de8f2dcUL, 0x825fdea9UL, 0xa0fe2aa9UL, 0xa49b38a8UL, 0x6f23e639UL, 0xee25668eUL, 0x7445b607UL, 0xdf79ed02UL,
+       0xa1a17c29UL, 0xdf23dc19UL, 0xc013c05aUL, 0x25094dfeUL, 0x984591fcUL, 0x0a825aa3UL, 0x577dae9dUL, 0x6bb1c513UL),
+    SC(0x467a55e3UL, 0xc7f904b6UL, 0x308f943cUL, 0xfbf1c9c6UL, 0xc8489622UL, 0x9533bd31UL, 0x5b008c0cUL, 0xdf5c6e5cUL,
+       0x59c10ba7UL, 0xddaa2005UL, 0xa169a884UL, 0x6f5bdc83UL, 0x633d260bUL, 0x762a6babUL, 0x2cc8d9bbUL, 0x401d0ca2UL),
+    SC(0x06064e78UL, 0x170d3667UL, 0xb0226c1eUL, 0x628c25bfUL, 0x3fd01939UL, 0x132f6fffUL, 0xbec47896UL, 0x9cef1880UL,
+       0x0d74e855UL, 0x68d86986UL, 0xf8850360UL, 0xe74faa47UL, 0x697a7ba9UL, 0x9d7cf241UL, 0xfd131af3UL, 0xe90b0dafUL),
+    SC(0x8dd19520UL, 0x5cacd63fUL, 0x7586954dUL, 0x3f1cf4d2UL, 0x25303baaUL, 0xa56bfab4UL, 0xc25fa9a0UL, 0x63621dffUL,
+       0xe772ecc0UL, 0xdfa4fc98UL, 0x9b6ac1e8UL, 0x4a96e4ddUL, 0xf1cf84eeUL, 0x37e0a2c5UL, 0x126f3dc5UL, 0x6b8bc142UL),
+    SC(0x178ca7d8UL, 0x807067b9UL, 0x253ce61aUL, 0xcf0b49d7UL, 0x1f973fecUL, 0x62bbaf65UL, 0x1af01974UL, 0xc102ad33UL,
+       0x293ae890UL, 0x98cd4157UL, 0xdb11f6bfUL, 0xc46414c5UL, 0x47e152a4UL, 0xe5276433UL, 0x06d3a4abUL, 0xf9f2c798UL),
+    SC(0x49fd915fUL, 0x42daf79aUL, 0x648d30deUL, 0xc913616dUL, 0x46e89e11UL, 0xafb9d46fUL, 0xb18aea34UL, 0xe4203d2eUL,
+       0xc94be4d0UL, 0xe2ccb36cUL, 0xc306aad0UL, 0x940f23d5UL, 0x20c2a29aUL, 0x4588a78eUL, 0xc4a8d792UL, 0x2d96bf9cUL),
+    SC(0xa76cdbb6UL, 0x1982ae31UL, 0x8b5d3be4UL, 0xeb03cefcUL, 0x8958abbfUL, 0x578bc99cUL, 0x5081bb2dUL, 0xecca6328UL,
+       0x8f0ad9deUL, 0x7d0a36e1UL, 0xe27e5bb2UL, 0x9510734cUL, 0x509c5f60UL, 0xc905982fUL, 0x23865986UL, 0x784134d7UL)
+  },
+  {
+    SC(0x0a488f83UL, 0x2bf3e57bUL, 0x5225f748UL, 0x754ba2b5UL, 0xcd9657c7UL, 0x175198aeUL, 0x122c3d1cUL, 0xee336ef2UL,
+       0x4e326d40UL, 0x648cf269UL, 0x2db42532UL, 0x55391fcaUL, 0x5c2b48d7UL, 0x44a9e39fUL, 0xbd1293dcUL, 0x827e9021UL),
+    SC(0xc2e4a4bbUL, 0x4cc75a7cUL, 0x4e5fdae1UL, 0x3b6910ecUL, 0x7056bfe4UL, 0x5c0ab7d1UL, 0x2146bd69UL, 0x5a7eaeb3UL,
+       0x72b2d74bUL, 0x6181bedfUL, 0x4bff36d5UL, 0xe1162304UL, 0x65ad711eUL, 0x0c13c099UL, 0x1dbf2b43UL, 0xc567a603UL),
+    SC(0x9e95d628UL, 0xc5278b1cUL, 0x56863ad9UL, 0xe595739eUL, 0x8cf36103UL, 0x75e29168UL, 0x5a5654baUL, 0x562292d5UL,
+       0x8abdc7c0UL, 0x8a472f49UL, 0x4279be90UL, 0x6d575b7dUL, 0x17fbbfe2UL, 0x47d97022UL, 0x533fbdd7UL, 0x1d4ff8e4UL),
+    SC(0x76fa079aUL, 0x2b9a0dc9UL, 0x3a12d28eUL, 0xcbede965UL, 0xe33afdf6UL, 0xed28f3c7UL, 0xc7d5295eUL, 0x6b26943cUL,
+       0x00cdd558UL, 0x61e9b7f6UL, 0xba779158UL, 0x065b37c6UL, 0xef665077UL, 0x9344f7eeUL, 0x06e8d4b3UL, 0xae658c96UL),
+    SC(0xa0269bccUL, 0xa3d91987UL, 0x737ae43fUL, 0x2d1b99d1UL, 0x18a139b2UL, 0x5d5b4ba9UL, 0xcab55c62UL, 0x66e4cc78UL,
+       0x6febb984UL, 0x7682c796UL, 0xfaf098b7UL, 0x60c5ab58UL, 0x0b1688f3UL, 0x49abaf25UL, 0x3456c3cfUL, 0xd60fd361UL),
+    SC(0xf197660bUL, 0xf5d0e191UL, 0xd2a75f95UL, 0x4230ad48UL, 0x04e28027UL, 0xf5e61d49UL, 0x64f02fd2UL, 0xb239b18cUL,
+       0xcd05cec7UL, 0x3eecdbd8UL, 0xfd186f5eUL, 0x73d121d8UL, 0x2ae2df03UL, 0x29bd7e44UL, 0x408bf7f8UL, 0x5b3009e9UL),
+    SC(0x584dacb5UL, 0x735c38abUL, 0x366ebb74UL, 0x8ecba797UL, 0x5be0576bUL, 0xa52eeec8UL, 0xc6fc353fUL, 0x17d783caUL,
+       0x0198e2b4UL, 0x5d1e6ee2UL, 0x888581c6UL, 0x5dda9b44UL, 0xa2441d09UL, 0x4945deafUL, 0x77232861UL, 0x4d6f0c98UL),
+    SC(0xeb6d53e9UL, 0x4f34c551UL, 0x9fc21d83UL, 0xf2092221UL, 0x457e9697UL, 0x9e535980UL, 0x31c5a853UL, 0x615637e6UL,
+       0xb958d521UL, 0xd74b297fUL, 0x6e537d1aUL, 0x9512c5bfUL, 0x74a3a134UL, 0xb2354d21UL, 0xb24b30c3UL, 0x1eb0e607UL),
+    SC(0xd32c2816UL, 0xb28e0bcfUL, 0xd477c631UL, 0x7ca9cea7UL, 0x51c3d7a2UL, 0xa4d2aa70UL, 0xb6ea5568UL, 0x63581e21UL,
+       0x7e42e895UL, 0xc6cc4eabUL, 0xc85b2bdfUL, 0x301e37edUL, 0x359ac182UL, 0xee1d6843UL, 0xa3c1c7f7UL, 0xd253cd0cUL),
+    SC(0xbab8ec85UL, 0xd297ac61UL, 0x8aeca643UL, 0xd3e54750UL, 0x5974d165UL, 0x4a2031d9UL, 0x3fe2a865UL, 0x7efaa8caUL,
+       0xf4544105UL, 0x4f81f7e9UL, 0x1a8c773cUL, 0x369689ffUL, 0xee5b286aUL, 0xea652d22UL, 0x7812c8b0UL, 0x57ffd710UL),
+    SC(0x7d75e064UL, 0x5542097cUL, 0xd70982b2UL, 0x92697b2fUL, 0xc3439a6aUL, 0x26f1d51aUL, 0x15766ba0UL, 0x10c80b5bUL,
+       0x9868b21dUL, 0x2fd0340bUL, 0x712b2958UL, 0xab4925adUL, 0xd22eae92UL, 0x01ca2015UL, 0x5b578d05UL, 0x14019501UL),
+    SC(0x4885a359UL, 0xcbdb926bUL, 0x3d2918e7UL, 0xa7bfc8a7UL, 0xca9c6a8fUL, 0x870824aaUL, 0xfc2911c2UL, 0xbe3be588UL,
+       0x7cfa2021UL, 0x0bc9eba8UL, 0x27729709UL, 0xba83cd2bUL, 0xd6c1d68bUL, 0x2217dd07UL, 0xc7af1977UL, 0x35ce7206UL),
+    SC(0x052c4990UL, 0x8a3b1b8bUL, 0x3eb084f5UL, 0x33f5f559UL, 0xe9113d53UL, 0x8d753027UL, 0x3b1f9bb5UL, 0xd0fd03ecUL,
+       0xadf0c562UL, 0x21176de9UL, 0xb5d54273UL, 0x97feec53UL, 0x735f430cUL, 0x44082b1dUL, 0x7233ad36UL, 0x472815bbUL),
+    SC(0xb07e4e7dUL, 0x366026b1UL, 0xe4487f0cUL, 0x3a2d6825UL, 0x909f526dUL, 0xdfeae840UL, 0x334fbcb7UL, 0xb1681bebUL,
+       0x26d3eb64UL, 0xc795a304UL, 0xf226b341UL, 0xd49adab8UL, 0x4b427557UL, 0x1f683268UL, 0x140853fbUL, 0xdbf65459UL),
+    SC(0x41d028a6UL, 0x260d5c21UL, 0xf3d31771UL, 0xeb876c10UL, 0x189c367aUL, 0xb513b761UL, 0x2530e974UL, 0x6ef3b4b1UL,
+       0xf8b295c4UL, 0xa2d2d5cfUL, 0x1be8fb36UL, 0x9d2472bfUL, 0x85263bcdUL, 0x3a36a42dUL, 0x705d2555UL, 0x1a501791UL),
+    SC(0x0da36f37UL, 0xba62c357UL, 0x1fff8b97UL, 0x39d77d44UL, 0x13ff457dUL, 0x5933e77dUL, 0xe4dc3d18UL, 0x7bc601cdUL,
+       0xec0e35b6UL, 0x6d1ef946UL, 0x7f59d7bbUL, 0x534beb75UL, 0x13f8d2e5UL, 0x1919d914UL, 0xf10a7778UL, 0x4d4abbd1UL)
+  },
+  {
+    SC(0xa473de46UL, 0xa554667aUL, 0x368fd573UL, 0x168dea23UL, 0x3f81153dUL, 0xe1b35b26UL, 0x90da8863UL, 0x71e6c131UL,
+       0x4ba0b462UL, 0x92aed936UL, 0x7a2bf9e9UL, 0xde48a08aUL, 0x874fd681UL, 0xaef86a15UL, 0x58b49e4fUL, 0x13dbbcecUL),
+    SC(0xec3a1d66UL, 0xa1f76399UL, 0xc683837bUL, 0x7b53e05cUL, 0x5df3ffbeUL, 0x325d3d4fUL, 0xde12cb19UL, 0xc44a8fc1UL,
+       0x73392723UL, 0x41f63fccUL, 0xd994c0afUL, 0xd1459f82UL, 0xc5479fc8UL, 0x01628b8aUL, 0x34b4d042UL, 0xe68a23ccUL),
+    SC(0x8de418b2UL, 0x77aa4dccUL, 0x11619e6eUL, 0xf76d6a5dUL, 0x8ae48448UL, 0xc6dedcccUL, 0xf32b7238UL, 0xb58a2e55UL,
+       0x11e44fa8UL, 0x68811549UL, 0x8a7cf95bUL, 0x91eb8c53UL, 0x7119ef6cUL, 0x03b9fd2dUL, 0x37f428ceUL, 0x94060ea5UL),
+    SC(0xeaef8564UL, 0xefa35058UL, 0x1ffc48ebUL, 0x329fe037UL, 0x60b85bf7UL, 0x864a433eUL, 0x70b5e227UL, 0x9282fd9dUL,
+       0x90eeb6b4UL, 0xc3252fa0UL, 0xae0ff9c4UL, 0xab2974ecUL, 0x12cd8b43UL, 0x8af9a0adUL, 0x064b8b3cUL, 0xe404d35cUL),
+    SC(0x6985a408UL, 0x1a00ef94UL, 0xac404379UL, 0xdbda4471UL, 0xeb99bb45UL, 0x69c90da3UL, 0x241743c1UL, 0xafa865e6UL,
+       0x02485252UL, 0x3273c205UL, 0x8321276eUL, 0x1cc4af69UL, 0x0380642dUL, 0x3e2ec299UL, 0x64da2d75UL, 0xb17f3865UL),
+    SC(0xdf779625UL, 0xea469eaeUL, 0x1463fa21UL, 0xb088cc70UL, 0x6ac9d3e0UL, 0x9c4ad69dUL, 0x554222b7UL, 0x7a2bdc0eUL,
+       0x56e00902UL, 0x4defe4e0UL, 0x5f097ebfUL, 0xae0c4782UL, 0xa93500dbUL, 0xbffdd525UL, 0x8ab8ecd3UL, 0x1253f224UL),
+    SC(0x1a2d4b3fUL, 0x29fec403UL, 0x5b3cb811UL, 0x147d66bcUL, 0x70fcc480UL, 0x04f07bc3UL, 0x0169b592UL, 0xe4622665UL,
+       0x600cc9e2UL, 0x370d498dUL, 0xd4db60eeUL, 0x963c5dabUL, 0x8da8a23eUL, 0x8db3cb01UL, 0xd805ac2aUL, 0xd77ddb46UL),
+    SC(0x2d8e71b5UL, 0x17971a2eUL, 0x351221d9UL, 0x44e82447UL, 0x0e913772UL, 0x216a4c40UL, 0xf067087dUL, 0x4106aa7dUL,
+       0xd9284393UL, 0xad9a63f1UL, 0x2e0981d7UL, 0xaa9107deUL, 0x21a91a16UL, 0xba43a25dUL, 0x26895b4cUL, 0xd793d525UL),
+    SC(0xb53f44cfUL, 0xa4f24aa5UL, 0xa57aadf9UL, 0xcfc0ee9cUL, 0xd621d482UL, 0x3a7046d2UL, 0x8058f086UL, 0x0cdc91b1UL,
+       0x8148f9daUL, 0x95142591UL, 0xdc71b505UL, 0xee60dab6UL, 0xa680d0c4UL, 0x1ddd1fcdUL, 0xd59aaa3dUL, 0xdd4a901dUL),
+    SC(0xf31db738UL, 0x2a3f41d8UL, 0xd4079efbUL, 0xcff1e3e1UL, 0xe818b2d4UL, 0xf83dca09UL, 0x4a044a73UL, 0xd64a7452UL,
+       0x8eae5b98UL, 0xcb9e9dd7UL, 0x2a9332a5UL, 0x5abb49f8UL, 0x9bcd4b0aUL, 0xd8f6913cUL, 0xe6c1cafeUL, 0x294ffc87UL),
+    SC(0x7ce5ec00UL, 0xff2a3001UL, 0x09eced47UL, 0x3a891bfdUL, 0xf2c2a9a1UL, 0x8fd7e18eUL, 0x3999ad19UL, 0xb60d42bdUL,
+       0xc514419eUL, 0x272c3380UL, 0x0a7ce5dcUL, 0x1883e7cbUL, 0x2df64c89UL, 0x5f2a730fUL, 0xcde2f3c4UL, 0x945b6ff7UL),
+    SC(0x57ea4789UL, 0xf7e02c29UL, 0x7a089cffUL, 0x9ae71fcdUL, 0x0f511cbcUL, 0x926b9299UL, 0x25a1e184UL, 0xc6157c5eUL,
+       0xc696731aUL, 0x51132560UL, 0xc77afd16UL, 0x15cd5072UL, 0x4cf0d136UL, 0x7c4fa3caUL, 0xb19aec05UL, 0xa8d701fdUL),
+    SC(0x5cba3f4eUL, 0x8aab710dUL, 0x878697efUL, 0x9a1ae299UL, 0x821960fcUL, 0xcaf88887UL, 0x9c6f38dbUL, 0x4be1dbe0UL,
+       0x336cd748UL, 0x99412e3fUL, 0x9ca14d01UL, 0x2cebcce3UL, 0x42ee9e97UL, 0x638cdf3fUL, 0xdf5c0077UL, 0x8d3e37b6UL),
+    SC(0x056b0894UL, 0x7d551fe1UL, 0x2e9ab57eUL, 0xa70d342eUL, 0x3cb74d74UL, 0xf549edc3UL, 0xf7551eefUL, 0xca9f9fc0UL,
+       0xe7ac85d2UL, 0xa4baa20cUL, 0x4e1bab03UL, 0x7190490bUL, 0xe3574ad1UL, 0xf9cbc392UL, 0xf28f45cfUL, 0xdb4dd2e1UL),
+    SC(0x7ca03c7fUL, 0xab7f76a5UL, 0xa258365eUL, 0x55473083UL, 0x5a9850afUL, 0x6c83c311UL, 0xb487a8c0UL, 0x4ba87a28UL,
+       0x1d144504UL, 0x193db309UL, 0x170a3ca7UL, 0x036b39bfUL, 0x46d08596UL, 0x552a2962UL, 0x6a3c40b0UL, 0x0a8f95e4UL),
+    SC(0x5d041b98UL, 0xb864a305UL, 0x117791ecUL, 0x21de3fbbUL, 0xcbe58a84UL, 0x8429d291UL, 0xbad63895UL, 0x0442c9fbUL,
+       0x46a179d0UL, 0xdecc9e6cUL, 0x09b642c1UL, 0x5fa126beUL, 0x0619872fUL, 0x17c6273dUL, 0x30e2ecb1UL, 0x1d3c0252UL)
+  },
+  {
+    SC(0x476d7ba4UL, 0x35177a71UL, 0x299267f4UL, 0x14ef275dUL, 0x48b434e1UL, 0x380c1afdUL, 0x9fac4606UL, 0xf8e02be0UL,
+       0x7f1255faUL, 0x57a60447UL, 0xc14d6574UL, 0x1d7774b9UL, 0x695e6d25UL, 0x1b46912dUL, 0xd33c77f3UL, 0xf756edc2UL),
+    SC(0xc68ac953UL, 0x985c624eUL, 0xdbbefae0UL, 0x148f049bUL, 0xc9de0f23UL, 0x7b192e7bUL, 0xe8f13921UL, 0xdc478295UL,
+       0x77efcfbfUL, 0xa08be5c4UL, 0x0632cae8UL, 0x0c7e9e6aUL, 0x520ddc19UL, 0xdbc1271fUL, 0xad0070d8UL, 0x366dfae1UL),
+    SC(0x031462a8UL, 0xae0be4c9UL, 0xb3d7a28fUL, 0x3fe28e1bUL, 0x994961a5UL, 0x80cdb3ceUL, 0x4ced5b5bUL, 0x20077b77UL,
+       0x3137a2d3UL, 0x5303daf6UL, 0x441b0ecdUL, 0x244ee32cUL, 0x1c87dcf4UL, 0x27449c65UL, 0xd3cd9bc2UL, 0x6189db3aUL),
+    SC(0xd78f7afeUL, 0x6bcb8574UL, 0x27dd87fdUL, 0x3869e74aUL, 0x760045d8UL, 0x1841a895UL, 0xf8e78697UL, 0x189ab251UL,
+       0x8e419b36UL, 0x47160117UL, 0xaf77b5c7UL, 0x97e6d695UL, 0x65ac587dUL, 0xce16b94fUL, 0x0c11ae91UL, 0x72b8eca8UL),
+    SC(0x827f5436UL, 0xf983e162UL, 0x42213577UL, 0x76403af3UL, 0xd700ac7eUL, 0x057e10eeUL, 0x53985649UL, 0x19922086UL,
+       0x9f64f7aaUL, 0xff4c6234UL, 0x5ef6017fUL, 0xe027dbd6UL, 0x26592cc4UL, 0xf050ff48UL, 0xca4c8fc7UL, 0x5ce87356UL),
+    SC(0x6ba0ce5cUL, 0x6893ee03UL, 0x629f90e7UL, 0x841790f0UL, 0x0414410fUL, 0x8526e56aUL, 0xb0f74f24UL, 0xf5c2fefaUL,
+       0x25d44a39UL, 0x961099efUL, 0xb341c985UL, 0xd1f7604fUL, 0x298838efUL, 0x422ccd0aUL, 0x091195f2UL, 0x2b48e7d7UL),
+    SC(0x2c43c784UL, 0xbbbcdc5fUL, 0x34789f99UL, 0x0046a9a5UL, 0x59be71bdUL, 0x3fde6f66UL, 0xb6faf050UL, 0x99b4dcecUL,
+       0x4e5fdc4cUL, 0x83eed83cUL, 0xdb5b5030UL, 0x91bdeac6UL, 0xa70cd8e1UL, 0xed187ae4UL, 0x469b9057UL, 0x18fa5386UL),
+    SC(0x4faafbdbUL, 0x1806f138UL, 0xa265e889UL, 0xdb4bfeb7UL, 0xab53b2c9UL, 0x622ed6b4UL, 0xc6b392d3UL, 0x1f7ccf07UL,
+       0xd1843334UL, 0x387f73c2UL, 0xda122ba6UL, 0x0a633fc2UL, 0x26fa3f70UL, 0xe42d41a4UL, 0x561e111eUL, 0xaed5b357UL),
+    SC(0x143b5028UL, 0xc0bee52fUL, 0x9dc11734UL, 0x0292d62bUL, 0x17672d64UL, 0x559ed0c7UL, 0x49e02f20UL, 0x8bf84bfeUL,
+       0x887d583fUL, 0xb7d6c57eUL, 0xc1c58895UL, 0x0aa99ea4UL, 0x7ff5406eUL, 0xfc5e15ebUL, 0x3d8db3a6UL, 0xe8cbd4b1UL),
+    SC(0x394ff209UL, 0xa9586a19UL, 0x396143ecUL, 0xf8ab1785UL, 0xa661b80dUL, 0x8d2d9b28UL, 0xc66c372bUL, 0xadd96e03UL,
+       0x5ce203f6UL, 0x0801bd8bUL, 0x92a673b5UL, 0x486f8f03UL, 0x08bebbcbUL, 0xbea85bd6UL, 0x7cab24eaUL, 0x92a54895UL),
+    SC(0x3e2670a7UL, 0x794a06f4UL, 0x2928430aUL, 0x8bce2866UL, 0xeebb6e38UL, 0x90fdbc94UL, 0x06b2c794UL, 0xd32f0452UL,
+       0x31d2e49eUL, 0x9a6ce422UL, 0x36bebb25UL, 0xcb243965UL, 0x6aa2a1faUL, 0x6712f17eUL, 0x6d5d2b58UL, 0xae91c3b8UL),
+    SC(0xc4cb5059UL, 0x31eb4fb6UL, 0x66fab44bUL, 0x6e063435UL, 0x35699e3fUL, 0x8c3d4957UL, 0xb971a271UL, 0x78430a1eUL,
+       0x9fb4a0e3UL, 0x8d46c234UL, 0xeba2ecc3UL, 0x8628150fUL, 0x41cbbde0UL, 0x734453f7UL, 0xc65f2444UL, 0xc52a9565UL),
+    SC(0x695d0e52UL, 0xb32cf29dUL, 0x02230b84UL, 0xc1260595UL, 0x8470dfe0UL, 0x713aa116UL, 0x0061710cUL, 0x8ce74e91UL,
+       0xf4ade5d1UL, 0x6d27de08UL, 0x78d907aaUL, 0x34b61f91UL, 0x4135227eUL, 0x097f0979UL, 0xf4ff6241UL, 0x04164ab5UL),
+    SC(0x5aed2254UL, 0x27ae4f7aUL, 0x92292498UL, 0x0a345b20UL, 0x49b00c0bUL, 0x284d55ddUL, 0x51e6cc82UL, 0x154a4cbdUL,
+       0x6da49cd4UL, 0x5a48b051UL, 0xf20987d5UL, 0x415d58b1UL, 0x9a4e1744UL, 0xd83a5ff7UL, 0x6bd95cecUL, 0x1c6dbb11UL),
+    SC(0x390aa9f6UL, 0x018e5660UL, 0xcd158531UL, 0x7d0e01e5UL, 0x5e6fb9d2UL, 0xaa785533UL, 0x6747eb80UL, 0x0caad2bbUL,
+       0xbd7e8ccfUL, 0x34e718caUL, 0x947500caUL, 0xa2d7e3e9UL, 0x3cb0c6f7UL, 0xd8b7c50cUL, 0x7aeede81UL, 0x95d0271aUL),
+    SC(0x41ff7ecfUL, 0x227a0f62UL, 0x0236265bUL, 0x1bd5649bUL, 0x96666154UL, 0x115a2840UL, 0xc37be05bUL, 0x776c85d5UL,
+       0xfa47dd69UL, 0xa1d89724UL, 0xf8801024UL, 0xdbb52b83UL, 0xd162f2e8UL, 0xb8614224UL, 0x4744afa3UL, 0x530aa1c5UL)
+  },
+  {
+    SC(0x4f62ab4cUL, 0xb7fb0d13UL, 0x12620121UL, 0x9841e932UL, 0xb0de312dUL, 0x674cd002UL, 0x315594e9UL, 0x81dfb3a1UL,
+       0x1145fdd8UL, 0xc5d16653UL, 0xa9129b0cUL, 0x39fcbbd9UL, 0x5968d22cUL, 0xff2127bfUL, 0x91e89847UL, 0x35e2834fUL),
+    SC(0x99813c3cUL, 0xdfbda83cUL, 0xa798f7dfUL, 0x5ea4f172UL, 0x3de535e8UL, 0x2f257577UL, 0xde67250cUL, 0x6e11370eUL,
+       0x38bdd34bUL, 0x18bd081cUL, 0x83307a5cUL, 0xfea76990UL, 0x11a50437UL, 0xff93fc6dUL, 0xaa22f9fcUL, 0xd5021226UL),
+    SC(0x75771c9bUL, 0x9b6e8b88UL, 0xcedcf4f4UL, 0x3772b3c2UL, 0x45f72319UL, 0x07544d57UL, 0xc6c920ccUL, 0x137aad40UL,
+       0xd8867e96UL, 0x07b79997UL, 0xc0526603UL, 0xa2a6c201UL, 0x18d93115UL, 0x4362d804UL, 0x1542e3d2UL, 0x51a8759fUL),
+    SC(0xfbc16489UL, 0x7bebf96bUL, 0xca01a281UL, 0xf2ca36c5UL, 0xdbe51bd4UL, 0x1a465b43UL, 0x3311e163UL, 0x16bbc85bUL,
+       0x07959724UL, 0x16729f2dUL, 0x9ade6f1dUL, 0x97157761UL, 0xa81baac3UL, 0xfff31e85UL, 0x13b9989fUL, 0x12f72175UL),
+    SC(0x2d625707UL, 0xd2c68919UL, 0x8ad1b321UL, 0xd60f6ba0UL, 0x5e106abdUL, 0x41bfe029UL, 0xcbc60bb5UL, 0xd5e0ddc4UL,
+       0x5b3e78b2UL, 0xa007c909UL, 0x3722440aUL, 0xd40c2ea3UL, 0x6f71717bUL, 0xc5822eefUL, 0x322a13adUL, 0x614ba310UL),
+    SC(0xcf23f492UL, 0x64ab8e60UL, 0xafd8c0d3UL, 0xa8a6e938UL, 0xfb6a3b06UL, 0x66b9abedUL, 0x23b6cb45UL, 0xd5b33a78UL,
+       0x479d121cUL, 0x571eb9c0UL, 0xe24c14ebUL, 0xb3be4816UL, 0x1363d752UL, 0xfba522efUL, 0xa010ee7cUL, 0x324be8caUL),
+    SC(0xc2f0f458UL, 0xe56f387cUL, 0xa92c2defUL, 0xf02c3e44UL, 0xdcc010e8UL, 0xc2b7917cUL, 0x751121e1UL, 0x3e49df7aUL,
+       0xd2bdb0a0UL, 0xf56b97a0UL, 0x0ffd8664UL, 0x01b34a1fUL, 0x24ba9123UL, 0xd089b256UL, 0x6a50126bUL, 0x90dfd936UL),
+    SC(0x4bbfdb7cUL, 0x8b393fa4UL, 0xbdffb5d6UL, 0xcfdf0721UL, 0xd17e03d5UL, 0xff142b34UL, 0xa0741039UL, 0x4c84bed6UL,
+       0xc115eef5UL, 0xb815b3b0UL, 0xc2f2ec4dUL, 0x98b6a09cUL, 0x36d8a320UL, 0x2f81e777UL, 0xeeea800cUL, 0x662441edUL),
+    SC(0x49868964UL, 0x9201341dUL, 0xbb24a12dUL, 0xac0cd8cbUL, 0xd973640fUL, 0x19f13540UL, 0x0dcc9d21UL, 0xd67a7d76UL,
+       0x3bcc0077UL, 0x5c6c7256UL, 0xfe0e1d3cUL, 0xa812ce2aUL, 0xc16294a9UL, 0x7b9ac6bbUL, 0x32f796c1UL, 0x3a2b50f8UL),
+    SC(0xa1e22bffUL, 0xd0567bc4UL, 0xf0261a3aUL, 0xdb9c918bUL, 0xa7d81791UL, 0xd68e99f7UL, 0xf8247ab1UL, 0x01fa7591UL,
+       0x9d1c7ff0UL, 0xdb87b176UL, 0x5e284432UL, 0x11299012UL, 0x94ce44ebUL, 0x31a4d6bbUL, 0x49fc3cc6UL, 0xd4735aaaUL),
+    SC(0x2ad5fc7bUL, 0x610a3ddcUL, 0xe4950765UL, 0x00a86b12UL, 0xe1f5e0afUL, 0x89da287fUL, 0xc930c035UL, 0xb81fbbd0UL,
+       0x9fbb7378UL, 0x36c20ee5UL, 0xbd5c081fUL, 0x5588f57bUL, 0x4fff0b1cUL, 0x71a9f334UL, 0xcff1df26UL, 0x60085c82UL),
+    SC(0xfb4dde8bUL, 0x40a51684UL, 0x0ee59627UL, 0xd5adba43UL, 0x50d2ad89UL, 0x3b0f4aacUL, 0x6f7a9900UL, 0x22b0fa1cUL,
+       0x753d7603UL, 0x674cd3cfUL, 0x46ef3a5cUL, 0xe19f0d8cUL, 0x3be64921UL, 0x6a581cb8UL, 0x6dc62674UL, 0x0abfb221UL),
+    SC(0xf36e438eUL, 0x9180c9a7UL, 0x19679a88UL, 0x51f96690UL, 0x6dc096aeUL, 0x4a86e60aUL, 0xa2a72bd1UL, 0xb06ddcfbUL,
+       0x3fd68d3bUL, 0x64d890f4UL, 0xaa653b0cUL, 0x5a670273UL, 0xa53409e9UL, 0x242f0ccfUL, 0xfb7ea68cUL, 0xc91a553bUL),
+    SC(0x7ff1d3bbUL, 0x8de59536UL, 0x19b5fa0cUL, 0x9519cecdUL, 0xfa121bdeUL, 0xff31a689UL, 0x65c18c42UL, 0xd182e4f7UL,
+       0x02953d0dUL, 0x7b0d215dUL, 0xf75955d2UL, 0x97a8ce92UL, 0x4b0f6ce2UL, 0x726b29c4UL, 0x2b7a2786UL, 0xa459c551UL),
+    SC(0x9385aa58UL, 0x1de6a3c5UL, 0x4b479bc5UL, 0x8823f699UL, 0xe65da4dfUL, 0xbfb277d4UL, 0xb56b76e7UL, 0xc41ee4f5UL,
+       0x95d109c0UL, 0x5e67ff73UL, 0x2ef10f46UL, 0x350a7578UL, 0xf7aca034UL, 0x962a573cUL, 0x707b3977UL, 0x97af5c72UL),
+    SC(0x4f3891aeUL, 0xe86c16d7UL, 0x73237e7cUL, 0xd2db7c7bUL, 0x7ba260a0UL, 0x4b85f6ddUL, 0x91e2443cUL, 0xbd21c831UL,
+       0xa96dbd49UL, 0x371bb1f4UL, 0x9ed1dc90UL, 0x17927defUL, 0x30810e2eUL, 0xb938de57UL, 0x0ab5665bUL, 0x8de5e86fUL)
+  },
+  {
+    SC(0x110f05a7UL, 0x489138c6UL, 0x51e48771UL, 0xd505c7ceUL, 0x68bd6e61UL, 0x067cf4c3UL, 0x3933441fUL, 0xa236f263UL,
+       0x0761652dUL, 0x178d0d5cUL, 0xf6189501UL, 0xd02d7078UL, 0x2f10f835UL, 0x27894d79UL, 0x4f93dff6UL, 0xe90a3b16UL),
+    SC(0x928df081UL, 0xcd85c375UL, 0xe53e825dUL, 0x4a250160UL, 0xa1a893f7UL, 0x95e0a9b8UL, 0x5378942dUL, 0xe206a1f8UL,
+       0x1f86b51cUL, 0x49582064UL, 0xf21e9673UL, 0x3786eff1UL, 0xdab4e713UL, 0x69273cbbUL, 0x9dfb3d7cUL, 0x2d930fa2UL),
+    SC(0xed504706UL, 0x702b297cUL, 0xe62c2788UL, 0x54a29419UL, 0xe7e0f76dUL, 0x0d6eb602UL, 0xe0defae2UL, 0x8f74882bUL,
+       0x67f3801fUL, 0x31e2c8f8UL, 0x5c3e409bUL, 0xb104323dUL, 0xee41c794UL, 0x802dbafeUL, 0xba832409UL, 0x4efd3486UL),
+    SC(0xd620c03fUL, 0xdad08f0aUL, 0xa67287d6UL, 0x7b68e8ffUL, 0x57d8fd09UL, 0x2ecc0731UL, 0xa236db54UL, 0x83d897b6UL,
+       0xf2a66048UL, 0x6520abffUL, 0xaa6cab39UL, 0xb90c1d3dUL, 0x89ac4738UL, 0xfe560114UL, 0x94117a73UL, 0x60f30a41UL),
+    SC(0xfe57b1d3UL, 0xb1b33889UL, 0x148509afUL, 0x29a3c797UL, 0x3bc726d2UL, 0x0593b14bUL, 0x1118580eUL, 0x6b8fc04eUL,
+       0xd69026bdUL, 0x820418aaUL, 0x74e6c115UL, 0x0b2bed0bUL, 0x0d4f48cfUL, 0xf1022367UL, 0x230679e9UL, 0x7d878547UL),
+    SC(0x1de846e8UL, 0x8e3bf169UL, 0x465b4d66UL, 0x6c0cc230UL, 0x36c0bf12UL, 0xb35ac6caUL, 0x5dd59935UL, 0x59c11063UL,
+       0xd925394cUL, 0xc8eac4bcUL, 0x31a49318UL, 0x1821560bUL, 0xbbe38d67UL, 0xea0040a9UL, 0x042a1747UL, 0xdefb69daUL),
+    SC(0x7a4dd28eUL, 0x3ccf40d8UL, 0x7ab743fbUL, 0x6011acd3UL, 0x981e4322UL, 0x0486d38cUL, 0x6b6bd69cUL, 0x368e9391UL,
+       0x89e0dc28UL, 0x680ddf3bUL, 0x1a6ee4f7UL, 0xb2b5a0a4UL, 0xc417a9caUL, 0x4cdbaaf0UL, 0xb08b4de2UL, 0xe2653010UL),
+    SC(0x593296c8UL, 0x840e55eeUL, 0xf7477ce0UL, 0xe9d5747bUL, 0x0ce2a24fUL, 0xe5e518a6UL, 0x7813da6bUL, 0x347fbd26UL,
+       0x7ea971f6UL, 0x037522c0UL, 0xf0bfebabUL, 0x17fef91bUL, 0x8216ed49UL, 0x1a0ec5d6UL, 0x55f12062UL, 0x6344c124UL),
+    SC(0xb784949bUL, 0x4228eeb8UL, 0xb8e9979eUL, 0xfd7309d0UL, 0x3e5e3a2eUL, 0xe658b017UL, 0x86b664e6UL, 0xdb7afe2dUL,
+       0x7f836c1aUL, 0x3f93744dUL, 0x0e4f0563UL, 0x456e3f36UL, 0x56b536c3UL, 0x1e8e7b39UL, 0x5c0bc78dUL, 0x9864910eUL),
+    SC(0x2298a36fUL, 0x06e66645UL, 0x5ef8ac54UL, 0xa3564c12UL, 0x59b2ebcfUL, 0x3a1dc1c6UL, 0x8f290f78UL, 0xfa366974UL,
+       0xda9db0a6UL, 0x26701765UL, 0x293d39b7UL, 0x1600c991UL, 0xeffb9ab9UL, 0x2bf6f95bUL, 0xa65f6b2eUL, 0x9c3477b1UL),
+    SC(0x253bd683UL, 0xf5421bc3UL, 0x4bfeca7bUL, 0x5b48e6e6UL, 0xd1db6398UL, 0x983b451dUL, 0x6f327288UL, 0x513516b4UL,
+       0x61b02eb9UL, 0xb3d32555UL, 0x9692df42UL, 0xb4ce3267UL, 0x297aa78bUL, 0x7ac94afdUL, 0xc08c3534UL, 0x3346f8c8UL),
+    SC(0xcd328c8fUL, 0x5aa7ced4UL, 0x0d0b0744UL, 0x39be20d9UL, 0xf44924b9UL, 0xc84fdee2UL, 0x8363fc9cUL, 0x1cfc80b3UL,
+       0x9b0dcad6UL, 0x5365b7bbUL, 0x822c2c73UL, 0x30105fe1UL, 0x907e674fUL, 0x9f11b13dUL, 0x63385bbaUL, 0xb3278d3fUL),
+    SC(0x29c6e1ceUL, 0x3f8caa9cUL, 0xd366a0e2UL, 0x3b86fc16UL, 0x986c3d12UL, 0x7c391b2cUL, 0xaee4ff5bUL, 0x5c229a7aUL,
+       0xdbd8686aUL, 0xe8f95d99UL, 0xcd7f133cUL, 0x3211620aUL, 0xb02d341dUL, 0x02a50d04UL, 0xe27a2430UL, 0xde9f8371UL),
+    SC(0xc2a3ace5UL, 0x382bdf5dUL, 0x0a5dc3c5UL, 0x09994d92UL, 0x88efd495UL, 0x32a3f0b4UL, 0xa129cb69UL, 0xa77fdfc1UL,
+       0xd79b9211UL, 0x55651adfUL, 0xbacb249aUL, 0x42ad5059UL, 0x9bf0eb15UL, 0x1d8b91a5UL, 0xf6033c13UL, 0x73db0480UL),
+    SC(0x778c13f2UL, 0x1cf131b2UL, 0x86bbe8d6UL, 0x9c4913bcUL, 0xa0932939UL, 0xa79a9446UL, 0xa8c908e8UL, 0xbfc396d8UL,
+       0x963bd25eUL, 0x461b56afUL, 0x990fef90UL, 0x5af101a3UL, 0xa96299d9UL, 0x44ffb8a5UL, 0xe6c59359UL, 0xa4d0129cUL),
+    SC(0x0c65a9cdUL, 0x15f3b7f4UL, 0xc0f668e8UL, 0x53227b2eUL, 0x4ac01865UL, 0x37c58514UL, 0x165b6bacUL, 0x93e43112UL,
+       0xae0f8b04UL, 0x1d5dc2d0UL, 0x7a8688e5UL, 0xffc70da8UL, 0xe7d5b4aaUL, 0x92faa455UL, 0x64fe31dbUL, 0x2d24929dUL)
+  },
+  {
+    SC(0x081f4223UL, 0x6a39a14eUL, 0xd2764665UL, 0x22edb719UL, 0xf2fb72b2UL, 0xc571ed67UL, 0x343e2c57UL, 0x4fb60e5bUL,
+       0x34f10ee5UL, 0x6c1d5e02UL, 0x51e8ba8cUL, 0x9f129391UL, 0x521f0601UL, 0x2ebb4549UL, 0x7377967aUL, 0xd8347e4bUL),
+    SC(0xbc6f8e27UL, 0x8bc0f3f8UL, 0x6bce4dc9UL, 0x8ed98476UL, 0xb4d7427cUL, 0x3e3f3a79UL, 0xf488d8bcUL, 0x3f11313aUL,
+       0x5a54bc1dUL, 0x4b08aefdUL, 0x53d16afcUL, 0x079b5065UL, 0xb637c0e3UL, 0x0d74dd46UL, 0x62728307UL, 0xff6c7611UL),
+    SC(0x259905bcUL, 0x501d58daUL, 0x72ff446aUL, 0x315b9f75UL, 0x89df7c14UL, 0x4d9cc937UL, 0xbd962d74UL, 0x12ac343aUL,
+       0x3c233cbcUL, 0xa1660e91UL, 0xfd41cce4UL, 0x674386a5UL, 0xd949ddffUL, 0x2477cbb3UL, 0x737e03f3UL, 0x03adf25bUL),
+    SC(0x5051c982UL, 0xaa4a5d22UL, 0x0d8c4f57UL, 0x42130c23UL, 0x4665bcb3UL, 0x4cfe0567UL, 0xdfaf3e4fUL, 0xa03d9721UL,
+       0x9413cf4bUL, 0x50784ad6UL, 0x1afd8a6bUL, 0x8ce23ae4UL, 0x80480b86UL, 0x6c08ac48UL, 0x24379d57UL, 0x8a4062d0UL),
+    SC(0xc0158ef9UL, 0xe70349feUL, 0x2d32c1edUL, 0x030c87c8UL, 0x90de8cebUL, 0x46ede75bUL, 0x02addba8UL, 0x0de2b26bUL,
+       0xb462c3ffUL, 0xb14bd8baUL, 0xc167709bUL, 0xdcae0d46UL, 0xa908fe55UL, 0x2789e2ceUL, 0xc5e43d62UL, 0xb71aab70UL),
+    SC(0x740d9568UL, 0xb420a2ddUL, 0x389b3fc8UL, 0x67065e00UL, 0x10eb2961UL, 0x56eb6774UL, 0x15755b4bUL, 0x5e277ebdUL,
+       0xeec4d9bfUL, 0x693994b5UL, 0x013ef673UL, 0x987ec7f7UL, 0x2d2c767eUL, 0x9b41cfd7UL, 0x858aacc7UL, 0xedda7aaaUL),
+    SC(0xff333278UL, 0x480b444eUL, 0x99b65b7dUL, 0x926675ecUL, 0x6b16a64eUL, 0xdffa2b75UL, 0x9c5410d6UL, 0x5fba02eeUL,
+       0x01d0f842UL, 0xe584e31aUL, 0x480c8202UL, 0x1824936eUL, 0xe2f717e3UL, 0xdf72412bUL, 0x155dd2b3UL, 0xfb1aeb4bUL),
+    SC(0x79b0a263UL, 0xdd3a2b33UL, 0x31d1369fUL, 0x8e94cc7fUL, 0xaa9b8364UL, 0x2918f9cdUL, 0xaad62d9fUL, 0x7a5cbffbUL,
+       0x225dec00UL, 0x4437c7c2UL, 0x2055851eUL, 0x1c4968b3UL, 0xf699dfc5UL, 0x846c373aUL, 0x13bec08fUL, 0x5cc3890dUL),
+    SC(0x2a12e289UL, 0x7cc085d6UL, 0x30996a53UL, 0xcd9b0e64UL, 0x4dcba64cUL, 0x7a9c4a5dUL, 0xc4affde5UL, 0x42717d25UL,
+       0x2b8e848aUL, 0x43566c29UL, 0xfc5242e0UL, 0x4892cf58UL, 0x1afb0667UL, 0x9bb15b87UL, 0x69252962UL, 0x637e00f2UL),
+    SC(0xdbf0d2c6UL, 0x29bb1f42UL, 0x10cfd3e7UL, 0x2d119391UL, 0x16d23a94UL, 0xfe0c2828UL, 0x9140a498UL, 0x1cdd0749UL,
+       0x54594d41UL, 0x8b87961eUL, 0xb6486d09UL, 0xf717471bUL, 0x13f4d39bUL, 0x1b82484dUL, 0x8463a4e7UL, 0xb28ba974UL),
+    SC(0x2a1eeaefUL, 0xb3478200UL, 0xde3fea29UL, 0xc1368d22UL, 0xba52fed7UL, 0x1175ec88UL, 0x4325833aUL, 0xe93ec8daUL,
+       0x1220e686UL, 0x97e0347eUL, 0xd0117f98UL, 0xce8929edUL, 0xeac74f0bUL, 0x2fecab82UL, 0x11bc5eaaUL, 0x638742edUL),
+    SC(0x8ecd4b9cUL, 0xbeaddc70UL, 0xf20c09cdUL, 0x67314d2aUL, 0x3cf3c115UL, 0x44cd3508UL, 0xe74050edUL, 0x16e9f34eUL,
+       0x052ddfd1UL, 0x795af7cfUL, 0x9f083a22UL, 0x35c15084UL, 0x87bfbf79UL, 0x4e3af1f7UL, 0x2183790eUL, 0x0a27b73cUL),
+    SC(0x82ae9584UL, 0xb592fdbaUL, 0x088ab48cUL, 0xceb9ff2eUL, 0xb95f09beUL, 0x29ad4700UL, 0x104bf18eUL, 0xbbf3e036UL,
+       0xac06c9c9UL, 0x4d3f79c8UL, 0x8ab2313fUL, 0xdd507808UL, 0x36cfa91bUL, 0x0f65c06dUL, 0x76b547b1UL, 0x24067fb0UL),
+    SC(0xc3b19b24UL, 0x35c6c07eUL, 0x4d3254d2UL, 0x1e0a30bbUL, 0x21c2f45fUL, 0x68a441e6UL, 0x925c3ffdUL, 0x072b230aUL,
+       0x3bdd5dedUL, 0x600a0c77UL, 0x3c620ed1UL, 0xd9545662UL, 0x0af5f3ecUL, 0x0b3b0763UL, 0x6022a466UL, 0x866aec3fUL),
+    SC(0x49622f79UL, 0x9672c94aUL, 0x26f86eddUL, 0x22e9e5aaUL, 0xb8ad1a62UL, 0x33abddc9UL, 0xfbbabbb3UL, 0x3fe276beUL,
+       0xc114c6bdUL, 0xf30f79c4UL, 0x194100daUL, 0x847518c4UL, 0xf5688a3bUL, 0x70dd60b6UL, 0xc4f765a1UL, 0x0cd324d6UL),
+    SC(0xc07b88f5UL, 0xcd465622UL, 0x2fdf8cfcUL, 0xc7191c4eUL, 0xa3dd6d18UL, 0x21adf780UL, 0x63d62d31UL, 0x02b9e02dUL,
+       0xe601c411UL, 0x839e2371UL, 0x8136fd1eUL, 0xe5adf8b7UL, 0xc5e59969UL, 0x35bb152eUL, 0x955d2ffdUL, 0x58964059UL)
+  },
+  {
+    SC(0x2dc8f27bUL, 0xb3bdcaa9UL, 0x2feace80UL, 0xf2f6212fUL, 0x8209477eUL, 0x531e74cbUL, 0xf497372eUL, 0x9a2f2263UL,
+       0x7feb63a7UL, 0x96b55beeUL, 0xffa180baUL, 0xfef47776UL, 0xfc4fabd4UL, 0x2ccdcd97UL, 0x64b4bab3UL, 0x10350790UL),
+    SC(0xac8dc04cUL, 0x1c1b8c7eUL, 0xabad287fUL, 0xa1f62206UL, 0xf307ee19UL, 0x4ba04fb2UL, 0xfdc0a908UL, 0x98a13387UL,
+       0xa06c53edUL, 0x5fce8db2UL, 0xa52ccbdeUL, 0x038121daUL, 0xfea83bccUL, 0x96482765UL, 0x26522b5eUL, 0xd762b0aeUL),
+    SC(0x20c34368UL, 0x618099a3UL, 0xd6713278UL, 0x7f2b5c9fUL, 0x3aa0d419UL, 0x40329291UL, 0x3c97237dUL, 0xb44c9072UL,
+       0xe1d3f30bUL, 0x8c4f9d31UL, 0x0df2dbccUL, 0x435a0bd9UL, 0xe4ab9342UL, 0x07df8f04UL, 0x90c820d7UL, 0xdd620444UL),
+    SC(0xdfa3550dUL, 0x49bee1f9UL, 0x304f5bd2UL, 0x5deb92ceUL, 0xb1e5d49aUL, 0x4e3535ebUL, 0x5b55d429UL, 0xe133d559UL,
+       0x1ddc87e2UL, 0xb3cad5aaUL, 0x922391d2UL, 0xb9bb11bfUL, 0xa3db93ccUL, 0x244dcebeUL, 0x147eaaf7UL, 0x610caeafUL),
+    SC(0x40510142UL, 0x20037393UL, 0x7df28434UL, 0x48899fe7UL, 0x2f6469a2UL, 0x1d77e591UL, 0xd77d2a16UL, 0xb3cd9aa8UL,
+       0x588afafdUL, 0x85ed985dUL, 0xab38fee9UL, 0x306ef133UL, 0xecb087cdUL, 0x30ac939aUL, 0xff13e1efUL, 0xa0b658faUL),
+    SC(0x120068a2UL, 0x65e77949UL, 0x05450c83UL, 0xc6ec07e1UL, 0xb6825840UL, 0xca7a00afUL, 0x6ecc6d3dUL, 0x9590e73aUL,
+       0xe2eff01bUL, 0xd4aa986eUL, 0xdec9248eUL, 0xf69d747fUL, 0x65dfa98dUL, 0x537d5443UL, 0xc1e7d9beUL, 0x317d371fUL),
+    SC(0x052a1135UL, 0x9611cb35UL, 0x6b71c05eUL, 0xc0376ea4UL, 0x27c9938fUL, 0x1191cf3bUL, 0xdc7d17deUL, 0x9c29b39dUL,
+       0x6299f3f3UL, 0x2f0bb14bUL, 0xf1c94b36UL, 0x88fcc301UL, 0xcc25c90dUL, 0xdef2f2b8UL, 0x7b0d0050UL, 0x193c987fUL),
+    SC(0x23000a37UL, 0x0c68fb1fUL, 0x4ab535a2UL, 0xdb033b76UL, 0x10f252c5UL, 0x7de5c03aUL, 0x47502282UL, 0x1200ea26UL,
+       0x3ac23fb1UL, 0xf0a42714UL, 0x829cf914UL, 0xffada79fUL, 0x234e1e5aUL, 0xdacffd5dUL, 0x34d3ca52UL, 0x976c934dUL),
+    SC(0x810aaf67UL, 0xf149fb01UL, 0xa64e25e6UL, 0x55888a74UL, 0xf6eea8b3UL, 0xc5e96fa0UL, 0x9fd9c689UL, 0x3e7543bbUL,
+       0xabfe36e6UL, 0x3418a26eUL, 0x7a19f2aeUL, 0xaee72cbaUL, 0x416880a1UL, 0x770e2bfaUL, 0x79eeff32UL, 0x35885e82UL),
+    SC(0xcdc0b689UL, 0x05afbdb4UL, 0xf1c9521eUL, 0x280cfbadUL, 0x7b543619UL, 0xb8d77c2aUL, 0x20fdfcc4UL, 0x66129e45UL,
+       0x9d59f91fUL, 0xbc3894f6UL, 0x820fda03UL, 0xae13748bUL, 0x0572f9a2UL, 0xd06dc312UL, 0x4f824831UL, 0x778d62ffUL),
+    SC(0x1bf8e290UL, 0x19706636UL, 0xe5d2c34aUL, 0x39de3f02UL, 0x331460edUL, 0x916c17feUL, 0x8e36d097UL, 0x9a5edcacUL,
+       0xe15e619cUL, 0xf4f096dbUL, 0x01ed1d51UL, 0xea5208ebUL, 0x041625eeUL, 0x6546f40eUL, 0x324b754dUL, 0xe0e202c5UL),
+    SC(0xe54a04cdUL, 0xf5893d80UL, 0x1a1cc8f6UL, 0x9dae01e5UL, 0x34b92457UL, 0xab7319a2UL, 0x04d2b6c2UL, 0x78f57f76UL,
+       0x08103dd9UL, 0xb4a89691UL, 0xb079aad5UL, 0x71267e5aUL, 0xf601dc04UL, 0x858f065eUL, 0xaeed5e92UL, 0x34dffc0eUL),
+    SC(0x711f6808UL, 0x53d18d8bUL, 0x911e2342UL, 0xa301a805UL, 0xa1c76c2bUL, 0xb5987775UL, 0x0f5867dfUL, 0xe2325d00UL,
+       0x091630abUL, 0xcdeca550UL, 0xa32e9df2UL, 0x30f02e64UL, 0x983eeb89UL, 0x396487d6UL, 0x4b3c9d59UL, 0x8350ca01UL),
+    SC(0x765b24fbUL, 0x0d42d4d4UL, 0xa9dec609UL, 0x48ce7f91UL, 0x7c3eee70UL, 0x49a36373UL, 0x9e44297eUL, 0x3cced026UL,
+       0x56408d2fUL, 0xd859a211UL, 0x26d14e77UL, 0x81302eebUL, 0x87371c17UL, 0xb1f9bf50UL, 0x9e15f545UL, 0xc240b79cUL),
+    SC(0xb68f07deUL, 0x6b13a7ceUL, 0x739a7e9aUL, 0x1c6a526eUL, 0xd1df5cdaUL, 0xb7fad149UL, 0x0df46aceUL, 0x3acc9919UL,
+       0x5da1b851UL, 0xa81fe645UL, 0x47ef84a8UL, 0xfe9a39ceUL, 0xfcdc9abcUL, 0xa3e95818UL, 0xb34860f7UL, 0xf54230bbUL),
+    SC(0xd98bcef6UL, 0xcb3e4a1fUL, 0x5b9ff8c9UL, 0x8ef7138dUL, 0xba98e80cUL, 0x200113daUL, 0xe7508497UL, 0x54954a96UL,
+       0x456c5f23UL, 0x96fc1c71UL, 0x79f6b3a3UL, 0xa82d8bb7UL, 0x8ab73d62UL, 0x61b6a098UL, 0x77527964UL, 0x5ad80080UL)
+  },
+  {
+    SC(0x118d5053UL, 0xfa3ef05cUL, 0x810cf906UL, 0x3a410f53UL, 0x38a9e6bfUL, 0x513b9a7fUL, 0x5259112fUL, 0xf84ad7e4UL,
+       0xa371fc9bUL, 0xc9182528UL, 0x27d6c842UL, 0x32e4e44aUL, 0x9d32eafaUL, 0x84f1a02dUL, 0xa86039d1UL, 0x06309e92UL),
+    SC(0xce68cb2bUL, 0xec0e3f64UL, 0xecab8273UL, 0x71f248b6UL, 0x9b25f4dbUL, 0x94ca333dUL, 0x0c8d3595UL, 0xe6f4db70UL,
+       0xa8355f23UL, 0xf22d8225UL, 0x7adc9865UL, 0x55350250UL, 0x8c0bd086UL, 0xad7d8b74UL, 0xec3f3ea0UL, 0xecc17e88UL),
+    SC(0x7834c202UL, 0x977d96ddUL, 0xd2897bc0UL, 0xb2e9b093UL, 0x06b3bb91UL, 0x36f78002UL, 0x85dfba94UL, 0xcfde7d74UL,
+       0x62df13f7UL, 0x87aecd0fUL, 0x5f299a98UL, 0x1b4b6763UL, 0x82b69aa4UL, 0x997c8419UL, 0x1f93eee5UL, 0x5a8da0e7UL),
+    SC(0x5dc11a79UL, 0x34d41b29UL, 0x5b384824UL, 0x89cc2fc6UL, 0xeae9c348UL, 0x02baf631UL, 0x94023e2bUL, 0x579b750fUL,
+       0xbc8719daUL, 0x924cd9dbUL, 0x901bd524UL, 0xa5eee1ebUL, 0xfc161286UL, 0x508e192cUL, 0x10f3b786UL, 0xf167057aUL),
+    SC(0x40f1348eUL, 0xa0032b45UL, 0x3f2b5339UL, 0x0d687a06UL, 0x03790503UL, 0xb4cc7b5eUL, 0x374828ddUL, 0x5374566aUL,
+       0xb7c04beeUL, 0x58dd65a2UL, 0xb5417ed7UL, 0x236557a9UL, 0x5d90f89fUL, 0x2f9be760UL, 0x408f3806UL, 0x5ec9c1f3UL),
+    SC(0x5bb43572UL, 0x6cfefc3fUL, 0xdfcc3a89UL, 0x3abe627aUL, 0x3bb9fe92UL, 0x2dc39256UL, 0x368b630aUL, 0x1bbc91c2UL,
+       0x4266fcb6UL, 0xcc3d664eUL, 0x72943e33UL, 0x3fc94db2UL, 0xb76b9b43UL, 0x1e5956a5UL, 0x5fcdb36bUL, 0x27d175a5UL),
+    SC(0xc61ca2a7UL, 0x48faba61UL, 0x93325019UL, 0xdde522a4UL, 0xb4ad7ffaUL, 0xffade4adUL, 0x84bc46beUL, 0x390d6833UL,
+       0x88fae1efUL, 0x1728b211UL, 0x6a24bf40UL, 0x7df169b8UL, 0x5987f26dUL, 0x75a86b84UL, 0x37b91bb5UL, 0x607b4effUL),
+    SC(0xebb9b8baUL, 0xc980a86bUL, 0x9955a450UL, 0x493875c1UL, 0x1bc446f5UL, 0xead71ef1UL, 0x8eeee3a2UL, 0xace3a417UL,
+       0x77aaae20UL, 0xa2959de0UL, 0x8b53b7adUL, 0x6434aa02UL, 0xf3c56deaUL, 0x0877d07bUL, 0xfdff41e0UL, 0xaa463b7eUL),
+    SC(0xfd3b8946UL, 0x296987d0UL, 0x22123898UL, 0xbffec5ecUL, 0xb1072fedUL, 0xc8e66617UL, 0xa8d1b00bUL, 0x6bbd9889UL,
+       0x54240cbcUL, 0x7512e6d4UL, 0x0744393aUL, 0x439e8b4eUL, 0x9973dc40UL, 0x34c68b72UL, 0xdf04ddb8UL, 0xb89e6acbUL),
+    SC(0x80aac570UL, 0x06eb40c4UL, 0xc6b5cdf8UL, 0xe25e5740UL, 0x3aadbc07UL, 0xf75b190aUL, 0x444ab53dUL, 0x4743ca1bUL,
+       0x196c7cc8UL, 0x3ce92b15UL, 0xba110e5aUL, 0xca1ca0b0UL, 0xc3205f61UL, 0xe58c1e4eUL, 0xfec5e957UL, 0x72274710UL),
+    SC(0x450df283UL, 0x6de16aa3UL, 0x3b893d69UL, 0x39c46224UL, 0x6ac30dabUL, 0x941be908UL, 0x42b3d5c0UL, 0x714f9670UL,
+       0x970c934dUL, 0x5b242d56UL, 0xb036b8d9UL, 0x4b1e8661UL, 0x45181ae3UL, 0xcd286bc2UL, 0x962035a0UL, 0xfd852a57UL),
+    SC(0x64c57089UL, 0x83eba9daUL, 0xd7871fb5UL, 0x064481b9UL, 0x12612c20UL, 0x4f2bfaf3UL, 0x635314c7UL, 0x3cc9bdb3UL,
+       0x7abcce5cUL, 0xfcfea03fUL, 0x74665734UL, 0x13a66116UL, 0xd6289badUL, 0x2209253dUL, 0x45e77ed4UL, 0xbae9a738UL),
+    SC(0x4692afdcUL, 0x34fd208cUL, 0x72726495UL, 0x7517fe0dUL, 0x0b463d39UL, 0x6ba454abUL, 0xc1b81898UL, 0xcd7343f8UL,
+       0x57b67c27UL, 0x8a0ab12bUL, 0x5eb4a55cUL, 0x933cb45aUL, 0xd6b5d955UL, 0x2110762bUL, 0x61fe79faUL, 0x0535a783UL),
+    SC(0x511415a6UL, 0x1371abd8UL, 0xc86d7fbeUL, 0x4adce11fUL, 0xf6cdf1bdUL, 0x330eb95cUL, 0x7c40ead7UL, 0xe5fca53eUL,
+       0x04adfb29UL, 0x87b9ac39UL, 0xbaefe7c8UL, 0x69aa931bUL, 0xc07fe15eUL, 0x05a5811bUL, 0x9add7b77UL, 0x1d56c8d9UL),
+    SC(0x4aee2f4aUL, 0xab479df9UL, 0xb2e1ed5eUL, 0x19230669UL, 0x0e15d153UL, 0x22b5472fUL, 0xc8b138fbUL, 0x7d542c30UL,
+       0x092c8e16UL, 0xfbea4d0bUL, 0x114a7d84UL, 0x292a9643UL, 0x6839624bUL, 0xdaaebfd3UL, 0x09d621f3UL, 0x7f8b141fUL),
+    SC(0x8c0bc6efUL, 0x25a255c9UL, 0x3816cea7UL, 0x599c39d7UL, 0x0acee681UL, 0x9373b82eUL, 0x96b81a43UL, 0xdd267223UL,
+       0x8ce9ad90UL, 0xe893c56cUL, 0xc0392afaUL, 0x24109c94UL, 0x2098b5c1UL, 0x15468b41UL, 0xe444568dUL, 0x09904efaUL)
+  },
+  {
+    SC(0x568b3e2aUL, 0x2db4792eUL, 0x4ef4ee66UL, 0x14e201f8UL, 0xa847fdcaUL, 0x38bb003bUL, 0xadb06d74UL, 0x1e4f999bUL,
+       0x7334b395UL, 0x61cbcce4UL, 0x49d83eedUL, 0x205a4c40UL, 0xd91d2751UL, 0x938ba7d0UL, 0x6ed9e5a5UL, 0xe1ffea7cUL),
+    SC(0x0ce433daUL, 0x719f5582UL, 0x6e69f248UL, 0x3c3db9dbUL, 0xde45e0ffUL, 0xfa2cace9UL, 0xf75cd210UL, 0x433fadafUL,
+       0xc296f641UL, 0x5200cb35UL, 0xcb8e1f23UL, 0x020b86ccUL, 0x9b341541UL, 0xb9256d77UL, 0xafe302c0UL, 0x1e2420eaUL),
+    SC(0xea19269eUL, 0x945625dcUL, 0x138b9e60UL, 0x249baee6UL, 0x8c63bbb7UL, 0x2b898569UL, 0x05459629UL, 0xfcc7ecf1UL,
+       0xf5a7bb81UL, 0x53552b33UL, 0x86deb8c0UL, 0x26d88504UL, 0xf6a85ac1UL, 0xb9290ef6UL, 0xf91c0278UL, 0x2cbb370bUL),
+    SC(0x19e8e269UL, 0xb972af70UL, 0xc61983cdUL, 0xcb7446f4UL, 0x23dc93fbUL, 0xb0e3d8baUL, 0x3fd02476UL, 0x0477e596UL,
+       0x3081973dUL, 0xf2123602UL, 0x770716d2UL, 0x6937f31dUL, 0xf0835148UL, 0x8c9d1375UL, 0xd2bfec67UL, 0x24df9c3aUL),
+    SC(0x4968feffUL, 0xd34e4649UL, 0x9ca759bcUL, 0x8e90d374UL, 0xde9e3199UL, 0xa13e2b04UL, 0x28a10df6UL, 0x15fb7696UL,
+       0x2936b2f5UL, 0x8491cc78UL, 0x38bdf347UL, 0xa4ee0b36UL, 0xdb288e5fUL, 0x09727980UL, 0x810c6eacUL, 0xa8d1edf9UL),
+    SC(0xd258654bUL, 0x45fe5366UL, 0x03552e85UL, 0xa7da0755UL, 0x0c4598ebUL, 0x68aa96d4UL, 0x624875b6UL, 0x580ea359UL,
+       0x052501a5UL, 0xe7d7d931UL, 0x417373ffUL, 0xce85e0fbUL, 0x43ef595bUL, 0x2056729eUL, 0x0b1daecbUL, 0x91998d1bUL),
+    SC(0xb86b0c06UL, 0x76f64537UL, 0xf9d38200UL, 0x66aeadadUL, 0x4f3b68b4UL, 0x2b5974e0UL, 0x9f218d81UL, 0xa547e04eUL,
+       0x52a0e4c2UL, 0xb827e0b6UL, 0x894ee674UL, 0x88a894f7UL, 0x577cf3f8UL, 0x0fe83ebcUL, 0x9e103a28UL, 0x3c054690UL),
+    SC(0x9212971dUL, 0xb38b95f4UL, 0xe7b9cae1UL, 0xf1519878UL, 0x80ca177fUL, 0x73adcd28UL, 0x0a6d03e8UL, 0xcefe9a31UL,
+       0x9ddd4828UL, 0x3b079a75UL, 0x74afcdd0UL, 0xe7cc4c24UL, 0x45a4e893UL, 0xddc2d2e5UL, 0xd24c413eUL, 0x9c676041UL),
+    SC(0x042a070dUL, 0x929191fbUL, 0xfb691944UL, 0xa311c931UL, 0x40740061UL, 0x2bf33de2UL, 0x809dcebaUL, 0xace68f50UL,
+       0x5429699eUL, 0x47e22e59UL, 0xb6cf8cc7UL, 0x0dbf2c81UL, 0x23d90d2bUL, 0xa48f6839UL, 0xdb4dd0c4UL, 0x7caf4412UL),
+    SC(0x895744c5UL, 0x5b460749UL, 0xa1e8b784UL, 0x19e8f6a2UL, 0x1e53f06aUL, 0xae99bb50UL, 0xdf9bd94fUL, 0xe1a20610UL,
+       0xa1ebffc6UL, 0xda8a497bUL, 0xbbc52ebcUL, 0x4de1f196UL, 0x881d88c1UL, 0x948b05caUL, 0x5b0641e8UL, 0xc56ab005UL),
+    SC(0xc9e8e6a1UL, 0x414b54f6UL, 0xc19e9ab4UL, 0xbd9bfee0UL, 0x86a3e8eaUL, 0x7a6b3e58UL, 0x80cc5988UL, 0x20fa512fUL,
+       0x6878f69aUL, 0x59a5be7fUL, 0x3e60c1b2UL, 0x6e9b9663UL, 0x9097a6eeUL, 0x7facc8e0UL, 0x0e242f56UL, 0xe9a2904aUL),
+    SC(0xdbf66722UL, 0x0d309634UL, 0x872fa8d4UL, 0xd9ddf8adUL, 0x2d198344UL, 0x041a8515UL, 0x7521b491UL, 0x1e9e3473UL,
+       0x1823095dUL, 0xdcf42369UL, 0x00f3ff23UL, 0xcb3a6ee5UL, 0x273b8f98UL, 0x7de2bff9UL, 0x67dbac10UL, 0x6b76928fUL),
+    SC(0xb133817cUL, 0xf965b7b2UL, 0xf5d80c05UL, 0xb82049b1UL, 0x464713a7UL, 0x7cc80d53UL, 0x1e930434UL, 0x0387ea7dUL,
+       0xdb03e202UL, 0x2eec1d26UL, 0x4cccb613UL, 0x7679c6e9UL, 0xe08ef66cUL, 0xf11378acUL, 0xadd8985cUL, 0x88f5e693UL),
+    SC(0xe198a2c6UL, 0x3f0bbde2UL, 0xf31b8d67UL, 0x776b8aedUL, 0xbb86ad58UL, 0xe2896a67UL, 0x11b5d5c0UL, 0xfd3a8d3eUL,
+       0xe8df361bUL, 0xef77d3d4UL, 0x4ca4f7d6UL, 0xc554fc2aUL, 0x9e2401baUL, 0x96769bf1UL, 0x0503b243UL, 0x8d8306b7UL),
+    SC(0x5f3ff8bfUL, 0x148ec6f7UL, 0x18aba1fdUL, 0x8ff0b37cUL, 0x18e440eeUL, 0x51beef26UL, 0x59652c0eUL, 0x39ab7255UL,
+       0x5da559a9UL, 0x40e22dcaUL, 0xbb4270d9UL, 0x31acb7b0UL, 0x2b19d7faUL, 0x3495abd6UL, 0xd5ca7f50UL, 0xd6281445UL),
+    SC(0x1e9ca439UL, 0xc93cd0b6UL, 0xd9886234UL, 0x105fc1b3UL, 0x178ba0b1UL, 0xc71742cdUL, 0x5c043ed5UL, 0x056045c5UL,
+       0xf7d31c2aUL, 0x1890f586UL, 0x214371c9UL, 0x77501788UL, 0xcf162d88UL, 0x641a5540UL, 0x00c49ce4UL, 0x323f3ad8UL)
+  },
+  {
+    SC(0x7c32fcd7UL, 0x13305cc7UL, 0x44fc4ff5UL, 0x2d315e2dUL, 0xd4cdf7c0UL, 0x31b41a64UL, 0xdb6ecbf9UL, 0xfd4edcbbUL,
+       0x7f002bf7UL, 0xb8e1b8f4UL, 0x0a4a4f2bUL, 0x1922983eUL, 0xfb901e13UL, 0x59cbe934UL, 0x8a31d91bUL, 0x7bc86bf4UL),
+    SC(0xd8aebd7aUL, 0xdb0ece5bUL, 0xff422046UL, 0x6856ea0aUL, 0x6446862aUL, 0x4d0a94efUL, 0xac7327a3UL, 0xacb201abUL,
+       0x6e96ecfaUL, 0xe9697649UL, 0xfaff155dUL, 0xcd01bc34UL, 0x0e6c8630UL, 0x616dd143UL, 0x01c816c4UL, 0x9d1168d7UL),
+    SC(0x7dd764e9UL, 0x40746adbUL, 0xe6dc9e23UL, 0xf113209cUL, 0x7fa75c21UL, 0x7da4cbc0UL, 0xdbe257f3UL, 0xcc0e3064UL,
+       0x97e244c1UL, 0xa0c8d68aUL, 0xfc7a3192UL, 0xb1f029e8UL, 0xdbc41d85UL, 0x8e0b273eUL, 0x0c4eff27UL, 0x97e63ce0UL),
+    SC(0x394a3fb7UL, 0x320acea1UL, 0xcf99bdebUL, 0xfe686508UL, 0x15b3b06aUL, 0x500df196UL, 0xc05459cbUL, 0x80b7781aUL,
+       0xec88e635UL, 0x9615da20UL, 0xcdb6a16aUL, 0x0245c694UL, 0x0ff550cfUL, 0xcfaf2939UL, 0x39103517UL, 0x653f8986UL),
+    SC(0xa394cc44UL, 0xe64c4b5dUL, 0xb36b4dadUL, 0xd0a458eaUL, 0x9c760e80UL, 0x342b99f7UL, 0x5227e22fUL, 0x6acb0de6UL,
+       0xde19b475UL, 0x9fe10976UL, 0xe9f38b74UL, 0x1738b12fUL, 0xe69df952UL, 0x26c20d19UL, 0x005f9135UL, 0x33458682UL),
+    SC(0x1277835bUL, 0x322b7118UL, 0x9ea416a4UL, 0xc9a51518UL, 0x0e3a42d8UL, 0x419f723bUL, 0xd2b242ecUL, 0xf904e26eUL,
+       0xce764cd2UL, 0x558ffc31UL, 0x779f610eUL, 0xb33be553UL, 0xa80a0dd0UL, 0x1136132cUL, 0x6e84b142UL, 0xe5f5a8b9UL),
+    SC(0x7c7527c3UL, 0xca6c3b60UL, 0x18d6af7cUL, 0x9ad79f0dUL, 0x461e3d0aUL, 0xc426e0a8UL, 0x3bc1610aUL, 0x80897370UL,
+       0xfa7dc6afUL, 0x7682554bUL, 0x09c6f4b9UL, 0x3822bd91UL, 0x46bdae61UL, 0x88fd2626UL, 0x6f13af48UL, 0x55ab23d6UL),
+    SC(0xaa59dd0aUL, 0x2e342733UL, 0xa151e156UL, 0xa82d63c8UL, 0x9e992530UL, 0x7bd774d5UL, 0xd08c327dUL, 0x27409a89UL,
+       0xf14bb267UL, 0x18ee5ac4UL, 0x44390439UL, 0xb8727f1aUL, 0xf5b62326UL, 0xfbdfb36eUL, 0x23ff2f08UL, 0x3a60e223UL),
+    SC(0x733fa3ddUL, 0x25e41c7cUL, 0x4e548de1UL, 0x17572b87UL, 0x31bcfb22UL, 0x57f0b822UL, 0x1be31943UL, 0x4bc2560cUL,
+       0x976fc63cUL, 0xe29bf97cUL, 0x499e220bUL, 0x80bc48d7UL, 0x1fc07e4fUL, 0x27afbe03UL, 0xfb4a610eUL, 0xe79bf820UL),
+    SC(0xd6bf5a3bUL, 0xee8b720dUL, 0x266586ccUL, 0x70fc5518UL, 0xa577cb70UL, 0x044dc30fUL, 0x210912c9UL, 0xf1609bddUL,
+       0xbbb5bd29UL, 0x290cf1b4UL, 0x28fd9150UL, 0xdb667219UL, 0x878b1507UL, 0x121c6fe5UL, 0xb1730f05UL, 0x474f98a5UL),
+    SC(0xb3a7824bUL, 0x4da122ceUL, 0x01120fa6UL, 0xf5046205UL, 0xe2989b8dUL, 0x7c4bc118UL, 0x0d540c91UL, 0xab1e4b30UL,
+       0xc7e452d5UL, 0xd23ab126UL, 0x28301b38UL, 0xd2286c89UL, 0x87d402a7UL, 0x7b5f1fa9UL, 0xac033675UL, 0x4f4461b1UL),
+    SC(0x383beab6UL, 0xdccedb68UL, 0xd6c461bbUL, 0xdffd27f7UL, 0x1dee3acdUL, 0x2d9bfc78UL, 0xf9c723dbUL, 0x2df57ee3UL,
+       0x913f9d57UL, 0x286e287cUL, 0x594a99deUL, 0xf59ee375UL, 0xc8d5fa1aUL, 0xca9db39dUL, 0x6397d1f4UL, 0xac524650UL),
+    SC(0x1de5be5bUL, 0x6fd264a3UL, 0xf9445660UL, 0x0995afa2UL, 0x39587660UL, 0x9d224d8dUL, 0x6d02e600UL, 0x4e7f74c0UL,
+       0xf3abf699UL, 0xaf7033f6UL, 0x0cee828eUL, 0x3bcbdeb8UL, 0xfcdbba9dUL, 0xd0f76121UL, 0xa77f1e9aUL, 0xcc65c1fdUL),
+    SC(0x787be997UL, 0xf12fb2edUL, 0x744bf579UL, 0xeaf42eadUL, 0x86d36029UL, 0xe3063ab0UL, 0x78e1c932UL, 0xda1896edUL,
+       0xd652cb82UL, 0x020ea596UL, 0x70a51612UL, 0x71249ce0UL, 0x62e5c584UL, 0xbbfc385eUL, 0x622d7e0aUL, 0x46a243c6UL),
+    SC(0xf5870f7cUL, 0x4dc65314UL, 0x8c4ffaeaUL, 0x79154e05UL, 0x1fcd6769UL, 0x54939f5eUL, 0x0cc33779UL, 0xf99634abUL,
+       0xfdb57c99UL, 0x9d115b59UL, 0x6d77bf19UL, 0xe42ea2b7UL, 0xc0dbf4c1UL, 0x0acccf2cUL, 0xef82949aUL, 0x2895ef3dUL),
+    SC(0x721a5aaaUL, 0xc5bf9886UL, 0x543b1e42UL, 0xaff4c222UL, 0xc6a63847UL, 0xdf9d72bfUL, 0x7feb57a5UL, 0x0a007e26UL,
+       0x94fb4bb8UL, 0xfb1f945aUL, 0x0d53dd78UL, 0x82f6a789UL, 0xab0dd874UL, 0x9d1621ceUL, 0x38bfa0e5UL, 0x5b50bab6UL)
+  },
+  {
+    SC(0x29d70da5UL, 0x92094c96UL, 0xe293c115UL, 0x42b9dbabUL, 0xb30df8dbUL, 0xac98416bUL, 0x65b0b75bUL, 0xb3ca446eUL,
+       0xa8a5aa3cUL, 0xc3269596UL, 0xdd8a9d98UL, 0x87a3b772UL, 0xefa1c668UL, 0x3f8a947fUL, 0xff80c662UL, 0x31c70799UL),
+    SC(0x357c14b5UL, 0x2c0eb735UL, 0x74f675f9UL, 0xcd9ba0eaUL, 0x9d0b5334UL, 0x0d7cd5dcUL, 0xa8d6cfb1UL, 0x1359a86eUL,
+       0x85ad0fbfUL, 0x09b2f48fUL, 0x86fa016dUL, 0x89824a4dUL, 0xeed06ad8UL, 0x3db7340fUL, 0x986cc8adUL, 0xebe9b5eaUL),
+    SC(0x72047bc0UL, 0x29b36192UL, 0xb1549087UL, 0x5e360270UL, 0xa7fecd3eUL, 0x1ebe8815UL, 0x61e7e0e9UL, 0x2ecc6973UL,
+       0x7d1153b9UL, 0x54ec6a42UL, 0x3df1157fUL, 0xfc9d413cUL, 0xf8c3837bUL, 0xd4c84bc0UL, 0x40ee5654UL, 0x6ec95d2eUL),
+    SC(0xa459ac94UL, 0x974bb47aUL, 0x8e5d3ba9UL, 0x169e7327UL, 0x349ad551UL, 0xba8ad12cUL, 0xfb4e15bcUL, 0xd4894e91UL,
+       0x699eedc9UL, 0xaeb4bc3dUL, 0xcdb97dceUL, 0x2ca019e7UL, 0x218ab0afUL, 0x2790bf80UL, 0xc59ba156UL, 0x9cbb8c74UL),
+    SC(0x0e6f35f3UL, 0x4a17a4a0UL, 0x0a76d997UL, 0xafd9a480UL, 0xbf8ef1e4UL, 0x29441d2fUL, 0xbd9f9d2dUL, 0xb3b93bf1UL,
+       0x67feedbcUL, 0xde8e075eUL, 0xfb80a4d9UL, 0x2959104eUL, 0xa990d813UL, 0x2b0d395cUL, 0x8e893212UL, 0xd47a2047UL),
+    SC(0x88924114UL, 0x3997a2efUL, 0x1e36bc46UL, 0x7e7f2fd0UL, 0x52fb02f9UL, 0xcd79f4b5UL, 0xe6ddc9c8UL, 0x51e26aacUL,
+       0x3b1ba5f4UL, 0x8b0a89ffUL, 0xa4ce1113UL, 0x934d11dbUL, 0x26b88e8bUL, 0x2eae3680UL, 0x57048db5UL, 0xe5488936UL),
+    SC(0x9ece7680UL, 0x448a953eUL, 0x5469839aUL, 0x12fd31f4UL, 0xf6d07a2dUL, 0x434159abUL, 0x414bf7ddUL, 0x60d783e5UL,
+       0x2d60b5b2UL, 0x0e6966e5UL, 0x7969016dUL, 0x74059dadUL, 0xc03cc7aeUL, 0xf7b80825UL, 0x9a629041UL, 0xe0cb1b1fUL),
+    SC(0xaa98d665UL, 0x0de5df68UL, 0x9e7d323eUL, 0x0943d411UL, 0xe98db3fbUL, 0x51124855UL, 0x256d0b00UL, 0x579caf90UL,
+       0xab791e6cUL, 0xebca5631UL, 0x22965594UL, 0xb52b43c9UL, 0x5f323834UL, 0x53b37368UL, 0x0281c895UL, 0x7d1226e2UL),
+    SC(0x306bf517UL, 0xc30d81fbUL, 0x1d931b26UL, 0x49af7c70UL, 0x87246821UL, 0x8562e255UL, 0x42576f53UL, 0x2ab4e48bUL,
+       0xd0d15fa8UL, 0x1391438aUL, 0x5416f0e7UL, 0x1c7b9ca4UL, 0x512fc802UL, 0xd4c46a4bUL, 0x779cb1d5UL, 0x2842059bUL),
+    SC(0x2c8ed21aUL, 0xfb154f9cUL, 0xc3e9a6d8UL, 0xdd047af9UL, 0xc124e6d2UL, 0x46da9faaUL, 0x36a580ceUL, 0x91b1788cUL,
+       0x7dda9e28UL, 0x6803924cUL, 0xd8ce710bUL, 0xd68e0a85UL, 0xfc2f8678UL, 0x45258f99UL, 0x43bbeb2eUL, 0xf6a7528eUL),
+    SC(0x4acfe8f4UL, 0x6ea97663UL, 0x56ecb2e1UL, 0xc3055379UL, 0xcb4a311eUL, 0x7e4dfe9fUL, 0x642fbfb4UL, 0x18abf5fdUL,
+       0xa5d6abd0UL, 0xd44bc614UL, 0xddf25ec4UL, 0x24526070UL, 0x100873e7UL, 0xc4501c65UL, 0xc3045e24UL, 0x7478c836UL),
+    SC(0xf7b1d348UL, 0x378a094cUL, 0x3e8ccc30UL, 0x3dd8ca52UL, 0x0fcfa019UL, 0x24c52fd7UL, 0x32544a40UL, 0xcf47d783UL,
+       0xb92c436aUL, 0x8c7e7ca6UL, 0x6dfc1223UL, 0xc7fad4c3UL, 0xc65aa955UL, 0xb8ce913bUL, 0x45437e54UL, 0x9dbbd1c7UL),
+    SC(0x1ea80a5cUL, 0x38827511UL, 0x69cb24f8UL, 0x064f4c1dUL, 0xa78f4dd4UL, 0x6509a73cUL, 0x381627a1UL, 0x7862ab8aUL,
+       0x126c7a44UL, 0x5fd6d3a8UL, 0xf57a3a55UL, 0x4fbe3f1cUL, 0xeb9bde07UL, 0x99afad93UL, 0x0fd7aa6aUL, 0x11a0dd16UL),
+    SC(0xe76aaeb3UL, 0x9cc18870UL, 0x6067a0f6UL, 0x54bc317bUL, 0x89a72313UL, 0x2b2bf079UL, 0x9ee88af0UL, 0x41597d5eUL,
+       0x6d75f6aaUL, 0x19727219UL, 0xea7f6f57UL, 0xc0a7d801UL, 0x3b9bf256UL, 0xd8764219UL, 0xd261b79bUL, 0x48ad6108UL),
+    SC(0xc6d1b9acUL, 0xf9fec422UL, 0xe89102aeUL, 0x4fa07021UL, 0xe6c81049UL, 0xdd1e66d1UL, 0xd0903ad9UL, 0x0e072398UL,
+       0x2e971363UL, 0x41b318a4UL, 0xdfc4e5b9UL, 0x31a79f35UL, 0xf90e673cUL, 0x6bb7aa17UL, 0xa2ec5f35UL, 0xdef14ff9UL),
+    SC(0x0d9faf06UL, 0xba5bd56bUL, 0xee78db82UL, 0x4db777bcUL, 0xe57aa5ceUL, 0x5c4b98ffUL, 0x8c736164UL, 0xd4d8b2dcUL,
+       0x97af746bUL, 0xfb890c20UL, 0x7af10658UL, 0x38d9b850UL, 0x2d8d0524UL, 0x7a5592e2UL, 0x89f6ffecUL, 0xa66c5168UL)
+  },
+  {
+    SC(0x7885bb79UL, 0x25196ae6UL, 0xf45b6658UL, 0x0f3c04f5UL, 0xa3b76cb6UL, 0x1d60eaf2UL, 0x45cb35c2UL, 0x2552267aUL,
+       0x9839aae2UL, 0xb4d9de01UL, 0x1a119d3aUL, 0xd269a821UL, 0xdd88d287UL, 0x2f031910UL, 0xa2f3cc22UL, 0x2e8555a7UL),
+    SC(0xfac317d2UL, 0xcb5e27e7UL, 0x74deba28UL, 0xd3c2cf69UL, 0x4364a190UL, 0x329787bcUL, 0xe325d80bUL, 0x150c9fbdUL,
+       0xc56d5053UL, 0xb0a73378UL, 0xb0d5fbf7UL, 0x940ac348UL, 0xabb46107UL, 0x1b9f0100UL, 0xc721154aUL, 0x4d084e7eUL),
+    SC(0x9ed46b01UL, 0xf4e56c79UL, 0x9b3f582eUL, 0x2e35434aUL, 0x25ec32e6UL, 0xab497137UL, 0x6eba881eUL, 0x7ca96ad4UL,
+       0x5e8d2e27UL, 0x96b8dc65UL, 0x867f45bbUL, 0xa623c59bUL, 0xa365d840UL, 0x1d9e889cUL, 0x23d6acd8UL, 0xd5bfb365UL),
+    SC(0x6acaf24dUL, 0xfce1919fUL, 0xc8d8743dUL, 0x7a5b64d3UL, 0x3010a8e9UL, 0xcb6340e9UL, 0x7400d143UL, 0x53620af4UL,
+       0xb767f30aUL, 0x87b29f8eUL, 0x308a95b9UL, 0x6848eb5dUL, 0xc8bada19UL, 0x74cee095UL, 0x8fb75735UL, 0x86f1d733UL),
+    SC(0x1a2f9605UL, 0xfdb3e5e5UL, 0x3445c350UL, 0x4e550312UL, 0xb36a7dfeUL, 0x5df0dac2UL, 0x23aa53e5UL, 0xdcd7264eUL,
+       0xcc4b4a0aUL, 0x6febc03bUL, 0x155a755cUL, 0x187421afUL, 0x52a7e6ebUL, 0x2227858bUL, 0xc56b9febUL, 0x4befb45aUL),
+    SC(0x4fe527abUL, 0x42540438UL, 0x009d9afaUL, 0x2a1da83cUL, 0x968fe9c4UL, 0xf678256bUL, 0xd4998bb5UL, 0xaf963a2cUL,
+       0x066dea7bUL, 0x7e0540c4UL, 0x75799ec3UL, 0x3987a775UL, 0x6ae86d43UL, 0x56a295d0UL, 0xfe8242ccUL, 0x027ad7c4UL),
+    SC(0x0756ee16UL, 0xfd1019acUL, 0x30e50f18UL, 0x5606d1f5UL, 0xfa91a7a0UL, 0xb01329e6UL, 0x2a949c80UL, 0xb7590bbaUL,
+       0x4d190439UL, 0x98483880UL, 0x6323163aUL, 0x6cb23a8bUL, 0xe47152e5UL, 0xa5439d24UL, 0x513d30e0UL, 0x21511050UL),
+    SC(0x063935d2UL, 0x711ec4d9UL, 0xf33fb116UL, 0xce09ea58UL, 0xb45b29abUL, 0x79614b14UL, 0x278539b3UL, 0x4ac44e83UL,
+       0x703a7f21UL, 0xc47d413cUL, 0x09235fb0UL, 0x36a7b441UL, 0x87a90768UL, 0x2d435953UL, 0x439f0624UL, 0x6550944aUL),
+    SC(0xfb6bad0bUL, 0x3503cf55UL, 0x8a75531eUL, 0x9e8915dfUL, 0x9a88277bUL, 0xc766b37cUL, 0xd9685b58UL, 0xa91e3fedUL,
+       0x0483fedaUL, 0x8c214ac0UL, 0x92ba5274UL, 0x8b158b62UL, 0x03a0d541UL, 0x065fb5b0UL, 0x7ce07e58UL, 0x78cb39d4UL),
+    SC(0x30c7d349UL, 0xa9fd4825UL, 0x82fb09deUL, 0xf7d638b8UL, 0x633fca82UL, 0xb9bbd65cUL, 0xef8f6dcfUL, 0x1c8c05b2UL,
+       0x56c76d9dUL, 0x6df4bd0aUL, 0xa8030ddeUL, 0xa3839728UL, 0x71aada1bUL, 0x61bb34ccUL, 0x1eda08eeUL, 0xa14761aeUL),
+    SC(0x13faa439UL, 0xf73bb77dUL, 0xd2423e1cUL, 0x9989808fUL, 0x96d98080UL, 0xaf214cb2UL, 0xe0cde511UL, 0x9eba8a14UL,
+       0xef6ed341UL, 0x7ff03112UL, 0xece400dbUL, 0xb274d225UL, 0xbea30a63UL, 0xc9a063ccUL, 0x9a987827UL, 0xd3e380f0UL),
+    SC(0x42112f0dUL, 0x7628b3bbUL, 0x7a0e4f0aUL, 0x0eb58d2bUL, 0x9915f797UL, 0x10aca7e2UL, 0x67214532UL, 0x2ebf502cUL,
+       0xa1ad23faUL, 0xd76d983dUL, 0x6cc4a654UL, 0x95da8d6dUL, 0xc5372849UL, 0xd7fdcff1UL, 0x34e5903aUL, 0xe8441ce5UL),
+    SC(0xd23fef28UL, 0x114b49b9UL, 0x077faea5UL, 0x2bd0e30eUL, 0x6a9ef11bUL, 0xc513cb8fUL, 0x3107e04aUL, 0xe26a9cebUL,
+       0x5a4cd8b8UL, 0xb0dbab13UL, 0x2abc50afUL, 0xc9d700bbUL, 0xbc28dc84UL, 0x3c12060fUL, 0x612134f4UL, 0xfe40aea2UL),
+    SC(0x463bd8fdUL, 0x21ba250dUL, 0x1eee7500UL, 0xe88aefa8UL, 0x38211947UL, 0xfee2be73UL, 0xd6511300UL, 0x6d28b5daUL,
+       0x20f6f300UL, 0xe2744ea0UL, 0x1ed033c4UL, 0xb5b9e7b6UL, 0x707c06d4UL, 0xd97c4771UL, 0xad35e305UL, 0xb11aed86UL),
+    SC(0x21795062UL, 0xe337d1fdUL, 0x994a7cb9UL, 0x7407d33dUL, 0xf40ac1deUL, 0x4a585c1aUL, 0x2b3ad400UL, 0x8e03c4a8UL,
+       0xe93a4632UL, 0xda05b347UL, 0x8be71e28UL, 0xc55af8c6UL, 0xb4b161b8UL, 0x9f48064fUL, 0x31755a1cUL, 0xf6b0ed96UL),
+    SC(0xe8f77f4dUL, 0x0272c5ddUL, 0xf001f939UL, 0x4b658b96UL, 0xd58a54aaUL, 0xbccb9de2UL, 0xc501211cUL, 0x6cf9364bUL,
+       0x7044feedUL, 0x21d1dd9fUL, 0x80705bf3UL, 0xd68fd160UL, 0x31c02dc8UL, 0x5a708f18UL, 0x1bb7ce91UL, 0x8655ea61UL)
+  },
+  {
+    SC(0x0422f029UL, 0x1f51c4dfUL, 0xaf233322UL, 0x7015e4c1UL, 0xec8175b1UL, 0xa8ab6b2fUL, 0x60a9e291UL, 0x7242d940UL,
+       0x51ae32b0UL, 0x0ed5d39dUL, 0xe1d61437UL, 0x0d363d59UL, 0x181a68b6UL, 0x4e052bc5UL, 0x9d132da0UL, 0x9c1f422eUL),
+    SC(0xf560c762UL, 0xbe8f90f3UL, 0xb12c1447UL, 0x4c3a2d37UL, 0x53634a4dUL, 0x0fef3344UL, 0xba8e9a65UL, 0x1becd50eUL,
+       0x49bc8c46UL, 0xe3207440UL, 0x76082021UL, 0x6d203410UL, 0xfda33028UL, 0xd3ff4ee3UL, 0xaf065502UL, 0xec96609fUL),
+    SC(0xedc545efUL, 0x2402bc41UL, 0xc4d7b437UL, 0x65830ad7UL, 0xf79128d5UL, 0x91b4201dUL, 0x1acb5f90UL, 0xa7ea6a46UL,
+       0xec758c41UL, 0xe0ff7bb1UL, 0xfc28a91cUL, 0x435c09d9UL, 0x90338a6bUL, 0x216504d7UL, 0x0a538691UL, 0x6af80454UL),
+    SC(0x67709f77UL, 0xe324ec1aUL, 0xfb57e5feUL, 0x43215f07UL, 0x3cbd3d48UL, 0xf6cd0bbbUL, 0xc01f3ae4UL, 0x1a3c5905UL,
+       0xe65102d9UL, 0xc33abbc4UL, 0x82f2ed0fUL, 0xfb156cbcUL, 0x20210edaUL, 0x19b5b345UL, 0xf21150f3UL, 0xffb29e79UL),
+    SC(0x6b73d1beUL, 0xa5b5ffb5UL, 0x438e4cd8UL, 0x9af6d9c2UL, 0xbc41a2d6UL, 0xa9c6b405UL, 0xac6fe5d4UL, 0x6ff920cbUL,
+       0x084f7e06UL, 0x6dc9bde7UL, 0x782c7636UL, 0x8aed4a2fUL, 0xe570e51aUL, 0x8494864dUL, 0x88e6c1d0UL, 0xed732be9UL),
+    SC(0x5aa1e427UL, 0x64c4f0c8UL, 0x60423a6dUL, 0x54cccad7UL, 0x0f6093baUL, 0xb6a0e383UL, 0x9e1e0b63UL, 0xcd652121UL,
+       0x3245d2b0UL, 0xfe27d590UL, 0x15cac18aUL, 0x861d9ed4UL, 0xa5131871UL, 0x038faaaeUL, 0x4c01d1d7UL, 0x759fc9dcUL),
+    SC(0xa8460aa6UL, 0x9cd68695UL, 0x94288486UL, 0x01f92a61UL, 0x0e7e924fUL, 0x1d61b9beUL, 0x1d31f923UL, 0xefd803a6UL,
+       0xf6bf9b9bUL, 0xf65a68ebUL, 0x925f6c63UL, 0x4d16a6b5UL, 0x6d92d68fUL, 0xfb807084UL, 0x7f09c0d9UL, 0xd95b852aUL),
+    SC(0xfa3b7d59UL, 0xbcd32e9fUL, 0xa4cee765UL, 0xd9b54c1cUL, 0x65d8cf67UL, 0x8a88f6e5UL, 0x3c3192e1UL, 0x64143cc7UL,
+       0x95ed2300UL, 0x2f55b1c2UL, 0x21061dc9UL, 0xbd26f0edUL, 0x82c05ee9UL, 0x4bcf1badUL, 0x3bf878e1UL, 0x3ff33b84UL),
+    SC(0xfebd5d39UL, 0x68446d45UL, 0xfe1daf28UL, 0x2018c980UL, 0xf4a5030cUL, 0x7710edfdUL, 0xb79daa69UL, 0xc10f2296UL,
+       0xb8c37c65UL, 0xbc7c42a0UL, 0x65be333dUL, 0x1827febaUL, 0x70eb75f3UL, 0x5f289e1eUL, 0x413e2325UL, 0x5ab9d551UL),
+    SC(0x9d696bb4UL, 0x4dbff608UL, 0xaf3ba93aUL, 0xe98993e7UL, 0x4a6d8902UL, 0x42d406a1UL, 0x7ae9c609UL, 0x6bb9b29eUL,
+       0xd92c5408UL, 0xc0ec7131UL, 0x9efb50d6UL, 0x18875060UL, 0xda65855dUL, 0x8b2d1cc0UL, 0x9f07f3e8UL, 0xc0e1d77dUL),
+    SC(0x8f4c98ccUL, 0x21d39520UL, 0xe837b075UL, 0x479b8646UL, 0x2837665aUL, 0xac82541dUL, 0x1bdda842UL, 0xca5c2562UL,
+       0x3de70692UL, 0xafbdd878UL, 0x5a858fe5UL, 0x51321576UL, 0x095f464eUL, 0xcf2c1237UL, 0x545b1e06UL, 0xa1cbbe6eUL),
+    SC(0x6d31e611UL, 0x2317acb5UL, 0xf2ebfc35UL, 0xa4f66f05UL, 0xaf86ed84UL, 0x720335ecUL, 0x535c0f5aUL, 0xcd14d952UL,
+       0x8d22c3d8UL, 0x32324673UL, 0x9b20d9b3UL, 0x7fc73b78UL, 0xfdaf98a9UL, 0x6cded077UL, 0x6e561037UL, 0xb2a85b1bUL),
+    SC(0xdc891a7bUL, 0x0d96f10fUL, 0xb6d8fe8cUL, 0x1c749ea0UL, 0x328ad2e1UL, 0x353b49a9UL, 0x8056c5c5UL, 0xb637df01UL,
+       0x475aca0dUL, 0xc67d1f8fUL, 0x92f6ffeaUL, 0x20c48300UL, 0x2b0f7d3fUL, 0xf5d2526aUL, 0xcbd8b89fUL, 0x25ed3eedUL),
+    SC(0xc77ede67UL, 0x1432ef33UL, 0x73af321dUL, 0x7d8fc6c0UL, 0xf254aaa8UL, 0x37feb14fUL, 0x34817740UL, 0x0a54cb5bUL,
+       0xec2f427aUL, 0xcbb9cd4dUL, 0x96f83c7aUL, 0x450efa09UL, 0x6e12917aUL, 0x122eb466UL, 0x23c6b63eUL, 0xdba11010UL),
+    SC(0x7334718aUL, 0xcb39692aUL, 0x91c140faUL, 0x67c21c0cUL, 0xda368242UL, 0xaa1d0d2dUL, 0x7223a0d8UL, 0x5ce102c3UL,
+       0xe3051cf3UL, 0x4d5e51e3UL, 0x901449a9UL, 0x3595fcb4UL, 0x327c59bcUL, 0x1e2d92cdUL, 0x4d4699c2UL, 0x26ae4e84UL),
+    SC(0x23c7e5d2UL, 0x2b0bab9bUL, 0xb95fbfe2UL, 0xe39e6902UL, 0x5c7bcc89UL, 0xfad1a0beUL, 0x1f5da48eUL, 0x74b3f622UL,
+       0xbc5a3ef3UL, 0xc4679a16UL, 0xba09f2efUL, 0x4fb202a7UL, 0x83257a5bUL, 0x3f95b629UL, 0x455e4173UL, 0x9b5b317fUL)
+  },
+  {
+    SC(0x43cf2273UL, 0xe372157cUL, 0x02180640UL, 0x594c144cUL, 0x93f64fa1UL, 0x75f28cd2UL, 0x5e7efebbUL, 0x14028a93UL,
+       0x1f8b092dUL, 0x4cabc600UL, 0x33782374UL, 0x10eafd04UL, 0x37d6436fUL, 0x06064932UL, 0x06f8de6dUL, 0x94059d4eUL),
+    SC(0x83bf8ee2UL, 0x2a69edf4UL, 0x74e5b45eUL, 0x50aa0bdfUL, 0x4879b4d9UL, 0x61d4b937UL, 0x00ab18d3UL, 0x7869fe5eUL,
+       0x296e8081UL, 0xcb72663bUL, 0x5223c040UL, 0xa64c7aa5UL, 0x273fc6ceUL, 0x70261af9UL, 0xcb3e071aUL, 0x79b7c3acUL),
+    SC(0x66b8e44eUL, 0xc913698eUL, 0xd68f3b1aUL, 0xdf750442UL, 0x442a4376UL, 0x9ebe7859UL, 0x84e4d233UL, 0x9f666b1bUL,
+       0xb09c7c2fUL, 0x852bae4dUL, 0xf90bcaafUL, 0xa664c792UL, 0xee88ac87UL, 0x2d2e046dUL, 0xaa6009b2UL, 0x2412af94UL),
+    SC(0xfea69879UL, 0xe4eeadf9UL, 0x275589ddUL, 0x6339111eUL, 0x5d29c581UL, 0x30f22fb7UL, 0xc6755d5bUL, 0x2f5840f7UL,
+       0x814a6766UL, 0x65b54689UL, 0xb3e2d415UL, 0x4519bc8cUL, 0x9676cf4eUL, 0x91b928efUL, 0x3586da12UL, 0x0416f546UL),
+    SC(0xbd147b40UL, 0x5c3ca694UL, 0xceb4fe83UL, 0x5f95676cUL, 0x5428a065UL, 0xadd89f79UL, 0xac5859c9UL, 0x7dc4d5feUL,
+       0x67544f50UL, 0xa639f7a0UL, 0x602a5fdfUL, 0x2d425fb3UL, 0xedea0cddUL, 0xf2cc5f9bUL, 0xc61189bbUL, 0x79cfbf58UL),
+    SC(0xb3806514UL, 0x838f93cfUL, 0x06118c8eUL, 0xf759cf82UL, 0x394bab94UL, 0xe020ca33UL, 0x7d20c8daUL, 0xbb61c79dUL,
+       0xbf4c1bc7UL, 0x35c5a806UL, 0xd682a1feUL, 0x239a1027UL, 0x51a547f1UL, 0x7d1d87faUL, 0x59c9384eUL, 0x3ca1fe45UL),
+    SC(0xbb002b37UL, 0x60adf886UL, 0xa89d4ba3UL, 0x23c17868UL, 0x83f0f3ddUL, 0xfd4232f1UL, 0x28410770UL, 0x563ba5eaUL,
+       0x4aca65b6UL, 0x68115f32UL, 0x186773d8UL, 0x41c061d6UL, 0x8d4a860cUL, 0x442b3f8bUL, 0xc72776b8UL, 0x3bcd22dbUL),
+    SC(0x7857b661UL, 0x420c4251UL, 0x3db90fadUL, 0xab97bfe1UL, 0x9a1e3f91UL, 0x5d524f66UL, 0x86d0cc01UL, 0x070652acUL,
+       0x75205776UL, 0x8c2e420cUL, 0xf255f9b0UL, 0xdf58bf4cUL, 0x39316f63UL, 0x612711c1UL, 0xfc7fe5c0UL, 0x0b4e7ef7UL),
+    SC(0xcd386b61UL, 0xbfbd43e5UL, 0x109b74f0UL, 0x5d765ed0UL, 0x5c4ceac7UL, 0x85bff4a3UL, 0xc8386ca9UL, 0x54fb4553UL,
+       0xaeef237eUL, 0x892a3a1bUL, 0x84183222UL, 0x091f9119UL, 0x64bc7240UL, 0x2f32da46UL, 0x47a159dcUL, 0x4a7d6611UL),
+    SC(0x94dcee6dUL, 0xe36b346dUL, 0x4dfb5ad6UL, 0x3f488761UL, 0x2a5734aeUL, 0xe251b07dUL, 0x6f81a3cbUL, 0x7d255409UL,
+       0x3265f73cUL, 0xaf4ef3f0UL, 0x40919637UL, 0x4e273be7UL, 0xc0588085UL, 0x1940bdc9UL, 0x9d0ab66cUL, 0xc488e203UL),
+    SC(0x53199671UL, 0x628f4a30UL, 0x89e65e28UL, 0x67489a1cUL, 0x7f29c9a8UL, 0x0a34fe8aUL, 0xc144623fUL, 0x9ef9fc4bUL,
+       0x45740e72UL, 0x3b787de5UL, 0x1ddf66dbUL, 0x96c91bbdUL, 0x19954170UL, 0x62fed0d9UL, 0x69522916UL, 0x7b2b10aaUL),
+    SC(0x38596053UL, 0x40ae3e91UL, 0xd005b3e2UL, 0x3a998796UL, 0x195a5c5aUL, 0x81b24286UL, 0x458cb7e8UL, 0xec905e3dUL,
+       0x5484588eUL, 0xc9dc9485UL, 0xbce07479UL, 0xb1dfe9d5UL, 0xc5007d9bUL, 0x0eb7c372UL, 0xf52e526fUL, 0x07627131UL),
+    SC(0x594e1bd2UL, 0x3a5ced9aUL, 0x98e48bdfUL, 0xdde40807UL, 0xb9c2871fUL, 0x79e1948dUL, 0x07167b59UL, 0x9ffecc53UL,
+       0x01d7fcd4UL, 0xbb9bf0efUL, 0xe0af9ed9UL, 0x8da3e36bUL, 0x2ceb0ea9UL, 0xe1e3358fUL, 0x4a590022UL, 0xf5c530eaUL),
+    SC(0xbef8b23fUL, 0x95e0bdbdUL, 0x3c0ba1fdUL, 0x7afb8a58UL, 0x1f038e23UL, 0xe3e9eac2UL, 0xb8848a08UL, 0x6f23f816UL,
+       0x9a234d55UL, 0xf9c810b1UL, 0xafff2a1eUL, 0xb1738d18UL, 0x4308d19dUL, 0x11a0e1ecUL, 0xcc571eaaUL, 0xb9663c26UL),
+    SC(0x632003fcUL, 0xf53c8833UL, 0x5542f216UL, 0xe4020ef5UL, 0x3eb225a4UL, 0xbe6c0e59UL, 0xb92ebfe6UL, 0x52721652UL,
+       0xbb4d2dc2UL, 0xf255b8d2UL, 0x5c1803b8UL, 0x88f40d8bUL, 0xbbe6b2d9UL, 0xf6754511UL, 0x8264f809UL, 0xcbd61844UL),
+    SC(0xb7ae730aUL, 0xe74aa208UL, 0x9f3266b1UL, 0x5358369cUL, 0x4970c009UL, 0xe6318581UL, 0x4d541b07UL, 0xc6c80a96UL,
+       0x43a7b349UL, 0x66b4bd5cUL, 0xa1e45593UL, 0x42642d35UL, 0xebc969daUL, 0x0544d4ccUL, 0x65519915UL, 0x34e80d65UL)
+  },
+  {
+    SC(0x9f10aba7UL, 0x5a7b9fa0UL, 0x233bf53cUL, 0xd819ba2dUL, 0x919f8acfUL, 0x9a5e6717UL, 0x2c93229dUL, 0x547a40bdUL,
+       0x85485295UL, 0x254a4456UL, 0x87b065aaUL, 0xdad21f32UL, 0xb31735e1UL, 0x96333fb8UL, 0x11117a00UL, 0xd0bf2361UL),
+    SC(0x75f8bcf3UL, 0x831197e8UL, 0xb9053c1eUL, 0x5194155eUL, 0xdae1867dUL, 0x52f74911UL, 0xa478085bUL, 0x52d916b4UL,
+       0x90448c24UL, 0x35180385UL, 0xa15a335dUL, 0xa33af722UL, 0xc9a395a7UL, 0x16937aa6UL, 0xb861aee5UL, 0xb0b9567dUL),
+    SC(0x2c05f980UL, 0x7e24fd5eUL, 0x87e4562dUL, 0x65aeee0eUL, 0x315ebc12UL, 0x35731606UL, 0x81e99bc6UL, 0x0be544c8UL,
+       0x3a3c9e33UL, 0x2e78cb5cUL, 0x8ae90d20UL, 0xedfc9eb0UL, 0x3ba0ee07UL, 0x82a158b9UL, 0x154999f9UL, 0x55e89210UL),
+    SC(0xc8ff77e3UL, 0x76a2c4ceUL, 0x46664e1dUL, 0xb33f281bUL, 0x90e34103UL, 0x500a9a46UL, 0x83038062UL, 0x42e59969UL,
+       0x1d609bf6UL, 0x2f6d3e86UL, 0xc0510de8UL, 0x4a42a45bUL, 0x3fdaedd3UL, 0x77101216UL, 0xe43c2d86UL, 0x751d7456UL),
+    SC(0xb3205953UL, 0xaa71cd5cUL, 0x88ef7e55UL, 0x3b94c8e3UL, 0xec4fd654UL, 0xb7524c80UL, 0x51908174UL, 0x32850864UL,
+       0x2c5d67ddUL, 0x479dcdf3UL, 0x41db7c5aUL, 0xe0d03776UL, 0xf3fe9eceUL, 0x032dcda0UL, 0x274a7955UL, 0xb45edae3UL),
+    SC(0xcb903c76UL, 0x7ad3cd58UL, 0x66c66429UL, 0x9e9d07f1UL, 0x0cd35043UL, 0x66784cd1UL, 0xaf3fc75bUL, 0x73c4499eUL,
+       0x8ef65e96UL, 0xf1998688UL, 0x2af0feddUL, 0xe0266d80UL, 0x780ec031UL, 0xfa47cc38UL, 0x9e7bd059UL, 0x0eac83baUL),
+    SC(0x1a975b06UL, 0x09e3f032UL, 0x7fa9b706UL, 0x3533fee9UL, 0xf72c6c11UL, 0x7ece27e9UL, 0xcc83934dUL, 0xa0c5d1e6UL,
+       0x2cf46c5bUL, 0x9f3596d9UL, 0x5739dae3UL, 0xa87564f6UL, 0x13eb944cUL, 0x5d1b6da5UL, 0x03be8d76UL, 0x14ddccf9UL),
+    SC(0xd708ccf9UL, 0x4dd50c89UL, 0xde00a127UL, 0x1cbd92bfUL, 0x29f440b6UL, 0x401c28feUL, 0x699f6f6eUL, 0x50e0367fUL,
+       0xfb173384UL, 0xe0463978UL, 0xa15de0eaUL, 0x2ce146d7UL, 0xb826f6a2UL, 0x616d38abUL, 0xae0a3dcfUL, 0x01e11a1eUL),
+    SC(0x11d850b5UL, 0x4aa10ef7UL, 0x8959f5dcUL, 0x4aa9ce13UL, 0x8ffa25cbUL, 0x1034a365UL, 0x234d0f6bUL, 0x46458146UL,
+       0x033162f6UL, 0xbbb5ce33UL, 0xaf19cdafUL, 0x57dc82ecUL, 0x69291c12UL, 0x38e8f266UL, 0xfd0becb0UL, 0xbab02e8fUL),
+    SC(0x7cd60401UL, 0xbe3033a1UL, 0x85784a4bUL, 0xadf9dd84UL, 0xf4bfacc1UL, 0x952597f0UL, 0x6730f2d6UL, 0x924332a2UL,
+       0x6efade89UL, 0x37b517f2UL, 0xe1a1d41fUL, 0xd6e6c137UL, 0xd581d7a3UL, 0xb55ec632UL, 0x74ef8b87UL, 0x1d9dd370UL),
+    SC(0xbd82a0d8UL, 0x34892e4cUL, 0x0974aa93UL, 0xa64edeb0UL, 0x09aa2e3bUL, 0x16785166UL, 0xc970206bUL, 0x53ecf157UL,
+       0x541cd14bUL, 0x1fed321dUL, 0x5a044abeUL, 0xaa3bba7dUL, 0x74c3f44bUL, 0xdb3f1feeUL, 0xb05ddaa2UL, 0x1f034ac5UL),
+    SC(0x6f77bfc3UL, 0x760934c0UL, 0xedad8b77UL, 0xf56d6309UL, 0x179c8fd5UL, 0xbbb731dcUL, 0x042c279dUL, 0x89f99a44UL,
+       0x662854faUL, 0xe1da57eaUL, 0x7e8eeb13UL, 0xb3bf6744UL, 0xf28cd210UL, 0xed461edeUL, 0x7883dba7UL, 0xf7b59d6eUL),
+    SC(0xf31d35d4UL, 0xdd0b2e6fUL, 0x5b236e98UL, 0xdf56ca98UL, 0xa5b6db2bUL, 0xa2a8e0c4UL, 0xeba41ab3UL, 0x20cde154UL,
+       0xe33e127cUL, 0xb9c16469UL, 0x83d71085UL, 0xec7ec9aaUL, 0x12d41302UL, 0xfa769c61UL, 0x55af26efUL, 0xa7d1785eUL),
+    SC(0xc0ea3ba7UL, 0xbe2030c7UL, 0x790a3d48UL, 0x7e720893UL, 0x2e070691UL, 0x82bd0024UL, 0x5483be62UL, 0x7916eab3UL,
+       0xf5055e6fUL, 0x298bb6b8UL, 0x47e99275UL, 0x64cb29f6UL, 0x054d2131UL, 0x1ff0a3baUL, 0x20a89ef5UL, 0x992c0342UL),
+    SC(0x23a696b0UL, 0xe70e4197UL, 0xd299abd0UL, 0xb301b383UL, 0x3df6f123UL, 0x80120247UL, 0x9e8b59a6UL, 0x10a1fcf3UL,
+       0x3af29a3bUL, 0xce23b0ceUL, 0xafd9a25cUL, 0xf1505958UL, 0xb85d4f39UL, 0x318a402dUL, 0x0cc48f98UL, 0xea953edfUL),
+    SC(0xac79289dUL, 0xc14206beUL, 0x742005e5UL, 0xf367c4b9UL, 0xe2b645a1UL, 0x2c21d30fUL, 0xffeac884UL, 0xe6f888daUL,
+       0x27c49edeUL, 0x7c0b42cfUL, 0x91de7682UL, 0x0e6f224bUL, 0x2a19f98fUL, 0x72f40054UL, 0x69c3121eUL, 0xda2c4379UL)
+  },
+  {
+    SC(0xb365ce49UL, 0xd21ca341UL, 0xc173b6d7UL, 0x2238c56bUL, 0xf080d218UL, 0xa89e57c6UL, 0xce1664f6UL, 0x5c290a44UL,
+       0xe77935ddUL, 0x75d26531UL, 0xd4045f72UL, 0x3b4b5dc4UL, 0x06608f8bUL, 0x60f58989UL, 0xd2ac4002UL, 0xc304cf04UL),
+    SC(0xaf35612aUL, 0xd1230c6bUL, 0x3a260abbUL, 0x69cc7099UL, 0xf7025c1dUL, 0x2a14d196UL, 0x1914236eUL, 0x4d4e1a44UL,
+       0xb67d23d0UL, 0x8737e96eUL, 0x0f629634UL, 0x44b08f82UL, 0x822c690aUL, 0xb3d2838eUL, 0x46ba259fUL, 0xbb951b2fUL),
+    SC(0x183181caUL, 0x37069462UL, 0x5de3c48fUL, 0xb8140ce9UL, 0x84029874UL, 0xe8189b4eUL, 0xbcc8d91eUL, 0xeb8d681dUL,
+       0xa1780f41UL, 0x8e7f00e1UL, 0xe5ff8147UL, 0x33a34699UL, 0x79e6fd38UL, 0xbfc03491UL, 0x8acb042eUL, 0x6ef4d6deUL),
+    SC(0x4c1db656UL, 0x41753e4eUL, 0x5cf10f66UL, 0x9a3e4b06UL, 0x0e18b3d0UL, 0x1b56961dUL, 0x8c400ae5UL, 0x9ba239b8UL,
+       0xcc57dad5UL, 0x77b3d6c5UL, 0xd96109efUL, 0x1006e33fUL, 0x9c888598UL, 0xc7248f60UL, 0x5a531800UL, 0xdd0c957bUL),
+    SC(0xf0f61e45UL, 0xcbe01564UL, 0x17fdf9e6UL, 0xdb32d3b4UL, 0x84fa0bbbUL, 0x4be30aeaUL, 0x95dfc8eaUL, 0x31529ee8UL,
+       0x4b0de888UL, 0xb71c441aUL, 0x1c54849cUL, 0x7e4a8129UL, 0xd757213eUL, 0x52b1796eUL, 0xa5ab02a7UL, 0x87087757UL),
+    SC(0x84e4bc99UL, 0x7066633cUL, 0xa3997a55UL, 0xa3fd3ef1UL, 0xb4b99302UL, 0x74349fb3UL, 0x5da10b39UL, 0x2f49a022UL,
+       0x64512422UL, 0x1acc41abUL, 0x068644fcUL, 0x73b39a3cUL, 0x6bcf1268UL, 0x0849bfc5UL, 0x84aa7c85UL, 0x4a48efccUL),
+    SC(0xa71007b1UL, 0xe0747b7bUL, 0x1b8b4398UL, 0x232ee970UL, 0x97f623ecUL, 0x4924b8afUL, 0x16ea98d3UL, 0x6f98102aUL,
+       0x91039909UL, 0x9c42dbe9UL, 0x01bdd719UL, 0xd31bd00dUL, 0xe040752bUL, 0xcedf9927UL, 0x77e0863aUL, 0x96a5a259UL),
+    SC(0x2f72cb7fUL, 0xf0aed6c8UL, 0xef75c041UL, 0x4ebc413cUL, 0x21705889UL, 0xde3e33ddUL, 0xd3057668UL, 0x4f882553UL,
+       0x86450b7cUL, 0xbfc89e63UL, 0xba1a1754UL, 0xba42125aUL, 0x08b41f12UL, 0xd5a5582fUL, 0xad86675aUL, 0xb05bf998UL),
+    SC(0x099f0e44UL, 0xe11ea919UL, 0xf16fa130UL, 0x5ac6e72eUL, 0xc11ae9ddUL, 0xe08d3143UL, 0x2ea9aed0UL, 0xf902cc77UL,
+       0x43f4e6afUL, 0x0ca0605eUL, 0x749623e4UL, 0x18027ee9UL, 0xc64c059eUL, 0x560d6c80UL, 0x6219eec7UL, 0xe475367dUL),
+    SC(0x1aff311fUL, 0xbed263a5UL, 0xedcebb0fUL, 0xe149302cUL, 0xc0cc2b0bUL, 0x92c69d33UL, 0xd31c5522UL, 0xeb9c9a94UL,
+       0x8533cdcdUL, 0x97190439UL, 0x48d38bb6UL, 0x845ca07aUL, 0x9a9485fdUL, 0xdbd44868UL, 0x7f06143fUL, 0x0e85f046UL),
+    SC(0x4a2dfcd1UL, 0x4f601607UL, 0x43273bfaUL, 0x3702be5cUL, 0x57f99a6aUL, 0x29fa7f92UL, 0x666d5020UL, 0x6ffc852dUL,
+       0x95931301UL, 0x821cd6fbUL, 0x63203fbdUL, 0xa894de3aUL, 0x57eb75b0UL, 0x2f273f3dUL, 0xbf462727UL, 0x301dd9b4UL),
+    SC(0x59c5a0daUL, 0x0480f334UL, 0x944608feUL, 0xa580c302UL, 0x965d26a0UL, 0xdcd43b31UL, 0x3854b302UL, 0xaf6abe35UL,
+       0x40e27b3eUL, 0x932ede7bUL, 0x40490224UL, 0x7b937b7fUL, 0x2938edb0UL, 0xa11b667fUL, 0x16a90ed0UL, 0x2a0309e4UL),
+    SC(0x570bc6cfUL, 0xfec905e1UL, 0x564906b9UL, 0xebdecc13UL, 0x60abe5a3UL, 0x61f7c5c8UL, 0xf03cd2aeUL, 0x3ef9d125UL,
+       0x55bff728UL, 0x01f73045UL, 0x82fe61e5UL, 0xd4a92697UL, 0x77503b39UL, 0x9b320c45UL, 0xce5bb9bdUL, 0x35def5c5UL),
+    SC(0xbd7dab69UL, 0x88ece4e3UL, 0x621efa68UL, 0x38a24032UL, 0xae9721c4UL, 0xfcd835d8UL, 0x6283b5f8UL, 0xf9f02ee4UL,
+       0xc7442cc0UL, 0x95009f1aUL, 0x193766f6UL, 0xd050d165UL, 0xd8cdca90UL, 0x2ebe6d8fUL, 0x237fb922UL, 0xa1b6fb06UL),
+    SC(0xa780a23dUL, 0xeb8459fdUL, 0x7195ea96UL, 0xe8fedf8eUL, 0x8b38edefUL, 0xe0e0865aUL, 0xb1d69d85UL, 0x1d27c65cUL,
+       0xf8c94632UL, 0xa11f7185UL, 0x9e3c7963UL, 0xf24904a6UL, 0x536321d5UL, 0x0f5e4652UL, 0x3195f854UL, 0x355de49cUL),
+    SC(0xf0ab42b0UL, 0xbb80f147UL, 0x7f9fe3aeUL, 0xf5944100UL, 0x14a94142UL, 0xe8312b91UL, 0x86b0d6faUL, 0x3f0243eaUL,
+       0x237a6ab6UL, 0xb5e08f03UL, 0xa7b58f98UL, 0xe72227acUL, 0x6d3660f5UL, 0x43da0694UL, 0xb6821c9dUL, 0x332724a4UL)
+  },
+  {
+    SC(0x38186a1dUL, 0x6092b158UL, 0x554f3f6dUL, 0xc6de049aUL, 0x2037577bUL, 0x2da8db39UL, 0x163fde30UL, 0xb19dbf2aUL,
+       0x0a8cf045UL, 0x9c7ea28aUL, 0x415d01f4UL, 0x47566d54UL, 0xf986cab5UL, 0xeb272326UL, 0x442f32efUL, 0xcb6c43c8UL),
+    SC(0xaaf937ebUL, 0xc2084f16UL, 0x301bdb4eUL, 0xaa106263UL, 0xcfe483a7UL, 0xd0ba1b16UL, 0xb93d921eUL, 0x80f03a4dUL,
+       0x7e18642eUL, 0x8be01d91UL, 0x86366b3cUL, 0xc94aef09UL, 0xc02501eaUL, 0xe084a87aUL, 0x0a94d2d2UL, 0xf85f84d9UL),
+    SC(0x128b8279UL, 0xec2731f6UL, 0xcf2ceed9UL, 0xfed2cb49UL, 0xf53d6237UL, 0x112a84fcUL, 0xc678189aUL, 0x8e19867aUL,
+       0xfc0dedbbUL, 0x32524c1aUL, 0x0f44fefcUL, 0x6b0e6bd2UL, 0xba65f23aUL, 0x54f69986UL, 0x52953154UL, 0x41a89489UL),
+    SC(0x7c3dac1eUL, 0x6d89c8b6UL, 0xe9645ec9UL, 0x039dc634UL, 0xa2cf5adbUL, 0x323be29fUL, 0x0625703bUL, 0xcaeb21e2UL,
+       0xa1b87f33UL, 0xb5bd9351UL, 0x15f16702UL, 0xae411a91UL, 0xb3e9eb6aUL, 0x814e678eUL, 0xb3dd7431UL, 0x6dff896aUL),
+    SC(0x609d5c22UL, 0xc8c7c1aeUL, 0x211b4ca2UL, 0xf709a1abUL, 0x75624b91UL, 0x0cb95d2dUL, 0x6ea6baf3UL, 0xeacc12c4UL,
+       0x65a7b252UL, 0x0f13d08bUL, 0x4b007967UL, 0x69e6bee8UL, 0xedb5cc68UL, 0xd4ec8c46UL, 0x527bcf77UL, 0x535bd7bcUL),
+    SC(0x691534e3UL, 0x2faa9206UL, 0x5fe7e8a1UL, 0x8a863d78UL, 0xafeeb581UL, 0x97b1f48fUL, 0x4f090bb6UL, 0x9d3f9d11UL,
+       0x2bfac0b5UL, 0x35202013UL, 0x60268e74UL, 0x2376b901UL, 0xa027d6f8UL, 0xf0d91aa6UL, 0x59341544UL, 0x118a325bUL),
+    SC(0xe6736a7eUL, 0xe2f3f088UL, 0x27012fafUL, 0x3b3d1b7eUL, 0xed8dc136UL, 0x3421e438UL, 0x8ba70c5bUL, 0x72eb4eb9UL,
+       0x5a9b2651UL, 0x26652e14UL, 0x08fa3639UL, 0x0be0b4d5UL, 0x1ba519c0UL, 0x1285964eUL, 0x7aa8a699UL, 0x45bc71efUL),
+    SC(0x0e3f05d6UL, 0x2aa7b9d9UL, 0x6e9480a0UL, 0xa3eefe32UL, 0xf1f6d45eUL, 0x2fb1215cUL, 0xee5a3fddUL, 0xf147b154UL,
+       0x47389f33UL, 0xe03817efUL, 0x1051db5bUL, 0x26efa711UL, 0x46cf673cUL, 0x12831163UL, 0x2ee13576UL, 0xb8508013UL),
+    SC(0xb5041a3fUL, 0xcf8b742aUL, 0xdee6540dUL, 0xe9974cbdUL, 0xfe527e2fUL, 0x4842a208UL, 0x0630b9d2UL, 0x239c0657UL,
+       0x4ea01569UL, 0xfdf5b2e1UL, 0x7631d2e8UL, 0x2c2c0bbcUL, 0x291d69f2UL, 0xfdeb077fUL, 0x4ea1df9aUL, 0x6303ad57UL),
+    SC(0xe5463af8UL, 0x5dc090f9UL, 0x9ff72771UL, 0xc1cc3585UL, 0xdfbf9dfeUL, 0x329e69b5UL, 0xfd0ac2efUL, 0x3f715ad6UL,
+       0xc54085dcUL, 0xa966fa9aUL, 0x985d8e46UL, 0x79335dcdUL, 0x2d22d470UL, 0x790f71ccUL, 0x1d0aeccbUL, 0xbe9c5fadUL),
+    SC(0x104b12f7UL, 0x8fdbd727UL, 0x2a5716f1UL, 0x51238362UL, 0x94261142UL, 0x48209abeUL, 0xe4dcbb4cUL, 0xd7bb0416UL,
+       0xebb07749UL, 0x12a3ce9aUL, 0xe20b6696UL, 0xe485811cUL, 0x6a15ed53UL, 0xa1015291UL, 0x90672c47UL, 0xe4442c6dUL),
+    SC(0x1699a1d8UL, 0xd04a07fbUL, 0x32fcecb6UL, 0xae89092eUL, 0xfcaaebd4UL, 0xfd9c4af7UL, 0xd79a5eebUL, 0x2c18da72UL,
+       0xcff1a93dUL, 0x4ccd9199UL, 0x9c6259bcUL, 0xfc975ab3UL, 0x4992c8e1UL, 0x8d1cae10UL, 0x0b0c1ce2UL, 0x83101103UL),
+    SC(0x13df43c4UL, 0x4de2fda2UL, 0x4b932131UL, 0xe7c7fc62UL, 0x896f2747UL, 0x706ff959UL, 0x85f98248UL, 0x4cbc6179UL,
+       0x1da341b8UL, 0x734cec8bUL, 0x74de0c08UL, 0xa040ff68UL, 0xd8d30ef1UL, 0xdfe1ffe4UL, 0x72ffc73dUL, 0xa6a82a74UL),
+    SC(0x2e101469UL, 0x1b7e08f2UL, 0xd3aa774cUL, 0xf8f91ae6UL, 0xe9aea711UL, 0xfddeccc5UL, 0xd816e5a3UL, 0xdd752dfdUL,
+       0xcd4e7f49UL, 0x998ec720UL, 0xa3ed2e45UL, 0x8136fbe7UL, 0x9942011dUL, 0xda5d7fd4UL, 0x2c56ed77UL, 0x29f55b98UL),
+    SC(0xb0296b3aUL, 0xf9e819acUL, 0xa7b01bd5UL, 0x7977ea85UL, 0x5d2ba87dUL, 0x24f820f0UL, 0xc1ad5f84UL, 0x6b9d10c1UL,
+       0x192cc5d1UL, 0xb6782d9eUL, 0xe3f444adUL, 0x61c0b8d6UL, 0x9772062eUL, 0x7b03c615UL, 0xb1cb7550UL, 0xa76e1d11UL),
+    SC(0xf9a11b59UL, 0x6e369694UL, 0xfd62d423UL, 0x518e355bUL, 0xa796269bUL, 0xd2b5a88bUL, 0x1c8bc812UL, 0x40fe464fUL,
+       0x8c919e60UL, 0x86160ff7UL, 0x8d1ce269UL, 0x4512c16eUL, 0x75f8a79eUL, 0xda39df1cUL, 0xad104555UL, 0x6d1543ddUL)
+  },
+  {
+    SC(0xd8e5f3baUL, 0xc152215aUL, 0x8cf8ca08UL, 0x40aaad6cUL, 0x7d001aa0UL, 0x140bb0b4UL, 0x0dcac726UL, 0x229ee272UL,
+       0xe59390a8UL, 0x21e8608bUL, 0xe53fb258UL, 0xa426dfb6UL, 0xca762fd0UL, 0x9d574f7cUL, 0x5555cb8dUL, 0x7174b381UL),
+    SC(0xc2d7dc95UL, 0x6c6721e8UL, 0x6effb64dUL, 0x5e1c4ec2UL, 0xffb13a28UL, 0x706669fbUL, 0xac30f035UL, 0x9d202663UL,
+       0x8cb207fdUL, 0x63af5339UL, 0xf9a705f5UL, 0x79f446cdUL, 0x1a11c0e4UL, 0xcde750cbUL, 0x803b840eUL, 0x5a4970a5UL),
+    SC(0xbb3445f8UL, 0xd7f47cf9UL, 0xbefd1a73UL, 0x76dd9c96UL, 0xf6d76fb5UL, 0xb6d4b7deUL, 0xe7f96dc8UL, 0xc9e8f025UL,
+       0xc1fddadaUL, 0x756d03aaUL, 0x7d92135aUL, 0xa8dd783dUL, 0x63920238UL, 0x1c2f5af4UL, 0x7e702cbbUL, 0x97ea783bUL),
+    SC(0x1271c587UL, 0xd72e74bfUL, 0x286ae688UL, 0xc022e129UL, 0xf9a95567UL, 0x9f74755aUL, 0x24e85d81UL, 0x486699ebUL,
+       0x1259045aUL, 0xcb14f2bdUL, 0x7d5fc85dUL, 0xd8c58303UL, 0x9181d367UL, 0x63e4733aUL, 0x56172be4UL, 0xb19c4a40UL),
+    SC(0x76274ca3UL, 0x884de253UL, 0xccd8e9feUL, 0xb2f7ceb6UL, 0x1c7b6c49UL, 0x1a358b42UL, 0xe64994fbUL, 0x80808263UL,
+       0x0d2639e7UL, 0x539ec38eUL, 0xb14c7d83UL, 0x47fc4d10UL, 0xc2a2d83fUL, 0x81a1e4adUL, 0x1ba8267eUL, 0xbfdd4dfaUL),
+    SC(0x8d80c172UL, 0xea0f7e79UL, 0xd3f2569cUL, 0x49d49bf8UL, 0x330cff73UL, 0xfdce6b14UL, 0x3a4a349dUL, 0xe7cec2d8UL,
+       0x86dd76eeUL, 0x63fb3a85UL, 0xae315029UL, 0x3e2d024cUL, 0xff1649d3UL, 0xc823ca63UL, 0x5a1fd992UL, 0x975fda33UL),
+    SC(0x441e6584UL, 0x10404939UL, 0x367bc434UL, 0xf1c64c42UL, 0x5b2bd11bUL, 0x5beeec47UL, 0x35919f02UL, 0x04a4626fUL,
+       0x3db30e8eUL, 0x29e6cedbUL, 0x7bb465ebUL, 0x92526c4fUL, 0x4b7d8361UL, 0xb151ddb1UL, 0xda878a87UL, 0x86d83573UL),
+    SC(0x10d89274UL, 0xb0d498f3UL, 0xd29df723UL, 0x937c3838UL, 0x49b4ffd8UL, 0xb87427bdUL, 0xa1d142d3UL, 0x160c2b88UL,
+       0x15df3d2dUL, 0xb11e35fdUL, 0xa423c709UL, 0x24e497d9UL, 0x77941b44UL, 0x20e3093eUL, 0x539d3406UL, 0xe2fcf435UL),
+    SC(0x3960dea1UL, 0x9431a970UL, 0x6bc4e886UL, 0x8cbcaaf6UL, 0x0dfb9c87UL, 0x17e664d0UL, 0x04ff6eb5UL, 0x4108f2ceUL,
+       0x3cd86dfeUL, 0x6d967078UL, 0x9f090213UL, 0x04661a7fUL, 0x78e4854dUL, 0x7e79e519UL, 0x7283f8c9UL, 0xa89ce6b3UL),
+    SC(0xa1f9b8bfUL, 0x15de0a59UL, 0x141449ebUL, 0x3a52a335UL, 0xab881489UL, 0x7a7ae82fUL, 0x964d3bffUL, 0xf1dd38d8UL,
+       0xdd563a40UL, 0xebbf06d0UL, 0x84e21a10UL, 0xdfd117e3UL, 0xc8806975UL, 0x53556b4cUL, 0x2fb51100UL, 0x6b498d6aUL),
+    SC(0x17cbba26UL, 0x09cf2b92UL, 0x7d442075UL, 0x396090daUL, 0x62a2026fUL, 0xce3b3ecaUL, 0x858feb21UL, 0x76659de2UL,
+       0x71f31851UL, 0xa2561f97UL, 0xb0ac2495UL, 0xd72904a0UL, 0xbdddd83eUL, 0x83a1dd87UL, 0xb0db14e6UL, 0xff1348b5UL),
+    SC(0x10dd7c20UL, 0x902512d6UL, 0x6484c830UL, 0x53063a20UL, 0xc7474504UL, 0x3a378949UL, 0x280a90b9UL, 0xf8504102UL,
+       0x1624bb25UL, 0x937d3b47UL, 0x43214401UL, 0xc8016fffUL, 0xf770f7aeUL, 0x7d78d8dfUL, 0x381c2de9UL, 0x13bc856cUL),
+    SC(0x7ecc1dcfUL, 0x5e9c56cdUL, 0x43cf311dUL, 0x5b31d269UL, 0x50db89c7UL, 0x2b51b624UL, 0x745b3c75UL, 0xeea68899UL,
+       0x03ae1b7dUL, 0x2e8252e6UL, 0x43b73aa5UL, 0x6d7c9b62UL, 0x1f79d1bbUL, 0x01d2973cUL, 0x1bc3b150UL, 0xa17d1ef5UL),
+    SC(0xf57d8aa8UL, 0xca4c8377UL, 0x14ca1ac8UL, 0xe2fa456fUL, 0x4c94b304UL, 0x0fd0b268UL, 0x2084ab52UL, 0x3768827aUL,
+       0x2c5bb2eeUL, 0xe4b509b7UL, 0x07cadd78UL, 0x4202c12cUL, 0x3644ec47UL, 0x9c599009UL, 0x581f8b6aUL, 0x7ef5bc83UL),
+    SC(0x74905ca2UL, 0x7116aec3UL, 0xb96d16cfUL, 0xfba3431fUL, 0x5ccc3cb7UL, 0xe5747525UL, 0x124b5b31UL, 0xbd6fd066UL,
+       0x7d26da6cUL, 0x1268cf67UL, 0x846954f0UL, 0x48c7dcb3UL, 0x3a1244b5UL, 0x8f0a8026UL, 0xc3dbc651UL, 0x68cbe871UL),
+    SC(0x4e0b7166UL, 0xde12f0ffUL, 0xbaeb2464UL, 0xba205624UL, 0xe85b9238UL, 0x4a3ebbcbUL, 0xdb9c6038UL, 0x94ef0cefUL,
+       0x08a85223UL, 0xcf784126UL, 0x3419d777UL, 0x93fb66d9UL, 0x19e3428cUL, 0x5ab844dcUL, 0xd3d9cc46UL, 0x7ea95c10UL)
+  },
+  {
+    SC(0xf41bd2b0UL, 0xe0f49133UL, 0x747e831cUL, 0xaf4c7a0cUL, 0x22d2b55fUL, 0x1cd4ca53UL, 0x1115d81bUL, 0xb47754b0UL,
+       0x869485d7UL, 0x26d4687bUL, 0xc57a9eb6UL, 0xe90e93a7UL, 0xbce3b523UL, 0x998d16c1UL, 0x297c996aUL, 0xb68c4fa3UL),
+    SC(0xce2e4f9aUL, 0x3c32ea4aUL, 0x02198e61UL, 0x8d7d88a9UL, 0x153111ccUL, 0xfc114a46UL, 0x0cb9b47cUL, 0x63842146UL,
+       0x5c90a793UL, 0xc4f4b290UL, 0x240dfc0cUL, 0x1dc0df9dUL, 0xa33214d8UL, 0x3024304aUL, 0xd49eab61UL, 0x8c4d64e9UL),
+    SC(0x924f51ebUL, 0x823a89d1UL, 0x3194305bUL, 0x45ba1f8cUL, 0x40a58987UL, 0x73cb1a5aUL, 0xa4a4017aUL, 0xb55af76fUL,
+       0x8cfbe8aaUL, 0xd3b759f6UL, 0x14c98aeaUL, 0x3b3443acUL, 0x46400a2fUL, 0x5cf741acUL, 0xc7f590b3UL, 0x39f3ea0eUL),
+    SC(0x9f985579UL, 0xfd32d32dUL, 0x090ec233UL, 0xc5577a12UL, 0xb1fc350aUL, 0xe94b5f08UL, 0xccd31cc0UL, 0x33495f5fUL,
+       0xffae345dUL, 0x8bae4446UL, 0xbfd5b6a5UL, 0x117c0b77UL, 0x49cab9ffUL, 0xeabbc8d6UL, 0x531e0c34UL, 0xfdaeb328UL),
+    SC(0xb4d25ec2UL, 0x6afed742UL, 0x2ae7f209UL, 0x0f4201d0UL, 0x91dfd595UL, 0x3418bb05UL, 0x12b1ce25UL, 0x455ba8e6UL,
+       0x8a13f82cUL, 0x47489b6cUL, 0x72223047UL, 0xe8e079e0UL, 0x0165edf0UL, 0x4c335814UL, 0xb971a5d8UL, 0x27d2cab6UL),
+    SC(0x7f4ce1f9UL, 0xacd1d262UL, 0x6c6da2f9UL, 0x7dc19ddbUL, 0xba3f15c7UL, 0x7b6c88e6UL, 0x3b0d4e41UL, 0xa40a3c7fUL,
+       0x750468cdUL, 0x33a35da7UL, 0x242142e1UL, 0xe68128e4UL, 0xb5210635UL, 0xc4739abaUL, 0x910ba9ecUL, 0xc9c01fcfUL),
+    SC(0x67f46710UL, 0x16d87e34UL, 0xb2d53d5eUL, 0xc54f9fa5UL, 0xf22c283bUL, 0xa3dc5a17UL, 0x70fc4a16UL, 0x1a2be4c4UL,
+       0x70503598UL, 0x1378a67dUL, 0x16827d9eUL, 0xc87c591eUL, 0xafb16feaUL, 0x6a5ba182UL, 0x4f6cf6c1UL, 0xfa92b772UL),
+    SC(0x1c30c0adUL, 0x43b0a74dUL, 0xfb199442UL, 0x0b151865UL, 0x7cf99e26UL, 0xfca6e2f2UL, 0x1cb97a6aUL, 0x53c15893UL,
+       0x3728e682UL, 0x72a4020dUL, 0x8365b4caUL, 0xeb153fe5UL, 0x162e79c6UL, 0xca6a851aUL, 0xe233a160UL, 0x400b625dUL),
+    SC(0x0d92d821UL, 0x8443e951UL, 0xad6ad28dUL, 0xb7bd7101UL, 0x756d91a0UL, 0xcc3deba4UL, 0x0219ee34UL, 0xba2f6017UL,
+       0xfc3dab7bUL, 0xac2436fdUL, 0xa39a65d4UL, 0x596dabc2UL, 0x0b65f8f0UL, 0xc1195a51UL, 0x5d8f2bd8UL, 0x4f5530deUL),
+    SC(0x3b6264bfUL, 0xa47de486UL, 0x3ceccda8UL, 0xfe6c55a6UL, 0xab1d8188UL, 0xd111b222UL, 0x4aae150dUL, 0xc3517ee3UL,
+       0xe3f786ceUL, 0x5adc8660UL, 0x98965a41UL, 0x62f4f510UL, 0x8c1f34d9UL, 0x2451af03UL, 0x8f68e5f5UL, 0x8f6c58d9UL),
+    SC(0xc6b7190aUL, 0xe4d0c14dUL, 0xb3cba3dbUL, 0xc72fadb9UL, 0xda9391d4UL, 0x2eb7ac68UL, 0x4e1b20faUL, 0xd89749ecUL,
+       0xf4b7f04aUL, 0xb1358c35UL, 0x1b2c622bUL, 0xaabf3e5fUL, 0xdc5abd87UL, 0xab3cb388UL, 0x86f73d91UL, 0x202ce359UL),
+    SC(0xc2846da6UL, 0xa821c506UL, 0xe022a927UL, 0x257b8d21UL, 0x57d82defUL, 0x196f32a6UL, 0x78b8cdcaUL, 0xd085779bUL,
+       0xd5431c41UL, 0x4ea1417fUL, 0x3f4d90cbUL, 0xc776ee29UL, 0x9a6a8557UL, 0xa256b3a2UL, 0x58a887faUL, 0xfb5aa256UL),
+    SC(0x7bbe2521UL, 0x01f987b2UL, 0x742b6266UL, 0xd2c598b4UL, 0x01de04ffUL, 0x70b689aaUL, 0x8be97f8cUL, 0x63829bc8UL,
+       0xdfb605caUL, 0x3491a434UL, 0xe53fd0ccUL, 0xd8bb2188UL, 0x0c6dbb06UL, 0xcb18a9a5UL, 0xcfc6844dUL, 0x400982fbUL),
+    SC(0x81a92f34UL, 0xce6c4383UL, 0x0a058d74UL, 0xac36b44fUL, 0xf4bad7adUL, 0xb6ec6a92UL, 0x87db84c5UL, 0x9df3469bUL,
+       0x31639fd5UL, 0x7842ad40UL, 0x4b204b26UL, 0x7570a557UL, 0x91dee70bUL, 0xac71630fUL, 0x90924443UL, 0x47597c32UL),
+    SC(0x9e309152UL, 0x54a25340UL, 0x8a533606UL, 0xd8f8dfb6UL, 0x9ff93f1aUL, 0x9d97212eUL, 0xc261dcf8UL, 0xea3d1d7bUL,
+       0xab95d903UL, 0xccce7769UL, 0xcc185c1dUL, 0x4e24da15UL, 0xb9c05bc2UL, 0x7977c754UL, 0x1b1023d4UL, 0x39d75d26UL),
+    SC(0x00f72ff9UL, 0x92e06721UL, 0x0559e127UL, 0x28169de4UL, 0x888efbeeUL, 0xe87542f8UL, 0xfe0fa971UL, 0x189baee7UL,
+       0xdb2e60c0UL, 0x4678d370UL, 0xcef335d1UL, 0xd3e007ecUL, 0x30dc03c1UL, 0xf31c02cbUL, 0x796de00aUL, 0xf856e440UL)
+  },
+  {
+    SC(0x67c452cbUL, 0xe71c61c5UL, 0x8aaf68ccUL, 0xb1f6208dUL, 0x5646432bUL, 0x86774f8fUL, 0x60081179UL, 0x6d5337c9UL,
+       0xd5f859deUL, 0xa125aee2UL, 0x11dcc7cbUL, 0xb50b4fa3UL, 0xef4f9767UL, 0x7eb94f65UL, 0xb6a181dfUL, 0x9b938c0aUL),
+    SC(0xb068a1a0UL, 0xe36426fbUL, 0x2d959715UL, 0x63faa818UL, 0x1da81aafUL, 0x3ba3654aUL, 0xf2570e0cUL, 0x3d373d2eUL,
+       0x9d29d11aUL, 0x9333182bUL, 0x3202e348UL, 0xf547a9acUL, 0xed5b6468UL, 0x83608526UL, 0x682b10b6UL, 0xe1ad0f0bUL),
+    SC(0xe33d0069UL, 0xdcc14230UL, 0x760f13d4UL, 0x59c4ae5aUL, 0x8af0383eUL, 0xe6f37eb3UL, 0x013a8b7cUL, 0x587e0c30UL,
+       0xaca7fc55UL, 0x47536053UL, 0x097b56a7UL, 0x4d814548UL, 0x993e11c7UL, 0x4b89bf1aUL, 0xb50ecb40UL, 0xb9cbb5f1UL),
+    SC(0x77f40f78UL, 0x10b06a83UL, 0x71c1493cUL, 0x61a816bcUL, 0x10f3b70dUL, 0x5fcd025cUL, 0x54de5036UL, 0xeb6b2ce4UL,
+       0x618187fbUL, 0xf124b864UL, 0xd69ae6f6UL, 0xc9eb674aUL, 0xeb73a074UL, 0xb95194dfUL, 0x967b804bUL, 0xc66d3e56UL),
+    SC(0xd0ebe599UL, 0x772c1450UL, 0x0979c403UL, 0x25ef498bUL, 0x69548f62UL, 0x907bb455UL, 0x1fba8f0dUL, 0xc7b076f7UL,
+       0xd0ffa315UL, 0x3b96c94bUL, 0xcb97af89UL, 0x2f845295UL, 0xccfd1146UL, 0xd8c682a8UL, 0x3bb7488cUL, 0x3fcec2f6UL),
+    SC(0x2fe20698UL, 0x39f33753UL, 0x819d4b74UL, 0xf0a036e9UL, 0x2aefe03fUL, 0x5b55f504UL, 0x0d3e1af7UL, 0xeb5cc0ebUL,
+       0x27e67641UL, 0x1aa1a970UL, 0xfa0fa0dfUL, 0x8a147716UL, 0xb52ac4beUL, 0x489194bfUL, 0x3f192ae0UL, 0xeceab892UL),
+    SC(0x94dfb5beUL, 0x319f7da5UL, 0xef283791UL, 0xe6375480UL, 0x1c337607UL, 0x32f8e66eUL, 0xbc649943UL, 0xaf99262dUL,
+       0x4fedb692UL, 0x4c6dbe8bUL, 0xdaec8caaUL, 0x4273f77dUL, 0x4736b73fUL, 0x80446c5dUL, 0xd4116329UL, 0x05008225UL),
+    SC(0xa0147c3dUL, 0xf958362cUL, 0x177aea45UL, 0x908de2f5UL, 0xafdb005aUL, 0x89182e95UL, 0xedd3f4e7UL, 0x74ee0cf6UL,
+       0xc81c0014UL, 0xb273d2b6UL, 0x2e7d40f9UL, 0xd9b169ccUL, 0x67ebc773UL, 0xbe51d8bcUL, 0x7f35ff75UL, 0xf0eeca0cUL),
+    SC(0x91fd8598UL, 0xf0a9c4b2UL, 0x130310ccUL, 0x417e7a3aUL, 0xc1374b1cUL, 0x2c76e675UL, 0xf5f1a7dfUL, 0x32b1b96eUL,
+       0xf2f277f1UL, 0x154afaffUL, 0x774390e2UL, 0xe87bf67bUL, 0xa722ee5dUL, 0xb502a1c6UL, 0x24042a7cUL, 0x779d5a45UL),
+    SC(0x0613b839UL, 0xa2dc9731UL, 0xa2ba890aUL, 0xe8f7c966UL, 0xab3c4237UL, 0x0fc14b05UL, 0x7c561f6eUL, 0x208c77fbUL,
+       0x22b63998UL, 0x85a758b5UL, 0x848a318aUL, 0x5aac49fcUL, 0x0aa14c4fUL, 0xcb29f020UL, 0x842280faUL, 0x618f235aUL),
+    SC(0x653389e1UL, 0x3b7f87e8UL, 0x8d22d0deUL, 0xd8b1de4aUL, 0xb4902d12UL, 0xa0c36e76UL, 0x11ed3d0fUL, 0xe1efcb86UL,
+       0xba710bfdUL, 0x095e40d1UL, 0xa4e8b4c4UL, 0xcd1ee147UL, 0xe01ebf1aUL, 0x74f52483UL, 0x4fc5148bUL, 0x65a86e4bUL),
+    SC(0x7b5aaf67UL, 0xbd31c86bUL, 0xe4877624UL, 0x85b35fb1UL, 0x4f6f480fUL, 0x69aefa91UL, 0x30e3208aUL, 0x0f9f9997UL,
+       0x0afdce71UL, 0x1bf55d3dUL, 0x4cb01dc9UL, 0x3870e40aUL, 0x851a8c7eUL, 0xa7217607UL, 0x1d3285f5UL, 0xc727a9edUL),
+    SC(0xbbed5d70UL, 0xbe29d810UL, 0x51bd811cUL, 0x7f237856UL, 0x7d097da5UL, 0xcfb2d891UL, 0xc0bc86daUL, 0x7d680decUL,
+       0x229ba9e5UL, 0xddeaa4ccUL, 0x498cce34UL, 0xabea1d19UL, 0x567e3a6cUL, 0x878f8fc1UL, 0x31be7b06UL, 0xf8550aaeUL),
+    SC(0x1c4562b2UL, 0x01dc0d0cUL, 0x1c4bd826UL, 0x603d07a2UL, 0x8b7545f9UL, 0x29e0cddeUL, 0x77a1ce23UL, 0x5d378d1bUL,
+       0xb8976266UL, 0x79671f6eUL, 0xbd0b43daUL, 0x9eef06bdUL, 0x99dff8eeUL, 0x05092e19UL, 0xf260f468UL, 0x0ef16ef0UL),
+    SC(0xa9edf307UL, 0xc7fd7446UL, 0xd71be12cUL, 0x267a7135UL, 0x688bf7c6UL, 0x8f1dd65bUL, 0xeed8208bUL, 0x897dc380UL,
+       0x9a20e692UL, 0x9437be50UL, 0x36a7b701UL, 0xad3a6a77UL, 0x82234965UL, 0xcadca1bfUL, 0x4992da4aUL, 0x24438f9fUL),
+    SC(0x003bce25UL, 0xad7ebdd3UL, 0x43645652UL, 0x954ccfe1UL, 0x1c5e9597UL, 0xfa3a9f83UL, 0xd51ea36fUL, 0x2b55aae4UL,
+       0xcfdbf98bUL, 0x7f3575f4UL, 0x4d37ac16UL, 0x41352d12UL, 0xbbf7e13aUL, 0x4315cc04UL, 0x3e9ab067UL, 0xb3e41c52UL)
+  },
+  {
+    SC(0x56d09714UL, 0x0cde8f0cUL, 0x0f1956cfUL, 0xa56bb0aaUL, 0xb73507c8UL, 0xbc0399f8UL, 0xc0fd17deUL, 0x19e48e9bUL,
+       0xd62e1f31UL, 0xb40ca6baUL, 0x71de9059UL, 0x8a9fb911UL, 0x6c5f0007UL, 0xdf0c33ebUL, 0xf50db688UL, 0xef0ab90fUL),
+    SC(0x8fd887e5UL, 0x50b3b108UL, 0xf17bf25aUL, 0x12187b64UL, 0x4b173b13UL, 0x15d5dbb1UL, 0xc9821c4fUL, 0x9d05a37dUL,
+       0x7b2d3e3bUL, 0x0731d83fUL, 0x535c0c5fUL, 0x1df2fe54UL, 0xb1eb7c02UL, 0xe43e73e5UL, 0x42d0efc2UL, 0xc9175fc1UL),
+    SC(0x64331c37UL, 0x0736130cUL, 0x78f719a7UL, 0x52603e28UL, 0xd8a48c9cUL, 0x033e3676UL, 0x02ddf079UL, 0x4647588aUL,
+       0x9f214dceUL, 0xbcf18beaUL, 0x5aa4823bUL, 0xe72df87fUL, 0x634e37e4UL, 0x6b8e696fUL, 0x41ac44f9UL, 0x76834a5dUL),
+    SC(0x6bed1320UL, 0x7626f62bUL, 0x4e323e92UL, 0x0ffbca06UL, 0x4b682d74UL, 0x59192c6fUL, 0xa3569567UL, 0xcadca363UL,
+       0x8d435e2cUL, 0xda580046UL, 0x755f375fUL, 0xb226ac7fUL, 0x86d15c33UL, 0x71114737UL, 0xfc09b8f1UL, 0x0ff9d311UL),
+    SC(0xe1c8c67cUL, 0x56fba327UL, 0xfa0b3790UL, 0x08dde77bUL, 0xa187df50UL, 0xe2b0217dUL, 0x8a151344UL, 0x4cef208fUL,
+       0x7be39f85UL, 0x450ba36dUL, 0x0b2d46faUL, 0x457c68bcUL, 0xe6c7d140UL, 0xac1f6f60UL, 0xcc95d12aUL, 0xb3dba197UL),
+    SC(0x9e927dc5UL, 0x427d6859UL, 0x30da46a8UL, 0x915934bdUL, 0x4483374dUL, 0x263d962cUL, 0xfa0e9710UL, 0x06cf285cUL,
+       0xcb9b2596UL, 0x90224417UL, 0xd65d7badUL, 0xf89a946fUL, 0xdf0f7b68UL, 0x2a28099aUL, 0x118c146aUL, 0x598ccf01UL),
+    SC(0xfcf97f06UL, 0xf70b77ddUL, 0x47ee5661UL, 0xca5c5653UL, 0x5b770d5aUL, 0x0ca61e88UL, 0x10542124UL, 0x92fa3748UL,
+       0x05df3187UL, 0x1f5af498UL, 0x0605324cUL, 0x81dea770UL, 0x67aa4952UL, 0x7736a0e6UL, 0xcd3cd6a6UL, 0xad4f185cUL),
+    SC(0xf8922d31UL, 0x8ee1c47fUL, 0x29a5df4aUL, 0x66ea44e7UL, 0x7ac4ecbfUL, 0x2440c4b9UL, 0x3815f249UL, 0xbc5a1b28UL,
+       0x9377d8bdUL, 0x548e7fa3UL, 0xbfef786dUL, 0xbca70039UL, 0x24509e9bUL, 0xd22e483dUL, 0x9218fc48UL, 0x34941d62UL),
+    SC(0x6b7de62bUL, 0x9c928cfaUL, 0xe9da1197UL, 0x951c010cUL, 0x34dfbb7bUL, 0xb111274fUL, 0xed5f4552UL, 0x20909188UL,
+       0x207d06d5UL, 0x719938a4UL, 0xf69be3adUL, 0xffe9e83eUL, 0x17d2e500UL, 0x7d3dea3eUL, 0xf34336f8UL, 0xdf3d226aUL),
+    SC(0xe948b128UL, 0xc6217752UL, 0x8f1d0569UL, 0x697c656dUL, 0x92a92b37UL, 0x34360795UL, 0x73c9d7abUL, 0x61db30b0UL,
+       0x7518e35eUL, 0x1a5e4e2bUL, 0x64966fbcUL, 0x1185e7f6UL, 0xb59766d6UL, 0xa8fbd37fUL, 0x36dd9354UL, 0x14d68af2UL),
+    SC(0x9d932075UL, 0x5fd767b5UL, 0x87d8cc95UL, 0x3b2b7d49UL, 0x4967a9ffUL, 0x9fe673d3UL, 0x8b7aa621UL, 0x3dc4d7aeUL,
+       0x80c62686UL, 0xe574233bUL, 0x21f8892fUL, 0x07f8e3cfUL, 0x4e05c47aUL, 0xdb687e38UL, 0x4ce2079dUL, 0x16fd7d36UL),
+    SC(0x46eff49dUL, 0xa6d4dd71UL, 0x108dff71UL, 0xe706a9a0UL, 0x952a8774UL, 0x0efe6eb8UL, 0x6cd28a90UL, 0x1b89a8f6UL,
+       0x8b26310eUL, 0xee49ba70UL, 0x77f085e7UL, 0xcb2f82a7UL, 0x97fa3d50UL, 0xc96e7148UL, 0x892f57dbUL, 0xf89e3544UL),
+    SC(0x72a59c5dUL, 0x6286d1feUL, 0xc37b7bb0UL, 0xff34f67cUL, 0x4a632530UL, 0x37a22efeUL, 0x7dba0305UL, 0x2cca87ebUL,
+       0xa3770634UL, 0x995ae65dUL, 0xc48151cbUL, 0xf2e5efe4UL, 0xbdb30825UL, 0xcccb1277UL, 0xe9728741UL, 0x0ea2832bUL),
+    SC(0x1eb0e1c4UL, 0x8471f8d4UL, 0x1e34c22dUL, 0x16bad4f8UL, 0x2f0cc863UL, 0xdb92d412UL, 0x008d7487UL, 0x1f7f2f3dUL,
+       0x232f76b7UL, 0x1cd83c5aUL, 0x4349358cUL, 0xa661639aUL, 0xb4d6a5b6UL, 0x8eed0f11UL, 0x0a674385UL, 0x8ce7bf95UL),
+    SC(0xd4173198UL, 0x3c8645f0UL, 0xec134630UL, 0x7c6974f3UL, 0x1aa396adUL, 0xf01a91b4UL, 0xb618304bUL, 0x34cad3b9UL,
+       0x3825cdf0UL, 0xbd454a15UL, 0xea3d18d6UL, 0xb07dd5faUL, 0x42e1c46fUL, 0x7fb6a1ccUL, 0xf1a707e4UL, 0x74b83550UL),
+    SC(0xaa030fd2UL, 0x52791775UL, 0xe051f0eeUL, 0xbe7d6902UL, 0x7da01452UL, 0x67b4e712UL, 0x0960692fUL, 0x1d59f72bUL,
+       0xfc83d72dUL, 0x5a0edc4eUL, 0xc05ecb54UL, 0x7111a10dUL, 0x09341df1UL, 0xb0544177UL, 0xc2eda0a6UL, 0x70980ba2UL)
+  },
+  {
+    SC(0x31095045UL, 0x658b8c85UL, 0xec0c4ddcUL, 0x7cbce691UL, 0xd060181dUL, 0xffa08855UL, 0xf3f36722UL, 0x4c026225UL,
+       0x9a8cc527UL, 0x1c231ce7UL, 0xaeb6e73bUL, 0x9acbc16fUL, 0x4b331b01UL, 0x4bd457b8UL, 0x799bad40UL, 0x547c210cUL),
+    SC(0x0372f6cdUL, 0x9a7b7907UL, 0x4f730fa1UL, 0x8cc1db50UL, 0xa9747818UL, 0x99df942fUL, 0x4f2ceaabUL, 0xe85c6678UL,
+       0x7c9b42a3UL, 0x81ebd00aUL, 0x8d4aadafUL, 0x2e34daaaUL, 0xe57f0633UL, 0x94631677UL, 0xee675952UL, 0x3c72753fUL),
+    SC(0x77e7096eUL, 0x7215e184UL, 0xcb096b45UL, 0x54f60fd9UL, 0x4fc5f7b7UL, 0x28bba5bfUL, 0xbe2a85b1UL, 0x1984daf6UL,
+       0x4a913cc1UL, 0xdae55633UL, 0x9a90de21UL, 0x746d3e55UL, 0x7e8db814UL, 0xc23aa361UL, 0xbe967cccUL, 0xcd319643UL),
+    SC(0x0fd6c827UL, 0x34bfd6d0UL, 0xa6130095UL, 0xd2c38135UL, 0xe7992c34UL, 0x6e85d7fcUL, 0xe5b13410UL, 0x767620fdUL,
+       0xa3996aa6UL, 0x1e87830eUL, 0x06d2da97UL, 0x05bd318fUL, 0xc44ec9bdUL, 0xef552204UL, 0xf3ecb761UL, 0xb4541df6UL),
+    SC(0x24824f95UL, 0xbe9fea47UL, 0xbe33b438UL, 0x0d855e2cUL, 0xd0d8982cUL, 0x2d8a0b0bUL, 0xd84bba5aUL, 0xeb8cf0b0UL,
+       0xd7e5c1d4UL, 0xd6c708dbUL, 0xa5b51a46UL, 0x310bd68bUL, 0x018b521bUL, 0xe765fb50UL, 0xe1d8978cUL, 0x6460f1a1UL),
+    SC(0xd1d2e882UL, 0x62b62a1bUL, 0x63ee8e90UL, 0x31f37d7eUL, 0xba90b95aUL, 0x3b577af4UL, 0xc0bf5d4aUL, 0x9cbc65cfUL,
+       0xb88f4f9fUL, 0x62ecbd5aUL, 0x5165ab8dUL, 0x92126053UL, 0x66d719b0UL, 0x9c5d41c7UL, 0x539d9991UL, 0x76d004a8UL),
+    SC(0x9118fd29UL, 0xacf4c565UL, 0x1ee732d3UL, 0xc606d374UL, 0xc4e5306dUL, 0x90614ae9UL, 0xd5aab499UL, 0x4ad300afUL,
+       0x8498b6d1UL, 0xdfa4b247UL, 0xddc437e6UL, 0xcc2f4dbfUL, 0xd46b4562UL, 0x3912a2c6UL, 0x1dea8068UL, 0xc86d9e54UL),
+    SC(0xc303d808UL, 0x8f33b08bUL, 0xea8e2490UL, 0xd8f4a108UL, 0x27569644UL, 0x9a116564UL, 0x41166838UL, 0x0d6602b9UL,
+       0xaf7a213fUL, 0xd6131447UL, 0x4be0c27cUL, 0x39abbe1aUL, 0x3cc45c97UL, 0x6f28182dUL, 0xcddd7d86UL, 0xef1c26c1UL),
+    SC(0x4f09e673UL, 0xcf4036caUL, 0x6b466d49UL, 0x11b21cb2UL, 0x421ebd98UL, 0x0f336c6fUL, 0x09be27aaUL, 0x7dafa17fUL,
+       0xd0b9b5deUL, 0x0d7517f0UL, 0xf452d744UL, 0xcc5c7201UL, 0xf292df97UL, 0xe70cf642UL, 0x4879267cUL, 0x160ccc96UL),
+    SC(0xcea44dbeUL, 0x7286698cUL, 0xdfb48302UL, 0xdeeb4345UL, 0x71ccabfdUL, 0x844411bbUL, 0xf0d63c70UL, 0x626c8bfdUL,
+       0x2cf9e22eUL, 0x16dbc1feUL, 0x8f159bd0UL, 0x36ff4496UL, 0x7eb0d11dUL, 0x977e181dUL, 0xa885b200UL, 0xa552108dUL),
+    SC(0x799d8d8eUL, 0x8297a1edUL, 0x5052961dUL, 0x646c44faUL, 0x787ec15fUL, 0x62c0ea1dUL, 0x13ba4ac0UL, 0x3b42dc4aUL,
+       0x9ac6c9fdUL, 0xe28c5dbfUL, 0x23c76484UL, 0x6ebae2efUL, 0xb4cd7e57UL, 0x592d6608UL, 0x9ca6fef6UL, 0xfaf148efUL),
+    SC(0xb7630524UL, 0x9472c060UL, 0x168677dfUL, 0x775b6696UL, 0x97f281b1UL, 0x3204908fUL, 0x0dbaaa74UL, 0xb87d555bUL,
+       0x5b157540UL, 0x7c35c69eUL, 0x9537a1e9UL, 0x10410d6bUL, 0x9c6d461bUL, 0x09a00520UL, 0xf6850bc8UL, 0x9628bdccUL),
+    SC(0x9866d83dUL, 0x7d9fe0b4UL, 0x8db8c7bdUL, 0x557326dbUL, 0xc74d757cUL, 0xd0f063b5UL, 0xa05eea98UL, 0x7847758aUL,
+       0xf664b109UL, 0xf96f49f2UL, 0xb06f3886UL, 0x4f7c7e99UL, 0xde8ac6b6UL, 0xec08f946UL, 0x3855bd5bUL, 0xc74f512aUL),
+    SC(0x6b5cf6bdUL, 0x565f780bUL, 0x0ad85093UL, 0x3da4f5e7UL, 0x6a168a5eUL, 0xbb3c4658UL, 0xc9ad6945UL, 0x99ac1d0aUL,
+       0x210f9b03UL, 0x96d9d3c5UL, 0xf2fd3ba1UL, 0xa889cbafUL, 0xfcfe0beaUL, 0xaf2771fdUL, 0xc021659bUL, 0x835e639fUL),
+    SC(0x1164bba1UL, 0xaf12b041UL, 0x55796a4cUL, 0xd5b17da4UL, 0xdb37470eUL, 0x782b7875UL, 0xed553675UL, 0x201d72e5UL,
+       0x9f5e04a3UL, 0x3b913c09UL, 0x56e72111UL, 0xbd99f2e5UL, 0x1de13c2bUL, 0xf496b72dUL, 0x3b7bf9f3UL, 0x42572d37UL),
+    SC(0xee09a791UL, 0x3ddaadbeUL, 0x13b1b198UL, 0xa3e4e63bUL, 0x5cb2f591UL, 0x475827b8UL, 0x1f9b81b4UL, 0x1449dcdaUL,
+       0x88fafebaUL, 0xbdd965bdUL, 0x019bc434UL, 0x8447f3b7UL, 0x91de017cUL, 0x3f89b292UL, 0x4a6c6f76UL, 0x839bc6f4UL)
+  },
+  {
+    SC(0xda34375cUL, 0xe38127dcUL, 0xcc88a823UL, 0x55d763a7UL, 0x2dd5d733UL, 0xd9bac216UL, 0x7c3e621bUL, 0xede529dfUL,
+       0x13426579UL, 0xdb1353d2UL, 0x8095e1f2UL, 0xa007904dUL, 0x5c04a725UL, 0x2c621ce4UL, 0x41157aefUL, 0xd2e28cf2UL),
+    SC(0xa781c07fUL, 0xcb52597eUL, 0xf229d634UL, 0xb3036507UL, 0xc297843eUL, 0x3e784024UL, 0xd38b0025UL, 0x72dc3009UL,
+       0xe4fa3bcbUL, 0x511877f0UL, 0x8369465cUL, 0x475dfbfdUL, 0xe0973309UL, 0xacd09a80UL, 0xa9d191a4UL, 0xe21aaa84UL),
+    SC(0xd879e837UL, 0xbb9174e2UL, 0x19108746UL, 0x91cbe6a1UL, 0x9e19efc6UL, 0x199464d5UL, 0x2c9ba4f1UL, 0xd32fa31fUL,
+       0x0e092c41UL, 0x35550370UL, 0x40c786e7UL, 0xc3d5f72cUL, 0x6be6988dUL, 0x441829e3UL, 0x085b1bfcUL, 0xf1f00bd3UL),
+    SC(0x9fe2fef4UL, 0x5f1c5e21UL, 0x0110aa61UL, 0xee83af2dUL, 0x2d409120UL, 0xc6e510d4UL, 0xdc2945b5UL, 0x936c8ff4UL,
+       0xa1d3701eUL, 0x26007255UL, 0xf4b8db48UL, 0xbc6ef057UL, 0xa7c146ccUL, 0xff50ef2aUL, 0xe5f8d868UL, 0x5a684a4bUL),
+    SC(0xf2266efbUL, 0x749fdf5cUL, 0xdca22ebaUL, 0x8b9d8141UL, 0x4b8cecf0UL, 0x1bb25dbbUL, 0x85f6e3feUL, 0xd88e55c4UL,
+       0x11acf31cUL, 0xad2b4ab6UL, 0xf3036259UL, 0xa3b54bdcUL, 0x6b8100f4UL, 0x36bfc1aeUL, 0xa17ba08bUL, 0x8fdb8bf5UL),
+    SC(0x527063afUL, 0x4e7ebc65UL, 0x2d45ae2cUL, 0xe2149c26UL, 0x0f591b12UL, 0xda157351UL, 0xbf8b97d9UL, 0xd998d007UL,
+       0x03cdb282UL, 0x740ff232UL, 0xd9ac9988UL, 0x8f0c20dcUL, 0x96476b79UL, 0x133af243UL, 0xeeb01413UL, 0x54c71ec8UL),
+    SC(0xaa067591UL, 0xc038a16cUL, 0x2bb18b54UL, 0xc6357140UL, 0x731440f2UL, 0x2b972152UL, 0xd08726cbUL, 0xf5654abfUL,
+       0x81e8b530UL, 0xa4997fd9UL, 0xff4122b8UL, 0xb559c6f7UL, 0x915b3d08UL, 0x96ecc8f9UL, 0xdcf01acaUL, 0xf1f4a61aUL),
+    SC(0x7a147e92UL, 0x6e2b916aUL, 0xc23e4fa8UL, 0xd9349aa5UL, 0x449e65feUL, 0xc52f01cdUL, 0xa7be7863UL, 0xfa2a1bd4UL,
+       0xd13d4e2bUL, 0x4e64a8c7UL, 0x824b3051UL, 0xe277da45UL, 0xfd947048UL, 0xba7f9f09UL, 0x6e6a6189UL, 0xf6ae356bUL),
+    SC(0x394773beUL, 0xc4c8587cUL, 0xa330f243UL, 0x5ac5057cUL, 0xf833333cUL, 0x4693ed63UL, 0x03d0e780UL, 0x8d31dfdcUL,
+       0x1374bfc8UL, 0x7b1a7ad2UL, 0x7c119dbdUL, 0xcea325b2UL, 0x0c663aa4UL, 0x18e9f62aUL, 0xd5cdc878UL, 0x88c8874eUL),
+    SC(0xa1b4eddaUL, 0x14ce5c2cUL, 0xed276886UL, 0x5a3a1519UL, 0xff2b56e0UL, 0xf0e06741UL, 0x613f7b3bUL, 0x37d001b9UL,
+       0xe462525eUL, 0x6a1ca74cUL, 0xbe1e0973UL, 0x139b2f1fUL, 0x2b1458b7UL, 0xdacf6f66UL, 0x0cd80ba4UL, 0x1195516fUL),
+    SC(0x0a2a20abUL, 0xb8cb4a84UL, 0x9625000dUL, 0xa2ab6d80UL, 0x6a2006d7UL, 0x6994069bUL, 0x2e50c83eUL, 0x4aaa183dUL,
+       0x3850f9d7UL, 0xbfe1c1dcUL, 0xb066f603UL, 0x08a71f78UL, 0x352d4cfbUL, 0x44a7d646UL, 0x81b86a7dUL, 0x23b0b468UL),
+    SC(0xd66412acUL, 0x030ed909UL, 0x4c282dabUL, 0xc40624ffUL, 0x7fc5a593UL, 0x494a9be2UL, 0x954d0cd4UL, 0x961999fdUL,
+       0xad6ad3d1UL, 0xe3be49b5UL, 0x402880f4UL, 0xc67d1546UL, 0x7b6d01fdUL, 0x63e4f45fUL, 0xf87e5901UL, 0x7b8445a1UL),
+    SC(0xca666365UL, 0x71fad850UL, 0x3205e1d3UL, 0x6c0b0062UL, 0x9a6347b9UL, 0xb9ad0a92UL, 0x10ba208bUL, 0x57fcd0e8UL,
+       0x821d0deeUL, 0xefc2bf47UL, 0x4e575d10UL, 0x83d63505UL, 0x67235026UL, 0xe50d9fadUL, 0x541fb097UL, 0x2cb196faUL),
+    SC(0x310184cfUL, 0x7c38bb82UL, 0xb04a80a7UL, 0x5c4678a9UL, 0x985336b0UL, 0xf60acee2UL, 0x2a048e87UL, 0xbfbc6970UL,
+       0x4e21334dUL, 0x6440e46bUL, 0xa12bc971UL, 0x31d55598UL, 0x94ec8648UL, 0xab901a94UL, 0xc757b957UL, 0x662b41f8UL),
+    SC(0xe051316aUL, 0x62329ec5UL, 0xadd4bf12UL, 0x4fe30288UL, 0xdacf5e82UL, 0xb0977184UL, 0x7c64bb4aUL, 0x8c77802eUL,
+       0x3358bcbfUL, 0x94e23384UL, 0xc9be2d87UL, 0x79d56ab9UL, 0xcc0fe4ceUL, 0x23eb227aUL, 0x741a3be5UL, 0x3fdf36adUL),
+    SC(0x1dee1a31UL, 0xe28d970dUL, 0x11436760UL, 0x7861cd75UL, 0x292cfc9fUL, 0x533197b6UL, 0x7ce40e8cUL, 0x62db266cUL,
+       0x7f9c4f61UL, 0xf534b388UL, 0x7f00bf73UL, 0x469601c0UL, 0x9c6971cfUL, 0x3ecbded7UL, 0x63560e1eUL, 0xccd0e32bUL)
+  },
+  {
+    SC(0xa80dd274UL, 0x9cb3c40dUL, 0xaf91b91fUL, 0x6e8b0850UL, 0x027fae17UL, 0x96e416fbUL, 0x8a172c27UL, 0xd39e8789UL,
+       0x466161e1UL, 0xe9519ac5UL, 0xe1b03652UL, 0xcd1ce6cdUL, 0x1d7dc696UL, 0xaa59ab5cUL, 0x565d822fUL, 0xaf427896UL),
+    SC(0x493c8d4aUL, 0x8a53ccc5UL, 0x67d531a4UL, 0xc833a8c2UL, 0x6ebb3337UL, 0x9f1f2330UL, 0x9ffc7a5fUL, 0x90ad860cUL,
+       0xeb52116bUL, 0xe4f5075eUL, 0xe391948eUL, 0xd7970c28UL, 0xce156e22UL, 0xcd3e5820UL, 0xed0158a2UL, 0x1158ea73UL),
+    SC(0x42a51205UL, 0x5158eff9UL, 0xed9b2df3UL, 0x3f17a809UL, 0xddea781bUL, 0xb0cad4f7UL, 0x5ee9b16dUL, 0xf03447e0UL,
+       0x4b305c2aUL, 0x0987f11cUL, 0x1700cc3cUL, 0xb09914b1UL, 0x0cb30379UL, 0x0257c122UL, 0xcab089daUL, 0xb0115e93UL),
+    SC(0xeeac8ba6UL, 0xc3397ecbUL, 0xad93a0b5UL, 0x1cbc9108UL, 0x29aefb53UL, 0x50a9bb5eUL, 0x1db9ea58UL, 0xa33dcab5UL,
+       0xe0eaa01aUL, 0x4596cbfcUL, 0x76f418c2UL, 0x6fa382abUL, 0x699e8ea6UL, 0x1b700f76UL, 0x98f5b913UL, 0xda774b70UL),
+    SC(0x33e903c6UL, 0x0ee45628UL, 0xdb06afdeUL, 0xdace17e8UL, 0xbf8ff9b2UL, 0xa4d1e3c2UL, 0xc43ab4dfUL, 0x693d71a8UL,
+       0xa9abf657UL, 0x094edb2cUL, 0x80a50e5cUL, 0xe210f39cUL, 0xfd37ce86UL, 0x5eafac01UL, 0x65191debUL, 0xadc9f379UL),
+    SC(0x4af6278dUL, 0x2c4ea624UL, 0xc4a7c264UL, 0x5fc4e5c3UL, 0x85a983e0UL, 0x1f5c0c2aUL, 0xbab8c101UL, 0x8ab36425UL,
+       0x4af48c96UL, 0x64a8e40eUL, 0x33812cf2UL, 0x6a4495d9UL, 0x8bb7bc4dUL, 0x3455e03cUL, 0x21ed94f1UL, 0xe6fcb069UL),
+    SC(0x2855cffeUL, 0x89b73f36UL, 0xc4851fa3UL, 0x092ffec8UL, 0x5b7b4c7dUL, 0x83998c67UL, 0xee8e710aUL, 0x473c9f72UL,
+       0xecd7c273UL, 0x0c26c1d7UL, 0x4de7bffaUL, 0x6bd26a51UL, 0xcfbf9716UL, 0x7e9875daUL, 0xcab2e632UL, 0x25766e83UL),
+    SC(0x1b06d384UL, 0xd0fb68d6UL, 0x396314d6UL, 0xa6f12d91UL, 0x3853306fUL, 0x1a904494UL, 0x24fb2c2eUL, 0x0d73e88eUL,
+       0x3de9709cUL, 0xcfb21234UL, 0xf8d687a2UL, 0xe6364cafUL, 0x74ec05e2UL, 0x82245cf5UL, 0x9fe5d37eUL, 0xe7e3e7b5UL),
+    SC(0xcef34326UL, 0x559a1922UL, 0xff354887UL, 0x54a1bc1bUL, 0x72d70955UL, 0x33591c3aUL, 0x9a2b871dUL, 0x8845a9a0UL,
+       0xaa2a7c74UL, 0x6a149cebUL, 0xb276bc9fUL, 0x860a96d0UL, 0x285e9a46UL, 0xd62b2c15UL, 0xc9a78701UL, 0x7cdba153UL),
+    SC(0x39e39d53UL, 0xd9c619beUL, 0xc9204156UL, 0x1c8dd8d1UL, 0x4f5cba0cUL, 0x94d93295UL, 0x352c8448UL, 0xd9ab988cUL,
+       0x56c6817cUL, 0xa33aabedUL, 0x00d8b724UL, 0x754e8764UL, 0x72e065faUL, 0x357917abUL, 0xd9d03199UL, 0x4c04c3dcUL),
+    SC(0x28cf0dccUL, 0x2765d3a8UL, 0xae99c40fUL, 0x57d14adcUL, 0x5d21e730UL, 0x271f2465UL, 0x142c5369UL, 0x80b21878UL,
+       0x908d84d6UL, 0x3774fb34UL, 0x774931b2UL, 0x12530d35UL, 0x8565392cUL, 0x6ec35541UL, 0x1cba899bUL, 0x3fa29e7cUL),
+    SC(0x383ae3fcUL, 0x07967167UL, 0xad6dc50dUL, 0x4af64da0UL, 0xf5c44be5UL, 0x04ac33d3UL, 0x6779a8e4UL, 0x7ec657d5UL,
+       0x11ae57f7UL, 0x6ef344c1UL, 0x263974e4UL, 0x25f27e6cUL, 0xc68d25afUL, 0x3c748935UL, 0x0f554e4fUL, 0x5cc16ba2UL),
+    SC(0x9f11beeeUL, 0xfdf9dbbdUL, 0xc9487b01UL, 0x869a7b18UL, 0xc8db78d1UL, 0x36027914UL, 0x00bf363fUL, 0x951b1b6fUL,
+       0x335899a8UL, 0x7abd3401UL, 0xd2ca87f1UL, 0xca330c10UL, 0xc098f7abUL, 0xcc2d0206UL, 0xfaa0d8aaUL, 0xe7726aaeUL),
+    SC(0x34278948UL, 0xb6755e7fUL, 0x2faa3674UL, 0xf766e6dcUL, 0x5029c644UL, 0x55f7ba86UL, 0x34e45370UL, 0xa244eac6UL,
+       0xf6e04f4aUL, 0xf27a8768UL, 0x23de58c9UL, 0xd2ecfcaaUL, 0x63a5027eUL, 0xb6c7cb1bUL, 0x428a159eUL, 0x2110537aUL),
+    SC(0x44828d6fUL, 0x29e24d8fUL, 0x1e1fd7e6UL, 0x13bec429UL, 0x27a1fa28UL, 0x803b1ce8UL, 0xac43804aUL, 0xbc2a4411UL,
+       0x4781fc5cUL, 0x6039f0f5UL, 0xfba6d3feUL, 0x4fa8cc9dUL, 0xbf9c3ee0UL, 0x4c42a0f1UL, 0x8835ecbcUL, 0xb15a2168UL),
+    SC(0x903910a7UL, 0x1cb1f65cUL, 0x838f84afUL, 0xa3167c3dUL, 0xf396436bUL, 0x1c76403aUL, 0x5526344cUL, 0xecb0a948UL,
+       0x19978bd9UL, 0xd0563fbeUL, 0xd9cb07c6UL, 0xf88e563aUL, 0x7aa007d2UL, 0x562feeddUL, 0x05c8fad6UL, 0xe555e66aUL)
+  },
+  {
+    SC(0xb3dee3f6UL, 0xcc08c0baUL, 0x5b7ba3b8UL, 0x50469647UL, 0x34f7dca1UL, 0x630e806eUL, 0xf84157e8UL, 0x2992c765UL,
+       0xd523bf3cUL, 0x6b004cbdUL, 0x59db62b2UL, 0x58395f63UL, 0xd487d6ceUL, 0x31799ee1UL, 0x59ddf96eUL, 0xd9bae2e8UL),
+    SC(0xf5c52e87UL, 0x8142cf16UL, 0xd01aa78fUL, 0x179460fdUL, 0x7a8d7645UL, 0x498118a1UL, 0xa1ec386bUL, 0xc2860a44UL,
+       0x868b7621UL, 0xa41ca177UL, 0x84d6b4a4UL, 0xd5a5ac40UL, 0xecced5eaUL, 0xd8d5bf13UL, 0xe5bfa29aUL, 0x5f998c38UL),
+    SC(0x26412ec7UL, 0xe11e9347UL, 0xd515de0eUL, 0x98e14920UL, 0x522610a7UL, 0x2c090b51UL, 0xf03bf049UL, 0x86738df7UL,
+       0x11a10543UL, 0x0394f932UL, 0x19284377UL, 0x1a2d0741UL, 0xebd89e8bUL, 0x4a0c0dfaUL, 0x08f8cc5cUL, 0xdb7cc207UL),
+    SC(0x8e313452UL, 0x7bc65ca9UL, 0x241666a8UL, 0xbec7c6f9UL, 0xb92f2f46UL, 0xc91c3843UL, 0xe430a22cUL, 0x4e6a92fbUL,
+       0xbf6e2a1fUL, 0x122f4b35UL, 0x0aadf5b3UL, 0xc03be0d8UL, 0x406c0b74UL, 0xc3e48b1cUL, 0x85023996UL, 0xa0eb1214UL),
+    SC(0xed72bb0fUL, 0x4800c2f4UL, 0x2db83b49UL, 0x137af4fdUL, 0x40d53e5eUL, 0xd690fe42UL, 0xb93d8cf4UL, 0xa603d3daUL,
+       0x4dc24219UL, 0x6e195c7cUL, 0xc1bd412aUL, 0xa0982a97UL, 0x80ed39c7UL, 0xc1f34181UL, 0x6540ea3aUL, 0xe52f0c27UL),
+    SC(0xa84809bfUL, 0xa6592d13UL, 0x47f1f37cUL, 0xe7a052beUL, 0xd4a5e06eUL, 0xe27c369aUL, 0x61a74f26UL, 0x552786caUL,
+       0x7bb26691UL, 0x5e544c06UL, 0x0cb7aec5UL, 0xaa61979cUL, 0xa77bbb52UL, 0x67dbaa2dUL, 0x13517b40UL, 0x3ead93cbUL),
+    SC(0x889c0732UL, 0x6ba150ebUL, 0xcbe394a5UL, 0x3bc9eed1UL, 0x1c6759b0UL, 0x4f8b82f9UL, 0x79f24efdUL, 0xb2469dffUL,
+       0x6c9a2c99UL, 0x7ee4f506UL, 0xd3150ddaUL, 0x71ff54f0UL, 0x88d8c904UL, 0x596fd99dUL, 0xd2f5017cUL, 0x9d72fac6UL),
+    SC(0xb6f64c81UL, 0xb5e1ea08UL, 0x8b712eb1UL, 0x7a7ba7c4UL, 0xff4821e9UL, 0x03e68c16UL, 0x7f385e5cUL, 0xd5e097e5UL,
+       0x99286e7bUL, 0x2c2b49f6UL, 0x2c2a5d9aUL, 0x058db244UL, 0x5e5f4981UL, 0xb1a7f40bUL, 0xb0f86004UL, 0x40e249a7UL),
+    SC(0x04b131fcUL, 0x5d5c5020UL, 0x48aa2195UL, 0xc079cb10UL, 0x8bd101bfUL, 0xbf4f54dbUL, 0x793bff99UL, 0x3c2e4a0fUL,
+       0xa689fc36UL, 0xfb782cb5UL, 0xc9722f4fUL, 0x8f123ab9UL, 0x05fc02ddUL, 0xd1caafd7UL, 0xeee117e2UL, 0xe58c6609UL),
+    SC(0x8bc5c221UL, 0x9248c065UL, 0xb713a126UL, 0xfacbeb63UL, 0x0ef435ceUL, 0x6759ced7UL, 0x62e189d8UL, 0x82adfb92UL,
+       0x6663fdc7UL, 0x32a65abcUL, 0x8b207cadUL, 0xdd72ed15UL, 0x68bdf3bfUL, 0xc2e84345UL, 0x9f964f73UL, 0xfa325216UL),
+    SC(0xad8ca6f2UL, 0xf29699e7UL, 0xc4b055c5UL, 0xbac3738eUL, 0xd3b390dbUL, 0x21512a70UL, 0x0c3bc452UL, 0x0e231722UL,
+       0xfbfd004dUL, 0x174964ffUL, 0x273fe355UL, 0x0d76281fUL, 0xb47fa1beUL, 0xeae7ec13UL, 0x6e4cb5caUL, 0x5e703b54UL),
+    SC(0x12270e16UL, 0xb82ac7b2UL, 0x20bee7f9UL, 0x8c45c6d7UL, 0x87d14d3cUL, 0x2e9a2201UL, 0x67650e2dUL, 0xc56110b0UL,
+       0x390c44c7UL, 0x4d01351fUL, 0x78b80029UL, 0xe84b211dUL, 0x04cba691UL, 0x1201864aUL, 0xd0632466UL, 0xee747badUL),
+    SC(0x48cb4d0fUL, 0xe669f556UL, 0x5c7e630bUL, 0xbf435d0cUL, 0xb0b47511UL, 0x553301ddUL, 0xa9bf6e35UL, 0xb59fb9cdUL,
+       0xbe02b272UL, 0xe6fb4e3eUL, 0x79d6655aUL, 0xaa37a132UL, 0x8649b74dUL, 0x4ab6d733UL, 0x6cbcd1cbUL, 0xd02d3f60UL),
+    SC(0x558b4a91UL, 0xb01ae7afUL, 0xdbe952beUL, 0xe03987d2UL, 0xbc64337aUL, 0x8178c079UL, 0xf06ee88eUL, 0x88b4fcc1UL,
+       0x1dd61340UL, 0xab7dd93aUL, 0x06b6e169UL, 0xa4879fbfUL, 0x75d24270UL, 0xb0708cc7UL, 0x51552ca4UL, 0xf6018052UL),
+    SC(0xaf5fb90bUL, 0xd4d48260UL, 0x9fc8f8b4UL, 0x34724c8dUL, 0x162997f2UL, 0xa6afe68dUL, 0x97a6bf46UL, 0x629aee86UL,
+       0xddfea22bUL, 0x6fd0c331UL, 0x68a196aaUL, 0x29c0f0c6UL, 0x7e828768UL, 0x15527132UL, 0x99c37e69UL, 0xf788c4adUL),
+    SC(0x2ba58b64UL, 0xb588a995UL, 0x3872a303UL, 0x8f478ee7UL, 0xae03b805UL, 0xafa95c54UL, 0x62920a80UL, 0x8a12228fUL,
+       0xb902f3efUL, 0xaa4a081dUL, 0x1260030dUL, 0x44d31436UL, 0x7c5a5b7fUL, 0x4ccc47c0UL, 0x1f82035dUL, 0xaf92c39eUL)
+  },
+  {
+    SC(0xdf9c2e20UL, 0x68e1e333UL, 0xf6acc6c3UL, 0xba9928ebUL, 0xe761d4b0UL, 0x27eaa1deUL, 0xdae18079UL, 0x29705021UL,
+       0x491f455bUL, 0x6e937f91UL, 0x35fe9060UL, 0xa8c5b6c1UL, 0x60de5af9UL, 0xba90aba4UL, 0xc060145aUL, 0xda1b032dUL),
+    SC(0x17cdf19bUL, 0x1f93cbf4UL, 0x47e2f77cUL, 0x6f4adee6UL, 0x0bb62f01UL, 0x8011e8c9UL, 0x965eb336UL, 0x899d4b6bUL,
+       0x5d5d7d2bUL, 0x33222edeUL, 0xaa07c15dUL, 0x7f07981bUL, 0xa7a80c94UL, 0xd9a4f2feUL, 0x7413b4c1UL, 0xdff20e7bUL),
+    SC(0xde7b1e48UL, 0x3d1e4e54UL, 0x039a65abUL, 0xb74bf705UL, 0x92a75671UL, 0x11f83390UL, 0x78699547UL, 0xad798cddUL,
+       0x61087a47UL, 0x1c37aa33UL, 0xf538234aUL, 0x9179e9eeUL, 0xb4af8e89UL, 0x7d1f5afbUL, 0x497ae5acUL, 0x8609f8ceUL),
+    SC(0x8baae56eUL, 0x4774ca16UL, 0x4bb58827UL, 0x896bb7fdUL, 0x6dbde044UL, 0x3e88eb57UL, 0xaef2cd98UL, 0xe3968870UL,
+       0x7edcb7e0UL, 0x29411a39UL, 0xbdc581d3UL, 0x3a8769daUL, 0xd0bb62b7UL, 0x49e2e05eUL, 0x4b698b73UL, 0x0d77471dUL),
+    SC(0x74bcf4a8UL, 0x18f280aeUL, 0x6216e44bUL, 0xfa8c65f5UL, 0x04de08eeUL, 0x14f2451eUL, 0xab85dbb6UL, 0x33ecbc27UL,
+       0xa72d7c82UL, 0x19b2307aUL, 0x3747a6afUL, 0xe17480bcUL, 0x12fbadd9UL, 0xf326a09bUL, 0x442e5f7cUL, 0xfa18aa28UL),
+    SC(0x8c24276aUL, 0x5f468d59UL, 0xd55a0eceUL, 0xffd642caUL, 0xad8a7dbfUL, 0xbd3ca6e9UL, 0xabda6a3cUL, 0x3e66c01cUL,
+       0xb7463b3bUL, 0x06fddb0cUL, 0xcc2b9006UL, 0xa7af9ba5UL, 0x346921c1UL, 0xccfd24e7UL, 0x4bb2d09eUL, 0x9cf78c16UL),
+    SC(0xca4c86a5UL, 0x438e1b85UL, 0xaeb79319UL, 0x95bb4cbbUL, 0xc2ca6eebUL, 0x22eb18c4UL, 0x449f8050UL, 0xf8403023UL,
+       0x6a86b9d2UL, 0xd205188eUL, 0xf6bd4414UL, 0x1f9948dfUL, 0x7d9bb06aUL, 0x538d5016UL, 0xfe310d53UL, 0xb3a95d18UL),
+    SC(0x768b3d99UL, 0xcf1a2d36UL, 0x972615c0UL, 0xb9dd964fUL, 0x74692061UL, 0x01d36bbeUL, 0x00892512UL, 0x5855ae6cUL,
+       0x5e821acdUL, 0x1a49c270UL, 0xb589b382UL, 0x159ee4aaUL, 0xddf1a163UL, 0x3f00513aUL, 0x935f0f05UL, 0xd4174dc9UL),
+    SC(0xf69a77b2UL, 0x368aa4d3UL, 0x55639610UL, 0xd3a4d6b2UL, 0x72638efdUL, 0x4ae36772UL, 0x3868146cUL, 0x50a81e0cUL,
+       0xafc09ceaUL, 0xe975c008UL, 0xc02827f2UL, 0x86b4a85aUL, 0x25e9f5adUL, 0x7e26ddf5UL, 0x0fe73f77UL, 0xedff3141UL),
+    SC(0x4d266e6dUL, 0x8805e372UL, 0x2ae985c0UL, 0x3f808e09UL, 0x04012a97UL, 0x23cde34bUL, 0xcc119732UL, 0x1e3eeb4dUL,
+       0x5747f4bbUL, 0x38eb2a19UL, 0x74315a74UL, 0x7fecf1beUL, 0x2633e3b6UL, 0x93a6571aUL, 0xe08bc2d6UL, 0x8ee984abUL),
+    SC(0x6ccfa6faUL, 0xa5bc8629UL, 0x10cffbd1UL, 0xc7815328UL, 0xbbe40716UL, 0x62b6e66fUL, 0x3e6db1feUL, 0xd796430fUL,
+       0x1bb21cdfUL, 0xc4aeb248UL, 0x454a6e96UL, 0xe6399a56UL, 0xe872effbUL, 0xed3c89b6UL, 0x95d52598UL, 0x6b801367UL),
+    SC(0x2bcac4d9UL, 0x0ad3f7bbUL, 0x784ff508UL, 0x3ee24058UL, 0x871f92c6UL, 0xdb50cefaUL, 0x3d84707eUL, 0x8576c271UL,
+       0xc2faffb2UL, 0x0f59066fUL, 0x1ef1e186UL, 0x3510f9d8UL, 0x236d9d6cUL, 0x37a9d5e2UL, 0x9dc1bd37UL, 0x1a349074UL),
+    SC(0x4ab261a1UL, 0x8413f27aUL, 0x328dd402UL, 0x4dcdc6fcUL, 0x6d31d071UL, 0xf479d8c0UL, 0x0f1857f0UL, 0x2ace11a1UL,
+       0xe53ea413UL, 0x8cd3ff01UL, 0x21acc725UL, 0x345ce814UL, 0xa6739aeaUL, 0xe4600dbbUL, 0x258df68eUL, 0x9e3dc4ebUL),
+    SC(0x7c276455UL, 0x398e6e95UL, 0x45e253a6UL, 0xb6381d74UL, 0x1cee69cbUL, 0x214686beUL, 0xa81435d1UL, 0x0eb90c86UL,
+       0x704bebf6UL, 0xc434161aUL, 0x66db20b9UL, 0x5c859064UL, 0x0a339ffcUL, 0x35510e49UL, 0xbc378440UL, 0xf6794d09UL),
+    SC(0xb3a041b7UL, 0xcf5e1d80UL, 0xed040d11UL, 0x0851e5e5UL, 0x292b7a20UL, 0xb125f018UL, 0x979d2853UL, 0x04e0b2d6UL,
+       0x0f8f8767UL, 0x5801504bUL, 0x98013371UL, 0x525962f8UL, 0xd40b44fdUL, 0xd54862eaUL, 0x4bd33629UL, 0xb34deba9UL),
+    SC(0xd10e348fUL, 0x403ae107UL, 0x5ac0f8afUL, 0xb81b17a3UL, 0xaa0d51f9UL, 0x2cc8d271UL, 0x2bb2d4f4UL, 0xcea9a881UL,
+       0x05fd767bUL, 0x030135e1UL, 0x0418ee9bUL, 0xb83719e0UL, 0x5f99c3a8UL, 0x87733c13UL, 0x695dbdceUL, 0xc1b26ec0UL)
+  },
+  {
+    SC(0xafdfa934UL, 0x6f7bcc74UL, 0xec473e17UL, 0xf5048650UL, 0x11c5251bUL, 0xbd6c0c70UL, 0xc25cb561UL, 0x4b004da8UL,
+       0xb16eec26UL, 0xd575cec6UL, 0xb8720f94UL, 0x04ccddddUL, 0x78a5c446UL, 0x0a0cf286UL, 0xfd933f6aUL, 0x999a4a39UL),
+    SC(0x5a4fce51UL, 0xd54d54baUL, 0xb8148e3fUL, 0x2f8da91aUL, 0x50c5a4c0UL, 0x409be13bUL, 0x0723f3edUL, 0x7879e1e2UL,
+       0x5ae7c52cUL, 0xf602d6d3UL, 0xb68f6989UL, 0xf6e7cb97UL, 0x484de6f8UL, 0xd729dbbeUL, 0x587756b8UL, 0xcc8b2d1aUL),
+    SC(0x53831467UL, 0xeba14563UL, 0x3181b826UL, 0x839812e3UL, 0x36c1a17dUL, 0xffe4bfaeUL, 0xf2baec53UL, 0xff428d8eUL,
+       0x0fa471d8UL, 0x73ba000cUL, 0x08d23b0dUL, 0x6bf79d36UL, 0xf57a7852UL, 0x4aa8c52bUL, 0x227fc42cUL, 0x400b4fe9UL),
+    SC(0xab384400UL, 0x3f19fcfcUL, 0x010055f6UL, 0x290a0540UL, 0xcf2242d0UL, 0xccab8a4cUL, 0x40319440UL, 0x54f0aebbUL,
+       0xaf368bcaUL, 0x0e17e62aUL, 0xec0a5544UL, 0x4d65ecd3UL, 0xa497306aUL, 0xeff4a439UL, 0x92e7d1d8UL, 0xed5495eaUL),
+    SC(0xed08f215UL, 0x50f6510eUL, 0xe8cb5e09UL, 0x53ca47a3UL, 0x9a140441UL, 0xcd7dc8acUL, 0x2c319ca8UL, 0xcd51c781UL,
+       0x39e4c088UL, 0x589c9851UL, 0xb78aef9fUL, 0x33678f7cUL, 0x0ed46d4aUL, 0x658ccf49UL, 0xb1c4de72UL, 0x9fe3b64fUL),
+    SC(0xfeba0c3dUL, 0x930d3c71UL, 0xd2edd2e8UL, 0xe63e5f67UL, 0x3f81ea4aUL, 0x5f8890ebUL, 0x3fdc6e6eUL, 0x9c729830UL,
+       0xa507a2a8UL, 0xa0fd3d76UL, 0x214f59d0UL, 0xcab63525UL, 0x54148970UL, 0x7cd0ae2cUL, 0x6488efacUL, 0x7d494d99UL),
+    SC(0xf5da1419UL, 0xbe3e268dUL, 0xb51dea4bUL, 0xaf8867f0UL, 0xa02a29c9UL, 0x599266e6UL, 0x00e0e37bUL, 0x0d569d8bUL,
+       0x01ecd596UL, 0x4748be32UL, 0x44cfe953UL, 0x6fa9ae30UL, 0x104b1e6bUL, 0x8ccd69f4UL, 0x1e5891e2UL, 0x242db1c8UL),
+    SC(0xeaae3a45UL, 0x5aa38fedUL, 0x381ed64fUL, 0xb6353d0fUL, 0x2236d267UL, 0x97f5dc1aUL, 0x04e7a511UL, 0x1654be5bUL,
+       0x24f1deddUL, 0x7f3d9cefUL, 0x572e7819UL, 0xb09be2a0UL, 0xde1f2f4aUL, 0x6b2314f7UL, 0x57a81b18UL, 0xcd1fdd08UL),
+    SC(0xa997a9f1UL, 0xe9fb824dUL, 0x768fa890UL, 0xb91ec55fUL, 0x0c851127UL, 0x5c16eb4aUL, 0x99577fe4UL, 0x87d155e5UL,
+       0x9cf136a2UL, 0xc3fd76f8UL, 0xd4921bbaUL, 0x09d61917UL, 0x0b6ebbfaUL, 0xf55a4cf5UL, 0x69665d47UL, 0xbce7a44cUL),
+    SC(0x0f20287bUL, 0x958ffe72UL, 0x72d443cdUL, 0xde9fa6f5UL, 0xf9ab208fUL, 0xa74c6147UL, 0x10c44c33UL, 0x003777f1UL,
+       0xce614f5fUL, 0x87c3a366UL, 0x65d7f574UL, 0x5446d80aUL, 0x035a8113UL, 0x1fb4dd2aUL, 0xaabed948UL, 0xb9e09931UL),
+    SC(0xf9fb85f3UL, 0xfc4e45a1UL, 0x6b6eef55UL, 0xcd8656dbUL, 0xde777390UL, 0x0f20b576UL, 0xa28110daUL, 0xe8ce5713UL,
+       0x51de9f5aUL, 0x7b2f0101UL, 0xcd02e6c7UL, 0xc98cdf93UL, 0xa430d62aUL, 0x1fec4f3eUL, 0x95bdc3bfUL, 0xa2212e13UL),
+    SC(0xd5fa0933UL, 0xf13c1f4eUL, 0x89caeba4UL, 0x101f44c0UL, 0x420da5c6UL, 0x7bfe1ea9UL, 0x66cf01a5UL, 0xef48b1d8UL,
+       0x5efc8918UL, 0x8b9eb65dUL, 0xfaa6e0e9UL, 0x812407efUL, 0x0035d8dbUL, 0x76f9e722UL, 0xff63bc3cUL, 0x3afc3b1aUL),
+    SC(0x93899e6fUL, 0xfc291a4bUL, 0xe986f938UL, 0xb8b378beUL, 0xbf4c3d35UL, 0xf9a1bdd3UL, 0xecea5f04UL, 0xd8f4badaUL,
+       0xa19a2983UL, 0x55cb62fcUL, 0x43334649UL, 0x1c89f26dUL, 0xfbb67bc3UL, 0x872f7512UL, 0x9229cb73UL, 0xd126293eUL),
+    SC(0x8fe07488UL, 0x0b5b173cUL, 0xd530d796UL, 0xa18eac08UL, 0x80164c2aUL, 0xed787b05UL, 0x90ac8dceUL, 0x3bb120d8UL,
+       0x829abce1UL, 0x43ea8009UL, 0xe4f5f481UL, 0x125ca6d4UL, 0xecff3f32UL, 0x577cdbf1UL, 0xc054a23eUL, 0x67f18b0bUL),
+    SC(0x10c3b093UL, 0x5461407cUL, 0x369494a7UL, 0x631eb4a2UL, 0x365b122eUL, 0xce0a6b95UL, 0x7c1bdbeeUL, 0x387394a4UL,
+       0xf09d69ecUL, 0x925c9a43UL, 0x57648509UL, 0xf7db85a9UL, 0x22f609cdUL, 0x32b400ceUL, 0x03a80567UL, 0x88a74627UL),
+    SC(0xcfe48dfcUL, 0xf5566fbdUL, 0x7562ed68UL, 0x576a7911UL, 0xbaef64f0UL, 0xdc63e158UL, 0x1a29bf23UL, 0x3e1a058eUL,
+       0x440c6051UL, 0x19f2a948UL, 0xb4b6c3a2UL, 0x7e711ceaUL, 0x0c7983d7UL, 0x0f4a2db9UL, 0x537536dbUL, 0xfdebab76UL)
+  },
+  {
+    SC(0x53d772b6UL, 0xb18211f7UL, 0x1478e9d3UL, 0x3a0c061eUL, 0x2d232358UL, 0x44177867UL, 0xaf91508dUL, 0xe014f22dUL,
+       0xb2e85a07UL, 0x8160d31cUL, 0x3ca32d9cUL, 0xba025904UL, 0x1bea0368UL, 0xd9eb13deUL, 0x8af8f505UL, 0x73142ed8UL),
+    SC(0xb9d6067cUL, 0xfc26ba4aUL, 0x1f5bab8eUL, 0xd5f28ffcUL, 0x00bb6bd6UL, 0xb61990c4UL, 0x1b091ec8UL, 0x2cba973fUL,
+       0x0532d0abUL, 0x7731c02dUL, 0x91cc7e51UL, 0x71b625b3UL, 0x0af5a605UL, 0xd92d02a5UL, 0xfc4cee4fUL, 0xafa09ebbUL),
+    SC(0xe8a93cebUL, 0x3db0a4a3UL, 0x9a3b768cUL, 0x700fb504UL, 0x652161e0UL, 0x4a1d4d92UL, 0xdf52cd4bUL, 0x83e65e38UL,
+       0x791b967fUL, 0x22543feaUL, 0x9ec38e5eUL, 0xa14a94ccUL, 0x9d11ea8aUL, 0x73ca0c13UL, 0xe022d53bUL, 0xf8bf1148UL),
+    SC(0xac6130f7UL, 0x41e1601fUL, 0x5a92bb75UL, 0x90a799a8UL, 0x03e8ad9cUL, 0xc911ed7bUL, 0x7dee1bcfUL, 0xda14f332UL,
+       0x97ea5d16UL, 0xd5c7e368UL, 0xc7b97c2dUL, 0x7283cb03UL, 0xf215f79cUL, 0xd1d80276UL, 0x6f9923e0UL, 0xce80ce44UL),
+    SC(0xac34d4c1UL, 0x1d2d4adeUL, 0x2f044e88UL, 0x6b57cd45UL, 0xc1b23550UL, 0x538059c4UL, 0xe9855077UL, 0x4132643cUL,
+       0x7191e155UL, 0xaeb3b578UL, 0x6b55db41UL, 0x652e8af2UL, 0xbac1f933UL, 0xd6f62723UL, 0x808c6172UL, 0xbf0eb0aaUL),
+    SC(0xa7c4bafbUL, 0xf1988992UL, 0x1ce15754UL, 0x187d41b9UL, 0x0eb653ddUL, 0xbc97cf05UL, 0xddf449d8UL, 0xc9ff734cUL,
+       0xccf20733UL, 0xda4aab6dUL, 0x81db8d5aUL, 0xd3f12d1dUL, 0x09cbc943UL, 0x8b92165cUL, 0xe83c5afaUL, 0x5ee108e3UL),
+    SC(0xc04ba857UL, 0xe758fdb0UL, 0x29c02712UL, 0x1671fe33UL, 0x9b7184b3UL, 0x50ad952eUL, 0x9d234681UL, 0x43f7568dUL,
+       0x9ce5d9caUL, 0x65f96b76UL, 0xb4b06f57UL, 0xf34de7e3UL, 0xc64a1d21UL, 0xf07fd6fdUL, 0xeb7d47e7UL, 0xbbf4e6c8UL),
+    SC(0x8230e7e7UL, 0x81259e58UL, 0xe9b74a49UL, 0x340733dcUL, 0x252bef7bUL, 0x05b7dc82UL, 0xa4e99f0bUL, 0x2998ba67UL,
+       0x09c71921UL, 0x3b3254d1UL, 0xf53b4f30UL, 0xd0a8e665UL, 0x186e272cUL, 0xd0e5d316UL, 0xa7451eb3UL, 0x2ac8bb3fUL),
+    SC(0x720c2f5fUL, 0x6465d38dUL, 0x3916939fUL, 0x8d095657UL, 0xe547cc5fUL, 0x849f4a41UL, 0x030485b1UL, 0x2d94b5c7UL,
+       0x8635961fUL, 0x5f74d176UL, 0xe4ae0ec6UL, 0xe4b3b394UL, 0x6d5b1766UL, 0xfcb902fdUL, 0x9f9bd982UL, 0x2ad4e4c4UL),
+    SC(0x263b45caUL, 0xb3547cf1UL, 0x5eca4381UL, 0x3d1c402eUL, 0x5c209d3eUL, 0x34a288cfUL, 0x182aa4a3UL, 0x0f04304fUL,
+       0x3516b1f3UL, 0x524bbdccUL, 0xfddd94bcUL, 0xfb86a43aUL, 0x27a7a78aUL, 0xfcbbefddUL, 0x6692fc21UL, 0x87364438UL),
+    SC(0x4edb7d61UL, 0xa45ebb51UL, 0x1fb0c220UL, 0x6f16fe60UL, 0x5a202976UL, 0x9007c3e7UL, 0x11b94889UL, 0xa983d0c8UL,
+       0xb482fee3UL, 0xfe824b1aUL, 0x3251cd2cUL, 0x3f38ab4fUL, 0xadad1feeUL, 0xd398be92UL, 0x58d2c81dUL, 0x79b0eb36UL),
+    SC(0xf44c286aUL, 0xb8196e25UL, 0x87c225f7UL, 0x2091db05UL, 0x0e47f18bUL, 0x05b9a0b9UL, 0x79d2cd3bUL, 0x15441767UL,
+       0xb7aa2018UL, 0x5925845eUL, 0x661ad980UL, 0xa6c215d5UL, 0xfd7072cbUL, 0x46010930UL, 0x0ae64089UL, 0x4c8a0af8UL),
+    SC(0x593f9bddUL, 0xb246bd1eUL, 0x19eeaafaUL, 0x017e348eUL, 0x5199deccUL, 0x8e63ef68UL, 0xed8bff89UL, 0xbdffad48UL,
+       0x5201d11fUL, 0xa4ac67dbUL, 0xdd66fbafUL, 0x5c2ba20fUL, 0x8bb1a6b3UL, 0x18cdfbacUL, 0x6b257aa8UL, 0xd30dd316UL),
+    SC(0x823b4c96UL, 0x8be9e125UL, 0x262d52d9UL, 0x4aaff240UL, 0x55def10dUL, 0x6353a347UL, 0xe4248de0UL, 0x7889ecb2UL,
+       0xadfafa7aUL, 0x0fb1c60eUL, 0xe7fb3e2eUL, 0x73c66063UL, 0x5a9e97e0UL, 0x4a38a120UL, 0xb7a81f17UL, 0x7d1a6c41UL),
+    SC(0x8daef78bUL, 0xc46e0f5fUL, 0x858fd74cUL, 0x68be31bdUL, 0x03b474d9UL, 0x6bd74debUL, 0xeeba69afUL, 0x5ef3056aUL,
+       0x15db0684UL, 0xbb6d4e7fUL, 0xb135a4abUL, 0xf4b81d4aUL, 0xa9fc7e93UL, 0xc26e3616UL, 0xb7b938daUL, 0x25d44a06UL),
+    SC(0x2b7616caUL, 0xeb608427UL, 0x5a14eb53UL, 0xb67a2ee3UL, 0xb831fb55UL, 0x6f63e0b2UL, 0xe01650f6UL, 0xe6900a0dUL,
+       0x915e7dbcUL, 0x62f8e349UL, 0x8ffdf22dUL, 0xd3604d77UL, 0xbb701137UL, 0xb6c36543UL, 0x84cce993UL, 0xc4613ca4UL)
+  }
+};
+
+#undef SC
+
+#endif /* SECP256K1_ECMULT_STATIC_CONTEXT_H */
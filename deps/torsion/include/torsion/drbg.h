@@ -24,6 +24,8 @@ extern "C" {
 #define hmac_drbg_reseed torsion_hmac_drbg_reseed
 #define hmac_drbg_generate torsion_hmac_drbg_generate
 #define hmac_drbg_rng __torsion_hmac_drbg_rng
+#define hmac_drbg_key_init torsion_hmac_drbg_key_init
+#define hmac_drbg_init_keyed torsion_hmac_drbg_init_keyed
 
 #define hash_drbg_init torsion_hash_drbg_init
 #define hash_drbg_reseed torsion_hash_drbg_reseed
@@ -47,6 +49,14 @@ typedef struct hmac_drbg_s {
   unsigned char V[HASH_MAX_OUTPUT_SIZE];
 } hmac_drbg_t;
 
+typedef struct hmac_drbg_key_s {
+  int type;
+  size_t size;
+  hmac_t kmac;
+  unsigned char prefix[HASH_MAX_BLOCK_SIZE];
+  size_t prefix_len;
+} hmac_drbg_key_t;
+
 typedef struct hash_drbg_s {
   int type;
   hash_t hash;
@@ -101,6 +111,18 @@ hmac_drbg_generate(hmac_drbg_t *drbg, void *out, size_t len,
 TORSION_EXTERN void
 hmac_drbg_rng(void *out, size_t size, void *arg);
 
+TORSION_EXTERN void
+hmac_drbg_key_init(hmac_drbg_key_t *key,
+                   int type,
+                   const unsigned char *prefix,
+                   size_t prefix_len);
+
+TORSION_EXTERN void
+hmac_drbg_init_keyed(hmac_drbg_t *drbg,
+                     const hmac_drbg_key_t *key,
+                     const unsigned char *seed,
+                     size_t seed_len);
+
 /*
  * Hash-DRBG
  */
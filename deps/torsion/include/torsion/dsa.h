@@ -41,6 +41,9 @@ extern "C" {
 #define dsa_sig_export torsion_dsa_sig_export
 #define dsa_sig_import torsion_dsa_sig_import
 #define dsa_sign torsion_dsa_sign
+#define dsa_signer_create torsion_dsa_signer_create
+#define dsa_signer_destroy torsion_dsa_signer_destroy
+#define dsa_sign_prepared torsion_dsa_sign_prepared
 #define dsa_verify torsion_dsa_verify
 #define dsa_derive torsion_dsa_derive
 
@@ -88,6 +91,12 @@ extern "C" {
   + 2 + 1 + DSA_MAX_QSIZE /* x */ \
 )
 
+/*
+ * Types
+ */
+
+typedef struct dsa_signer_s dsa_signer_t;
+
 /*
  * DSA
  */
@@ -188,6 +197,18 @@ dsa_sign(unsigned char *out, size_t *out_len,
          const unsigned char *key, size_t key_len,
          const unsigned char *entropy);
 
+TORSION_EXTERN dsa_signer_t *
+dsa_signer_create(const unsigned char *key, size_t key_len);
+
+TORSION_EXTERN void
+dsa_signer_destroy(dsa_signer_t *signer);
+
+TORSION_EXTERN int
+dsa_sign_prepared(unsigned char *out, size_t *out_len,
+                  const unsigned char *msg, size_t msg_len,
+                  const dsa_signer_t *signer,
+                  const unsigned char *entropy);
+
 TORSION_EXTERN int
 dsa_verify(const unsigned char *msg, size_t msg_len,
            const unsigned char *sig, size_t sig_len,
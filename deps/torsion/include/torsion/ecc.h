@@ -19,14 +19,19 @@ extern "C" {
  */
 
 #define wei_curve_create torsion_wei_curve_create
+#define wei_curve_create_ex torsion_wei_curve_create_ex
 #define wei_curve_destroy torsion_wei_curve_destroy
 #define wei_scratch_destroy torsion_wei_scratch_destroy
 #define wei_curve_scalar_size torsion_wei_curve_scalar_size
 #define wei_curve_scalar_bits torsion_wei_curve_scalar_bits
 #define wei_curve_field_size torsion_wei_curve_field_size
 #define wei_curve_field_bits torsion_wei_curve_field_bits
+#define wei_curve_table_size torsion_wei_curve_table_size
 #define wei_curve_randomize torsion_wei_curve_randomize
 #define wei_scratch_create torsion_wei_scratch_create
+#define wei_prepared_destroy torsion_wei_prepared_destroy
+#define wei_signer_destroy torsion_wei_signer_destroy
+#define wei_pool_destroy torsion_wei_pool_destroy
 
 #define mont_curve_create torsion_mont_curve_create
 #define mont_curve_destroy torsion_mont_curve_destroy
@@ -36,14 +41,18 @@ extern "C" {
 #define mont_curve_field_bits torsion_mont_curve_field_bits
 
 #define edwards_curve_create torsion_edwards_curve_create
+#define edwards_curve_create_ex torsion_edwards_curve_create_ex
 #define edwards_curve_destroy torsion_edwards_curve_destroy
 #define edwards_curve_randomize torsion_edwards_curve_randomize
 #define edwards_curve_scalar_size torsion_edwards_curve_scalar_size
 #define edwards_curve_scalar_bits torsion_edwards_curve_scalar_bits
 #define edwards_curve_field_size torsion_edwards_curve_field_size
 #define edwards_curve_field_bits torsion_edwards_curve_field_bits
+#define edwards_curve_table_size torsion_edwards_curve_table_size
 #define edwards_scratch_create torsion_edwards_scratch_create
 #define edwards_scratch_destroy torsion_edwards_scratch_destroy
+#define edwards_prepared_destroy torsion_edwards_prepared_destroy
+#define edwards_signer_destroy torsion_edwards_signer_destroy
 
 #define ecdsa_privkey_size torsion_ecdsa_privkey_size
 #define ecdsa_pubkey_size torsion_ecdsa_pubkey_size
@@ -58,15 +67,19 @@ extern "C" {
 #define ecdsa_privkey_negate torsion_ecdsa_privkey_negate
 #define ecdsa_privkey_invert torsion_ecdsa_privkey_invert
 #define ecdsa_pubkey_create torsion_ecdsa_pubkey_create
+#define ecdsa_pubkey_create_batch torsion_ecdsa_pubkey_create_batch
 #define ecdsa_pubkey_convert torsion_ecdsa_pubkey_convert
 #define ecdsa_pubkey_from_uniform torsion_ecdsa_pubkey_from_uniform
+#define ecdsa_pubkey_from_uniform_batch torsion_ecdsa_pubkey_from_uniform_batch
 #define ecdsa_pubkey_to_uniform torsion_ecdsa_pubkey_to_uniform
 #define ecdsa_pubkey_from_hash torsion_ecdsa_pubkey_from_hash
+#define ecdsa_pubkey_from_hash_batch torsion_ecdsa_pubkey_from_hash_batch
 #define ecdsa_pubkey_to_hash torsion_ecdsa_pubkey_to_hash
 #define ecdsa_pubkey_verify torsion_ecdsa_pubkey_verify
 #define ecdsa_pubkey_export torsion_ecdsa_pubkey_export
 #define ecdsa_pubkey_import torsion_ecdsa_pubkey_import
 #define ecdsa_pubkey_tweak_add torsion_ecdsa_pubkey_tweak_add
+#define ecdsa_pubkey_tweak_add_batch torsion_ecdsa_pubkey_tweak_add_batch
 #define ecdsa_pubkey_tweak_mul torsion_ecdsa_pubkey_tweak_mul
 #define ecdsa_pubkey_combine torsion_ecdsa_pubkey_combine
 #define ecdsa_pubkey_negate torsion_ecdsa_pubkey_negate
@@ -78,6 +91,16 @@ extern "C" {
 #define ecdsa_sign torsion_ecdsa_sign
 #define ecdsa_sign_internal torsion_ecdsa_sign_internal
 #define ecdsa_verify torsion_ecdsa_verify
+#define ecdsa_pubkey_prepare torsion_ecdsa_pubkey_prepare
+#define ecdsa_verify_prepared torsion_ecdsa_verify_prepared
+#define ecdsa_signer_create torsion_ecdsa_signer_create
+#define ecdsa_sign_prepared torsion_ecdsa_sign_prepared
+#define ecdsa_pool_create torsion_ecdsa_pool_create
+#define ecdsa_pool_size torsion_ecdsa_pool_size
+#define ecdsa_pool_fill torsion_ecdsa_pool_fill
+#define ecdsa_pool_move torsion_ecdsa_pool_move
+#define ecdsa_pool_clear torsion_ecdsa_pool_clear
+#define ecdsa_sign_pooled torsion_ecdsa_sign_pooled
 #define ecdsa_recover torsion_ecdsa_recover
 #define ecdsa_derive torsion_ecdsa_derive
 
@@ -86,6 +109,8 @@ extern "C" {
 #define schnorr_legacy_sign torsion_schnorr_legacy_sign
 #define schnorr_legacy_verify torsion_schnorr_legacy_verify
 #define schnorr_legacy_verify_batch torsion_schnorr_legacy_verify_batch
+#define schnorr_legacy_verify_batch_invalid \
+  torsion_schnorr_legacy_verify_batch_invalid
 
 #define schnorr_support torsion_schnorr_support
 #define schnorr_privkey_size torsion_schnorr_privkey_size
@@ -113,7 +138,10 @@ extern "C" {
 #define schnorr_pubkey_combine torsion_schnorr_pubkey_combine
 #define schnorr_sign torsion_schnorr_sign
 #define schnorr_verify torsion_schnorr_verify
+#define schnorr_pubkey_prepare torsion_schnorr_pubkey_prepare
+#define schnorr_verify_prepared torsion_schnorr_verify_prepared
 #define schnorr_verify_batch torsion_schnorr_verify_batch
+#define schnorr_verify_batch_invalid torsion_schnorr_verify_batch_invalid
 #define schnorr_derive torsion_schnorr_derive
 
 #define ecdh_privkey_size torsion_ecdh_privkey_size
@@ -125,8 +153,10 @@ extern "C" {
 #define ecdh_pubkey_create torsion_ecdh_pubkey_create
 #define ecdh_pubkey_convert torsion_ecdh_pubkey_convert
 #define ecdh_pubkey_from_uniform torsion_ecdh_pubkey_from_uniform
+#define ecdh_pubkey_from_uniform_batch torsion_ecdh_pubkey_from_uniform_batch
 #define ecdh_pubkey_to_uniform torsion_ecdh_pubkey_to_uniform
 #define ecdh_pubkey_from_hash torsion_ecdh_pubkey_from_hash
+#define ecdh_pubkey_from_hash_batch torsion_ecdh_pubkey_from_hash_batch
 #define ecdh_pubkey_to_hash torsion_ecdh_pubkey_to_hash
 #define ecdh_pubkey_verify torsion_ecdh_pubkey_verify
 #define ecdh_pubkey_export torsion_ecdh_pubkey_export
@@ -134,6 +164,7 @@ extern "C" {
 #define ecdh_pubkey_is_small torsion_ecdh_pubkey_is_small
 #define ecdh_pubkey_has_torsion torsion_ecdh_pubkey_has_torsion
 #define ecdh_derive torsion_ecdh_derive
+#define ecdh_derive_batch torsion_ecdh_derive_batch
 
 #define eddsa_privkey_size torsion_eddsa_privkey_size
 #define eddsa_pubkey_size torsion_eddsa_pubkey_size
@@ -157,8 +188,10 @@ extern "C" {
 #define eddsa_pubkey_create torsion_eddsa_pubkey_create
 #define eddsa_pubkey_convert torsion_eddsa_pubkey_convert
 #define eddsa_pubkey_from_uniform torsion_eddsa_pubkey_from_uniform
+#define eddsa_pubkey_from_uniform_batch torsion_eddsa_pubkey_from_uniform_batch
 #define eddsa_pubkey_to_uniform torsion_eddsa_pubkey_to_uniform
 #define eddsa_pubkey_from_hash torsion_eddsa_pubkey_from_hash
+#define eddsa_pubkey_from_hash_batch torsion_eddsa_pubkey_from_hash_batch
 #define eddsa_pubkey_to_hash torsion_eddsa_pubkey_to_hash
 #define eddsa_pubkey_verify torsion_eddsa_pubkey_verify
 #define eddsa_pubkey_export torsion_eddsa_pubkey_export
@@ -174,9 +207,15 @@ extern "C" {
 #define eddsa_sign torsion_eddsa_sign
 #define eddsa_sign_tweak_add torsion_eddsa_sign_tweak_add
 #define eddsa_sign_tweak_mul torsion_eddsa_sign_tweak_mul
+#define eddsa_signer_create torsion_eddsa_signer_create
+#define eddsa_signer_pubkey torsion_eddsa_signer_pubkey
+#define eddsa_sign_prepared torsion_eddsa_sign_prepared
 #define eddsa_verify torsion_eddsa_verify
+#define eddsa_pubkey_prepare torsion_eddsa_pubkey_prepare
+#define eddsa_verify_prepared torsion_eddsa_verify_prepared
 #define eddsa_verify_single torsion_eddsa_verify_single
 #define eddsa_verify_batch torsion_eddsa_verify_batch
+#define eddsa_verify_batch_invalid torsion_eddsa_verify_batch_invalid
 #define eddsa_derive_with_scalar torsion_eddsa_derive_with_scalar
 #define eddsa_derive torsion_eddsa_derive
 
@@ -239,15 +278,31 @@ extern "C" {
 #define EDWARDS_CURVE_ED1174 2
 #define EDWARDS_CURVE_MAX 2
 
+/*
+ * Flags
+ */
+
+/* Use smaller precomputed tables (slower, for cold contexts). */
+#define ECC_FLAG_COMPACT 1
+
+/* Override the build's default field and scalar inverter. */
+#define ECC_FLAG_INVERT_CHAIN 2
+#define ECC_FLAG_INVERT_SAFEGCD 4
+
 /*
  * Types
  */
 
 typedef struct wei_s wei_curve_t;
 typedef struct wei_scratch_s wei_scratch_t;
+typedef struct wei_prepared_s wei_prepared_t;
+typedef struct wei_signer_s wei_signer_t;
+typedef struct wei_pool_s wei_pool_t;
 typedef struct mont_s mont_curve_t;
 typedef struct edwards_s edwards_curve_t;
 typedef struct edwards_scratch_s edwards_scratch_t;
+typedef struct edwards_prepared_s edwards_prepared_t;
+typedef struct edwards_signer_s edwards_signer_t;
 
 typedef void ecdsa_redefine_f(void *, size_t);
 
@@ -258,6 +313,9 @@ typedef void ecdsa_redefine_f(void *, size_t);
 TORSION_EXTERN wei_curve_t *
 wei_curve_create(int type);
 
+TORSION_EXTERN wei_curve_t *
+wei_curve_create_ex(int type, unsigned int flags);
+
 TORSION_EXTERN void
 wei_curve_destroy(wei_curve_t *ec);
 
@@ -276,12 +334,24 @@ wei_curve_field_size(const wei_curve_t *ec);
 TORSION_EXTERN size_t
 wei_curve_field_bits(const wei_curve_t *ec);
 
+TORSION_EXTERN size_t
+wei_curve_table_size(const wei_curve_t *ec);
+
 TORSION_EXTERN wei_scratch_t *
 wei_scratch_create(const wei_curve_t *ec, size_t size);
 
 TORSION_EXTERN void
 wei_scratch_destroy(const wei_curve_t *ec, wei_scratch_t *scratch);
 
+TORSION_EXTERN void
+wei_prepared_destroy(const wei_curve_t *ec, wei_prepared_t *key);
+
+TORSION_EXTERN void
+wei_signer_destroy(const wei_curve_t *ec, wei_signer_t *signer);
+
+TORSION_EXTERN void
+wei_pool_destroy(const wei_curve_t *ec, wei_pool_t *pool);
+
 /*
  * Montgomery Curve
  */
@@ -311,6 +381,9 @@ mont_curve_field_bits(const mont_curve_t *ec);
 TORSION_EXTERN edwards_curve_t *
 edwards_curve_create(int type);
 
+TORSION_EXTERN edwards_curve_t *
+edwards_curve_create_ex(int type, unsigned int flags);
+
 TORSION_EXTERN void
 edwards_curve_destroy(edwards_curve_t *ec);
 
@@ -329,12 +402,21 @@ edwards_curve_field_size(const edwards_curve_t *ec);
 TORSION_EXTERN size_t
 edwards_curve_field_bits(const edwards_curve_t *ec);
 
+TORSION_EXTERN size_t
+edwards_curve_table_size(const edwards_curve_t *ec);
+
 TORSION_EXTERN edwards_scratch_t *
 edwards_scratch_create(const edwards_curve_t *ec, size_t size);
 
 TORSION_EXTERN void
 edwards_scratch_destroy(const edwards_curve_t *ec, edwards_scratch_t *scratch);
 
+TORSION_EXTERN void
+edwards_prepared_destroy(const edwards_curve_t *ec, edwards_prepared_t *key);
+
+TORSION_EXTERN void
+edwards_signer_destroy(const edwards_curve_t *ec, edwards_signer_t *signer);
+
 /*
  * ECDSA
  */
@@ -402,6 +484,14 @@ ecdsa_pubkey_create(const wei_curve_t *ec,
                     const unsigned char *priv,
                     int compact);
 
+TORSION_EXTERN int
+ecdsa_pubkey_create_batch(const wei_curve_t *ec,
+                          unsigned char *out,
+                          size_t *out_len,
+                          const unsigned char *const *privs,
+                          size_t len,
+                          int compact);
+
 TORSION_EXTERN int
 ecdsa_pubkey_convert(const wei_curve_t *ec,
                      unsigned char *out,
@@ -417,6 +507,14 @@ ecdsa_pubkey_from_uniform(const wei_curve_t *ec,
                           const unsigned char *bytes,
                           int compact);
 
+TORSION_EXTERN void
+ecdsa_pubkey_from_uniform_batch(const wei_curve_t *ec,
+                                unsigned char *out,
+                                size_t *out_len,
+                                const unsigned char *const *bytes,
+                                size_t len,
+                                int compact);
+
 TORSION_EXTERN int
 ecdsa_pubkey_to_uniform(const wei_curve_t *ec,
                         unsigned char *out,
@@ -431,6 +529,14 @@ ecdsa_pubkey_from_hash(const wei_curve_t *ec,
                        const unsigned char *bytes,
                        int compact);
 
+TORSION_EXTERN int
+ecdsa_pubkey_from_hash_batch(const wei_curve_t *ec,
+                             unsigned char *out,
+                             size_t *out_len,
+                             const unsigned char *const *bytes,
+                             size_t len,
+                             int compact);
+
 TORSION_EXTERN int
 ecdsa_pubkey_to_hash(const wei_curve_t *ec,
                      unsigned char *out,
@@ -471,6 +577,16 @@ ecdsa_pubkey_tweak_add(const wei_curve_t *ec,
                        const unsigned char *tweak,
                        int compact);
 
+TORSION_EXTERN int
+ecdsa_pubkey_tweak_add_batch(const wei_curve_t *ec,
+                             unsigned char *out,
+                             size_t *out_len,
+                             const unsigned char *const *pubs,
+                             const size_t *pub_lens,
+                             const unsigned char *const *tweaks,
+                             size_t len,
+                             int compact);
+
 TORSION_EXTERN int
 ecdsa_pubkey_tweak_mul(const wei_curve_t *ec,
                        unsigned char *out,
@@ -548,6 +664,56 @@ ecdsa_verify(const wei_curve_t *ec,
              const unsigned char *pub,
              size_t pub_len);
 
+TORSION_EXTERN wei_prepared_t *
+ecdsa_pubkey_prepare(const wei_curve_t *ec,
+                     const unsigned char *pub,
+                     size_t pub_len,
+                     unsigned int width);
+
+TORSION_EXTERN int
+ecdsa_verify_prepared(const wei_curve_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const wei_prepared_t *key);
+
+TORSION_EXTERN wei_signer_t *
+ecdsa_signer_create(const wei_curve_t *ec, const unsigned char *priv);
+
+TORSION_EXTERN void
+ecdsa_sign_prepared(const wei_curve_t *ec,
+                    unsigned char *sig,
+                    unsigned int *param,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const wei_signer_t *signer);
+
+TORSION_EXTERN wei_pool_t *
+ecdsa_pool_create(const wei_curve_t *ec, size_t size);
+
+TORSION_EXTERN size_t
+ecdsa_pool_size(const wei_curve_t *ec, const wei_pool_t *pool);
+
+TORSION_EXTERN size_t
+ecdsa_pool_fill(const wei_curve_t *ec,
+                wei_pool_t *pool,
+                const unsigned char *entropy);
+
+TORSION_EXTERN size_t
+ecdsa_pool_move(const wei_curve_t *ec, wei_pool_t *dst, wei_pool_t *src);
+
+TORSION_EXTERN void
+ecdsa_pool_clear(const wei_curve_t *ec, wei_pool_t *pool);
+
+TORSION_EXTERN int
+ecdsa_sign_pooled(const wei_curve_t *ec,
+                  unsigned char *sig,
+                  unsigned int *param,
+                  const unsigned char *msg,
+                  size_t msg_len,
+                  const unsigned char *priv,
+                  wei_pool_t *pool);
+
 TORSION_EXTERN int
 ecdsa_recover(const wei_curve_t *ec,
               unsigned char *pub,
@@ -628,6 +794,17 @@ schnorr_legacy_verify_batch(const wei_curve_t *ec,
                             size_t len,
                             wei_scratch_t *scratch);
 
+TORSION_EXTERN size_t
+schnorr_legacy_verify_batch_invalid(const wei_curve_t *ec,
+                                    size_t *invalid,
+                                    const unsigned char *const *msgs,
+                                    const size_t *msg_lens,
+                                    const unsigned char *const *sigs,
+                                    const unsigned char *const *pubs,
+                                    const size_t *pub_lens,
+                                    size_t len,
+                                    wei_scratch_t *scratch);
+
 #define schnorr_legacy_derive ecdsa_derive
 
 /*
@@ -776,6 +953,18 @@ schnorr_verify(const wei_curve_t *ec,
                const unsigned char *sig,
                const unsigned char *pub);
 
+TORSION_EXTERN wei_prepared_t *
+schnorr_pubkey_prepare(const wei_curve_t *ec,
+                       const unsigned char *pub,
+                       unsigned int width);
+
+TORSION_EXTERN int
+schnorr_verify_prepared(const wei_curve_t *ec,
+                        const unsigned char *msg,
+                        size_t msg_len,
+                        const unsigned char *sig,
+                        const wei_prepared_t *key);
+
 TORSION_EXTERN int
 schnorr_verify_batch(const wei_curve_t *ec,
                      const unsigned char *const *msgs,
@@ -785,6 +974,16 @@ schnorr_verify_batch(const wei_curve_t *ec,
                      size_t len,
                      wei_scratch_t *scratch);
 
+TORSION_EXTERN size_t
+schnorr_verify_batch_invalid(const wei_curve_t *ec,
+                             size_t *invalid,
+                             const unsigned char *const *msgs,
+                             const size_t *msg_lens,
+                             const unsigned char *const *sigs,
+                             const unsigned char *const *pubs,
+                             size_t len,
+                             wei_scratch_t *scratch);
+
 TORSION_EXTERN int
 schnorr_derive(const wei_curve_t *ec,
                unsigned char *secret,
@@ -836,6 +1035,12 @@ ecdh_pubkey_from_uniform(const mont_curve_t *ec,
                          unsigned char *out,
                          const unsigned char *bytes);
 
+TORSION_EXTERN void
+ecdh_pubkey_from_uniform_batch(const mont_curve_t *ec,
+                               unsigned char *out,
+                               const unsigned char *const *bytes,
+                               size_t len);
+
 TORSION_EXTERN int
 ecdh_pubkey_to_uniform(const mont_curve_t *ec,
                        unsigned char *out,
@@ -848,6 +1053,13 @@ ecdh_pubkey_from_hash(const mont_curve_t *ec,
                       const unsigned char *bytes,
                       int pake);
 
+TORSION_EXTERN int
+ecdh_pubkey_from_hash_batch(const mont_curve_t *ec,
+                            unsigned char *out,
+                            const unsigned char *const *bytes,
+                            size_t len,
+                            int pake);
+
 TORSION_EXTERN int
 ecdh_pubkey_to_hash(const mont_curve_t *ec,
                     unsigned char *out,
@@ -883,6 +1095,14 @@ ecdh_derive(const mont_curve_t *ec,
             const unsigned char *pub,
             const unsigned char *priv);
 
+TORSION_EXTERN int
+ecdh_derive_batch(const mont_curve_t *ec,
+                  unsigned char *out,
+                  int *valid,
+                  const unsigned char *const *pubs,
+                  const unsigned char *const *privs,
+                  size_t len);
+
 /*
  * EdDSA
  */
@@ -990,6 +1210,12 @@ eddsa_pubkey_from_uniform(const edwards_curve_t *ec,
                           unsigned char *out,
                           const unsigned char *bytes);
 
+TORSION_EXTERN void
+eddsa_pubkey_from_uniform_batch(const edwards_curve_t *ec,
+                                unsigned char *out,
+                                const unsigned char *const *bytes,
+                                size_t len);
+
 TORSION_EXTERN int
 eddsa_pubkey_to_uniform(const edwards_curve_t *ec,
                         unsigned char *out,
@@ -1002,6 +1228,13 @@ eddsa_pubkey_from_hash(const edwards_curve_t *ec,
                        const unsigned char *bytes,
                        int pake);
 
+TORSION_EXTERN void
+eddsa_pubkey_from_hash_batch(const edwards_curve_t *ec,
+                             unsigned char *out,
+                             const unsigned char *const *bytes,
+                             size_t len,
+                             int pake);
+
 TORSION_EXTERN int
 eddsa_pubkey_to_hash(const edwards_curve_t *ec,
                      unsigned char *out,
@@ -1102,6 +1335,25 @@ eddsa_sign_tweak_mul(const edwards_curve_t *ec,
                      const unsigned char *ctx,
                      size_t ctx_len);
 
+TORSION_EXTERN edwards_signer_t *
+eddsa_signer_create(const edwards_curve_t *ec,
+                    const unsigned char *priv,
+                    int ph,
+                    const unsigned char *ctx,
+                    size_t ctx_len);
+
+TORSION_EXTERN void
+eddsa_signer_pubkey(const edwards_curve_t *ec,
+                    unsigned char *out,
+                    const edwards_signer_t *signer);
+
+TORSION_EXTERN void
+eddsa_sign_prepared(const edwards_curve_t *ec,
+                    unsigned char *sig,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const edwards_signer_t *signer);
+
 TORSION_EXTERN int
 eddsa_verify(const edwards_curve_t *ec,
              const unsigned char *msg,
@@ -1112,6 +1364,21 @@ eddsa_verify(const edwards_curve_t *ec,
              const unsigned char *ctx,
              size_t ctx_len);
 
+TORSION_EXTERN edwards_prepared_t *
+eddsa_pubkey_prepare(const edwards_curve_t *ec,
+                     const unsigned char *pub,
+                     unsigned int width);
+
+TORSION_EXTERN int
+eddsa_verify_prepared(const edwards_curve_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const edwards_prepared_t *key,
+                      int ph,
+                      const unsigned char *ctx,
+                      size_t ctx_len);
+
 TORSION_EXTERN int
 eddsa_verify_single(const edwards_curve_t *ec,
                     const unsigned char *msg,
@@ -1134,6 +1401,19 @@ eddsa_verify_batch(const edwards_curve_t *ec,
                    size_t ctx_len,
                    edwards_scratch_t *scratch);
 
+TORSION_EXTERN size_t
+eddsa_verify_batch_invalid(const edwards_curve_t *ec,
+                           size_t *invalid,
+                           const unsigned char *const *msgs,
+                           const size_t *msg_lens,
+                           const unsigned char *const *sigs,
+                           const unsigned char *const *pubs,
+                           size_t len,
+                           int ph,
+                           const unsigned char *ctx,
+                           size_t ctx_len,
+                           edwards_scratch_t *scratch);
+
 TORSION_EXTERN int
 eddsa_derive_with_scalar(const edwards_curve_t *ec,
                          unsigned char *secret,
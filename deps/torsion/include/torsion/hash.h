@@ -97,12 +97,16 @@ extern "C" {
 #define sha256_init torsion_sha256_init
 #define sha256_update torsion_sha256_update
 #define sha256_final torsion_sha256_final
+#define sha256_export torsion_sha256_export
+#define sha256_import torsion_sha256_import
 #define sha384_init torsion_sha384_init
 #define sha384_update torsion_sha384_update
 #define sha384_final torsion_sha384_final
 #define sha512_init torsion_sha512_init
 #define sha512_update torsion_sha512_update
 #define sha512_final torsion_sha512_final
+#define sha512_export torsion_sha512_export
+#define sha512_import torsion_sha512_import
 #define sha3_224_init torsion_sha3_224_init
 #define sha3_224_update torsion_sha3_224_update
 #define sha3_224_final torsion_sha3_224_final
@@ -127,9 +131,12 @@ extern "C" {
 #define hash_init torsion_hash_init
 #define hash_update torsion_hash_update
 #define hash_final torsion_hash_final
+#define hash_export torsion_hash_export
+#define hash_import torsion_hash_import
 #define hash_has_backend torsion_hash_has_backend
 #define hash_output_size torsion_hash_output_size
 #define hash_block_size torsion_hash_block_size
+#define hash_midstate_size torsion_hash_midstate_size
 #define hmac_init torsion_hmac_init
 #define hmac_update torsion_hmac_update
 #define hmac_final torsion_hmac_final
@@ -140,6 +147,7 @@ extern "C" {
 
 #define HASH_MAX_OUTPUT_SIZE 64
 #define HASH_MAX_BLOCK_SIZE 168
+#define HASH_MAX_MIDSTATE_SIZE 72
 
 #define HASH_BLAKE2B_160 0
 #define HASH_BLAKE2B_256 1
@@ -525,6 +533,12 @@ sha256_update(sha256_t *ctx, const void *data, size_t len);
 TORSION_EXTERN void
 sha256_final(sha256_t *ctx, unsigned char *out);
 
+TORSION_EXTERN int
+sha256_export(const sha256_t *ctx, unsigned char *out);
+
+TORSION_EXTERN int
+sha256_import(sha256_t *ctx, const unsigned char *in);
+
 /*
  * SHA384
  */
@@ -551,6 +565,12 @@ sha512_update(sha512_t *ctx, const void *data, size_t len);
 TORSION_EXTERN void
 sha512_final(sha512_t *ctx, unsigned char *out);
 
+TORSION_EXTERN int
+sha512_export(const sha512_t *ctx, unsigned char *out);
+
+TORSION_EXTERN int
+sha512_import(sha512_t *ctx, const unsigned char *in);
+
 /*
  * SHA3-{224,256,384,512}
  */
@@ -603,6 +623,12 @@ hash_update(hash_t *hash, const void *data, size_t len);
 TORSION_EXTERN void
 hash_final(hash_t *hash, unsigned char *out, size_t len);
 
+TORSION_EXTERN int
+hash_export(const hash_t *hash, unsigned char *out);
+
+TORSION_EXTERN int
+hash_import(hash_t *hash, int type, const unsigned char *in);
+
 TORSION_EXTERN int
 hash_has_backend(int type);
 
@@ -612,6 +638,9 @@ hash_output_size(int type);
 TORSION_EXTERN size_t
 hash_block_size(int type);
 
+TORSION_EXTERN size_t
+hash_midstate_size(int type);
+
 /*
  * HMAC
  */
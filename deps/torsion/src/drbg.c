@@ -115,6 +115,82 @@ hmac_drbg_rng(void *out, size_t size, void *arg) {
   hmac_drbg_generate((hmac_drbg_t *)arg, out, size, NULL, 0);
 }
 
+void
+hmac_drbg_key_init(hmac_drbg_key_t *key,
+                   int type,
+                   const unsigned char *prefix,
+                   size_t prefix_len) {
+  /* For seeds of the form `prefix || seed` where
+   * the prefix is long-lived (e.g. the private key
+   * in [RFC6979]), the first MAC is always keyed
+   * with K = 0x00... and starts with V = 0x01...,
+   * so its pads and the leading blocks of
+   *
+   *   V || 0x00 || prefix
+   *
+   * can be absorbed once and reused.
+   */
+  unsigned char zero[HASH_MAX_OUTPUT_SIZE];
+  unsigned char one[HASH_MAX_OUTPUT_SIZE];
+  size_t size = hash_output_size(type);
+
+  CHECK(size != 0);
+  CHECK(prefix_len <= sizeof(key->prefix));
+
+  memset(zero, 0x00, size);
+  memset(one, 0x01, size);
+
+  key->type = type;
+  key->size = size;
+
+  hmac_init(&key->kmac, type, zero, size);
+  hmac_update(&key->kmac, one, size);
+  hmac_update(&key->kmac, ZERO, 1);
+  hmac_update(&key->kmac, prefix, prefix_len);
+
+  if (prefix_len > 0)
+    memcpy(key->prefix, prefix, prefix_len);
+
+  key->prefix_len = prefix_len;
+}
+
+void
+hmac_drbg_init_keyed(hmac_drbg_t *drbg,
+                     const hmac_drbg_key_t *key,
+                     const unsigned char *seed,
+                     size_t seed_len) {
+  /* Equivalent to hmac_drbg_init(drbg, type, prefix || seed). */
+  size_t size = key->size;
+
+  drbg->type = key->type;
+  drbg->size = size;
+
+  memset(drbg->V, 0x01, size);
+
+  drbg->kmac = key->kmac;
+  hmac_update(&drbg->kmac, seed, seed_len);
+  hmac_final(&drbg->kmac, drbg->K);
+
+  hmac_init(&drbg->kmac, drbg->type, drbg->K, size);
+  hmac_update(&drbg->kmac, drbg->V, size);
+  hmac_final(&drbg->kmac, drbg->V);
+
+  if (key->prefix_len + seed_len != 0) {
+    hmac_init(&drbg->kmac, drbg->type, drbg->K, size);
+    hmac_update(&drbg->kmac, drbg->V, size);
+    hmac_update(&drbg->kmac, ONE, 1);
+    hmac_update(&drbg->kmac, key->prefix, key->prefix_len);
+    hmac_update(&drbg->kmac, seed, seed_len);
+    hmac_final(&drbg->kmac, drbg->K);
+
+    hmac_init(&drbg->kmac, drbg->type, drbg->K, size);
+    hmac_update(&drbg->kmac, drbg->V, size);
+    hmac_final(&drbg->kmac, drbg->V);
+  }
+
+  hmac_init(&drbg->kmac, drbg->type, drbg->K, size);
+}
+
 /*
  * Hash-DRBG
  */
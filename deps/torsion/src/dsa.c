@@ -64,6 +64,26 @@ typedef struct _dsa_sig_s {
   mpz_t s;
 } dsa_sig_t;
 
+struct dsa_signer_s {
+  dsa_priv_t priv;
+  size_t qsize;
+  hmac_drbg_key_t key;
+};
+
+/*
+ * Helpers
+ */
+
+static void *
+checked_malloc(size_t size) {
+  void *ptr = malloc(size);
+
+  if (ptr == NULL)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  return ptr;
+}
+
 /*
  * Group
  */
@@ -1251,6 +1271,14 @@ dsa_reduce(mpz_t m, const unsigned char *msg, size_t msg_len, const mpz_t q) {
   mpz_mod(m, m, q);
 }
 
+static int
+dsa_sign_drbg(unsigned char *out, size_t *out_len,
+              const dsa_priv_t *priv,
+              const mpz_t m,
+              size_t qsize,
+              drbg_t *drbg,
+              const unsigned char *entropy);
+
 int
 dsa_sign(unsigned char *out, size_t *out_len,
          const unsigned char *msg, size_t msg_len,
@@ -1306,20 +1334,13 @@ dsa_sign(unsigned char *out, size_t *out_len,
    * construction described in [RFC6979].
    */
   unsigned char bytes[DSA_MAX_QSIZE * 2];
-  mpz_t m, b, bx, bm, k, r, s;
   dsa_priv_t priv;
-  dsa_sig_t S;
   size_t qsize;
-  drbg_t drbg, rng;
+  drbg_t drbg;
   int ret = 0;
+  mpz_t m;
 
   mpz_init(m);
-  mpz_init(b);
-  mpz_init(bx);
-  mpz_init(bm);
-  mpz_init(k);
-  mpz_init(r);
-  mpz_init(s);
   dsa_priv_init(&priv);
 
   if (!dsa_priv_import(&priv, key, key_len))
@@ -1335,44 +1356,75 @@ dsa_sign(unsigned char *out, size_t *out_len,
   mpz_export(bytes + qsize, m, qsize, 1);
 
   drbg_init(&drbg, HASH_SHA256, bytes, qsize * 2);
+
+  ret = dsa_sign_drbg(out, out_len, &priv, m, qsize, &drbg, entropy);
+
+fail:
+  mpz_cleanse(m);
+  dsa_priv_clear(&priv);
+  torsion_cleanse(&drbg, sizeof(drbg));
+  torsion_cleanse(bytes, sizeof(bytes));
+  return ret;
+}
+
+static int
+dsa_sign_drbg(unsigned char *out, size_t *out_len,
+              const dsa_priv_t *priv,
+              const mpz_t m,
+              size_t qsize,
+              drbg_t *drbg,
+              const unsigned char *entropy) {
+  unsigned char bytes[DSA_MAX_QSIZE];
+  mpz_t b, bx, bm, k, r, s;
+  dsa_sig_t S;
+  drbg_t rng;
+  int ret = 0;
+
+  mpz_init(b);
+  mpz_init(bx);
+  mpz_init(bm);
+  mpz_init(k);
+  mpz_init(r);
+  mpz_init(s);
+
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
   for (;;) {
-    mpz_random_int(b, priv.q, drbg_rng, &rng);
+    mpz_random_int(b, priv->q, drbg_rng, &rng);
 
     if (mpz_sgn(b) == 0)
       continue;
 
-    drbg_generate(&drbg, bytes, qsize);
-    dsa_truncate(k, bytes, qsize, priv.q);
+    drbg_generate(drbg, bytes, qsize);
+    dsa_truncate(k, bytes, qsize, priv->q);
 
-    if (mpz_sgn(k) == 0 || mpz_cmp(k, priv.q) >= 0)
+    if (mpz_sgn(k) == 0 || mpz_cmp(k, priv->q) >= 0)
       continue;
 
-    mpz_powm_sec(r, priv.g, k, priv.p);
-    mpz_mod(r, r, priv.q);
+    mpz_powm_sec(r, priv->g, k, priv->p);
+    mpz_mod(r, r, priv->q);
 
     if (mpz_sgn(r) == 0)
       continue;
 
     /* Blind. */
     mpz_mul(k, k, b);
-    mpz_mod(k, k, priv.q);
-    mpz_mul(bx, priv.x, b);
-    mpz_mod(bx, bx, priv.q);
+    mpz_mod(k, k, priv->q);
+    mpz_mul(bx, priv->x, b);
+    mpz_mod(bx, bx, priv->q);
     mpz_mul(bm, m, b);
-    mpz_mod(bm, bm, priv.q);
+    mpz_mod(bm, bm, priv->q);
 
     /* Can only fail if `q` is not prime. */
-    if (!mpz_invert(k, k, priv.q))
+    if (!mpz_invert(k, k, priv->q))
       goto fail;
 
     /* Sign. */
     mpz_mul(s, r, bx);
     mpz_add(s, s, bm);
-    mpz_mod(s, s, priv.q);
+    mpz_mod(s, s, priv->q);
     mpz_mul(s, s, k);
-    mpz_mod(s, s, priv.q);
+    mpz_mod(s, s, priv->q);
 
     if (mpz_sgn(s) == 0)
       continue;
@@ -1386,20 +1438,87 @@ dsa_sign(unsigned char *out, size_t *out_len,
   }
 
 fail:
-  mpz_cleanse(m);
   mpz_cleanse(b);
   mpz_cleanse(bx);
   mpz_cleanse(bm);
   mpz_cleanse(k);
   mpz_cleanse(r);
   mpz_cleanse(s);
-  dsa_priv_clear(&priv);
-  torsion_cleanse(&drbg, sizeof(drbg));
   torsion_cleanse(&rng, sizeof(rng));
   torsion_cleanse(bytes, sizeof(bytes));
   return ret;
 }
 
+dsa_signer_t *
+dsa_signer_create(const unsigned char *key, size_t key_len) {
+  /* Keyed [RFC6979] signing. The key is decoded
+   * and checked once, and the HMAC-DRBG is keyed
+   * with `x` up front (see hmac_drbg_key_init).
+   */
+  unsigned char bytes[DSA_MAX_QSIZE];
+  dsa_signer_t *signer;
+
+  signer = checked_malloc(sizeof(dsa_signer_t));
+
+  dsa_priv_init(&signer->priv);
+
+  if (!dsa_priv_import(&signer->priv, key, key_len))
+    goto fail;
+
+  if (!dsa_priv_is_sane(&signer->priv))
+    goto fail;
+
+  signer->qsize = mpz_bytelen(signer->priv.q);
+
+  mpz_export(bytes, signer->priv.x, signer->qsize, 1);
+
+  hmac_drbg_key_init(&signer->key, HASH_SHA256, bytes, signer->qsize);
+
+  torsion_cleanse(bytes, sizeof(bytes));
+
+  return signer;
+fail:
+  dsa_signer_destroy(signer);
+  return NULL;
+}
+
+void
+dsa_signer_destroy(dsa_signer_t *signer) {
+  if (signer != NULL) {
+    dsa_priv_clear(&signer->priv);
+    torsion_cleanse(signer, sizeof(*signer));
+    free(signer);
+  }
+}
+
+int
+dsa_sign_prepared(unsigned char *out, size_t *out_len,
+                  const unsigned char *msg, size_t msg_len,
+                  const dsa_signer_t *signer,
+                  const unsigned char *entropy) {
+  unsigned char bytes[DSA_MAX_QSIZE];
+  size_t qsize = signer->qsize;
+  drbg_t drbg;
+  int ret;
+  mpz_t m;
+
+  mpz_init(m);
+
+  dsa_reduce(m, msg, msg_len, signer->priv.q);
+
+  mpz_export(bytes, m, qsize, 1);
+
+  hmac_drbg_init_keyed(&drbg, &signer->key, bytes, qsize);
+
+  ret = dsa_sign_drbg(out, out_len, &signer->priv, m, qsize, &drbg, entropy);
+
+  mpz_cleanse(m);
+  torsion_cleanse(&drbg, sizeof(drbg));
+  torsion_cleanse(bytes, sizeof(bytes));
+
+  return ret;
+}
+
 int
 dsa_verify(const unsigned char *msg, size_t msg_len,
            const unsigned char *sig, size_t sig_len,
@@ -135,6 +135,14 @@
  *
  *   [ECPM] Elliptic Curve Point Multiplication (wikipedia)
  *     https://en.wikipedia.org/wiki/Elliptic_curve_point_multiplication
+ *
+ *   [PIPPENGER] On the Evaluation of Powers and Monomials
+ *     N. Pippenger
+ *     https://doi.org/10.1137/0209022
+ *
+ *   [DECAF] Decaf: Eliminating cofactors through point compression
+ *     M. Hamburg
+ *     https://eprint.iacr.org/2015/673.pdf
  */
 
 #include <limits.h>
@@ -147,8 +155,10 @@
 #include <torsion/util.h>
 
 #include "asn1.h"
+#include "entropy/entropy.h"
 #include "internal.h"
 #include "mpi.h"
+#include "tls.h"
 
 #ifdef TORSION_HAVE_INT128
 typedef uint64_t fe_word_t;
@@ -162,6 +172,9 @@ typedef uint32_t fe_word_t;
 
 TORSION_BARRIER(fe_word_t, fiat)
 
+#include "fields/adx.h"
+#include "fields/avx2.h"
+#include "fields/scalar_64.h"
 #include "fields/p192.h"
 #include "fields/p224.h"
 #include "fields/p256.h"
@@ -188,11 +201,40 @@ TORSION_BARRIER(fe_word_t, fiat)
 #define MAX_SIG_SIZE (MAX_FIELD_SIZE + MAX_SCALAR_SIZE)
 #define MAX_DER_SIZE (9 + MAX_SIG_SIZE)
 
-#define FIXED_WIDTH 4
-#define FIXED_SIZE (1 << FIXED_WIDTH) /* 16 */
-#define FIXED_STEPS(bits) (((bits) + FIXED_WIDTH - 1) / FIXED_WIDTH) /* 64 */
-#define FIXED_LENGTH(bits) (FIXED_STEPS(bits) * FIXED_SIZE) /* 1024 */
-#define FIXED_MAX_LENGTH FIXED_LENGTH(MAX_SCALAR_BITS) /* 2096 */
+/* Signed-digit comb widths (trade memory for speed).
+ * A Weierstrass addition costs more relative to the
+ * table scan than an Edwards one, so those curves
+ * take wider windows. TORSION_FIXED_WIDTH overrides
+ * both; the shipped tables serve any width which
+ * divides theirs.
+ */
+#ifdef TORSION_FIXED_WIDTH
+#if TORSION_FIXED_WIDTH < 2 || TORSION_FIXED_WIDTH > 8
+#error "TORSION_FIXED_WIDTH must be in the range [2, 8]."
+#endif
+#define WEI_FIXED_WIDTH TORSION_FIXED_WIDTH
+#define EDWARDS_FIXED_WIDTH TORSION_FIXED_WIDTH
+#else
+#define WEI_FIXED_WIDTH 5
+#define EDWARDS_FIXED_WIDTH 4
+#endif
+
+#define FIXED_WIDTH_COMPACT 2
+#define FIXED_SIZE(width) (1 << ((width) - 1)) /* 8 */
+#define FIXED_STEPS(bits, width) (((bits) + (width) - 1) / (width)) /* 64 */
+#define FIXED_LENGTH(bits, width) \
+  (FIXED_STEPS(bits, width) * FIXED_SIZE(width)) /* 512 */
+
+/* Default inverter. safegcd beats the addition
+ * chains with both 62-bit and 30-bit limbs (see
+ * bench/invert.js). TORSION_INVERT_CHAIN makes
+ * the chains the default where it does not.
+ */
+#ifdef TORSION_INVERT_CHAIN
+#define INVERT_CHAIN 1
+#else
+#define INVERT_CHAIN 0
+#endif
 
 #define WND_WIDTH 4
 #define WND_SIZE (1 << WND_WIDTH) /* 16 */
@@ -202,13 +244,73 @@ TORSION_BARRIER(fe_word_t, fiat)
 #define NAF_SIZE (1 << (NAF_WIDTH - 2)) /* 8 */
 
 #define NAF_WIDTH_PRE 12
-#define NAF_SIZE_PRE (1 << (NAF_WIDTH_PRE - 2)) /* 1024 */
+#define NAF_WIDTH_COMPACT 8
+#define NAF_LENGTH(width) (1 << ((width) - 2)) /* 1024 */
+
+#define BUCKET_MIN_POINTS 128
+#define BUCKET_MAX_WIDTH 12
+#define BUCKET_SIZE(width) (1 << ((width) - 1)) /* 2048 */
+
+#define NORM_BATCH 32 /* 11776 bytes of stack */
 
 #define ECC_MIN(a, b) ((a) < (b) ? (a) : (b))
 #define ECC_MAX(a, b) ((a) > (b) ? (a) : (b))
 
 #define cleanse torsion_cleanse
 
+/*
+ * Global Lock
+ */
+
+#if defined(TORSION_HAVE_PTHREAD)
+#  include <pthread.h>
+static pthread_mutex_t ecc_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define TORSION_USE_LOCK
+#elif defined(_WIN32)
+#  include <windows.h>
+static SRWLOCK ecc_lock = SRWLOCK_INIT;
+#  define TORSION_USE_LOCK
+#endif
+
+static void
+ecc_global_lock(void) {
+#if defined(TORSION_HAVE_PTHREAD)
+  if (pthread_mutex_lock(&ecc_lock) != 0)
+    torsion_abort();
+#elif defined(_WIN32)
+  AcquireSRWLockExclusive(&ecc_lock);
+#endif
+}
+
+static void
+ecc_global_unlock(void) {
+#if defined(TORSION_HAVE_PTHREAD)
+  if (pthread_mutex_unlock(&ecc_lock) != 0)
+    torsion_abort();
+#elif defined(_WIN32)
+  ReleaseSRWLockExclusive(&ecc_lock);
+#endif
+}
+
+/* Published tables are only ever read, so readers
+ * check for them with an acquire load and take the
+ * lock only when a table still has to be built.
+ * Without atomics, every reader takes the lock.
+ */
+#if defined(TORSION_HAVE_PTHREAD) \
+  && (TORSION_GNUC_PREREQ(4, 7) || defined(__clang__))
+#  define ecc_load_acquire(p) __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#  define ecc_store_release(p, x) __atomic_store_n(&(p), x, __ATOMIC_RELEASE)
+#elif !defined(TORSION_HAVE_PTHREAD) && defined(_WIN32)
+#  define ecc_load_acquire(p) \
+     InterlockedCompareExchangePointer((void *volatile *)&(p), NULL, NULL)
+#  define ecc_store_release(p, x) \
+     InterlockedExchangePointer((void *volatile *)&(p), (void *)(x))
+#else
+#  define ecc_load_acquire(p) NULL
+#  define ecc_store_release(p, x) ((p) = (x))
+#endif
+
 /*
  * Scalar Field
  */
@@ -310,6 +412,8 @@ typedef struct prime_def_s {
   fe_opp_f *opp;
   fe_mul_f *mul;
   fe_sqr_f *square;
+  fe_mul_f *mul_adx;
+  fe_sqr_f *square_adx;
   fe_to_montgomery_f *to_montgomery;
   fe_from_montgomery_f *from_montgomery;
   fe_nonzero_f *nonzero;
@@ -346,6 +450,26 @@ typedef struct subgroup_def_s {
   int inf;
 } subgroup_def_t;
 
+/*
+ * Precomputed Tables
+ */
+
+static int
+table_has_fixed(size_t table_width, size_t width) {
+  /* A comb whose width divides the table's only
+     needs multiples which the table holds. */
+  return table_width != 0 && table_width % width == 0;
+}
+
+static size_t
+table_fixed_index(size_t table_width, size_t width, size_t i, size_t j) {
+  /* Index of (j + 1) * 2^(width * i) * G. */
+  size_t pos = i * width;
+
+  return (pos / table_width) * FIXED_SIZE(table_width)
+       + ((j + 1) << (pos % table_width)) - 1;
+}
+
 /*
  * Short Weierstrass
  */
@@ -366,6 +490,49 @@ typedef struct jge_s {
   fe_t z;
 } jge_t;
 
+struct wei_s;
+
+typedef void jge_dbl_f(const struct wei_s *, jge_t *, const jge_t *);
+typedef void jge_addsub_f(const struct wei_s *, jge_t *,
+                          const jge_t *, const jge_t *, int);
+typedef void jge_mixed_addsub_f(const struct wei_s *, jge_t *, const jge_t *,
+                                const fe_t, const fe_t, int);
+typedef void jge_add_f(const struct wei_s *, jge_t *,
+                       const jge_t *, const jge_t *);
+typedef void jge_mixed_add_f(const struct wei_s *, jge_t *,
+                             const jge_t *, const wge_t *);
+typedef void jge_mul_g_f(const struct wei_s *, jge_t *, const sc_t);
+typedef void jge_mul_double_f(const struct wei_s *, jge_t *, const sc_t,
+                              const wge_t *, const sc_t);
+
+/* Group law, possibly specialized for the field (see group.h). */
+typedef struct wei_group_s {
+  jge_dbl_f *dbl;
+  jge_addsub_f *addsub_var;
+  jge_mixed_addsub_f *mixed_addsub_var;
+  jge_add_f *add;
+  jge_mixed_add_f *mixed_add;
+  /* Optional multiplication routines (may be NULL). */
+  jge_mul_g_f *mul_g;
+  jge_mul_double_f *mul_double_var;
+} wei_group_t;
+
+/* Shipped tables (see tables.h), in the field's limb layout. */
+typedef struct wei_tables_s {
+  size_t fixed_width;
+  const wge_t *fixed;
+  const wge_t *naf;
+  const wge_t *endo;
+} wei_tables_t;
+
+/* Precomputed tables, shared by all contexts of the same curve. */
+typedef struct wei_cache_s {
+  size_t refs;
+  const wge_t *fixed; /* 155.6kb */
+  const wge_t *naf; /* 152kb */
+  const wge_t *endo; /* 19kb */
+} wei_cache_t;
+
 typedef struct wei_s {
   int hash;
   prime_field_t fe;
@@ -385,11 +552,14 @@ typedef struct wei_s {
   int three_a;
   int high_order;
   int small_gap;
+  wei_group_t group;
   wge_t g;
   sc_t blind;
   jge_t unblind;
-  wge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 311.2kb */
-  wge_t wnd_naf[NAF_SIZE_PRE]; /* 152kb */
+  const wei_tables_t *tables;
+  wei_cache_t *cache;
+  size_t fixed_width;
+  size_t naf_width;
   wge_t torsion[8];
   int endo;
   fe_t beta;
@@ -398,7 +568,9 @@ typedef struct wei_s {
   sc_t b2;
   sc_t g1;
   sc_t g2;
-  wge_t wnd_endo[NAF_SIZE_PRE]; /* 19kb */
+  hash_t tag_aux;
+  hash_t tag_nonce;
+  hash_t tag_challenge;
 } wei_t;
 
 typedef struct wei_def_s {
@@ -414,18 +586,48 @@ typedef struct wei_def_s {
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
   const endo_def_t *endo;
+  const wei_tables_t *tables;
+  const wei_group_t *group;
+  const wei_group_t *group_adx;
 } wei_def_t;
 
 struct wei_scratch_s {
   size_t size;
+  size_t width;
   jge_t *wnd;
   jge_t **wnds;
   int *naf;
   int **nafs;
+  jge_t *buckets;
   wge_t *points;
   sc_t *coeffs;
 };
 
+struct wei_prepared_s {
+  wge_t point;
+  unsigned char raw[MAX_FIELD_SIZE];
+  size_t width;
+  wge_t *wnd;
+  wge_t *wnd_endo;
+};
+
+struct wei_signer_s {
+  sc_t a;
+  hmac_drbg_key_t key;
+};
+
+typedef struct wei_nonce_s {
+  sc_t kinv; /* 1 / k */
+  sc_t r; /* x(G * k) mod n */
+  unsigned int param;
+} wei_nonce_t;
+
+struct wei_pool_s {
+  size_t size;
+  size_t len;
+  wei_nonce_t *items;
+};
+
 /*
  * Montgomery
  */
@@ -445,6 +647,16 @@ typedef struct pge_s {
   fe_t z;
 } pge_t;
 
+struct mont_s;
+
+/* Ladder, possibly specialized for the field (see group.h). */
+typedef void pge_mul_f(const struct mont_s *, pge_t *,
+                       const pge_t *, const sc_t, int);
+
+/* Four independent ladders (inputs must be affine). */
+typedef void pge_mul4_f(const struct mont_s *, pge_t *,
+                        const pge_t *, const sc_t *);
+
 typedef struct mont_s {
   prime_field_t fe;
   scalar_field_t sc;
@@ -463,6 +675,8 @@ typedef struct mont_s {
   sc_t i16;
   mge_t g;
   mge_t torsion[8];
+  pge_mul_f *mul;
+  pge_mul4_f *mul4;
 } mont_t;
 
 typedef struct mont_def_s {
@@ -477,6 +691,8 @@ typedef struct mont_def_s {
   const unsigned char y[MAX_FIELD_SIZE];
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
+  pge_mul_f *mul;
+  pge_mul4_f *mul4_avx2;
 } mont_def_t;
 
 /*
@@ -492,6 +708,59 @@ typedef struct xge_s {
   fe_t t;
 } xge_t;
 
+/* nge = niels group element (affine, precomputed for mixed addition) */
+typedef struct nge_s {
+  /* 216 bytes */
+  fe_t u; /* y + x if a = -1, otherwise x */
+  fe_t v; /* y - x if a = -1, otherwise y */
+  fe_t w; /* 2 * d * x * y if a = -1, otherwise d * x * y */
+} nge_t;
+
+struct edwards_s;
+
+typedef void xge_dbl_f(const struct edwards_s *, xge_t *, const xge_t *);
+typedef void xge_add_f(const struct edwards_s *, xge_t *,
+                       const xge_t *, const xge_t *);
+typedef void xge_mixed_add_f(const struct edwards_s *, xge_t *,
+                             const xge_t *, const nge_t *);
+
+struct edwards_scratch_s;
+
+typedef void xge_mul_g_f(const struct edwards_s *, xge_t *, const sc_t);
+typedef void xge_mul_double_f(const struct edwards_s *, xge_t *, const sc_t,
+                              const xge_t *, const sc_t);
+typedef void xge_mul_multi_f(const struct edwards_s *, xge_t *, const sc_t,
+                             const xge_t *, const sc_t *, size_t,
+                             struct edwards_scratch_s *);
+
+/* Group law, possibly specialized for the field (see group.h). */
+typedef struct edwards_group_s {
+  xge_dbl_f *dbl;
+  xge_add_f *add;
+  xge_mixed_add_f *mixed_add;
+  /* Optional multiplication routines (may be NULL). */
+  xge_mul_g_f *mul_g;
+  xge_mul_double_f *mul_double_var;
+  xge_mul_multi_f *mul_multi_normal_var;
+} edwards_group_t;
+
+/* Shipped tables (see tables.h), in the field's limb layout. */
+typedef struct edwards_tables_s {
+  size_t fixed_width;
+  const nge_t *fixed;
+  const xge_t *naf;
+} edwards_tables_t;
+
+/* Precomputed tables, shared by all contexts of the same curve. */
+typedef struct edwards_cache_s {
+  size_t refs;
+  const nge_t *fixed; /* 221.1kb */
+  const xge_t *naf; /* 288kb */
+#ifdef TORSION_HAVE_ASM_AVX2
+  p25519x4_t *naf_avx2; /* 320kb */
+#endif
+} edwards_cache_t;
+
 typedef struct edwards_s {
   int hash;
   int context;
@@ -512,12 +781,16 @@ typedef struct edwards_s {
   fe_t B0;
   int mone_a;
   int one_a;
+  edwards_group_t group;
   xge_t g;
   sc_t blind;
   xge_t unblind;
-  xge_t wnd_fixed[FIXED_MAX_LENGTH]; /* 589.5kb */
-  xge_t wnd_naf[NAF_SIZE_PRE]; /* 288kb */
+  const edwards_tables_t *tables;
+  edwards_cache_t *cache;
+  size_t fixed_width;
+  size_t naf_width;
   xge_t torsion[8];
+  struct edwards_s *iso;
 } edwards_t;
 
 typedef struct edwards_def_s {
@@ -535,16 +808,39 @@ typedef struct edwards_def_s {
   const unsigned char y[MAX_FIELD_SIZE];
   const unsigned char c[MAX_FIELD_SIZE];
   const subgroup_def_t *torsion;
+  const edwards_tables_t *tables;
+  const edwards_group_t *group;
+  const edwards_group_t *group_avx2;
+  const struct edwards_def_s *isogeny;
 } edwards_def_t;
 
 struct edwards_scratch_s {
   size_t size;
+  size_t width;
   xge_t *wnd;
   xge_t **wnds;
   int *naf;
   int **nafs;
+  xge_t *buckets;
   xge_t *points;
   sc_t *coeffs;
+#ifdef TORSION_HAVE_ASM_AVX2
+  p25519x4_t *wnd_avx2;
+#endif
+};
+
+struct edwards_prepared_s {
+  xge_t point; /* -A */
+  unsigned char raw[MAX_FIELD_SIZE + 1];
+  size_t width;
+  xge_t *wnd;
+};
+
+struct edwards_signer_s {
+  sc_t a;
+  unsigned char raw[MAX_FIELD_SIZE + 1]; /* A */
+  hash_t nonce; /* dom(ph, ctx) || w */
+  hash_t challenge; /* dom(ph, ctx) */
 };
 
 /*
@@ -681,6 +977,15 @@ sc_import_wide(const scalar_field_t *sc, sc_t r,
 
   ASSERT(size * 8 <= (size_t)sc->shift * MP_LIMB_BITS);
 
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4 && size <= 64) {
+    mpn_import(rp, 8, raw, size, sc->endian);
+    sc4x64_reduce(r, rp, sc->n, sc->m + 2);
+    mpn_cleanse(rp, 8);
+    return;
+  }
+#endif
+
   mpn_import(rp, sc->shift, raw, size, sc->endian);
 
   sc_reduce(sc, r, rp);
@@ -813,6 +1118,13 @@ sc_add(const scalar_field_t *sc, sc_t r, const sc_t a, const sc_t b) {
 
   ASSERT(sc->n[sc->limbs] == 0);
 
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4) {
+    sc4x64_add(r, a, b, sc->n);
+    return;
+  }
+#endif
+
   /* r = a + b */
   ap[sc->limbs] = mpn_add_n(ap, a, b, sc->limbs);
 
@@ -879,6 +1191,13 @@ static void
 sc_mul(const scalar_field_t *sc, sc_t r, const sc_t a, const sc_t b) {
   mp_limb_t rp[MAX_REDUCE_LIMBS]; /* 160 bytes */
 
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4) {
+    sc4x64_mul(r, a, b, sc->n, sc->m + 2);
+    return;
+  }
+#endif
+
   mpn_mul_n(rp, a, b, sc->limbs);
 
   rp[sc->shift - 2] = 0;
@@ -891,6 +1210,13 @@ TORSION_UNUSED static void
 sc_sqr(const scalar_field_t *sc, sc_t r, const sc_t a) {
   mp_limb_t rp[MAX_REDUCE_LIMBS]; /* 160 bytes */
 
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4) {
+    sc4x64_sqr(r, a, sc->n, sc->m + 2);
+    return;
+  }
+#endif
+
   mpn_sqr(rp, a, sc->limbs);
 
   rp[sc->shift - 2] = 0;
@@ -916,6 +1242,16 @@ sc_mulshift(const scalar_field_t *sc, sc_t r,
 
   ASSERT(shift > sc->bits);
 
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4 && shift >= 256) {
+    sc4x64_mulshift(r, a, b, shift);
+#ifdef TORSION_VERIFY
+    ASSERT(mpn_cmp(r, sc->n, sc->limbs) < 0);
+#endif
+    return;
+  }
+#endif
+
   /* r = a * b */
   mpn_mul_n(rp, a, b, sc->limbs);
 
@@ -974,60 +1310,22 @@ sc_normal(const scalar_field_t *sc, sc_t r, const sc_t a) {
 
 static int
 sc_invert_var(const scalar_field_t *sc, sc_t r, const sc_t a) {
-  mp_limb_t scratch[MPN_INVERT_ITCH(MAX_SCALAR_LIMBS)];
-  return mpn_invert_n(r, a, sc->n, sc->limbs, scratch);
-}
-
-static void
-sc_pow(const scalar_field_t *sc, sc_t r, const sc_t a, const mp_limb_t *e) {
-  /* Used for inversion if not available otherwise. */
-  /* Note that our exponent is not secret. */
-  mp_size_t start = WND_STEPS(sc->bits) - 1;
-  sc_t wnd[WND_SIZE]; /* 1152 bytes */
-  mp_size_t i, j;
-  mp_limb_t b;
-
-  sc_mont(sc, wnd[0], sc_one);
-  sc_mont(sc, wnd[1], a);
-
-  for (i = 2; i < WND_SIZE; i += 2) {
-    sc_montsqr(sc, wnd[i], wnd[i / 2]);
-    sc_montmul(sc, wnd[i + 1], wnd[i], wnd[1]);
-  }
-
-  sc_set(sc, r, wnd[0]);
-
-  for (i = start; i >= 0; i--) {
-    b = mpn_get_bits(e, sc->limbs, i * WND_WIDTH, WND_WIDTH);
-
-    if (i == start) {
-      sc_set(sc, r, wnd[b]);
-    } else {
-      for (j = 0; j < WND_WIDTH; j++)
-        sc_montsqr(sc, r, r);
-
-      sc_montmul(sc, r, r, wnd[b]);
-    }
-  }
-
-  sc_normal(sc, r, r);
+  mp_limb_t scratch[MPN_INVERT_VAR_ITCH(MAX_SCALAR_LIMBS)];
+  return mpn_invert_var(r, a, sc->n, sc->limbs, scratch);
 }
 
 static int
 sc_invert(const scalar_field_t *sc, sc_t r, const sc_t a) {
-  int ret = sc_is_zero(sc, a) ^ 1;
+  mp_limb_t scratch[MPN_INVERT_SEC_ITCH(MAX_SCALAR_LIMBS)];
+  int ret;
 
-  if (sc->invert) {
+  if (sc->invert != NULL) {
     /* Fast inversion chain. */
+    ret = sc_is_zero(sc, a) ^ 1;
     sc->invert(sc, r, a);
   } else {
-    /* Fermat's little theorem. */
-    mp_limb_t e[MAX_SCALAR_LIMBS];
-
-    /* e = n - 2 */
-    mpn_sub_1(e, sc->n, sc->limbs, 2);
-
-    sc_pow(sc, r, a, e);
+    /* Constant-time safegcd. */
+    ret = mpn_invert_sec(r, a, sc->n, sc->limbs, scratch);
   }
 
   return ret;
@@ -1041,15 +1339,44 @@ sc_bitlen_var(const scalar_field_t *sc, const sc_t a) {
 static mp_limb_t
 sc_get_bit(const scalar_field_t *sc, const sc_t k, size_t i) {
   /* Constant time assuming `i` is constant. */
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4)
+    return sc4x64_get_bits(k, i, 1);
+#endif
   return mpn_get_bit(k, sc->limbs, i);
 }
 
 static mp_limb_t
 sc_get_bits(const scalar_field_t *sc, const sc_t k, size_t i, size_t w) {
   /* Constant time assuming `i` is constant. */
+#ifdef TORSION_HAVE_SCALAR_4X64
+  if (sc->limbs == 4)
+    return sc4x64_get_bits(k, i, w);
+#endif
   return mpn_get_bits(k, sc->limbs, i, w);
 }
 
+static int
+sc_get_booth(const scalar_field_t *sc, const sc_t k, size_t i, size_t w) {
+  /* Signed radix-2^w digit (Booth recoding).
+   *
+   * Computes the i'th digit of `k` in the
+   * range [-2^(w-1), 2^(w-1)] without any
+   * carry propagation between windows. The
+   * digits sum to `k` provided the window
+   * after the last one is zero.
+   */
+  size_t pos = i * w;
+  int bits;
+
+  if (pos == 0)
+    bits = sc_get_bits(sc, k, 0, w) << 1;
+  else
+    bits = sc_get_bits(sc, k, pos - 1, w + 1);
+
+  return ((bits + 1) >> 1) - ((bits >> w) << w);
+}
+
 static int
 sc_minimize(const scalar_field_t *sc, sc_t r, const sc_t a) {
   int high = sc_is_high(sc, a);
@@ -1092,6 +1419,16 @@ sc_naf_var0(const scalar_field_t *sc, int *naf,
   memset(naf, 0, max * sizeof(int));
 
   while (i < bits) {
+#ifdef TORSION_HAVE_SCALAR_4X64
+    /* Skip runs of bits equal to the carry. */
+    if (sc->limbs == 4) {
+      i = sc4x64_scan(k, i, carry);
+
+      if (i >= bits)
+        break;
+    }
+#endif
+
     if (sc_get_bit(sc, k, i) == (mp_limb_t)carry) {
       i += 1;
       continue;
@@ -1609,13 +1946,13 @@ fe_pow(const prime_field_t *fe, fe_t r, const fe_t a, const mp_limb_t *e) {
 
 static int
 fe_invert_var(const prime_field_t *fe, fe_t r, const fe_t a) {
-  mp_limb_t scratch[MPN_INVERT_ITCH(MAX_FIELD_LIMBS)];
+  mp_limb_t scratch[MPN_INVERT_VAR_ITCH(MAX_FIELD_LIMBS)];
   mp_limb_t rp[MAX_FIELD_LIMBS];
   int ret;
 
   fe_get_limbs(fe, rp, a);
 
-  ret = mpn_invert_n(rp, rp, fe->p, fe->limbs, scratch);
+  ret = mpn_invert_var(rp, rp, fe->p, fe->limbs, scratch);
 
   ASSERT(fe_set_limbs(fe, r, rp, fe->limbs));
 
@@ -1624,24 +1961,61 @@ fe_invert_var(const prime_field_t *fe, fe_t r, const fe_t a) {
 
 static int
 fe_invert(const prime_field_t *fe, fe_t r, const fe_t a) {
-  int ret = fe_is_zero(fe, a) ^ 1;
+  mp_limb_t scratch[MPN_INVERT_SEC_ITCH(MAX_FIELD_LIMBS)];
+  mp_limb_t rp[MAX_FIELD_LIMBS];
+  int ret;
 
-  if (fe->invert) {
+  if (fe->invert != NULL) {
     /* Fast inversion chain. */
+    ret = fe_is_zero(fe, a) ^ 1;
     fe->invert(r, a);
   } else {
-    /* Fermat's little theorem. */
-    mp_limb_t e[MAX_FIELD_LIMBS];
+    /* Constant-time safegcd. */
+    fe_get_limbs(fe, rp, a);
 
-    /* e = p - 2 */
-    mpn_sub_1(e, fe->p, fe->limbs, 2);
+    ret = mpn_invert_sec(rp, rp, fe->p, fe->limbs, scratch);
 
-    fe_pow(fe, r, a, e);
+    ASSERT(fe_set_limbs(fe, r, rp, fe->limbs));
   }
 
   return ret;
 }
 
+static void
+fe_invert_all(const prime_field_t *fe, fe_t *r, fe_t *scratch, size_t len) {
+  /* Montgomery's trick (constant time, in place).
+   *
+   * Zero elements are given a value of one for
+   * the duration of the inversion and invert to
+   * zero (as with fe_invert).
+   */
+  fe_t acc, z;
+  size_t i;
+  int zero;
+
+  fe_set(fe, acc, fe->one);
+
+  for (i = 0; i < len; i++) {
+    fe_select(fe, z, r[i], fe->one, fe_is_zero(fe, r[i]));
+    fe_set(fe, scratch[i], acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  ASSERT(fe_invert(fe, acc, acc));
+
+  for (i = len; i-- > 0;) {
+    zero = fe_is_zero(fe, r[i]);
+
+    fe_select(fe, z, r[i], fe->one, zero);
+    fe_mul(fe, scratch[i], scratch[i], acc);
+    fe_mul(fe, acc, acc, z);
+    fe_select(fe, r[i], scratch[i], fe->zero, zero);
+  }
+
+  fe_cleanse(fe, acc);
+  fe_cleanse(fe, z);
+}
+
 static int
 fe_sqrt(const prime_field_t *fe, fe_t r, const fe_t a) {
   int ret;
@@ -1840,13 +2214,69 @@ scalar_field_init(scalar_field_t *sc, const scalar_def_t *def, int endian) {
   mpn_mont(&sc->k, sc->r2, sc->n, sc->limbs);
 
   /* Optimized scalar inverse (optional). */
-  sc->invert = def->invert;
+  sc->invert = INVERT_CHAIN ? def->invert : NULL;
 }
 
 /*
  * Prime Field
  */
 
+static int
+fe_has_adx(void) {
+  /* Check for BMI2 (mulx) and ADX (adcx/adox). */
+  uint32_t eax, ebx, ecx, edx;
+
+  if (!torsion_has_cpuid())
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  return ((ebx >> 8) & 1) && ((ebx >> 19) & 1);
+}
+
+static int
+fe_has_avx2(void) {
+  /* Check for AVX, AVX2 and OS support for the ymm registers. */
+#if defined(TORSION_HAVE_ASM_X64)
+  uint32_t eax, ebx, ecx, edx;
+
+  if (!torsion_has_cpuid())
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 0, 0);
+
+  if (eax < 7)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 1, 0);
+
+  /* OSXSAVE and AVX. */
+  if (((ecx >> 27) & 1) == 0 || ((ecx >> 28) & 1) == 0)
+    return 0;
+
+  /* xgetbv (XCR0): xmm and ymm state enabled. */
+  __asm__ __volatile__(
+    ".byte 0x0f, 0x01, 0xd0\n"
+    : "=a" (eax), "=d" (edx)
+    : "c" (0)
+  );
+
+  if ((eax & 6) != 6)
+    return 0;
+
+  torsion_cpuid(&eax, &ebx, &ecx, &edx, 7, 0);
+
+  return (ebx >> 5) & 1;
+#else
+  return 0;
+#endif
+}
+
 static void
 prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
   /* Prime field using a fiat backend. */
@@ -1873,8 +2303,8 @@ prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
 
   /* Function pointers for field arithmetic. In
    * addition to fiat's default functions, we
-   * have optimized addition chains for inversions,
-   * square roots, and inverse square roots.
+   * have optimized addition chains for square
+   * roots and inverse square roots.
    */
   fe->add = def->add;
   fe->sub = def->sub;
@@ -1889,10 +2319,16 @@ prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
   fe->from_bytes = def->from_bytes;
   fe->carry = def->carry;
   fe->scmul_121666 = def->scmul_121666;
-  fe->invert = def->invert;
+  fe->invert = INVERT_CHAIN ? def->invert : NULL;
   fe->sqrt = def->sqrt;
   fe->isqrt = def->isqrt;
 
+  /* Hand-written multiplication (optional). */
+  if (def->mul_adx != NULL && fe_has_adx()) {
+    fe->mul = def->mul_adx;
+    fe->square = def->square_adx;
+  }
+
   /* Pre-montgomerized constants. */
   fe_set_word(fe, fe->zero, 0);
   fe_set_word(fe, fe->one, 1);
@@ -1902,6 +2338,23 @@ prime_field_init(prime_field_t *fe, const prime_def_t *def, int endian) {
   fe_neg(fe, fe->mone, fe->one);
 }
 
+static void
+field_set_invert(prime_field_t *fe,
+                 scalar_field_t *sc,
+                 const prime_def_t *fe_def,
+                 const scalar_def_t *sc_def,
+                 unsigned int flags) {
+  /* Override the default inverter. Fields
+     without a chain fall back to safegcd. */
+  if (flags & ECC_FLAG_INVERT_CHAIN) {
+    fe->invert = fe_def->invert;
+    sc->invert = sc_def->invert;
+  } else if (flags & ECC_FLAG_INVERT_SAFEGCD) {
+    fe->invert = NULL;
+    sc->invert = NULL;
+  }
+}
+
 /*
  * Short Weierstrass
  */
@@ -1927,10 +2380,6 @@ jge_dbl_var(const wei_t *ec, jge_t *r, const jge_t *p);
 static void
 jge_add_var(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b);
 
-static void
-jge_mixed_addsub_var(const wei_t *ec, jge_t *r, const jge_t *a,
-                     const fe_t bx, const fe_t by, int negate);
-
 static void
 jge_mixed_add_var(const wei_t *ec, jge_t *r, const jge_t *a, const wge_t *b);
 
@@ -1940,6 +2389,22 @@ jge_mixed_sub_var(const wei_t *ec, jge_t *r, const jge_t *a, const wge_t *b);
 static void
 jge_to_wge_all_var(const wei_t *ec, wge_t *out, const jge_t *in, size_t len);
 
+static void
+jge_naf_points_var(const wei_t *ec, jge_t *out,
+                   const wge_t *p, size_t width);
+
+static const wge_t *
+wei_wnd_fixed(const wei_t *ec);
+
+static const wge_t *
+wei_wnd_naf(const wei_t *ec);
+
+static const wge_t *
+wei_wnd_endo(const wei_t *ec);
+
+static void
+wei_endo_split(const wei_t *ec, sc_t k1, sc_t k2, const sc_t k);
+
 /*
  * Short Weierstrass Affine Point
  */
@@ -2491,26 +2956,29 @@ static void
 wge_fixed_points_var(const wei_t *ec, wge_t *out, const wge_t *p) {
   /* NOTE: Only called on initialization. */
   const scalar_field_t *sc = &ec->sc;
-  size_t size = FIXED_LENGTH(sc->bits);
-  jge_t *wnds = checked_malloc(size * sizeof(jge_t)); /* 442.2kb */
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  size_t len = steps * size;
+  jge_t *wnds = checked_malloc(len * sizeof(jge_t)); /* 221.1kb */
   size_t i, j;
   jge_t g;
 
   wge_to_jge(ec, &g, p);
 
-  for (i = 0; i < FIXED_STEPS(sc->bits); i++) {
-    jge_t *wnd = &wnds[i * FIXED_SIZE];
+  for (i = 0; i < steps; i++) {
+    jge_t *wnd = &wnds[i * size];
 
-    jge_zero(ec, &wnd[0]);
+    jge_set(ec, &wnd[0], &g);
 
-    for (j = 1; j < FIXED_SIZE; j++)
+    for (j = 1; j < size; j++)
       jge_add_var(ec, &wnd[j], &wnd[j - 1], &g);
 
-    for (j = 0; j < FIXED_WIDTH; j++)
+    for (j = 0; j < width; j++)
       jge_dbl_var(ec, &g, &g);
   }
 
-  jge_to_wge_all_var(ec, out, wnds, size);
+  jge_to_wge_all_var(ec, out, wnds, len);
 
   free(wnds);
 }
@@ -2764,153 +3232,169 @@ jge_neg_cond(const wei_t *ec, jge_t *r, const jge_t *a, unsigned int flag) {
   fe_set(fe, r->z, a->z);
 }
 
-static void
-jge_dblj(const wei_t *ec, jge_t *r, const jge_t *p) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#doubling-dbl-1998-cmo-2
-   * 3M + 6S + 4A + 1*a + 2*2 + 1*3 + 1*4 + 1*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t xx, yy, zz, s, m, t;
-
-  /* XX = X1^2 */
-  fe_sqr(fe, xx, p->x);
-
-  /* YY = Y1^2 */
-  fe_sqr(fe, yy, p->y);
-
-  /* ZZ = Z1^2 */
-  fe_sqr(fe, zz, p->z);
-
-  /* S = 4 * X1 * YY */
-  fe_mul(fe, s, p->x, yy);
-  fe_add(fe, s, s, s);
-  fe_add(fe, s, s, s);
-
-  /* M = 3 * XX + a * ZZ^2 */
-  fe_add(fe, m, xx, xx);
-  fe_add(fe, m, m, xx);
-  fe_sqr(fe, t, zz);
-  fe_mul(fe, t, t, ec->a);
-  fe_add(fe, m, m, t);
-
-  /* T = M^2 - 2 * S */
-  fe_sqr(fe, t, m);
-  fe_sub(fe, t, t, s);
-  fe_sub(fe, t, t, s);
-
-  /* Z3 = 2 * Y1 * Z1 */
-  fe_mul(fe, r->z, p->z, p->y);
-  fe_add(fe, r->z, r->z, r->z);
-
-  /* X3 = T */
-  fe_set(fe, r->x, t);
-
-  /* Y3 = M * (S - T) - 8 * YY^2 */
-  fe_sub(fe, xx, s, t);
-  fe_sqr(fe, zz, yy);
-  fe_add(fe, zz, zz, zz);
-  fe_add(fe, zz, zz, zz);
-  fe_add(fe, zz, zz, zz);
-  fe_mul(fe, r->y, m, xx);
-  fe_sub(fe, r->y, r->y, zz);
-}
-
-static void
-jge_dbl0(const wei_t *ec, jge_t *r, const jge_t *p) {
-  /* Assumes a = 0.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#doubling-dbl-2009-l
-   * 2M + 5S + 6A + 3*2 + 1*3 + 1*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, f;
-
-  /* A = X1^2 */
-  fe_sqr(fe, a, p->x);
-
-  /* B = Y1^2 */
-  fe_sqr(fe, b, p->y);
-
-  /* C = B^2 */
-  fe_sqr(fe, c, b);
-
-  /* D = 2 * ((X1 + B)^2 - A - C) */
-  fe_add(fe, d, p->x, b);
-  fe_sqr(fe, d, d);
-  fe_sub(fe, d, d, a);
-  fe_sub(fe, d, d, c);
-  fe_add(fe, d, d, d);
-
-  /* E = 3 * A */
-  fe_add(fe, e, a, a);
-  fe_add(fe, e, e, a);
-
-  /* F = E^2 */
-  fe_sqr(fe, f, e);
-
-  /* Z3 = 2 * Y1 * Z1 */
-  fe_mul(fe, r->z, p->z, p->y);
-  fe_add(fe, r->z, r->z, r->z);
-
-  /* X3 = F - 2 * D */
-  fe_add(fe, r->x, d, d);
-  fe_sub(fe, r->x, f, r->x);
-
-  /* Y3 = E * (D - X3) - 8 * C */
-  fe_add(fe, c, c, c);
-  fe_add(fe, c, c, c);
-  fe_add(fe, c, c, c);
-  fe_sub(fe, d, d, r->x);
-  fe_mul(fe, r->y, e, d);
-  fe_sub(fe, r->y, r->y, c);
-}
-
-static void
-jge_dbl3(const wei_t *ec, jge_t *r, const jge_t *p) {
-  /* Assumes a = -3.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
-   * 3M + 5S + 8A + 1*3 + 1*4 + 2*8
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t delta, gamma, beta, alpha, t1, t2;
-
-  /* delta = Z1^2 */
-  fe_sqr(fe, delta, p->z);
-
-  /* gamma = Y1^2 */
-  fe_sqr(fe, gamma, p->y);
-
-  /* beta = X1 * gamma */
-  fe_mul(fe, beta, p->x, gamma);
+/* Generic group law (see group.h). */
+#define GROUP_NAME(name) generic_ ## name
+#define GROUP_WEI
+#define GROUP_DBLJ
+#define GROUP_DBL0
+#define GROUP_DBL3
+#define GROUP_ZERO_A ec->zero_a
+#define GROUP_MUL_A(r, x) wei_mul_a(ec, r, x)
+#define FE_ADD(r, a, b) fe_add(&ec->fe, r, a, b)
+#define FE_SUB(r, a, b) fe_sub(&ec->fe, r, a, b)
+#define FE_NEG(r, a) fe_neg(&ec->fe, r, a)
+#define FE_MUL(r, a, b) fe_mul(&ec->fe, r, a, b)
+#define FE_SQR(r, a) fe_sqr(&ec->fe, r, a)
+#define FE_SELECT(r, a, b, flag) fe_select(&ec->fe, r, a, b, flag)
+#define FE_SET(r, a) fe_set(&ec->fe, r, a)
+#include "group.h"
+
+static const wei_group_t wei_group_generic = {
+  generic_jge_dblj,
+  generic_jge_addsub_var,
+  generic_jge_mixed_addsub_var,
+  generic_jge_add,
+  generic_jge_mixed_add,
+  NULL,
+  NULL
+};
 
-  /* alpha = 3 * (X1 - delta) * (X1 + delta) */
-  fe_sub(fe, t1, p->x, delta);
-  fe_add(fe, t2, p->x, delta);
-  fe_add(fe, alpha, t1, t1);
-  fe_add(fe, alpha, alpha, t1);
-  fe_mul(fe, alpha, alpha, t2);
+/* P-256 (a = -3). */
+#define GROUP_NAME(name) p256_ ## name
+#define GROUP_WEI
+#define GROUP_DBL3
+#define GROUP_MUL
+#define GROUP_ZERO_A 0
+#define GROUP_MUL_A(r, x) do { \
+  FE_ADD(r, x, x);             \
+  FE_ADD(r, r, x);             \
+  FE_NEG(r, r);                \
+} while (0)
+#define FE_ADD p256_fe_add
+#define FE_SUB p256_fe_sub
+#define FE_NEG p256_fe_neg
+#define FE_MUL p256_fe_mul
+#define FE_SQR p256_fe_sqr
+#define FE_SELECT(r, a, b, flag) fiat_p256_selectznz(r, (flag) != 0, a, b)
+#define FE_SET p256_fe_set
+#include "group.h"
+
+static const wei_group_t wei_group_p256 = {
+  p256_jge_dbl3,
+  p256_jge_addsub_var,
+  p256_jge_mixed_addsub_var,
+  p256_jge_add,
+  p256_jge_mixed_add,
+  p256_wei_jmul_g,
+  p256_wei_jmul_double_var
+};
 
-  /* Z3 = (Y1 + Z1)^2 - gamma - delta */
-  fe_add(fe, r->z, p->y, p->z);
-  fe_sqr(fe, r->z, r->z);
-  fe_sub(fe, r->z, r->z, gamma);
-  fe_sub(fe, r->z, r->z, delta);
+#ifdef TORSION_HAVE_ASM_ADX
+#define GROUP_NAME(name) p256_adx_ ## name
+#define GROUP_WEI
+#define GROUP_DBL3
+#define GROUP_MUL
+#define GROUP_ZERO_A 0
+#define GROUP_MUL_A(r, x) do { \
+  FE_ADD(r, x, x);             \
+  FE_ADD(r, r, x);             \
+  FE_NEG(r, r);                \
+} while (0)
+#define FE_ADD p256_fe_add
+#define FE_SUB p256_fe_sub
+#define FE_NEG p256_fe_neg
+#define FE_MUL p256_fe_mul_adx
+#define FE_SQR p256_fe_sqr_adx
+#define FE_SELECT(r, a, b, flag) fiat_p256_selectznz(r, (flag) != 0, a, b)
+#define FE_SET p256_fe_set
+#include "group.h"
+
+static const wei_group_t wei_group_p256_adx = {
+  p256_adx_jge_dbl3,
+  p256_adx_jge_addsub_var,
+  p256_adx_jge_mixed_addsub_var,
+  p256_adx_jge_add,
+  p256_adx_jge_mixed_add,
+  p256_adx_wei_jmul_g,
+  p256_adx_wei_jmul_double_var
+};
+#else
+#define wei_group_p256_adx wei_group_p256
+#endif
 
-  /* X3 = alpha^2 - 8 * beta */
-  fe_add(fe, t1, beta, beta);
-  fe_add(fe, t1, t1, t1);
-  fe_add(fe, t2, t1, t1);
-  fe_sqr(fe, r->x, alpha);
-  fe_sub(fe, r->x, r->x, t2);
+/* secp256k1 (a = 0). */
+#define GROUP_NAME(name) secp256k1_ ## name
+#define GROUP_WEI
+#define GROUP_DBL0
+#define GROUP_MUL
+#define GROUP_ENDO
+#define GROUP_ZERO_A 1
+#define GROUP_MUL_A(r, x) wei_mul_a(ec, r, x) /* Unused. */
+#ifdef TORSION_USE_LIBSECP256K1
+#define FE_ADD(r, a, b) do {     \
+  secp256k1_fe_add(r, a, b);     \
+  fiat_secp256k1_carry(r, r);    \
+} while (0)
+#define FE_SUB(r, a, b) do {     \
+  secp256k1_fe_sub(r, a, b);     \
+  fiat_secp256k1_carry(r, r);    \
+} while (0)
+#define FE_NEG(r, a) do {        \
+  secp256k1_fe_neg(r, a);        \
+  fiat_secp256k1_carry(r, r);    \
+} while (0)
+#else
+#define FE_ADD secp256k1_fe_add
+#define FE_SUB secp256k1_fe_sub
+#define FE_NEG secp256k1_fe_neg
+#endif
+#define FE_MUL secp256k1_fe_mul
+#define FE_SQR secp256k1_fe_sqr
+#define FE_SELECT(r, a, b, flag) \
+  fiat_secp256k1_selectznz(r, (flag) != 0, a, b)
+#define FE_SET secp256k1_fe_set
+#include "group.h"
+
+static const wei_group_t wei_group_secp256k1 = {
+  secp256k1_jge_dbl0,
+  secp256k1_jge_addsub_var,
+  secp256k1_jge_mixed_addsub_var,
+  secp256k1_jge_add,
+  secp256k1_jge_mixed_add,
+  secp256k1_wei_jmul_g,
+  secp256k1_wei_jmul_double_var
+};
 
-  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
-  fe_sub(fe, r->y, t1, r->x);
-  fe_mul(fe, r->y, r->y, alpha);
-  fe_sqr(fe, gamma, gamma);
-  fe_add(fe, gamma, gamma, gamma);
-  fe_add(fe, gamma, gamma, gamma);
-  fe_add(fe, gamma, gamma, gamma);
-  fe_sub(fe, r->y, r->y, gamma);
-}
+#if defined(TORSION_HAVE_ASM_ADX) && !defined(TORSION_USE_LIBSECP256K1)
+#define GROUP_NAME(name) secp256k1_adx_ ## name
+#define GROUP_WEI
+#define GROUP_DBL0
+#define GROUP_MUL
+#define GROUP_ENDO
+#define GROUP_ZERO_A 1
+#define GROUP_MUL_A(r, x) wei_mul_a(ec, r, x) /* Unused. */
+#define FE_ADD secp256k1_fe_add
+#define FE_SUB secp256k1_fe_sub
+#define FE_NEG secp256k1_fe_neg
+#define FE_MUL secp256k1_fe_mul_adx
+#define FE_SQR secp256k1_fe_sqr_adx
+#define FE_SELECT(r, a, b, flag) \
+  fiat_secp256k1_selectznz(r, (flag) != 0, a, b)
+#define FE_SET secp256k1_fe_set
+#include "group.h"
+
+static const wei_group_t wei_group_secp256k1_adx = {
+  secp256k1_adx_jge_dbl0,
+  secp256k1_adx_jge_addsub_var,
+  secp256k1_adx_jge_mixed_addsub_var,
+  secp256k1_adx_jge_add,
+  secp256k1_adx_jge_mixed_add,
+  secp256k1_adx_wei_jmul_g,
+  secp256k1_adx_wei_jmul_double_var
+};
+#else
+#define wei_group_secp256k1_adx wei_group_secp256k1
+#endif
 
 static void
 jge_dbl_var(const wei_t *ec, jge_t *r, const jge_t *p) {
@@ -2928,112 +3412,30 @@ jge_dbl_var(const wei_t *ec, jge_t *r, const jge_t *p) {
     return;
   }
 
-  if (ec->zero_a)
-    jge_dbl0(ec, r, p);
-  else if (ec->three_a)
-    jge_dbl3(ec, r, p);
-  else
-    jge_dblj(ec, r, p);
+  ec->group.dbl(ec, r, p);
 }
 
 static void
-jge_addsub_var(const wei_t *ec, jge_t *r,
-               const jge_t *a, const jge_t *b, int negate) {
-  /* No assumptions.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-1998-cmo-2
-   * 12M + 4S + 6A + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t z1z1, z2z2, u1, u2, s1, s2, h, r0, hh, hhh, v;
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, a->z);
-
-  /* Z2Z2 = Z2^2 */
-  fe_sqr(fe, z2z2, b->z);
+jge_add_var(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b) {
+  /* O + P = P */
+  if (jge_is_zero(ec, a)) {
+    jge_set(ec, r, b);
+    return;
+  }
 
-  /* U1 = X1 * Z2Z2 */
-  fe_mul(fe, u1, a->x, z2z2);
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, b->x, z1z1);
-
-  /* S1 = Y1 * Z2 * Z2Z2 */
-  fe_mul(fe, s1, a->y, b->z);
-  fe_mul(fe, s1, s1, z2z2);
-
-  /* S2 = Y2 * Z1 * Z1Z1 */
-  fe_mul(fe, s2, b->y, a->z);
-  fe_mul(fe, s2, s2, z1z1);
-
-  /* S2 = -S2 (if subtracting) */
-  if (negate)
-    fe_neg(fe, s2, s2);
-
-  /* H = U2 - U1 */
-  fe_sub(fe, h, u2, u1);
-
-  /* r = S2 - S1 */
-  fe_sub(fe, r0, s2, s1);
-
-  /* H = 0 */
-  if (fe_is_zero(fe, h)) {
-    if (!fe_is_zero(fe, r0)) {
-      jge_zero(ec, r);
-      return;
-    }
-
-    jge_dbl_var(ec, r, a);
-    return;
-  }
-
-  /* HH = H^2 */
-  fe_sqr(fe, hh, h);
-
-  /* HHH = H * HH */
-  fe_mul(fe, hhh, h, hh);
-
-  /* V = U1 * HH */
-  fe_mul(fe, v, u1, hh);
-
-  /* Z3 = Z1 * Z2 * H */
-  fe_mul(fe, r->z, a->z, b->z);
-  fe_mul(fe, r->z, r->z, h);
-
-  /* X3 = r^2 - HHH - 2 * V */
-  fe_sqr(fe, r->x, r0);
-  fe_sub(fe, r->x, r->x, hhh);
-  fe_sub(fe, r->x, r->x, v);
-  fe_sub(fe, r->x, r->x, v);
-
-  /* Y3 = r * (V - X3) - S1 * HHH */
-  fe_sub(fe, u1, v, r->x);
-  fe_mul(fe, u2, s1, hhh);
-  fe_mul(fe, r->y, r0, u1);
-  fe_sub(fe, r->y, r->y, u2);
-}
-
-static void
-jge_add_var(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b) {
-  /* O + P = P */
-  if (jge_is_zero(ec, a)) {
-    jge_set(ec, r, b);
-    return;
-  }
-
-  /* P + O = P */
-  if (jge_is_zero(ec, b)) {
-    jge_set(ec, r, a);
-    return;
-  }
+  /* P + O = P */
+  if (jge_is_zero(ec, b)) {
+    jge_set(ec, r, a);
+    return;
+  }
 
   /* Z2 = 1 */
   if (jge_is_affine(ec, b)) {
-    jge_mixed_addsub_var(ec, r, a, b->x, b->y, 0);
+    ec->group.mixed_addsub_var(ec, r, a, b->x, b->y, 0);
     return;
   }
 
-  jge_addsub_var(ec, r, a, b, 0);
+  ec->group.addsub_var(ec, r, a, b, 0);
 }
 
 static void
@@ -3052,81 +3454,11 @@ jge_sub_var(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b) {
 
   /* Z2 = 1 */
   if (jge_is_affine(ec, b)) {
-    jge_mixed_addsub_var(ec, r, a, b->x, b->y, 1);
-    return;
-  }
-
-  jge_addsub_var(ec, r, a, b, 1);
-}
-
-static void
-jge_mixed_addsub_var(const wei_t *ec, jge_t *r, const jge_t *a,
-                     const fe_t bx, const fe_t by, int negate) {
-  /* Assumes Z2 = 1.
-   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd
-   * 8M + 3S + 6A + 5*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t z1z1, u2, s2, h, r0, i, j, v;
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, a->z);
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, bx, z1z1);
-
-  /* S2 = Y2 * Z1 * Z1Z1 */
-  fe_mul(fe, s2, by, a->z);
-  fe_mul(fe, s2, s2, z1z1);
-
-  /* S2 = -S2 (if subtracting) */
-  if (negate)
-    fe_neg(fe, s2, s2);
-
-  /* H = U2 - X1 */
-  fe_sub(fe, h, u2, a->x);
-
-  /* r = 2 * (S2 - Y1) */
-  fe_sub(fe, r0, s2, a->y);
-  fe_add(fe, r0, r0, r0);
-
-  /* H = 0 */
-  if (fe_is_zero(fe, h)) {
-    if (!fe_is_zero(fe, r0)) {
-      jge_zero(ec, r);
-      return;
-    }
-
-    jge_dbl_var(ec, r, a);
+    ec->group.mixed_addsub_var(ec, r, a, b->x, b->y, 1);
     return;
   }
 
-  /* I = (2 * H)^2 */
-  fe_add(fe, i, h, h);
-  fe_sqr(fe, i, i);
-
-  /* J = H * I */
-  fe_mul(fe, j, h, i);
-
-  /* V = X1 * I */
-  fe_mul(fe, v, a->x, i);
-
-  /* X3 = r^2 - J - 2 * V */
-  fe_sqr(fe, r->x, r0);
-  fe_sub(fe, r->x, r->x, j);
-  fe_sub(fe, r->x, r->x, v);
-  fe_sub(fe, r->x, r->x, v);
-
-  /* Y3 = r * (V - X3) - 2 * Y1 * J */
-  fe_sub(fe, u2, v, r->x);
-  fe_mul(fe, s2, a->y, j);
-  fe_add(fe, s2, s2, s2);
-  fe_mul(fe, r->y, r0, u2);
-  fe_sub(fe, r->y, r->y, s2);
-
-  /* Z3 = 2 * Z1 * H */
-  fe_mul(fe, r->z, a->z, h);
-  fe_add(fe, r->z, r->z, r->z);
+  ec->group.addsub_var(ec, r, a, b, 1);
 }
 
 static void
@@ -3143,7 +3475,7 @@ jge_mixed_add_var(const wei_t *ec, jge_t *r, const jge_t *a, const wge_t *b) {
     return;
   }
 
-  jge_mixed_addsub_var(ec, r, a, b->x, b->y, 0);
+  ec->group.mixed_addsub_var(ec, r, a, b->x, b->y, 0);
 }
 
 static void
@@ -3161,7 +3493,7 @@ jge_mixed_sub_var(const wei_t *ec, jge_t *r, const jge_t *a, const wge_t *b) {
     return;
   }
 
-  jge_mixed_addsub_var(ec, r, a, b->x, b->y, 1);
+  ec->group.mixed_addsub_var(ec, r, a, b->x, b->y, 1);
 }
 
 static void
@@ -3176,12 +3508,7 @@ jge_dbl(const wei_t *ec, jge_t *r, const jge_t *p) {
   if (ec->h > 1)
     inf |= fe_is_zero(fe, p->y);
 
-  if (ec->zero_a)
-    jge_dbl0(ec, r, p);
-  else if (ec->three_a)
-    jge_dbl3(ec, r, p);
-  else
-    jge_dblj(ec, r, p);
+  ec->group.dbl(ec, r, p);
 
   fe_select(fe, r->x, r->x, fe->one, inf);
   fe_select(fe, r->y, r->y, fe->one, inf);
@@ -3190,158 +3517,7 @@ jge_dbl(const wei_t *ec, jge_t *r, const jge_t *p) {
 
 static void
 jge_add(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b) {
-  /* Strongly unified Jacobian addition (Brier and Joye).
-   *
-   * [SIDE2] Page 6, Section 3.
-   * [SIDE3] Page 4, Section 3.
-   *
-   * The above documents use projective coordinates[1]
-   * and have been modified for jacobian coordinates. A
-   * further modification, taken from libsecp256k1[2],
-   * handles the degenerate case of: x1 != x2, y1 = -y2.
-   *
-   * [1] https://hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-2002-bj
-   * [2] https://github.com/bitcoin-core/secp256k1/blob/ee9e68c/src/group_impl.h#L525
-   *
-   * 11M + 8S + 7A + 1*a + 2*4 + 1*3 + 2*2 (a != 0)
-   * 11M + 6S + 6A + 2*4 + 1*3 + 2*2 (a = 0)
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t z1z1, z2z2, u1, u2, s1, s2, z, t, m, l, w, h;
-  int degenerate, inf1, inf2, inf3;
-
-  /* Save some stack space. */
-#define ll l
-#define f m
-#define r0 z1z1
-#define g z2z2
-#define x3 u2
-#define y3 s2
-#define z3 t
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, a->z);
-
-  /* Z2Z2 = Z2^2 */
-  fe_sqr(fe, z2z2, b->z);
-
-  /* U1 = X1 * Z2Z2 */
-  fe_mul(fe, u1, a->x, z2z2);
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, b->x, z1z1);
-
-  /* S1 = Y1 * Z2Z2 * Z2 */
-  fe_mul(fe, s1, a->y, z2z2);
-  fe_mul(fe, s1, s1, b->z);
-
-  /* S2 = Y2 * Z1Z1 * Z1 */
-  fe_mul(fe, s2, b->y, z1z1);
-  fe_mul(fe, s2, s2, a->z);
-
-  /* Z = Z1 * Z2 */
-  fe_mul(fe, z, a->z, b->z);
-
-  /* T = U1 + U2 */
-  fe_add(fe, t, u1, u2);
-
-  /* M = S1 + S2 */
-  fe_add(fe, m, s1, s2);
-
-  /* R = T^2 - U1 * U2 */
-  fe_sqr(fe, r0, t);
-  fe_mul(fe, l, u1, u2);
-  fe_sub(fe, r0, r0, l);
-
-  /* R = R + a * Z^4 (if a != 0) */
-  if (!ec->zero_a) {
-    fe_sqr(fe, l, z);
-    fe_sqr(fe, l, l);
-    wei_mul_a(ec, l, l);
-    fe_add(fe, r0, r0, l);
-  }
-
-  /* Check for degenerate case (X1 != X2, Y1 = -Y2). */
-  degenerate = fe_is_zero(fe, m) & fe_is_zero(fe, r0);
-
-  /* M = U1 - U2 (if degenerate) */
-  fe_sub(fe, l, u1, u2);
-  fe_select(fe, m, m, l, degenerate);
-
-  /* R = S1 - S2 (if degenerate) */
-  fe_sub(fe, l, s1, s2);
-  fe_select(fe, r0, r0, l, degenerate);
-
-  /* L = M^2 */
-  fe_sqr(fe, l, m);
-
-  /* G = T * L */
-  fe_mul(fe, g, t, l);
-
-  /* LL = L^2 */
-  fe_sqr(fe, ll, l);
-
-  /* LL = 0 (if degenerate) */
-  fe_select(fe, ll, ll, fe->zero, degenerate);
-
-  /* W = R^2 */
-  fe_sqr(fe, w, r0);
-
-  /* F = Z * M */
-  fe_mul(fe, f, m, z);
-
-  /* H = 3 * G - 2 * W */
-  fe_add(fe, h, g, g);
-  fe_add(fe, h, h, g);
-  fe_sub(fe, h, h, w);
-  fe_sub(fe, h, h, w);
-
-  /* X3 = 4 * (W - G) */
-  fe_sub(fe, x3, w, g);
-  fe_add(fe, x3, x3, x3);
-  fe_add(fe, x3, x3, x3);
-
-  /* Y3 = 4 * (R * H - LL) */
-  fe_mul(fe, y3, r0, h);
-  fe_sub(fe, y3, y3, ll);
-  fe_add(fe, y3, y3, y3);
-  fe_add(fe, y3, y3, y3);
-
-  /* Z3 = 2 * F */
-  fe_add(fe, z3, f, f);
-
-  /* Check for infinity. */
-  inf1 = fe_is_zero(fe, a->z);
-  inf2 = fe_is_zero(fe, b->z);
-  inf3 = fe_is_zero(fe, z3) & ((inf1 | inf2) ^ 1);
-
-  /* Case 1: O + P = P */
-  fe_select(fe, x3, x3, b->x, inf1);
-  fe_select(fe, y3, y3, b->y, inf1);
-  fe_select(fe, z3, z3, b->z, inf1);
-
-  /* Case 2: P + O = P */
-  fe_select(fe, x3, x3, a->x, inf2);
-  fe_select(fe, y3, y3, a->y, inf2);
-  fe_select(fe, z3, z3, a->z, inf2);
-
-  /* Case 3: P + -P = O */
-  fe_select(fe, x3, x3, fe->one, inf3);
-  fe_select(fe, y3, y3, fe->one, inf3);
-  fe_select(fe, z3, z3, fe->zero, inf3);
-
-  /* R = (X3, Y3, Z3) */
-  fe_set(fe, r->x, x3);
-  fe_set(fe, r->y, y3);
-  fe_set(fe, r->z, z3);
-
-#undef ll
-#undef f
-#undef r0
-#undef g
-#undef x3
-#undef y3
-#undef z3
+  ec->group.add(ec, r, a, b);
 }
 
 TORSION_UNUSED static void
@@ -3353,143 +3529,7 @@ jge_sub(const wei_t *ec, jge_t *r, const jge_t *a, const jge_t *b) {
 
 static void
 jge_mixed_add(const wei_t *ec, jge_t *r, const jge_t *a, const wge_t *b) {
-  /* Strongly unified mixed addition (Brier and Joye).
-   *
-   * [SIDE2] Page 6, Section 3.
-   * [SIDE3] Page 4, Section 3.
-   *
-   * 7M + 7S + 7A + 1*a + 2*4 + 1*3 + 2*2 (a != 0)
-   * 7M + 5S + 6A + 2*4 + 1*3 + 2*2 (a = 0)
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t z1z1, u2, s2, t, m, l, g, w, h;
-  int degenerate, inf1, inf2, inf3;
-
-  /* Save some stack space. */
-#define u1 a->x
-#define s1 a->y
-#define ll l
-#define f m
-#define r0 z1z1
-#define x3 u2
-#define y3 s2
-#define z3 t
-
-  /* Z1Z1 = Z1^2 */
-  fe_sqr(fe, z1z1, a->z);
-
-  /* U1 = X1 */
-
-  /* U2 = X2 * Z1Z1 */
-  fe_mul(fe, u2, b->x, z1z1);
-
-  /* S1 = Y1 */
-
-  /* S2 = Y2 * Z1Z1 * Z1 */
-  fe_mul(fe, s2, b->y, z1z1);
-  fe_mul(fe, s2, s2, a->z);
-
-  /* T = U1 + U2 */
-  fe_add(fe, t, u1, u2);
-
-  /* M = S1 + S2 */
-  fe_add(fe, m, s1, s2);
-
-  /* R = T^2 - U1 * U2 */
-  fe_sqr(fe, r0, t);
-  fe_mul(fe, l, u1, u2);
-  fe_sub(fe, r0, r0, l);
-
-  /* R = R + a * Z1^4 (if a != 0) */
-  if (!ec->zero_a) {
-    fe_sqr(fe, l, a->z);
-    fe_sqr(fe, l, l);
-    wei_mul_a(ec, l, l);
-    fe_add(fe, r0, r0, l);
-  }
-
-  /* Check for degenerate case (X1 != X2, Y1 = -Y2). */
-  degenerate = fe_is_zero(fe, m) & fe_is_zero(fe, r0);
-
-  /* M = U1 - U2 (if degenerate) */
-  fe_sub(fe, l, u1, u2);
-  fe_select(fe, m, m, l, degenerate);
-
-  /* R = S1 - S2 (if degenerate) */
-  fe_sub(fe, l, s1, s2);
-  fe_select(fe, r0, r0, l, degenerate);
-
-  /* L = M^2 */
-  fe_sqr(fe, l, m);
-
-  /* G = T * L */
-  fe_mul(fe, g, t, l);
-
-  /* LL = L^2 */
-  fe_sqr(fe, ll, l);
-
-  /* LL = 0 (if degenerate) */
-  fe_select(fe, ll, ll, fe->zero, degenerate);
-
-  /* W = R^2 */
-  fe_sqr(fe, w, r0);
-
-  /* F = Z1 * M */
-  fe_mul(fe, f, m, a->z);
-
-  /* H = 3 * G - 2 * W */
-  fe_add(fe, h, g, g);
-  fe_add(fe, h, h, g);
-  fe_sub(fe, h, h, w);
-  fe_sub(fe, h, h, w);
-
-  /* X3 = 4 * (W - G) */
-  fe_sub(fe, x3, w, g);
-  fe_add(fe, x3, x3, x3);
-  fe_add(fe, x3, x3, x3);
-
-  /* Y3 = 4 * (R * H - LL) */
-  fe_mul(fe, y3, r0, h);
-  fe_sub(fe, y3, y3, ll);
-  fe_add(fe, y3, y3, y3);
-  fe_add(fe, y3, y3, y3);
-
-  /* Z3 = 2 * F */
-  fe_add(fe, z3, f, f);
-
-  /* Check for infinity. */
-  inf1 = fe_is_zero(fe, a->z);
-  inf2 = b->inf;
-  inf3 = fe_is_zero(fe, z3) & ((inf1 | inf2) ^ 1);
-
-  /* Case 1: O + P = P */
-  fe_select(fe, x3, x3, b->x, inf1);
-  fe_select(fe, y3, y3, b->y, inf1);
-  fe_select(fe, z3, z3, fe->one, inf1);
-
-  /* Case 2: P + O = P */
-  fe_select(fe, x3, x3, a->x, inf2);
-  fe_select(fe, y3, y3, a->y, inf2);
-  fe_select(fe, z3, z3, a->z, inf2);
-
-  /* Case 3: P + -P = O */
-  fe_select(fe, x3, x3, fe->one, inf3);
-  fe_select(fe, y3, y3, fe->one, inf3);
-  fe_select(fe, z3, z3, fe->zero, inf3);
-
-  /* R = (X3, Y3, Z3) */
-  fe_set(fe, r->x, x3);
-  fe_set(fe, r->y, y3);
-  fe_set(fe, r->z, z3);
-
-#undef u1
-#undef s1
-#undef ll
-#undef f
-#undef r0
-#undef x3
-#undef y3
-#undef z3
+  ec->group.mixed_add(ec, r, a, b);
 }
 
 TORSION_UNUSED static void
@@ -3558,6 +3598,46 @@ jge_to_wge_var(const wei_t *ec, wge_t *r, const jge_t *p) {
   r->inf = 0;
 }
 
+static void
+jge_to_wge_all(const wei_t *ec, wge_t *out, const jge_t *in, size_t len) {
+  /* Montgomery's trick (constant time).
+   *
+   * Points at infinity are given a Z of one
+   * for the duration of the inversion.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t acc, z, z2, z3;
+  size_t i;
+
+  fe_set(fe, acc, fe->one);
+
+  for (i = 0; i < len; i++) {
+    fe_select(fe, z, in[i].z, fe->one, fe_is_zero(fe, in[i].z));
+    fe_set(fe, out[i].x, acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  ASSERT(fe_invert(fe, acc, acc));
+
+  for (i = len; i-- > 0;) {
+    fe_select(fe, z, in[i].z, fe->one, fe_is_zero(fe, in[i].z));
+    fe_mul(fe, out[i].x, out[i].x, acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  for (i = 0; i < len; i++) {
+    out[i].inf = fe_is_zero(fe, in[i].z);
+
+    fe_sqr(fe, z2, out[i].x);
+    fe_mul(fe, z3, z2, out[i].x);
+    fe_mul(fe, out[i].x, in[i].x, z2);
+    fe_mul(fe, out[i].y, in[i].y, z3);
+  }
+
+  fe_cleanse(fe, acc);
+  fe_cleanse(fe, z);
+}
+
 static void
 jge_to_wge_all_var(const wei_t *ec, wge_t *out, const jge_t *in, size_t len) {
   /* Montgomery's trick. */
@@ -3655,6 +3735,9 @@ wei_has_high_order(const wei_t *ec);
 static int
 wei_has_small_gap(const wei_t *ec);
 
+static void
+schnorr_hash_init(hash_t *hash, int type, const char *tag);
+
 static void
 wei_init(wei_t *ec, const wei_def_t *def) {
   prime_field_t *fe = &ec->fe;
@@ -3696,6 +3779,19 @@ wei_init(wei_t *ec, const wei_def_t *def) {
   ec->high_order = wei_has_high_order(ec);
   ec->small_gap = wei_has_small_gap(ec);
 
+  if (def->group_adx != NULL && fe->mul == def->fe->mul_adx) {
+    ec->group = *def->group_adx;
+  } else if (def->group != NULL) {
+    ec->group = *def->group;
+  } else {
+    ec->group = wei_group_generic;
+
+    if (ec->zero_a)
+      ec->group.dbl = generic_jge_dbl0;
+    else if (ec->three_a)
+      ec->group.dbl = generic_jge_dbl3;
+  }
+
   fe_import(fe, ec->g.x, def->x);
   fe_import(fe, ec->g.y, def->y);
   ec->g.inf = 0;
@@ -3703,8 +3799,9 @@ wei_init(wei_t *ec, const wei_def_t *def) {
   sc_zero(sc, ec->blind);
   jge_zero(ec, &ec->unblind);
 
-  wge_fixed_points_var(ec, ec->wnd_fixed, &ec->g);
-  wge_naf_points_var(ec, ec->wnd_naf, &ec->g, NAF_WIDTH_PRE);
+  ec->tables = def->tables;
+  ec->fixed_width = WEI_FIXED_WIDTH;
+  ec->naf_width = NAF_WIDTH_PRE;
 
   for (i = 0; i < ec->h; i++) {
     fe_import(fe, ec->torsion[i].x, def->torsion[i].x);
@@ -3722,10 +3819,12 @@ wei_init(wei_t *ec, const wei_def_t *def) {
     sc_import(sc, ec->b2, def->endo->b2);
     sc_import(sc, ec->g1, def->endo->g1);
     sc_import(sc, ec->g2, def->endo->g2);
-
-    for (i = 0; i < NAF_SIZE_PRE; i++)
-      wge_endo_beta(ec, &ec->wnd_endo[i], &ec->wnd_naf[i]);
   }
+
+  /* Tagged hash midstates for BIP340. */
+  schnorr_hash_init(&ec->tag_aux, ec->hash, "BIP340/aux");
+  schnorr_hash_init(&ec->tag_nonce, ec->hash, "BIP340/nonce");
+  schnorr_hash_init(&ec->tag_challenge, ec->hash, "BIP340/challenge");
 }
 
 static int
@@ -3763,6 +3862,138 @@ wei_has_small_gap(const wei_t *ec) {
   return q == 1;
 }
 
+static void
+wei_init_fixed(const wei_t *ec) {
+  const wei_tables_t *tables = ec->tables;
+  const scalar_field_t *sc = &ec->sc;
+  wei_cache_t *cache = ec->cache;
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  wge_t *wnd;
+  size_t i, j;
+
+  if (cache->fixed != NULL)
+    return;
+
+  /* The shipped table is used in place. */
+  if (tables != NULL && tables->fixed_width == width) {
+    ecc_store_release(cache->fixed, tables->fixed);
+    return;
+  }
+
+  wnd = checked_malloc(steps * size * sizeof(wge_t));
+
+  if (tables != NULL && table_has_fixed(tables->fixed_width, width)) {
+    for (i = 0; i < steps; i++) {
+      for (j = 0; j < size; j++) {
+        size_t k = table_fixed_index(tables->fixed_width, width, i, j);
+
+        wnd[i * size + j] = tables->fixed[k];
+      }
+    }
+  } else {
+    wge_fixed_points_var(ec, wnd, &ec->g);
+  }
+
+  ecc_store_release(cache->fixed, wnd);
+}
+
+static void
+wei_init_naf(const wei_t *ec) {
+  const wei_tables_t *tables = ec->tables;
+  wei_cache_t *cache = ec->cache;
+  size_t len = NAF_LENGTH(ec->naf_width);
+  wge_t *wnd, *endo;
+  size_t i;
+
+  if (cache->naf != NULL)
+    return;
+
+  /* Smaller windows are a prefix of the table. */
+  if (tables != NULL) {
+    cache->endo = tables->endo;
+
+    ecc_store_release(cache->naf, tables->naf);
+
+    return;
+  }
+
+  wnd = checked_malloc(len * sizeof(wge_t));
+
+  wge_naf_points_var(ec, wnd, &ec->g, ec->naf_width);
+
+  if (ec->endo) {
+    endo = checked_malloc(len * sizeof(wge_t));
+
+    for (i = 0; i < len; i++)
+      wge_endo_beta(ec, &endo[i], &wnd[i]);
+
+    cache->endo = endo;
+  }
+
+  ecc_store_release(cache->naf, wnd);
+}
+
+static const wge_t *
+wei_wnd_fixed(const wei_t *ec) {
+  /* Tables are computed on first use. The
+     cache is shared between threads, so
+     building a table takes the lock. Once
+     published, it is read without it. */
+  const wge_t *wnd = ecc_load_acquire(ec->cache->fixed);
+
+  if (UNLIKELY(wnd == NULL)) {
+    ecc_global_lock();
+    wei_init_fixed(ec);
+    wnd = ec->cache->fixed;
+    ecc_global_unlock();
+  }
+
+  return wnd;
+}
+
+static const wge_t *
+wei_wnd_naf(const wei_t *ec) {
+  /* The endomorphism table is written
+     before the NAF table is published. */
+  const wge_t *wnd = ecc_load_acquire(ec->cache->naf);
+
+  if (UNLIKELY(wnd == NULL)) {
+    ecc_global_lock();
+    wei_init_naf(ec);
+    wnd = ec->cache->naf;
+    ecc_global_unlock();
+  }
+
+  return wnd;
+}
+
+static const wge_t *
+wei_wnd_endo(const wei_t *ec) {
+  ASSERT(ec->endo);
+
+  wei_wnd_naf(ec);
+
+  return ec->cache->endo;
+}
+
+static void
+wei_cache_clear(wei_cache_t *cache, const wei_tables_t *tables) {
+  /* Shipped tables are not ours to free. */
+  if (tables == NULL || cache->fixed != tables->fixed)
+    free((void *)cache->fixed);
+
+  if (tables == NULL) {
+    free((void *)cache->naf);
+    free((void *)cache->endo);
+  }
+
+  cache->fixed = NULL;
+  cache->naf = NULL;
+  cache->endo = NULL;
+}
+
 static void
 wei_mul_a(const wei_t *ec, fe_t r, const fe_t x) {
   const prime_field_t *fe = &ec->fe;
@@ -3892,33 +4123,71 @@ wei_jmul_g(const wei_t *ec, jge_t *r, const sc_t k) {
    * Windows are appropriately shifted to avoid any
    * doublings. This reduces a 256 bit multiplication
    * down to 64 additions with a window size of 4.
+   *
+   * The scalar is recoded to signed digits, halving
+   * the table and the number of entries we need to
+   * scan. Minimizing the scalar beforehand ensures
+   * the final digit cannot carry.
    */
   const scalar_field_t *sc = &ec->sc;
-  const wge_t *wnds = ec->wnd_fixed;
-  size_t i, j, b;
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  size_t i, j, b, m, carry;
+  unsigned int negated;
+  const wge_t *wnds;
   sc_t k0;
   wge_t t;
 
+  if (ec->group.mul_g != NULL) {
+    ec->group.mul_g(ec, r, k);
+    return;
+  }
+
+  wnds = wei_wnd_fixed(ec);
+
   /* Blind if available. */
   sc_add(sc, k0, k, ec->blind);
 
+  /* Ensure k0 < 2^(bits - 1). */
+  negated = sc_minimize(sc, k0, k0);
+
   /* Multiply in constant time. */
-  jge_set(ec, r, &ec->unblind);
-  wge_zero(ec, &t);
+  jge_neg_cond(ec, r, &ec->unblind, negated);
+
+  carry = 0;
+
+  for (i = 0; i < steps; i++) {
+    b = sc_get_bits(sc, k0, i * width, width) + carry;
+
+    /* Recode to a digit in [-2^(w-1), 2^(w-1)]. */
+    carry = (b + size) >> width;
 
-  for (i = 0; i < FIXED_STEPS(sc->bits); i++) {
-    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH);
+    if (i == steps - 1)
+      carry = 0;
 
-    for (j = 0; j < FIXED_SIZE; j++)
-      wge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j == b);
+    m = -carry;
+    b = (((size << 1) - b) & m) | (b & ~m);
+
+    wge_zero(ec, &t);
+
+    for (j = 0; j < size; j++)
+      wge_select(ec, &t, &t, &wnds[i * size + j], j + 1 == b);
+
+    wge_neg_cond(ec, &t, &t, carry);
 
     jge_mixed_add(ec, r, r, &t);
   }
 
+  jge_neg_cond(ec, r, r, negated);
+
   /* Cleanse. */
   sc_cleanse(sc, k0);
 
   cleanse(&b, sizeof(b));
+  cleanse(&m, sizeof(m));
+  cleanse(&carry, sizeof(carry));
+  cleanse(&negated, sizeof(negated));
 }
 
 static void
@@ -4087,14 +4356,14 @@ wei_jmul_double_normal_var(const wei_t *ec,
    *        Algorithm 3.51, Page 112, Section 3.3.
    */
   const scalar_field_t *sc = &ec->sc;
-  const wge_t *wnd1 = ec->wnd_naf;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
   int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   jge_t wnd2[NAF_SIZE]; /* 1728 bytes */
   size_t i, max, max1, max2;
 
   /* Compute NAFs. */
-  max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
   max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
   max = ECC_MAX(max1, max2);
 
@@ -4135,8 +4404,8 @@ wei_jmul_double_endo_var(const wei_t *ec,
    * [GLV] Page 193, Section 3 (Using Efficient Endomorphisms).
    */
   const scalar_field_t *sc = &ec->sc;
-  const wge_t *wnd1 = ec->wnd_naf;
-  const wge_t *wnd2 = ec->wnd_endo;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
+  const wge_t *wnd2 = wei_wnd_endo(ec);
   int naf1[MAX_ENDO_BITS + 1]; /* 1048 bytes */
   int naf2[MAX_ENDO_BITS + 1]; /* 1048 bytes */
   int naf3[MAX_ENDO_BITS + 1]; /* 1048 bytes */
@@ -4151,7 +4420,7 @@ wei_jmul_double_endo_var(const wei_t *ec,
   wei_endo_split(ec, c3, c4, k2);
 
   /* Compute NAFs. */
-  max1 = sc_naf_endo_var(sc, naf1, naf2, c1, c2, NAF_WIDTH_PRE);
+  max1 = sc_naf_endo_var(sc, naf1, naf2, c1, c2, ec->naf_width);
   max2 = sc_jsf_endo_var(sc, naf3, c3, c4);
   max = ECC_MAX(max1, max2);
 
@@ -4192,7 +4461,9 @@ wei_jmul_double_var(const wei_t *ec,
                     const sc_t k1,
                     const wge_t *p2,
                     const sc_t k2) {
-  if (ec->endo)
+  if (ec->group.mul_double_var != NULL)
+    ec->group.mul_double_var(ec, r, k1, p2, k2);
+  else if (ec->endo)
     wei_jmul_double_endo_var(ec, r, k1, p2, k2);
   else
     wei_jmul_double_normal_var(ec, r, k1, p2, k2);
@@ -4210,9 +4481,162 @@ wei_mul_double_var(const wei_t *ec,
 }
 
 static void
-wei_jmul_multi_normal_var(const wei_t *ec,
-                          jge_t *r,
-                          const sc_t k0,
+wei_jmul_double_pre_normal_var(const wei_t *ec,
+                               jge_t *r,
+                               const sc_t k1,
+                               const struct wei_prepared_s *key,
+                               const sc_t k2) {
+  /* Shamir's trick with a precomputed window
+   * for the second point. Both windows are
+   * affine, so every addition is mixed.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
+  const wge_t *wnd2 = key->wnd;
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  size_t i, max, max1, max2;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
+  max2 = sc_naf_var(sc, naf2, k2, key->width);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      jge_dbl_var(ec, r, r);
+
+    if (z1 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+static void
+wei_jmul_double_pre_endo_var(const wei_t *ec,
+                             jge_t *r,
+                             const sc_t k1,
+                             const struct wei_prepared_s *key,
+                             const sc_t k2) {
+  /* Endomorphism-split variant of the above. The
+   * key carries windows for both P and beta(P),
+   * mirroring the generator's tables.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
+  const wge_t *wnd2 = wei_wnd_endo(ec);
+  const wge_t *wnd3 = key->wnd;
+  const wge_t *wnd4 = key->wnd_endo;
+  int naf1[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf2[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf3[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf4[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  sc_t c1, c2, c3, c4; /* 288 bytes */
+  size_t i, max, max1, max2;
+
+  ASSERT(ec->endo == 1);
+
+  /* Split scalars. */
+  wei_endo_split(ec, c1, c2, k1);
+  wei_endo_split(ec, c3, c4, k2);
+
+  /* Compute NAFs. */
+  max1 = sc_naf_endo_var(sc, naf1, naf2, c1, c2, ec->naf_width);
+  max2 = sc_naf_endo_var(sc, naf3, naf4, c3, c4, key->width);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+    int z3 = naf3[i];
+    int z4 = naf4[i];
+
+    if (i != max - 1)
+      jge_dbl_var(ec, r, r);
+
+    if (z1 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+
+    if (z3 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd3[(z3 - 1) >> 1]);
+    else if (z3 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd3[(-z3 - 1) >> 1]);
+
+    if (z4 > 0)
+      jge_mixed_add_var(ec, r, r, &wnd4[(z4 - 1) >> 1]);
+    else if (z4 < 0)
+      jge_mixed_sub_var(ec, r, r, &wnd4[(-z4 - 1) >> 1]);
+  }
+}
+
+static void
+wei_jmul_double_pre_var(const wei_t *ec,
+                        jge_t *r,
+                        const sc_t k1,
+                        const struct wei_prepared_s *key,
+                        const sc_t k2) {
+  if (key->wnd == NULL)
+    wei_jmul_double_var(ec, r, k1, &key->point, k2);
+  else if (ec->endo)
+    wei_jmul_double_pre_endo_var(ec, r, k1, key, k2);
+  else
+    wei_jmul_double_pre_normal_var(ec, r, k1, key, k2);
+}
+
+static void
+wei_prepared_init(const wei_t *ec,
+                  struct wei_prepared_s *key,
+                  size_t width) {
+  /* NOTE: `point` must already be set. */
+  size_t i, size;
+
+  key->width = width;
+  key->wnd = NULL;
+  key->wnd_endo = NULL;
+
+  if (width == 0)
+    return;
+
+  size = (size_t)1 << (width - 2);
+
+  key->wnd = checked_malloc(size * sizeof(wge_t));
+
+  wge_naf_points_var(ec, key->wnd, &key->point, width);
+
+  if (ec->endo) {
+    key->wnd_endo = checked_malloc(size * sizeof(wge_t));
+
+    for (i = 0; i < size; i++)
+      wge_endo_beta(ec, &key->wnd_endo[i], &key->wnd[i]);
+  }
+}
+
+static void
+wei_jmul_multi_normal_var(const wei_t *ec,
+                          jge_t *r,
+                          const sc_t k0,
                           const wge_t *points,
                           const sc_t *coeffs,
                           size_t len,
@@ -4224,7 +4648,7 @@ wei_jmul_multi_normal_var(const wei_t *ec,
    *        Algorithm 3.51, Page 112, Section 3.3.
    */
   const scalar_field_t *sc = &ec->sc;
-  const wge_t *wnd0 = ec->wnd_naf;
+  const wge_t *wnd0 = wei_wnd_naf(ec);
   jge_t wnd1[NAF_SIZE]; /* 1728 bytes */
   int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
@@ -4235,7 +4659,7 @@ wei_jmul_multi_normal_var(const wei_t *ec,
   ASSERT(len <= scratch->size);
 
   /* Compute fixed NAF. */
-  max = sc_naf_var(sc, naf0, k0, NAF_WIDTH_PRE);
+  max = sc_naf_var(sc, naf0, k0, ec->naf_width);
 
   for (i = 0; i < len - (len & 1); i += 2) {
     /* Compute JSF.*/
@@ -4310,8 +4734,8 @@ wei_jmul_multi_endo_var(const wei_t *ec,
    *        Algorithm 3.51, Page 112, Section 3.3.
    */
   const scalar_field_t *sc = &ec->sc;
-  const wge_t *wnd0 = ec->wnd_naf;
-  const wge_t *wnd1 = ec->wnd_endo;
+  const wge_t *wnd0 = wei_wnd_naf(ec);
+  const wge_t *wnd1 = wei_wnd_endo(ec);
   int naf0[MAX_ENDO_BITS + 1]; /* 1048 bytes */
   int naf1[MAX_ENDO_BITS + 1]; /* 1048 bytes */
   jge_t **wnds = scratch->wnds;
@@ -4326,7 +4750,7 @@ wei_jmul_multi_endo_var(const wei_t *ec,
   wei_endo_split(ec, k1, k2, k0);
 
   /* Compute fixed NAFs. */
-  max = sc_naf_endo_var(sc, naf0, naf1, k1, k2, NAF_WIDTH_PRE);
+  max = sc_naf_endo_var(sc, naf0, naf1, k1, k2, ec->naf_width);
 
   for (i = 0; i < len; i++) {
     /* Split scalar. */
@@ -4373,6 +4797,109 @@ wei_jmul_multi_endo_var(const wei_t *ec,
   }
 }
 
+static size_t
+bucket_width(size_t bits, size_t len) {
+  /* Pick the window which minimizes the
+   * number of additions for `len` points:
+   *
+   *   (bits / w + 1) * (len + 2^w)
+   *
+   * This is non-decreasing in `len`, so a
+   * scratch sized for N points has enough
+   * buckets for any smaller batch.
+   */
+  size_t best = 0;
+  size_t width = 2;
+  size_t w;
+
+  for (w = 2; w <= BUCKET_MAX_WIDTH; w++) {
+    size_t cost = (bits / w + 1) * (len + ((size_t)1 << w));
+
+    if (best == 0 || cost < best) {
+      best = cost;
+      width = w;
+    }
+  }
+
+  return width;
+}
+
+static void
+wei_jmul_multi_bucket_var(const wei_t *ec,
+                          jge_t *r,
+                          const sc_t k0,
+                          const wge_t *points,
+                          const sc_t *coeffs,
+                          size_t len,
+                          struct wei_scratch_s *scratch) {
+  /* Multiple point multiplication using
+   * Pippenger's bucket method.
+   *
+   * [PIPPENGER] Page 240, Section 4.
+   *
+   * Each window is computed by sorting the
+   * points into buckets by their signed digit
+   * and summing the buckets with a running
+   * sum. The generator is handled with its
+   * precomputed NAF table and interleaved
+   * with the doublings between windows.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd0 = wei_wnd_naf(ec);
+  size_t width = bucket_width(sc->bits, len);
+  size_t steps = sc->bits / width + 1;
+  size_t size = BUCKET_SIZE(width);
+  int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  jge_t *buckets = scratch->buckets;
+  size_t i, j, b, max;
+  jge_t sum;
+
+  ASSERT(len <= scratch->size);
+  ASSERT(width <= scratch->width);
+
+  /* Compute fixed NAF. */
+  max = sc_naf_var(sc, naf0, k0, ec->naf_width);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = steps; i-- > 0;) {
+    /* Double and add generator. */
+    for (b = width; b-- > 0;) {
+      size_t pos = i * width + b;
+      int z0 = pos < max ? naf0[pos] : 0;
+
+      jge_dbl_var(ec, r, r);
+
+      if (z0 > 0)
+        jge_mixed_add_var(ec, r, r, &wnd0[(z0 - 1) >> 1]);
+      else if (z0 < 0)
+        jge_mixed_sub_var(ec, r, r, &wnd0[(-z0 - 1) >> 1]);
+    }
+
+    /* Fill buckets. */
+    for (j = 0; j < size; j++)
+      jge_zero(ec, &buckets[j]);
+
+    for (j = 0; j < len; j++) {
+      int z = sc_get_booth(sc, coeffs[j], i, width);
+
+      if (z > 0)
+        jge_mixed_add_var(ec, &buckets[z - 1], &buckets[z - 1], &points[j]);
+      else if (z < 0)
+        jge_mixed_sub_var(ec, &buckets[-z - 1], &buckets[-z - 1], &points[j]);
+    }
+
+    /* Sum buckets (sum of j * B[j]). */
+    jge_zero(ec, &sum);
+
+    for (j = size; j-- > 0;) {
+      jge_add_var(ec, &sum, &sum, &buckets[j]);
+      jge_add_var(ec, r, r, &sum);
+    }
+  }
+}
+
 static void
 wei_jmul_multi_var(const wei_t *ec,
                    jge_t *r,
@@ -4381,7 +4908,9 @@ wei_jmul_multi_var(const wei_t *ec,
                    const sc_t *coeffs,
                    size_t len,
                    struct wei_scratch_s *scratch) {
-  if (ec->endo)
+  if (len >= BUCKET_MIN_POINTS)
+    wei_jmul_multi_bucket_var(ec, r, k0, points, coeffs, len, scratch);
+  else if (ec->endo)
     wei_jmul_multi_endo_var(ec, r, k0, points, coeffs, len, scratch);
   else
     wei_jmul_multi_normal_var(ec, r, k0, points, coeffs, len, scratch);
@@ -4400,6 +4929,150 @@ wei_mul_multi_var(const wei_t *ec,
   jge_to_wge_var(ec, r, &j);
 }
 
+static size_t
+batch_merge_invalid(size_t *invalid, size_t x, size_t y, size_t *tmp) {
+  /* Merge the two sorted runs invalid[0,x) and invalid[x,x+y). */
+  size_t i = 0;
+  size_t j = x;
+  size_t k = 0;
+
+  while (i < x && j < x + y) {
+    if (invalid[i] < invalid[j])
+      tmp[k++] = invalid[i++];
+    else
+      tmp[k++] = invalid[j++];
+  }
+
+  while (i < x)
+    tmp[k++] = invalid[i++];
+
+  while (j < x + y)
+    tmp[k++] = invalid[j++];
+
+  memcpy(invalid, tmp, k * sizeof(size_t));
+
+  return k;
+}
+
+static int
+wei_batch_check_var(const wei_t *ec,
+                    const wge_t *points,
+                    const sc_t *scalars,
+                    const size_t *items,
+                    size_t len,
+                    drbg_t *rng,
+                    struct wei_scratch_s *scratch) {
+  /* Check a subset of a parsed batch.
+   *
+   * Every item `k` contributes the points
+   * (R, A) = points[2k...] and the scalars
+   * (s, e) = scalars[2k...]. We compute:
+   *
+   *   G * -(si * ai + ...) + Ri * ai + Ai * (ei * ai) + ... == O
+   *
+   * With fresh random `ai` on every call.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  sc_t *coeffs = scratch->coeffs;
+  sc_t sum, s, a;
+  size_t i, k;
+  jge_t r;
+
+  ASSERT(len * 2 <= scratch->size);
+
+  sc_zero(sc, sum);
+
+  for (i = 0; i < len; i++) {
+    k = items[i];
+
+    sc_random(sc, a, rng);
+
+    sc_mul(sc, s, scalars[k * 2 + 0], a);
+    sc_add(sc, sum, sum, s);
+
+    wge_set(ec, &scratch->points[i * 2 + 0], &points[k * 2 + 0]);
+    wge_set(ec, &scratch->points[i * 2 + 1], &points[k * 2 + 1]);
+
+    sc_set(sc, coeffs[i * 2 + 0], a);
+    sc_mul(sc, coeffs[i * 2 + 1], scalars[k * 2 + 1], a);
+  }
+
+  sc_neg(sc, sum, sum);
+
+  wei_jmul_multi_var(ec, &r, sum, scratch->points,
+                     (const sc_t *)coeffs, len * 2, scratch);
+
+  return jge_is_zero(ec, &r);
+}
+
+static size_t
+wei_batch_bisect_var(const wei_t *ec,
+                     size_t *invalid,
+                     const wge_t *points,
+                     const sc_t *scalars,
+                     const size_t *items,
+                     size_t len,
+                     drbg_t *rng,
+                     struct wei_scratch_s *scratch) {
+  /* Find the invalid items in a subset which is
+   * known to contain at least one of them.
+   *
+   * If the left half passes, the failure must be
+   * in the right half, which we can then bisect
+   * without checking it first.
+   */
+  size_t half = len / 2;
+  size_t count = 0;
+
+  if (len == 1) {
+    invalid[0] = items[0];
+    return 1;
+  }
+
+  if (!wei_batch_check_var(ec, points, scalars, items, half, rng, scratch)) {
+    count += wei_batch_bisect_var(ec, invalid, points, scalars,
+                                  items, half, rng, scratch);
+
+    if (wei_batch_check_var(ec, points, scalars, items + half,
+                            len - half, rng, scratch)) {
+      return count;
+    }
+  }
+
+  count += wei_batch_bisect_var(ec, invalid + count, points, scalars,
+                                items + half, len - half, rng, scratch);
+
+  return count;
+}
+
+static size_t
+wei_batch_invalid_var(const wei_t *ec,
+                      size_t *invalid,
+                      const wge_t *points,
+                      const sc_t *scalars,
+                      const size_t *items,
+                      size_t len,
+                      drbg_t *rng,
+                      struct wei_scratch_s *scratch) {
+  size_t max = scratch->size / 2;
+  size_t count = 0;
+  size_t i, n;
+
+  CHECK(max >= 1);
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(max, len - i);
+
+    if (wei_batch_check_var(ec, points, scalars, items + i, n, rng, scratch))
+      continue;
+
+    count += wei_batch_bisect_var(ec, invalid + count, points, scalars,
+                                  items + i, n, rng, scratch);
+  }
+
+  return count;
+}
+
 static void
 wei_randomize(wei_t *ec, const unsigned char *entropy) {
   const scalar_field_t *sc = &ec->sc;
@@ -4422,7 +5095,22 @@ wei_randomize(wei_t *ec, const unsigned char *entropy) {
 }
 
 static void
-wei_sswu(const wei_t *ec, wge_t *p, const fe_t u) {
+wei_sswu_den(const wei_t *ec, fe_t d, const fe_t u) {
+  /* d = z^2 * u^4 + z * u^2 */
+  const prime_field_t *fe = &ec->fe;
+  fe_t z2, u2, u4;
+
+  fe_sqr(fe, z2, ec->z);
+  fe_sqr(fe, u2, u);
+  fe_sqr(fe, u4, u2);
+
+  fe_mul(fe, u2, ec->z, u2);
+  fe_mul(fe, d, z2, u4);
+  fe_add(fe, d, d, u2);
+}
+
+static void
+wei_sswu(const wei_t *ec, wge_t *p, const fe_t u, const fe_t t1) {
   /* Simplified Shallue-Woestijne-Ulas Method.
    *
    * Distribution: 3/8.
@@ -4450,27 +5138,26 @@ wei_sswu(const wei_t *ec, wge_t *p, const fe_t u) {
    *   x = x1, if g(x1) is square
    *     = x2, otherwise
    *   y = sign(u) * abs(sqrt(g(x)))
+   *
+   * The inversion is done by the caller, which
+   * passes t1 (zero if the denominator is zero,
+   * see wei_sswu_den).
    */
   const prime_field_t *fe = &ec->fe;
-  fe_t z2, ba, bza, u2, u4, t1, x1, x2, y1, y2;
+  fe_t ba, bza, u2, x1, x2, y1, y2;
   int zero, alpha;
 
-  fe_sqr(fe, z2, ec->z);
   fe_neg(fe, ba, ec->b);
   fe_mul(fe, ba, ba, ec->ai);
   fe_mul(fe, bza, ec->b, ec->zi);
   fe_mul(fe, bza, bza, ec->ai);
 
   fe_sqr(fe, u2, u);
-  fe_sqr(fe, u4, u2);
 
-  fe_mul(fe, x1, ec->z, u2);
-  fe_mul(fe, t1, z2, u4);
-  fe_add(fe, t1, t1, x1);
-  zero = fe_invert(fe, t1, t1) ^ 1;
+  zero = fe_is_zero(fe, t1);
 
-  fe_add(fe, t1, t1, fe->one);
-  fe_mul(fe, x1, ba, t1);
+  fe_add(fe, x1, t1, fe->one);
+  fe_mul(fe, x1, x1, ba);
 
   fe_select(fe, x1, x1, bza, zero);
 
@@ -4571,7 +5258,20 @@ wei_sswui(const wei_t *ec, fe_t u, const wge_t *p, unsigned int hint) {
 }
 
 static void
-wei_svdwf(const wei_t *ec, fe_t x, fe_t y, const fe_t u) {
+wei_svdw_den(const wei_t *ec, fe_t d, const fe_t u) {
+  /* d = u^2 * (u^2 + g(z)) */
+  const prime_field_t *fe = &ec->fe;
+  fe_t gz, u2;
+
+  wei_solve_y2(ec, gz, ec->z);
+
+  fe_sqr(fe, u2, u);
+  fe_add(fe, d, u2, gz);
+  fe_mul(fe, d, d, u2);
+}
+
+static void
+wei_svdw_map(const wei_t *ec, fe_t x, fe_t y, const fe_t u, const fe_t t2) {
   /* Shallue-van de Woestijne Method.
    *
    * Distribution: 9/16.
@@ -4603,9 +5303,13 @@ wei_svdwf(const wei_t *ec, fe_t x, fe_t y, const fe_t u) {
    *     = x2, if g(x2) is square
    *     = x3, otherwise
    *   y = sign(u) * abs(sqrt(g(x)))
+   *
+   * The inversion is done by the caller, which
+   * passes t2 (zero if the denominator is zero,
+   * see wei_svdw_den).
    */
   const prime_field_t *fe = &ec->fe;
-  fe_t gz, z3, u2, u4, t1, t2, t3, t4, x1, x2, x3, y1, y2, y3;
+  fe_t gz, z3, u2, u4, t1, t3, t4, x1, x2, x3, y1, y2, y3;
   unsigned int alpha, beta;
 
   wei_solve_y2(ec, gz, ec->z);
@@ -4618,9 +5322,6 @@ wei_svdwf(const wei_t *ec, fe_t x, fe_t y, const fe_t u) {
 
   fe_add(fe, t1, u2, gz);
 
-  fe_mul(fe, t2, u2, t1);
-  fe_invert(fe, t2, t2);
-
   fe_mul(fe, t3, u4, t2);
   fe_mul(fe, t3, t3, ec->c);
 
@@ -4656,11 +5357,21 @@ wei_svdwf(const wei_t *ec, fe_t x, fe_t y, const fe_t u) {
 }
 
 static void
-wei_svdw(const wei_t *ec, wge_t *p, const fe_t u) {
+wei_svdwf(const wei_t *ec, fe_t x, fe_t y, const fe_t u) {
+  const prime_field_t *fe = &ec->fe;
+  fe_t t2;
+
+  wei_svdw_den(ec, t2, u);
+  fe_invert(fe, t2, t2);
+  wei_svdw_map(ec, x, y, u, t2);
+}
+
+static void
+wei_svdw(const wei_t *ec, wge_t *p, const fe_t u, const fe_t t2) {
   const prime_field_t *fe = &ec->fe;
   fe_t x, y;
 
-  wei_svdwf(ec, x, y, u);
+  wei_svdw_map(ec, x, y, u, t2);
 
   ASSERT(fe_sqrt(fe, y, y));
 
@@ -4784,32 +5495,79 @@ wei_svdwi(const wei_t *ec, fe_t u, const wge_t *p, unsigned int hint) {
 static void
 wei_point_from_uniform(const wei_t *ec, wge_t *p, const unsigned char *bytes) {
   const prime_field_t *fe = &ec->fe;
-  fe_t u;
+  fe_t u, d;
 
   fe_import(fe, u, bytes);
 
   if (ec->zero_a)
-    wei_svdw(ec, p, u);
+    wei_svdw_den(ec, d, u);
+  else
+    wei_sswu_den(ec, d, u);
+
+  fe_invert(fe, d, d);
+
+  if (ec->zero_a)
+    wei_svdw(ec, p, u, d);
   else
-    wei_sswu(ec, p, u);
+    wei_sswu(ec, p, u, d);
 
   fe_cleanse(fe, u);
+  fe_cleanse(fe, d);
 }
 
-static int
-wei_point_to_uniform(const wei_t *ec,
-                     unsigned char *bytes,
-                     const wge_t *p,
-                     unsigned int hint) {
+static void
+wei_point_from_uniform_all(const wei_t *ec,
+                           wge_t *out,
+                           const unsigned char *const *bytes,
+                           size_t len) {
+  /* Same as wei_point_from_uniform, but the map
+   * denominators share a single inversion.
+   */
   const prime_field_t *fe = &ec->fe;
-  unsigned int subgroup = (hint >> 4) & 15;
-  wge_t p0;
-  fe_t u;
-  int ret;
+  fe_t u[NORM_BATCH]; /* 2304 bytes */
+  fe_t d[NORM_BATCH]; /* 2304 bytes */
+  fe_t t[NORM_BATCH]; /* 2304 bytes */
+  size_t i;
 
-  if (ec->h > 1)
-    wge_add(ec, &p0, p, &ec->torsion[subgroup % ec->h]);
-  else
+  ASSERT(len <= NORM_BATCH);
+
+  for (i = 0; i < len; i++) {
+    fe_import(fe, u[i], bytes[i]);
+
+    if (ec->zero_a)
+      wei_svdw_den(ec, d[i], u[i]);
+    else
+      wei_sswu_den(ec, d[i], u[i]);
+  }
+
+  fe_invert_all(fe, d, t, len);
+
+  for (i = 0; i < len; i++) {
+    if (ec->zero_a)
+      wei_svdw(ec, &out[i], u[i], d[i]);
+    else
+      wei_sswu(ec, &out[i], u[i], d[i]);
+
+    fe_cleanse(fe, u[i]);
+    fe_cleanse(fe, d[i]);
+    fe_cleanse(fe, t[i]);
+  }
+}
+
+static int
+wei_point_to_uniform(const wei_t *ec,
+                     unsigned char *bytes,
+                     const wge_t *p,
+                     unsigned int hint) {
+  const prime_field_t *fe = &ec->fe;
+  unsigned int subgroup = (hint >> 4) & 15;
+  wge_t p0;
+  fe_t u;
+  int ret;
+
+  if (ec->h > 1)
+    wge_add(ec, &p0, p, &ec->torsion[subgroup % ec->h]);
+  else
     wge_set(ec, &p0, p);
 
   if (ec->zero_a)
@@ -5191,6 +5949,82 @@ mge_sub(const mont_t *ec, mge_t *r, const mge_t *a, const mge_t *b) {
   mge_add(ec, r, a, &c);
 }
 
+static void
+mge_add_x(const mont_t *ec, pge_t *r, const mge_t *a, const mge_t *b) {
+  /* Same as mge_add, but only computes x(A + B),
+   * and leaves it in projective form to avoid
+   * the inversion:
+   *
+   *   X3 = b * R^2 - (a + X1 + X2) * H^2
+   *   Z3 = H^2
+   *
+   * 4M + 2S + 10A + 1*a + 2*b + 2*2 + 1*3
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t h, r0, m, z, x3, z3;
+  int dbl, neg, inf;
+
+  /* H = X2 - X1 */
+  fe_sub(fe, h, b->x, a->x);
+
+  /* R = Y2 - Y1 */
+  fe_sub(fe, r0, b->y, a->y);
+
+  /* M = (3 * X1^2) + (2 * a * X1) + 1 */
+  fe_add(fe, x3, ec->a, ec->a);
+  fe_mul(fe, x3, x3, a->x);
+  fe_add(fe, x3, x3, fe->one);
+  fe_sqr(fe, z, a->x);
+  fe_add(fe, m, z, z);
+  fe_add(fe, m, m, z);
+  fe_add(fe, m, m, x3);
+
+  /* Z = 2 * b * Y1 */
+  fe_add(fe, z, a->y, a->y);
+  mont_mul_b(ec, z, z);
+
+  /* Check for doubling (X1 = X2, Y1 = Y2). */
+  dbl = fe_is_zero(fe, h) & fe_is_zero(fe, r0);
+
+  /* R = M (if dbl) */
+  fe_select(fe, r0, r0, m, dbl);
+
+  /* H = Z (if dbl) */
+  fe_select(fe, h, h, z, dbl);
+
+  /* Check for negation (X1 = X2, Y1 = -Y2). */
+  neg = fe_is_zero(fe, h) & ((a->inf | b->inf) ^ 1);
+
+  /* Z3 = H^2 */
+  fe_sqr(fe, z3, h);
+
+  /* X3 = b * R^2 - (a + X1 + X2) * Z3 */
+  fe_sqr(fe, x3, r0);
+  mont_mul_b(ec, x3, x3);
+  fe_add(fe, m, ec->a, a->x);
+  fe_add(fe, m, m, b->x);
+  fe_mul(fe, m, m, z3);
+  fe_sub(fe, x3, x3, m);
+
+  /* Check for infinity. */
+  inf = neg | (a->inf & b->inf);
+
+  /* Case 1: O + P = P */
+  fe_select(fe, x3, x3, b->x, a->inf);
+  fe_select(fe, z3, z3, fe->one, a->inf);
+
+  /* Case 2: P + O = P */
+  fe_select(fe, x3, x3, a->x, b->inf);
+  fe_select(fe, z3, z3, fe->one, b->inf);
+
+  /* Case 3 & 4: P + -P = O, O + O = O */
+  fe_select(fe, x3, x3, fe->one, inf);
+  fe_select(fe, z3, z3, fe->zero, inf);
+
+  fe_set(fe, r->x, x3);
+  fe_set(fe, r->z, z3);
+}
+
 static void
 mge_to_pge(const mont_t *ec, pge_t *r, const mge_t *a) {
   const prime_field_t *fe = &ec->fe;
@@ -5284,6 +6118,59 @@ pge_export(const mont_t *ec,
   return ret;
 }
 
+static int
+pge_export_all(const mont_t *ec,
+               unsigned char *raw,
+               const pge_t *p,
+               size_t len) {
+  /* Montgomery's trick (constant time).
+   *
+   * Points with a Z of zero are given a Z of
+   * one for the duration of the inversion and
+   * export as zero (as with pge_export).
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t zi[NORM_BATCH]; /* 2304 bytes */
+  fe_t acc, z, x;
+  int ret = 1;
+  size_t i;
+  int zero;
+
+  ASSERT(len <= NORM_BATCH);
+
+  fe_set(fe, acc, fe->one);
+
+  for (i = 0; i < len; i++) {
+    fe_select(fe, z, p[i].z, fe->one, fe_is_zero(fe, p[i].z));
+    fe_set(fe, zi[i], acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  ASSERT(fe_invert(fe, acc, acc));
+
+  for (i = len; i-- > 0;) {
+    fe_select(fe, z, p[i].z, fe->one, fe_is_zero(fe, p[i].z));
+    fe_mul(fe, zi[i], zi[i], acc);
+    fe_mul(fe, acc, acc, z);
+  }
+
+  for (i = 0; i < len; i++) {
+    zero = fe_is_zero(fe, p[i].z);
+
+    fe_select(fe, zi[i], zi[i], fe->zero, zero);
+    fe_mul(fe, x, p[i].x, zi[i]);
+    fe_export(fe, raw + i * fe->size, x);
+
+    ret &= zero ^ 1;
+  }
+
+  fe_cleanse(fe, acc);
+  fe_cleanse(fe, z);
+  fe_cleanse(fe, x);
+
+  return ret;
+}
+
 static void
 pge_import_unsafe(const mont_t *ec, pge_t *r, const unsigned char *raw) {
   /* [RFC7748] Section 5. */
@@ -5548,6 +6435,11 @@ mont_init(mont_t *ec, const mont_def_t *def) {
 
     ec->torsion[i].inf = def->torsion[i].inf;
   }
+
+  ec->mul = def->mul;
+
+  if (def->mul4_avx2 != NULL && fe_has_avx2())
+    ec->mul4 = def->mul4_avx2;
 }
 
 static void
@@ -5690,6 +6582,11 @@ mont_mul(const mont_t *ec, pge_t *r, const pge_t *p, const sc_t k, int affine) {
   mp_size_t i;
   pge_t a, b;
 
+  if (ec->mul != NULL) {
+    ec->mul(ec, r, p, k, affine);
+    return;
+  }
+
   pge_zero(ec, &a);
   pge_set(ec, &b, p);
 
@@ -5715,6 +6612,142 @@ mont_mul(const mont_t *ec, pge_t *r, const pge_t *p, const sc_t k, int affine) {
   cleanse(&swap, sizeof(swap));
 }
 
+/* X25519 (a24 = 121666). */
+#define GROUP_NAME(name) x25519_ ## name
+#define GROUP_MONT
+#define GROUP_MUL_A24 fiat_p25519_carry_scmul_121666
+#define FE_ADD(r, a, b) do { \
+  p25519_fe_add(r, a, b);    \
+  p25519_fe_carry(r, r);     \
+} while (0)
+#define FE_SUB(r, a, b) do { \
+  p25519_fe_sub(r, a, b);    \
+  p25519_fe_carry(r, r);     \
+} while (0)
+#define FE_MUL p25519_fe_mul
+#define FE_SQR p25519_fe_sqr
+#include "group.h"
+
+/* X448 (a24 = 39082). */
+#define GROUP_NAME(name) x448_ ## name
+#define GROUP_MONT
+#define GROUP_MUL_A24(r, x) FE_MUL(r, x, ec->a24)
+#define FE_ADD(r, a, b) do { \
+  p448_fe_add(r, a, b);      \
+  fiat_p448_carry(r, r);     \
+} while (0)
+#define FE_SUB(r, a, b) do { \
+  p448_fe_sub(r, a, b);      \
+  fiat_p448_carry(r, r);     \
+} while (0)
+#define FE_MUL p448_fe_mul
+#define FE_SQR p448_fe_sqr
+#include "group.h"
+
+#ifdef TORSION_HAVE_ASM_AVX2
+static void
+x25519_avx2_mul4(const mont_t *ec,
+                 pge_t *r,
+                 const pge_t *p,
+                 const sc_t *k) {
+  /* Four montgomery ladders, one per lane.
+   *
+   * Same formula as pge_ladder (affine case),
+   * with every field operation done 4-way. The
+   * swaps are lane-wise and constant time.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  p25519x4_t x1, x2, z2, x3, z3;
+  p25519x4_t a, b, c, d, aa, bb, e, f;
+  uint64_t swap[4] = {0, 0, 0, 0};
+  uint64_t mask[4];
+  mp_limb_t bit;
+  mp_size_t i;
+  int j;
+
+  p25519x4_pack(x1, p[0].x, p[1].x, p[2].x, p[3].x);
+  p25519x4_pack(x2, fe->one, fe->one, fe->one, fe->one);
+  p25519x4_pack(z2, fe->zero, fe->zero, fe->zero, fe->zero);
+  p25519x4_pack(x3, p[0].x, p[1].x, p[2].x, p[3].x);
+  p25519x4_pack(z3, fe->one, fe->one, fe->one, fe->one);
+
+  /* Climb the ladder. */
+  for (i = fe->bits - 1; i >= 0; i--) {
+    for (j = 0; j < 4; j++) {
+      bit = sc_get_bit(sc, k[j], i);
+      mask[j] = -(uint64_t)(swap[j] ^ bit);
+      swap[j] = bit;
+    }
+
+    /* Maybe swap. */
+    p25519x4_swap(x2, x3, mask);
+    p25519x4_swap(z2, z3, mask);
+
+    /* A = X2 + Z2, B = X2 - Z2 */
+    p25519x4_add_sub(a, b, x2, z2);
+
+    /* C = X3 + Z3, D = X3 - Z3 */
+    p25519x4_add_sub(c, d, x3, z3);
+
+    /* AA = A^2, BB = B^2 */
+    p25519x4_sqr(aa, a);
+    p25519x4_sqr(bb, b);
+
+    /* DA = D * A, CB = C * B */
+    p25519x4_mul(d, d, a);
+    p25519x4_mul(c, c, b);
+
+    /* X3 = (DA + CB)^2, Z3 = X1 * (DA - CB)^2 */
+    p25519x4_add_sub(a, b, d, c);
+    p25519x4_sqr(x3, a);
+    p25519x4_sqr(b, b);
+    p25519x4_mul(z3, b, x1);
+
+    /* X2 = AA * BB */
+    p25519x4_mul(x2, aa, bb);
+
+    /* Z2 = E * (BB + a24 * E), E = AA - BB */
+    p25519x4_mul_a24(e, f, aa, bb);
+    p25519x4_mul(z2, e, f);
+  }
+
+  /* Finalize loop. */
+  for (j = 0; j < 4; j++)
+    mask[j] = -swap[j];
+
+  p25519x4_swap(x2, x3, mask);
+  p25519x4_swap(z2, z3, mask);
+
+  p25519x4_unpack(r[0].x, r[1].x, r[2].x, r[3].x, x2);
+  p25519x4_unpack(r[0].z, r[1].z, r[2].z, r[3].z, z2);
+
+  for (j = 0; j < 4; j++) {
+    p25519_fe_carry(r[j].x, r[j].x);
+    p25519_fe_carry(r[j].z, r[j].z);
+  }
+
+  /* Cleanse. */
+  cleanse(&bit, sizeof(bit));
+  cleanse(swap, sizeof(swap));
+  cleanse(mask, sizeof(mask));
+  cleanse(x2, sizeof(x2));
+  cleanse(z2, sizeof(z2));
+  cleanse(x3, sizeof(x3));
+  cleanse(z3, sizeof(z3));
+  cleanse(a, sizeof(a));
+  cleanse(b, sizeof(b));
+  cleanse(c, sizeof(c));
+  cleanse(d, sizeof(d));
+  cleanse(aa, sizeof(aa));
+  cleanse(bb, sizeof(bb));
+  cleanse(e, sizeof(e));
+  cleanse(f, sizeof(f));
+}
+#else /* !TORSION_HAVE_ASM_AVX2 */
+#define x25519_avx2_mul4 NULL
+#endif /* !TORSION_HAVE_ASM_AVX2 */
+
 static void
 mont_mul_g(const mont_t *ec, pge_t *r, const sc_t k) {
   pge_t g;
@@ -5742,7 +6775,19 @@ mont_solve_y0(const mont_t *ec, fe_t r, const fe_t x) {
 }
 
 static void
-mont_elligator2(const mont_t *ec, mge_t *r, const fe_t u) {
+mont_elligator2_den(const mont_t *ec, fe_t d, const fe_t u) {
+  /* d = 1 + z * u^2 (one if zero) */
+  const prime_field_t *fe = &ec->fe;
+
+  fe_sqr(fe, d, u);
+  fe_mul(fe, d, d, ec->z);
+  fe_add(fe, d, d, fe->one);
+
+  fe_select(fe, d, d, fe->one, fe_is_zero(fe, d));
+}
+
+static void
+mont_elligator2(const mont_t *ec, mge_t *r, const fe_t u, const fe_t t1) {
   /* Elligator 2.
    *
    * Distribution: 1/2.
@@ -5794,20 +6839,17 @@ mont_elligator2(const mont_t *ec, mge_t *r, const fe_t u) {
    *   x = x1, if g(x1) is square
    *     = x2, otherwise
    *   y = sign(u) * abs(sqrt(g(x)))
+   *
+   * The inversion is done by the caller, which
+   * passes t1 = 1 / (1 + z * u^2) (see
+   * mont_elligator2_den).
    */
   const prime_field_t *fe = &ec->fe;
-  fe_t lhs, rhs, x1, x2, y1, y2;
+  fe_t lhs, x1, x2, y1, y2;
   int alpha;
 
   fe_neg(fe, lhs, ec->a0);
-  fe_sqr(fe, rhs, u);
-  fe_mul(fe, rhs, rhs, ec->z);
-  fe_add(fe, rhs, rhs, fe->one);
-
-  fe_select(fe, rhs, rhs, fe->one, fe_is_zero(fe, rhs));
-
-  fe_invert(fe, rhs, rhs);
-  fe_mul(fe, x1, lhs, rhs);
+  fe_mul(fe, x1, lhs, t1);
   fe_neg(fe, x2, x1);
   fe_sub(fe, x2, x2, ec->a0);
 
@@ -5878,13 +6920,49 @@ static void
 mont_point_from_uniform(const mont_t *ec, mge_t *p,
                         const unsigned char *bytes) {
   const prime_field_t *fe = &ec->fe;
-  fe_t u;
+  fe_t u, d;
 
   fe_import(fe, u, bytes);
 
-  mont_elligator2(ec, p, u);
+  mont_elligator2_den(ec, d, u);
+  fe_invert(fe, d, d);
+  mont_elligator2(ec, p, u, d);
 
   fe_cleanse(fe, u);
+  fe_cleanse(fe, d);
+}
+
+static void
+mont_point_from_uniform_all(const mont_t *ec,
+                            mge_t *out,
+                            const unsigned char *const *bytes,
+                            size_t len) {
+  /* Same as mont_point_from_uniform, but the
+   * map denominators share a single inversion.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t u[NORM_BATCH]; /* 2304 bytes */
+  fe_t d[NORM_BATCH]; /* 2304 bytes */
+  fe_t t[NORM_BATCH]; /* 2304 bytes */
+  size_t i;
+
+  ASSERT(len <= NORM_BATCH);
+
+  for (i = 0; i < len; i++) {
+    fe_import(fe, u[i], bytes[i]);
+
+    mont_elligator2_den(ec, d[i], u[i]);
+  }
+
+  fe_invert_all(fe, d, t, len);
+
+  for (i = 0; i < len; i++) {
+    mont_elligator2(ec, &out[i], u[i], d[i]);
+
+    fe_cleanse(fe, u[i]);
+    fe_cleanse(fe, d[i]);
+    fe_cleanse(fe, t[i]);
+  }
 }
 
 static int
@@ -5984,6 +7062,16 @@ _edwards_to_mont(const prime_field_t *fe, mge_t *r,
                  const xge_t *p, const fe_t c,
                  int invert, int isogeny);
 
+static void
+xge_naf_points(const edwards_t *ec, xge_t *out,
+               const xge_t *p, size_t width);
+
+static const nge_t *
+edwards_wnd_fixed(const edwards_t *ec);
+
+static const xge_t *
+edwards_wnd_naf(const edwards_t *ec);
+
 /*
  * Edwards Extended Point
  */
@@ -6157,6 +7245,44 @@ xge_export(const edwards_t *ec,
     raw[fe->size - 1] |= fe_is_odd(fe, x) << 7;
 }
 
+static void
+xge_export_all(const edwards_t *ec,
+               unsigned char *raw,
+               const xge_t *p,
+               size_t len) {
+  /* Montgomery's trick (constant time). */
+  const prime_field_t *fe = &ec->fe;
+  fe_t zi[NORM_BATCH]; /* 2304 bytes */
+  fe_t t[NORM_BATCH]; /* 2304 bytes */
+  unsigned char *out;
+  fe_t x, y;
+  size_t i;
+
+  ASSERT(len <= NORM_BATCH);
+
+  for (i = 0; i < len; i++) {
+    ASSERT(!fe_is_zero(fe, p[i].z));
+    fe_set(fe, zi[i], p[i].z);
+  }
+
+  fe_invert_all(fe, zi, t, len);
+
+  for (i = 0; i < len; i++) {
+    out = raw + i * fe->adj_size;
+
+    fe_mul(fe, x, p[i].x, zi[i]);
+    fe_mul(fe, y, p[i].y, zi[i]);
+
+    fe_export(fe, out, y);
+
+    /* Quirk: we need an extra byte (p448). */
+    if ((fe->bits & 7) == 0)
+      out[fe->size] = fe_is_odd(fe, x) << 7;
+    else
+      out[fe->size - 1] |= fe_is_odd(fe, x) << 7;
+  }
+}
+
 TORSION_UNUSED static void
 xge_swap(const edwards_t *ec, xge_t *a, xge_t *b, unsigned int flag) {
   const prime_field_t *fe = &ec->fe;
@@ -6230,7 +7356,7 @@ xge_neg(const edwards_t *ec, xge_t *r, const xge_t *a) {
   fe_neg(fe, r->t, a->t);
 }
 
-TORSION_UNUSED static void
+static void
 xge_neg_cond(const edwards_t *ec, xge_t *r, const xge_t *a, unsigned int flag) {
   const prime_field_t *fe = &ec->fe;
 
@@ -6240,165 +7366,67 @@ xge_neg_cond(const edwards_t *ec, xge_t *r, const xge_t *a, unsigned int flag) {
   fe_neg_cond(fe, r->t, a->t, flag);
 }
 
-static void
-xge_dbl(const edwards_t *ec, xge_t *r, const xge_t *p) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#doubling-dbl-2008-hwcd
-   * 4M + 4S + 6A + 1*a + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t a, b, c, d, e, g, f, h;
-
-  /* A = X1^2 */
-  fe_sqr(fe, a, p->x);
-
-  /* B = Y1^2 */
-  fe_sqr(fe, b, p->y);
-
-  /* C = 2 * Z1^2 */
-  fe_sqr(fe, c, p->z);
-  fe_add(fe, c, c, c);
-
-  /* D = a * A */
-  edwards_mul_a(ec, d, a);
-
-  /* E = (X1 + Y1)^2 - A - B */
-  fe_add(fe, e, p->x, p->y);
-  fe_sqr(fe, e, e);
-  fe_sub(fe, e, e, a);
-  fe_sub(fe, e, e, b);
-
-  /* G = D + B */
-  fe_add(fe, g, d, b);
-
-  /* F = G - C */
-  fe_sub(fe, f, g, c);
-
-  /* H = D - B */
-  fe_sub(fe, h, d, b);
-
-  /* X3 = E * F */
-  fe_mul(fe, r->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, r->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, r->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, r->z, f, g);
-}
+/* Generic group law (see group.h). */
+#define GROUP_NAME(name) generic_ ## name
+#define GROUP_EDWARDS
+#define GROUP_ADD_A
+#define GROUP_ADD_M1
+#define GROUP_MUL_A(r, x) edwards_mul_a(ec, r, x)
+#define FE_ADD(r, a, b) fe_add(&ec->fe, r, a, b)
+#define FE_SUB(r, a, b) fe_sub(&ec->fe, r, a, b)
+#define FE_NEG(r, a) fe_neg(&ec->fe, r, a)
+#define FE_MUL(r, a, b) fe_mul(&ec->fe, r, a, b)
+#define FE_SQR(r, a) fe_sqr(&ec->fe, r, a)
+#define FE_SELECT(r, a, b, flag) fe_select(&ec->fe, r, a, b, flag)
+#define FE_SET(r, a) fe_set(&ec->fe, r, a)
+#include "group.h"
+
+/* Ed25519 (a = -1). */
+#define GROUP_NAME(name) ed25519_ ## name
+#define GROUP_EDWARDS
+#define GROUP_ADD_M1
+#define GROUP_MUL
+#define GROUP_MUL_A(r, x) FE_NEG(r, x)
+#define FE_ADD(r, a, b) do { \
+  p25519_fe_add(r, a, b);    \
+  p25519_fe_carry(r, r);     \
+} while (0)
+#define FE_SUB(r, a, b) do { \
+  p25519_fe_sub(r, a, b);    \
+  p25519_fe_carry(r, r);     \
+} while (0)
+#define FE_NEG(r, a) do {    \
+  p25519_fe_neg(r, a);       \
+  p25519_fe_carry(r, r);     \
+} while (0)
+#define FE_MUL p25519_fe_mul
+#define FE_SQR p25519_fe_sqr
+#define FE_SELECT p25519_fe_select
+#define FE_SET p25519_fe_set
+#include "group.h"
+
+static const edwards_group_t edwards_group_ed25519 = {
+  ed25519_xge_dbl,
+  ed25519_xge_add_m1,
+  ed25519_xge_mixed_add_m1,
+  ed25519_edwards_mul_g,
+  ed25519_edwards_mul_double_var,
+  NULL
+};
 
 static void
-xge_add_a(const edwards_t *ec, xge_t *r, const xge_t *a, const xge_t *b) {
-  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
-   * 9M + 7A + 1*a + 1*d
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t A, B, c, d, e, f, g, h;
-
-  /* A = X1 * X2 */
-  fe_mul(fe, A, a->x, b->x);
-
-  /* B = Y1 * Y2 */
-  fe_mul(fe, B, a->y, b->y);
-
-  /* C = T1 * d * T2 */
-  fe_mul(fe, c, a->t, b->t);
-  fe_mul(fe, c, c, ec->d);
-
-  /* D = Z1 * Z2 */
-  fe_mul(fe, d, a->z, b->z);
-
-  /* E = (X1 + Y1) * (X2 + Y2) - A - B */
-  fe_add(fe, f, a->x, a->y);
-  fe_add(fe, g, b->x, b->y);
-  fe_mul(fe, e, f, g);
-  fe_sub(fe, e, e, A);
-  fe_sub(fe, e, e, B);
-
-  /* F = D - C */
-  fe_sub(fe, f, d, c);
-
-  /* G = D + C */
-  fe_add(fe, g, d, c);
-
-  /* H = B - a * A */
-  edwards_mul_a(ec, h, A);
-  fe_sub(fe, h, B, h);
-
-  /* X3 = E * F */
-  fe_mul(fe, r->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, r->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, r->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, r->z, f, g);
+xge_dbl(const edwards_t *ec, xge_t *r, const xge_t *p) {
+  ec->group.dbl(ec, r, p);
 }
 
 static void
-xge_add_m1(const edwards_t *ec, xge_t *r, const xge_t *a, const xge_t *b) {
-  /* Assumes a = -1.
-   *
-   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
-   * 8M + 8A + 1*k + 1*2
-   */
-  const prime_field_t *fe = &ec->fe;
-  fe_t A, B, c, d, e, f, g, h;
-
-  /* A = (Y1 - X1) * (Y2 - X2) */
-  fe_sub(fe, c, a->y, a->x);
-  fe_sub(fe, d, b->y, b->x);
-  fe_mul(fe, A, c, d);
-
-  /* B = (Y1 + X1) * (Y2 + X2) */
-  fe_add(fe, c, a->y, a->x);
-  fe_add(fe, d, b->y, b->x);
-  fe_mul(fe, B, c, d);
-
-  /* C = T1 * k * T2 */
-  fe_mul(fe, c, a->t, b->t);
-  fe_mul(fe, c, c, ec->k);
-
-  /* D = Z1 * 2 * Z2 */
-  fe_mul(fe, d, a->z, b->z);
-  fe_add(fe, d, d, d);
-
-  /* E = B - A */
-  fe_sub(fe, e, B, A);
-
-  /* F = D - C */
-  fe_sub(fe, f, d, c);
-
-  /* G = D + C */
-  fe_add(fe, g, d, c);
-
-  /* H = B + A */
-  fe_add(fe, h, B, A);
-
-  /* X3 = E * F */
-  fe_mul(fe, r->x, e, f);
-
-  /* Y3 = G * H */
-  fe_mul(fe, r->y, g, h);
-
-  /* T3 = E * H */
-  fe_mul(fe, r->t, e, h);
-
-  /* Z3 = F * G */
-  fe_mul(fe, r->z, f, g);
+xge_add(const edwards_t *ec, xge_t *r, const xge_t *a, const xge_t *b) {
+  ec->group.add(ec, r, a, b);
 }
 
 static void
-xge_add(const edwards_t *ec, xge_t *r, const xge_t *a, const xge_t *b) {
-  if (ec->mone_a)
-    xge_add_m1(ec, r, a, b);
-  else
-    xge_add_a(ec, r, a, b);
+xge_mixed_add(const edwards_t *ec, xge_t *r, const xge_t *a, const nge_t *b) {
+  ec->group.mixed_add(ec, r, a, b);
 }
 
 static void
@@ -6435,22 +7463,108 @@ xge_is_small(const edwards_t *ec, const xge_t *p) {
 }
 
 static void
-xge_fixed_points(const edwards_t *ec, xge_t *out, const xge_t *p) {
-  const scalar_field_t *sc = &ec->sc;
-  size_t i, j;
-  xge_t g;
-
-  xge_set(ec, &g, p);
-
-  for (i = 0; i < FIXED_STEPS(sc->bits); i++) {
-    xge_t *wnd = &out[i * FIXED_SIZE];
-
-    xge_zero(ec, &wnd[0]);
+xge_isogeny(const edwards_t *ec, xge_t *r, const xge_t *p) {
+  /* 4-isogeny from E(a,d) to E(-a,d-a), as used
+   * by [DECAF] for Ed448.
+   *
+   * Affine formula:
+   *
+   *   x' = 2 * x * y / (y^2 - a * x^2)
+   *   y' = (y^2 + a * x^2) / (2 - y^2 - a * x^2)
+   *
+   * The same map taken from the image curve is
+   * the dual isogeny (i.e. mapping there and back
+   * is a multiplication by 4). The image of the
+   * rational points is the subgroup of odd order,
+   * in which the denominators are never zero.
+   *
+   * Cost: 5M + 3S + 1*a.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t xx, yy, zz, xy, u, v, w;
+
+  /* XX = a * X1^2 */
+  fe_sqr(fe, xx, p->x);
+  edwards_mul_a(ec, xx, xx);
+
+  /* YY = Y1^2 */
+  fe_sqr(fe, yy, p->y);
+
+  /* ZZ = 2 * Z1^2 */
+  fe_sqr(fe, zz, p->z);
+  fe_add(fe, zz, zz, zz);
+
+  /* XY = 2 * X1 * Y1 */
+  fe_mul(fe, xy, p->x, p->y);
+  fe_add(fe, xy, xy, xy);
+
+  /* U = YY - XX */
+  fe_sub(fe, u, yy, xx);
+
+  /* V = YY + XX */
+  fe_add(fe, v, yy, xx);
+
+  /* W = ZZ - V */
+  fe_sub(fe, w, zz, v);
+
+  /* X3 = XY * W */
+  fe_mul(fe, r->x, xy, w);
+
+  /* Y3 = V * U */
+  fe_mul(fe, r->y, v, u);
+
+  /* Z3 = U * W */
+  fe_mul(fe, r->z, u, w);
+
+  /* T3 = XY * V */
+  fe_mul(fe, r->t, xy, v);
+}
+
+static const edwards_t *
+edwards_iso(const edwards_t *ec) {
+  /* Curve on which cofactor-cleared points live. */
+  return ec->iso != NULL ? ec->iso : ec;
+}
+
+static void
+xge_mulh_iso(const edwards_t *ec, xge_t *r, const xge_t *p) {
+  /* Clear the cofactor for a cofactored check.
+   *
+   * Where a 4-isogenous a = -1 curve exists, we
+   * map to it rather than doubling. Its generator
+   * is chosen such that the dual isogeny sends it
+   * back to ours. Any combination of the generator
+   * and mapped points therefore equals, under the
+   * dual, the same combination of `G` and `P * h`.
+   * Both sides of the check live in the subgroup
+   * of odd order, where the dual is injective, so
+   * the check itself can be done on the image.
+   */
+  if (ec->iso != NULL)
+    xge_isogeny(ec, r, p);
+  else
+    xge_mulh(ec, r, p);
+}
 
-    for (j = 1; j < FIXED_SIZE; j++)
+static void
+xge_fixed_points(const edwards_t *ec, xge_t *out, const xge_t *p) {
+  const scalar_field_t *sc = &ec->sc;
+  size_t width = ec->fixed_width;
+  size_t size = FIXED_SIZE(width);
+  size_t i, j;
+  xge_t g;
+
+  xge_set(ec, &g, p);
+
+  for (i = 0; i < FIXED_STEPS(sc->bits, width); i++) {
+    xge_t *wnd = &out[i * size];
+
+    xge_set(ec, &wnd[0], &g);
+
+    for (j = 1; j < size; j++)
       xge_add(ec, &wnd[j], &wnd[j - 1], &g);
 
-    for (j = 0; j < FIXED_WIDTH; j++)
+    for (j = 0; j < width; j++)
       xge_dbl(ec, &g, &g);
   }
 }
@@ -6484,6 +7598,118 @@ xge_to_mge(const edwards_t *ec, mge_t *r, const xge_t *p) {
   _edwards_to_mont(&ec->fe, r, p, ec->c, ec->invert, 1);
 }
 
+/*
+ * Edwards Niels Point
+ */
+
+static void
+nge_zero(const edwards_t *ec, nge_t *r) {
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a)
+    fe_set(fe, r->u, fe->one);
+  else
+    fe_zero(fe, r->u);
+
+  fe_set(fe, r->v, fe->one);
+  fe_zero(fe, r->w);
+}
+
+static void
+nge_select(const edwards_t *ec,
+           nge_t *r,
+           const nge_t *a,
+           const nge_t *b,
+           unsigned int flag) {
+  const prime_field_t *fe = &ec->fe;
+
+  fe_select(fe, r->u, a->u, b->u, flag);
+  fe_select(fe, r->v, a->v, b->v, flag);
+  fe_select(fe, r->w, a->w, b->w, flag);
+}
+
+static void
+nge_neg_cond(const edwards_t *ec, nge_t *r, const nge_t *a, unsigned int flag) {
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a) {
+    /* -(y + x, y - x, kxy) = (y - x, y + x, -kxy) */
+    fe_set(fe, r->u, a->u);
+    fe_set(fe, r->v, a->v);
+    fe_swap(fe, r->u, r->v, flag);
+  } else {
+    fe_neg_cond(fe, r->u, a->u, flag);
+    fe_set(fe, r->v, a->v);
+  }
+
+  fe_neg_cond(fe, r->w, a->w, flag);
+}
+
+static void
+nge_set_xy(const edwards_t *ec, nge_t *r, const fe_t x, const fe_t y) {
+  /* For a = -1, store (y + x, y - x, 2 * d * x * y)
+   * such that a mixed addition costs 7M. Otherwise,
+   * store (x, y, d * x * y) for an 8M addition.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t t;
+
+  fe_mul(fe, t, x, y);
+
+  if (ec->mone_a) {
+    fe_add(fe, r->u, y, x);
+    fe_sub(fe, r->v, y, x);
+    fe_mul(fe, r->w, t, ec->k);
+  } else {
+    fe_set(fe, r->u, x);
+    fe_set(fe, r->v, y);
+    fe_mul(fe, r->w, t, ec->d);
+  }
+}
+
+static void
+xge_to_nge_all_var(const edwards_t *ec, nge_t *out,
+                   const xge_t *in, size_t len) {
+  /* Montgomery's trick. */
+  const prime_field_t *fe = &ec->fe;
+  fe_t acc, x, y;
+  size_t i;
+
+  fe_set(fe, acc, fe->one);
+
+  for (i = 0; i < len; i++) {
+    fe_set(fe, out[i].u, acc);
+    fe_mul(fe, acc, acc, in[i].z);
+  }
+
+  ASSERT(fe_invert_var(fe, acc, acc));
+
+  for (i = len; i-- > 0;) {
+    fe_mul(fe, out[i].u, out[i].u, acc);
+    fe_mul(fe, acc, acc, in[i].z);
+  }
+
+  for (i = 0; i < len; i++) {
+    fe_mul(fe, x, in[i].x, out[i].u);
+    fe_mul(fe, y, in[i].y, out[i].u);
+
+    nge_set_xy(ec, &out[i], x, y);
+  }
+}
+
+static void
+nge_fixed_points_var(const edwards_t *ec, nge_t *out, const xge_t *p) {
+  /* NOTE: Only called on initialization. */
+  const scalar_field_t *sc = &ec->sc;
+  size_t len = FIXED_LENGTH(sc->bits, ec->fixed_width);
+  xge_t *wnds = checked_malloc(len * sizeof(xge_t)); /* 294.8kb */
+
+  xge_fixed_points(ec, wnds, p);
+  xge_to_nge_all_var(ec, out, wnds, len);
+
+  free(wnds);
+}
+
 /*
  * Edwards Curve
  */
@@ -6525,6 +7751,22 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
   ec->mone_a = fe_equal(fe, ec->a, fe->mone);
   ec->one_a = fe_equal(fe, ec->a, fe->one);
 
+  if (def->group_avx2 != NULL && fe_has_avx2()) {
+    ec->group = *def->group_avx2;
+  } else if (def->group != NULL) {
+    ec->group = *def->group;
+  } else {
+    ec->group.dbl = generic_xge_dbl;
+
+    if (ec->mone_a) {
+      ec->group.add = generic_xge_add_m1;
+      ec->group.mixed_add = generic_xge_mixed_add_m1;
+    } else {
+      ec->group.add = generic_xge_add_a;
+      ec->group.mixed_add = generic_xge_mixed_add_a;
+    }
+  }
+
   fe_import_be(fe, ec->g.x, def->x);
   fe_import_be(fe, ec->g.y, def->y);
   fe_set(fe, ec->g.z, fe->one);
@@ -6533,8 +7775,13 @@ edwards_init(edwards_t *ec, const edwards_def_t *def) {
   sc_zero(sc, ec->blind);
   xge_zero(ec, &ec->unblind);
 
-  xge_fixed_points(ec, ec->wnd_fixed, &ec->g);
-  xge_naf_points(ec, ec->wnd_naf, &ec->g, NAF_WIDTH_PRE);
+  ec->tables = def->tables;
+  ec->fixed_width = EDWARDS_FIXED_WIDTH;
+  ec->naf_width = NAF_WIDTH_PRE;
+
+  /* The isogenous curve's 4-torsion is not affine. */
+  if (def->torsion == NULL)
+    return;
 
   for (i = 0; i < ec->h; i++) {
     fe_import_be(fe, ec->torsion[i].x, def->torsion[i].x);
@@ -6600,6 +7847,112 @@ edwards_init_isomorphism(edwards_t *ec, const edwards_def_t *def) {
   fe_sqr(fe, ec->B0, ec->Bi);
 }
 
+static void
+edwards_init_fixed(const edwards_t *ec) {
+  const edwards_tables_t *tables = ec->tables;
+  const scalar_field_t *sc = &ec->sc;
+  edwards_cache_t *cache = ec->cache;
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  nge_t *wnd;
+  size_t i, j;
+
+  if (cache->fixed != NULL)
+    return;
+
+  /* See wei_init_fixed. */
+  if (tables != NULL && tables->fixed_width == width) {
+    ecc_store_release(cache->fixed, tables->fixed);
+    return;
+  }
+
+  wnd = checked_malloc(steps * size * sizeof(nge_t));
+
+  if (tables != NULL && table_has_fixed(tables->fixed_width, width)) {
+    for (i = 0; i < steps; i++) {
+      for (j = 0; j < size; j++) {
+        size_t k = table_fixed_index(tables->fixed_width, width, i, j);
+
+        wnd[i * size + j] = tables->fixed[k];
+      }
+    }
+  } else {
+    nge_fixed_points_var(ec, wnd, &ec->g);
+  }
+
+  ecc_store_release(cache->fixed, wnd);
+}
+
+static void
+edwards_init_naf(const edwards_t *ec) {
+  edwards_cache_t *cache = ec->cache;
+  size_t len = NAF_LENGTH(ec->naf_width);
+  xge_t *wnd;
+
+  if (cache->naf != NULL)
+    return;
+
+  /* See wei_init_naf. */
+  if (ec->tables != NULL) {
+    ecc_store_release(cache->naf, ec->tables->naf);
+    return;
+  }
+
+  wnd = checked_malloc(len * sizeof(xge_t));
+
+  xge_naf_points(ec, wnd, &ec->g, ec->naf_width);
+
+  ecc_store_release(cache->naf, wnd);
+}
+
+static const nge_t *
+edwards_wnd_fixed(const edwards_t *ec) {
+  /* See wei_wnd_fixed. */
+  const nge_t *wnd = ecc_load_acquire(ec->cache->fixed);
+
+  if (UNLIKELY(wnd == NULL)) {
+    ecc_global_lock();
+    edwards_init_fixed(ec);
+    wnd = ec->cache->fixed;
+    ecc_global_unlock();
+  }
+
+  return wnd;
+}
+
+static const xge_t *
+edwards_wnd_naf(const edwards_t *ec) {
+  const xge_t *wnd = ecc_load_acquire(ec->cache->naf);
+
+  if (UNLIKELY(wnd == NULL)) {
+    ecc_global_lock();
+    edwards_init_naf(ec);
+    wnd = ec->cache->naf;
+    ecc_global_unlock();
+  }
+
+  return wnd;
+}
+
+static void
+edwards_cache_clear(edwards_cache_t *cache, const edwards_tables_t *tables) {
+  /* See wei_cache_clear. */
+  if (tables == NULL || cache->fixed != tables->fixed)
+    free((void *)cache->fixed);
+
+  if (tables == NULL)
+    free((void *)cache->naf);
+
+#ifdef TORSION_HAVE_ASM_AVX2
+  free(cache->naf_avx2);
+  cache->naf_avx2 = NULL;
+#endif
+
+  cache->fixed = NULL;
+  cache->naf = NULL;
+}
+
 static void
 edwards_clamp(const edwards_t *ec,
               unsigned char *out,
@@ -6621,215 +7974,697 @@ edwards_clamp(const edwards_t *ec,
   if (sc->size < fe->size)
     top = 8;
 
-  /* Ensure a multiple of the cofactor. */
-  out[0] &= -ec->h;
+  /* Ensure a multiple of the cofactor. */
+  out[0] &= -ec->h;
+
+  /* Clamp to the prime. */
+  out[sc->size - 1] &= (1 << top) - 1;
+
+  /* Set the high bit. */
+  out[sc->size - 1] |= 1 << (top - 1);
+}
+
+static void
+edwards_mul_a(const edwards_t *ec, fe_t r, const fe_t x) {
+  const prime_field_t *fe = &ec->fe;
+
+  if (ec->mone_a)
+    fe_neg(fe, r, x); /* a = -1 */
+  else if (ec->one_a)
+    fe_set(fe, r, x); /* a = 1 */
+  else
+    fe_mul(fe, r, x, ec->a);
+}
+
+static int
+edwards_validate_xy(const edwards_t *ec, const fe_t x, const fe_t y) {
+  /* [TWISTED] Definition 2.1, Page 3, Section 2. */
+  /*           Page 11, Section 6. */
+  /* a * x^2 + y^2 = 1 + d * x^2 * y^2 */
+  const prime_field_t *fe = &ec->fe;
+  fe_t x2, y2, dxy, lhs, rhs;
+
+  fe_sqr(fe, x2, x);
+  fe_sqr(fe, y2, y);
+  fe_mul(fe, dxy, ec->d, x2);
+  fe_mul(fe, dxy, dxy, y2);
+  edwards_mul_a(ec, lhs, x2);
+  fe_add(fe, lhs, lhs, y2);
+  fe_add(fe, rhs, fe->one, dxy);
+
+  return fe_equal(fe, lhs, rhs);
+}
+
+static void
+edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
+  /* Fixed-base method for point multiplication.
+   *
+   * [ECPM] "Windowed method".
+   * [GECC] Page 95, Section 3.3.
+   *
+   * Windows are appropriately shifted to avoid any
+   * doublings. This reduces a 256 bit multiplication
+   * down to 64 additions with a window size of 4.
+   *
+   * The windows are stored in affine Niels form,
+   * allowing for a cheaper mixed addition and a
+   * smaller table to scan. Digits are signed (see
+   * wei_jmul_g).
+   *
+   * Where a 4-isogenous a = -1 curve exists, the
+   * multiplication is done there instead and the
+   * result mapped back (see xge_mulh_iso).
+   */
+  const scalar_field_t *sc = &ec->sc;
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  size_t i, j, b, m, carry;
+  unsigned int negated;
+  const nge_t *wnds;
+  sc_t k0;
+  nge_t t;
+
+  if (ec->iso != NULL) {
+    edwards_mul_g(ec->iso, r, k);
+    xge_isogeny(ec->iso, r, r);
+    return;
+  }
+
+  if (ec->group.mul_g != NULL) {
+    ec->group.mul_g(ec, r, k);
+    return;
+  }
+
+  wnds = edwards_wnd_fixed(ec);
+
+  /* Blind if available. */
+  sc_add(sc, k0, k, ec->blind);
+
+  /* Ensure k0 < 2^(bits - 1). */
+  negated = sc_minimize(sc, k0, k0);
+
+  /* Multiply in constant time. */
+  xge_neg_cond(ec, r, &ec->unblind, negated);
+
+  carry = 0;
+
+  for (i = 0; i < steps; i++) {
+    b = sc_get_bits(sc, k0, i * width, width) + carry;
+
+    /* Recode to a digit in [-2^(w-1), 2^(w-1)]. */
+    carry = (b + size) >> width;
+
+    if (i == steps - 1)
+      carry = 0;
+
+    m = -carry;
+    b = (((size << 1) - b) & m) | (b & ~m);
+
+    nge_zero(ec, &t);
+
+    for (j = 0; j < size; j++)
+      nge_select(ec, &t, &t, &wnds[i * size + j], j + 1 == b);
+
+    nge_neg_cond(ec, &t, &t, carry);
+
+    xge_mixed_add(ec, r, r, &t);
+  }
+
+  xge_neg_cond(ec, r, r, negated);
+
+  /* Cleanse. */
+  sc_cleanse(sc, k0);
+
+  cleanse(&b, sizeof(b));
+  cleanse(&m, sizeof(m));
+  cleanse(&carry, sizeof(carry));
+  cleanse(&negated, sizeof(negated));
+}
+
+static void
+edwards_mul(const edwards_t *ec, xge_t *r, const xge_t *p, const sc_t k) {
+  /* Windowed method for point multiplication.
+   *
+   * [ECPM] "Windowed method".
+   * [GECC] Page 95, Section 3.3.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  mp_size_t start = WND_STEPS(fe->bits) - 1;
+  xge_t wnd[WND_SIZE]; /* 4608 bytes */
+  mp_size_t i, j, b;
+  xge_t t;
+
+  /* Create window. */
+  xge_zero(ec, &wnd[0]);
+  xge_set(ec, &wnd[1], p);
+
+  for (i = 2; i < WND_SIZE; i += 2) {
+    xge_dbl(ec, &wnd[i], &wnd[i / 2]);
+    xge_add(ec, &wnd[i + 1], &wnd[i], p);
+  }
+
+  /* Multiply in constant time. */
+  xge_zero(ec, r);
+  xge_zero(ec, &t);
+
+  for (i = start; i >= 0; i--) {
+    b = sc_get_bits(sc, k, i * WND_WIDTH, WND_WIDTH);
+
+    for (j = 0; j < WND_SIZE; j++)
+      xge_select(ec, &t, &t, &wnd[j], j == b);
+
+    if (i == start) {
+      xge_set(ec, r, &t);
+    } else {
+      for (j = 0; j < WND_WIDTH; j++)
+        xge_dbl(ec, r, r);
+
+      xge_add(ec, r, r, &t);
+    }
+  }
+
+  cleanse(&b, sizeof(b));
+}
+
+static void
+edwards_mul_double_var(const edwards_t *ec,
+                       xge_t *r,
+                       const sc_t k1,
+                       const xge_t *p2,
+                       const sc_t k2) {
+  /* Multiple point multiplication, also known
+   * as "Shamir's trick" (with interleaved NAFs).
+   *
+   * [GECC] Algorithm 3.48, Page 109, Section 3.3.3.
+   *        Algorithm 3.51, Page 112, Section 3.3.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd1 = edwards_wnd_naf(ec);
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t wnd2[NAF_SIZE]; /* 2304 bytes */
+  size_t i, max, max1, max2;
+
+  if (ec->group.mul_double_var != NULL) {
+    ec->group.mul_double_var(ec, r, k1, p2, k2);
+    return;
+  }
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
+  max = ECC_MAX(max1, max2);
+
+  /* Compute NAF points. */
+  xge_naf_points(ec, wnd2, p2, NAF_WIDTH);
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      xge_dbl(ec, r, r);
+
+    if (z1 > 0)
+      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      xge_add(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      xge_sub(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+static void
+edwards_mul_double_pre_var(const edwards_t *ec,
+                           xge_t *r,
+                           const sc_t k1,
+                           const struct edwards_prepared_s *key,
+                           const sc_t k2) {
+  /* Shamir's trick with a precomputed window
+   * for the second point (see above).
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd1 = edwards_wnd_naf(ec);
+  const xge_t *wnd2 = key->wnd;
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  size_t i, max, max1, max2;
+
+  if (key->wnd == NULL) {
+    edwards_mul_double_var(ec, r, k1, &key->point, k2);
+    return;
+  }
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
+  max2 = sc_naf_var(sc, naf2, k2, key->width);
+  max = ECC_MAX(max1, max2);
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      xge_dbl(ec, r, r);
+
+    if (z1 > 0)
+      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      xge_add(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      xge_sub(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+static void
+edwards_prepared_init(const edwards_t *ec,
+                      struct edwards_prepared_s *key,
+                      size_t width) {
+  /* NOTE: `point` must already be set. */
+  key->width = width;
+  key->wnd = NULL;
+
+  if (width == 0)
+    return;
+
+  key->wnd = checked_malloc(((size_t)1 << (width - 2)) * sizeof(xge_t));
+
+  xge_naf_points(ec, key->wnd, &key->point, width);
+}
+
+static void
+edwards_mul_multi_normal_var(const edwards_t *ec,
+                             xge_t *r,
+                             const sc_t k0,
+                             const xge_t *points,
+                             const sc_t *coeffs,
+                             size_t len,
+                             struct edwards_scratch_s *scratch) {
+  /* Multiple point multiplication, also known
+   * as "Shamir's trick" (with interleaved NAFs).
+   *
+   * [GECC] Algorithm 3.48, Page 109, Section 3.3.3.
+   *        Algorithm 3.51, Page 112, Section 3.3.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd0 = edwards_wnd_naf(ec);
+  xge_t wnd1[NAF_SIZE]; /* 2304 bytes */
+  int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t **wnds = scratch->wnds;
+  int **nafs = scratch->nafs;
+  size_t i, j, max, size;
+
+  if (ec->group.mul_multi_normal_var != NULL) {
+    ec->group.mul_multi_normal_var(ec, r, k0, points, coeffs, len, scratch);
+    return;
+  }
+
+  ASSERT(len <= scratch->size);
+
+  /* Compute fixed NAF. */
+  max = sc_naf_var(sc, naf0, k0, ec->naf_width);
+
+  for (i = 0; i < len - (len & 1); i += 2) {
+    /* Compute JSF.*/
+    size = sc_jsf_var(sc, nafs[i / 2], coeffs[i], coeffs[i + 1]);
+
+    /* Create comb for JSF. */
+    xge_jsf_points(ec, wnds[i / 2], &points[i], &points[i + 1]);
+
+    /* Calculate max. */
+    max = ECC_MAX(max, size);
+  }
+
+  if (len & 1) {
+    /* Compute NAF.*/
+    size = sc_naf_var(sc, naf1, coeffs[i], NAF_WIDTH);
+
+    /* Compute NAF points. */
+    xge_naf_points(ec, wnd1, &points[i], NAF_WIDTH);
+
+    /* Calculate max. */
+    max = ECC_MAX(max, size);
+  } else {
+    for (i = 0; i < max; i++)
+      naf1[i] = 0;
+  }
+
+  len /= 2;
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z0 = naf0[i];
+    int z1 = naf1[i];
+
+    if (i != max - 1)
+      xge_dbl(ec, r, r);
+
+    if (z0 > 0)
+      xge_add(ec, r, r, &wnd0[(z0 - 1) >> 1]);
+    else if (z0 < 0)
+      xge_sub(ec, r, r, &wnd0[(-z0 - 1) >> 1]);
+
+    for (j = 0; j < len; j++) {
+      int z = nafs[j][i];
+
+      if (z > 0)
+        xge_add(ec, r, r, &wnds[j][(z - 1) >> 1]);
+      else if (z < 0)
+        xge_sub(ec, r, r, &wnds[j][(-z - 1) >> 1]);
+    }
+
+    if (z1 > 0)
+      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+  }
+}
+
+static void
+edwards_mul_multi_bucket_var(const edwards_t *ec,
+                             xge_t *r,
+                             const sc_t k0,
+                             const xge_t *points,
+                             const sc_t *coeffs,
+                             size_t len,
+                             struct edwards_scratch_s *scratch) {
+  /* Multiple point multiplication using
+   * Pippenger's bucket method.
+   *
+   * [PIPPENGER] Page 240, Section 4.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd0 = edwards_wnd_naf(ec);
+  size_t width = bucket_width(sc->bits, len);
+  size_t steps = sc->bits / width + 1;
+  size_t size = BUCKET_SIZE(width);
+  int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t *buckets = scratch->buckets;
+  size_t i, j, b, max;
+  xge_t sum;
+
+  ASSERT(len <= scratch->size);
+  ASSERT(width <= scratch->width);
+
+  /* Compute fixed NAF. */
+  max = sc_naf_var(sc, naf0, k0, ec->naf_width);
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = steps; i-- > 0;) {
+    /* Double and add generator. */
+    for (b = width; b-- > 0;) {
+      size_t pos = i * width + b;
+      int z0 = pos < max ? naf0[pos] : 0;
+
+      xge_dbl(ec, r, r);
+
+      if (z0 > 0)
+        xge_add(ec, r, r, &wnd0[(z0 - 1) >> 1]);
+      else if (z0 < 0)
+        xge_sub(ec, r, r, &wnd0[(-z0 - 1) >> 1]);
+    }
+
+    /* Fill buckets. */
+    for (j = 0; j < size; j++)
+      xge_zero(ec, &buckets[j]);
+
+    for (j = 0; j < len; j++) {
+      int z = sc_get_booth(sc, coeffs[j], i, width);
+
+      if (z > 0)
+        xge_add(ec, &buckets[z - 1], &buckets[z - 1], &points[j]);
+      else if (z < 0)
+        xge_sub(ec, &buckets[-z - 1], &buckets[-z - 1], &points[j]);
+    }
+
+    /* Sum buckets (sum of j * B[j]). */
+    xge_zero(ec, &sum);
 
-  /* Clamp to the prime. */
-  out[sc->size - 1] &= (1 << top) - 1;
+    for (j = size; j-- > 0;) {
+      xge_add(ec, &sum, &sum, &buckets[j]);
+      xge_add(ec, r, r, &sum);
+    }
+  }
+}
 
-  /* Set the high bit. */
-  out[sc->size - 1] |= 1 << (top - 1);
+static void
+edwards_mul_multi_var(const edwards_t *ec,
+                      xge_t *r,
+                      const sc_t k0,
+                      const xge_t *points,
+                      const sc_t *coeffs,
+                      size_t len,
+                      struct edwards_scratch_s *scratch) {
+  if (len >= BUCKET_MIN_POINTS)
+    edwards_mul_multi_bucket_var(ec, r, k0, points, coeffs, len, scratch);
+  else
+    edwards_mul_multi_normal_var(ec, r, k0, points, coeffs, len, scratch);
 }
 
+/*
+ * Ed25519 AVX2 Backend
+ */
+
+#ifdef TORSION_HAVE_ASM_AVX2
 static void
-edwards_mul_a(const edwards_t *ec, fe_t r, const fe_t x) {
-  const prime_field_t *fe = &ec->fe;
+ed25519_avx2_pack(p25519x4_t r, const xge_t *p) {
+  p25519x4_pack(r, p->x, p->y, p->z, p->t);
+}
 
-  if (ec->mone_a)
-    fe_neg(fe, r, x); /* a = -1 */
-  else if (ec->one_a)
-    fe_set(fe, r, x); /* a = 1 */
-  else
-    fe_mul(fe, r, x, ec->a);
+static void
+ed25519_avx2_unpack(xge_t *r, const p25519x4_t a) {
+  p25519x4_unpack(r->x, r->y, r->z, r->t, a);
 }
 
-static int
-edwards_validate_xy(const edwards_t *ec, const fe_t x, const fe_t y) {
-  /* [TWISTED] Definition 2.1, Page 3, Section 2. */
-  /*           Page 11, Section 6. */
-  /* a * x^2 + y^2 = 1 + d * x^2 * y^2 */
-  const prime_field_t *fe = &ec->fe;
-  fe_t x2, y2, dxy, lhs, rhs;
+static void
+ed25519_avx2_cache(const edwards_t *ec, p25519x4_t r, const xge_t *p) {
+  /* Compute (Y - X, Y + X, 2 * Z, k * T) for the
+   * addition formula (see p25519x4_swap_neg for -P).
+   */
+  p25519_fe_t a, b, c, d;
 
-  fe_sqr(fe, x2, x);
-  fe_sqr(fe, y2, y);
-  fe_mul(fe, dxy, ec->d, x2);
-  fe_mul(fe, dxy, dxy, y2);
-  edwards_mul_a(ec, lhs, x2);
-  fe_add(fe, lhs, lhs, y2);
-  fe_add(fe, rhs, fe->one, dxy);
+  p25519_fe_sub(a, p->y, p->x);
+  p25519_fe_carry(a, a);
+  p25519_fe_add(b, p->y, p->x);
+  p25519_fe_carry(b, b);
+  p25519_fe_add(c, p->z, p->z);
+  p25519_fe_carry(c, c);
+  p25519_fe_mul(d, p->t, ec->k);
 
-  return fe_equal(fe, lhs, rhs);
+  p25519x4_pack(r, a, b, c, d);
 }
 
 static void
-edwards_mul_g(const edwards_t *ec, xge_t *r, const sc_t k) {
-  /* Fixed-base method for point multiplication.
-   *
-   * [ECPM] "Windowed method".
-   * [GECC] Page 95, Section 3.3.
-   *
-   * Windows are appropriately shifted to avoid any
-   * doublings. This reduces a 256 bit multiplication
-   * down to 64 additions with a window size of 4.
+ed25519_avx2_dbl(p25519x4_t r, const p25519x4_t p) {
+  /* Same formula as ed25519_xge_dbl, with the
+   * four squarings and the four multiplications
+   * each done in a single 4-way multiplication.
    */
-  const scalar_field_t *sc = &ec->sc;
-  const xge_t *wnds = ec->wnd_fixed;
-  size_t i, j, b;
-  sc_t k0;
-  xge_t t;
+  p25519x4_t t, u, v;
 
-  /* Blind if available. */
-  sc_add(sc, k0, k, ec->blind);
+  /* (A, B, ZZ, S) = (X1^2, Y1^2, Z1^2, (X1 + Y1)^2) */
+  p25519x4_dbl_pre(t, p);
+  p25519x4_sqr(u, t);
 
-  /* Multiply in constant time. */
-  xge_set(ec, r, &ec->unblind);
-  xge_zero(ec, &t);
+  /* (X3, Y3, Z3, T3) = (E, G, F, E) * (F, H, G, H) */
+  p25519x4_dbl_mid(t, v, u);
+  p25519x4_mul(r, t, v);
+}
 
-  for (i = 0; i < FIXED_STEPS(sc->bits); i++) {
-    b = sc_get_bits(sc, k0, i * FIXED_WIDTH, FIXED_WIDTH);
+static void
+ed25519_avx2_add(p25519x4_t r, const p25519x4_t a, const p25519x4_t b) {
+  /* Same formula as ed25519_xge_add_m1 (`b` is cached). */
+  p25519x4_t t, u, v;
 
-    for (j = 0; j < FIXED_SIZE; j++)
-      xge_select(ec, &t, &t, &wnds[i * FIXED_SIZE + j], j == b);
+  /* (A, B, D, C) = (Y1 - X1, Y1 + X1, Z1, T1)
+   *              * (Y2 - X2, Y2 + X2, 2 * Z2, k * T2)
+   */
+  p25519x4_add_pre(t, a);
+  p25519x4_mul(u, t, b);
 
-    xge_add(ec, r, r, &t);
-  }
+  /* (X3, Y3, Z3, T3) = (E, G, F, E) * (F, H, G, H) */
+  p25519x4_add_mid(t, v, u);
+  p25519x4_mul(r, t, v);
+}
 
-  /* Cleanse. */
-  sc_cleanse(sc, k0);
+static void
+ed25519_avx2_add_naf(p25519x4_t r, p25519x4_t *wnd, int z) {
+  /* `wnd` is cached (see ed25519_avx2_cache). */
+  p25519x4_t t;
 
-  cleanse(&b, sizeof(b));
+  if (z > 0) {
+    ed25519_avx2_add(r, r, wnd[(z - 1) >> 1]);
+  } else if (z < 0) {
+    p25519x4_swap_neg(t, wnd[(-z - 1) >> 1]);
+    ed25519_avx2_add(r, r, t);
+  }
 }
 
 static void
-edwards_mul(const edwards_t *ec, xge_t *r, const xge_t *p, const sc_t k) {
-  /* Windowed method for point multiplication.
-   *
-   * [ECPM] "Windowed method".
-   * [GECC] Page 95, Section 3.3.
-   */
-  const prime_field_t *fe = &ec->fe;
-  const scalar_field_t *sc = &ec->sc;
-  mp_size_t start = WND_STEPS(fe->bits) - 1;
-  xge_t wnd[WND_SIZE]; /* 4608 bytes */
-  mp_size_t i, j, b;
-  xge_t t;
+ed25519_avx2_init_naf(const edwards_t *ec) {
+  /* The NAF table in cached form, built once
+     and shared like the table itself. */
+  edwards_cache_t *cache = ec->cache;
+  size_t len = NAF_LENGTH(ec->naf_width);
+  p25519x4_t *wnd;
+  size_t i;
 
-  /* Create window. */
-  xge_zero(ec, &wnd[0]);
-  xge_set(ec, &wnd[1], p);
+  if (cache->naf_avx2 != NULL)
+    return;
 
-  for (i = 2; i < WND_SIZE; i += 2) {
-    xge_dbl(ec, &wnd[i], &wnd[i / 2]);
-    xge_add(ec, &wnd[i + 1], &wnd[i], p);
-  }
+  edwards_init_naf(ec);
 
-  /* Multiply in constant time. */
-  xge_zero(ec, r);
-  xge_zero(ec, &t);
+  wnd = checked_malloc(len * sizeof(p25519x4_t));
 
-  for (i = start; i >= 0; i--) {
-    b = sc_get_bits(sc, k, i * WND_WIDTH, WND_WIDTH);
+  for (i = 0; i < len; i++)
+    ed25519_avx2_cache(ec, wnd[i], &cache->naf[i]);
 
-    for (j = 0; j < WND_SIZE; j++)
-      xge_select(ec, &t, &t, &wnd[j], j == b);
+  ecc_store_release(cache->naf_avx2, wnd);
+}
 
-    if (i == start) {
-      xge_set(ec, r, &t);
-    } else {
-      for (j = 0; j < WND_WIDTH; j++)
-        xge_dbl(ec, r, r);
+static p25519x4_t *
+ed25519_avx2_wnd_naf(const edwards_t *ec) {
+  /* See wei_wnd_fixed. */
+  p25519x4_t *wnd = ecc_load_acquire(ec->cache->naf_avx2);
 
-      xge_add(ec, r, r, &t);
-    }
+  if (UNLIKELY(wnd == NULL)) {
+    ecc_global_lock();
+    ed25519_avx2_init_naf(ec);
+    wnd = ec->cache->naf_avx2;
+    ecc_global_unlock();
   }
 
-  cleanse(&b, sizeof(b));
+  return wnd;
 }
 
 static void
-edwards_mul_double_var(const edwards_t *ec,
-                       xge_t *r,
-                       const sc_t k1,
-                       const xge_t *p2,
-                       const sc_t k2) {
-  /* Multiple point multiplication, also known
-   * as "Shamir's trick" (with interleaved NAFs).
-   *
-   * [GECC] Algorithm 3.48, Page 109, Section 3.3.3.
-   *        Algorithm 3.51, Page 112, Section 3.3.
+ed25519_avx2_xge_dbl(const edwards_t *ec, xge_t *r, const xge_t *p) {
+  p25519x4_t t;
+
+  (void)ec;
+
+  ed25519_avx2_pack(t, p);
+  ed25519_avx2_dbl(t, t);
+  ed25519_avx2_unpack(r, t);
+}
+
+static void
+ed25519_avx2_xge_add(const edwards_t *ec, xge_t *r,
+                     const xge_t *a, const xge_t *b) {
+  p25519x4_t t, u;
+
+  ed25519_avx2_pack(t, a);
+  ed25519_avx2_cache(ec, u, b);
+  ed25519_avx2_add(t, t, u);
+  ed25519_avx2_unpack(r, t);
+}
+
+static void
+ed25519_avx2_mul_double_var(const edwards_t *ec,
+                            xge_t *r,
+                            const sc_t k1,
+                            const xge_t *p2,
+                            const sc_t k2) {
+  /* Same as edwards_mul_double_var, but the
+   * accumulator stays in 4-way form and both
+   * windows are in cached form.
    */
   const scalar_field_t *sc = &ec->sc;
-  const xge_t *wnd1 = ec->wnd_naf;
+  p25519x4_t *wnd1 = ed25519_avx2_wnd_naf(ec);
   int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   xge_t wnd2[NAF_SIZE]; /* 2304 bytes */
+  p25519x4_t pre2[NAF_SIZE]; /* 2560 bytes */
+  p25519x4_t acc;
   size_t i, max, max1, max2;
 
   /* Compute NAFs. */
-  max1 = sc_naf_var(sc, naf1, k1, NAF_WIDTH_PRE);
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
   max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
   max = ECC_MAX(max1, max2);
 
   /* Compute NAF points. */
   xge_naf_points(ec, wnd2, p2, NAF_WIDTH);
 
+  for (i = 0; i < NAF_SIZE; i++)
+    ed25519_avx2_cache(ec, pre2[i], &wnd2[i]);
+
   /* Multiply and add. */
   xge_zero(ec, r);
+  ed25519_avx2_pack(acc, r);
 
   for (i = max; i-- > 0;) {
     int z1 = naf1[i];
     int z2 = naf2[i];
 
     if (i != max - 1)
-      xge_dbl(ec, r, r);
-
-    if (z1 > 0)
-      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
-    else if (z1 < 0)
-      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+      ed25519_avx2_dbl(acc, acc);
 
-    if (z2 > 0)
-      xge_add(ec, r, r, &wnd2[(z2 - 1) >> 1]);
-    else if (z2 < 0)
-      xge_sub(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+    ed25519_avx2_add_naf(acc, wnd1, z1);
+    ed25519_avx2_add_naf(acc, pre2, z2);
   }
+
+  ed25519_avx2_unpack(r, acc);
 }
 
 static void
-edwards_mul_multi_var(const edwards_t *ec,
-                      xge_t *r,
-                      const sc_t k0,
-                      const xge_t *points,
-                      const sc_t *coeffs,
-                      size_t len,
-                      struct edwards_scratch_s *scratch) {
-  /* Multiple point multiplication, also known
-   * as "Shamir's trick" (with interleaved NAFs).
-   *
-   * [GECC] Algorithm 3.48, Page 109, Section 3.3.3.
-   *        Algorithm 3.51, Page 112, Section 3.3.
+ed25519_avx2_mul_multi_normal_var(const edwards_t *ec,
+                                  xge_t *r,
+                                  const sc_t k0,
+                                  const xge_t *points,
+                                  const sc_t *coeffs,
+                                  size_t len,
+                                  struct edwards_scratch_s *scratch) {
+  /* Same as edwards_mul_multi_normal_var, but
+   * the accumulator stays in 4-way form and the
+   * windows are converted to cached form once.
    */
   const scalar_field_t *sc = &ec->sc;
-  const xge_t *wnd0 = ec->wnd_naf;
+  p25519x4_t *wnd0 = ed25519_avx2_wnd_naf(ec);
   xge_t wnd1[NAF_SIZE]; /* 2304 bytes */
+  p25519x4_t pre1[NAF_SIZE]; /* 2560 bytes */
   int naf0[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
   int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
-  xge_t **wnds = scratch->wnds;
+  p25519x4_t *wnds = scratch->wnd_avx2;
+  xge_t **jsfs = scratch->wnds;
   int **nafs = scratch->nafs;
   size_t i, j, max, size;
+  p25519x4_t acc;
 
   ASSERT(len <= scratch->size);
+  ASSERT(wnds != NULL);
 
   /* Compute fixed NAF. */
-  max = sc_naf_var(sc, naf0, k0, NAF_WIDTH_PRE);
+  max = sc_naf_var(sc, naf0, k0, ec->naf_width);
 
   for (i = 0; i < len - (len & 1); i += 2) {
     /* Compute JSF.*/
     size = sc_jsf_var(sc, nafs[i / 2], coeffs[i], coeffs[i + 1]);
 
     /* Create comb for JSF. */
-    xge_jsf_points(ec, wnds[i / 2], &points[i], &points[i + 1]);
+    xge_jsf_points(ec, jsfs[i / 2], &points[i], &points[i + 1]);
+
+    for (j = 0; j < 4; j++)
+      ed25519_avx2_cache(ec, wnds[i * 2 + j], &jsfs[i / 2][j]);
 
     /* Calculate max. */
     max = ECC_MAX(max, size);
@@ -6842,6 +8677,9 @@ edwards_mul_multi_var(const edwards_t *ec,
     /* Compute NAF points. */
     xge_naf_points(ec, wnd1, &points[i], NAF_WIDTH);
 
+    for (j = 0; j < NAF_SIZE; j++)
+      ed25519_avx2_cache(ec, pre1[j], &wnd1[j]);
+
     /* Calculate max. */
     max = ECC_MAX(max, size);
   } else {
@@ -6853,33 +8691,147 @@ edwards_mul_multi_var(const edwards_t *ec,
 
   /* Multiply and add. */
   xge_zero(ec, r);
+  ed25519_avx2_pack(acc, r);
 
   for (i = max; i-- > 0;) {
-    int z0 = naf0[i];
-    int z1 = naf1[i];
-
     if (i != max - 1)
-      xge_dbl(ec, r, r);
+      ed25519_avx2_dbl(acc, acc);
 
-    if (z0 > 0)
-      xge_add(ec, r, r, &wnd0[(z0 - 1) >> 1]);
-    else if (z0 < 0)
-      xge_sub(ec, r, r, &wnd0[(-z0 - 1) >> 1]);
+    ed25519_avx2_add_naf(acc, wnd0, naf0[i]);
 
-    for (j = 0; j < len; j++) {
-      int z = nafs[j][i];
+    for (j = 0; j < len; j++)
+      ed25519_avx2_add_naf(acc, &wnds[j * 4], nafs[j][i]);
 
-      if (z > 0)
-        xge_add(ec, r, r, &wnds[j][(z - 1) >> 1]);
-      else if (z < 0)
-        xge_sub(ec, r, r, &wnds[j][(-z - 1) >> 1]);
+    ed25519_avx2_add_naf(acc, pre1, naf1[i]);
+  }
+
+  ed25519_avx2_unpack(r, acc);
+}
+
+static const edwards_group_t edwards_group_ed25519_avx2 = {
+  ed25519_avx2_xge_dbl,
+  ed25519_avx2_xge_add,
+  ed25519_xge_mixed_add_m1,
+  ed25519_edwards_mul_g,
+  ed25519_avx2_mul_double_var,
+  ed25519_avx2_mul_multi_normal_var
+};
+#else /* !TORSION_HAVE_ASM_AVX2 */
+#define edwards_group_ed25519_avx2 edwards_group_ed25519
+#endif /* !TORSION_HAVE_ASM_AVX2 */
+
+static int
+edwards_batch_check_var(const edwards_t *ec,
+                        const xge_t *points,
+                        const sc_t *scalars,
+                        const size_t *items,
+                        size_t len,
+                        drbg_t *rng,
+                        struct edwards_scratch_s *scratch) {
+  /* Check a subset of a parsed batch.
+   *
+   * Identical to the Weierstrass variant except
+   * that the points are expected to have been
+   * cleared of the cofactor already (see
+   * xge_mulh_iso).
+   */
+  const scalar_field_t *sc = &ec->sc;
+  const edwards_t *iso = edwards_iso(ec);
+  sc_t *coeffs = scratch->coeffs;
+  sc_t sum, s, a;
+  size_t i, k;
+  xge_t r;
+
+  ASSERT(len * 2 <= scratch->size);
+
+  sc_zero(sc, sum);
+
+  for (i = 0; i < len; i++) {
+    k = items[i];
+
+    sc_random(sc, a, rng);
+
+    sc_mul(sc, s, scalars[k * 2 + 0], a);
+    sc_add(sc, sum, sum, s);
+
+    xge_set(iso, &scratch->points[i * 2 + 0], &points[k * 2 + 0]);
+    xge_set(iso, &scratch->points[i * 2 + 1], &points[k * 2 + 1]);
+
+    sc_set(sc, coeffs[i * 2 + 0], a);
+    sc_mul(sc, coeffs[i * 2 + 1], scalars[k * 2 + 1], a);
+  }
+
+  sc_mul_word(sc, sum, sum, ec->h);
+  sc_neg(sc, sum, sum);
+
+  edwards_mul_multi_var(iso, &r, sum, scratch->points,
+                        (const sc_t *)coeffs, len * 2, scratch);
+
+  return xge_is_zero(iso, &r);
+}
+
+static size_t
+edwards_batch_bisect_var(const edwards_t *ec,
+                         size_t *invalid,
+                         const xge_t *points,
+                         const sc_t *scalars,
+                         const size_t *items,
+                         size_t len,
+                         drbg_t *rng,
+                         struct edwards_scratch_s *scratch) {
+  size_t half = len / 2;
+  size_t count = 0;
+
+  if (len == 1) {
+    invalid[0] = items[0];
+    return 1;
+  }
+
+  if (!edwards_batch_check_var(ec, points, scalars,
+                               items, half, rng, scratch)) {
+    count += edwards_batch_bisect_var(ec, invalid, points, scalars,
+                                      items, half, rng, scratch);
+
+    if (edwards_batch_check_var(ec, points, scalars, items + half,
+                                len - half, rng, scratch)) {
+      return count;
     }
+  }
 
-    if (z1 > 0)
-      xge_add(ec, r, r, &wnd1[(z1 - 1) >> 1]);
-    else if (z1 < 0)
-      xge_sub(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+  count += edwards_batch_bisect_var(ec, invalid + count, points, scalars,
+                                    items + half, len - half, rng, scratch);
+
+  return count;
+}
+
+static size_t
+edwards_batch_invalid_var(const edwards_t *ec,
+                          size_t *invalid,
+                          const xge_t *points,
+                          const sc_t *scalars,
+                          const size_t *items,
+                          size_t len,
+                          drbg_t *rng,
+                          struct edwards_scratch_s *scratch) {
+  size_t max = scratch->size / 2;
+  size_t count = 0;
+  size_t i, n;
+
+  CHECK(max >= 1);
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(max, len - i);
+
+    if (edwards_batch_check_var(ec, points, scalars,
+                                items + i, n, rng, scratch)) {
+      continue;
+    }
+
+    count += edwards_batch_bisect_var(ec, invalid + count, points, scalars,
+                                      items + i, n, rng, scratch);
   }
+
+  return count;
 }
 
 static void
@@ -6889,6 +8841,12 @@ edwards_randomize(edwards_t *ec, const unsigned char *entropy) {
   xge_t unblind;
   drbg_t rng;
 
+  /* Blinding happens on the isogenous curve. */
+  if (ec->iso != NULL) {
+    edwards_randomize(ec->iso, entropy);
+    return;
+  }
+
   drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
 
   sc_random(sc, blind, &rng);
@@ -6918,7 +8876,20 @@ edwards_solve_y0(const edwards_t *ec, fe_t r, const fe_t x) {
 }
 
 static void
-edwards_elligator2(const edwards_t *ec, xge_t *r, const fe_t u) {
+edwards_elligator2_den(const edwards_t *ec, fe_t d, const fe_t u) {
+  /* d = 1 + z * u^2 (one if zero) */
+  const prime_field_t *fe = &ec->fe;
+
+  fe_sqr(fe, d, u);
+  fe_mul(fe, d, d, ec->z);
+  fe_add(fe, d, d, fe->one);
+
+  fe_select(fe, d, d, fe->one, fe_is_zero(fe, d));
+}
+
+static void
+edwards_elligator2(const edwards_t *ec, xge_t *r,
+                   const fe_t u, const fe_t t1) {
   /* Elligator 2.
    *
    * Distribution: 1/2.
@@ -6970,21 +8941,18 @@ edwards_elligator2(const edwards_t *ec, xge_t *r, const fe_t u) {
    *   x = x1, if g(x1) is square
    *     = x2, otherwise
    *   y = sign(u) * abs(sqrt(g(x)))
+   *
+   * The inversion is done by the caller, which
+   * passes t1 = 1 / (1 + z * u^2) (see
+   * edwards_elligator2_den).
    */
   const prime_field_t *fe = &ec->fe;
-  fe_t lhs, rhs, x1, x2, y1, y2;
+  fe_t lhs, x1, x2, y1, y2;
   mge_t m;
   int alpha;
 
   fe_neg(fe, lhs, ec->A0);
-  fe_sqr(fe, rhs, u);
-  fe_mul(fe, rhs, rhs, ec->z);
-  fe_add(fe, rhs, rhs, fe->one);
-
-  fe_select(fe, rhs, rhs, fe->one, fe_is_zero(fe, rhs));
-
-  fe_invert(fe, rhs, rhs);
-  fe_mul(fe, x1, lhs, rhs);
+  fe_mul(fe, x1, lhs, t1);
   fe_neg(fe, x2, x1);
   fe_sub(fe, x2, x2, ec->A0);
 
@@ -7061,13 +9029,49 @@ static void
 edwards_point_from_uniform(const edwards_t *ec, xge_t *p,
                            const unsigned char *bytes) {
   const prime_field_t *fe = &ec->fe;
-  fe_t u;
+  fe_t u, d;
 
   fe_import(fe, u, bytes);
 
-  edwards_elligator2(ec, p, u);
+  edwards_elligator2_den(ec, d, u);
+  fe_invert(fe, d, d);
+  edwards_elligator2(ec, p, u, d);
 
   fe_cleanse(fe, u);
+  fe_cleanse(fe, d);
+}
+
+static void
+edwards_point_from_uniform_all(const edwards_t *ec,
+                               xge_t *out,
+                               const unsigned char *const *bytes,
+                               size_t len) {
+  /* Same as edwards_point_from_uniform, but the
+   * map denominators share a single inversion.
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t u[NORM_BATCH]; /* 2304 bytes */
+  fe_t d[NORM_BATCH]; /* 2304 bytes */
+  fe_t t[NORM_BATCH]; /* 2304 bytes */
+  size_t i;
+
+  ASSERT(len <= NORM_BATCH);
+
+  for (i = 0; i < len; i++) {
+    fe_import(fe, u[i], bytes[i]);
+
+    edwards_elligator2_den(ec, d[i], u[i]);
+  }
+
+  fe_invert_all(fe, d, t, len);
+
+  for (i = 0; i < len; i++) {
+    edwards_elligator2(ec, &out[i], u[i], d[i]);
+
+    fe_cleanse(fe, u[i]);
+    fe_cleanse(fe, d[i]);
+    fe_cleanse(fe, t[i]);
+  }
 }
 
 static int
@@ -7406,6 +9410,8 @@ static const prime_def_t field_p192 = {
   NULL,
   NULL,
   NULL,
+  NULL,
+  NULL,
   fiat_p192_selectznz,
   fiat_p192_to_bytes,
   fiat_p192_from_bytes,
@@ -7445,6 +9451,8 @@ static const prime_def_t field_p224 = {
   fiat_p224_opp,
   fiat_p224_mul,
   fiat_p224_square,
+  NULL,
+  NULL,
   fiat_p224_to_montgomery,
   fiat_p224_from_montgomery,
   fiat_p224_nonzero,
@@ -7488,6 +9496,8 @@ static const prime_def_t field_p256 = {
   fiat_p256_opp,
   fiat_p256_mul,
   fiat_p256_square,
+  p256_fe_mul_adx,
+  p256_fe_sqr_adx,
   fiat_p256_to_montgomery,
   fiat_p256_from_montgomery,
   fiat_p256_nonzero,
@@ -7533,6 +9543,8 @@ static const prime_def_t field_p384 = {
   fiat_p384_opp,
   fiat_p384_mul,
   fiat_p384_square,
+  NULL,
+  NULL,
   fiat_p384_to_montgomery,
   fiat_p384_from_montgomery,
   fiat_p384_nonzero,
@@ -7586,6 +9598,8 @@ static const prime_def_t field_p521 = {
   NULL,
   NULL,
   NULL,
+  NULL,
+  NULL,
   fiat_p521_selectznz,
   fiat_p521_to_bytes,
   fiat_p521_from_bytes,
@@ -7631,6 +9645,8 @@ static const prime_def_t field_p256k1 = {
   fiat_secp256k1_opp,
   fiat_secp256k1_mul,
   fiat_secp256k1_square,
+  secp256k1_fe_mul_adx,
+  secp256k1_fe_sqr_adx,
   fiat_secp256k1_to_montgomery,
   fiat_secp256k1_from_montgomery,
   fiat_secp256k1_nonzero,
@@ -7677,6 +9693,8 @@ static const prime_def_t field_p25519 = {
   NULL,
   NULL,
   NULL,
+  NULL,
+  NULL,
   fiat_p25519_selectznz,
   fiat_p25519_to_bytes,
   fiat_p25519_from_bytes,
@@ -7723,6 +9741,8 @@ static const prime_def_t field_p448 = {
   NULL,
   NULL,
   NULL,
+  NULL,
+  NULL,
   fiat_p448_selectznz,
   fiat_p448_to_bytes,
   fiat_p448_from_bytes,
@@ -7769,6 +9789,8 @@ static const prime_def_t field_p251 = {
   NULL,
   NULL,
   NULL,
+  NULL,
+  NULL,
   fiat_p251_selectznz,
   fiat_p251_to_bytes,
   fiat_p251_from_bytes,
@@ -7840,6 +9862,12 @@ static const endo_def_t endo_secp256k1 = {
 
 #include "subgroups.h"
 
+/*
+ * Precomputed Tables
+ */
+
+#include "tables.h"
+
 /*
  * Short Weierstrass Curves
  */
@@ -7875,6 +9903,9 @@ static const wei_def_t curve_p192 = {
   },
   {0},
   subgroups_prime,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -7913,6 +9944,9 @@ static const wei_def_t curve_p224 = {
   },
   {0},
   subgroups_prime,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -7951,7 +9985,10 @@ static const wei_def_t curve_p256 = {
   },
   {0},
   subgroups_prime,
-  NULL
+  NULL,
+  &tables_p256,
+  &wei_group_p256,
+  &wei_group_p256_adx
 };
 
 static const wei_def_t curve_p384 = {
@@ -7997,6 +10034,9 @@ static const wei_def_t curve_p384 = {
   },
   {0},
   subgroups_prime,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -8055,6 +10095,9 @@ static const wei_def_t curve_p521 = {
   },
   {0},
   subgroups_prime,
+  NULL,
+  NULL,
+  NULL,
   NULL
 };
 
@@ -8099,7 +10142,10 @@ static const wei_def_t curve_secp256k1 = {
     0x7d, 0x8d, 0x27, 0xae, 0x1c, 0xd5, 0xf8, 0x52
   },
   subgroups_prime,
-  &endo_secp256k1
+  &endo_secp256k1,
+  &tables_secp256k1,
+  &wei_group_secp256k1,
+  &wei_group_secp256k1_adx
 };
 
 /*
@@ -8149,7 +10195,9 @@ static const mont_def_t curve_x25519 = {
     0xc5, 0xa1, 0xd3, 0xd1, 0x4b, 0x7d, 0x1a, 0x82,
     0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
   },
-  subgroups_x25519
+  subgroups_x25519,
+  x25519_mont_mul,
+  x25519_avx2_mul4
 };
 
 static const mont_def_t curve_x448 = {
@@ -8208,7 +10256,9 @@ static const mont_def_t curve_x448 = {
     0xc0, 0x66, 0xf7, 0xed, 0x54, 0x41, 0x9c, 0xa5,
     0x2c, 0x85, 0xde, 0x1e, 0x8a, 0xae, 0x4e, 0x6c
   },
-  subgroups_x448
+  subgroups_x448,
+  x448_mont_mul,
+  NULL
 };
 
 /*
@@ -8262,7 +10312,80 @@ static const edwards_def_t curve_ed25519 = {
     0xc5, 0xa1, 0xd3, 0xd1, 0x4b, 0x7d, 0x1a, 0x82,
     0xcc, 0x6e, 0x04, 0xaa, 0xff, 0x45, 0x7e, 0x06
   },
-  subgroups_ed25519
+  subgroups_ed25519,
+  &tables_ed25519,
+  &edwards_group_ed25519,
+  &edwards_group_ed25519_avx2,
+  NULL
+};
+
+static const edwards_def_t curve_ed448_iso = {
+  /* 4-isogenous to Ed448 (see xge_mulh_iso). */
+  HASH_SHAKE256,
+  1,
+  "SigEd448",
+  &field_p448,
+  &field_q448,
+  4,
+  -1,
+  0,
+  /* Coefficients (a, d). */
+  {
+    /* -1 mod p */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe
+  },
+  {
+    /* -39082 mod p */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x55
+  },
+  /* Base point coordinates (x, y). */
+  {
+    /* G' such that iso(G') = G (i.e. iso(G) / 4). */
+    0xa5, 0x0d, 0xd9, 0x73, 0xd9, 0x9e, 0x99, 0x33,
+    0x4f, 0x4b, 0x74, 0x9a, 0x1d, 0x6d, 0x2c, 0xf3,
+    0x16, 0x9d, 0x70, 0x10, 0x8c, 0xfd, 0x33, 0x03,
+    0x25, 0x67, 0x06, 0xf4, 0x21, 0x34, 0xda, 0x9e,
+    0xa3, 0xb6, 0x29, 0xcb, 0xf5, 0xb7, 0xd4, 0x98,
+    0x22, 0xb2, 0x32, 0x54, 0xe3, 0x64, 0xb1, 0x4f,
+    0x53, 0x0c, 0x0f, 0x01, 0x91, 0x24, 0x54, 0x8e
+  },
+  {
+    0xa2, 0xa3, 0x5d, 0x8c, 0x3c, 0xbf, 0x45, 0xf7,
+    0x75, 0xc2, 0x4a, 0xb6, 0x4d, 0xfe, 0xcd, 0x7f,
+    0x62, 0x2d, 0x84, 0x24, 0x37, 0x77, 0x9f, 0xcd,
+    0x52, 0x52, 0x94, 0xc2, 0xec, 0xfb, 0xf8, 0x9b,
+    0x84, 0x65, 0xcf, 0x19, 0xc9, 0x06, 0x57, 0x7b,
+    0xb5, 0xed, 0x6a, 0xa9, 0x66, 0xcc, 0x6a, 0x2f,
+    0xd3, 0x83, 0x8d, 0xdc, 0x89, 0x8c, 0x40, 0x8b
+  },
+  /* Isomorphism scaling factor (c). */
+  {
+    /* None (unused). */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  NULL,
+  &tables_ed448_iso,
+  NULL,
+  NULL,
+  NULL
 };
 
 static const edwards_def_t curve_ed448 = {
@@ -8325,7 +10448,11 @@ static const edwards_def_t curve_ed448 = {
     0xc3, 0xd1, 0x12, 0x0f, 0x0e, 0xfa, 0x59, 0xf5,
     0x4b, 0xf3, 0x8e, 0x82, 0xb0, 0xe1, 0xe0, 0x28
   },
-  subgroups_ed448
+  subgroups_ed448,
+  &tables_ed448,
+  NULL,
+  NULL,
+  &curve_ed448_iso
 };
 
 static const edwards_def_t curve_ed1174 = {
@@ -8373,7 +10500,11 @@ static const edwards_def_t curve_ed1174 = {
     0x6f, 0x8f, 0xfb, 0xe8, 0x35, 0x95, 0x48, 0xba,
     0x82, 0x76, 0xac, 0xe6, 0xbb, 0xe7, 0xdf, 0xd2
   },
-  subgroups_ed1174
+  subgroups_ed1174,
+  NULL,
+  NULL,
+  NULL,
+  NULL
 };
 
 /*
@@ -8400,21 +10531,59 @@ static const edwards_def_t *edwards_curves[3] = {
   &curve_ed1174
 };
 
+/*
+ * Table Registry
+ */
+
+/* Indexed by compactness, then curve type. */
+static wei_cache_t wei_caches[2][ARRAY_SIZE(wei_curves)];
+static edwards_cache_t edwards_caches[2][ARRAY_SIZE(edwards_curves)];
+static edwards_cache_t edwards_iso_caches[2][ARRAY_SIZE(edwards_curves)];
+
 /*
  * Short Weierstrass API
  */
 
 wei_t *
 wei_curve_create(int type) {
+  return wei_curve_create_ex(type, 0);
+}
+
+wei_t *
+wei_curve_create_ex(int type, unsigned int flags) {
+  int compact = (flags & ECC_FLAG_COMPACT) != 0;
   wei_t *ec = NULL;
 
-  if (type < 0 || (size_t)type > ARRAY_SIZE(wei_curves))
+  if (type < 0 || (size_t)type >= ARRAY_SIZE(wei_curves))
     return NULL;
 
   ec = checked_malloc(sizeof(wei_t));
 
   wei_init(ec, wei_curves[type]);
 
+  field_set_invert(&ec->fe, &ec->sc,
+                   wei_curves[type]->fe,
+                   wei_curves[type]->sc,
+                   flags);
+
+  if (compact) {
+    ec->fixed_width = FIXED_WIDTH_COMPACT;
+    ec->naf_width = NAF_WIDTH_COMPACT;
+  }
+
+  ecc_global_lock();
+
+  ec->cache = &wei_caches[compact][type];
+  ec->cache->refs += 1;
+
+#ifndef TORSION_USE_LOCK
+  /* Cannot synchronize lazy initialization. */
+  wei_init_fixed(ec);
+  wei_init_naf(ec);
+#endif
+
+  ecc_global_unlock();
+
   return ec;
 }
 
@@ -8423,6 +10592,14 @@ wei_curve_destroy(wei_t *ec) {
   if (ec != NULL) {
     sc_cleanse(&ec->sc, ec->blind);
     jge_cleanse(ec, &ec->unblind);
+
+    ecc_global_lock();
+
+    if (--ec->cache->refs == 0)
+      wei_cache_clear(ec->cache, ec->tables);
+
+    ecc_global_unlock();
+
     free(ec);
   }
 }
@@ -8452,14 +10629,29 @@ wei_curve_field_bits(const wei_t *ec) {
   return ec->fe.bits;
 }
 
+size_t
+wei_curve_table_size(const wei_t *ec) {
+  const scalar_field_t *sc = &ec->sc;
+  size_t fixed = FIXED_LENGTH(sc->bits, ec->fixed_width);
+  size_t naf = NAF_LENGTH(ec->naf_width);
+
+  if (ec->endo)
+    naf *= 2;
+
+  return (fixed + naf) * sizeof(wge_t);
+}
+
 struct wei_scratch_s *
 wei_scratch_create(const wei_t *ec, size_t size) {
   struct wei_scratch_s *scratch = checked_malloc(sizeof(struct wei_scratch_s));
-  size_t length = ec->endo ? size : size / 2;
+  size_t min = ECC_MIN(size, BUCKET_MIN_POINTS);
+  size_t length = ec->endo ? min : min / 2;
   size_t bits = ec->endo ? ec->sc.endo_bits : ec->sc.bits;
   size_t i;
 
   scratch->size = size;
+  scratch->width = 0;
+  scratch->buckets = NULL;
   scratch->wnd = checked_malloc(length * 4 * sizeof(jge_t));
   scratch->wnds = checked_malloc(length * sizeof(jge_t *));
   scratch->naf = checked_malloc(length * (bits + 1) * sizeof(int));
@@ -8470,6 +10662,12 @@ wei_scratch_create(const wei_t *ec, size_t size) {
     scratch->nafs[i] = &scratch->naf[i * (bits + 1)];
   }
 
+  if (size >= BUCKET_MIN_POINTS) {
+    scratch->width = bucket_width(ec->sc.bits, size);
+    scratch->buckets = checked_malloc(BUCKET_SIZE(scratch->width)
+                                      * sizeof(jge_t));
+  }
+
   scratch->points = checked_malloc(size * sizeof(wge_t));
   scratch->coeffs = checked_malloc(size * sizeof(sc_t));
 
@@ -8485,12 +10683,45 @@ wei_scratch_destroy(const wei_t *ec, struct wei_scratch_s *scratch) {
     free(scratch->wnds);
     free(scratch->naf);
     free(scratch->nafs);
+    free(scratch->buckets);
     free(scratch->points);
     free(scratch->coeffs);
     free(scratch);
   }
 }
 
+void
+wei_prepared_destroy(const wei_t *ec, struct wei_prepared_s *key) {
+  (void)ec;
+
+  if (key != NULL) {
+    free(key->wnd);
+    free(key->wnd_endo);
+    free(key);
+  }
+}
+
+void
+wei_signer_destroy(const wei_t *ec, struct wei_signer_s *signer) {
+  (void)ec;
+
+  if (signer != NULL) {
+    cleanse(signer, sizeof(*signer));
+    free(signer);
+  }
+}
+
+void
+wei_pool_destroy(const wei_t *ec, struct wei_pool_s *pool) {
+  (void)ec;
+
+  if (pool != NULL) {
+    cleanse(pool->items, pool->size * sizeof(wei_nonce_t));
+    free(pool->items);
+    free(pool);
+  }
+}
+
 /*
  * Montgomery API
  */
@@ -8541,14 +10772,77 @@ mont_curve_field_bits(const mont_t *ec) {
 
 edwards_t *
 edwards_curve_create(int type) {
+  return edwards_curve_create_ex(type, 0);
+}
+
+edwards_t *
+edwards_curve_create_ex(int type, unsigned int flags) {
+  int compact = (flags & ECC_FLAG_COMPACT) != 0;
+  const edwards_def_t *def;
   edwards_t *ec = NULL;
+  edwards_t *iso = NULL;
 
-  if (type < 0 || (size_t)type > ARRAY_SIZE(edwards_curves))
+  if (type < 0 || (size_t)type >= ARRAY_SIZE(edwards_curves))
     return NULL;
 
+  def = edwards_curves[type];
   ec = checked_malloc(sizeof(edwards_t));
 
-  edwards_init(ec, edwards_curves[type]);
+  edwards_init(ec, def);
+
+  field_set_invert(&ec->fe, &ec->sc, def->fe, def->sc, flags);
+
+  if (def->isogeny != NULL) {
+    const edwards_def_t *idef = def->isogeny;
+
+    iso = checked_malloc(sizeof(edwards_t));
+
+    edwards_init(iso, idef);
+
+    field_set_invert(&iso->fe, &iso->sc, idef->fe, idef->sc, flags);
+
+    ec->iso = iso;
+  }
+
+  if (compact) {
+    ec->fixed_width = FIXED_WIDTH_COMPACT;
+    ec->naf_width = NAF_WIDTH_COMPACT;
+
+    if (iso != NULL) {
+      iso->fixed_width = FIXED_WIDTH_COMPACT;
+      iso->naf_width = NAF_WIDTH_COMPACT;
+    }
+  }
+
+  ecc_global_lock();
+
+  ec->cache = &edwards_caches[compact][type];
+  ec->cache->refs += 1;
+
+  if (iso != NULL) {
+    iso->cache = &edwards_iso_caches[compact][type];
+    iso->cache->refs += 1;
+  }
+
+#ifndef TORSION_USE_LOCK
+  /* Cannot synchronize lazy initialization. */
+  if (iso != NULL) {
+    /* Fixed-base multiplication happens on `iso`. */
+    edwards_init_fixed(iso);
+    edwards_init_naf(iso);
+  } else {
+    edwards_init_fixed(ec);
+  }
+
+  edwards_init_naf(ec);
+
+#ifdef TORSION_HAVE_ASM_AVX2
+  if (ec->group.mul_double_var == ed25519_avx2_mul_double_var)
+    ed25519_avx2_init_naf(ec);
+#endif
+#endif
+
+  ecc_global_unlock();
 
   return ec;
 }
@@ -8556,8 +10850,29 @@ edwards_curve_create(int type) {
 void
 edwards_curve_destroy(edwards_t *ec) {
   if (ec != NULL) {
+    edwards_t *iso = ec->iso;
+
     sc_cleanse(&ec->sc, ec->blind);
     xge_cleanse(ec, &ec->unblind);
+
+    if (iso != NULL) {
+      sc_cleanse(&iso->sc, iso->blind);
+      xge_cleanse(iso, &iso->unblind);
+    }
+
+    ecc_global_lock();
+
+    if (--ec->cache->refs == 0)
+      edwards_cache_clear(ec->cache, ec->tables);
+
+    if (iso != NULL) {
+      if (--iso->cache->refs == 0)
+        edwards_cache_clear(iso->cache, iso->tables);
+    }
+
+    ecc_global_unlock();
+
+    free(iso);
     free(ec);
   }
 }
@@ -8587,15 +10902,30 @@ edwards_curve_field_bits(const edwards_t *ec) {
   return ec->fe.bits;
 }
 
+size_t
+edwards_curve_table_size(const edwards_t *ec) {
+  const scalar_field_t *sc = &ec->sc;
+  size_t fixed = FIXED_LENGTH(sc->bits, ec->fixed_width);
+  size_t naf = NAF_LENGTH(ec->naf_width);
+
+  /* Both curves keep a NAF table. */
+  if (ec->iso != NULL)
+    naf *= 2;
+
+  return fixed * sizeof(nge_t) + naf * sizeof(xge_t);
+}
+
 struct edwards_scratch_s *
 edwards_scratch_create(const edwards_t *ec, size_t size) {
   struct edwards_scratch_s *scratch =
     checked_malloc(sizeof(struct edwards_scratch_s));
-  size_t length = size / 2;
+  size_t length = ECC_MIN(size, BUCKET_MIN_POINTS) / 2;
   size_t bits = ec->sc.bits;
   size_t i;
 
   scratch->size = size;
+  scratch->width = 0;
+  scratch->buckets = NULL;
   scratch->wnd = checked_malloc(length * 4 * sizeof(xge_t));
   scratch->wnds = checked_malloc(length * sizeof(xge_t *));
   scratch->naf = checked_malloc(length * (bits + 1) * sizeof(int));
@@ -8606,9 +10936,23 @@ edwards_scratch_create(const edwards_t *ec, size_t size) {
     scratch->nafs[i] = &scratch->naf[i * (bits + 1)];
   }
 
+  if (size >= BUCKET_MIN_POINTS) {
+    scratch->width = bucket_width(ec->sc.bits, size);
+    scratch->buckets = checked_malloc(BUCKET_SIZE(scratch->width)
+                                      * sizeof(xge_t));
+  }
+
   scratch->points = checked_malloc(size * sizeof(xge_t));
   scratch->coeffs = checked_malloc(size * sizeof(sc_t));
 
+#ifdef TORSION_HAVE_ASM_AVX2
+  /* The 4-way backend keeps its combs in cached form. */
+  scratch->wnd_avx2 = NULL;
+
+  if (ec->group.mul_multi_normal_var == ed25519_avx2_mul_multi_normal_var)
+    scratch->wnd_avx2 = checked_malloc(length * 4 * sizeof(p25519x4_t));
+#endif
+
   return scratch;
 }
 
@@ -8622,12 +10966,38 @@ edwards_scratch_destroy(const edwards_t *ec,
     free(scratch->wnds);
     free(scratch->naf);
     free(scratch->nafs);
+    free(scratch->buckets);
     free(scratch->points);
     free(scratch->coeffs);
+#ifdef TORSION_HAVE_ASM_AVX2
+    free(scratch->wnd_avx2);
+#endif
     free(scratch);
   }
 }
 
+void
+edwards_prepared_destroy(const edwards_t *ec,
+                         struct edwards_prepared_s *key) {
+  (void)ec;
+
+  if (key != NULL) {
+    free(key->wnd);
+    free(key);
+  }
+}
+
+void
+edwards_signer_destroy(const edwards_t *ec,
+                       struct edwards_signer_s *signer) {
+  (void)ec;
+
+  if (signer != NULL) {
+    cleanse(signer, sizeof(*signer));
+    free(signer);
+  }
+}
+
 /*
  * ECDSA
  */
@@ -8857,6 +11227,50 @@ ecdsa_pubkey_create(const wei_t *ec,
   return ret;
 }
 
+int
+ecdsa_pubkey_create_batch(const wei_t *ec,
+                          unsigned char *out,
+                          size_t *out_len,
+                          const unsigned char *const *privs,
+                          size_t len,
+                          int compact) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t size = compact ? 1 + fe->size : 1 + fe->size * 2;
+  jge_t points[NORM_BATCH];
+  wge_t affine[NORM_BATCH];
+  size_t i, j, n;
+  int ret = 1;
+  sc_t a;
+
+  *out_len = size;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    for (j = 0; j < n; j++) {
+      ret &= sc_import(sc, a, privs[i + j]);
+      ret &= sc_is_zero(sc, a) ^ 1;
+
+      wei_jmul_g(ec, &points[j], a);
+    }
+
+    /* One inversion per chunk. */
+    jge_to_wge_all(ec, affine, points, n);
+
+    for (j = 0; j < n; j++) {
+      ret &= wge_export(ec, out + (i + j) * size, NULL, &affine[j], compact);
+
+      jge_cleanse(ec, &points[j]);
+      wge_cleanse(ec, &affine[j]);
+    }
+  }
+
+  sc_cleanse(sc, a);
+
+  return ret;
+}
+
 int
 ecdsa_pubkey_convert(const wei_t *ec,
                      unsigned char *out,
@@ -8886,6 +11300,35 @@ ecdsa_pubkey_from_uniform(const wei_t *ec,
   ASSERT(wge_export(ec, out, out_len, &A, compact));
 }
 
+void
+ecdsa_pubkey_from_uniform_batch(const wei_t *ec,
+                                unsigned char *out,
+                                size_t *out_len,
+                                const unsigned char *const *bytes,
+                                size_t len,
+                                int compact) {
+  const prime_field_t *fe = &ec->fe;
+  size_t size = compact ? 1 + fe->size : 1 + fe->size * 2;
+  wge_t points[NORM_BATCH];
+  size_t i, j, n;
+
+  *out_len = size;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    /* One inversion per chunk. */
+    wei_point_from_uniform_all(ec, points, &bytes[i], n);
+
+    for (j = 0; j < n; j++) {
+      ASSERT(wge_export(ec, out + (i + j) * size, NULL,
+                        &points[j], compact));
+
+      wge_cleanse(ec, &points[j]);
+    }
+  }
+}
+
 int
 ecdsa_pubkey_to_uniform(const wei_t *ec,
                         unsigned char *out,
@@ -8898,20 +11341,73 @@ ecdsa_pubkey_to_uniform(const wei_t *ec,
   ret &= wge_import(ec, &A, pub, pub_len);
   ret &= wei_point_to_uniform(ec, out, &A, hint);
 
-  return ret;
-}
+  return ret;
+}
+
+int
+ecdsa_pubkey_from_hash(const wei_t *ec,
+                       unsigned char *out,
+                       size_t *out_len,
+                       const unsigned char *bytes,
+                       int compact) {
+  wge_t A;
+
+  wei_point_from_hash(ec, &A, bytes);
+
+  return wge_export(ec, out, out_len, &A, compact);
+}
+
+int
+ecdsa_pubkey_from_hash_batch(const wei_t *ec,
+                             unsigned char *out,
+                             size_t *out_len,
+                             const unsigned char *const *bytes,
+                             size_t len,
+                             int compact) {
+  const prime_field_t *fe = &ec->fe;
+  size_t size = compact ? 1 + fe->size : 1 + fe->size * 2;
+  const unsigned char *ptrs[NORM_BATCH];
+  wge_t points[NORM_BATCH];
+  jge_t sums[NORM_BATCH / 2];
+  wge_t affine[NORM_BATCH / 2];
+  size_t i, j, n;
+  int ret = 1;
+  jge_t T;
+
+  *out_len = size;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH / 2);
+
+    for (j = 0; j < n; j++) {
+      ptrs[j * 2 + 0] = bytes[i + j];
+      ptrs[j * 2 + 1] = bytes[i + j] + fe->size;
+    }
+
+    /* One inversion for the maps. */
+    wei_point_from_uniform_all(ec, points, ptrs, n * 2);
+
+    for (j = 0; j < n; j++) {
+      wge_to_jge(ec, &T, &points[j * 2 + 0]);
+      jge_mixed_add(ec, &sums[j], &T, &points[j * 2 + 1]);
+    }
+
+    /* One inversion for the sums. */
+    jge_to_wge_all(ec, affine, sums, n);
 
-int
-ecdsa_pubkey_from_hash(const wei_t *ec,
-                       unsigned char *out,
-                       size_t *out_len,
-                       const unsigned char *bytes,
-                       int compact) {
-  wge_t A;
+    for (j = 0; j < n; j++) {
+      ret &= wge_export(ec, out + (i + j) * size, NULL, &affine[j], compact);
 
-  wei_point_from_hash(ec, &A, bytes);
+      wge_cleanse(ec, &points[j * 2 + 0]);
+      wge_cleanse(ec, &points[j * 2 + 1]);
+      jge_cleanse(ec, &sums[j]);
+      wge_cleanse(ec, &affine[j]);
+    }
+  }
 
-  return wge_export(ec, out, out_len, &A, compact);
+  jge_cleanse(ec, &T);
+
+  return ret;
 }
 
 int
@@ -9044,6 +11540,51 @@ ecdsa_pubkey_tweak_add(const wei_t *ec,
   return ret;
 }
 
+int
+ecdsa_pubkey_tweak_add_batch(const wei_t *ec,
+                             unsigned char *out,
+                             size_t *out_len,
+                             const unsigned char *const *pubs,
+                             const size_t *pub_lens,
+                             const unsigned char *const *tweaks,
+                             size_t len,
+                             int compact) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t size = compact ? 1 + fe->size : 1 + fe->size * 2;
+  jge_t points[NORM_BATCH];
+  wge_t affine[NORM_BATCH];
+  size_t i, j, n;
+  int ret = 1;
+  wge_t A;
+  sc_t t;
+
+  *out_len = size;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    for (j = 0; j < n; j++) {
+      ret &= wge_import(ec, &A, pubs[i + j], pub_lens[i + j]);
+      ret &= sc_import(sc, t, tweaks[i + j]);
+
+      wei_jmul_g(ec, &points[j], t);
+
+      jge_mixed_add(ec, &points[j], &points[j], &A);
+    }
+
+    /* One inversion per chunk. */
+    jge_to_wge_all(ec, affine, points, n);
+
+    for (j = 0; j < n; j++)
+      ret &= wge_export(ec, out + (i + j) * size, NULL, &affine[j], compact);
+  }
+
+  sc_cleanse(sc, t);
+
+  return ret;
+}
+
 int
 ecdsa_pubkey_tweak_mul(const wei_t *ec,
                        unsigned char *out,
@@ -9326,6 +11867,15 @@ ecdsa_is_low_s(const wei_t *ec, const unsigned char *sig) {
   return ret;
 }
 
+static void
+ecdsa_sign_drbg(const wei_t *ec,
+                unsigned char *sig,
+                unsigned int *param,
+                const sc_t a,
+                const sc_t m,
+                drbg_t *rng,
+                ecdsa_redefine_f *redefine);
+
 int
 ecdsa_sign(const wei_t *ec,
            unsigned char *sig,
@@ -9388,15 +11938,11 @@ ecdsa_sign_internal(const wei_t *ec,
    * deterministically using the HMAC-DRBG
    * construction described in [RFC6979].
    */
-  const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
   unsigned char bytes[MAX_SCALAR_SIZE * 2];
-  unsigned int sign, high;
-  sc_t a, m, k, r, s;
+  sc_t a, m;
   drbg_t rng;
-  wge_t R;
   int ret = 1;
-  int ok;
 
   ret &= sc_import(sc, a, priv);
   ret &= sc_is_zero(sc, a) ^ 1;
@@ -9408,8 +11954,35 @@ ecdsa_sign_internal(const wei_t *ec,
 
   drbg_init(&rng, ec->hash, bytes, sc->size * 2);
 
+  ecdsa_sign_drbg(ec, sig, param, a, m, &rng, redefine);
+
+  sc_cleanse(sc, a);
+  sc_cleanse(sc, m);
+
+  cleanse(&rng, sizeof(rng));
+  cleanse(bytes, sc->size * 2);
+
+  return ret;
+}
+
+static void
+ecdsa_sign_drbg(const wei_t *ec,
+                unsigned char *sig,
+                unsigned int *param,
+                const sc_t a,
+                const sc_t m,
+                drbg_t *rng,
+                ecdsa_redefine_f *redefine) {
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char bytes[MAX_SCALAR_SIZE];
+  unsigned int sign, high;
+  sc_t k, r, s;
+  wge_t R;
+  int ok;
+
   do {
-    drbg_generate(&rng, bytes, sc->size);
+    drbg_generate(rng, bytes, sc->size);
 
     ok = ecdsa_reduce(ec, k, bytes, sc->size);
 
@@ -9439,27 +12012,316 @@ ecdsa_sign_internal(const wei_t *ec,
   if (param != NULL)
     *param = (high << 1) | sign;
 
-  sc_cleanse(sc, a);
-  sc_cleanse(sc, m);
   sc_cleanse(sc, k);
   sc_cleanse(sc, r);
   sc_cleanse(sc, s);
 
   wge_cleanse(ec, &R);
 
+  cleanse(bytes, sc->size);
+}
+
+struct wei_signer_s *
+ecdsa_signer_create(const wei_t *ec, const unsigned char *priv) {
+  /* Keyed [RFC6979] signing. The scalar is decoded
+   * once and the HMAC-DRBG is pre-keyed with it
+   * (see hmac_drbg_key_init), leaving only the
+   * message-dependent compressions per signature.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char bytes[MAX_SCALAR_SIZE];
+  struct wei_signer_s *signer;
+  int ret = 1;
+  sc_t a;
+
+  ret &= sc_import(sc, a, priv);
+  ret &= sc_is_zero(sc, a) ^ 1;
+
+  if (!ret) {
+    sc_cleanse(sc, a);
+    return NULL;
+  }
+
+  signer = checked_malloc(sizeof(struct wei_signer_s));
+
+  sc_set(sc, signer->a, a);
+  sc_export(sc, bytes, a);
+
+  hmac_drbg_key_init(&signer->key, ec->hash, bytes, sc->size);
+
+  sc_cleanse(sc, a);
+
+  cleanse(bytes, sc->size);
+
+  return signer;
+}
+
+void
+ecdsa_sign_prepared(const wei_t *ec,
+                    unsigned char *sig,
+                    unsigned int *param,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const struct wei_signer_s *signer) {
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char bytes[MAX_SCALAR_SIZE];
+  drbg_t rng;
+  sc_t m;
+
+  ecdsa_reduce(ec, m, msg, msg_len);
+
+  sc_export(sc, bytes, m);
+
+  hmac_drbg_init_keyed(&rng, &signer->key, bytes, sc->size);
+
+  ecdsa_sign_drbg(ec, sig, param, signer->a, m, &rng, NULL);
+
+  sc_cleanse(sc, m);
+
   cleanse(&rng, sizeof(rng));
-  cleanse(bytes, sc->size * 2);
+}
 
-  return ret;
+struct wei_pool_s *
+ecdsa_pool_create(const wei_t *ec, size_t size) {
+  struct wei_pool_s *pool = checked_malloc(sizeof(struct wei_pool_s));
+
+  (void)ec;
+
+  CHECK(size > 0);
+
+  pool->size = size;
+  pool->len = 0;
+  pool->items = checked_malloc(size * sizeof(wei_nonce_t));
+
+  return pool;
+}
+
+size_t
+ecdsa_pool_size(const wei_t *ec, const struct wei_pool_s *pool) {
+  (void)ec;
+  return pool->len;
+}
+
+size_t
+ecdsa_pool_fill(const wei_t *ec,
+                struct wei_pool_s *pool,
+                const unsigned char *entropy) {
+  /* Offline half of randomized ECDSA signing.
+   *
+   * Computation:
+   *
+   *   k = random integer in [1,n-1]
+   *   R = G * k
+   *   r = x(R) mod n
+   *
+   * for every free slot, after which only
+   *
+   *   s = (r * a + m) / k mod n
+   *
+   * is left for ecdsa_sign_pooled to do. The
+   * affine conversions and the inversions of
+   * `k` are each batched with Montgomery's
+   * trick, in constant time, so a pool of `n`
+   * nonces costs `n` fixed-base multiplications
+   * plus one field and one scalar inversion.
+   *
+   * Nonces are drawn from a DRBG seeded with
+   * `entropy` and are not derived from any key
+   * or message, unlike [RFC6979].
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t want = pool->size - pool->len;
+  wei_nonce_t *items = &pool->items[pool->len];
+  unsigned char bytes[MAX_SCALAR_SIZE];
+  unsigned int sign, high;
+  jge_t *points;
+  wge_t *out;
+  sc_t *pre;
+  sc_t acc, t;
+  drbg_t rng;
+  size_t i, j;
+  int ok;
+
+  if (want == 0)
+    return 0;
+
+  points = checked_malloc(want * sizeof(jge_t));
+  out = checked_malloc(want * sizeof(wge_t));
+  pre = checked_malloc(want * sizeof(sc_t));
+
+  drbg_init(&rng, HASH_SHA256, entropy, ENTROPY_SIZE);
+
+  /* Draw `k` (held in `kinv` for now) and compute R. */
+  for (i = 0; i < want; i++) {
+    do {
+      drbg_generate(&rng, bytes, sc->size);
+
+      ok = sc_import(sc, items[i].kinv, bytes);
+      ok &= sc_is_zero(sc, items[i].kinv) ^ 1;
+    } while (UNLIKELY(!ok));
+
+    wei_jmul_g(ec, &points[i], items[i].kinv);
+  }
+
+  jge_to_wge_all(ec, out, points, want);
+
+  /* Invert every `k` at once. */
+  sc_set_word(sc, acc, 1);
+
+  for (i = 0; i < want; i++) {
+    sc_set(sc, pre[i], acc);
+    sc_mul(sc, acc, acc, items[i].kinv);
+  }
+
+  ASSERT(sc_invert(sc, acc, acc));
+
+  for (i = want; i-- > 0;) {
+    sc_mul(sc, t, acc, pre[i]);
+    sc_mul(sc, acc, acc, items[i].kinv);
+    sc_set(sc, items[i].kinv, t);
+  }
+
+  /* Compute `r`, dropping the (negligible) r = 0. */
+  for (i = 0, j = 0; i < want; i++) {
+    sign = fe_is_odd(fe, out[i].y);
+    high = sc_set_fe(sc, fe, items[j].r, out[i].x) ^ 1;
+
+    if (UNLIKELY(sc_is_zero(sc, items[j].r)))
+      continue;
+
+    if (j != i)
+      sc_set(sc, items[j].kinv, items[i].kinv);
+
+    items[j].param = (high << 1) | sign;
+
+    j += 1;
+  }
+
+  cleanse(&items[j], (want - j) * sizeof(wei_nonce_t));
+
+  pool->len += j;
+
+  cleanse(points, want * sizeof(jge_t));
+  cleanse(out, want * sizeof(wge_t));
+  cleanse(pre, want * sizeof(sc_t));
+
+  free(points);
+  free(out);
+  free(pre);
+
+  sc_cleanse(sc, acc);
+  sc_cleanse(sc, t);
+
+  cleanse(&rng, sizeof(rng));
+  cleanse(bytes, sc->size);
+
+  return j;
+}
+
+size_t
+ecdsa_pool_move(const wei_t *ec,
+                struct wei_pool_s *dst,
+                struct wei_pool_s *src) {
+  /* Move as many nonces as will fit. */
+  size_t len = ECC_MIN(dst->size - dst->len, src->len);
+  size_t size = len * sizeof(wei_nonce_t);
+
+  (void)ec;
+
+  src->len -= len;
+
+  memcpy(&dst->items[dst->len], &src->items[src->len], size);
+  cleanse(&src->items[src->len], size);
+
+  dst->len += len;
+
+  return len;
+}
+
+void
+ecdsa_pool_clear(const wei_t *ec, struct wei_pool_s *pool) {
+  (void)ec;
+
+  cleanse(pool->items, pool->size * sizeof(wei_nonce_t));
+
+  pool->len = 0;
 }
 
 int
-ecdsa_verify(const wei_t *ec,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *sig,
-             const unsigned char *pub,
-             size_t pub_len) {
+ecdsa_sign_pooled(const wei_t *ec,
+                  unsigned char *sig,
+                  unsigned int *param,
+                  const unsigned char *msg,
+                  size_t msg_len,
+                  const unsigned char *priv,
+                  struct wei_pool_s *pool) {
+  /* Online half of ECDSA signing (see
+   * ecdsa_pool_fill). Each nonce is erased
+   * from the pool as it is consumed.
+   *
+   * A nonce yielding s = 0 is thrown away
+   * and the next one is tried. Should the
+   * pool run dry, we fall back to RFC6979.
+   */
+  const scalar_field_t *sc = &ec->sc;
+  unsigned int sign;
+  wei_nonce_t *item;
+  sc_t a, m, s;
+  int found = 0;
+  int ret = 1;
+
+  ret &= sc_import(sc, a, priv);
+  ret &= sc_is_zero(sc, a) ^ 1;
+
+  if (!ret) {
+    sc_cleanse(sc, a);
+    return 0;
+  }
+
+  ecdsa_reduce(ec, m, msg, msg_len);
+
+  while (!found && pool->len > 0) {
+    item = &pool->items[pool->len - 1];
+
+    sc_mul(sc, s, item->r, a);
+    sc_add(sc, s, s, m);
+    sc_mul(sc, s, s, item->kinv);
+
+    found = sc_is_zero(sc, s) ^ 1;
+
+    if (LIKELY(found)) {
+      sign = item->param & 1;
+      sign ^= sc_minimize(sc, s, s);
+
+      sc_export(sc, sig, item->r);
+      sc_export(sc, sig + sc->size, s);
+
+      if (param != NULL)
+        *param = (item->param & 2) | sign;
+    }
+
+    cleanse(item, sizeof(*item));
+
+    pool->len -= 1;
+  }
+
+  sc_cleanse(sc, a);
+  sc_cleanse(sc, m);
+  sc_cleanse(sc, s);
+
+  if (!found)
+    return ecdsa_sign(ec, sig, param, msg, msg_len, priv);
+
+  return 1;
+}
+
+static int
+ecdsa_verify_pre(const wei_t *ec,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 const unsigned char *sig,
+                 const struct wei_prepared_s *key) {
   /* ECDSA Verification.
    *
    * [SEC1] Page 46, Section 4.1.4.
@@ -9494,7 +12356,7 @@ ecdsa_verify(const wei_t *ec,
   const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
   sc_t m, r, s, u1, u2;
-  wge_t A, R;
+  wge_t R;
   jge_t J;
   sc_t x;
 
@@ -9510,29 +12372,82 @@ ecdsa_verify(const wei_t *ec,
   if (sc_is_high_var(sc, s))
     return 0;
 
-  if (!wge_import(ec, &A, pub, pub_len))
+  ecdsa_reduce(ec, m, msg, msg_len);
+
+  ASSERT(sc_invert_var(sc, s, s));
+  sc_mul(sc, u1, m, s);
+  sc_mul(sc, u2, r, s);
+
+  wei_jmul_double_pre_var(ec, &J, u1, key, u2);
+
+  if (ec->small_gap)
+    return jge_equal_r_var(ec, &J, r);
+
+  jge_to_wge_var(ec, &R, &J);
+
+  if (wge_is_zero(ec, &R))
+    return 0;
+
+  sc_set_fe(sc, fe, x, R.x);
+
+  return sc_equal(sc, x, r);
+}
+
+int
+ecdsa_verify(const wei_t *ec,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *sig,
+             const unsigned char *pub,
+             size_t pub_len) {
+  struct wei_prepared_s key;
+
+  if (!wge_import(ec, &key.point, pub, pub_len))
     return 0;
 
-  ecdsa_reduce(ec, m, msg, msg_len);
+  key.width = 0;
+  key.wnd = NULL;
+  key.wnd_endo = NULL;
 
-  ASSERT(sc_invert_var(sc, s, s));
-  sc_mul(sc, u1, m, s);
-  sc_mul(sc, u2, r, s);
+  return ecdsa_verify_pre(ec, msg, msg_len, sig, &key);
+}
 
-  if (ec->small_gap) {
-    wei_jmul_double_var(ec, &J, u1, &A, u2);
+struct wei_prepared_s *
+ecdsa_pubkey_prepare(const wei_t *ec,
+                     const unsigned char *pub,
+                     size_t pub_len,
+                     unsigned int width) {
+  /* Decode a key once and (optionally) compute a
+   * `width`-bit NAF window for it. Verifiers which
+   * see the same key repeatedly can then skip the
+   * decompression and window setup on every call.
+   */
+  struct wei_prepared_s *key;
+  wge_t A;
 
-    return jge_equal_r_var(ec, &J, r);
-  }
+  CHECK(width == 0 || (width >= 2 && width <= NAF_WIDTH_PRE));
 
-  wei_mul_double_var(ec, &R, u1, &A, u2);
+  if (!wge_import(ec, &A, pub, pub_len))
+    return NULL;
 
-  if (wge_is_zero(ec, &R))
-    return 0;
+  key = checked_malloc(sizeof(struct wei_prepared_s));
 
-  sc_set_fe(sc, fe, x, R.x);
+  wge_set(ec, &key->point, &A);
 
-  return sc_equal(sc, x, r);
+  memset(key->raw, 0, sizeof(key->raw));
+
+  wei_prepared_init(ec, key, width);
+
+  return key;
+}
+
+int
+ecdsa_verify_prepared(const wei_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const struct wei_prepared_s *key) {
+  return ecdsa_verify_pre(ec, msg, msg_len, sig, key);
 }
 
 int
@@ -10043,6 +12958,126 @@ schnorr_legacy_verify_batch(const wei_t *ec,
   return 1;
 }
 
+size_t
+schnorr_legacy_verify_batch_invalid(const wei_t *ec,
+                                    size_t *invalid,
+                                    const unsigned char *const *msgs,
+                                    const size_t *msg_lens,
+                                    const unsigned char *const *sigs,
+                                    const unsigned char *const *pubs,
+                                    const size_t *pub_lens,
+                                    size_t len,
+                                    struct wei_scratch_s *scratch) {
+  /* Schnorr Batch Verification (with fault identification).
+   *
+   * Every item is decoded and hashed once. Failing
+   * sub-batches are then bisected recursively with
+   * fresh coefficients, reusing the decoded points
+   * and challenges at every level.
+   *
+   * The indices of the invalid items are written to
+   * `invalid` in ascending order. The number of
+   * invalid items is returned.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char Araw[MAX_FIELD_SIZE + 1];
+  size_t count = 0;
+  size_t total = 0;
+  wge_t *points;
+  sc_t *scalars;
+  size_t *items;
+  drbg_t rng;
+  size_t i;
+
+  CHECK(scratch->size >= 2);
+
+  if (len == 0)
+    return 0;
+
+  /* Seed RNG. */
+  {
+    unsigned char bytes[32];
+    sha256_t outer, inner;
+
+    sha256_init(&outer);
+
+    for (i = 0; i < len; i++) {
+      const unsigned char *msg = msgs[i];
+      size_t msg_len = msg_lens[i];
+      const unsigned char *sig = sigs[i];
+      const unsigned char *pub = pubs[i];
+      size_t pub_len = pub_lens[i];
+
+      /* Quick key reserialization. */
+      if (pub_len == fe->size + 1) {
+        memcpy(Araw, pub, pub_len);
+      } else if (pub_len == fe->size * 2 + 1) {
+        Araw[0] = 0x02 | (pub[pub_len - 1] & 1);
+        memcpy(Araw + 1, pub + 1, fe->size);
+      } else {
+        memset(Araw, 0x00, fe->size + 1);
+      }
+
+      sha256_init(&inner);
+      sha256_update(&inner, msg, msg_len);
+      sha256_final(&inner, bytes);
+
+      sha256_update(&outer, bytes, 32);
+      sha256_update(&outer, sig, fe->size + sc->size);
+      sha256_update(&outer, Araw, fe->size + 1);
+    }
+
+    sha256_final(&outer, bytes);
+
+    drbg_init(&rng, HASH_SHA256, bytes, 32);
+  }
+
+  points = checked_malloc(len * 2 * sizeof(wge_t));
+  scalars = checked_malloc(len * 2 * sizeof(sc_t));
+  items = checked_malloc(len * sizeof(size_t));
+
+  /* Decode signatures. */
+  for (i = 0; i < len; i++) {
+    const unsigned char *msg = msgs[i];
+    size_t msg_len = msg_lens[i];
+    const unsigned char *sig = sigs[i];
+    const unsigned char *pub = pubs[i];
+    size_t pub_len = pub_lens[i];
+    const unsigned char *Rraw = sig;
+    const unsigned char *sraw = sig + fe->size;
+    wge_t *R = &points[i * 2 + 0];
+    wge_t *A = &points[i * 2 + 1];
+
+    if (!sc_import(sc, scalars[i * 2 + 0], sraw)
+        || !wge_import_square(ec, R, Rraw)
+        || !wge_import(ec, A, pub, pub_len)) {
+      invalid[count++] = i;
+      continue;
+    }
+
+    ASSERT(wge_export(ec, Araw, NULL, A, 1));
+
+    schnorr_legacy_hash_challenge(ec, scalars[i * 2 + 1],
+                                  Rraw, Araw, msg, msg_len);
+
+    items[total++] = i;
+  }
+
+  /* Identify invalid signatures. */
+  i = wei_batch_invalid_var(ec, invalid + count, points,
+                            (const sc_t *)scalars, items,
+                            total, &rng, scratch);
+
+  count = batch_merge_invalid(invalid, count, i, items);
+
+  free(points);
+  free(scalars);
+  free(items);
+
+  return count;
+}
+
 /*
  * Schnorr
  */
@@ -10419,7 +13454,11 @@ schnorr_pubkey_combine(const wei_t *ec,
 
 static void
 schnorr_hash_init(hash_t *hash, int type, const char *tag) {
-  /* [BIP340] "Tagged Hashes". */
+  /* [BIP340] "Tagged Hashes".
+   *
+   * Only called on initialization. The
+   * resulting midstates live in `wei_t`.
+   */
   size_t hash_size = hash_output_size(type);
   unsigned char bytes[HASH_MAX_OUTPUT_SIZE];
 
@@ -10443,23 +13482,7 @@ schnorr_hash_aux(const wei_t *ec,
   hash_t hash;
   size_t i;
 
-  if (ec->hash == HASH_SHA256) {
-    sha256_t *sha = &hash.ctx.sha256;
-
-    sha->state[0] = 0x5d74a872;
-    sha->state[1] = 0xd57064d4;
-    sha->state[2] = 0x89495bec;
-    sha->state[3] = 0x910f46f5;
-    sha->state[4] = 0xcbc6fd3e;
-    sha->state[5] = 0xaf05d9d0;
-    sha->state[6] = 0xcb781ce6;
-    sha->state[7] = 0x062930ac;
-    sha->size = 64;
-
-    hash.type = HASH_SHA256;
-  } else {
-    schnorr_hash_init(&hash, ec->hash, "BIP340/aux");
-  }
+  hash = ec->tag_aux;
 
   hash_update(&hash, aux, 32);
   hash_final(&hash, bytes, hash_size);
@@ -10495,23 +13518,7 @@ schnorr_hash_nonce(const wei_t *ec, sc_t k,
     memset(bytes, 0x00, off);
   }
 
-  if (ec->hash == HASH_SHA256) {
-    sha256_t *sha = &hash.ctx.sha256;
-
-    sha->state[0] = 0xa96e75cb;
-    sha->state[1] = 0x74f9f0ac;
-    sha->state[2] = 0xc49e3c98;
-    sha->state[3] = 0x202f99ba;
-    sha->state[4] = 0x8946a616;
-    sha->state[5] = 0x4accf415;
-    sha->state[6] = 0x86e335c3;
-    sha->state[7] = 0x48d0a072;
-    sha->size = 64;
-
-    hash.type = HASH_SHA256;
-  } else {
-    schnorr_hash_init(&hash, ec->hash, "BIP340/nonce");
-  }
+  hash = ec->tag_nonce;
 
   hash_update(&hash, secret, sc->size);
   hash_update(&hash, point, fe->size);
@@ -10545,23 +13552,7 @@ schnorr_hash_challenge(const wei_t *ec, sc_t e,
     memset(bytes, 0x00, off);
   }
 
-  if (ec->hash == HASH_SHA256) {
-    sha256_t *sha = &hash.ctx.sha256;
-
-    sha->state[0] = 0x71985ac9;
-    sha->state[1] = 0x198317a2;
-    sha->state[2] = 0x60b6e581;
-    sha->state[3] = 0x54c109b6;
-    sha->state[4] = 0x64bac2fd;
-    sha->state[5] = 0x91231de2;
-    sha->state[6] = 0x7301ebde;
-    sha->state[7] = 0x87635f83;
-    sha->size = 64;
-
-    hash.type = HASH_SHA256;
-  } else {
-    schnorr_hash_init(&hash, ec->hash, "BIP340/challenge");
-  }
+  hash = ec->tag_challenge;
 
   hash_update(&hash, R, fe->size);
   hash_update(&hash, A, fe->size);
@@ -10663,12 +13654,12 @@ schnorr_sign(const wei_t *ec,
   return ret;
 }
 
-int
-schnorr_verify(const wei_t *ec,
-               const unsigned char *msg,
-               size_t msg_len,
-               const unsigned char *sig,
-               const unsigned char *pub) {
+static int
+schnorr_verify_pre(const wei_t *ec,
+                   const unsigned char *msg,
+                   size_t msg_len,
+                   const unsigned char *sig,
+                   const struct wei_prepared_s *key) {
   /* Schnorr Verification.
    *
    * [BIP340] "Verification".
@@ -10714,7 +13705,6 @@ schnorr_verify(const wei_t *ec,
   const unsigned char *sraw = sig + fe->size;
   fe_t r;
   sc_t s, e;
-  wge_t A;
   jge_t R;
 
   if (!fe_import(fe, r, Rraw))
@@ -10723,14 +13713,11 @@ schnorr_verify(const wei_t *ec,
   if (!sc_import(sc, s, sraw))
     return 0;
 
-  if (!wge_import_even(ec, &A, pub))
-    return 0;
-
-  schnorr_hash_challenge(ec, e, Rraw, pub, msg, msg_len);
+  schnorr_hash_challenge(ec, e, Rraw, key->raw, msg, msg_len);
 
   sc_neg(sc, e, e);
 
-  wei_jmul_double_var(ec, &R, s, &A, e);
+  wei_jmul_double_pre_var(ec, &R, s, key, e);
 
   if (!jge_is_square_var(ec, &R))
     return 0;
@@ -10741,6 +13728,61 @@ schnorr_verify(const wei_t *ec,
   return 1;
 }
 
+int
+schnorr_verify(const wei_t *ec,
+               const unsigned char *msg,
+               size_t msg_len,
+               const unsigned char *sig,
+               const unsigned char *pub) {
+  const prime_field_t *fe = &ec->fe;
+  struct wei_prepared_s key;
+
+  if (!wge_import_even(ec, &key.point, pub))
+    return 0;
+
+  memcpy(key.raw, pub, fe->size);
+
+  key.width = 0;
+  key.wnd = NULL;
+  key.wnd_endo = NULL;
+
+  return schnorr_verify_pre(ec, msg, msg_len, sig, &key);
+}
+
+struct wei_prepared_s *
+schnorr_pubkey_prepare(const wei_t *ec,
+                       const unsigned char *pub,
+                       unsigned int width) {
+  /* See ecdsa_pubkey_prepare. */
+  const prime_field_t *fe = &ec->fe;
+  struct wei_prepared_s *key;
+  wge_t A;
+
+  CHECK(width == 0 || (width >= 2 && width <= NAF_WIDTH_PRE));
+
+  if (!wge_import_even(ec, &A, pub))
+    return NULL;
+
+  key = checked_malloc(sizeof(struct wei_prepared_s));
+
+  wge_set(ec, &key->point, &A);
+
+  memcpy(key->raw, pub, fe->size);
+
+  wei_prepared_init(ec, key, width);
+
+  return key;
+}
+
+int
+schnorr_verify_prepared(const wei_t *ec,
+                        const unsigned char *msg,
+                        size_t msg_len,
+                        const unsigned char *sig,
+                        const struct wei_prepared_s *key) {
+  return schnorr_verify_pre(ec, msg, msg_len, sig, key);
+}
+
 int
 schnorr_verify_batch(const wei_t *ec,
                      const unsigned char *const *msgs,
@@ -10881,6 +13923,103 @@ schnorr_verify_batch(const wei_t *ec,
   return 1;
 }
 
+size_t
+schnorr_verify_batch_invalid(const wei_t *ec,
+                             size_t *invalid,
+                             const unsigned char *const *msgs,
+                             const size_t *msg_lens,
+                             const unsigned char *const *sigs,
+                             const unsigned char *const *pubs,
+                             size_t len,
+                             struct wei_scratch_s *scratch) {
+  /* Schnorr Batch Verification (with fault identification).
+   *
+   * See schnorr_legacy_verify_batch_invalid.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t count = 0;
+  size_t total = 0;
+  wge_t *points;
+  sc_t *scalars;
+  size_t *items;
+  drbg_t rng;
+  size_t i;
+
+  CHECK(scratch->size >= 2);
+
+  if (len == 0)
+    return 0;
+
+  /* Seed RNG. */
+  {
+    unsigned char bytes[32];
+    sha256_t outer, inner;
+
+    sha256_init(&outer);
+
+    for (i = 0; i < len; i++) {
+      const unsigned char *msg = msgs[i];
+      size_t msg_len = msg_lens[i];
+      const unsigned char *sig = sigs[i];
+      const unsigned char *pub = pubs[i];
+
+      sha256_init(&inner);
+      sha256_update(&inner, msg, msg_len);
+      sha256_final(&inner, bytes);
+
+      sha256_update(&outer, bytes, 32);
+      sha256_update(&outer, sig, fe->size + sc->size);
+      sha256_update(&outer, pub, fe->size);
+    }
+
+    sha256_final(&outer, bytes);
+
+    drbg_init(&rng, HASH_SHA256, bytes, 32);
+  }
+
+  points = checked_malloc(len * 2 * sizeof(wge_t));
+  scalars = checked_malloc(len * 2 * sizeof(sc_t));
+  items = checked_malloc(len * sizeof(size_t));
+
+  /* Decode signatures. */
+  for (i = 0; i < len; i++) {
+    const unsigned char *msg = msgs[i];
+    size_t msg_len = msg_lens[i];
+    const unsigned char *sig = sigs[i];
+    const unsigned char *pub = pubs[i];
+    const unsigned char *Rraw = sig;
+    const unsigned char *sraw = sig + fe->size;
+    wge_t *R = &points[i * 2 + 0];
+    wge_t *A = &points[i * 2 + 1];
+
+    if (!sc_import(sc, scalars[i * 2 + 0], sraw)
+        || !wge_import_square(ec, R, Rraw)
+        || !wge_import_even(ec, A, pub)) {
+      invalid[count++] = i;
+      continue;
+    }
+
+    schnorr_hash_challenge(ec, scalars[i * 2 + 1],
+                           Rraw, pub, msg, msg_len);
+
+    items[total++] = i;
+  }
+
+  /* Identify invalid signatures. */
+  i = wei_batch_invalid_var(ec, invalid + count, points,
+                            (const sc_t *)scalars, items,
+                            total, &rng, scratch);
+
+  count = batch_merge_invalid(invalid, count, i, items);
+
+  free(points);
+  free(scalars);
+  free(items);
+
+  return count;
+}
+
 int
 schnorr_derive(const wei_t *ec,
                unsigned char *secret,
@@ -11061,6 +14200,29 @@ ecdh_pubkey_from_uniform(const mont_t *ec,
   ASSERT(mge_export(ec, out, &A));
 }
 
+void
+ecdh_pubkey_from_uniform_batch(const mont_t *ec,
+                               unsigned char *out,
+                               const unsigned char *const *bytes,
+                               size_t len) {
+  const prime_field_t *fe = &ec->fe;
+  mge_t points[NORM_BATCH];
+  size_t i, j, n;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    /* One inversion per chunk. */
+    mont_point_from_uniform_all(ec, points, &bytes[i], n);
+
+    for (j = 0; j < n; j++) {
+      ASSERT(mge_export(ec, out + (i + j) * fe->size, &points[j]));
+
+      mge_cleanse(ec, &points[j]);
+    }
+  }
+}
+
 int
 ecdh_pubkey_to_uniform(const mont_t *ec,
                        unsigned char *out,
@@ -11075,21 +14237,65 @@ ecdh_pubkey_to_uniform(const mont_t *ec,
   return ret;
 }
 
-int
-ecdh_pubkey_from_hash(const mont_t *ec,
-                      unsigned char *out,
-                      const unsigned char *bytes,
-                      int pake) {
-  mge_t A;
-  pge_t P;
+int
+ecdh_pubkey_from_hash(const mont_t *ec,
+                      unsigned char *out,
+                      const unsigned char *bytes,
+                      int pake) {
+  mge_t A;
+  pge_t P;
+
+  mont_point_from_hash(ec, &A, bytes);
+  mge_to_pge(ec, &P, &A);
+
+  if (pake)
+    pge_mulh(ec, &P, &P);
+
+  return pge_export(ec, out, &P);
+}
+
+int
+ecdh_pubkey_from_hash_batch(const mont_t *ec,
+                            unsigned char *out,
+                            const unsigned char *const *bytes,
+                            size_t len,
+                            int pake) {
+  const prime_field_t *fe = &ec->fe;
+  const unsigned char *ptrs[NORM_BATCH];
+  mge_t points[NORM_BATCH];
+  pge_t sums[NORM_BATCH / 2];
+  size_t i, j, n;
+  int ret = 1;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH / 2);
+
+    for (j = 0; j < n; j++) {
+      ptrs[j * 2 + 0] = bytes[i + j];
+      ptrs[j * 2 + 1] = bytes[i + j] + fe->size;
+    }
+
+    /* One inversion for the maps. */
+    mont_point_from_uniform_all(ec, points, ptrs, n * 2);
+
+    for (j = 0; j < n; j++) {
+      mge_add_x(ec, &sums[j], &points[j * 2 + 0], &points[j * 2 + 1]);
 
-  mont_point_from_hash(ec, &A, bytes);
-  mge_to_pge(ec, &P, &A);
+      if (pake)
+        pge_mulh(ec, &sums[j], &sums[j]);
+    }
 
-  if (pake)
-    pge_mulh(ec, &P, &P);
+    /* One inversion for the sums. */
+    ret &= pge_export_all(ec, out + i * fe->size, sums, n);
 
-  return pge_export(ec, out, &P);
+    for (j = 0; j < n; j++) {
+      mge_cleanse(ec, &points[j * 2 + 0]);
+      mge_cleanse(ec, &points[j * 2 + 1]);
+      pge_cleanse(ec, &sums[j]);
+    }
+  }
+
+  return ret;
 }
 
 int
@@ -11224,6 +14430,68 @@ ecdh_derive(const mont_t *ec,
   return ret;
 }
 
+int
+ecdh_derive_batch(const mont_t *ec,
+                  unsigned char *out,
+                  int *valid,
+                  const unsigned char *const *pubs,
+                  const unsigned char *const *privs,
+                  size_t len) {
+  /* Four ladders at a time where a 4-way
+   * backend is available, with one inversion
+   * per chunk for the final normalization.
+   *
+   * Each item's result is flagged in `valid`.
+   * A bad key zeroes only its own secret.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char clamped[MAX_SCALAR_SIZE];
+  sc_t k[NORM_BATCH]; /* 2304 bytes */
+  pge_t A[NORM_BATCH]; /* 4608 bytes */
+  pge_t P[NORM_BATCH]; /* 4608 bytes */
+  size_t i, j, n;
+  int ret = 1;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    for (j = 0; j < n; j++) {
+      mont_clamp(ec, clamped, privs[i + j]);
+
+      sc_import_raw(sc, k[j], clamped);
+
+      pge_import_unsafe(ec, &A[j], pubs[i + j]);
+    }
+
+    j = 0;
+
+    if (ec->mul4 != NULL) {
+      for (; j + 4 <= n; j += 4)
+        ec->mul4(ec, &P[j], &A[j], (const sc_t *)&k[j]);
+    }
+
+    for (; j < n; j++)
+      mont_mul(ec, &P[j], &A[j], k[j], 1);
+
+    pge_export_all(ec, out + i * fe->size, P, n);
+
+    for (j = 0; j < n; j++) {
+      valid[i + j] = fe_is_zero(fe, P[j].z) ^ 1;
+      ret &= valid[i + j];
+    }
+  }
+
+  for (j = 0; j < ECC_MIN(len, NORM_BATCH); j++) {
+    sc_cleanse(sc, k[j]);
+    pge_cleanse(ec, &P[j]);
+  }
+
+  cleanse(clamped, sc->size);
+
+  return ret;
+}
+
 /*
  * EdDSA
  */
@@ -11522,6 +14790,29 @@ eddsa_pubkey_from_uniform(const edwards_t *ec,
   xge_export(ec, out, &A);
 }
 
+void
+eddsa_pubkey_from_uniform_batch(const edwards_t *ec,
+                                unsigned char *out,
+                                const unsigned char *const *bytes,
+                                size_t len) {
+  const prime_field_t *fe = &ec->fe;
+  xge_t points[NORM_BATCH];
+  size_t i, j, n;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH);
+
+    /* One inversion for the maps. */
+    edwards_point_from_uniform_all(ec, points, &bytes[i], n);
+
+    /* One inversion for the export. */
+    xge_export_all(ec, out + i * fe->adj_size, points, n);
+
+    for (j = 0; j < n; j++)
+      xge_cleanse(ec, &points[j]);
+  }
+}
+
 int
 eddsa_pubkey_to_uniform(const edwards_t *ec,
                         unsigned char *out,
@@ -11551,6 +14842,47 @@ eddsa_pubkey_from_hash(const edwards_t *ec,
   xge_export(ec, out, &A);
 }
 
+void
+eddsa_pubkey_from_hash_batch(const edwards_t *ec,
+                             unsigned char *out,
+                             const unsigned char *const *bytes,
+                             size_t len,
+                             int pake) {
+  const prime_field_t *fe = &ec->fe;
+  const unsigned char *ptrs[NORM_BATCH];
+  xge_t points[NORM_BATCH];
+  xge_t sums[NORM_BATCH / 2];
+  size_t i, j, n;
+
+  for (i = 0; i < len; i += n) {
+    n = ECC_MIN(len - i, NORM_BATCH / 2);
+
+    for (j = 0; j < n; j++) {
+      ptrs[j * 2 + 0] = bytes[i + j];
+      ptrs[j * 2 + 1] = bytes[i + j] + fe->size;
+    }
+
+    /* One inversion for the maps. */
+    edwards_point_from_uniform_all(ec, points, ptrs, n * 2);
+
+    for (j = 0; j < n; j++) {
+      xge_add(ec, &sums[j], &points[j * 2 + 0], &points[j * 2 + 1]);
+
+      if (pake)
+        xge_mulh(ec, &sums[j], &sums[j]);
+    }
+
+    /* One inversion for the export. */
+    xge_export_all(ec, out + i * fe->adj_size, sums, n);
+
+    for (j = 0; j < n; j++) {
+      xge_cleanse(ec, &points[j * 2 + 0]);
+      xge_cleanse(ec, &points[j * 2 + 1]);
+      xge_cleanse(ec, &sums[j]);
+    }
+  }
+}
+
 int
 eddsa_pubkey_to_hash(const edwards_t *ec,
                      unsigned char *out,
@@ -12015,15 +15347,111 @@ eddsa_sign_tweak_mul(const edwards_t *ec,
   cleanse(prefix, sizeof(prefix));
 }
 
-int
-eddsa_verify(const edwards_t *ec,
-             const unsigned char *msg,
-             size_t msg_len,
-             const unsigned char *sig,
-             const unsigned char *pub,
-             int ph,
-             const unsigned char *ctx,
-             size_t ctx_len) {
+struct edwards_signer_s *
+eddsa_signer_create(const edwards_t *ec,
+                    const unsigned char *priv,
+                    int ph,
+                    const unsigned char *ctx,
+                    size_t ctx_len) {
+  /* Expand the key once and keep everything
+   * eddsa_sign would rederive per signature:
+   * the scalar, the encoded public key, and
+   * the hash states with the domain separator
+   * (and for the nonce, the prefix) absorbed.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char scalar[MAX_SCALAR_SIZE];
+  unsigned char prefix[MAX_FIELD_SIZE + 1];
+  struct edwards_signer_s *signer;
+  xge_t A;
+
+  signer = checked_malloc(sizeof(struct edwards_signer_s));
+
+  eddsa_privkey_expand(ec, scalar, prefix, priv);
+
+  sc_import_reduce(sc, signer->a, scalar);
+
+  edwards_mul_g(ec, &A, signer->a);
+  xge_export(ec, signer->raw, &A);
+
+  eddsa_hash_init(ec, &signer->nonce, ph, ctx, ctx_len);
+  eddsa_hash_update(ec, &signer->nonce, prefix, fe->adj_size);
+
+  eddsa_hash_init(ec, &signer->challenge, ph, ctx, ctx_len);
+
+  cleanse(scalar, sc->size);
+  cleanse(prefix, fe->adj_size);
+
+  xge_cleanse(ec, &A);
+
+  return signer;
+}
+
+void
+eddsa_signer_pubkey(const edwards_t *ec,
+                    unsigned char *out,
+                    const struct edwards_signer_s *signer) {
+  memcpy(out, signer->raw, ec->fe.adj_size);
+}
+
+void
+eddsa_sign_prepared(const edwards_t *ec,
+                    unsigned char *sig,
+                    const unsigned char *msg,
+                    size_t msg_len,
+                    const struct edwards_signer_s *signer) {
+  /* Same as eddsa_sign_with_scalar, minus the
+   * key expansion and the second multiplication.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  unsigned char *Rraw = sig;
+  unsigned char *sraw = sig + fe->adj_size;
+  sc_t k, e, s;
+  hash_t hash;
+  xge_t R;
+
+  hash = signer->nonce;
+
+  eddsa_hash_update(ec, &hash, msg, msg_len);
+  eddsa_hash_final(ec, &hash, k);
+
+  edwards_mul_g(ec, &R, k);
+  xge_export(ec, Rraw, &R);
+
+  hash = signer->challenge;
+
+  eddsa_hash_update(ec, &hash, Rraw, fe->adj_size);
+  eddsa_hash_update(ec, &hash, signer->raw, fe->adj_size);
+  eddsa_hash_update(ec, &hash, msg, msg_len);
+  eddsa_hash_final(ec, &hash, e);
+
+  sc_mul(sc, s, e, signer->a);
+  sc_add(sc, s, s, k);
+  sc_export(sc, sraw, s);
+
+  if ((fe->bits & 7) == 0)
+    sraw[fe->size] = 0x00;
+
+  sc_cleanse(sc, k);
+  sc_cleanse(sc, e);
+  sc_cleanse(sc, s);
+
+  xge_cleanse(ec, &R);
+
+  cleanse(&hash, sizeof(hash));
+}
+
+static int
+eddsa_verify_pre(const edwards_t *ec,
+                 const unsigned char *msg,
+                 size_t msg_len,
+                 const unsigned char *sig,
+                 const struct edwards_prepared_s *key,
+                 int ph,
+                 const unsigned char *ctx,
+                 size_t ctx_len) {
   /* EdDSA Verification.
    *
    * [EDDSA] Page 15, Section 5.
@@ -12053,15 +15481,12 @@ eddsa_verify(const edwards_t *ec,
   const scalar_field_t *sc = &ec->sc;
   const unsigned char *Rraw = sig;
   const unsigned char *sraw = sig + fe->adj_size;
-  xge_t R, A, Re;
+  xge_t R, Re;
   sc_t s, e;
 
   if (!xge_import(ec, &R, Rraw))
     return 0;
 
-  if (!xge_import(ec, &A, pub))
-    return 0;
-
   if (!sc_import(sc, s, sraw))
     return 0;
 
@@ -12070,15 +15495,76 @@ eddsa_verify(const edwards_t *ec,
       return 0;
   }
 
-  eddsa_hash_challenge(ec, e, Rraw, pub, msg, msg_len, ph, ctx, ctx_len);
-
-  xge_neg(ec, &A, &A);
+  eddsa_hash_challenge(ec, e, Rraw, key->raw, msg, msg_len, ph, ctx, ctx_len);
 
-  edwards_mul_double_var(ec, &Re, s, &A, e);
+  /* Note that `key->point` is already negated. */
+  edwards_mul_double_pre_var(ec, &Re, s, key, e);
 
   return xge_equal(ec, &R, &Re);
 }
 
+int
+eddsa_verify(const edwards_t *ec,
+             const unsigned char *msg,
+             size_t msg_len,
+             const unsigned char *sig,
+             const unsigned char *pub,
+             int ph,
+             const unsigned char *ctx,
+             size_t ctx_len) {
+  const prime_field_t *fe = &ec->fe;
+  struct edwards_prepared_s key;
+
+  if (!xge_import(ec, &key.point, pub))
+    return 0;
+
+  xge_neg(ec, &key.point, &key.point);
+
+  memcpy(key.raw, pub, fe->adj_size);
+
+  key.width = 0;
+  key.wnd = NULL;
+
+  return eddsa_verify_pre(ec, msg, msg_len, sig, &key, ph, ctx, ctx_len);
+}
+
+struct edwards_prepared_s *
+eddsa_pubkey_prepare(const edwards_t *ec,
+                     const unsigned char *pub,
+                     unsigned int width) {
+  /* See ecdsa_pubkey_prepare. */
+  const prime_field_t *fe = &ec->fe;
+  struct edwards_prepared_s *key;
+  xge_t A;
+
+  CHECK(width == 0 || (width >= 2 && width <= NAF_WIDTH_PRE));
+
+  if (!xge_import(ec, &A, pub))
+    return NULL;
+
+  key = checked_malloc(sizeof(struct edwards_prepared_s));
+
+  xge_neg(ec, &key->point, &A);
+
+  memcpy(key->raw, pub, fe->adj_size);
+
+  edwards_prepared_init(ec, key, width);
+
+  return key;
+}
+
+int
+eddsa_verify_prepared(const edwards_t *ec,
+                      const unsigned char *msg,
+                      size_t msg_len,
+                      const unsigned char *sig,
+                      const struct edwards_prepared_s *key,
+                      int ph,
+                      const unsigned char *ctx,
+                      size_t ctx_len) {
+  return eddsa_verify_pre(ec, msg, msg_len, sig, key, ph, ctx, ctx_len);
+}
+
 int
 eddsa_verify_single(const edwards_t *ec,
                     const unsigned char *msg,
@@ -12112,9 +15598,14 @@ eddsa_verify_single(const edwards_t *ec,
    *
    * This allows us to make use of a
    * multi-exponentiation algorithm.
+   *
+   * The right hand side is computed on
+   * the isogenous curve if there is one
+   * (see xge_mulh_iso).
    */
   const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
+  const edwards_t *iso = edwards_iso(ec);
   const unsigned char *Rraw = sig;
   const unsigned char *sraw = sig + fe->adj_size;
   xge_t R, A, Re;
@@ -12137,14 +15628,14 @@ eddsa_verify_single(const edwards_t *ec,
   eddsa_hash_challenge(ec, e, Rraw, pub, msg, msg_len, ph, ctx, ctx_len);
 
   sc_mul_word(sc, s, s, ec->h);
-  xge_mulh(ec, &A, &A);
-  xge_mulh(ec, &R, &R);
+  xge_mulh_iso(ec, &A, &A);
+  xge_mulh_iso(ec, &R, &R);
 
-  xge_neg(ec, &A, &A);
+  xge_neg(iso, &A, &A);
 
-  edwards_mul_double_var(ec, &Re, s, &A, e);
+  edwards_mul_double_var(iso, &Re, s, &A, e);
 
-  return xge_equal(ec, &R, &Re);
+  return xge_equal(iso, &R, &Re);
 }
 
 int
@@ -12178,9 +15669,14 @@ eddsa_verify_batch(const edwards_t *ec,
    *   lhs = (si * ai + ...) * h mod n
    *   rhs = (Ri * h) * ai + (Ai * h) * (ei * ai mod n) + ...
    *   G * -lhs + rhs == O
+   *
+   * As with single verification, this is
+   * done on the isogenous curve if there
+   * is one (see xge_mulh_iso).
    */
   const prime_field_t *fe = &ec->fe;
   const scalar_field_t *sc = &ec->sc;
+  const edwards_t *iso = edwards_iso(ec);
   xge_t *points = scratch->points;
   sc_t *coeffs = scratch->coeffs;
   drbg_t rng;
@@ -12255,11 +15751,11 @@ eddsa_verify_batch(const edwards_t *ec,
     sc_mul(sc, s, s, a);
     sc_add(sc, sum, sum, s);
 
-    xge_mulh(ec, &R, &R);
-    xge_mulh(ec, &A, &A);
+    xge_mulh_iso(ec, &R, &R);
+    xge_mulh_iso(ec, &A, &A);
 
-    xge_set(ec, &points[j + 0], &R);
-    xge_set(ec, &points[j + 1], &A);
+    xge_set(iso, &points[j + 0], &R);
+    xge_set(iso, &points[j + 1], &A);
 
     sc_set(sc, coeffs[j + 0], a);
     sc_set(sc, coeffs[j + 1], e);
@@ -12270,10 +15766,10 @@ eddsa_verify_batch(const edwards_t *ec,
       sc_mul_word(sc, sum, sum, ec->h);
       sc_neg(sc, sum, sum);
 
-      edwards_mul_multi_var(ec, &R, sum, points,
+      edwards_mul_multi_var(iso, &R, sum, points,
                             (const sc_t *)coeffs, j, scratch);
 
-      if (!xge_is_zero(ec, &R))
+      if (!xge_is_zero(iso, &R))
         return 0;
 
       sc_zero(sc, sum);
@@ -12286,16 +15782,126 @@ eddsa_verify_batch(const edwards_t *ec,
     sc_mul_word(sc, sum, sum, ec->h);
     sc_neg(sc, sum, sum);
 
-    edwards_mul_multi_var(ec, &R, sum, points,
+    edwards_mul_multi_var(iso, &R, sum, points,
                           (const sc_t *)coeffs, j, scratch);
 
-    if (!xge_is_zero(ec, &R))
+    if (!xge_is_zero(iso, &R))
       return 0;
   }
 
   return 1;
 }
 
+size_t
+eddsa_verify_batch_invalid(const edwards_t *ec,
+                           size_t *invalid,
+                           const unsigned char *const *msgs,
+                           const size_t *msg_lens,
+                           const unsigned char *const *sigs,
+                           const unsigned char *const *pubs,
+                           size_t len,
+                           int ph,
+                           const unsigned char *ctx,
+                           size_t ctx_len,
+                           struct edwards_scratch_s *scratch) {
+  /* EdDSA Batch Verification (with fault identification).
+   *
+   * Every item is decoded and hashed once. Failing
+   * sub-batches are then bisected recursively with
+   * fresh coefficients, reusing the decoded points
+   * and challenges at every level.
+   *
+   * Like eddsa_verify_batch, this uses the cofactor
+   * verification equation.
+   */
+  const prime_field_t *fe = &ec->fe;
+  const scalar_field_t *sc = &ec->sc;
+  size_t count = 0;
+  size_t total = 0;
+  xge_t *points;
+  sc_t *scalars;
+  size_t *items;
+  drbg_t rng;
+  size_t i;
+
+  CHECK(scratch->size >= 2);
+
+  if (len == 0)
+    return 0;
+
+  /* Seed RNG. */
+  {
+    unsigned char bytes[32];
+    sha256_t outer, inner;
+
+    sha256_init(&outer);
+
+    for (i = 0; i < len; i++) {
+      const unsigned char *msg = msgs[i];
+      size_t msg_len = msg_lens[i];
+      const unsigned char *sig = sigs[i];
+      const unsigned char *pub = pubs[i];
+
+      sha256_init(&inner);
+      sha256_update(&inner, msg, msg_len);
+      sha256_final(&inner, bytes);
+
+      sha256_update(&outer, bytes, 32);
+      sha256_update(&outer, sig, fe->adj_size * 2);
+      sha256_update(&outer, pub, fe->adj_size);
+    }
+
+    sha256_final(&outer, bytes);
+
+    drbg_init(&rng, HASH_SHA256, bytes, 32);
+  }
+
+  points = checked_malloc(len * 2 * sizeof(xge_t));
+  scalars = checked_malloc(len * 2 * sizeof(sc_t));
+  items = checked_malloc(len * sizeof(size_t));
+
+  /* Decode signatures. */
+  for (i = 0; i < len; i++) {
+    const unsigned char *msg = msgs[i];
+    size_t msg_len = msg_lens[i];
+    const unsigned char *sig = sigs[i];
+    const unsigned char *pub = pubs[i];
+    const unsigned char *Rraw = sig;
+    const unsigned char *sraw = sig + fe->adj_size;
+    xge_t *R = &points[i * 2 + 0];
+    xge_t *A = &points[i * 2 + 1];
+
+    if (!xge_import(ec, R, Rraw)
+        || !xge_import(ec, A, pub)
+        || !sc_import(sc, scalars[i * 2 + 0], sraw)
+        || ((fe->bits & 7) == 0 && sraw[fe->size] != 0x00)) {
+      invalid[count++] = i;
+      continue;
+    }
+
+    eddsa_hash_challenge(ec, scalars[i * 2 + 1], Rraw,
+                         pub, msg, msg_len, ph, ctx, ctx_len);
+
+    xge_mulh_iso(ec, R, R);
+    xge_mulh_iso(ec, A, A);
+
+    items[total++] = i;
+  }
+
+  /* Identify invalid signatures. */
+  i = edwards_batch_invalid_var(ec, invalid + count, points,
+                                (const sc_t *)scalars, items,
+                                total, &rng, scratch);
+
+  count = batch_merge_invalid(invalid, count, i, items);
+
+  free(points);
+  free(scalars);
+  free(items);
+
+  return count;
+}
+
 int
 eddsa_derive_with_scalar(const edwards_t *ec,
                          unsigned char *secret,
@@ -0,0 +1,132 @@
+/*!
+ * adx.h - mulx/adx field multiplication for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ *
+ * Resources:
+ *   https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/ia-large-integer-arithmetic-paper.pdf
+ */
+
+/*
+ * Word-by-word montgomery multiplication for
+ * 4x64 fields, compatible with the fiat backends.
+ *
+ * The BMI2/ADX instructions give us a flagless
+ * multiply (mulx) and two independent carry
+ * chains (adcx on CF, adox on OF), allowing the
+ * low and high halves of each partial product
+ * to be accumulated in a single pass.
+ *
+ * Callers must check for BMI2 and ADX support
+ * at runtime (see fe_has_adx in ecc.c).
+ */
+
+#if defined(TORSION_HAVE_ASM_X64) && defined(TORSION_HAVE_INT128)
+
+#define TORSION_HAVE_ASM_ADX
+
+/* t += a * b[i] */
+#define ADX_MUL_ROW(i, x0, x1, x2, x3, x4, x5)  \
+  "movq " #i "*8(%[b]), %%rdx\n"                \
+  "xorl %k[zero], %k[zero]\n"                   \
+  "mulxq 0(%[a]), %[lo], %[hi]\n"               \
+  "adcxq %[lo], %[" #x0 "]\n"                   \
+  "adoxq %[hi], %[" #x1 "]\n"                   \
+  "mulxq 8(%[a]), %[lo], %[hi]\n"               \
+  "adcxq %[lo], %[" #x1 "]\n"                   \
+  "adoxq %[hi], %[" #x2 "]\n"                   \
+  "mulxq 16(%[a]), %[lo], %[hi]\n"              \
+  "adcxq %[lo], %[" #x2 "]\n"                   \
+  "adoxq %[hi], %[" #x3 "]\n"                   \
+  "mulxq 24(%[a]), %[lo], %[hi]\n"              \
+  "adcxq %[lo], %[" #x3 "]\n"                   \
+  "adoxq %[hi], %[" #x4 "]\n"                   \
+  "adcxq %[zero], %[" #x4 "]\n"                 \
+  "adoxq %[zero], %[" #x5 "]\n"                 \
+  "adcxq %[zero], %[" #x5 "]\n"
+
+/* t = (t + ((t0 * m) mod 2^64) * p) / 2^64 (x0 becomes zero) */
+#define ADX_RED_ROW(x0, x1, x2, x3, x4, x5)     \
+  "movq %[" #x0 "], %%rdx\n"                    \
+  "imulq %[m], %%rdx\n"                         \
+  "xorl %k[zero], %k[zero]\n"                   \
+  "mulxq 0(%[p]), %[lo], %[hi]\n"               \
+  "adcxq %[lo], %[" #x0 "]\n"                   \
+  "adoxq %[hi], %[" #x1 "]\n"                   \
+  "mulxq 8(%[p]), %[lo], %[hi]\n"               \
+  "adcxq %[lo], %[" #x1 "]\n"                   \
+  "adoxq %[hi], %[" #x2 "]\n"                   \
+  "mulxq 16(%[p]), %[lo], %[hi]\n"              \
+  "adcxq %[lo], %[" #x2 "]\n"                   \
+  "adoxq %[hi], %[" #x3 "]\n"                   \
+  "mulxq 24(%[p]), %[lo], %[hi]\n"              \
+  "adcxq %[lo], %[" #x3 "]\n"                   \
+  "adoxq %[hi], %[" #x4 "]\n"                   \
+  "adcxq %[zero], %[" #x4 "]\n"                 \
+  "adoxq %[zero], %[" #x5 "]\n"                 \
+  "adcxq %[zero], %[" #x5 "]\n"
+
+static void
+adx_mont4_mul(uint64_t out[4],
+              const uint64_t a[4],
+              const uint64_t b[4],
+              const uint64_t p[4],
+              const uint64_t *m) {
+  /* The accumulator is six words wide. After each
+   * reduction the lowest word is zero and is reused
+   * as the new top word, so we rotate the register
+   * names rather than shifting.
+   */
+  uint64_t t0, t1, t2, t3, t4, t5;
+  uint64_t lo, hi, zero, d;
+
+  __asm__ __volatile__(
+    "xorl %k[t0], %k[t0]\n"
+    "xorl %k[t1], %k[t1]\n"
+    "xorl %k[t2], %k[t2]\n"
+    "xorl %k[t3], %k[t3]\n"
+    "xorl %k[t4], %k[t4]\n"
+    "xorl %k[t5], %k[t5]\n"
+
+    ADX_MUL_ROW(0, t0, t1, t2, t3, t4, t5)
+    ADX_RED_ROW(t0, t1, t2, t3, t4, t5)
+    ADX_MUL_ROW(1, t1, t2, t3, t4, t5, t0)
+    ADX_RED_ROW(t1, t2, t3, t4, t5, t0)
+    ADX_MUL_ROW(2, t2, t3, t4, t5, t0, t1)
+    ADX_RED_ROW(t2, t3, t4, t5, t0, t1)
+    ADX_MUL_ROW(3, t3, t4, t5, t0, t1, t2)
+    ADX_RED_ROW(t3, t4, t5, t0, t1, t2)
+
+    /* Result is in t4:t5:t0:t1 with carry in t2 (t < 2p). */
+    /* Conditionally subtract p in constant time. */
+    "movq %[t4], %%rdx\n"
+    "subq 0(%[p]), %%rdx\n"
+    "movq %[t5], %[lo]\n"
+    "sbbq 8(%[p]), %[lo]\n"
+    "movq %[t0], %[hi]\n"
+    "sbbq 16(%[p]), %[hi]\n"
+    "movq %[t1], %[t3]\n"
+    "sbbq 24(%[p]), %[t3]\n"
+    "sbbq $0, %[t2]\n"
+    "cmovcq %[t4], %%rdx\n"
+    "cmovcq %[t5], %[lo]\n"
+    "cmovcq %[t0], %[hi]\n"
+    "cmovcq %[t1], %[t3]\n"
+    : [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2),
+      [t3] "=&r" (t3), [t4] "=&r" (t4), [t5] "=&r" (t5),
+      [lo] "=&r" (lo), [hi] "=&r" (hi), [zero] "=&r" (zero),
+      "=&d" (d)
+    : [a] "r" (a), [b] "r" (b), [p] "r" (p), [m] "m" (*m)
+    : "cc", "memory"
+  );
+
+  out[0] = d;
+  out[1] = lo;
+  out[2] = hi;
+  out[3] = t3;
+}
+
+#undef ADX_MUL_ROW
+#undef ADX_RED_ROW
+
+#endif /* TORSION_HAVE_ASM_X64 && TORSION_HAVE_INT128 */
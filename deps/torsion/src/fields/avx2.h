@@ -0,0 +1,644 @@
+/*!
+ * avx2.h - 4-way p25519 arithmetic for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ *
+ * Resources:
+ *   https://eprint.iacr.org/2012/309.pdf
+ *   https://eprint.iacr.org/2020/388.pdf
+ *   https://github.com/floodyberry/supercop/tree/master/crypto_sign/ed25519/amd64-51-30k
+ */
+
+/*
+ * Four p25519 elements packed into the lanes of
+ * ten AVX2 registers (radix 2^25.5, alternating
+ * 26 and 25 bit limbs). An extended edwards point
+ * (X, Y, Z, T) occupies exactly one such vector,
+ * which lets the four field multiplications of a
+ * doubling or an addition run side by side.
+ * The same layout also carries four independent
+ * montgomery ladders, one per lane, for X25519.
+ *
+ * Elements are stored row-major: limb i of lane j
+ * lives at v[i * 4 + j]. vpmuludq only looks at the
+ * low 32 bits of each lane, so multiplication inputs
+ * must have even limbs below 2^27.75 and odd limbs
+ * below 2^26.75. Multiplication outputs are carried
+ * (even limbs below 2^26, odd limbs below 2^25 plus
+ * a small carry), and the formulas below never add
+ * more than two such values plus a multiple of p.
+ *
+ * Callers must check for AVX2 support at runtime
+ * (see fe_has_avx2 in ecc.c).
+ */
+
+#if defined(TORSION_HAVE_ASM_X64) && defined(TORSION_HAVE_INT128)
+
+#define TORSION_HAVE_ASM_AVX2
+
+#define P25519X4_WORDS 40
+
+typedef uint64_t p25519x4_t[P25519X4_WORDS];
+
+/* Lane constants: 19, 2^26-1, 2^25-1, 2 * p, 4 * p and a24. */
+static const uint64_t p25519x4_consts[24][4] = {
+  {19, 19, 19, 19},
+  {0x3ffffff, 0x3ffffff, 0x3ffffff, 0x3ffffff},
+  {0x1ffffff, 0x1ffffff, 0x1ffffff, 0x1ffffff},
+  {0x7ffffda, 0x7ffffda, 0x7ffffda, 0x7ffffda},
+  {0x3fffffe, 0x3fffffe, 0x3fffffe, 0x3fffffe},
+  {0x7fffffe, 0x7fffffe, 0x7fffffe, 0x7fffffe},
+  {0x3fffffe, 0x3fffffe, 0x3fffffe, 0x3fffffe},
+  {0x7fffffe, 0x7fffffe, 0x7fffffe, 0x7fffffe},
+  {0x3fffffe, 0x3fffffe, 0x3fffffe, 0x3fffffe},
+  {0x7fffffe, 0x7fffffe, 0x7fffffe, 0x7fffffe},
+  {0x3fffffe, 0x3fffffe, 0x3fffffe, 0x3fffffe},
+  {0x7fffffe, 0x7fffffe, 0x7fffffe, 0x7fffffe},
+  {0x3fffffe, 0x3fffffe, 0x3fffffe, 0x3fffffe},
+  {0xfffffb4, 0xfffffb4, 0xfffffb4, 0xfffffb4},
+  {0x7fffffc, 0x7fffffc, 0x7fffffc, 0x7fffffc},
+  {0xffffffc, 0xffffffc, 0xffffffc, 0xffffffc},
+  {0x7fffffc, 0x7fffffc, 0x7fffffc, 0x7fffffc},
+  {0xffffffc, 0xffffffc, 0xffffffc, 0xffffffc},
+  {0x7fffffc, 0x7fffffc, 0x7fffffc, 0x7fffffc},
+  {0xffffffc, 0xffffffc, 0xffffffc, 0xffffffc},
+  {0x7fffffc, 0x7fffffc, 0x7fffffc, 0x7fffffc},
+  {0xffffffc, 0xffffffc, 0xffffffc, 0xffffffc},
+  {0x7fffffc, 0x7fffffc, 0x7fffffc, 0x7fffffc},
+  {121666, 121666, 121666, 121666}
+};
+
+#define X4_C19 "0(%[c])"
+#define X4_M26 "32(%[c])"
+#define X4_M25 "64(%[c])"
+#define X4_P2(i) "(3+" #i ")*32(%[c])"
+#define X4_P4(i) "(13+" #i ")*32(%[c])"
+#define X4_A24 "23*32(%[c])"
+
+#define X4_ROW_(i) "(" #i ")*32"
+#define X4_B(k) X4_ROW_(k) "(%[b])"
+#define X4_G19(k) X4_ROW_(k) "(%[s])"
+#define X4_G2(k) X4_ROW_(10+k) "(%[s])"
+#define X4_G38(k) X4_ROW_(20+k) "(%[s])"
+#define X4_H(i) X4_ROW_(30+i) "(%[s])"
+
+/* s[k] = 19 * b[k] */
+#define X4_MUL19(k)                       \
+  "vmovdqu " X4_B(k) ", %%ymm10\n"        \
+  "vpmuludq %%ymm15, %%ymm10, %%ymm11\n"  \
+  "vmovdqu %%ymm11, " X4_G19(k) "\n"
+
+/* s[k] = 19 * b[k], 2 * b[k], 38 * b[k] */
+#define X4_MUL19_2(k)                     \
+  "vmovdqu " X4_B(k) ", %%ymm10\n"        \
+  "vpmuludq %%ymm15, %%ymm10, %%ymm11\n"  \
+  "vpaddq %%ymm10, %%ymm10, %%ymm10\n"    \
+  "vmovdqu %%ymm11, " X4_G19(k) "\n"      \
+  "vpaddq %%ymm11, %%ymm11, %%ymm11\n"    \
+  "vmovdqu %%ymm10, " X4_G2(k) "\n"       \
+  "vmovdqu %%ymm11, " X4_G38(k) "\n"
+
+#define X4_TERM(j, t)                     \
+  "vpmuludq " t ", %%ymm" #j ", %%ymm11\n" \
+  "vpaddq %%ymm11, %%ymm10, %%ymm10\n"
+
+/* h[i] = sum(a[j] * t[j]) */
+#define X4_ROW(i, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9) \
+  "vpmuludq " t0 ", %%ymm0, %%ymm10\n"                    \
+  X4_TERM(1, t1) X4_TERM(2, t2) X4_TERM(3, t3)            \
+  X4_TERM(4, t4) X4_TERM(5, t5) X4_TERM(6, t6)            \
+  X4_TERM(7, t7) X4_TERM(8, t8) X4_TERM(9, t9)            \
+  "vmovdqu %%ymm10, " X4_H(i) "\n"
+
+/* h[j] += h[i] >> bits; h[i] &= mask */
+#define X4_CARRY(i, j, bits, mask)        \
+  "vpsrlq $" #bits ", %%ymm" #i ", %%ymm11\n" \
+  "vpaddq %%ymm11, %%ymm" #j ", %%ymm" #j "\n" \
+  "vpand %%ymm" #mask ", %%ymm" #i ", %%ymm" #i "\n"
+
+/* Carry a vector held in ymm0-ymm9 (masks in ymm13 and ymm14). */
+#define X4_REDUCE                         \
+  X4_CARRY(0, 1, 26, 13)                  \
+  X4_CARRY(4, 5, 26, 13)                  \
+  X4_CARRY(1, 2, 25, 14)                  \
+  X4_CARRY(5, 6, 25, 14)                  \
+  X4_CARRY(2, 3, 26, 13)                  \
+  X4_CARRY(6, 7, 26, 13)                  \
+  X4_CARRY(3, 4, 25, 14)                  \
+  X4_CARRY(7, 8, 25, 14)                  \
+  X4_CARRY(4, 5, 26, 13)                  \
+  X4_CARRY(8, 9, 26, 13)                  \
+  /* h[0] += (h[9] >> 25) * 19 */         \
+  "vpsrlq $25, %%ymm9, %%ymm11\n"         \
+  "vpand %%ymm14, %%ymm9, %%ymm9\n"       \
+  "vpsllq $4, %%ymm11, %%ymm12\n"         \
+  "vpaddq %%ymm11, %%ymm0, %%ymm0\n"      \
+  "vpaddq %%ymm11, %%ymm11, %%ymm11\n"    \
+  "vpaddq %%ymm12, %%ymm0, %%ymm0\n"      \
+  "vpaddq %%ymm11, %%ymm0, %%ymm0\n"      \
+  X4_CARRY(0, 1, 26, 13)
+
+#define X4_LOAD(i) "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm" #i "\n"
+#define X4_LOADH(i) "vmovdqu " X4_H(i) ", %%ymm" #i "\n"
+#define X4_STORE(i) "vmovdqu %%ymm" #i ", " X4_ROW_(i) "(%[r])\n"
+
+#define X4_LOAD_ALL(x)                    \
+  x(0) x(1) x(2) x(3) x(4)                \
+  x(5) x(6) x(7) x(8) x(9)
+
+#define X4_CLOBBER                        \
+  "xmm0", "xmm1", "xmm2", "xmm3",         \
+  "xmm4", "xmm5", "xmm6", "xmm7",         \
+  "xmm8", "xmm9", "xmm10", "xmm11",       \
+  "xmm12", "xmm13", "xmm14", "xmm15",     \
+  "cc", "memory"
+
+static void
+p25519x4_pack(uint64_t r[P25519X4_WORDS],
+              const uint64_t x[5],
+              const uint64_t y[5],
+              const uint64_t z[5],
+              const uint64_t t[5]) {
+  int i;
+
+  for (i = 0; i < 5; i++) {
+    r[i * 8 + 0] = x[i] & 0x3ffffff;
+    r[i * 8 + 1] = y[i] & 0x3ffffff;
+    r[i * 8 + 2] = z[i] & 0x3ffffff;
+    r[i * 8 + 3] = t[i] & 0x3ffffff;
+    r[i * 8 + 4] = x[i] >> 26;
+    r[i * 8 + 5] = y[i] >> 26;
+    r[i * 8 + 6] = z[i] >> 26;
+    r[i * 8 + 7] = t[i] >> 26;
+  }
+}
+
+static void
+p25519x4_unpack(uint64_t x[5],
+                uint64_t y[5],
+                uint64_t z[5],
+                uint64_t t[5],
+                const uint64_t a[P25519X4_WORDS]) {
+  int i;
+
+  for (i = 0; i < 5; i++) {
+    x[i] = a[i * 8 + 0] + (a[i * 8 + 4] << 26);
+    y[i] = a[i * 8 + 1] + (a[i * 8 + 5] << 26);
+    z[i] = a[i * 8 + 2] + (a[i * 8 + 6] << 26);
+    t[i] = a[i * 8 + 3] + (a[i * 8 + 7] << 26);
+  }
+}
+
+static void
+p25519x4_mul(uint64_t r[P25519X4_WORDS],
+             const uint64_t a[P25519X4_WORDS],
+             const uint64_t b[P25519X4_WORDS]) {
+  /* Schoolbook multiplication with the wrapped
+   * terms pre-multiplied by 19 (and by 2 where
+   * two odd limbs meet), followed by the usual
+   * interleaved carry chain.
+   */
+  uint64_t s[40 * 4];
+
+  __asm__ __volatile__(
+    "vmovdqu " X4_C19 ", %%ymm15\n"
+
+    X4_MUL19_2(1)
+    X4_MUL19(2)
+    X4_MUL19_2(3)
+    X4_MUL19(4)
+    X4_MUL19_2(5)
+    X4_MUL19(6)
+    X4_MUL19_2(7)
+    X4_MUL19(8)
+    X4_MUL19_2(9)
+
+    X4_LOAD_ALL(X4_LOAD)
+
+    X4_ROW(0, X4_B(0), X4_G38(9), X4_G19(8), X4_G38(7),
+              X4_G19(6), X4_G38(5), X4_G19(4), X4_G38(3),
+              X4_G19(2), X4_G38(1))
+    X4_ROW(1, X4_B(1), X4_B(0), X4_G19(9), X4_G19(8),
+              X4_G19(7), X4_G19(6), X4_G19(5), X4_G19(4),
+              X4_G19(3), X4_G19(2))
+    X4_ROW(2, X4_B(2), X4_G2(1), X4_B(0), X4_G38(9),
+              X4_G19(8), X4_G38(7), X4_G19(6), X4_G38(5),
+              X4_G19(4), X4_G38(3))
+    X4_ROW(3, X4_B(3), X4_B(2), X4_B(1), X4_B(0),
+              X4_G19(9), X4_G19(8), X4_G19(7), X4_G19(6),
+              X4_G19(5), X4_G19(4))
+    X4_ROW(4, X4_B(4), X4_G2(3), X4_B(2), X4_G2(1),
+              X4_B(0), X4_G38(9), X4_G19(8), X4_G38(7),
+              X4_G19(6), X4_G38(5))
+    X4_ROW(5, X4_B(5), X4_B(4), X4_B(3), X4_B(2),
+              X4_B(1), X4_B(0), X4_G19(9), X4_G19(8),
+              X4_G19(7), X4_G19(6))
+    X4_ROW(6, X4_B(6), X4_G2(5), X4_B(4), X4_G2(3),
+              X4_B(2), X4_G2(1), X4_B(0), X4_G38(9),
+              X4_G19(8), X4_G38(7))
+    X4_ROW(7, X4_B(7), X4_B(6), X4_B(5), X4_B(4),
+              X4_B(3), X4_B(2), X4_B(1), X4_B(0),
+              X4_G19(9), X4_G19(8))
+    X4_ROW(8, X4_B(8), X4_G2(7), X4_B(6), X4_G2(5),
+              X4_B(4), X4_G2(3), X4_B(2), X4_G2(1),
+              X4_B(0), X4_G38(9))
+    X4_ROW(9, X4_B(9), X4_B(8), X4_B(7), X4_B(6),
+              X4_B(5), X4_B(4), X4_B(3), X4_B(2),
+              X4_B(1), X4_B(0))
+
+    X4_LOAD_ALL(X4_LOADH)
+
+    "vmovdqu " X4_M26 ", %%ymm13\n"
+    "vmovdqu " X4_M25 ", %%ymm14\n"
+
+    X4_REDUCE
+
+    X4_LOAD_ALL(X4_STORE)
+
+    "vzeroupper\n"
+    :
+    : [r] "r" (r), [a] "r" (a), [b] "r" (b),
+      [s] "r" (s), [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* h[i] = 2 * sum(a[j] * t[j]) */
+#define X4_SQR_ODD(i, j0, t0, j1, t1, j2, t2, j3, t3, j4, t4) \
+  "vpmuludq " t0 ", %%ymm" #j0 ", %%ymm10\n"                  \
+  X4_TERM(j1, t1) X4_TERM(j2, t2)                             \
+  X4_TERM(j3, t3) X4_TERM(j4, t4)                             \
+  "vpaddq %%ymm10, %%ymm10, %%ymm10\n"                        \
+  "vmovdqu %%ymm10, " X4_H(i) "\n"
+
+/* h[i] = 2 * sum(a[j] * t[j]) + a[d0] * u0 + a[d1] * u1 */
+#define X4_SQR_EVEN(i, j0, t0, j1, t1, j2, t2, j3, t3,        \
+                       d0, u0, d1, u1)                        \
+  "vpmuludq " t0 ", %%ymm" #j0 ", %%ymm10\n"                  \
+  X4_TERM(j1, t1) X4_TERM(j2, t2) X4_TERM(j3, t3)             \
+  "vpmuludq " u0 ", %%ymm" #d0 ", %%ymm12\n"                  \
+  "vpmuludq " u1 ", %%ymm" #d1 ", %%ymm11\n"                  \
+  "vpaddq %%ymm10, %%ymm10, %%ymm10\n"                        \
+  "vpaddq %%ymm11, %%ymm12, %%ymm12\n"                        \
+  "vpaddq %%ymm12, %%ymm10, %%ymm10\n"                        \
+  "vmovdqu %%ymm10, " X4_H(i) "\n"
+
+static void
+p25519x4_sqr(uint64_t r[P25519X4_WORDS],
+             const uint64_t a[P25519X4_WORDS]) {
+  /* Same as p25519x4_mul with b = a, but each
+   * cross term is computed once and doubled.
+   */
+  uint64_t s[40 * 4];
+
+  __asm__ __volatile__(
+    "vmovdqu " X4_C19 ", %%ymm15\n"
+
+    X4_MUL19_2(1)
+    X4_MUL19_2(3)
+    X4_MUL19_2(5)
+    X4_MUL19(6)
+    X4_MUL19_2(7)
+    X4_MUL19(8)
+    X4_MUL19_2(9)
+
+    X4_LOAD_ALL(X4_LOAD)
+
+    X4_SQR_EVEN(0, 1, X4_G38(9), 2, X4_G19(8), 3, X4_G38(7), 4, X4_G19(6),
+                   0, X4_B(0), 5, X4_G38(5))
+    X4_SQR_ODD(1, 0, X4_B(1), 2, X4_G19(9), 3, X4_G19(8),
+                  4, X4_G19(7), 5, X4_G19(6))
+    X4_SQR_EVEN(2, 0, X4_B(2), 3, X4_G38(9), 4, X4_G19(8), 5, X4_G38(7),
+                   1, X4_G2(1), 6, X4_G19(6))
+    X4_SQR_ODD(3, 0, X4_B(3), 1, X4_B(2), 4, X4_G19(9),
+                  5, X4_G19(8), 6, X4_G19(7))
+    X4_SQR_EVEN(4, 0, X4_B(4), 1, X4_G2(3), 5, X4_G38(9), 6, X4_G19(8),
+                   2, X4_B(2), 7, X4_G38(7))
+    X4_SQR_ODD(5, 0, X4_B(5), 1, X4_B(4), 2, X4_B(3),
+                  6, X4_G19(9), 7, X4_G19(8))
+    X4_SQR_EVEN(6, 0, X4_B(6), 1, X4_G2(5), 2, X4_B(4), 7, X4_G38(9),
+                   3, X4_G2(3), 8, X4_G19(8))
+    X4_SQR_ODD(7, 0, X4_B(7), 1, X4_B(6), 2, X4_B(5),
+                  3, X4_B(4), 8, X4_G19(9))
+    X4_SQR_EVEN(8, 0, X4_B(8), 1, X4_G2(7), 2, X4_B(6), 3, X4_G2(5),
+                   4, X4_B(4), 9, X4_G38(9))
+    X4_SQR_ODD(9, 0, X4_B(9), 1, X4_B(8), 2, X4_B(7),
+                  3, X4_B(6), 4, X4_B(5))
+
+    X4_LOAD_ALL(X4_LOADH)
+
+    "vmovdqu " X4_M26 ", %%ymm13\n"
+    "vmovdqu " X4_M25 ", %%ymm14\n"
+
+    X4_REDUCE
+
+    X4_LOAD_ALL(X4_STORE)
+
+    "vzeroupper\n"
+    :
+    : [r] "r" (r), [a] "r" (a), [b] "r" (a),
+      [s] "r" (s), [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* (X, Y, Z, T) -> (X, Y, Z, X + Y) */
+#define X4_DBL_PRE_ROW(i)                           \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm0\n"          \
+  "vpbroadcastq " X4_ROW_(i) "+0(%[a]), %%ymm1\n"   \
+  "vpbroadcastq " X4_ROW_(i) "+8(%[a]), %%ymm2\n"   \
+  "vpaddq %%ymm2, %%ymm1, %%ymm1\n"                 \
+  "vpblendd $0xc0, %%ymm1, %%ymm0, %%ymm0\n"        \
+  "vmovdqu %%ymm0, " X4_ROW_(i) "(%[r])\n"
+
+static void
+p25519x4_dbl_pre(uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS]) {
+  __asm__ __volatile__(
+    X4_LOAD_ALL(X4_DBL_PRE_ROW)
+
+    "vzeroupper\n"
+    :
+    : [r] "r" (r), [a] "r" (a)
+    : X4_CLOBBER
+  );
+}
+
+/* (X, Y, Z, T) -> (Y - X, Y + X, Z, T) (biased by 2 * p) */
+#define X4_ADD_PRE_ROW(i)                           \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm0\n"          \
+  "vpbroadcastq " X4_ROW_(i) "+0(%[a]), %%ymm1\n"   \
+  "vpbroadcastq " X4_ROW_(i) "+8(%[a]), %%ymm2\n"   \
+  "vpaddq " X4_P2(i) ", %%ymm2, %%ymm3\n"           \
+  "vpaddq %%ymm2, %%ymm1, %%ymm2\n"                 \
+  "vpsubq %%ymm1, %%ymm3, %%ymm3\n"                 \
+  "vpblendd $0x03, %%ymm3, %%ymm0, %%ymm0\n"        \
+  "vpblendd $0x0c, %%ymm2, %%ymm0, %%ymm0\n"        \
+  "vmovdqu %%ymm0, " X4_ROW_(i) "(%[r])\n"
+
+static void
+p25519x4_add_pre(uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS]) {
+  __asm__ __volatile__(
+    X4_LOAD_ALL(X4_ADD_PRE_ROW)
+
+    "vzeroupper\n"
+    :
+    : [r] "r" (r), [a] "r" (a),
+      [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* (A, B, ZZ, S) -> (E, G, F, H) (biased by 4 * p) */
+#define X4_DBL_ROW(i)                               \
+  "vpbroadcastq " X4_ROW_(i) "+0(%[a]), %%ymm10\n"   \
+  "vpbroadcastq " X4_ROW_(i) "+8(%[a]), %%ymm11\n"   \
+  "vpbroadcastq " X4_ROW_(i) "+16(%[a]), %%ymm12\n"  \
+  "vpbroadcastq " X4_ROW_(i) "+24(%[a]), %%ymm13\n"  \
+  "vpsubq %%ymm11, %%ymm15, %%ymm14\n"              \
+  "vpaddq %%ymm12, %%ymm12, %%ymm12\n"              \
+  "vpblendd $0x3c, %%ymm11, %%ymm14, %%ymm11\n"     \
+  "vpblendd $0x30, %%ymm12, %%ymm15, %%ymm12\n"     \
+  "vpblendd $0x03, %%ymm13, %%ymm15, %%ymm13\n"     \
+  "vpaddq " X4_P4(i) ", %%ymm11, %%ymm" #i "\n"     \
+  "vpsubq %%ymm10, %%ymm" #i ", %%ymm" #i "\n"      \
+  "vpsubq %%ymm12, %%ymm" #i ", %%ymm" #i "\n"      \
+  "vpaddq %%ymm13, %%ymm" #i ", %%ymm" #i "\n"
+
+/* l = (E, G, F, E), r = (F, H, G, H) */
+#define X4_DBL_OUT(i)                               \
+  "vpermq $0x24, %%ymm" #i ", %%ymm10\n"            \
+  "vpermq $0xde, %%ymm" #i ", %%ymm11\n"            \
+  "vmovdqu %%ymm10, " X4_ROW_(i) "(%[l])\n"         \
+  "vmovdqu %%ymm11, " X4_ROW_(i) "(%[r])\n"
+
+static void
+p25519x4_dbl_mid(uint64_t l[P25519X4_WORDS],
+                 uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS]) {
+  /* Input: (X^2, Y^2, Z^2, (X + Y)^2).
+   *
+   * With a = -1 the doubling formula needs:
+   *
+   *   E = (X + Y)^2 - A - B
+   *   G = B - A
+   *   F = G - 2 * Z^2
+   *   H = -A - B
+   *
+   * These are computed lane-wise and carried so
+   * that the final products fit the 32-bit lanes.
+   */
+  __asm__ __volatile__(
+    "vpxor %%ymm15, %%ymm15, %%ymm15\n"
+
+    X4_LOAD_ALL(X4_DBL_ROW)
+
+    "vmovdqu " X4_M26 ", %%ymm13\n"
+    "vmovdqu " X4_M25 ", %%ymm14\n"
+
+    X4_REDUCE
+
+    X4_LOAD_ALL(X4_DBL_OUT)
+
+    "vzeroupper\n"
+    :
+    : [l] "r" (l), [r] "r" (r), [a] "r" (a),
+      [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* l = (E, G, F, E), r = (F, H, G, H) */
+#define X4_ADD_ROW(i)                               \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm0\n"          \
+  "vpermq $0xb1, %%ymm0, %%ymm1\n"                  \
+  "vpaddq %%ymm1, %%ymm0, %%ymm2\n"                 \
+  "vpaddq " X4_P2(i) ", %%ymm1, %%ymm3\n"           \
+  "vpsubq %%ymm0, %%ymm3, %%ymm3\n"                 \
+  "vpermq $0x30, %%ymm3, %%ymm4\n"                  \
+  "vpermq $0xaa, %%ymm2, %%ymm5\n"                  \
+  "vpermq $0xff, %%ymm3, %%ymm6\n"                  \
+  "vpermq $0x20, %%ymm2, %%ymm7\n"                  \
+  "vpblendd $0x0c, %%ymm5, %%ymm4, %%ymm4\n"        \
+  "vpblendd $0xfc, %%ymm7, %%ymm6, %%ymm6\n"        \
+  "vmovdqu %%ymm4, " X4_ROW_(i) "(%[l])\n"          \
+  "vmovdqu %%ymm6, " X4_ROW_(i) "(%[r])\n"
+
+static void
+p25519x4_add_mid(uint64_t l[P25519X4_WORDS],
+                 uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS]) {
+  /* Input: (A, B, D, C).
+   *
+   * With a = -1 the addition formula needs:
+   *
+   *   E = B - A
+   *   F = D - C
+   *   G = D + C
+   *   H = B + A
+   *
+   * The inputs are carried, so no further
+   * reduction is necessary here.
+   */
+  __asm__ __volatile__(
+    X4_LOAD_ALL(X4_ADD_ROW)
+
+    "vzeroupper\n"
+    :
+    : [l] "r" (l), [r] "r" (r), [a] "r" (a),
+      [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* l = a + b, r = a - b (biased by 2 * p) */
+#define X4_ADD_SUB_ROW(i)                           \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm0\n"          \
+  "vmovdqu " X4_ROW_(i) "(%[b]), %%ymm1\n"          \
+  "vpaddq %%ymm1, %%ymm0, %%ymm2\n"                 \
+  "vpaddq " X4_P2(i) ", %%ymm0, %%ymm3\n"           \
+  "vpsubq %%ymm1, %%ymm3, %%ymm3\n"                 \
+  "vmovdqu %%ymm2, " X4_ROW_(i) "(%[l])\n"          \
+  "vmovdqu %%ymm3, " X4_ROW_(i) "(%[r])\n"
+
+static void
+p25519x4_add_sub(uint64_t l[P25519X4_WORDS],
+                 uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS],
+                 const uint64_t b[P25519X4_WORDS]) {
+  /* Both inputs must be carried. */
+  __asm__ __volatile__(
+    X4_LOAD_ALL(X4_ADD_SUB_ROW)
+
+    "vzeroupper\n"
+    :
+    : [l] "r" (l), [r] "r" (r), [a] "r" (a), [b] "r" (b),
+      [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* l = a - b (biased by 2 * p), h = b + a24 * l */
+#define X4_A24_ROW(i)                               \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm10\n"         \
+  "vmovdqu " X4_ROW_(i) "(%[b]), %%ymm11\n"         \
+  "vpaddq " X4_P2(i) ", %%ymm10, %%ymm10\n"         \
+  "vpsubq %%ymm11, %%ymm10, %%ymm10\n"              \
+  "vmovdqu %%ymm10, " X4_ROW_(i) "(%[l])\n"         \
+  "vpmuludq %%ymm15, %%ymm10, %%ymm" #i "\n"        \
+  "vpaddq %%ymm11, %%ymm" #i ", %%ymm" #i "\n"
+
+static void
+p25519x4_mul_a24(uint64_t l[P25519X4_WORDS],
+                 uint64_t r[P25519X4_WORDS],
+                 const uint64_t a[P25519X4_WORDS],
+                 const uint64_t b[P25519X4_WORDS]) {
+  /* Input: (AA, BB) from the montgomery ladder.
+   *
+   * Computes E = AA - BB and BB + a24 * E, where
+   * a24 = (486662 + 2) / 4. The second output is
+   * carried; the first is left as is.
+   */
+  __asm__ __volatile__(
+    "vmovdqu " X4_A24 ", %%ymm15\n"
+
+    X4_LOAD_ALL(X4_A24_ROW)
+
+    "vmovdqu " X4_M26 ", %%ymm13\n"
+    "vmovdqu " X4_M25 ", %%ymm14\n"
+
+    X4_REDUCE
+
+    X4_LOAD_ALL(X4_STORE)
+
+    "vzeroupper\n"
+    :
+    : [l] "r" (l), [r] "r" (r), [a] "r" (a), [b] "r" (b),
+      [c] "r" (p25519x4_consts)
+    : X4_CLOBBER
+  );
+}
+
+/* t = (a ^ b) & m, a ^= t, b ^= t */
+#define X4_SWAP_ROW(i)                              \
+  "vmovdqu " X4_ROW_(i) "(%[a]), %%ymm0\n"          \
+  "vmovdqu " X4_ROW_(i) "(%[b]), %%ymm1\n"          \
+  "vpxor %%ymm1, %%ymm0, %%ymm2\n"                  \
+  "vpand %%ymm15, %%ymm2, %%ymm2\n"                 \
+  "vpxor %%ymm2, %%ymm0, %%ymm0\n"                  \
+  "vpxor %%ymm2, %%ymm1, %%ymm1\n"                  \
+  "vmovdqu %%ymm0, " X4_ROW_(i) "(%[a])\n"          \
+  "vmovdqu %%ymm1, " X4_ROW_(i) "(%[b])\n"
+
+static void
+p25519x4_swap(uint64_t a[P25519X4_WORDS],
+              uint64_t b[P25519X4_WORDS],
+              const uint64_t mask[4]) {
+  /* Lane-wise conditional swap (constant time).
+   * Each mask word must be zero or all ones.
+   */
+  __asm__ __volatile__(
+    "vmovdqu (%[m]), %%ymm15\n"
+
+    X4_LOAD_ALL(X4_SWAP_ROW)
+
+    "vzeroupper\n"
+    :
+    : [a] "r" (a), [b] "r" (b), [m] "r" (mask)
+    : X4_CLOBBER
+  );
+}
+
+static void
+p25519x4_swap_neg(uint64_t r[P25519X4_WORDS],
+                  const uint64_t a[P25519X4_WORDS]) {
+  /* (U, V, W, S) -> (V, U, W, -S) */
+  int i;
+
+  for (i = 0; i < 10; i++) {
+    uint64_t u = a[i * 4 + 0];
+    uint64_t v = a[i * 4 + 1];
+
+    r[i * 4 + 0] = v;
+    r[i * 4 + 1] = u;
+    r[i * 4 + 2] = a[i * 4 + 2];
+    r[i * 4 + 3] = p25519x4_consts[3 + i][0] - a[i * 4 + 3];
+  }
+}
+
+#undef X4_C19
+#undef X4_M26
+#undef X4_M25
+#undef X4_P2
+#undef X4_P4
+#undef X4_A24
+#undef X4_ROW_
+#undef X4_B
+#undef X4_G19
+#undef X4_G2
+#undef X4_G38
+#undef X4_H
+#undef X4_MUL19
+#undef X4_MUL19_2
+#undef X4_TERM
+#undef X4_ROW
+#undef X4_SQR_ODD
+#undef X4_SQR_EVEN
+#undef X4_CARRY
+#undef X4_REDUCE
+#undef X4_LOAD
+#undef X4_LOADH
+#undef X4_STORE
+#undef X4_LOAD_ALL
+#undef X4_CLOBBER
+#undef X4_DBL_PRE_ROW
+#undef X4_ADD_PRE_ROW
+#undef X4_DBL_ROW
+#undef X4_DBL_OUT
+#undef X4_ADD_ROW
+#undef X4_ADD_SUB_ROW
+#undef X4_A24_ROW
+#undef X4_SWAP_ROW
+
+#endif /* TORSION_HAVE_ASM_X64 && TORSION_HAVE_INT128 */
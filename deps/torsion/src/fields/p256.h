@@ -22,6 +22,28 @@ typedef p256_fe_word_t p256_fe_t[P256_FIELD_WORDS];
 #define p256_fe_mul fiat_p256_mul
 #define p256_fe_sqr fiat_p256_square
 
+#ifdef TORSION_HAVE_ASM_ADX
+static const uint64_t p256_adx_p[4] = {
+  UINT64_C(0xffffffffffffffff), UINT64_C(0x00000000ffffffff),
+  UINT64_C(0x0000000000000000), UINT64_C(0xffffffff00000001)
+};
+
+static const uint64_t p256_adx_m = UINT64_C(0x0000000000000001);
+
+static void
+p256_fe_mul_adx(p256_fe_t out, const p256_fe_t a, const p256_fe_t b) {
+  adx_mont4_mul(out, a, b, p256_adx_p, &p256_adx_m);
+}
+
+static void
+p256_fe_sqr_adx(p256_fe_t out, const p256_fe_t a) {
+  adx_mont4_mul(out, a, a, p256_adx_p, &p256_adx_m);
+}
+#else
+#define p256_fe_mul_adx NULL
+#define p256_fe_sqr_adx NULL
+#endif
+
 static void
 p256_fe_set(p256_fe_t out, const p256_fe_t in) {
   out[0] = in[0];
@@ -0,0 +1,419 @@
+/*!
+ * scalar_64.h - 4x64 scalar arithmetic for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ *
+ * Resources:
+ *   https://cacr.uwaterloo.ca/hac/about/chap14.pdf
+ *   https://github.com/bitcoin-core/secp256k1/blob/master/src/scalar_4x64_impl.h
+ */
+
+/*
+ * Fixed-width arithmetic for group orders which
+ * fit in four 64-bit limbs (secp256k1, P-256,
+ * P-224, Ed25519 and Ed1174).
+ *
+ * Reduction is Barrett's with b = 2^64 and k = 4
+ * (HAC Algorithm 14.42), using mu = 2^512 / n.
+ * This is simply the generic reduction constant
+ * of the scalar field shifted down by two limbs,
+ * so no extra precomputation is necessary.
+ *
+ * Products are accumulated column by column in a
+ * three word accumulator (c0, c1, c2), in the
+ * style of libsecp256k1. Everything here runs in
+ * constant time.
+ */
+
+#ifdef TORSION_HAVE_INT128
+
+#define TORSION_HAVE_SCALAR_4X64
+
+typedef torsion_uint128_t sc4x64_wide_t;
+
+/* (c0, c1, c2) += a * b */
+#define SC4_MULADD(a, b) do {                   \
+  sc4x64_wide_t w_ = (sc4x64_wide_t)(a) * (b);  \
+  uint64_t l_ = (uint64_t)w_;                   \
+  uint64_t h_ = (uint64_t)(w_ >> 64);           \
+                                                \
+  c0 += l_;                                     \
+  h_ += (c0 < l_);                              \
+  c1 += h_;                                     \
+  c2 += (c1 < h_);                              \
+} while (0)
+
+/* (c0, c1, c2) += 2 * a * b */
+#define SC4_MULADD2(a, b) do {                  \
+  sc4x64_wide_t w_ = (sc4x64_wide_t)(a) * (b);  \
+  uint64_t l_ = (uint64_t)w_;                   \
+  uint64_t h_ = (uint64_t)(w_ >> 64);           \
+                                                \
+  c2 += h_ >> 63;                               \
+  h_ = (h_ << 1) | (l_ >> 63);                  \
+  l_ <<= 1;                                     \
+  c0 += l_;                                     \
+  h_ += (c0 < l_);                              \
+  c1 += h_;                                     \
+  c2 += (c1 < h_);                              \
+} while (0)
+
+/* r = c0, (c0, c1, c2) >>= 64 */
+#define SC4_EXTRACT(r) do {                     \
+  (r) = c0;                                     \
+  c0 = c1;                                      \
+  c1 = c2;                                      \
+  c2 = 0;                                       \
+} while (0)
+
+/* r = x - y - b, b = borrow */
+#define SC4_SUBB(r, x, y) do {                  \
+  sc4x64_wide_t w_ = (sc4x64_wide_t)(x) - (y) - b; \
+  (r) = (uint64_t)w_;                           \
+  b = (uint64_t)(w_ >> 64) & 1;                 \
+} while (0)
+
+/* r = x + y + c, c = carry */
+#define SC4_ADDC(r, x, y) do {                  \
+  sc4x64_wide_t w_ = (sc4x64_wide_t)(x) + (y) + c; \
+  (r) = (uint64_t)w_;                           \
+  c = (uint64_t)(w_ >> 64);                     \
+} while (0)
+
+static void
+sc4x64_mul_wide(uint64_t z[8], const uint64_t a[4], const uint64_t b[4]) {
+  uint64_t c0 = 0, c1 = 0, c2 = 0;
+
+  SC4_MULADD(a[0], b[0]);
+  SC4_EXTRACT(z[0]);
+
+  SC4_MULADD(a[0], b[1]);
+  SC4_MULADD(a[1], b[0]);
+  SC4_EXTRACT(z[1]);
+
+  SC4_MULADD(a[0], b[2]);
+  SC4_MULADD(a[1], b[1]);
+  SC4_MULADD(a[2], b[0]);
+  SC4_EXTRACT(z[2]);
+
+  SC4_MULADD(a[0], b[3]);
+  SC4_MULADD(a[1], b[2]);
+  SC4_MULADD(a[2], b[1]);
+  SC4_MULADD(a[3], b[0]);
+  SC4_EXTRACT(z[3]);
+
+  SC4_MULADD(a[1], b[3]);
+  SC4_MULADD(a[2], b[2]);
+  SC4_MULADD(a[3], b[1]);
+  SC4_EXTRACT(z[4]);
+
+  SC4_MULADD(a[2], b[3]);
+  SC4_MULADD(a[3], b[2]);
+  SC4_EXTRACT(z[5]);
+
+  SC4_MULADD(a[3], b[3]);
+  SC4_EXTRACT(z[6]);
+
+  z[7] = c0;
+}
+
+static void
+sc4x64_sqr_wide(uint64_t z[8], const uint64_t a[4]) {
+  uint64_t c0 = 0, c1 = 0, c2 = 0;
+
+  SC4_MULADD(a[0], a[0]);
+  SC4_EXTRACT(z[0]);
+
+  SC4_MULADD2(a[0], a[1]);
+  SC4_EXTRACT(z[1]);
+
+  SC4_MULADD2(a[0], a[2]);
+  SC4_MULADD(a[1], a[1]);
+  SC4_EXTRACT(z[2]);
+
+  SC4_MULADD2(a[0], a[3]);
+  SC4_MULADD2(a[1], a[2]);
+  SC4_EXTRACT(z[3]);
+
+  SC4_MULADD2(a[1], a[3]);
+  SC4_MULADD(a[2], a[2]);
+  SC4_EXTRACT(z[4]);
+
+  SC4_MULADD2(a[2], a[3]);
+  SC4_EXTRACT(z[5]);
+
+  SC4_MULADD(a[3], a[3]);
+  SC4_EXTRACT(z[6]);
+
+  z[7] = c0;
+}
+
+static TORSION_INLINE void
+sc4x64_sub_cond(uint64_t z[5], const uint64_t n[4]) {
+  /* z = z - n if z >= n */
+  uint64_t t[5], m;
+  uint64_t b = 0;
+
+  SC4_SUBB(t[0], z[0], n[0]);
+  SC4_SUBB(t[1], z[1], n[1]);
+  SC4_SUBB(t[2], z[2], n[2]);
+  SC4_SUBB(t[3], z[3], n[3]);
+  SC4_SUBB(t[4], z[4], 0);
+
+  m = b - 1;
+
+  z[0] = (z[0] & ~m) | (t[0] & m);
+  z[1] = (z[1] & ~m) | (t[1] & m);
+  z[2] = (z[2] & ~m) | (t[2] & m);
+  z[3] = (z[3] & ~m) | (t[3] & m);
+  z[4] = (z[4] & ~m) | (t[4] & m);
+}
+
+static void
+sc4x64_reduce(uint64_t r[4],
+              const uint64_t x[8],
+              const uint64_t n[4],
+              const uint64_t mu[5]) {
+  /* Barrett reduction of a 512 bit integer.
+   *
+   * [HAC] Algorithm 14.42, Page 603, Section 14.3.3.
+   */
+  const uint64_t *h = x + 3;
+  uint64_t c0 = 0, c1 = 0, c2 = 0;
+  uint64_t q[5], t[5], z[5], d;
+  uint64_t b = 0;
+
+  /* q = ((x >> 192) * mu) >> 320 */
+  SC4_MULADD(h[0], mu[0]);
+  SC4_EXTRACT(d);
+
+  SC4_MULADD(h[0], mu[1]);
+  SC4_MULADD(h[1], mu[0]);
+  SC4_EXTRACT(d);
+
+  SC4_MULADD(h[0], mu[2]);
+  SC4_MULADD(h[1], mu[1]);
+  SC4_MULADD(h[2], mu[0]);
+  SC4_EXTRACT(d);
+
+  SC4_MULADD(h[0], mu[3]);
+  SC4_MULADD(h[1], mu[2]);
+  SC4_MULADD(h[2], mu[1]);
+  SC4_MULADD(h[3], mu[0]);
+  SC4_EXTRACT(d);
+
+  SC4_MULADD(h[0], mu[4]);
+  SC4_MULADD(h[1], mu[3]);
+  SC4_MULADD(h[2], mu[2]);
+  SC4_MULADD(h[3], mu[1]);
+  SC4_MULADD(h[4], mu[0]);
+  SC4_EXTRACT(d);
+
+  SC4_MULADD(h[1], mu[4]);
+  SC4_MULADD(h[2], mu[3]);
+  SC4_MULADD(h[3], mu[2]);
+  SC4_MULADD(h[4], mu[1]);
+  SC4_EXTRACT(q[0]);
+
+  SC4_MULADD(h[2], mu[4]);
+  SC4_MULADD(h[3], mu[3]);
+  SC4_MULADD(h[4], mu[2]);
+  SC4_EXTRACT(q[1]);
+
+  SC4_MULADD(h[3], mu[4]);
+  SC4_MULADD(h[4], mu[3]);
+  SC4_EXTRACT(q[2]);
+
+  SC4_MULADD(h[4], mu[4]);
+  SC4_EXTRACT(q[3]);
+
+  q[4] = c0;
+
+  /* t = (q * n) mod 2^320 */
+  c0 = 0;
+  c1 = 0;
+  c2 = 0;
+
+  SC4_MULADD(q[0], n[0]);
+  SC4_EXTRACT(t[0]);
+
+  SC4_MULADD(q[0], n[1]);
+  SC4_MULADD(q[1], n[0]);
+  SC4_EXTRACT(t[1]);
+
+  SC4_MULADD(q[0], n[2]);
+  SC4_MULADD(q[1], n[1]);
+  SC4_MULADD(q[2], n[0]);
+  SC4_EXTRACT(t[2]);
+
+  SC4_MULADD(q[0], n[3]);
+  SC4_MULADD(q[1], n[2]);
+  SC4_MULADD(q[2], n[1]);
+  SC4_MULADD(q[3], n[0]);
+  SC4_EXTRACT(t[3]);
+
+  SC4_MULADD(q[1], n[3]);
+  SC4_MULADD(q[2], n[2]);
+  SC4_MULADD(q[3], n[1]);
+  SC4_MULADD(q[4], n[0]);
+
+  t[4] = c0;
+
+  /* z = (x - t) mod 2^320 */
+  SC4_SUBB(z[0], x[0], t[0]);
+  SC4_SUBB(z[1], x[1], t[1]);
+  SC4_SUBB(z[2], x[2], t[2]);
+  SC4_SUBB(z[3], x[3], t[3]);
+  SC4_SUBB(z[4], x[4], t[4]);
+
+  (void)d;
+
+  /* z < 3 * n */
+  sc4x64_sub_cond(z, n);
+  sc4x64_sub_cond(z, n);
+
+  r[0] = z[0];
+  r[1] = z[1];
+  r[2] = z[2];
+  r[3] = z[3];
+}
+
+static void
+sc4x64_mul(uint64_t r[4],
+           const uint64_t a[4],
+           const uint64_t b[4],
+           const uint64_t n[4],
+           const uint64_t mu[5]) {
+  uint64_t z[8];
+
+  sc4x64_mul_wide(z, a, b);
+  sc4x64_reduce(r, z, n, mu);
+}
+
+static void
+sc4x64_sqr(uint64_t r[4],
+           const uint64_t a[4],
+           const uint64_t n[4],
+           const uint64_t mu[5]) {
+  uint64_t z[8];
+
+  sc4x64_sqr_wide(z, a);
+  sc4x64_reduce(r, z, n, mu);
+}
+
+static void
+sc4x64_add(uint64_t r[4],
+           const uint64_t a[4],
+           const uint64_t b[4],
+           const uint64_t n[4]) {
+  /* r = a + b mod n (a, b < n) */
+  uint64_t z[5];
+  uint64_t c = 0;
+
+  SC4_ADDC(z[0], a[0], b[0]);
+  SC4_ADDC(z[1], a[1], b[1]);
+  SC4_ADDC(z[2], a[2], b[2]);
+  SC4_ADDC(z[3], a[3], b[3]);
+
+  z[4] = c;
+
+  sc4x64_sub_cond(z, n);
+
+  r[0] = z[0];
+  r[1] = z[1];
+  r[2] = z[2];
+  r[3] = z[3];
+}
+
+static void
+sc4x64_mulshift(uint64_t r[4],
+                const uint64_t a[4],
+                const uint64_t b[4],
+                size_t shift) {
+  /* r = round((a * b) >> shift) (256 <= shift < 512) */
+  size_t limbs = shift / 64;
+  size_t left = shift % 64;
+  uint64_t z[12], bit, c;
+  size_t i;
+
+  sc4x64_mul_wide(z, a, b);
+
+  z[8] = 0;
+  z[9] = 0;
+  z[10] = 0;
+  z[11] = 0;
+
+  bit = (z[(shift - 1) / 64] >> ((shift - 1) % 64)) & 1;
+
+  for (i = 0; i < 4; i++) {
+    if (left > 0)
+      r[i] = (z[limbs + i] >> left) | (z[limbs + i + 1] << (64 - left));
+    else
+      r[i] = z[limbs + i];
+  }
+
+  c = bit;
+
+  SC4_ADDC(r[0], r[0], 0);
+  SC4_ADDC(r[1], r[1], 0);
+  SC4_ADDC(r[2], r[2], 0);
+  SC4_ADDC(r[3], r[3], 0);
+}
+
+static TORSION_INLINE uint64_t
+sc4x64_get_bits(const uint64_t k[4], size_t pos, size_t width) {
+  /* Same as mpn_get_bits, with a fixed length. */
+  size_t index = pos / 64;
+  size_t shift = pos % 64;
+  uint64_t bits;
+
+  if (index >= 4)
+    return 0;
+
+  bits = (k[index] >> shift) & ((UINT64_C(1) << width) - 1);
+
+  if (shift + width > 64 && index + 1 < 4) {
+    size_t more = shift + width - 64;
+    uint64_t next = k[index + 1] & ((UINT64_C(1) << more) - 1);
+
+    bits |= next << (64 - shift);
+  }
+
+  return bits;
+}
+
+static TORSION_INLINE size_t
+sc4x64_scan(const uint64_t k[4], size_t pos, int bit) {
+  /* Position of the first bit not equal to `bit`
+   * at or after `pos` (bits above 255 are zero).
+   * Variable time; used for NAF recoding.
+   */
+  uint64_t mask = -(uint64_t)bit;
+  size_t index = pos / 64;
+  uint64_t w;
+
+  if (index >= 4)
+    return pos;
+
+  w = (k[index] ^ mask) >> (pos % 64);
+
+  if (w != 0)
+    return pos + __builtin_ctzll(w);
+
+  for (index++; index < 4; index++) {
+    w = k[index] ^ mask;
+
+    if (w != 0)
+      return index * 64 + __builtin_ctzll(w);
+  }
+
+  return 256;
+}
+
+#undef SC4_MULADD
+#undef SC4_MULADD2
+#undef SC4_EXTRACT
+#undef SC4_SUBB
+#undef SC4_ADDC
+
+#endif /* TORSION_HAVE_INT128 */
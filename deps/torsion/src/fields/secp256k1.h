@@ -48,6 +48,30 @@ typedef secp256k1_fe_word_t secp256k1_fe_t[SECP256K1_FIELD_WORDS];
 #define secp256k1_fe_sqr fiat_secp256k1_square
 #define secp256k1_fe_nonzero fiat_secp256k1_nonzero
 
+#if defined(TORSION_HAVE_ASM_ADX) && !defined(TORSION_USE_LIBSECP256K1)
+static const uint64_t secp256k1_adx_p[4] = {
+  UINT64_C(0xfffffffefffffc2f), UINT64_C(0xffffffffffffffff),
+  UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff)
+};
+
+static const uint64_t secp256k1_adx_m = UINT64_C(0xd838091dd2253531);
+
+static void
+secp256k1_fe_mul_adx(secp256k1_fe_t out,
+                     const secp256k1_fe_t a,
+                     const secp256k1_fe_t b) {
+  adx_mont4_mul(out, a, b, secp256k1_adx_p, &secp256k1_adx_m);
+}
+
+static void
+secp256k1_fe_sqr_adx(secp256k1_fe_t out, const secp256k1_fe_t a) {
+  adx_mont4_mul(out, a, a, secp256k1_adx_p, &secp256k1_adx_m);
+}
+#else
+#define secp256k1_fe_mul_adx NULL
+#define secp256k1_fe_sqr_adx NULL
+#endif
+
 static void
 secp256k1_fe_set(secp256k1_fe_t out, const secp256k1_fe_t in) {
 #ifdef TORSION_USE_LIBSECP256K1
@@ -0,0 +1,1456 @@
+/*!
+ * group.h - group law templates for libtorsion
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/libtorsion
+ */
+
+/*
+ * Group Law Template
+ *
+ * Included by ecc.c once per field backend. The
+ * generic instance goes through the prime_field_t
+ * function pointers, while the specialized ones
+ * call the field backend directly and are free
+ * to be inlined by the compiler.
+ *
+ * Parameters:
+ *
+ *   GROUP_NAME(name) - name of the instantiated function.
+ *   GROUP_WEI / GROUP_EDWARDS - which group law to emit.
+ *   GROUP_MONT - emit the montgomery ladder instead.
+ *   GROUP_DBLJ, GROUP_DBL0, GROUP_DBL3 - doubling formulas (wei).
+ *   GROUP_ADD_A, GROUP_ADD_M1 - addition formulas (edwards).
+ *   GROUP_ZERO_A - whether a = 0 (wei).
+ *   GROUP_MUL_A(r, x) - multiply by the curve's `a` (r != x).
+ *   GROUP_MUL_A24(r, x) - multiply by `(a + 2) / 4` (mont).
+ *   GROUP_MUL - also emit the hot multiplication loops, calling
+ *               the group law above directly (one doubling
+ *               formula for wei, a = -1 for edwards).
+ *   GROUP_ENDO - the curve has an endomorphism (wei).
+ *   FE_ADD, FE_SUB, FE_NEG, FE_MUL, FE_SQR,
+ *   FE_SELECT, FE_SET - field arithmetic.
+ *
+ * All parameters are undefined at the end.
+ */
+
+#ifdef GROUP_WEI
+
+/*
+ * Jacobian Point
+ */
+
+#ifdef GROUP_DBLJ
+static void
+GROUP_NAME(jge_dblj)(const wei_t *ec, jge_t *r, const jge_t *p) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#doubling-dbl-1998-cmo-2
+   * 3M + 6S + 4A + 1*a + 2*2 + 1*3 + 1*4 + 1*8
+   */
+  fe_t xx, yy, zz, s, m, t;
+
+  /* XX = X1^2 */
+  FE_SQR(xx, p->x);
+
+  /* YY = Y1^2 */
+  FE_SQR(yy, p->y);
+
+  /* ZZ = Z1^2 */
+  FE_SQR(zz, p->z);
+
+  /* S = 4 * X1 * YY */
+  FE_MUL(s, p->x, yy);
+  FE_ADD(s, s, s);
+  FE_ADD(s, s, s);
+
+  /* M = 3 * XX + a * ZZ^2 */
+  FE_ADD(m, xx, xx);
+  FE_ADD(m, m, xx);
+  FE_SQR(t, zz);
+  FE_MUL(t, t, ec->a);
+  FE_ADD(m, m, t);
+
+  /* T = M^2 - 2 * S */
+  FE_SQR(t, m);
+  FE_SUB(t, t, s);
+  FE_SUB(t, t, s);
+
+  /* Z3 = 2 * Y1 * Z1 */
+  FE_MUL(r->z, p->z, p->y);
+  FE_ADD(r->z, r->z, r->z);
+
+  /* X3 = T */
+  FE_SET(r->x, t);
+
+  /* Y3 = M * (S - T) - 8 * YY^2 */
+  FE_SUB(xx, s, t);
+  FE_SQR(zz, yy);
+  FE_ADD(zz, zz, zz);
+  FE_ADD(zz, zz, zz);
+  FE_ADD(zz, zz, zz);
+  FE_MUL(r->y, m, xx);
+  FE_SUB(r->y, r->y, zz);
+}
+#endif
+
+#ifdef GROUP_DBL0
+static void
+GROUP_NAME(jge_dbl0)(const wei_t *ec, jge_t *r, const jge_t *p) {
+  /* Assumes a = 0.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#doubling-dbl-2009-l
+   * 2M + 5S + 6A + 3*2 + 1*3 + 1*8
+   */
+  fe_t a, b, c, d, e, f;
+
+  (void)ec;
+
+  /* A = X1^2 */
+  FE_SQR(a, p->x);
+
+  /* B = Y1^2 */
+  FE_SQR(b, p->y);
+
+  /* C = B^2 */
+  FE_SQR(c, b);
+
+  /* D = 2 * ((X1 + B)^2 - A - C) */
+  FE_ADD(d, p->x, b);
+  FE_SQR(d, d);
+  FE_SUB(d, d, a);
+  FE_SUB(d, d, c);
+  FE_ADD(d, d, d);
+
+  /* E = 3 * A */
+  FE_ADD(e, a, a);
+  FE_ADD(e, e, a);
+
+  /* F = E^2 */
+  FE_SQR(f, e);
+
+  /* Z3 = 2 * Y1 * Z1 */
+  FE_MUL(r->z, p->z, p->y);
+  FE_ADD(r->z, r->z, r->z);
+
+  /* X3 = F - 2 * D */
+  FE_ADD(r->x, d, d);
+  FE_SUB(r->x, f, r->x);
+
+  /* Y3 = E * (D - X3) - 8 * C */
+  FE_ADD(c, c, c);
+  FE_ADD(c, c, c);
+  FE_ADD(c, c, c);
+  FE_SUB(d, d, r->x);
+  FE_MUL(r->y, e, d);
+  FE_SUB(r->y, r->y, c);
+}
+#endif
+
+#ifdef GROUP_DBL3
+static void
+GROUP_NAME(jge_dbl3)(const wei_t *ec, jge_t *r, const jge_t *p) {
+  /* Assumes a = -3.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
+   * 3M + 5S + 8A + 1*3 + 1*4 + 2*8
+   */
+  fe_t delta, gamma, beta, alpha, t1, t2;
+
+  (void)ec;
+
+  /* delta = Z1^2 */
+  FE_SQR(delta, p->z);
+
+  /* gamma = Y1^2 */
+  FE_SQR(gamma, p->y);
+
+  /* beta = X1 * gamma */
+  FE_MUL(beta, p->x, gamma);
+
+  /* alpha = 3 * (X1 - delta) * (X1 + delta) */
+  FE_SUB(t1, p->x, delta);
+  FE_ADD(t2, p->x, delta);
+  FE_ADD(alpha, t1, t1);
+  FE_ADD(alpha, alpha, t1);
+  FE_MUL(alpha, alpha, t2);
+
+  /* Z3 = (Y1 + Z1)^2 - gamma - delta */
+  FE_ADD(r->z, p->y, p->z);
+  FE_SQR(r->z, r->z);
+  FE_SUB(r->z, r->z, gamma);
+  FE_SUB(r->z, r->z, delta);
+
+  /* X3 = alpha^2 - 8 * beta */
+  FE_ADD(t1, beta, beta);
+  FE_ADD(t1, t1, t1);
+  FE_ADD(t2, t1, t1);
+  FE_SQR(r->x, alpha);
+  FE_SUB(r->x, r->x, t2);
+
+  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+  FE_SUB(r->y, t1, r->x);
+  FE_MUL(r->y, r->y, alpha);
+  FE_SQR(gamma, gamma);
+  FE_ADD(gamma, gamma, gamma);
+  FE_ADD(gamma, gamma, gamma);
+  FE_ADD(gamma, gamma, gamma);
+  FE_SUB(r->y, r->y, gamma);
+}
+#endif
+
+static void
+GROUP_NAME(jge_addsub_var)(const wei_t *ec, jge_t *r,
+                           const jge_t *a, const jge_t *b, int negate) {
+  /* No assumptions.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-1998-cmo-2
+   * 12M + 4S + 6A + 1*2
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t z1z1, z2z2, u1, u2, s1, s2, h, r0, hh, hhh, v;
+
+  /* Z1Z1 = Z1^2 */
+  FE_SQR(z1z1, a->z);
+
+  /* Z2Z2 = Z2^2 */
+  FE_SQR(z2z2, b->z);
+
+  /* U1 = X1 * Z2Z2 */
+  FE_MUL(u1, a->x, z2z2);
+
+  /* U2 = X2 * Z1Z1 */
+  FE_MUL(u2, b->x, z1z1);
+
+  /* S1 = Y1 * Z2 * Z2Z2 */
+  FE_MUL(s1, a->y, b->z);
+  FE_MUL(s1, s1, z2z2);
+
+  /* S2 = Y2 * Z1 * Z1Z1 */
+  FE_MUL(s2, b->y, a->z);
+  FE_MUL(s2, s2, z1z1);
+
+  /* S2 = -S2 (if subtracting) */
+  if (negate)
+    FE_NEG(s2, s2);
+
+  /* H = U2 - U1 */
+  FE_SUB(h, u2, u1);
+
+  /* r = S2 - S1 */
+  FE_SUB(r0, s2, s1);
+
+  /* H = 0 */
+  if (fe_is_zero(fe, h)) {
+    if (!fe_is_zero(fe, r0)) {
+      jge_zero(ec, r);
+      return;
+    }
+
+    jge_dbl_var(ec, r, a);
+    return;
+  }
+
+  /* HH = H^2 */
+  FE_SQR(hh, h);
+
+  /* HHH = H * HH */
+  FE_MUL(hhh, h, hh);
+
+  /* V = U1 * HH */
+  FE_MUL(v, u1, hh);
+
+  /* Z3 = Z1 * Z2 * H */
+  FE_MUL(r->z, a->z, b->z);
+  FE_MUL(r->z, r->z, h);
+
+  /* X3 = r^2 - HHH - 2 * V */
+  FE_SQR(r->x, r0);
+  FE_SUB(r->x, r->x, hhh);
+  FE_SUB(r->x, r->x, v);
+  FE_SUB(r->x, r->x, v);
+
+  /* Y3 = r * (V - X3) - S1 * HHH */
+  FE_SUB(u1, v, r->x);
+  FE_MUL(u2, s1, hhh);
+  FE_MUL(r->y, r0, u1);
+  FE_SUB(r->y, r->y, u2);
+}
+
+static void
+GROUP_NAME(jge_mixed_addsub_var)(const wei_t *ec, jge_t *r, const jge_t *a,
+                                 const fe_t bx, const fe_t by, int negate) {
+  /* Assumes Z2 = 1.
+   * https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd
+   * 8M + 3S + 6A + 5*2
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t z1z1, u2, s2, h, r0, i, j, v;
+
+  /* Z1Z1 = Z1^2 */
+  FE_SQR(z1z1, a->z);
+
+  /* U2 = X2 * Z1Z1 */
+  FE_MUL(u2, bx, z1z1);
+
+  /* S2 = Y2 * Z1 * Z1Z1 */
+  FE_MUL(s2, by, a->z);
+  FE_MUL(s2, s2, z1z1);
+
+  /* S2 = -S2 (if subtracting) */
+  if (negate)
+    FE_NEG(s2, s2);
+
+  /* H = U2 - X1 */
+  FE_SUB(h, u2, a->x);
+
+  /* r = 2 * (S2 - Y1) */
+  FE_SUB(r0, s2, a->y);
+  FE_ADD(r0, r0, r0);
+
+  /* H = 0 */
+  if (fe_is_zero(fe, h)) {
+    if (!fe_is_zero(fe, r0)) {
+      jge_zero(ec, r);
+      return;
+    }
+
+    jge_dbl_var(ec, r, a);
+    return;
+  }
+
+  /* I = (2 * H)^2 */
+  FE_ADD(i, h, h);
+  FE_SQR(i, i);
+
+  /* J = H * I */
+  FE_MUL(j, h, i);
+
+  /* V = X1 * I */
+  FE_MUL(v, a->x, i);
+
+  /* X3 = r^2 - J - 2 * V */
+  FE_SQR(r->x, r0);
+  FE_SUB(r->x, r->x, j);
+  FE_SUB(r->x, r->x, v);
+  FE_SUB(r->x, r->x, v);
+
+  /* Y3 = r * (V - X3) - 2 * Y1 * J */
+  FE_SUB(u2, v, r->x);
+  FE_MUL(s2, a->y, j);
+  FE_ADD(s2, s2, s2);
+  FE_MUL(r->y, r0, u2);
+  FE_SUB(r->y, r->y, s2);
+
+  /* Z3 = 2 * Z1 * H */
+  FE_MUL(r->z, a->z, h);
+  FE_ADD(r->z, r->z, r->z);
+}
+
+static void
+GROUP_NAME(jge_add)(const wei_t *ec, jge_t *r,
+                    const jge_t *a, const jge_t *b) {
+  /* Strongly unified Jacobian addition (Brier and Joye).
+   *
+   * [SIDE2] Page 6, Section 3.
+   * [SIDE3] Page 4, Section 3.
+   *
+   * The above documents use projective coordinates[1]
+   * and have been modified for jacobian coordinates. A
+   * further modification, taken from libsecp256k1[2],
+   * handles the degenerate case of: x1 != x2, y1 = -y2.
+   *
+   * [1] https://hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-2002-bj
+   * [2] https://github.com/bitcoin-core/secp256k1/blob/ee9e68c/src/group_impl.h#L525
+   *
+   * 11M + 8S + 7A + 1*a + 2*4 + 1*3 + 2*2 (a != 0)
+   * 11M + 6S + 6A + 2*4 + 1*3 + 2*2 (a = 0)
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t z1z1, z2z2, u1, u2, s1, s2, z, t, m, l, w, h;
+  int degenerate, inf1, inf2, inf3;
+
+  /* Save some stack space. */
+#define ll l
+#define f m
+#define r0 z1z1
+#define g z2z2
+#define x3 u2
+#define y3 s2
+#define z3 t
+
+  /* Z1Z1 = Z1^2 */
+  FE_SQR(z1z1, a->z);
+
+  /* Z2Z2 = Z2^2 */
+  FE_SQR(z2z2, b->z);
+
+  /* U1 = X1 * Z2Z2 */
+  FE_MUL(u1, a->x, z2z2);
+
+  /* U2 = X2 * Z1Z1 */
+  FE_MUL(u2, b->x, z1z1);
+
+  /* S1 = Y1 * Z2Z2 * Z2 */
+  FE_MUL(s1, a->y, z2z2);
+  FE_MUL(s1, s1, b->z);
+
+  /* S2 = Y2 * Z1Z1 * Z1 */
+  FE_MUL(s2, b->y, z1z1);
+  FE_MUL(s2, s2, a->z);
+
+  /* Z = Z1 * Z2 */
+  FE_MUL(z, a->z, b->z);
+
+  /* T = U1 + U2 */
+  FE_ADD(t, u1, u2);
+
+  /* M = S1 + S2 */
+  FE_ADD(m, s1, s2);
+
+  /* R = T^2 - U1 * U2 */
+  FE_SQR(r0, t);
+  FE_MUL(l, u1, u2);
+  FE_SUB(r0, r0, l);
+
+  /* R = R + a * Z^4 (if a != 0) */
+  if (!GROUP_ZERO_A) {
+    FE_SQR(l, z);
+    FE_SQR(l, l);
+    GROUP_MUL_A(w, l);
+    FE_ADD(r0, r0, w);
+  }
+
+  /* Check for degenerate case (X1 != X2, Y1 = -Y2). */
+  degenerate = fe_is_zero(fe, m) & fe_is_zero(fe, r0);
+
+  /* M = U1 - U2 (if degenerate) */
+  FE_SUB(l, u1, u2);
+  FE_SELECT(m, m, l, degenerate);
+
+  /* R = S1 - S2 (if degenerate) */
+  FE_SUB(l, s1, s2);
+  FE_SELECT(r0, r0, l, degenerate);
+
+  /* L = M^2 */
+  FE_SQR(l, m);
+
+  /* G = T * L */
+  FE_MUL(g, t, l);
+
+  /* LL = L^2 */
+  FE_SQR(ll, l);
+
+  /* LL = 0 (if degenerate) */
+  FE_SELECT(ll, ll, fe->zero, degenerate);
+
+  /* W = R^2 */
+  FE_SQR(w, r0);
+
+  /* F = Z * M */
+  FE_MUL(f, m, z);
+
+  /* H = 3 * G - 2 * W */
+  FE_ADD(h, g, g);
+  FE_ADD(h, h, g);
+  FE_SUB(h, h, w);
+  FE_SUB(h, h, w);
+
+  /* X3 = 4 * (W - G) */
+  FE_SUB(x3, w, g);
+  FE_ADD(x3, x3, x3);
+  FE_ADD(x3, x3, x3);
+
+  /* Y3 = 4 * (R * H - LL) */
+  FE_MUL(y3, r0, h);
+  FE_SUB(y3, y3, ll);
+  FE_ADD(y3, y3, y3);
+  FE_ADD(y3, y3, y3);
+
+  /* Z3 = 2 * F */
+  FE_ADD(z3, f, f);
+
+  /* Check for infinity. */
+  inf1 = fe_is_zero(fe, a->z);
+  inf2 = fe_is_zero(fe, b->z);
+  inf3 = fe_is_zero(fe, z3) & ((inf1 | inf2) ^ 1);
+
+  /* Case 1: O + P = P */
+  FE_SELECT(x3, x3, b->x, inf1);
+  FE_SELECT(y3, y3, b->y, inf1);
+  FE_SELECT(z3, z3, b->z, inf1);
+
+  /* Case 2: P + O = P */
+  FE_SELECT(x3, x3, a->x, inf2);
+  FE_SELECT(y3, y3, a->y, inf2);
+  FE_SELECT(z3, z3, a->z, inf2);
+
+  /* Case 3: P + -P = O */
+  FE_SELECT(x3, x3, fe->one, inf3);
+  FE_SELECT(y3, y3, fe->one, inf3);
+  FE_SELECT(z3, z3, fe->zero, inf3);
+
+  /* R = (X3, Y3, Z3) */
+  FE_SET(r->x, x3);
+  FE_SET(r->y, y3);
+  FE_SET(r->z, z3);
+
+#undef ll
+#undef f
+#undef r0
+#undef g
+#undef x3
+#undef y3
+#undef z3
+}
+
+static void
+GROUP_NAME(jge_mixed_add)(const wei_t *ec, jge_t *r,
+                          const jge_t *a, const wge_t *b) {
+  /* Strongly unified mixed addition (Brier and Joye).
+   *
+   * [SIDE2] Page 6, Section 3.
+   * [SIDE3] Page 4, Section 3.
+   *
+   * 7M + 7S + 7A + 1*a + 2*4 + 1*3 + 2*2 (a != 0)
+   * 7M + 5S + 6A + 2*4 + 1*3 + 2*2 (a = 0)
+   */
+  const prime_field_t *fe = &ec->fe;
+  fe_t z1z1, u2, s2, t, m, l, g, w, h;
+  int degenerate, inf1, inf2, inf3;
+
+  /* Save some stack space. */
+#define u1 a->x
+#define s1 a->y
+#define ll l
+#define f m
+#define r0 z1z1
+#define x3 u2
+#define y3 s2
+#define z3 t
+
+  /* Z1Z1 = Z1^2 */
+  FE_SQR(z1z1, a->z);
+
+  /* U1 = X1 */
+
+  /* U2 = X2 * Z1Z1 */
+  FE_MUL(u2, b->x, z1z1);
+
+  /* S1 = Y1 */
+
+  /* S2 = Y2 * Z1Z1 * Z1 */
+  FE_MUL(s2, b->y, z1z1);
+  FE_MUL(s2, s2, a->z);
+
+  /* T = U1 + U2 */
+  FE_ADD(t, u1, u2);
+
+  /* M = S1 + S2 */
+  FE_ADD(m, s1, s2);
+
+  /* R = T^2 - U1 * U2 */
+  FE_SQR(r0, t);
+  FE_MUL(l, u1, u2);
+  FE_SUB(r0, r0, l);
+
+  /* R = R + a * Z1^4 (if a != 0) */
+  if (!GROUP_ZERO_A) {
+    FE_SQR(l, a->z);
+    FE_SQR(l, l);
+    GROUP_MUL_A(w, l);
+    FE_ADD(r0, r0, w);
+  }
+
+  /* Check for degenerate case (X1 != X2, Y1 = -Y2). */
+  degenerate = fe_is_zero(fe, m) & fe_is_zero(fe, r0);
+
+  /* M = U1 - U2 (if degenerate) */
+  FE_SUB(l, u1, u2);
+  FE_SELECT(m, m, l, degenerate);
+
+  /* R = S1 - S2 (if degenerate) */
+  FE_SUB(l, s1, s2);
+  FE_SELECT(r0, r0, l, degenerate);
+
+  /* L = M^2 */
+  FE_SQR(l, m);
+
+  /* G = T * L */
+  FE_MUL(g, t, l);
+
+  /* LL = L^2 */
+  FE_SQR(ll, l);
+
+  /* LL = 0 (if degenerate) */
+  FE_SELECT(ll, ll, fe->zero, degenerate);
+
+  /* W = R^2 */
+  FE_SQR(w, r0);
+
+  /* F = Z1 * M */
+  FE_MUL(f, m, a->z);
+
+  /* H = 3 * G - 2 * W */
+  FE_ADD(h, g, g);
+  FE_ADD(h, h, g);
+  FE_SUB(h, h, w);
+  FE_SUB(h, h, w);
+
+  /* X3 = 4 * (W - G) */
+  FE_SUB(x3, w, g);
+  FE_ADD(x3, x3, x3);
+  FE_ADD(x3, x3, x3);
+
+  /* Y3 = 4 * (R * H - LL) */
+  FE_MUL(y3, r0, h);
+  FE_SUB(y3, y3, ll);
+  FE_ADD(y3, y3, y3);
+  FE_ADD(y3, y3, y3);
+
+  /* Z3 = 2 * F */
+  FE_ADD(z3, f, f);
+
+  /* Check for infinity. */
+  inf1 = fe_is_zero(fe, a->z);
+  inf2 = b->inf;
+  inf3 = fe_is_zero(fe, z3) & ((inf1 | inf2) ^ 1);
+
+  /* Case 1: O + P = P */
+  FE_SELECT(x3, x3, b->x, inf1);
+  FE_SELECT(y3, y3, b->y, inf1);
+  FE_SELECT(z3, z3, fe->one, inf1);
+
+  /* Case 2: P + O = P */
+  FE_SELECT(x3, x3, a->x, inf2);
+  FE_SELECT(y3, y3, a->y, inf2);
+  FE_SELECT(z3, z3, a->z, inf2);
+
+  /* Case 3: P + -P = O */
+  FE_SELECT(x3, x3, fe->one, inf3);
+  FE_SELECT(y3, y3, fe->one, inf3);
+  FE_SELECT(z3, z3, fe->zero, inf3);
+
+  /* R = (X3, Y3, Z3) */
+  FE_SET(r->x, x3);
+  FE_SET(r->y, y3);
+  FE_SET(r->z, z3);
+
+#undef u1
+#undef s1
+#undef ll
+#undef f
+#undef r0
+#undef x3
+#undef y3
+#undef z3
+}
+
+#ifdef GROUP_MUL
+
+/*
+ * Jacobian Multiplication
+ */
+
+#if defined(GROUP_DBL0)
+#define GROUP_DBL GROUP_NAME(jge_dbl0)
+#elif defined(GROUP_DBL3)
+#define GROUP_DBL GROUP_NAME(jge_dbl3)
+#else
+#define GROUP_DBL GROUP_NAME(jge_dblj)
+#endif
+
+static void
+GROUP_NAME(jge_dbl_var)(const wei_t *ec, jge_t *r, const jge_t *p) {
+  /* See jge_dbl_var. */
+
+  /* P = O */
+  if (jge_is_zero(ec, p)) {
+    jge_zero(ec, r);
+    return;
+  }
+
+  /* Y1 = 0 */
+  if (ec->h > 1 && fe_is_zero(&ec->fe, p->y)) {
+    jge_zero(ec, r);
+    return;
+  }
+
+  GROUP_DBL(ec, r, p);
+}
+
+static void
+GROUP_NAME(jge_addsub_safe_var)(const wei_t *ec, jge_t *r,
+                                const jge_t *a, const jge_t *b, int negate) {
+  /* See jge_add_var and jge_sub_var. */
+
+  /* O +- P = +-P */
+  if (jge_is_zero(ec, a)) {
+    if (negate)
+      jge_neg(ec, r, b);
+    else
+      jge_set(ec, r, b);
+    return;
+  }
+
+  /* P +- O = P */
+  if (jge_is_zero(ec, b)) {
+    jge_set(ec, r, a);
+    return;
+  }
+
+  /* Z2 = 1 */
+  if (jge_is_affine(ec, b)) {
+    GROUP_NAME(jge_mixed_addsub_var)(ec, r, a, b->x, b->y, negate);
+    return;
+  }
+
+  GROUP_NAME(jge_addsub_var)(ec, r, a, b, negate);
+}
+
+static void
+GROUP_NAME(jge_mixed_addsub_safe_var)(const wei_t *ec, jge_t *r,
+                                      const jge_t *a, const wge_t *b,
+                                      int negate) {
+  /* See jge_mixed_add_var and jge_mixed_sub_var. */
+
+  /* O +- P = +-P */
+  if (jge_is_zero(ec, a)) {
+    wge_to_jge(ec, r, b);
+
+    if (negate)
+      jge_neg(ec, r, r);
+
+    return;
+  }
+
+  /* P +- O = P */
+  if (wge_is_zero(ec, b)) {
+    jge_set(ec, r, a);
+    return;
+  }
+
+  GROUP_NAME(jge_mixed_addsub_var)(ec, r, a, b->x, b->y, negate);
+}
+
+static void
+GROUP_NAME(wei_jmul_g)(const wei_t *ec, jge_t *r, const sc_t k) {
+  /* See wei_jmul_g. */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnds = wei_wnd_fixed(ec);
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  size_t i, j, b, m, carry;
+  unsigned int negated;
+  sc_t k0;
+  fe_t y;
+  wge_t t;
+
+  /* Blind if available. */
+  sc_add(sc, k0, k, ec->blind);
+
+  /* Ensure k0 < 2^(bits - 1). */
+  negated = sc_minimize(sc, k0, k0);
+
+  /* Multiply in constant time. */
+  jge_neg_cond(ec, r, &ec->unblind, negated);
+
+  carry = 0;
+
+  for (i = 0; i < steps; i++) {
+    b = sc_get_bits(sc, k0, i * width, width) + carry;
+
+    /* Recode to a digit in [-2^(w-1), 2^(w-1)]. */
+    carry = (b + size) >> width;
+
+    if (i == steps - 1)
+      carry = 0;
+
+    m = -carry;
+    b = (((size << 1) - b) & m) | (b & ~m);
+
+    wge_zero(ec, &t);
+
+    for (j = 0; j < size; j++) {
+      const wge_t *p = &wnds[i * size + j];
+      unsigned int flag = (j + 1 == b);
+
+      FE_SELECT(t.x, t.x, p->x, flag);
+      FE_SELECT(t.y, t.y, p->y, flag);
+
+      t.inf = (t.inf & (flag ^ 1)) | (p->inf & flag);
+    }
+
+    FE_NEG(y, t.y);
+    FE_SELECT(t.y, t.y, y, carry);
+
+    GROUP_NAME(jge_mixed_add)(ec, r, r, &t);
+  }
+
+  jge_neg_cond(ec, r, r, negated);
+
+  /* Cleanse. */
+  sc_cleanse(sc, k0);
+
+  cleanse(&b, sizeof(b));
+  cleanse(&m, sizeof(m));
+  cleanse(&carry, sizeof(carry));
+  cleanse(&negated, sizeof(negated));
+}
+
+static void
+GROUP_NAME(wei_jmul_double_normal_var)(const wei_t *ec,
+                                       jge_t *r,
+                                       const sc_t k1,
+                                       const wge_t *p2,
+                                       const sc_t k2) {
+  /* See wei_jmul_double_normal_var. */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  jge_t wnd2[NAF_SIZE]; /* 1728 bytes */
+  size_t i, max, max1, max2;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
+  max = ECC_MAX(max1, max2);
+
+  /* Compute NAF points. */
+  jge_naf_points_var(ec, wnd2, p2, NAF_WIDTH);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      GROUP_NAME(jge_dbl_var)(ec, r, r);
+
+    if (z1 > 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd1[(z1 - 1) >> 1], 0);
+    else if (z1 < 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd1[(-z1 - 1) >> 1], 1);
+
+    if (z2 > 0)
+      GROUP_NAME(jge_addsub_safe_var)(ec, r, r, &wnd2[(z2 - 1) >> 1], 0);
+    else if (z2 < 0)
+      GROUP_NAME(jge_addsub_safe_var)(ec, r, r, &wnd2[(-z2 - 1) >> 1], 1);
+  }
+}
+
+#ifdef GROUP_ENDO
+static void
+GROUP_NAME(wei_jmul_double_endo_var)(const wei_t *ec,
+                                     jge_t *r,
+                                     const sc_t k1,
+                                     const wge_t *p2,
+                                     const sc_t k2) {
+  /* See wei_jmul_double_endo_var. */
+  const scalar_field_t *sc = &ec->sc;
+  const wge_t *wnd1 = wei_wnd_naf(ec);
+  const wge_t *wnd2 = wei_wnd_endo(ec);
+  int naf1[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf2[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  int naf3[MAX_ENDO_BITS + 1]; /* 1048 bytes */
+  jge_t wnd3[4]; /* 608 bytes */
+  sc_t c1, c2, c3, c4; /* 288 bytes */
+  size_t i, max, max1, max2;
+
+  /* Split scalars. */
+  wei_endo_split(ec, c1, c2, k1);
+  wei_endo_split(ec, c3, c4, k2);
+
+  /* Compute NAFs. */
+  max1 = sc_naf_endo_var(sc, naf1, naf2, c1, c2, ec->naf_width);
+  max2 = sc_jsf_endo_var(sc, naf3, c3, c4);
+  max = ECC_MAX(max1, max2);
+
+  /* Create comb for JSF. */
+  wge_jsf_points_endo_var(ec, wnd3, p2);
+
+  /* Multiply and add. */
+  jge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+    int z3 = naf3[i];
+
+    if (i != max - 1)
+      GROUP_NAME(jge_dbl_var)(ec, r, r);
+
+    if (z1 > 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd1[(z1 - 1) >> 1], 0);
+    else if (z1 < 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd1[(-z1 - 1) >> 1], 1);
+
+    if (z2 > 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd2[(z2 - 1) >> 1], 0);
+    else if (z2 < 0)
+      GROUP_NAME(jge_mixed_addsub_safe_var)(ec, r, r, &wnd2[(-z2 - 1) >> 1], 1);
+
+    if (z3 > 0)
+      GROUP_NAME(jge_addsub_safe_var)(ec, r, r, &wnd3[(z3 - 1) >> 1], 0);
+    else if (z3 < 0)
+      GROUP_NAME(jge_addsub_safe_var)(ec, r, r, &wnd3[(-z3 - 1) >> 1], 1);
+  }
+}
+#endif
+
+static void
+GROUP_NAME(wei_jmul_double_var)(const wei_t *ec,
+                                jge_t *r,
+                                const sc_t k1,
+                                const wge_t *p2,
+                                const sc_t k2) {
+#ifdef GROUP_ENDO
+  if (ec->endo) {
+    GROUP_NAME(wei_jmul_double_endo_var)(ec, r, k1, p2, k2);
+    return;
+  }
+#endif
+
+  GROUP_NAME(wei_jmul_double_normal_var)(ec, r, k1, p2, k2);
+}
+
+#undef GROUP_DBL
+
+#endif /* GROUP_MUL */
+
+#endif /* GROUP_WEI */
+
+#ifdef GROUP_EDWARDS
+
+/*
+ * Extended Point
+ */
+
+static void
+GROUP_NAME(xge_dbl)(const edwards_t *ec, xge_t *r, const xge_t *p) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#doubling-dbl-2008-hwcd
+   * 4M + 4S + 6A + 1*a + 1*2
+   */
+  fe_t a, b, c, d, e, g, f, h;
+
+  (void)ec;
+
+  /* A = X1^2 */
+  FE_SQR(a, p->x);
+
+  /* B = Y1^2 */
+  FE_SQR(b, p->y);
+
+  /* C = 2 * Z1^2 */
+  FE_SQR(c, p->z);
+  FE_ADD(c, c, c);
+
+  /* D = a * A */
+  GROUP_MUL_A(d, a);
+
+  /* E = (X1 + Y1)^2 - A - B */
+  FE_ADD(e, p->x, p->y);
+  FE_SQR(e, e);
+  FE_SUB(e, e, a);
+  FE_SUB(e, e, b);
+
+  /* G = D + B */
+  FE_ADD(g, d, b);
+
+  /* F = G - C */
+  FE_SUB(f, g, c);
+
+  /* H = D - B */
+  FE_SUB(h, d, b);
+
+  /* X3 = E * F */
+  FE_MUL(r->x, e, f);
+
+  /* Y3 = G * H */
+  FE_MUL(r->y, g, h);
+
+  /* T3 = E * H */
+  FE_MUL(r->t, e, h);
+
+  /* Z3 = F * G */
+  FE_MUL(r->z, f, g);
+}
+
+#ifdef GROUP_ADD_A
+static void
+GROUP_NAME(xge_add_a)(const edwards_t *ec, xge_t *r,
+                      const xge_t *a, const xge_t *b) {
+  /* https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-add-2008-hwcd
+   * 9M + 7A + 1*a + 1*d
+   */
+  fe_t A, B, c, d, e, f, g, h;
+
+  /* A = X1 * X2 */
+  FE_MUL(A, a->x, b->x);
+
+  /* B = Y1 * Y2 */
+  FE_MUL(B, a->y, b->y);
+
+  /* C = T1 * d * T2 */
+  FE_MUL(c, a->t, b->t);
+  FE_MUL(c, c, ec->d);
+
+  /* D = Z1 * Z2 */
+  FE_MUL(d, a->z, b->z);
+
+  /* E = (X1 + Y1) * (X2 + Y2) - A - B */
+  FE_ADD(f, a->x, a->y);
+  FE_ADD(g, b->x, b->y);
+  FE_MUL(e, f, g);
+  FE_SUB(e, e, A);
+  FE_SUB(e, e, B);
+
+  /* F = D - C */
+  FE_SUB(f, d, c);
+
+  /* G = D + C */
+  FE_ADD(g, d, c);
+
+  /* H = B - a * A */
+  GROUP_MUL_A(h, A);
+  FE_SUB(h, B, h);
+
+  /* X3 = E * F */
+  FE_MUL(r->x, e, f);
+
+  /* Y3 = G * H */
+  FE_MUL(r->y, g, h);
+
+  /* T3 = E * H */
+  FE_MUL(r->t, e, h);
+
+  /* Z3 = F * G */
+  FE_MUL(r->z, f, g);
+}
+
+static void
+GROUP_NAME(xge_mixed_add_a)(const edwards_t *ec, xge_t *r,
+                            const xge_t *a, const nge_t *b) {
+  /* Assumes `b` is (x, y, d * x * y).
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended.html#addition-madd-2008-hwcd
+   * 8M + 7A + 1*a
+   */
+  fe_t A, B, c, e, f, g, h;
+
+  (void)ec;
+
+  /* A = X1 * X2 */
+  FE_MUL(A, a->x, b->u);
+
+  /* B = Y1 * Y2 */
+  FE_MUL(B, a->y, b->v);
+
+  /* C = T1 * d * T2 */
+  FE_MUL(c, a->t, b->w);
+
+  /* D = Z1 */
+
+  /* E = (X1 + Y1) * (X2 + Y2) - A - B */
+  FE_ADD(f, a->x, a->y);
+  FE_ADD(g, b->u, b->v);
+  FE_MUL(e, f, g);
+  FE_SUB(e, e, A);
+  FE_SUB(e, e, B);
+
+  /* F = D - C */
+  FE_SUB(f, a->z, c);
+
+  /* G = D + C */
+  FE_ADD(g, a->z, c);
+
+  /* H = B - a * A */
+  GROUP_MUL_A(h, A);
+  FE_SUB(h, B, h);
+
+  /* X3 = E * F */
+  FE_MUL(r->x, e, f);
+
+  /* Y3 = G * H */
+  FE_MUL(r->y, g, h);
+
+  /* T3 = E * H */
+  FE_MUL(r->t, e, h);
+
+  /* Z3 = F * G */
+  FE_MUL(r->z, f, g);
+}
+#endif
+
+#ifdef GROUP_ADD_M1
+static void
+GROUP_NAME(xge_add_m1)(const edwards_t *ec, xge_t *r,
+                       const xge_t *a, const xge_t *b) {
+  /* Assumes a = -1.
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
+   * 8M + 8A + 1*k + 1*2
+   */
+  fe_t A, B, c, d, e, f, g, h;
+
+  /* A = (Y1 - X1) * (Y2 - X2) */
+  FE_SUB(c, a->y, a->x);
+  FE_SUB(d, b->y, b->x);
+  FE_MUL(A, c, d);
+
+  /* B = (Y1 + X1) * (Y2 + X2) */
+  FE_ADD(c, a->y, a->x);
+  FE_ADD(d, b->y, b->x);
+  FE_MUL(B, c, d);
+
+  /* C = T1 * k * T2 */
+  FE_MUL(c, a->t, b->t);
+  FE_MUL(c, c, ec->k);
+
+  /* D = Z1 * 2 * Z2 */
+  FE_MUL(d, a->z, b->z);
+  FE_ADD(d, d, d);
+
+  /* E = B - A */
+  FE_SUB(e, B, A);
+
+  /* F = D - C */
+  FE_SUB(f, d, c);
+
+  /* G = D + C */
+  FE_ADD(g, d, c);
+
+  /* H = B + A */
+  FE_ADD(h, B, A);
+
+  /* X3 = E * F */
+  FE_MUL(r->x, e, f);
+
+  /* Y3 = G * H */
+  FE_MUL(r->y, g, h);
+
+  /* T3 = E * H */
+  FE_MUL(r->t, e, h);
+
+  /* Z3 = F * G */
+  FE_MUL(r->z, f, g);
+}
+
+static void
+GROUP_NAME(xge_mixed_add_m1)(const edwards_t *ec, xge_t *r,
+                             const xge_t *a, const nge_t *b) {
+  /* Assumes a = -1 and `b` is (y + x, y - x, k * x * y).
+   *
+   * https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
+   * 7M + 8A + 1*2
+   */
+  fe_t A, B, c, d, e, f, g, h;
+
+  (void)ec;
+
+  /* A = (Y1 - X1) * (Y2 - X2) */
+  FE_SUB(c, a->y, a->x);
+  FE_MUL(A, c, b->v);
+
+  /* B = (Y1 + X1) * (Y2 + X2) */
+  FE_ADD(c, a->y, a->x);
+  FE_MUL(B, c, b->u);
+
+  /* C = T1 * k * T2 */
+  FE_MUL(c, a->t, b->w);
+
+  /* D = 2 * Z1 */
+  FE_ADD(d, a->z, a->z);
+
+  /* E = B - A */
+  FE_SUB(e, B, A);
+
+  /* F = D - C */
+  FE_SUB(f, d, c);
+
+  /* G = D + C */
+  FE_ADD(g, d, c);
+
+  /* H = B + A */
+  FE_ADD(h, B, A);
+
+  /* X3 = E * F */
+  FE_MUL(r->x, e, f);
+
+  /* Y3 = G * H */
+  FE_MUL(r->y, g, h);
+
+  /* T3 = E * H */
+  FE_MUL(r->t, e, h);
+
+  /* Z3 = F * G */
+  FE_MUL(r->z, f, g);
+}
+#endif
+
+#if defined(GROUP_MUL) && defined(GROUP_ADD_M1)
+
+/*
+ * Extended Multiplication (a = -1)
+ */
+
+static void
+GROUP_NAME(xge_sub_m1)(const edwards_t *ec, xge_t *r,
+                       const xge_t *a, const xge_t *b) {
+  /* -(X, Y, Z, T) = (-X, Y, Z, -T) */
+  xge_t c;
+
+  FE_NEG(c.x, b->x);
+  FE_SET(c.y, b->y);
+  FE_SET(c.z, b->z);
+  FE_NEG(c.t, b->t);
+
+  GROUP_NAME(xge_add_m1)(ec, r, a, &c);
+}
+
+static void
+GROUP_NAME(edwards_mul_g)(const edwards_t *ec, xge_t *r, const sc_t k) {
+  /* See edwards_mul_g. */
+  const scalar_field_t *sc = &ec->sc;
+  const nge_t *wnds = edwards_wnd_fixed(ec);
+  size_t width = ec->fixed_width;
+  size_t steps = FIXED_STEPS(sc->bits, width);
+  size_t size = FIXED_SIZE(width);
+  size_t i, j, b, m, carry;
+  unsigned int negated;
+  sc_t k0;
+  nge_t t, s;
+
+  /* Blind if available. */
+  sc_add(sc, k0, k, ec->blind);
+
+  /* Ensure k0 < 2^(bits - 1). */
+  negated = sc_minimize(sc, k0, k0);
+
+  /* Multiply in constant time. */
+  xge_neg_cond(ec, r, &ec->unblind, negated);
+
+  carry = 0;
+
+  for (i = 0; i < steps; i++) {
+    b = sc_get_bits(sc, k0, i * width, width) + carry;
+
+    /* Recode to a digit in [-2^(w-1), 2^(w-1)]. */
+    carry = (b + size) >> width;
+
+    if (i == steps - 1)
+      carry = 0;
+
+    m = -carry;
+    b = (((size << 1) - b) & m) | (b & ~m);
+
+    /* O = (1, 1, 0) */
+    FE_SET(t.u, ec->fe.one);
+    FE_SET(t.v, ec->fe.one);
+    FE_SET(t.w, ec->fe.zero);
+
+    for (j = 0; j < size; j++) {
+      const nge_t *p = &wnds[i * size + j];
+      unsigned int flag = (j + 1 == b);
+
+      FE_SELECT(t.u, t.u, p->u, flag);
+      FE_SELECT(t.v, t.v, p->v, flag);
+      FE_SELECT(t.w, t.w, p->w, flag);
+    }
+
+    /* -(y + x, y - x, kxy) = (y - x, y + x, -kxy) */
+    FE_SELECT(s.u, t.u, t.v, carry);
+    FE_SELECT(s.v, t.v, t.u, carry);
+    FE_NEG(s.w, t.w);
+    FE_SELECT(s.w, t.w, s.w, carry);
+
+    GROUP_NAME(xge_mixed_add_m1)(ec, r, r, &s);
+  }
+
+  xge_neg_cond(ec, r, r, negated);
+
+  /* Cleanse. */
+  sc_cleanse(sc, k0);
+
+  cleanse(&b, sizeof(b));
+  cleanse(&m, sizeof(m));
+  cleanse(&carry, sizeof(carry));
+  cleanse(&negated, sizeof(negated));
+}
+
+static void
+GROUP_NAME(edwards_mul_double_var)(const edwards_t *ec,
+                                   xge_t *r,
+                                   const sc_t k1,
+                                   const xge_t *p2,
+                                   const sc_t k2) {
+  /* See edwards_mul_double_var. */
+  const scalar_field_t *sc = &ec->sc;
+  const xge_t *wnd1 = edwards_wnd_naf(ec);
+  int naf1[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  int naf2[MAX_SCALAR_BITS + 1]; /* 2088 bytes */
+  xge_t wnd2[NAF_SIZE]; /* 2304 bytes */
+  size_t i, max, max1, max2;
+
+  /* Compute NAFs. */
+  max1 = sc_naf_var(sc, naf1, k1, ec->naf_width);
+  max2 = sc_naf_var(sc, naf2, k2, NAF_WIDTH);
+  max = ECC_MAX(max1, max2);
+
+  /* Compute NAF points. */
+  xge_naf_points(ec, wnd2, p2, NAF_WIDTH);
+
+  /* Multiply and add. */
+  xge_zero(ec, r);
+
+  for (i = max; i-- > 0;) {
+    int z1 = naf1[i];
+    int z2 = naf2[i];
+
+    if (i != max - 1)
+      GROUP_NAME(xge_dbl)(ec, r, r);
+
+    if (z1 > 0)
+      GROUP_NAME(xge_add_m1)(ec, r, r, &wnd1[(z1 - 1) >> 1]);
+    else if (z1 < 0)
+      GROUP_NAME(xge_sub_m1)(ec, r, r, &wnd1[(-z1 - 1) >> 1]);
+
+    if (z2 > 0)
+      GROUP_NAME(xge_add_m1)(ec, r, r, &wnd2[(z2 - 1) >> 1]);
+    else if (z2 < 0)
+      GROUP_NAME(xge_sub_m1)(ec, r, r, &wnd2[(-z2 - 1) >> 1]);
+  }
+}
+
+#endif /* GROUP_MUL */
+
+#endif /* GROUP_EDWARDS */
+
+#ifdef GROUP_MONT
+
+/*
+ * Projective Ladder
+ */
+
+static void
+GROUP_NAME(pge_ladder)(const mont_t *ec,
+                       pge_t *p4,
+                       pge_t *p5,
+                       const pge_t *p1,
+                       const pge_t *p2,
+                       const pge_t *p3,
+                       int affine) {
+  /* See pge_ladder.
+   * 6M + 4S + 8A + 1*a24
+   */
+  fe_t a, aa, b, bb, e, c, d, da, cb;
+
+  (void)ec;
+
+  /* A = X2 + Z2 */
+  FE_ADD(a, p2->x, p2->z);
+
+  /* AA = A^2 */
+  FE_SQR(aa, a);
+
+  /* B = X2 - Z2 */
+  FE_SUB(b, p2->x, p2->z);
+
+  /* BB = B^2 */
+  FE_SQR(bb, b);
+
+  /* E = AA - BB */
+  FE_SUB(e, aa, bb);
+
+  /* C = X3 + Z3 */
+  FE_ADD(c, p3->x, p3->z);
+
+  /* D = X3 - Z3 */
+  FE_SUB(d, p3->x, p3->z);
+
+  /* DA = D * A */
+  FE_MUL(da, d, a);
+
+  /* CB = C * B */
+  FE_MUL(cb, c, b);
+
+  /* X5 = Z1 * (DA + CB)^2 */
+  FE_ADD(p5->x, da, cb);
+  FE_SQR(p5->x, p5->x);
+
+  if (!affine)
+    FE_MUL(p5->x, p5->x, p1->z);
+
+  /* Z5 = X1 * (DA - CB)^2 */
+  FE_SUB(p5->z, da, cb);
+  FE_SQR(p5->z, p5->z);
+  FE_MUL(p5->z, p5->z, p1->x);
+
+  /* X4 = AA * BB */
+  FE_MUL(p4->x, aa, bb);
+
+  /* Z4 = E * (BB + a24 * E) */
+  GROUP_MUL_A24(p4->z, e);
+  FE_ADD(p4->z, p4->z, bb);
+  FE_MUL(p4->z, p4->z, e);
+}
+
+static void
+GROUP_NAME(mont_mul)(const mont_t *ec,
+                     pge_t *r,
+                     const pge_t *p,
+                     const sc_t k,
+                     int affine) {
+  /* See mont_mul. */
+  const scalar_field_t *sc = &ec->sc;
+  mp_limb_t swap = 0;
+  mp_limb_t bit = 0;
+  mp_size_t i;
+  pge_t a, b;
+
+  pge_zero(ec, &a);
+  pge_set(ec, &b, p);
+
+  /* Climb the ladder. */
+  for (i = ec->fe.bits - 1; i >= 0; i--) {
+    bit = sc_get_bit(sc, k, i);
+
+    /* Maybe swap. */
+    pge_swap(ec, &a, &b, swap ^ bit);
+
+    /* Single coordinate add+double. */
+    GROUP_NAME(pge_ladder)(ec, &a, &b, p, &a, &b, affine);
+
+    swap = bit;
+  }
+
+  /* Finalize loop. */
+  pge_swap(ec, &a, &b, swap);
+  pge_set(ec, r, &a);
+
+  /* Cleanse. */
+  cleanse(&bit, sizeof(bit));
+  cleanse(&swap, sizeof(swap));
+}
+
+#endif /* GROUP_MONT */
+
+#undef GROUP_NAME
+#undef GROUP_WEI
+#undef GROUP_EDWARDS
+#undef GROUP_DBLJ
+#undef GROUP_DBL0
+#undef GROUP_DBL3
+#undef GROUP_ADD_A
+#undef GROUP_ADD_M1
+#undef GROUP_ZERO_A
+#undef GROUP_MUL_A
+#undef GROUP_MUL_A24
+#undef GROUP_MUL
+#undef GROUP_ENDO
+#undef GROUP_MONT
+#undef FE_ADD
+#undef FE_SUB
+#undef FE_NEG
+#undef FE_MUL
+#undef FE_SQR
+#undef FE_SELECT
+#undef FE_SET
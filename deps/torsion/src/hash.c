@@ -3875,6 +3875,38 @@ sha256_final(sha256_t *ctx, unsigned char *out) {
     write32be(out + i * 4, ctx->state[i]);
 }
 
+int
+sha256_export(const sha256_t *ctx, unsigned char *out) {
+  /* Midstate is `state || size`, taken on a block boundary. */
+  size_t i;
+
+  if (ctx->size & 63)
+    return 0;
+
+  for (i = 0; i < 8; i++)
+    write32be(out + i * 4, ctx->state[i]);
+
+  write64be(out + 32, ctx->size);
+
+  return 1;
+}
+
+int
+sha256_import(sha256_t *ctx, const unsigned char *in) {
+  uint64_t size = read64be(in + 32);
+  size_t i;
+
+  if (size & 63)
+    return 0;
+
+  for (i = 0; i < 8; i++)
+    ctx->state[i] = read32be(in + i * 4);
+
+  ctx->size = size;
+
+  return 1;
+}
+
 /*
  * SHA384
  *
@@ -5346,6 +5378,38 @@ sha512_final(sha512_t *ctx, unsigned char *out) {
     write64be(out + i * 8, ctx->state[i]);
 }
 
+int
+sha512_export(const sha512_t *ctx, unsigned char *out) {
+  /* See sha256_export. */
+  size_t i;
+
+  if (ctx->size & 127)
+    return 0;
+
+  for (i = 0; i < 8; i++)
+    write64be(out + i * 8, ctx->state[i]);
+
+  write64be(out + 64, ctx->size);
+
+  return 1;
+}
+
+int
+sha512_import(sha512_t *ctx, const unsigned char *in) {
+  uint64_t size = read64be(in + 64);
+  size_t i;
+
+  if (size & 127)
+    return 0;
+
+  for (i = 0; i < 8; i++)
+    ctx->state[i] = read64be(in + i * 8);
+
+  ctx->size = size;
+
+  return 1;
+}
+
 /*
  * SHA3-{224,256,384,512}
  */
@@ -6829,6 +6893,48 @@ hash_final(hash_t *hash, unsigned char *out, size_t len) {
   }
 }
 
+int
+hash_export(const hash_t *hash, unsigned char *out) {
+  switch (hash->type) {
+    case HASH_HASH160:
+    case HASH_HASH256:
+    case HASH_SHA224:
+    case HASH_SHA256:
+      return sha256_export(&hash->ctx.sha256, out);
+    case HASH_SHA384:
+    case HASH_SHA512:
+      return sha512_export(&hash->ctx.sha512, out);
+    default:
+      return 0;
+  }
+}
+
+int
+hash_import(hash_t *hash, int type, const unsigned char *in) {
+  /* The context is left untouched on failure. */
+  int ret;
+
+  switch (type) {
+    case HASH_HASH160:
+    case HASH_HASH256:
+    case HASH_SHA224:
+    case HASH_SHA256:
+      ret = sha256_import(&hash->ctx.sha256, in);
+      break;
+    case HASH_SHA384:
+    case HASH_SHA512:
+      ret = sha512_import(&hash->ctx.sha512, in);
+      break;
+    default:
+      return 0;
+  }
+
+  if (ret)
+    hash->type = type;
+
+  return ret;
+}
+
 int
 hash_has_backend(int type) {
   switch (type) {
@@ -7013,6 +7119,22 @@ hash_block_size(int type) {
   }
 }
 
+size_t
+hash_midstate_size(int type) {
+  switch (type) {
+    case HASH_HASH160:
+    case HASH_HASH256:
+    case HASH_SHA224:
+    case HASH_SHA256:
+      return 40;
+    case HASH_SHA384:
+    case HASH_SHA512:
+      return 72;
+    default:
+      return 0;
+  }
+}
+
 /*
  * HMAC
  *
@@ -2375,6 +2375,445 @@ mpn_invert_n(mp_ptr rp, mp_srcptr xp,
   return mpn_invert(rp, xp, xn, yp, n, scratch);
 }
 
+/* Safegcd inversion.
+ *
+ * See: Fast constant-time gcd computation and modular inversion
+ *   D. J. Bernstein, B. Yang
+ *   https://gcd.cr.yp.to/safegcd-20190413.pdf
+ *
+ * See: The safegcd implementation in libsecp256k1 explained
+ *   P. Wuille
+ *   https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md
+ *
+ * Numbers are held in signed limbs of MP_LIMB_BITS - 2 bits, allowing
+ * the 2x2 transition matrices to be applied with a single wide multiply
+ * per limb. That means 62-bit limbs with __int128, 30-bit otherwise.
+ */
+
+#define MP_DIVSTEPS (MP_LIMB_BITS - 2)
+#define MP_DIVSTEPS_MASK (MP_LIMB_MAX >> 2)
+
+#if MP_LIMB_BITS == 64
+typedef torsion_int128_t mp_swide_t;
+#else
+typedef int64_t mp_swide_t;
+#endif
+
+typedef struct mp_divsteps_s {
+  mp_long_t u, v, q, r;
+} mp_divsteps_t;
+
+static void
+mps_import(mp_long_t *zp, mp_size_t zn, mp_srcptr xp, mp_size_t xn) {
+  mp_bitcnt_t pos = 0;
+  mp_size_t i, j;
+  mp_limb_t w;
+  unsigned s;
+
+  for (i = 0; i < zn; i++) {
+    j = pos / MP_LIMB_BITS;
+    s = pos % MP_LIMB_BITS;
+    w = 0;
+
+    if (j < xn) {
+      w = xp[j] >> s;
+
+      if (s > 2 && j + 1 < xn)
+        w |= xp[j + 1] << (MP_LIMB_BITS - s);
+    }
+
+    zp[i] = (mp_long_t)(w & MP_DIVSTEPS_MASK);
+
+    pos += MP_DIVSTEPS;
+  }
+}
+
+static void
+mps_export(mp_ptr zp, mp_size_t zn, const mp_long_t *xp, mp_size_t xn) {
+  /* Assumes a normalized, non-negative input. */
+  mp_bitcnt_t pos = 0;
+  mp_size_t i, j;
+  mp_limb_t w;
+  unsigned s;
+
+  mpn_zero(zp, zn);
+
+  for (i = 0; i < xn; i++) {
+    j = pos / MP_LIMB_BITS;
+    s = pos % MP_LIMB_BITS;
+    w = (mp_limb_t)xp[i];
+
+    if (j < zn) {
+      zp[j] |= w << s;
+
+      if (s > 2 && j + 1 < zn)
+        zp[j + 1] |= w >> (MP_LIMB_BITS - s);
+    }
+
+    pos += MP_DIVSTEPS;
+  }
+}
+
+static mp_limb_t
+mps_modinv(mp_limb_t m) {
+  /* Newton iteration for m^-1 mod 2^MP_DIVSTEPS. */
+  mp_limb_t x = m; /* 3 bits */
+  int i;
+
+  for (i = 0; i < 5; i++)
+    x *= 2 - m * x;
+
+  return x & MP_DIVSTEPS_MASK;
+}
+
+static mp_long_t
+mps_divsteps(mp_long_t eta, mp_limb_t f, mp_limb_t g, mp_divsteps_t *t) {
+  /* Constant-time divsteps with eta = -delta. The
+     matrix is scaled by 2^MP_DIVSTEPS on return. */
+  mp_limb_t u = 1, v = 0, q = 0, r = 1;
+  mp_limb_t c1, c2, x, y, z;
+  int i;
+
+  for (i = 0; i < MP_DIVSTEPS; i++) {
+    c1 = (mp_limb_t)(eta >> (MP_LIMB_BITS - 1));
+    c2 = -(g & 1);
+
+    x = (f ^ c1) - c1;
+    y = (u ^ c1) - c1;
+    z = (v ^ c1) - c1;
+
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+
+    c1 &= c2;
+
+    eta = (eta ^ (mp_long_t)c1) - (mp_long_t)c1 - 1;
+
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+
+  t->u = (mp_long_t)u;
+  t->v = (mp_long_t)v;
+  t->q = (mp_long_t)q;
+  t->r = (mp_long_t)r;
+
+  return eta;
+}
+
+static mp_long_t
+mps_divsteps_var(mp_long_t eta, mp_limb_t f, mp_limb_t g, mp_divsteps_t *t) {
+  /* Same as above, but skips runs of zeroes. */
+  mp_limb_t u = 1, v = 0, q = 0, r = 1;
+  mp_limb_t x, y, z;
+  unsigned i = MP_DIVSTEPS;
+  unsigned zeros;
+
+  for (;;) {
+    MP_CTZ(zeros, g | (MP_LIMB_MAX << i));
+
+    g >>= zeros;
+    u <<= zeros;
+    v <<= zeros;
+    eta -= zeros;
+    i -= zeros;
+
+    if (i == 0)
+      break;
+
+    if (eta < 0) {
+      eta = -eta - 1;
+      x = f;
+      f = g;
+      g -= x;
+      y = u;
+      u = q;
+      q -= y;
+      z = v;
+      v = r;
+      r -= z;
+    } else {
+      eta -= 1;
+      g += f;
+      q += u;
+      r += v;
+    }
+
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+    i -= 1;
+  }
+
+  t->u = (mp_long_t)u;
+  t->v = (mp_long_t)v;
+  t->q = (mp_long_t)q;
+  t->r = (mp_long_t)r;
+
+  return eta;
+}
+
+static void
+mps_update_de(mp_long_t *dp,
+              mp_long_t *ep,
+              const mp_divsteps_t *t,
+              const mp_long_t *mp,
+              mp_limb_t mi,
+              mp_size_t n) {
+  /* [d, e] = t * [d, e] / 2^MP_DIVSTEPS mod m, keeping both in (-2m, m). */
+  mp_long_t sd = dp[n - 1] >> (MP_LIMB_BITS - 1);
+  mp_long_t se = ep[n - 1] >> (MP_LIMB_BITS - 1);
+  mp_long_t md = (t->u & sd) + (t->v & se);
+  mp_long_t me = (t->q & sd) + (t->r & se);
+  mp_swide_t cd, ce;
+  mp_size_t i;
+
+  cd = (mp_swide_t)t->u * dp[0] + (mp_swide_t)t->v * ep[0];
+  ce = (mp_swide_t)t->q * dp[0] + (mp_swide_t)t->r * ep[0];
+
+  md -= (mp_long_t)((mi * (mp_limb_t)cd + (mp_limb_t)md) & MP_DIVSTEPS_MASK);
+  me -= (mp_long_t)((mi * (mp_limb_t)ce + (mp_limb_t)me) & MP_DIVSTEPS_MASK);
+
+  cd += (mp_swide_t)mp[0] * md;
+  ce += (mp_swide_t)mp[0] * me;
+
+  ASSERT(((mp_limb_t)cd & MP_DIVSTEPS_MASK) == 0);
+  ASSERT(((mp_limb_t)ce & MP_DIVSTEPS_MASK) == 0);
+
+  cd >>= MP_DIVSTEPS;
+  ce >>= MP_DIVSTEPS;
+
+  for (i = 1; i < n; i++) {
+    cd += (mp_swide_t)t->u * dp[i] + (mp_swide_t)t->v * ep[i];
+    ce += (mp_swide_t)t->q * dp[i] + (mp_swide_t)t->r * ep[i];
+    cd += (mp_swide_t)mp[i] * md;
+    ce += (mp_swide_t)mp[i] * me;
+
+    dp[i - 1] = (mp_long_t)((mp_limb_t)cd & MP_DIVSTEPS_MASK);
+    ep[i - 1] = (mp_long_t)((mp_limb_t)ce & MP_DIVSTEPS_MASK);
+
+    cd >>= MP_DIVSTEPS;
+    ce >>= MP_DIVSTEPS;
+  }
+
+  dp[n - 1] = (mp_long_t)cd;
+  ep[n - 1] = (mp_long_t)ce;
+}
+
+static void
+mps_update_fg(mp_long_t *fp,
+              mp_long_t *gp,
+              const mp_divsteps_t *t,
+              mp_size_t n) {
+  /* [f, g] = t * [f, g] / 2^MP_DIVSTEPS (exact). */
+  mp_swide_t cf, cg;
+  mp_size_t i;
+
+  cf = (mp_swide_t)t->u * fp[0] + (mp_swide_t)t->v * gp[0];
+  cg = (mp_swide_t)t->q * fp[0] + (mp_swide_t)t->r * gp[0];
+
+  ASSERT(((mp_limb_t)cf & MP_DIVSTEPS_MASK) == 0);
+  ASSERT(((mp_limb_t)cg & MP_DIVSTEPS_MASK) == 0);
+
+  cf >>= MP_DIVSTEPS;
+  cg >>= MP_DIVSTEPS;
+
+  for (i = 1; i < n; i++) {
+    cf += (mp_swide_t)t->u * fp[i] + (mp_swide_t)t->v * gp[i];
+    cg += (mp_swide_t)t->q * fp[i] + (mp_swide_t)t->r * gp[i];
+
+    fp[i - 1] = (mp_long_t)((mp_limb_t)cf & MP_DIVSTEPS_MASK);
+    gp[i - 1] = (mp_long_t)((mp_limb_t)cg & MP_DIVSTEPS_MASK);
+
+    cf >>= MP_DIVSTEPS;
+    cg >>= MP_DIVSTEPS;
+  }
+
+  fp[n - 1] = (mp_long_t)cf;
+  gp[n - 1] = (mp_long_t)cg;
+}
+
+static void
+mps_normalize(mp_long_t *rp, mp_long_t sign, const mp_long_t *mp, mp_size_t n) {
+  /* Map r in (-2m, m) to r * sign(f) in [0, m). */
+  mp_long_t cond;
+  mp_size_t i;
+
+  cond = rp[n - 1] >> (MP_LIMB_BITS - 1);
+
+  for (i = 0; i < n; i++)
+    rp[i] += mp[i] & cond;
+
+  cond = sign >> (MP_LIMB_BITS - 1);
+
+  for (i = 0; i < n; i++)
+    rp[i] = (rp[i] ^ cond) - cond;
+
+  for (i = 0; i < n - 1; i++) {
+    rp[i + 1] += rp[i] >> MP_DIVSTEPS;
+    rp[i] &= (mp_long_t)MP_DIVSTEPS_MASK;
+  }
+
+  cond = rp[n - 1] >> (MP_LIMB_BITS - 1);
+
+  for (i = 0; i < n; i++)
+    rp[i] += mp[i] & cond;
+
+  for (i = 0; i < n - 1; i++) {
+    rp[i + 1] += rp[i] >> MP_DIVSTEPS;
+    rp[i] &= (mp_long_t)MP_DIVSTEPS_MASK;
+  }
+}
+
+static int
+mps_is_unit(const mp_long_t *fp, mp_size_t n) {
+  /* Constant-time check for f = +-1. */
+  mp_limb_t sign = (mp_limb_t)(fp[n - 1] >> (MP_LIMB_BITS - 1));
+  mp_limb_t z = 0;
+  mp_limb_t w;
+  mp_size_t i;
+
+  for (i = 0; i < n; i++) {
+    w = (mp_limb_t)fp[i] ^ sign;
+
+    if (i < n - 1)
+      w &= MP_DIVSTEPS_MASK;
+
+    if (i == 0)
+      w ^= ~sign & 1;
+
+    z |= w;
+  }
+
+  return ((z | -z) >> (MP_LIMB_BITS - 1)) ^ 1;
+}
+
+static mp_size_t
+mps_init(mp_long_t *fp, mp_long_t *gp,
+         mp_long_t *dp, mp_long_t *ep,
+         mp_long_t *mp, mp_limb_t *mi,
+         mp_srcptr xp, mp_srcptr yp, mp_size_t n) {
+  mp_size_t s = MPN_SAFEGCD_LIMBS(n);
+  mp_size_t i;
+
+  if (n == 0 || (yp[0] & 1) == 0)
+    torsion_abort(); /* LCOV_EXCL_LINE */
+
+  mps_import(mp, s, yp, n);
+  mps_import(fp, s, yp, n);
+  mps_import(gp, s, xp, n);
+
+  for (i = 0; i < s; i++) {
+    dp[i] = 0;
+    ep[i] = 0;
+  }
+
+  ep[0] = 1;
+
+  *mi = mps_modinv(yp[0]);
+
+  return s;
+}
+
+int
+mpn_invert_sec(mp_ptr rp, mp_srcptr xp,
+               mp_srcptr yp, mp_size_t n, mp_ptr scratch) {
+  /* Constant-time assuming x < y and y is public. */
+  mp_size_t s = MPN_SAFEGCD_LIMBS(n);
+  mp_long_t *fp = (mp_long_t *)&scratch[0 * s];
+  mp_long_t *gp = (mp_long_t *)&scratch[1 * s];
+  mp_long_t *dp = (mp_long_t *)&scratch[2 * s];
+  mp_long_t *ep = (mp_long_t *)&scratch[3 * s];
+  mp_long_t *mp = (mp_long_t *)&scratch[4 * s];
+  mp_bitcnt_t bits = mpn_bitlen(yp, n);
+  mp_bitcnt_t steps;
+  mp_long_t eta = -1;
+  mp_divsteps_t t;
+  mp_limb_t mi;
+  int ret;
+
+  mps_init(fp, gp, dp, ep, mp, &mi, xp, yp, n);
+
+  if (bits == 1) {
+    mpn_zero(rp, n);
+    return 0;
+  }
+
+  /* Bernstein-Yang iteration bound (Theorem 11.2). */
+  steps = (49 * bits + (bits < 46 ? 80 : 57)) / 17;
+
+  while (steps > 0) {
+    eta = mps_divsteps(eta, fp[0], gp[0], &t);
+
+    mps_update_de(dp, ep, &t, mp, mi, s);
+    mps_update_fg(fp, gp, &t, s);
+
+    steps -= MP_MIN(steps, MP_DIVSTEPS);
+  }
+
+  ret = mps_is_unit(fp, s);
+
+  mps_normalize(dp, fp[s - 1], mp, s);
+  mps_export(rp, n, dp, s);
+
+  mpn_cnd_zero(ret ^ 1, rp, rp, n);
+
+  return ret;
+}
+
+int
+mpn_invert_var(mp_ptr rp, mp_srcptr xp,
+               mp_srcptr yp, mp_size_t n, mp_ptr scratch) {
+  mp_size_t s = MPN_SAFEGCD_LIMBS(n);
+  mp_long_t *fp = (mp_long_t *)&scratch[0 * s];
+  mp_long_t *gp = (mp_long_t *)&scratch[1 * s];
+  mp_long_t *dp = (mp_long_t *)&scratch[2 * s];
+  mp_long_t *ep = (mp_long_t *)&scratch[3 * s];
+  mp_long_t *mp = (mp_long_t *)&scratch[4 * s];
+  mp_long_t eta = -1;
+  mp_divsteps_t t;
+  mp_limb_t mi;
+  mp_size_t i;
+
+  mps_init(fp, gp, dp, ep, mp, &mi, xp, yp, n);
+
+  if (mpn_bitlen(yp, n) == 1) {
+    mpn_zero(rp, n);
+    return 0;
+  }
+
+  for (;;) {
+    for (i = 0; i < s; i++) {
+      if (gp[i] != 0)
+        break;
+    }
+
+    if (i == s)
+      break;
+
+    eta = mps_divsteps_var(eta, fp[0], gp[0], &t);
+
+    mps_update_de(dp, ep, &t, mp, mi, s);
+    mps_update_fg(fp, gp, &t, s);
+  }
+
+  if (!mps_is_unit(fp, s)) {
+    mpn_zero(rp, n);
+    return 0;
+  }
+
+  mps_normalize(dp, fp[s - 1], mp, s);
+  mps_export(rp, n, dp, s);
+
+  return 1;
+}
+
 int
 mpn_jacobi(mp_srcptr xp, mp_size_t xs,
            mp_srcptr yp, mp_size_t ys, mp_ptr scratch) {
@@ -86,6 +86,8 @@ extern "C" {
 #define mpn_gcdext __torsion_mpn_gcdext
 #define mpn_invert __torsion_mpn_invert
 #define mpn_invert_n __torsion_mpn_invert_n
+#define mpn_invert_sec __torsion_mpn_invert_sec
+#define mpn_invert_var __torsion_mpn_invert_var
 #define mpn_jacobi __torsion_mpn_jacobi
 #define mpn_jacobi_n __torsion_mpn_jacobi_n
 #define mpn_powm_sec __torsion_mpn_powm_sec
@@ -244,6 +246,9 @@ typedef void mp_rng_f(void *out, size_t size, void *arg);
  */
 
 #define MPN_INVERT_ITCH(n) (4 * ((n) + 1))
+#define MPN_SAFEGCD_LIMBS(n) (((n) * MP_LIMB_BITS + 1) / (MP_LIMB_BITS - 2) + 1)
+#define MPN_INVERT_SEC_ITCH(n) (5 * MPN_SAFEGCD_LIMBS(n))
+#define MPN_INVERT_VAR_ITCH(n) MPN_INVERT_SEC_ITCH(n)
 #define MPN_JACOBI_ITCH(n) (2 * (n))
 #define MPN_POWM_SEC_ITCH(n) (7 * (n) + (MP_WND_SIZE + 1) * (n))
 
@@ -348,6 +353,8 @@ mp_size_t mpn_gcdext(mp_ptr, mp_ptr, mp_size_t *,
                      mp_ptr, mp_size_t, mp_ptr, mp_size_t);
 int mpn_invert(mp_ptr, mp_srcptr, mp_size_t, mp_srcptr, mp_size_t, mp_ptr);
 int mpn_invert_n(mp_ptr, mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
+int mpn_invert_sec(mp_ptr, mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
+int mpn_invert_var(mp_ptr, mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
 int mpn_jacobi(mp_srcptr, mp_size_t, mp_srcptr, mp_size_t, mp_ptr);
 int mpn_jacobi_n(mp_srcptr, mp_srcptr, mp_size_t, mp_ptr);
 void mpn_powm_sec(mp_ptr,
@@ -89,6 +89,7 @@ exports.SHA3_512 = require('./sha3-512');
 exports.SHAKE = require('./shake');
 exports.SHAKE128 = require('./shake128');
 exports.SHAKE256 = require('./shake256');
+exports.sigcache = require('./sigcache');
 exports.siphash = require('./siphash');
 exports.Whirlpool = require('./whirlpool');
 exports.x25519 = require('./x25519');
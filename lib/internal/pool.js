@@ -0,0 +1,34 @@
+/*!
+ * pool.js - ecdsa nonce pools for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+const assert = require('./assert');
+
+/**
+ * NoncePool
+ */
+
+class NoncePool {
+  constructor(id, capacity, low, handle) {
+    assert(typeof id === 'string');
+    assert((capacity >>> 0) === capacity && capacity > 0);
+    assert((low >>> 0) === low && low < capacity);
+    assert(handle != null);
+
+    this.id = id;
+    this.capacity = capacity;
+    this.low = low;
+    this.handle = handle;
+    this.pending = null;
+  }
+}
+
+/*
+ * Expose
+ */
+
+module.exports = NoncePool;
@@ -0,0 +1,36 @@
+/*!
+ * prepared.js - prepared public keys for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+const assert = require('./assert');
+
+/**
+ * PreparedPublicKey
+ */
+
+class PreparedPublicKey {
+  constructor(id, type, data, handle = null) {
+    assert(typeof id === 'string');
+    assert(typeof type === 'string');
+    assert(Buffer.isBuffer(data));
+
+    this.id = id;
+    this.type = type;
+    this.data = data;
+    this.handle = handle;
+  }
+
+  encode() {
+    return this.data;
+  }
+}
+
+/*
+ * Expose
+ */
+
+module.exports = PreparedPublicKey;
@@ -0,0 +1,35 @@
+/*!
+ * signer.js - prepared signers for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+const assert = require('./assert');
+
+/**
+ * Signer
+ *
+ * Opaque signing state for a single private key:
+ * an expanded EdDSA key or a keyed RFC6979 DRBG.
+ * `publicKey` is null for the latter.
+ */
+
+class Signer {
+  constructor(id, publicKey, handle) {
+    assert(typeof id === 'string');
+    assert(publicKey === null || Buffer.isBuffer(publicKey));
+    assert(handle != null);
+
+    this.id = id;
+    this.publicKey = publicKey;
+    this.handle = handle;
+  }
+}
+
+/*
+ * Expose
+ */
+
+module.exports = Signer;
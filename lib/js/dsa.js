@@ -32,6 +32,7 @@ const HmacDRBG = require('../hmac-drbg');
 const SHA256 = require('../sha256');
 const {isProbablePrime} = require('../internal/primes');
 const asn1 = require('../internal/asn1');
+const Signer = require('../internal/signer');
 
 /*
  * Constants
@@ -951,6 +952,38 @@ function signDER(msg, key) {
   return S.encode();
 }
 
+/**
+ * Create a keyed signer.
+ * @param {Buffer} key - Private key.
+ * @returns {Signer}
+ */
+
+function signerCreate(key) {
+  const k = DSAPrivateKey.decode(key);
+
+  if (!k.isSane())
+    throw new Error('Invalid DSA private key.');
+
+  return new Signer('DSA', null, k);
+}
+
+/**
+ * Sign a message with a keyed signer (R/S).
+ * @param {Buffer} msg
+ * @param {Signer} signer
+ * @returns {Buffer} R/S-formatted signature.
+ */
+
+function signPrepared(msg, signer) {
+  assert(signer instanceof Signer);
+  assert(signer.id === 'DSA');
+
+  const k = signer.handle;
+  const S = _sign(msg, k);
+
+  return S.encodeRS(k.size());
+}
+
 /**
  * Sign a message.
  * @private
@@ -1300,6 +1333,8 @@ exports.signatureImport = signatureImport;
 exports.signatureExport = signatureExport;
 exports.sign = sign;
 exports.signDER = signDER;
+exports.signerCreate = signerCreate;
+exports.signPrepared = signPrepared;
 exports.verify = verify;
 exports.verifyDER = verifyDER;
 exports.derive = derive;
@@ -124,6 +124,12 @@ class ECDH {
     return A.encode();
   }
 
+  publicKeyFromUniformBatch(items) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromUniform(bytes));
+  }
+
   publicKeyToUniform(key, hint = rng.randomInt()) {
     const A = this.curve.decodePoint(key);
     const u = this.curve.pointToUniform(A, hint);
@@ -137,6 +143,12 @@ class ECDH {
     return A.encode();
   }
 
+  publicKeyFromHashBatch(items, pake = false) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromHash(bytes, pake));
+  }
+
   publicKeyToHash(key, subgroup = rng.randomInt()) {
     const A = this.curve.decodePoint(key);
     return this.curve.pointToHash(A, subgroup, rng);
@@ -215,6 +227,22 @@ class ECDH {
 
     return P.encode();
   }
+
+  deriveBatch(batch) {
+    assert(Array.isArray(batch));
+
+    // A bad key fails only its own item.
+    return batch.map(([pub, priv]) => {
+      const A = this.curve.decodeX(pub);
+      const a = this.curve.decodeClamped(priv);
+      const P = A.mulConst(a, rng);
+
+      if (P.isInfinity())
+        return null;
+
+      return P.encode();
+    });
+  }
 }
 
 /*
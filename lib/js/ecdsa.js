@@ -36,6 +36,9 @@ const asn1 = require('../internal/asn1');
 const Schnorr = require('./schnorr-legacy');
 const HmacDRBG = require('../hmac-drbg');
 const elliptic = require('./elliptic');
+const Signer = require('../internal/signer');
+const NoncePool = require('../internal/pool');
+const PreparedPublicKey = require('../internal/prepared');
 
 /**
  * ECDSA
@@ -204,6 +207,12 @@ class ECDSA {
     return A.encode(compress);
   }
 
+  publicKeyCreateBatch(keys, compress) {
+    assert(Array.isArray(keys));
+
+    return keys.map(key => this.publicKeyCreate(key, compress));
+  }
+
   publicKeyConvert(key, compress) {
     const A = this.curve.decodePoint(key);
     return A.encode(compress);
@@ -216,6 +225,12 @@ class ECDSA {
     return A.encode(compress);
   }
 
+  publicKeyFromUniformBatch(items, compress) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromUniform(bytes, compress));
+  }
+
   publicKeyToUniform(key, hint = rng.randomInt()) {
     const A = this.curve.decodePoint(key);
     const u = this.curve.pointToUniform(A, hint);
@@ -228,6 +243,12 @@ class ECDSA {
     return A.encode(compress);
   }
 
+  publicKeyFromHashBatch(items, compress) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromHash(bytes, compress));
+  }
+
   publicKeyToHash(key) {
     const A = this.curve.decodePoint(key);
     return this.curve.pointToHash(A, 0, rng);
@@ -245,6 +266,17 @@ class ECDSA {
     return true;
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    if (!this.publicKeyVerify(key))
+      throw new Error('Invalid public key.');
+
+    return new PreparedPublicKey(this.id, 'ecdsa', key);
+  }
+
   publicKeyExport(key) {
     const {x, y} = this.curve.decodePoint(key);
 
@@ -294,6 +326,14 @@ class ECDSA {
     return P.encode(compress);
   }
 
+  publicKeyTweakAddBatch(batch, compress) {
+    assert(Array.isArray(batch));
+
+    return batch.map(([key, tweak]) => {
+      return this.publicKeyTweakAdd(key, tweak, compress);
+    });
+  }
+
   publicKeyTweakMul(key, tweak, compress) {
     const t = this.curve.decodeScalar(tweak);
 
@@ -401,6 +441,149 @@ class ECDSA {
     return [this._encodeDER(r, s), param];
   }
 
+  noncePoolCreate(size, low = size >>> 2) {
+    return new NoncePool(this.id, size, low, []);
+  }
+
+  noncePoolSize(pool) {
+    assert(pool instanceof NoncePool);
+    return pool.handle.length;
+  }
+
+  noncePoolFill(pool) {
+    // Offline half of randomized signing:
+    //
+    //   k = random integer in [1,n-1]
+    //   R = G * k
+    //   r = x(R) mod n
+    //
+    // See ecdsa_pool_fill in libtorsion.
+    assert(pool instanceof NoncePool);
+
+    const {n} = this.curve;
+    const G = this.curve.g;
+    const items = pool.handle;
+    const want = pool.capacity - items.length;
+
+    for (let i = 0; i < want; i++) {
+      const k = this.curve.randomScalar(rng);
+      const R = G.mulBlind(k);
+      const x = R.getX();
+      const r = x.mod(n);
+
+      if (r.isZero())
+        continue;
+
+      const param = R.isOdd() | (!x.eq(r) << 1);
+
+      items.push([k.fermat(n), r, param]);
+    }
+
+    return items.length - (pool.capacity - want);
+  }
+
+  noncePoolRefill(pool) {
+    assert(pool instanceof NoncePool);
+
+    if (!pool.pending) {
+      pool.pending = new Promise((resolve, reject) => {
+        setImmediate(() => {
+          pool.pending = null;
+
+          try {
+            resolve(this.noncePoolFill(pool));
+          } catch (e) {
+            reject(e);
+          }
+        });
+      });
+    }
+
+    return pool.pending;
+  }
+
+  noncePoolClear(pool) {
+    assert(pool instanceof NoncePool);
+    pool.handle.length = 0;
+  }
+
+  signPooled(msg, key, pool) {
+    const [sig] = this.signRecoverablePooled(msg, key, pool);
+    return sig;
+  }
+
+  signRecoverablePooled(msg, key, pool) {
+    // Online half of randomized signing:
+    //
+    //   s = (r * a + m) / k mod n
+    //   s = -s mod n, if s > n / 2
+    //
+    // A nonce yielding s = 0 is thrown away.
+    // Falls back to RFC6979 if the pool is empty.
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+    assert(pool instanceof NoncePool);
+
+    const {n, nh} = this.curve;
+    const a = this.curve.decodeScalar(key);
+
+    if (a.isZero() || a.cmp(n) >= 0)
+      throw new Error('Invalid private key.');
+
+    const m = this._reduce(msg);
+
+    let result = null;
+
+    while (!result && pool.handle.length > 0) {
+      const [ki, r, param] = pool.handle.pop();
+      const s = r.mul(a).iadd(m).imod(n).imul(ki).imod(n);
+
+      if (s.isZero())
+        continue;
+
+      if (s.cmp(nh) > 0) {
+        s.ineg().imod(n);
+        result = [this._encodeCompact(r, s), param ^ 1];
+      } else {
+        result = [this._encodeCompact(r, s), param];
+      }
+    }
+
+    if (pool.handle.length <= pool.low)
+      this.noncePoolRefill(pool).catch(() => {});
+
+    if (!result)
+      return this.signRecoverable(msg, key);
+
+    return result;
+  }
+
+  signerCreate(key) {
+    assert(Buffer.isBuffer(key));
+
+    const a = this.curve.decodeScalar(key);
+
+    if (a.isZero() || a.cmp(this.curve.n) >= 0)
+      throw new Error('Invalid private key.');
+
+    return new Signer(this.id, null, Buffer.from(key));
+  }
+
+  signPrepared(msg, signer) {
+    const [sig] = this.signRecoverablePrepared(msg, signer);
+    return sig;
+  }
+
+  signRecoverablePrepared(msg, signer) {
+    // The HMAC-DRBG here has no keyed fast path;
+    // the key was validated up front, so this is
+    // plain RFC6979 signing.
+    assert(signer instanceof Signer);
+    assert(signer.id === this.id);
+
+    return this.signRecoverable(msg, signer.handle);
+  }
+
   _sign(msg, key) {
     // ECDSA Signing.
     //
@@ -502,6 +685,9 @@ class ECDSA {
   }
 
   verify(msg, sig, key) {
+    if (key instanceof PreparedPublicKey)
+      key = key.data;
+
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
     assert(Buffer.isBuffer(key));
@@ -734,6 +920,15 @@ class ECDSA {
     return this.schnorr.verifyBatch(batch);
   }
 
+  async schnorrVerifyBatchAsync(batch, threads = 1) {
+    assert((threads >>> 0) === threads);
+    return this.schnorr.verifyBatch(batch);
+  }
+
+  schnorrVerifyBatchInvalid(batch) {
+    return this.schnorr.verifyBatchInvalid(batch);
+  }
+
   /*
    * Helpers
    */
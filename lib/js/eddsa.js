@@ -85,6 +85,8 @@ const BatchRNG = require('./batch-rng');
 const BN = require('../bn');
 const elliptic = require('./elliptic');
 const rng = require('../random');
+const Signer = require('../internal/signer');
+const PreparedPublicKey = require('../internal/prepared');
 
 /*
  * EDDSA
@@ -320,6 +322,12 @@ class EDDSA {
     return A.encode();
   }
 
+  publicKeyFromUniformBatch(items) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromUniform(bytes));
+  }
+
   publicKeyToUniform(key, hint = rng.randomInt()) {
     const A = this.curve.decodePoint(key);
     const u = this.curve.pointToUniform(A, hint, this.iso);
@@ -332,6 +340,12 @@ class EDDSA {
     return A.encode();
   }
 
+  publicKeyFromHashBatch(items, pake = false) {
+    assert(Array.isArray(items));
+
+    return items.map(bytes => this.publicKeyFromHash(bytes, pake));
+  }
+
   publicKeyToHash(key, subgroup = rng.randomInt()) {
     const A = this.curve.decodePoint(key);
     return this.curve.pointToHash(A, subgroup, rng, this.iso);
@@ -349,6 +363,17 @@ class EDDSA {
     return true;
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    if (!this.publicKeyVerify(key))
+      throw new Error('Invalid public key.');
+
+    return new PreparedPublicKey(this.id, 'eddsa', key);
+  }
+
   publicKeyIsInfinity(key) {
     assert(Buffer.isBuffer(key));
 
@@ -506,19 +531,25 @@ class EDDSA {
     //
     // The same is true of `w` as `k`
     // can be re-derived as `H(w, m)`.
+    assert(Buffer.isBuffer(prefix));
+    assert(prefix.length === this.curve.adjustedSize);
+
+    const a = this.curve.decodeScalar(scalar);
+    const Araw = this.curve.g.mulBlind(a).encode();
+
+    return this._sign(msg, a, prefix, Araw, ph, ctx);
+  }
+
+  _sign(msg, a, prefix, Araw, ph, ctx) {
     if (ctx == null)
       ctx = Buffer.alloc(0);
 
     assert(Buffer.isBuffer(msg));
-    assert(Buffer.isBuffer(prefix));
-    assert(prefix.length === this.curve.adjustedSize);
 
     const {n} = this.curve;
     const G = this.curve.g;
     const k = this.hashNonce(prefix, msg, ph, ctx);
     const Rraw = G.mulBlind(k).encode();
-    const a = this.curve.decodeScalar(scalar);
-    const Araw = G.mulBlind(a).encode();
     const e = this.hashChallenge(Rraw, Araw, msg, ph, ctx);
     const s = k.add(e.mul(a)).imod(n);
 
@@ -545,7 +576,32 @@ class EDDSA {
     return this.signWithScalar(msg, key, prefix, ph, ctx);
   }
 
+  signerCreate(secret, ph, ctx) {
+    if (ctx == null)
+      ctx = Buffer.alloc(0);
+
+    assert(Buffer.isBuffer(ctx));
+
+    const [key, prefix] = this.privateKeyExpand(secret);
+    const a = this.curve.decodeScalar(key);
+    const Araw = this.curve.g.mulBlind(a).encode();
+
+    return new Signer(this.id, Araw, { a, prefix, ph, ctx });
+  }
+
+  signPrepared(msg, signer) {
+    assert(signer instanceof Signer);
+    assert(signer.id === this.id);
+
+    const {a, prefix, ph, ctx} = signer.handle;
+
+    return this._sign(msg, a, prefix, signer.publicKey, ph, ctx);
+  }
+
   verify(msg, sig, key, ph, ctx) {
+    if (key instanceof PreparedPublicKey)
+      key = key.data;
+
     if (ctx == null)
       ctx = Buffer.alloc(0);
 
@@ -707,6 +763,27 @@ class EDDSA {
     }
   }
 
+  async verifyBatchAsync(batch, ph, ctx, threads = 1) {
+    assert((threads >>> 0) === threads);
+    return this.verifyBatch(batch, ph, ctx);
+  }
+
+  verifyBatchInvalid(batch, ph, ctx) {
+    if (this.verifyBatch(batch, ph, ctx))
+      return [];
+
+    const invalid = [];
+
+    for (let i = 0; i < batch.length; i++) {
+      const [msg, sig, key] = batch[i];
+
+      if (!this.verifySingle(msg, sig, key, ph, ctx))
+        invalid.push(i);
+    }
+
+    return invalid;
+  }
+
   _verifyBatch(batch, ph, ctx) {
     // EdDSA Batch Verification.
     //
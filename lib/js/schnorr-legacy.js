@@ -265,6 +265,22 @@ class Schnorr {
     }
   }
 
+  verifyBatchInvalid(batch) {
+    if (this.verifyBatch(batch))
+      return [];
+
+    const invalid = [];
+
+    for (let i = 0; i < batch.length; i++) {
+      const [msg, sig, key] = batch[i];
+
+      if (!this.verify(msg, sig, key))
+        invalid.push(i);
+    }
+
+    return invalid;
+  }
+
   _verifyBatch(batch) {
     // Schnorr Batch Verification.
     //
@@ -31,6 +31,7 @@ const BN = require('../bn');
 const rng = require('../random');
 const SHA256 = require('../sha256');
 const elliptic = require('./elliptic');
+const PreparedPublicKey = require('../internal/prepared');
 const pre = require('./precomputed/secp256k1.json');
 
 /**
@@ -310,6 +311,17 @@ class Schnorr {
     return true;
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    if (!this.publicKeyVerify(key))
+      throw new Error('Invalid public key.');
+
+    return new PreparedPublicKey(this.id, 'schnorr', key);
+  }
+
   publicKeyExport(key) {
     const {x, y} = this.curve.decodeEven(key);
 
@@ -486,6 +498,9 @@ class Schnorr {
   }
 
   verify(msg, sig, key) {
+    if (key instanceof PreparedPublicKey)
+      key = key.data;
+
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
     assert(Buffer.isBuffer(key));
@@ -591,6 +606,27 @@ class Schnorr {
     }
   }
 
+  async verifyBatchAsync(batch, threads = 1) {
+    assert((threads >>> 0) === threads);
+    return this.verifyBatch(batch);
+  }
+
+  verifyBatchInvalid(batch) {
+    if (this.verifyBatch(batch))
+      return [];
+
+    const invalid = [];
+
+    for (let i = 0; i < batch.length; i++) {
+      const [msg, sig, key] = batch[i];
+
+      if (!this.verify(msg, sig, key))
+        invalid.push(i);
+    }
+
+    return invalid;
+  }
+
   _verifyBatch(batch) {
     // Schnorr Batch Verification.
     //
@@ -82,6 +82,37 @@ class SHA256 {
     return this._final(Buffer.alloc(32));
   }
 
+  export() {
+    assert(this.size !== FINALIZED, 'Context is not initialized.');
+    assert((this.size & 63) === 0, 'Context is not on a block boundary.');
+
+    const out = Buffer.alloc(40);
+
+    for (let i = 0; i < 8; i++)
+      writeU32(out, this.state[i], i * 4);
+
+    writeU32(out, (this.size * (1 / 0x100000000)) >>> 0, 32);
+    writeU32(out, this.size >>> 0, 36);
+
+    return out;
+  }
+
+  import(raw) {
+    assert(Buffer.isBuffer(raw) && raw.length === 40);
+
+    const hi = readU32(raw, 32);
+    const lo = readU32(raw, 36);
+
+    assert(hi < 0x200000 && (lo & 63) === 0, 'Invalid midstate.');
+
+    for (let i = 0; i < 8; i++)
+      this.state[i] = readU32(raw, i * 4);
+
+    this.size = hi * 0x100000000 + lo;
+
+    return this;
+  }
+
   _update(data, len) {
     assert(this.size !== FINALIZED, 'Context is not initialized.');
 
@@ -226,6 +257,11 @@ class SHA256 {
   static mac(data, key) {
     return SHA256.hmac().init(key).update(data).final();
   }
+
+  static tag(tag) {
+    const hash = SHA256.digest(tag);
+    return SHA256.ctx.init().update(hash).update(hash).export();
+  }
 }
 
 /*
@@ -116,6 +116,37 @@ class SHA512 {
     return this._final(Buffer.alloc(64));
   }
 
+  export() {
+    assert(this.size !== FINALIZED, 'Context is not initialized.');
+    assert((this.size & 127) === 0, 'Context is not on a block boundary.');
+
+    const out = Buffer.alloc(72);
+
+    for (let i = 0; i < 16; i++)
+      writeU32(out, this.state[i], i * 4);
+
+    writeU32(out, (this.size * (1 / 0x100000000)) >>> 0, 64);
+    writeU32(out, this.size >>> 0, 68);
+
+    return out;
+  }
+
+  import(raw) {
+    assert(Buffer.isBuffer(raw) && raw.length === 72);
+
+    const hi = readU32(raw, 64);
+    const lo = readU32(raw, 68);
+
+    assert(hi < 0x200000 && (lo & 127) === 0, 'Invalid midstate.');
+
+    for (let i = 0; i < 16; i++)
+      this.state[i] = readU32(raw, i * 4);
+
+    this.size = hi * 0x100000000 + lo;
+
+    return this;
+  }
+
   _update(data, len) {
     assert(this.size !== FINALIZED, 'Context is not initialized.');
 
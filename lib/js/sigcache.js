@@ -0,0 +1,45 @@
+/*!
+ * sigcache.js - signature cache for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ *
+ * The JS backend does not cache verifications.
+ * This module only mirrors the native API.
+ */
+
+'use strict';
+
+const assert = require('../internal/assert');
+
+/**
+ * Enable the signature cache (no-op).
+ * @param {Number} size
+ */
+
+function init(size) {
+  assert(Number.isSafeInteger(size) && size >= 0);
+}
+
+/**
+ * Remove all entries (no-op).
+ */
+
+function clear() {}
+
+/**
+ * Get cache statistics.
+ * @returns {Object}
+ */
+
+function stats() {
+  return { capacity: 0, size: 0, hits: 0, misses: 0 };
+}
+
+/*
+ * Expose
+ */
+
+exports.native = 0;
+exports.init = init;
+exports.clear = clear;
+exports.stats = stats;
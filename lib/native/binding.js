@@ -50,6 +50,13 @@ binding.hashes = {
   WHIRLPOOL: 31
 };
 
+binding.flags = {
+  __proto__: null,
+  COMPACT: 1,
+  INVERT_CHAIN: 2,
+  INVERT_SAFEGCD: 4
+};
+
 binding.curves = {
   wei: {
     __proto__: null,
@@ -184,16 +191,34 @@ const curveCaches = {
   }
 };
 
-binding.curve = function curve(type, name) {
+binding.curve = function curve(type, name, compact = false, invert = null) {
   assert(typeof type === 'string');
   assert(typeof name === 'string');
+  assert(typeof compact === 'boolean');
+  assert(invert === null || invert === 'chain' || invert === 'safegcd');
 
   const cache = curveCaches[type];
 
+  let key = name;
+  let flags = 0;
+
+  if (compact) {
+    key += ':compact';
+    flags |= binding.flags.COMPACT;
+  }
+
+  if (invert === 'chain') {
+    key += ':chain';
+    flags |= binding.flags.INVERT_CHAIN;
+  } else if (invert === 'safegcd') {
+    key += ':safegcd';
+    flags |= binding.flags.INVERT_SAFEGCD;
+  }
+
   assert(cache);
 
-  if (cache[name])
-    return cache[name];
+  if (cache[key])
+    return cache[key];
 
   const curves = binding.curves[type];
 
@@ -207,19 +232,19 @@ binding.curve = function curve(type, name) {
 
   switch (type) {
     case 'wei':
-      handle = binding.wei_curve_create(id);
+      handle = binding.wei_curve_create(id, flags);
       binding.wei_curve_randomize(handle, binding.entropy());
       break;
     case 'mont':
       handle = binding.mont_curve_create(id);
       break;
     case 'edwards':
-      handle = binding.edwards_curve_create(id);
+      handle = binding.edwards_curve_create(id, flags);
       binding.edwards_curve_randomize(handle, binding.entropy());
       break;
   }
 
-  cache[name] = handle;
+  cache[key] = handle;
 
   return handle;
 };
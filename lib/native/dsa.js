@@ -8,6 +8,7 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const Signer = require('../internal/signer');
 
 /**
  * Create params from key.
@@ -378,6 +379,35 @@ function signDER(msg, key) {
   return binding.dsa_sign_der(msg, key, binding.entropy());
 }
 
+/**
+ * Create a keyed signer.
+ * @param {Buffer} key - Private key.
+ * @returns {Signer}
+ */
+
+function signerCreate(key) {
+  assert(Buffer.isBuffer(key));
+
+  const handle = binding.dsa_signer_create(key);
+
+  return new Signer('DSA', null, handle);
+}
+
+/**
+ * Sign a message with a keyed signer (R/S).
+ * @param {Buffer} msg
+ * @param {Signer} signer
+ * @returns {Buffer} R/S-formatted signature.
+ */
+
+function signPrepared(msg, signer) {
+  assert(Buffer.isBuffer(msg));
+  assert(signer instanceof Signer);
+  assert(signer.id === 'DSA');
+
+  return binding.dsa_sign_prepared(msg, signer.handle, binding.entropy());
+}
+
 /**
  * Verify a signature (R/S).
  * @param {Buffer} msg
@@ -455,6 +485,8 @@ exports.signatureImport = signatureImport;
 exports.signatureExport = signatureExport;
 exports.sign = sign;
 exports.signDER = signDER;
+exports.signerCreate = signerCreate;
+exports.signPrepared = signPrepared;
 exports.verify = verify;
 exports.verifyDER = verifyDER;
 exports.derive = derive;
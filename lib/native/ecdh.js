@@ -104,6 +104,16 @@ class ECDH {
     return binding.ecdh_pubkey_from_uniform(this._handle, bytes);
   }
 
+  publicKeyFromUniformBatch(items) {
+    assert(this instanceof ECDH);
+    assert(Array.isArray(items));
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.ecdh_pubkey_from_uniform_batch(this._handle, items);
+  }
+
   publicKeyToUniform(key, hint = binding.hint()) {
     assert(this instanceof ECDH);
     assert(Buffer.isBuffer(key));
@@ -120,6 +130,17 @@ class ECDH {
     return binding.ecdh_pubkey_from_hash(this._handle, bytes, pake);
   }
 
+  publicKeyFromHashBatch(items, pake = false) {
+    assert(this instanceof ECDH);
+    assert(Array.isArray(items));
+    assert(typeof pake === 'boolean');
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.ecdh_pubkey_from_hash_batch(this._handle, items, pake);
+  }
+
   publicKeyToHash(key, subgroup = binding.hint()) {
     assert(this instanceof ECDH);
     assert(Buffer.isBuffer(key));
@@ -178,6 +199,20 @@ class ECDH {
 
     return binding.ecdh_derive(this._handle, pub, priv);
   }
+
+  deriveBatch(batch) {
+    assert(this instanceof ECDH);
+    assert(Array.isArray(batch));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 2);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+    }
+
+    return binding.ecdh_derive_batch(this._handle, batch);
+  }
 }
 
 /*
@@ -8,24 +8,32 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const Signer = require('../internal/signer');
+const NoncePool = require('../internal/pool');
+const PreparedPublicKey = require('../internal/prepared');
 
 /**
  * ECDSA
  */
 
 class ECDSA {
-  constructor(name) {
+  constructor(name, compact = false, invert = null) {
     assert(binding.curves.wei[name] != null);
+    assert(typeof compact === 'boolean');
+    assert(invert === null || invert === 'chain' || invert === 'safegcd');
 
     this.id = name;
     this.type = 'ecdsa';
     this.native = 2;
+    this.compact = compact;
+    this.invert = invert;
     this._ctx = null;
   }
 
   get _handle() {
     if (!this._ctx)
-      this._ctx = binding.curve('wei', this.id);
+      this._ctx = binding.curve('wei', this.id,
+                                this.compact, this.invert);
 
     return this._ctx;
   }
@@ -40,6 +48,11 @@ class ECDSA {
     return binding.wei_curve_field_bits(this._handle);
   }
 
+  get tableSize() {
+    assert(this instanceof ECDSA);
+    return binding.wei_curve_table_size(this._handle);
+  }
+
   privateKeyGenerate() {
     assert(this instanceof ECDSA);
     return binding.ecdsa_privkey_generate(this._handle, binding.entropy());
@@ -119,6 +132,17 @@ class ECDSA {
     return binding.ecdsa_pubkey_create(this._handle, key, compress);
   }
 
+  publicKeyCreateBatch(keys, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(keys));
+    assert(typeof compress === 'boolean');
+
+    for (const key of keys)
+      assert(Buffer.isBuffer(key));
+
+    return binding.ecdsa_pubkey_create_batch(this._handle, keys, compress);
+  }
+
   publicKeyConvert(key, compress = true) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -135,6 +159,19 @@ class ECDSA {
     return binding.ecdsa_pubkey_from_uniform(this._handle, bytes, compress);
   }
 
+  publicKeyFromUniformBatch(items, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(items));
+    assert(typeof compress === 'boolean');
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.ecdsa_pubkey_from_uniform_batch(this._handle,
+                                                   items,
+                                                   compress);
+  }
+
   publicKeyToUniform(key, hint = binding.hint()) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -151,6 +188,17 @@ class ECDSA {
     return binding.ecdsa_pubkey_from_hash(this._handle, bytes, compress);
   }
 
+  publicKeyFromHashBatch(items, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(items));
+    assert(typeof compress === 'boolean');
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.ecdsa_pubkey_from_hash_batch(this._handle, items, compress);
+  }
+
   publicKeyToHash(key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -165,6 +213,17 @@ class ECDSA {
     return binding.ecdsa_pubkey_verify(this._handle, key);
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    const handle = binding.ecdsa_pubkey_prepare(this._handle, key, width);
+
+    return new PreparedPublicKey(this.id, 'ecdsa', key, handle);
+  }
+
   publicKeyExport(key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -204,6 +263,21 @@ class ECDSA {
     return binding.ecdsa_pubkey_tweak_add(this._handle, key, tweak, compress);
   }
 
+  publicKeyTweakAddBatch(batch, compress = true) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+    assert(typeof compress === 'boolean');
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 2);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+    }
+
+    return binding.ecdsa_pubkey_tweak_add_batch(this._handle, batch, compress);
+  }
+
   publicKeyTweakMul(key, tweak, compress = true) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(key));
@@ -306,10 +380,117 @@ class ECDSA {
     return binding.ecdsa_sign_recoverable_der(this._handle, msg, key);
   }
 
+  noncePoolCreate(size, low = size >>> 2) {
+    assert(this instanceof ECDSA);
+    assert((size >>> 0) === size);
+    assert((low >>> 0) === low);
+
+    const handle = binding.ecdsa_pool_create(this._handle, size);
+
+    return new NoncePool(this.id, size, low, handle);
+  }
+
+  noncePoolSize(pool) {
+    assert(this instanceof ECDSA);
+    assert(pool instanceof NoncePool);
+
+    return binding.ecdsa_pool_size(this._handle, pool.handle);
+  }
+
+  noncePoolFill(pool) {
+    assert(this instanceof ECDSA);
+    assert(pool instanceof NoncePool);
+
+    return binding.ecdsa_pool_fill(this._handle, pool.handle,
+                                   binding.entropy());
+  }
+
+  noncePoolRefill(pool) {
+    assert(this instanceof ECDSA);
+    assert(pool instanceof NoncePool);
+
+    if (!pool.pending) {
+      const promise = binding.ecdsa_pool_fill_async(this._handle,
+                                                    pool.handle,
+                                                    binding.entropy());
+
+      pool.pending = promise.then((len) => {
+        pool.pending = null;
+        return len;
+      }, (err) => {
+        pool.pending = null;
+        throw err;
+      });
+    }
+
+    return pool.pending;
+  }
+
+  noncePoolClear(pool) {
+    assert(this instanceof ECDSA);
+    assert(pool instanceof NoncePool);
+
+    binding.ecdsa_pool_clear(this._handle, pool.handle);
+  }
+
+  signPooled(msg, key, pool) {
+    const [sig] = this.signRecoverablePooled(msg, key, pool);
+    return sig;
+  }
+
+  signRecoverablePooled(msg, key, pool) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(Buffer.isBuffer(key));
+    assert(pool instanceof NoncePool);
+
+    // Fall back to RFC6979 if the pool has run dry.
+    const result = this.noncePoolSize(pool) > 0
+      ? binding.ecdsa_sign_pooled(this._handle, msg, key, pool.handle)
+      : binding.ecdsa_sign_recoverable(this._handle, msg, key);
+
+    if (this.noncePoolSize(pool) <= pool.low)
+      this.noncePoolRefill(pool).catch(() => {});
+
+    return result;
+  }
+
+  signerCreate(key) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(key));
+
+    const handle = binding.ecdsa_signer_create(this._handle, key);
+
+    return new Signer(this.id, null, handle);
+  }
+
+  signPrepared(msg, signer) {
+    const [sig] = this.signRecoverablePrepared(msg, signer);
+    return sig;
+  }
+
+  signRecoverablePrepared(msg, signer) {
+    assert(this instanceof ECDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(signer instanceof Signer);
+    assert(signer.id === this.id);
+
+    return binding.ecdsa_sign_prepared(this._handle, msg, signer.handle);
+  }
+
   verify(msg, sig, key) {
     assert(this instanceof ECDSA);
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
+
+    if (key instanceof PreparedPublicKey) {
+      if (key.handle == null)
+        return this.verify(msg, sig, key.data);
+
+      return binding.ecdsa_verify_prepared(this._handle, msg, sig,
+                                           key.handle);
+    }
+
     assert(Buffer.isBuffer(key));
 
     return binding.ecdsa_verify(this._handle, msg, sig, key);
@@ -384,6 +565,39 @@ class ECDSA {
 
     return binding.schnorr_legacy_verify_batch(this._handle, batch);
   }
+
+  async schnorrVerifyBatchAsync(batch, threads = 1) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+    assert((threads >>> 0) === threads);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_legacy_verify_batch_async(this._handle,
+                                                     batch,
+                                                     threads);
+  }
+
+  schnorrVerifyBatchInvalid(batch) {
+    assert(this instanceof ECDSA);
+    assert(Array.isArray(batch));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_legacy_verify_batch_invalid(this._handle, batch);
+  }
 }
 
 /*
@@ -8,24 +8,31 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const Signer = require('../internal/signer');
+const PreparedPublicKey = require('../internal/prepared');
 
 /*
  * EDDSA
  */
 
 class EDDSA {
-  constructor(name) {
+  constructor(name, compact = false, invert = null) {
     assert(binding.curves.edwards[name] != null);
+    assert(typeof compact === 'boolean');
+    assert(invert === null || invert === 'chain' || invert === 'safegcd');
 
     this.id = name;
     this.type = 'eddsa';
     this.native = 2;
+    this.compact = compact;
+    this.invert = invert;
     this._ctx = null;
   }
 
   get _handle() {
     if (!this._ctx)
-      this._ctx = binding.curve('edwards', this.id);
+      this._ctx = binding.curve('edwards', this.id,
+                                this.compact, this.invert);
 
     return this._ctx;
   }
@@ -40,6 +47,11 @@ class EDDSA {
     return binding.edwards_curve_field_bits(this._handle);
   }
 
+  get tableSize() {
+    assert(this instanceof EDDSA);
+    return binding.edwards_curve_table_size(this._handle);
+  }
+
   privateKeyGenerate() {
     assert(this instanceof EDDSA);
     return binding.eddsa_privkey_generate(this._handle, binding.entropy());
@@ -179,6 +191,16 @@ class EDDSA {
     return binding.eddsa_pubkey_from_uniform(this._handle, bytes);
   }
 
+  publicKeyFromUniformBatch(items) {
+    assert(this instanceof EDDSA);
+    assert(Array.isArray(items));
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.eddsa_pubkey_from_uniform_batch(this._handle, items);
+  }
+
   publicKeyToUniform(key, hint = binding.hint()) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(key));
@@ -195,6 +217,17 @@ class EDDSA {
     return binding.eddsa_pubkey_from_hash(this._handle, bytes, pake);
   }
 
+  publicKeyFromHashBatch(items, pake = false) {
+    assert(this instanceof EDDSA);
+    assert(Array.isArray(items));
+    assert(typeof pake === 'boolean');
+
+    for (const bytes of items)
+      assert(Buffer.isBuffer(bytes));
+
+    return binding.eddsa_pubkey_from_hash_batch(this._handle, items, pake);
+  }
+
   publicKeyToHash(key, subgroup = binding.hint()) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(key));
@@ -213,6 +246,17 @@ class EDDSA {
     return binding.eddsa_pubkey_verify(this._handle, key);
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(this instanceof EDDSA);
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    const handle = binding.eddsa_pubkey_prepare(this._handle, key, width);
+
+    return new PreparedPublicKey(this.id, 'eddsa', key, handle);
+  }
+
   publicKeyIsInfinity(key) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(key));
@@ -362,6 +406,32 @@ class EDDSA {
                                         secret, tweak, ph, ctx);
   }
 
+  signerCreate(secret, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Buffer.isBuffer(secret));
+    assert(Buffer.isBuffer(ctx));
+
+    const handle = binding.eddsa_signer_create(this._handle, secret, ph, ctx);
+    const key = binding.eddsa_signer_pubkey(this._handle, handle);
+
+    return new Signer(this.id, key, handle);
+  }
+
+  signPrepared(msg, signer) {
+    assert(this instanceof EDDSA);
+    assert(Buffer.isBuffer(msg));
+    assert(signer instanceof Signer);
+    assert(signer.id === this.id);
+
+    return binding.eddsa_sign_prepared(this._handle, msg, signer.handle);
+  }
+
   verify(msg, sig, key, ph, ctx) {
     assert(this instanceof EDDSA);
 
@@ -372,9 +442,18 @@ class EDDSA {
 
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
-    assert(Buffer.isBuffer(key));
     assert(Buffer.isBuffer(ctx));
 
+    if (key instanceof PreparedPublicKey) {
+      if (key.handle == null)
+        return binding.eddsa_verify(this._handle, msg, sig, key.data, ph, ctx);
+
+      return binding.eddsa_verify_prepared(this._handle, msg, sig,
+                                           key.handle, ph, ctx);
+    }
+
+    assert(Buffer.isBuffer(key));
+
     return binding.eddsa_verify(this._handle, msg, sig, key, ph, ctx);
   }
 
@@ -416,6 +495,52 @@ class EDDSA {
     return binding.eddsa_verify_batch(this._handle, batch, ph, ctx);
   }
 
+  async verifyBatchAsync(batch, ph, ctx, threads = 1) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Array.isArray(batch));
+    assert(Buffer.isBuffer(ctx));
+    assert((threads >>> 0) === threads);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.eddsa_verify_batch_async(this._handle, batch,
+                                            ph, ctx, threads);
+  }
+
+  verifyBatchInvalid(batch, ph, ctx) {
+    assert(this instanceof EDDSA);
+
+    ph = binding.ternary(ph);
+
+    if (ctx == null)
+      ctx = binding.NULL;
+
+    assert(Array.isArray(batch));
+    assert(Buffer.isBuffer(ctx));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.eddsa_verify_batch_invalid(this._handle, batch, ph, ctx);
+  }
+
   derive(pub, secret) {
     assert(this instanceof EDDSA);
     assert(Buffer.isBuffer(pub));
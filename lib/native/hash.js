@@ -42,6 +42,20 @@ class Hash {
     return binding.hash_final(this._handle);
   }
 
+  export() {
+    assert(this instanceof Hash);
+    return binding.hash_export(this._handle);
+  }
+
+  import(raw) {
+    assert(this instanceof Hash);
+    assert(Buffer.isBuffer(raw));
+
+    binding.hash_import(this._handle, raw);
+
+    return this;
+  }
+
   static hash(type) {
     return new Hash(type);
   }
@@ -9,6 +9,7 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const PreparedPublicKey = require('../internal/prepared');
 const handle = binding.secp256k1;
 
 /**
@@ -191,6 +192,26 @@ function publicKeyVerify(key) {
   return binding.secp256k1_xonly_verify(handle(), key);
 }
 
+/**
+ * Prepare a public key for repeated verification.
+ * @param {Buffer} key
+ * @param {Number} [width=0]
+ * @returns {PreparedPublicKey}
+ */
+
+function publicKeyPrepare(key, width = 0) {
+  assert(Buffer.isBuffer(key));
+  assert((width >>> 0) === width);
+  assert(width === 0 || (width >= 2 && width <= 12));
+
+  // libsecp256k1 verifies against its own static
+  // tables. There is no per-key state worth keeping.
+  if (!publicKeyVerify(key))
+    throw new Error('Invalid public key.');
+
+  return new PreparedPublicKey('SECP256K1', 'schnorr', key);
+}
+
 /**
  * Export a public key to an object.
  * @param {Buffer} key
@@ -327,13 +348,17 @@ function sign(msg, key, aux = binding.entropy(32)) {
  * Verify a signature.
  * @param {Buffer} msg
  * @param {Buffer} sig
- * @param {Buffer} key
+ * @param {Buffer|PreparedPublicKey} key
  * @returns {Boolean}
  */
 
 function verify(msg, sig, key) {
   assert(Buffer.isBuffer(msg));
   assert(Buffer.isBuffer(sig));
+
+  if (key instanceof PreparedPublicKey)
+    key = key.data;
+
   assert(Buffer.isBuffer(key));
 
   return binding.secp256k1_schnorr_verify(handle(), msg, sig, key);
@@ -359,6 +384,50 @@ function verifyBatch(batch) {
   return binding.secp256k1_schnorr_verify_batch(handle(), batch);
 }
 
+/**
+ * Batch verify signatures in the background.
+ * @param {Object[]} batch
+ * @param {Number} [threads=1] - Capped at UV_THREADPOOL_SIZE.
+ * @returns {Promise<Boolean>}
+ */
+
+async function verifyBatchAsync(batch, threads = 1) {
+  assert(Array.isArray(batch));
+  assert((threads >>> 0) === threads);
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  return binding.secp256k1_schnorr_verify_batch_async(handle(), batch, threads);
+}
+
+/**
+ * Find the invalid signatures in a batch.
+ * @param {Object[]} batch
+ * @returns {Number[]}
+ */
+
+function verifyBatchInvalid(batch) {
+  assert(Array.isArray(batch));
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  // libsecp256k1 has no fault identification; use torsion.
+  return binding.schnorr_verify_batch_invalid(
+    binding.curve('wei', 'SECP256K1'), batch);
+}
+
 /**
  * Perform an ecdh.
  * @param {Buffer} pub
@@ -397,6 +466,7 @@ exports.publicKeyToUniform = publicKeyToUniform;
 exports.publicKeyFromHash = publicKeyFromHash;
 exports.publicKeyToHash = publicKeyToHash;
 exports.publicKeyVerify = publicKeyVerify;
+exports.publicKeyPrepare = publicKeyPrepare;
 exports.publicKeyExport = publicKeyExport;
 exports.publicKeyImport = publicKeyImport;
 exports.publicKeyTweakAdd = publicKeyTweakAdd;
@@ -407,4 +477,6 @@ exports.publicKeyCombine = publicKeyCombine;
 exports.sign = sign;
 exports.verify = verify;
 exports.verifyBatch = verifyBatch;
+exports.verifyBatchAsync = verifyBatchAsync;
+exports.verifyBatchInvalid = verifyBatchInvalid;
 exports.derive = derive;
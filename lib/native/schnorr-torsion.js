@@ -8,6 +8,7 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const PreparedPublicKey = require('../internal/prepared');
 
 /**
  * Schnorr
@@ -142,6 +143,17 @@ class Schnorr {
     return binding.schnorr_pubkey_verify(this._handle, key);
   }
 
+  publicKeyPrepare(key, width = 0) {
+    assert(this instanceof Schnorr);
+    assert(Buffer.isBuffer(key));
+    assert((width >>> 0) === width);
+    assert(width === 0 || (width >= 2 && width <= 12));
+
+    const handle = binding.schnorr_pubkey_prepare(this._handle, key, width);
+
+    return new PreparedPublicKey(this.id, 'schnorr', key, handle);
+  }
+
   publicKeyExport(key) {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(key));
@@ -217,6 +229,15 @@ class Schnorr {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(msg));
     assert(Buffer.isBuffer(sig));
+
+    if (key instanceof PreparedPublicKey) {
+      if (key.handle == null)
+        return this.verify(msg, sig, key.data);
+
+      return binding.schnorr_verify_prepared(this._handle, msg, sig,
+                                             key.handle);
+    }
+
     assert(Buffer.isBuffer(key));
 
     return binding.schnorr_verify(this._handle, msg, sig, key);
@@ -237,6 +258,37 @@ class Schnorr {
     return binding.schnorr_verify_batch(this._handle, batch);
   }
 
+  async verifyBatchAsync(batch, threads = 1) {
+    assert(this instanceof Schnorr);
+    assert(Array.isArray(batch));
+    assert((threads >>> 0) === threads);
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_verify_batch_async(this._handle, batch, threads);
+  }
+
+  verifyBatchInvalid(batch) {
+    assert(this instanceof Schnorr);
+    assert(Array.isArray(batch));
+
+    for (const item of batch) {
+      assert(Array.isArray(item));
+      assert(item.length === 3);
+      assert(Buffer.isBuffer(item[0]));
+      assert(Buffer.isBuffer(item[1]));
+      assert(Buffer.isBuffer(item[2]));
+    }
+
+    return binding.schnorr_verify_batch_invalid(this._handle, batch);
+  }
+
   derive(pub, priv) {
     assert(this instanceof Schnorr);
     assert(Buffer.isBuffer(pub));
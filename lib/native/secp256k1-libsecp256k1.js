@@ -9,8 +9,11 @@
 
 const assert = require('../internal/assert');
 const binding = require('./binding');
+const PreparedPublicKey = require('../internal/prepared');
 const handle = binding.secp256k1;
 
+let torsion = null;
+
 /**
  * Generate a private key.
  * @returns {Buffer}
@@ -138,6 +141,21 @@ function publicKeyCreate(key, compress = true) {
   return binding.secp256k1_pubkey_create(handle(), key, compress);
 }
 
+/**
+ * Create public keys from private keys.
+ * @param {Buffer[]} keys
+ * @param {Boolean} [compress=true]
+ * @returns {Buffer[]}
+ */
+
+function publicKeyCreateBatch(keys, compress = true) {
+  assert(Array.isArray(keys));
+
+  // libsecp256k1's single-key path is already faster
+  // than torsion's batched one.
+  return keys.map(key => publicKeyCreate(key, compress));
+}
+
 /**
  * Compress or decompress public key.
  * @param {Buffer} key
@@ -166,6 +184,21 @@ function publicKeyFromUniform(bytes, compress = true) {
   return binding.secp256k1_pubkey_from_uniform(handle(), bytes, compress);
 }
 
+/**
+ * Run an array of uniform bytes through Shallue-van de Woestijne.
+ * @param {Buffer[]} items
+ * @param {Boolean} [compress=true]
+ * @returns {Buffer[]}
+ */
+
+function publicKeyFromUniformBatch(items, compress = true) {
+  assert(Array.isArray(items));
+
+  // libsecp256k1's single-item path is already faster
+  // than torsion's batched one.
+  return items.map(bytes => publicKeyFromUniform(bytes, compress));
+}
+
 /**
  * Run public key through Shallue-van de Woestijne inverse.
  * @param {Buffer} key
@@ -194,6 +227,21 @@ function publicKeyFromHash(bytes, compress = true) {
   return binding.secp256k1_pubkey_from_hash(handle(), bytes, compress);
 }
 
+/**
+ * Create public keys from an array of 64 byte hashes.
+ * @param {Buffer[]} items
+ * @param {Boolean} [compress=true]
+ * @returns {Buffer[]}
+ */
+
+function publicKeyFromHashBatch(items, compress = true) {
+  assert(Array.isArray(items));
+
+  // libsecp256k1's single-item path is already faster
+  // than torsion's batched one.
+  return items.map(bytes => publicKeyFromHash(bytes, compress));
+}
+
 /**
  * Create a 64 byte hash from a public key.
  * @param {Buffer} key
@@ -216,6 +264,26 @@ function publicKeyVerify(key) {
   return binding.secp256k1_pubkey_verify(handle(), key);
 }
 
+/**
+ * Prepare a public key for repeated verification.
+ * @param {Buffer} key
+ * @param {Number} [width=0]
+ * @returns {PreparedPublicKey}
+ */
+
+function publicKeyPrepare(key, width = 0) {
+  assert(Buffer.isBuffer(key));
+  assert((width >>> 0) === width);
+  assert(width === 0 || (width >= 2 && width <= 12));
+
+  // libsecp256k1 verifies against its own static
+  // tables. There is no per-key state worth keeping.
+  if (!publicKeyVerify(key))
+    throw new Error('Invalid public key.');
+
+  return new PreparedPublicKey('SECP256K1', 'ecdsa', key);
+}
+
 /**
  * Export a public key to an object.
  * @param {Buffer} key
@@ -273,6 +341,21 @@ function publicKeyTweakAdd(key, tweak, compress = true) {
   return binding.secp256k1_pubkey_tweak_add(handle(), key, tweak, compress);
 }
 
+/**
+ * Compute ((g * tweak) + key) for each item.
+ * @param {Array} batch
+ * @param {Boolean} [compress=true]
+ * @returns {Buffer[]}
+ */
+
+function publicKeyTweakAddBatch(batch, compress = true) {
+  assert(Array.isArray(batch));
+
+  return batch.map(([key, tweak]) => {
+    return publicKeyTweakAdd(key, tweak, compress);
+  });
+}
+
 /**
  * Compute (key * tweak).
  * @param {Buffer} key
@@ -446,13 +529,17 @@ function signRecoverableDER(msg, key) {
  * Verify a signature.
  * @param {Buffer} msg
  * @param {Buffer} sig
- * @param {Buffer} key
+ * @param {Buffer|PreparedPublicKey} key
  * @returns {Boolean}
  */
 
 function verify(msg, sig, key) {
   assert(Buffer.isBuffer(msg));
   assert(Buffer.isBuffer(sig));
+
+  if (key instanceof PreparedPublicKey)
+    key = key.data;
+
   assert(Buffer.isBuffer(key));
 
   return binding.secp256k1_verify(handle(), msg, sig, key);
@@ -576,6 +663,173 @@ function schnorrVerifyBatch(batch) {
   return binding.secp256k1_schnorr_legacy_verify_batch(handle(), batch);
 }
 
+/**
+ * Batch verify schnorr signatures in the background.
+ * @param {Object[]} batch
+ * @param {Number} [threads=1] - Capped at UV_THREADPOOL_SIZE.
+ * @returns {Promise<Boolean>}
+ */
+
+async function schnorrVerifyBatchAsync(batch, threads = 1) {
+  assert(Array.isArray(batch));
+  assert((threads >>> 0) === threads);
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  return binding.secp256k1_schnorr_legacy_verify_batch_async(handle(),
+                                                             batch,
+                                                             threads);
+}
+
+/**
+ * Find the invalid schnorr signatures in a batch.
+ * @param {Object[]} batch
+ * @returns {Number[]}
+ */
+
+function schnorrVerifyBatchInvalid(batch) {
+  assert(Array.isArray(batch));
+
+  for (const item of batch) {
+    assert(Array.isArray(item));
+    assert(item.length === 3);
+    assert(Buffer.isBuffer(item[0]));
+    assert(Buffer.isBuffer(item[1]));
+    assert(Buffer.isBuffer(item[2]));
+  }
+
+  // libsecp256k1 has no fault identification; use torsion.
+  return binding.schnorr_legacy_verify_batch_invalid(
+    binding.curve('wei', 'SECP256K1'), batch);
+}
+
+/**
+ * Create a pool of precomputed signing nonces.
+ * @param {Number} size
+ * @param {Number} [low=size/4] - refill watermark
+ * @returns {NoncePool}
+ */
+
+function noncePoolCreate(size, low) {
+  // libsecp256k1 has no offline/online signing; use torsion.
+  return getTorsion().noncePoolCreate(size, low);
+}
+
+/**
+ * Count the nonces left in a pool.
+ * @param {NoncePool} pool
+ * @returns {Number}
+ */
+
+function noncePoolSize(pool) {
+  return getTorsion().noncePoolSize(pool);
+}
+
+/**
+ * Fill a pool synchronously.
+ * @param {NoncePool} pool
+ * @returns {Number}
+ */
+
+function noncePoolFill(pool) {
+  return getTorsion().noncePoolFill(pool);
+}
+
+/**
+ * Fill a pool on a worker thread.
+ * @param {NoncePool} pool
+ * @returns {Promise}
+ */
+
+function noncePoolRefill(pool) {
+  return getTorsion().noncePoolRefill(pool);
+}
+
+/**
+ * Erase all nonces in a pool.
+ * @param {NoncePool} pool
+ */
+
+function noncePoolClear(pool) {
+  return getTorsion().noncePoolClear(pool);
+}
+
+/**
+ * Sign a message with a pooled nonce.
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @param {NoncePool} pool
+ * @returns {Buffer}
+ */
+
+function signPooled(msg, key, pool) {
+  return getTorsion().signPooled(msg, key, pool);
+}
+
+/**
+ * Sign a message with a pooled nonce.
+ * @param {Buffer} msg
+ * @param {Buffer} key
+ * @param {NoncePool} pool
+ * @returns {Array}
+ */
+
+function signRecoverablePooled(msg, key, pool) {
+  return getTorsion().signRecoverablePooled(msg, key, pool);
+}
+
+/**
+ * Create a keyed RFC6979 signer.
+ * @param {Buffer} key
+ * @returns {Signer}
+ */
+
+function signerCreate(key) {
+  // libsecp256k1 cannot key its nonce function ahead of time; use torsion.
+  return getTorsion().signerCreate(key);
+}
+
+/**
+ * Sign a message with a keyed signer.
+ * @param {Buffer} msg
+ * @param {Signer} signer
+ * @returns {Buffer}
+ */
+
+function signPrepared(msg, signer) {
+  return getTorsion().signPrepared(msg, signer);
+}
+
+/**
+ * Sign a message with a keyed signer.
+ * @param {Buffer} msg
+ * @param {Signer} signer
+ * @returns {Array}
+ */
+
+function signRecoverablePrepared(msg, signer) {
+  return getTorsion().signRecoverablePrepared(msg, signer);
+}
+
+/*
+ * Helpers
+ */
+
+function getTorsion() {
+  if (!torsion) {
+    const ECDSA = require('./ecdsa');
+    torsion = new ECDSA('SECP256K1');
+  }
+
+  return torsion;
+}
+
 /*
  * Expose
  */
@@ -595,15 +849,20 @@ exports.privateKeyReduce = privateKeyReduce;
 exports.privateKeyNegate = privateKeyNegate;
 exports.privateKeyInvert = privateKeyInvert;
 exports.publicKeyCreate = publicKeyCreate;
+exports.publicKeyCreateBatch = publicKeyCreateBatch;
 exports.publicKeyConvert = publicKeyConvert;
 exports.publicKeyFromUniform = publicKeyFromUniform;
+exports.publicKeyFromUniformBatch = publicKeyFromUniformBatch;
 exports.publicKeyToUniform = publicKeyToUniform;
 exports.publicKeyFromHash = publicKeyFromHash;
+exports.publicKeyFromHashBatch = publicKeyFromHashBatch;
 exports.publicKeyToHash = publicKeyToHash;
 exports.publicKeyVerify = publicKeyVerify;
+exports.publicKeyPrepare = publicKeyPrepare;
 exports.publicKeyExport = publicKeyExport;
 exports.publicKeyImport = publicKeyImport;
 exports.publicKeyTweakAdd = publicKeyTweakAdd;
+exports.publicKeyTweakAddBatch = publicKeyTweakAddBatch;
 exports.publicKeyTweakMul = publicKeyTweakMul;
 exports.publicKeyCombine = publicKeyCombine;
 exports.publicKeyNegate = publicKeyNegate;
@@ -617,6 +876,16 @@ exports.sign = sign;
 exports.signRecoverable = signRecoverable;
 exports.signDER = signDER;
 exports.signRecoverableDER = signRecoverableDER;
+exports.noncePoolCreate = noncePoolCreate;
+exports.noncePoolSize = noncePoolSize;
+exports.noncePoolFill = noncePoolFill;
+exports.noncePoolRefill = noncePoolRefill;
+exports.noncePoolClear = noncePoolClear;
+exports.signPooled = signPooled;
+exports.signRecoverablePooled = signRecoverablePooled;
+exports.signerCreate = signerCreate;
+exports.signPrepared = signPrepared;
+exports.signRecoverablePrepared = signRecoverablePrepared;
 exports.verify = verify;
 exports.verifyDER = verifyDER;
 exports.recover = recover;
@@ -625,3 +894,5 @@ exports.derive = derive;
 exports.schnorrSign = schnorrSign;
 exports.schnorrVerify = schnorrVerify;
 exports.schnorrVerifyBatch = schnorrVerifyBatch;
+exports.schnorrVerifyBatchAsync = schnorrVerifyBatchAsync;
+exports.schnorrVerifyBatchInvalid = schnorrVerifyBatchInvalid;
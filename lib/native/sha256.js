@@ -40,6 +40,11 @@ class SHA256 extends Hash {
   static mac(data, key) {
     return HMAC.digest(hashes.SHA256, data, key);
   }
+
+  static tag(tag) {
+    const hash = SHA256.digest(tag);
+    return SHA256.ctx.init().update(hash).update(hash).export();
+  }
 }
 
 /*
@@ -0,0 +1,56 @@
+/*!
+ * sigcache.js - signature cache for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+const assert = require('../internal/assert');
+const binding = require('./binding');
+
+/**
+ * Enable the signature cache (or resize it).
+ * The cache is shared by every thread in the
+ * process. A size of zero disables it.
+ *
+ * Single verifications (including prepared
+ * keys) consult the cache. Batch verification
+ * bypasses it.
+ * @param {Number} size - maximum size in bytes.
+ */
+
+function init(size) {
+  assert(Number.isSafeInteger(size) && size >= 0);
+  binding.sigcache_init(size);
+}
+
+/**
+ * Remove all entries and reset the counters.
+ */
+
+function clear() {
+  binding.sigcache_clear();
+}
+
+/**
+ * Get cache statistics. `capacity` is the table
+ * size in bytes (as passed to init, rounded down
+ * to a power of two, 64 at minimum); `size` is
+ * the number of cached entries.
+ * @returns {Object}
+ */
+
+function stats() {
+  const [capacity, size, hits, misses] = binding.sigcache_stats();
+  return { capacity, size, hits, misses };
+}
+
+/*
+ * Expose
+ */
+
+exports.native = 2;
+exports.init = init;
+exports.clear = clear;
+exports.stats = stats;
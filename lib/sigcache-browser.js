@@ -0,0 +1,9 @@
+/*!
+ * sigcache.js - signature cache for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+module.exports = require('./js/sigcache');
@@ -0,0 +1,12 @@
+/*!
+ * sigcache.js - signature cache for bcrypto
+ * Copyright (c) 2020, Christopher Jeffrey (MIT License).
+ * https://github.com/bcoin-org/bcrypto
+ */
+
+'use strict';
+
+if (process.env.NODE_BACKEND === 'js')
+  module.exports = require('./js/sigcache');
+else
+  module.exports = require('./native/sigcache');
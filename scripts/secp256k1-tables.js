@@ -0,0 +1,164 @@
+'use strict';
+
+const BN = require('../lib/bn');
+const elliptic = require('../lib/js/elliptic');
+
+const ECMULT_WINDOW_SIZE = 15;
+const ECMULT_TABLE_SIZE = 1 << (ECMULT_WINDOW_SIZE - 2);
+const ECMULT_GEN_PREC_BITS = 4;
+const ECMULT_GEN_PREC_G = 1 << ECMULT_GEN_PREC_BITS;
+const ECMULT_GEN_PREC_N = 256 / ECMULT_GEN_PREC_BITS;
+
+const curve = elliptic.curve('SECP256K1');
+
+function fmt(point) {
+  const p = point.toP();
+
+  if (p.isInfinity())
+    throw new Error('Unexpected infinity.');
+
+  const buf = Buffer.concat([
+    p.getX().encode('be', 32),
+    p.getY().encode('be', 32)
+  ]);
+
+  const words = [];
+
+  for (let i = 0; i < buf.length; i += 4)
+    words.push('0x' + buf.toString('hex', i, i + 4) + 'UL');
+
+  return 'SC(' + words.slice(0, 8).join(', ') + ',\n'
+       + '   ' + words.slice(8).join(', ') + ')';
+}
+
+function oddMultiples(g) {
+  // Matches secp256k1_ecmult_odd_multiples_table_storage_var.
+  const dbl = g.dbl();
+  const out = [g];
+
+  for (let i = 1; i < ECMULT_TABLE_SIZE; i++)
+    out.push(out[i - 1].add(dbl));
+
+  return out;
+}
+
+function genPoints() {
+  // Matches secp256k1_ecmult_gen_context_build.
+  const raw = Buffer.from('The scalar for this x is unknown', 'binary');
+  const nums = curve.pointFromX(new BN(raw), false).toJ().add(curve.g.toJ());
+  const out = [];
+
+  let gbase = curve.g.toJ();
+  let numsbase = nums;
+
+  for (let j = 0; j < ECMULT_GEN_PREC_N; j++) {
+    const row = [numsbase];
+
+    for (let i = 1; i < ECMULT_GEN_PREC_G; i++)
+      row.push(row[i - 1].add(gbase));
+
+    for (let i = 0; i < ECMULT_GEN_PREC_BITS; i++)
+      gbase = gbase.dbl();
+
+    numsbase = numsbase.dbl();
+
+    // In the last iteration, numsbase is (1 - 2^j) * nums instead.
+    if (j === ECMULT_GEN_PREC_N - 2)
+      numsbase = numsbase.neg().add(nums);
+
+    out.push(row);
+  }
+
+  return out;
+}
+
+function printList(points, indent) {
+  const pad = ' '.repeat(indent);
+
+  return points.map(p => pad + fmt(p).replace('\n', '\n' + pad)).join(',\n');
+}
+
+function printHeader(guard, desc) {
+  let out = '';
+
+  out += '/*!\n';
+  out += ` * ${desc}\n`;
+  out += ' * Generated by scripts/secp256k1-tables.js. Do not edit.\n';
+  out += ' */\n\n';
+  out += `#ifndef ${guard}\n`;
+  out += `#define ${guard}\n\n`;
+  out += '#include "group.h"\n\n';
+  out += '#define SC SECP256K1_GE_STORAGE_CONST\n\n';
+
+  return out;
+}
+
+function printFooter(guard) {
+  return `#undef SC\n\n#endif /* ${guard} */\n`;
+}
+
+function printGen() {
+  const guard = 'SECP256K1_ECMULT_STATIC_CONTEXT_H';
+
+  let out = '';
+
+  out += printHeader(guard, 'ecmult_static_context.h - ecmult_gen tables');
+  out += `#if ECMULT_GEN_PREC_N != ${ECMULT_GEN_PREC_N}`
+       + ` || ECMULT_GEN_PREC_G != ${ECMULT_GEN_PREC_G}\n`;
+  out += '#  error "Invalid ECMULT_GEN_PREC_BITS for static tables."\n';
+  out += '#endif\n\n';
+  out += 'static const secp256k1_ge_storage secp256k1_ecmult_static_context'
+       + '[ECMULT_GEN_PREC_N][ECMULT_GEN_PREC_G] = {\n';
+  out += genPoints().map(row => '  {\n' + printList(row, 4) + '\n  }')
+                    .join(',\n');
+  out += '\n};\n\n';
+  out += printFooter(guard);
+
+  return out;
+}
+
+function printPreG() {
+  const guard = 'SECP256K1_ECMULT_STATIC_PRE_G_H';
+
+  let g128 = curve.g.toJ();
+
+  for (let i = 0; i < 128; i++)
+    g128 = g128.dbl();
+
+  let out = '';
+
+  out += printHeader(guard, 'ecmult_static_pre_g.h - ecmult tables');
+  out += `#if ECMULT_WINDOW_SIZE != ${ECMULT_WINDOW_SIZE}\n`;
+  out += '#  error "Invalid ECMULT_WINDOW_SIZE for static tables."\n';
+  out += '#endif\n\n';
+  out += 'static const secp256k1_ge_storage secp256k1_pre_g'
+       + `[${ECMULT_TABLE_SIZE}] = {\n`;
+  out += printList(oddMultiples(curve.g.toJ()), 2);
+  out += '\n};\n\n';
+  out += '#ifdef USE_ENDOMORPHISM\n';
+  out += 'static const secp256k1_ge_storage secp256k1_pre_g_128'
+       + `[${ECMULT_TABLE_SIZE}] = {\n`;
+  out += printList(oddMultiples(g128), 2);
+  out += '\n};\n';
+  out += '#endif\n\n';
+  out += printFooter(guard);
+
+  return out;
+}
+
+function main(argv) {
+  switch (argv[2]) {
+    case 'gen':
+      process.stdout.write(printGen());
+      break;
+    case 'pre_g':
+      process.stdout.write(printPreG());
+      break;
+    default:
+      process.stderr.write('Usage: secp256k1-tables.js [gen|pre_g]\n');
+      process.exit(1);
+      break;
+  }
+}
+
+main(process.argv);
@@ -0,0 +1,327 @@
+'use strict';
+
+const assert = require('assert');
+const BN = require('../lib/bn');
+const elliptic = require('../lib/js/elliptic');
+
+require('../test/util/curves');
+
+// Matches WEI_FIXED_WIDTH and EDWARDS_FIXED_WIDTH.
+const WEI_FIXED_WIDTH = 5;
+const EDWARDS_FIXED_WIDTH = 4;
+const NAF_WIDTH_PRE = 12;
+const NAF_SIZE_PRE = 1 << (NAF_WIDTH_PRE - 2);
+
+const curves = [
+  'P256',
+  'SECP256K1',
+  'ED25519',
+  'ED448',
+  'ED448_ISO'
+];
+
+// Ed448 multiplies by G on its 4-isogenous
+// curve (see xge_mulh_iso in ecc.c).
+const NAF_ONLY = new Set(['ED448']);
+
+// Limb layouts of the field backends (see fields/*.h).
+// Saturated layouts hold Montgomery form (R = 2^256);
+// unsaturated ones place limb i at ceil(bits * i / limbs).
+const P256_LAYOUTS = [
+  ['defined(TORSION_HAVE_INT128)', { word: 64, limbs: 4, mont: 256 }],
+  [null, { word: 32, limbs: 8, mont: 256 }]
+];
+
+const SECP256K1_LAYOUTS = [
+  ['defined(TORSION_USE_LIBSECP256K1) && defined(TORSION_HAVE_INT128)',
+   { word: 64, limbs: 5, radix: 52 }],
+  ['defined(TORSION_USE_LIBSECP256K1)', { word: 32, limbs: 10, radix: 26 }],
+  ['defined(TORSION_HAVE_INT128)', { word: 64, limbs: 4, mont: 256 }],
+  [null, { word: 32, limbs: 8, mont: 256 }]
+];
+
+const P25519_LAYOUTS = [
+  ['defined(TORSION_HAVE_INT128)', { word: 64, limbs: 5, bits: 255 }],
+  [null, { word: 32, limbs: 10, bits: 255 }]
+];
+
+const P448_LAYOUTS = [
+  ['defined(TORSION_HAVE_INT128)', { word: 64, limbs: 8, bits: 448 }],
+  [null, { word: 32, limbs: 18, bits: 448 }]
+];
+
+const layouts = {
+  P256: P256_LAYOUTS,
+  SECP256K1: SECP256K1_LAYOUTS,
+  ED25519: P25519_LAYOUTS,
+  ED448: P448_LAYOUTS,
+  ED448_ISO: P448_LAYOUTS
+};
+
+function offset(layout, i) {
+  if (layout.radix != null)
+    return layout.radix * i;
+
+  if (layout.mont != null)
+    return layout.word * i;
+
+  return Math.ceil(layout.bits * i / layout.limbs);
+}
+
+function toLimbs(curve, layout, num) {
+  const out = [];
+
+  let x = num.mod(curve.p);
+
+  if (layout.mont != null)
+    x = x.ushln(layout.mont).mod(curve.p);
+
+  for (let i = 0; i < layout.limbs; i++) {
+    const lo = offset(layout, i);
+    const hi = i === layout.limbs - 1 ? lo + layout.word
+                                      : offset(layout, i + 1);
+
+    assert(hi - lo <= layout.word);
+
+    out.push(x.ushrn(lo).maskn(hi - lo));
+  }
+
+  assert(x.ushrn(offset(layout, layout.limbs - 1) + layout.word).isZero());
+
+  return out;
+}
+
+function fmtElement(curve, layout, num) {
+  const limbs = toLimbs(curve, layout, num);
+  const digits = layout.word / 4;
+  const perLine = layout.word === 64 ? 2 : 4;
+
+  let out = '    {\n';
+
+  for (let i = 0; i < limbs.length; i += perLine) {
+    const line = [];
+
+    for (const limb of limbs.slice(i, i + perLine)) {
+      const hex = '0x' + limb.toString(16, digits);
+
+      if (layout.word === 64)
+        line.push(`UINT64_C(${hex})`);
+      else
+        line.push(hex);
+    }
+
+    out += '      ' + line.join(', ');
+    out += i + perLine < limbs.length ? ',\n' : '\n';
+  }
+
+  out += '    }';
+
+  return out;
+}
+
+function fmtEntry(curve, layout, coords, inf) {
+  const fields = coords.map(num => fmtElement(curve, layout, num));
+
+  if (inf != null)
+    fields.push(`    ${inf}`);
+
+  return '  {\n' + fields.join(',\n') + '\n  }';
+}
+
+function wge(curve, point) {
+  // Entries are never the identity.
+  const p = point.toP();
+
+  assert(!p.isInfinity());
+
+  return [p.getX(), p.getY()];
+}
+
+function endo(curve, point) {
+  // Matches wge_endo_beta.
+  const [x, y] = wge(curve, point);
+
+  return [x.mul(curve.endo.beta.fromRed()), y];
+}
+
+function xge(curve, point) {
+  // Affine extended coordinates: (x, y, 1, x * y).
+  const p = point.toP();
+  const x = p.getX();
+  const y = p.getY();
+
+  return [x, y, new BN(1), x.mul(y)];
+}
+
+function nge(curve, point) {
+  // Matches nge_set_xy.
+  const p = point.toP();
+  const x = p.getX();
+  const y = p.getY();
+  const d = curve.d.fromRed();
+  const xy = x.mul(y).mod(curve.p);
+
+  if (curve.a.fromRed().eq(curve.p.subn(1)))
+    return [y.add(x), y.sub(x).mod(curve.p), xy.mul(d).muln(2)];
+
+  return [x, y, xy.mul(d)];
+}
+
+function fixedWidth(curve) {
+  return curve.type === 'short' ? WEI_FIXED_WIDTH : EDWARDS_FIXED_WIDTH;
+}
+
+function fixedPoints(curve, width) {
+  // Matches wge_fixed_points_var and xge_fixed_points.
+  const steps = Math.ceil(curve.n.bitLength() / width);
+  const size = 1 << (width - 1);
+  const out = [];
+
+  let g = curve.g.toJ();
+
+  for (let i = 0; i < steps; i++) {
+    let p = g;
+
+    for (let j = 0; j < size; j++) {
+      out.push(p);
+      p = p.add(g);
+    }
+
+    for (let j = 0; j < width; j++)
+      g = g.dbl();
+  }
+
+  return out;
+}
+
+function nafPoints(curve) {
+  // Matches wge_naf_points_var and xge_naf_points.
+  const g = curve.g.toJ();
+  const dbl = g.dbl();
+  const out = [g];
+
+  for (let i = 1; i < NAF_SIZE_PRE; i++)
+    out.push(out[i - 1].add(dbl));
+
+  return out;
+}
+
+function getCurve(id) {
+  if (id !== 'ED448_ISO')
+    return elliptic.curve(id);
+
+  // Matches curve_ed448_iso: G' = iso(G) / 4.
+  const curve = elliptic.curve('TWIST448');
+
+  const x = curve.field('a50dd973d99e99334f4b749a1d6d2cf3'
+                      + '169d70108cfd3303256706f42134da9e'
+                      + 'a3b629cbf5b7d49822b23254e364b14f'
+                      + '530c0f019124548e', 16);
+
+  const y = curve.field('a2a35d8c3cbf45f775c24ab64dfecd7f'
+                      + '622d842437779fcd525294c2ecfbf89b'
+                      + '8465cf19c906577bb5ed6aa966cc6a2f'
+                      + 'd3838ddc898c408b', 16);
+
+  curve.g = curve.point(x, y);
+
+  assert(curve.g.validate());
+  assert(curve.g.mul(curve.n).isInfinity());
+
+  return curve;
+}
+
+function printTable(id, curve, name, type, points, convert) {
+  const coords = points.map(p => convert(curve, p));
+  const inf = type === 'wge_t' ? 0 : null;
+
+  let out = '';
+
+  out += `static const ${type} `;
+  out += `tables_${id.toLowerCase()}_${name}`;
+  out += `[${points.length}] = {\n`;
+
+  for (const [i, [cond, layout]] of layouts[id].entries()) {
+    if (cond != null)
+      out += i === 0 ? `#if ${cond}\n` : `#elif ${cond}\n`;
+    else
+      out += '#else\n';
+
+    out += coords.map(c => fmtEntry(curve, layout, c, inf)).join(',\n');
+    out += '\n';
+  }
+
+  out += '#endif\n';
+  out += '};\n\n';
+
+  return out;
+}
+
+function printTables(id) {
+  const curve = getCurve(id);
+  const name = id.toLowerCase();
+  const fixed = !NAF_ONLY.has(id);
+  const width = fixedWidth(curve);
+
+  let out = '';
+
+  if (curve.type === 'short') {
+    const naf = nafPoints(curve);
+
+    if (fixed)
+      out += printTable(id, curve, 'fixed', 'wge_t',
+                        fixedPoints(curve, width), wge);
+
+    out += printTable(id, curve, 'naf', 'wge_t', naf, wge);
+
+    if (curve.endo)
+      out += printTable(id, curve, 'endo', 'wge_t', naf, endo);
+
+    out += `static const wei_tables_t tables_${name} = {\n`;
+    out += `  ${fixed ? width : 0},\n`;
+    out += fixed ? `  tables_${name}_fixed,\n` : '  NULL,\n';
+    out += `  tables_${name}_naf,\n`;
+    out += curve.endo ? `  tables_${name}_endo\n` : '  NULL\n';
+    out += '};\n';
+  } else {
+    if (fixed)
+      out += printTable(id, curve, 'fixed', 'nge_t',
+                        fixedPoints(curve, width), nge);
+
+    out += printTable(id, curve, 'naf', 'xge_t', nafPoints(curve), xge);
+
+    out += `static const edwards_tables_t tables_${name} = {\n`;
+    out += `  ${fixed ? width : 0},\n`;
+    out += fixed ? `  tables_${name}_fixed,\n` : '  NULL,\n';
+    out += `  tables_${name}_naf\n`;
+    out += '};\n';
+  }
+
+  return out;
+}
+
+function main(argv) {
+  const ids = argv.length > 2 ? argv.slice(2) : curves;
+
+  let out = '';
+
+  out += '/*!\n';
+  out += ' * tables.h - precomputed tables for libtorsion\n';
+  out += ' * Copyright (c) 2020, Christopher Jeffrey (MIT License).\n';
+  out += ' * https://github.com/bcoin-org/libtorsion\n';
+  out += ' *\n';
+  out += ' * Generated by scripts/torsion-tables.js. Do not edit.\n';
+  out += ' *\n';
+  out += ' * Entries are stored in the limb layout of each field\n';
+  out += ' * backend so contexts can point at them directly.\n';
+  out += ' */\n';
+
+  for (const id of ids) {
+    out += '\n';
+    out += printTables(id);
+  }
+
+  process.stdout.write(out);
+}
+
+main(process.argv);
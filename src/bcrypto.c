@@ -10,6 +10,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 #include <node_api.h>
 
 #include <torsion/aead.h>
@@ -46,7 +52,10 @@
 } while (0)
 
 #define ENTROPY_SIZE 32
-#define SCRATCH_SIZE 64
+#define SCRATCH_SIZE 1024
+#define BATCH_CHUNK_SIZE 64
+#define BATCH_MAX_THREADS 256
+#define SIGCACHE_MAX_KICKS 8
 
 #define MAX_BUFFER_LENGTH \
   (sizeof(uintptr_t) == 4 ? 0x3ffffffful : 0xfffffffeul)
@@ -167,6 +176,7 @@ typedef struct bcrypto_edwards_s {
   size_t priv_size;
   size_t pub_size;
   size_t sig_size;
+  uint32_t type;
 } bcrypto_edwards_curve_t;
 
 typedef struct bcrypto_hash_s {
@@ -230,8 +240,44 @@ typedef struct bcrypto_wei_s {
   size_t sig_size;
   size_t legacy_size;
   size_t schnorr_size;
+  uint32_t type;
 } bcrypto_wei_curve_t;
 
+typedef struct bcrypto_wei_prepared_s {
+  const wei_curve_t *ctx;
+  napi_ref ref;
+  wei_prepared_t *key;
+  uint8_t pub[ECDSA_MAX_PUB_SIZE];
+  size_t pub_len;
+  int schnorr;
+} bcrypto_wei_prepared_t;
+
+typedef struct bcrypto_wei_signer_s {
+  const wei_curve_t *ctx;
+  napi_ref ref;
+  wei_signer_t *signer;
+} bcrypto_wei_signer_t;
+
+typedef struct bcrypto_wei_pool_s {
+  const wei_curve_t *ctx;
+  napi_ref ref;
+  wei_pool_t *pool;
+  uint32_t size;
+} bcrypto_wei_pool_t;
+
+typedef struct bcrypto_edwards_prepared_s {
+  const edwards_curve_t *ctx;
+  napi_ref ref;
+  edwards_prepared_t *key;
+  uint8_t pub[EDDSA_MAX_PUB_SIZE];
+} bcrypto_edwards_prepared_t;
+
+typedef struct bcrypto_edwards_signer_s {
+  const edwards_curve_t *ctx;
+  napi_ref ref;
+  edwards_signer_t *signer;
+} bcrypto_edwards_signer_t;
+
 /*
  * Assertions
  */
@@ -314,6 +360,676 @@ read_value_string_latin1(napi_env env, napi_value value,
   return napi_ok;
 }
 
+/*
+ * Batch Verification
+ */
+
+typedef struct bcrypto_batch_s {
+  uint8_t *data;
+  const uint8_t **ptrs;
+  size_t *lens;
+  const uint8_t **msgs;
+  const uint8_t **sigs;
+  const uint8_t **pubs;
+  size_t *msg_lens;
+  size_t *sig_lens;
+  size_t *pub_lens;
+  uint32_t length;
+} bcrypto_batch_t;
+
+typedef struct bcrypto_verify_job_s bcrypto_verify_job_t;
+
+typedef struct bcrypto_verify_worker_s {
+  bcrypto_verify_job_t *job;
+  bcrypto_batch_t batch;
+  int result;
+  napi_async_work work;
+} bcrypto_verify_worker_t;
+
+struct bcrypto_verify_job_s {
+  bcrypto_batch_t batch;
+  void *curve;
+  int32_t ph;
+  uint8_t *ctx;
+  size_t ctx_len;
+  int (*verify)(void *data);
+  bcrypto_verify_worker_t *workers;
+  uint32_t threads;
+  uint32_t pending;
+  int result;
+  int error;
+  napi_ref ref;
+  napi_deferred deferred;
+};
+
+static void
+bcrypto_batch_clear(bcrypto_batch_t *batch) {
+  bcrypto_free(batch->data);
+  bcrypto_free((void *)batch->ptrs);
+  bcrypto_free(batch->lens);
+}
+
+static int
+bcrypto_batch_init(napi_env env, bcrypto_batch_t *batch, napi_value value) {
+  napi_value item, items[3];
+  uint32_t i, j, length, item_len;
+  const uint8_t *ptr;
+  size_t len;
+
+  CHECK(napi_get_array_length(env, value, &length) == napi_ok);
+
+  batch->data = NULL;
+  batch->ptrs = NULL;
+  batch->lens = NULL;
+  batch->length = length;
+
+  if (length == 0)
+    return 1;
+
+  batch->ptrs = bcrypto_malloc(3 * length * sizeof(uint8_t *));
+  batch->lens = bcrypto_malloc(3 * length * sizeof(size_t));
+
+  if (batch->ptrs == NULL || batch->lens == NULL) {
+    bcrypto_batch_clear(batch);
+    return 0;
+  }
+
+  batch->msgs = &batch->ptrs[length * 0];
+  batch->sigs = &batch->ptrs[length * 1];
+  batch->pubs = &batch->ptrs[length * 2];
+  batch->msg_lens = &batch->lens[length * 0];
+  batch->sig_lens = &batch->lens[length * 1];
+  batch->pub_lens = &batch->lens[length * 2];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, value, i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 3);
+
+    for (j = 0; j < 3; j++) {
+      CHECK(napi_get_element(env, item, j, &items[j]) == napi_ok);
+      CHECK(napi_get_buffer_info(env, items[j], (void **)&ptr,
+                                 &len) == napi_ok);
+
+      batch->ptrs[length * j + i] = ptr;
+      batch->lens[length * j + i] = len;
+    }
+  }
+
+  return 1;
+}
+
+static int
+bcrypto_batch_copy(napi_env env, bcrypto_batch_t *batch, napi_value value) {
+  size_t i, size = 0;
+  uint8_t *data;
+
+  if (!bcrypto_batch_init(env, batch, value))
+    return 0;
+
+  for (i = 0; i < 3 * (size_t)batch->length; i++)
+    size += batch->lens[i];
+
+  /* All messages may be empty. */
+  batch->data = bcrypto_malloc(size + 1);
+
+  if (batch->data == NULL) {
+    bcrypto_batch_clear(batch);
+    return 0;
+  }
+
+  data = batch->data;
+
+  for (i = 0; i < 3 * (size_t)batch->length; i++) {
+    size_t len = batch->lens[i];
+
+    if (len > 0)
+      memcpy(data, batch->ptrs[i], len);
+
+    batch->ptrs[i] = data;
+
+    data += len;
+  }
+
+  return 1;
+}
+
+static uint32_t
+bcrypto_batch_filter(bcrypto_batch_t *batch,
+                     uint32_t *map,
+                     uint8_t *bad,
+                     size_t sig_size,
+                     size_t pub_size) {
+  /* Move well-formed items to the front of the
+     batch and flag the rest as invalid up front.
+     A `pub_size` of zero accepts any key length. */
+  uint32_t i, j = 0;
+
+  for (i = 0; i < batch->length; i++) {
+    bad[i] = batch->sig_lens[i] != sig_size
+          || (pub_size != 0 && batch->pub_lens[i] != pub_size);
+
+    if (bad[i])
+      continue;
+
+    batch->msgs[j] = batch->msgs[i];
+    batch->sigs[j] = batch->sigs[i];
+    batch->pubs[j] = batch->pubs[i];
+    batch->msg_lens[j] = batch->msg_lens[i];
+    batch->sig_lens[j] = batch->sig_lens[i];
+    batch->pub_lens[j] = batch->pub_lens[i];
+
+    map[j++] = i;
+  }
+
+  return j;
+}
+
+static napi_value
+bcrypto_batch_invalid(napi_env env,
+                      uint8_t *bad,
+                      const uint32_t *map,
+                      const size_t *invalid,
+                      size_t count,
+                      uint32_t length) {
+  napi_value result, index;
+  uint32_t i, j = 0;
+  size_t k;
+
+  for (k = 0; k < count; k++)
+    bad[map[invalid[k]]] = 1;
+
+  CHECK(napi_create_array(env, &result) == napi_ok);
+
+  for (i = 0; i < length; i++) {
+    if (!bad[i])
+      continue;
+
+    CHECK(napi_create_uint32(env, i, &index) == napi_ok);
+    CHECK(napi_set_element(env, result, j++, index) == napi_ok);
+  }
+
+  return result;
+}
+
+static void
+bcrypto_verify_execute_(napi_env env, void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+
+  (void)env;
+
+  if (w->batch.length == 0)
+    w->result = 1;
+  else
+    w->result = w->job->verify(w);
+}
+
+static void
+bcrypto_verify_complete_(napi_env env, napi_status status, void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_verify_job_t *job = w->job;
+  napi_value result, strval, errval;
+
+  if (status != napi_ok)
+    job->error = 1;
+
+  job->result &= w->result;
+
+  CHECK(napi_delete_async_work(env, w->work) == napi_ok);
+
+  if (--job->pending > 0)
+    return;
+
+  if (!job->error) {
+    CHECK(napi_get_boolean(env, job->result, &result) == napi_ok);
+    CHECK(napi_resolve_deferred(env, job->deferred, result) == napi_ok);
+  } else {
+    CHECK(napi_create_string_latin1(env, JS_ERR_SIGNATURE, NAPI_AUTO_LENGTH,
+                                    &strval) == napi_ok);
+    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
+    CHECK(napi_reject_deferred(env, job->deferred, errval) == napi_ok);
+  }
+
+  CHECK(napi_delete_reference(env, job->ref) == napi_ok);
+
+  bcrypto_batch_clear(&job->batch);
+  bcrypto_free(job->ctx);
+  bcrypto_free(job->workers);
+  bcrypto_free(job);
+}
+
+static bcrypto_verify_job_t *
+bcrypto_verify_job_create(napi_env env,
+                          napi_value batch,
+                          int32_t ph,
+                          const uint8_t *ctx,
+                          size_t ctx_len) {
+  bcrypto_verify_job_t *job = bcrypto_xmalloc(sizeof(bcrypto_verify_job_t));
+
+  job->curve = NULL;
+  job->ph = ph;
+  job->ctx = bcrypto_malloc(ctx_len);
+  job->ctx_len = ctx_len;
+  job->verify = NULL;
+  job->workers = NULL;
+  job->threads = 0;
+  job->pending = 0;
+  job->result = 1;
+  job->error = 0;
+
+  if (job->ctx == NULL && ctx_len != 0) {
+    bcrypto_free(job);
+    return NULL;
+  }
+
+  if (!bcrypto_batch_copy(env, &job->batch, batch)) {
+    bcrypto_free(job->ctx);
+    bcrypto_free(job);
+    return NULL;
+  }
+
+  if (ctx_len > 0)
+    memcpy(job->ctx, ctx, ctx_len);
+
+  return job;
+}
+
+static uint32_t
+bcrypto_threadpool_size(void) {
+  /* Jobs beyond the size of the libuv threadpool
+   * would only queue behind one another. Parse
+   * UV_THREADPOOL_SIZE the same way libuv does.
+   */
+  const char *val = getenv("UV_THREADPOOL_SIZE");
+  int size = 4;
+
+  if (val != NULL)
+    size = atoi(val);
+
+  if (size < 1)
+    size = 1;
+
+  if (size > BATCH_MAX_THREADS)
+    size = BATCH_MAX_THREADS;
+
+  return size;
+}
+
+static napi_value
+bcrypto_verify_job_queue(napi_env env,
+                         bcrypto_verify_job_t *job,
+                         napi_value handle,
+                         uint32_t threads,
+                         const char *name) {
+  /* Each thread verifies a contiguous slice of the
+   * batch with its own scratch space. The batch
+   * coefficients are derived from a hash of each
+   * slice, so no per-thread seeding is involved.
+   * A batch is valid if every sub-batch is valid.
+   */
+  uint32_t length = job->batch.length;
+  uint32_t max = (length + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+  uint32_t pool = bcrypto_threadpool_size();
+  uint32_t i, chunk, start;
+  napi_value workname, result;
+
+  if (threads > max)
+    threads = max;
+
+  if (threads > pool)
+    threads = pool;
+
+  if (threads == 0)
+    threads = 1;
+
+  chunk = (length + threads - 1) / threads;
+
+  job->workers = bcrypto_xmalloc(threads * sizeof(bcrypto_verify_worker_t));
+  job->threads = threads;
+  job->pending = threads;
+
+  CHECK(napi_get_value_external(env, handle, &job->curve) == napi_ok);
+  CHECK(napi_create_reference(env, handle, 1, &job->ref) == napi_ok);
+
+  CHECK(napi_create_string_latin1(env, name, NAPI_AUTO_LENGTH,
+                                  &workname) == napi_ok);
+
+  CHECK(napi_create_promise(env, &job->deferred, &result) == napi_ok);
+
+  for (i = 0; i < threads; i++) {
+    bcrypto_verify_worker_t *w = &job->workers[i];
+    bcrypto_batch_t *batch = &w->batch;
+
+    start = i * chunk;
+
+    if (start > length)
+      start = length;
+
+    batch->data = NULL;
+    batch->ptrs = NULL;
+    batch->lens = NULL;
+    batch->length = length - start < chunk ? length - start : chunk;
+
+    if (length > 0) {
+      batch->msgs = job->batch.msgs + start;
+      batch->sigs = job->batch.sigs + start;
+      batch->pubs = job->batch.pubs + start;
+      batch->msg_lens = job->batch.msg_lens + start;
+      batch->sig_lens = job->batch.sig_lens + start;
+      batch->pub_lens = job->batch.pub_lens + start;
+    }
+
+    w->job = job;
+    w->result = 0;
+
+    CHECK(napi_create_async_work(env,
+                                 NULL,
+                                 workname,
+                                 bcrypto_verify_execute_,
+                                 bcrypto_verify_complete_,
+                                 w,
+                                 &w->work) == napi_ok);
+  }
+
+  for (i = 0; i < threads; i++)
+    CHECK(napi_queue_async_work(env, job->workers[i].work) == napi_ok);
+
+  return result;
+}
+
+/*
+ * Signature Cache
+ */
+
+/* Consulted by the single verify paths, prepared
+   keys included. Batch verification bypasses it,
+   as a batch is accepted or rejected as a whole. */
+
+#define SIGCACHE_ECDSA 0
+#define SIGCACHE_SCHNORR 1
+#define SIGCACHE_EDDSA 2
+#define SIGCACHE_SECP256K1 3
+
+typedef struct bcrypto_sigcache_s {
+  uint8_t (*table)[32];
+  size_t mask;
+  size_t entries;
+  uint64_t hits;
+  uint64_t misses;
+  uint8_t salt[32];
+  int salted;
+} bcrypto_sigcache_t;
+
+/* Shared by every environment (including worker threads). */
+static bcrypto_sigcache_t bcrypto_sigcache;
+
+#ifdef _WIN32
+static SRWLOCK bcrypto_sigcache_mutex = SRWLOCK_INIT;
+#else
+static pthread_mutex_t bcrypto_sigcache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void
+bcrypto_sigcache_lock(void) {
+#ifdef _WIN32
+  AcquireSRWLockExclusive(&bcrypto_sigcache_mutex);
+#else
+  CHECK(pthread_mutex_lock(&bcrypto_sigcache_mutex) == 0);
+#endif
+}
+
+static void
+bcrypto_sigcache_unlock(void) {
+#ifdef _WIN32
+  ReleaseSRWLockExclusive(&bcrypto_sigcache_mutex);
+#else
+  CHECK(pthread_mutex_unlock(&bcrypto_sigcache_mutex) == 0);
+#endif
+}
+
+static void
+bcrypto_sigcache_write(uint8_t *out, uint64_t x) {
+  int i;
+
+  for (i = 0; i < 8; i++)
+    out[i] = x >> (i * 8);
+}
+
+static size_t
+bcrypto_sigcache_slot(const uint8_t *key, size_t mask, int i) {
+  const uint8_t *p = key + i * 8;
+  uint64_t x = 0;
+  int j;
+
+  for (j = 7; j >= 0; j--)
+    x = (x << 8) | p[j];
+
+  return (size_t)x & mask;
+}
+
+static int
+bcrypto_sigcache_has(uint8_t *key,
+                     uint32_t type,
+                     uint32_t curve,
+                     const uint8_t *msg,
+                     size_t msg_len,
+                     const uint8_t *sig,
+                     size_t sig_len,
+                     const uint8_t *pub,
+                     size_t pub_len,
+                     const uint8_t *ctx,
+                     size_t ctx_len) {
+  /* key = SHA256(salt || type || curve || lengths ||
+   *              msg || sig || pub || ctx)
+   *
+   * The key is derived and looked up under a single
+   * lock (init() may be writing the salt on another
+   * thread). Empty slots are zeroed, so we set the
+   * low bit to keep a key from looking empty.
+   *
+   * Returns 1 on a hit, 0 on a miss (`key` is then
+   * ready for bcrypto_sigcache_add) and -1 if the
+   * cache is disabled.
+   */
+  bcrypto_sigcache_t *cache = &bcrypto_sigcache;
+  uint8_t lens[48];
+  sha256_t hash;
+  size_t i0, i1;
+  int ret = -1;
+
+  bcrypto_sigcache_write(lens + 0, type);
+  bcrypto_sigcache_write(lens + 8, curve);
+  bcrypto_sigcache_write(lens + 16, msg_len);
+  bcrypto_sigcache_write(lens + 24, sig_len);
+  bcrypto_sigcache_write(lens + 32, pub_len);
+  bcrypto_sigcache_write(lens + 40, ctx_len);
+
+  bcrypto_sigcache_lock();
+
+  if (cache->table != NULL) {
+    sha256_init(&hash);
+    sha256_update(&hash, cache->salt, 32);
+    sha256_update(&hash, lens, sizeof(lens));
+    sha256_update(&hash, msg, msg_len);
+    sha256_update(&hash, sig, sig_len);
+    sha256_update(&hash, pub, pub_len);
+    sha256_update(&hash, ctx, ctx_len);
+    sha256_final(&hash, key);
+
+    key[0] |= 1;
+
+    i0 = bcrypto_sigcache_slot(key, cache->mask, 0);
+    i1 = bcrypto_sigcache_slot(key, cache->mask, 1);
+
+    ret = memcmp(cache->table[i0], key, 32) == 0
+       || memcmp(cache->table[i1], key, 32) == 0;
+
+    if (ret)
+      cache->hits += 1;
+    else
+      cache->misses += 1;
+  }
+
+  bcrypto_sigcache_unlock();
+
+  return ret;
+}
+
+static void
+bcrypto_sigcache_add(const uint8_t *key) {
+  /* Cuckoo insertion: every key has two candidate
+   * slots. If both are taken, the key displaces the
+   * occupant of one, which moves to its other slot.
+   * After SIGCACHE_MAX_KICKS displacements the last
+   * homeless key is dropped; the table never grows.
+   */
+  bcrypto_sigcache_t *cache = &bcrypto_sigcache;
+  uint8_t item[32], tmp[32];
+  size_t i, i0, i1, pos;
+
+  bcrypto_sigcache_lock();
+
+  if (cache->table == NULL)
+    goto done;
+
+  i0 = bcrypto_sigcache_slot(key, cache->mask, 0);
+  i1 = bcrypto_sigcache_slot(key, cache->mask, 1);
+
+  if (memcmp(cache->table[i0], key, 32) == 0
+      || memcmp(cache->table[i1], key, 32) == 0) {
+    goto done;
+  }
+
+  memcpy(item, key, 32);
+
+  pos = (cache->table[i0][0] & 1) ? i1 : i0;
+
+  for (i = 0; i < SIGCACHE_MAX_KICKS; i++) {
+    if ((cache->table[pos][0] & 1) == 0) {
+      memcpy(cache->table[pos], item, 32);
+      cache->entries += 1;
+      break;
+    }
+
+    memcpy(tmp, cache->table[pos], 32);
+    memcpy(cache->table[pos], item, 32);
+    memcpy(item, tmp, 32);
+
+    i0 = bcrypto_sigcache_slot(item, cache->mask, 0);
+
+    if (pos == i0)
+      pos = bcrypto_sigcache_slot(item, cache->mask, 1);
+    else
+      pos = i0;
+  }
+
+done:
+  bcrypto_sigcache_unlock();
+}
+
+static napi_value
+bcrypto_sigcache_init(napi_env env, napi_callback_info info) {
+  bcrypto_sigcache_t *cache = &bcrypto_sigcache;
+  napi_value argv[1];
+  size_t argc = 1;
+  uint8_t (*table)[32] = NULL;
+  size_t size = 0;
+  int64_t bytes;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_int64(env, argv[0], &bytes) == napi_ok);
+  CHECK(bytes >= 0);
+
+  /* Round down to a power of two, but never below
+     one bucket (two slots): a non-zero size always
+     enables the cache. */
+  if (bytes > 0) {
+    size = 2;
+
+    while (size <= (uint64_t)bytes / 64 && size <= (SIZE_MAX >> 6))
+      size <<= 1;
+
+    table = bcrypto_malloc(size * 32);
+
+    JS_ASSERT(table != NULL, JS_ERR_ALLOC);
+
+    memset(table, 0, size * 32);
+  }
+
+  bcrypto_sigcache_lock();
+
+  if (!cache->salted) {
+    CHECK(torsion_getrandom(cache->salt, 32));
+    cache->salted = 1;
+  }
+
+  bcrypto_free(cache->table);
+
+  cache->table = table;
+  cache->mask = size - 1;
+  cache->entries = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+
+  bcrypto_sigcache_unlock();
+
+  return argv[0];
+}
+
+static napi_value
+bcrypto_sigcache_clear(napi_env env, napi_callback_info info) {
+  bcrypto_sigcache_t *cache = &bcrypto_sigcache;
+  napi_value result;
+
+  (void)info;
+
+  bcrypto_sigcache_lock();
+
+  if (cache->table != NULL)
+    memset(cache->table, 0, (cache->mask + 1) * 32);
+
+  cache->entries = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+
+  bcrypto_sigcache_unlock();
+
+  CHECK(napi_get_undefined(env, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_sigcache_stats(napi_env env, napi_callback_info info) {
+  bcrypto_sigcache_t *cache = &bcrypto_sigcache;
+  napi_value items[4];
+  napi_value result;
+  double stats[4];
+  int i;
+
+  (void)info;
+
+  bcrypto_sigcache_lock();
+
+  /* Capacity is in bytes, as passed to init(). */
+  stats[0] = cache->table != NULL ? (double)(cache->mask + 1) * 32 : 0;
+  stats[1] = (double)cache->entries;
+  stats[2] = (double)cache->hits;
+  stats[3] = (double)cache->misses;
+
+  bcrypto_sigcache_unlock();
+
+  CHECK(napi_create_array_with_length(env, 4, &result) == napi_ok);
+
+  for (i = 0; i < 4; i++) {
+    CHECK(napi_create_double(env, stats[i], &items[i]) == napi_ok);
+    CHECK(napi_set_element(env, result, i, items[i]) == napi_ok);
+  }
+
+  return result;
+}
+
 /*
  * AEAD
  */
@@ -3813,18 +4529,81 @@ bcrypto_dsa_sign(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static void
+bcrypto_dsa_signer_destroy(napi_env env, void *data, void *hint) {
+  (void)env;
+  (void)hint;
+
+  dsa_signer_destroy((dsa_signer_t *)data);
+}
+
 static napi_value
-bcrypto_dsa_sign_der(napi_env env, napi_callback_info info) {
-  napi_value argv[3];
-  size_t argc = 3;
-  uint8_t out[DSA_MAX_DER_SIZE];
-  size_t out_len = DSA_MAX_DER_SIZE;
-  const uint8_t *msg, *key, *entropy;
-  size_t msg_len, key_len, entropy_len;
-  napi_value result;
+bcrypto_dsa_signer_create(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  const uint8_t *key;
+  size_t key_len;
+  dsa_signer_t *signer;
+  napi_value handle;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 3);
+  CHECK(argc == 1);
+  CHECK(napi_get_buffer_info(env, argv[0], (void **)&key, &key_len) == napi_ok);
+
+  signer = dsa_signer_create(key, key_len);
+
+  JS_ASSERT(signer != NULL, JS_ERR_PRIVKEY);
+
+  CHECK(napi_create_external(env,
+                             signer,
+                             bcrypto_dsa_signer_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_dsa_sign_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[DSA_MAX_SIG_SIZE];
+  size_t out_len = DSA_MAX_SIG_SIZE;
+  const uint8_t *msg, *entropy;
+  size_t msg_len, entropy_len;
+  dsa_signer_t *signer;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_buffer_info(env, argv[0], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&signer) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+  JS_ASSERT(dsa_sign_prepared(out, &out_len, msg, msg_len, signer, entropy),
+            JS_ERR_SIGN);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  torsion_cleanse((void *)entropy, entropy_len);
+
+  return result;
+}
+
+static napi_value
+bcrypto_dsa_sign_der(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[DSA_MAX_DER_SIZE];
+  size_t out_len = DSA_MAX_DER_SIZE;
+  const uint8_t *msg, *key, *entropy;
+  size_t msg_len, key_len, entropy_len;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
   CHECK(napi_get_buffer_info(env, argv[0], (void **)&msg, &msg_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[1], (void **)&key, &key_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&entropy,
@@ -4165,6 +4944,60 @@ bcrypto_ecdh_pubkey_from_uniform(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdh_pubkey_from_uniform_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t **items;
+  size_t item_len;
+  uint32_t i, length;
+  bcrypto_mont_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + ECDH_MAX_PUB_SIZE));
+
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
+
+  ecdh_pubkey_from_uniform_batch(ec->ctx, out, items, length);
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, ec->field_size, out + i * ec->field_size,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(items);
+
+  return result;
+}
+
 static napi_value
 bcrypto_ecdh_pubkey_to_uniform(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -4222,6 +5055,64 @@ bcrypto_ecdh_pubkey_from_hash(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdh_pubkey_from_hash_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t **items;
+  size_t item_len;
+  uint32_t i, length;
+  bool pake;
+  bcrypto_mont_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &pake) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + ECDH_MAX_PUB_SIZE));
+
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size * 2;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
+
+  ok = ecdh_pubkey_from_hash_batch(ec->ctx, out, items, length, pake);
+
+  for (i = 0; ok && i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, ec->field_size, out + i * ec->field_size,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(items);
+
+  JS_ASSERT(ok, JS_ERR_PREIMAGE);
+
+  return result;
+}
+
 static napi_value
 bcrypto_ecdh_pubkey_to_hash(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -4412,10 +5303,164 @@ bcrypto_ecdh_derive(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdh_derive_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t **pubs, **privs;
+  size_t pub_len, priv_len;
+  uint32_t i, length, item_len;
+  bcrypto_mont_curve_t *ec;
+  napi_value item, items[2], result;
+  int pub_ok = 1;
+  int priv_ok = 1;
+  uint8_t *out;
+  int *valid;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  pubs = bcrypto_malloc(length * (2 * sizeof(uint8_t *)
+                                + sizeof(int)
+                                + ECDH_MAX_PUB_SIZE));
+
+  JS_ASSERT(pubs != NULL, JS_ERR_ALLOC);
+
+  privs = &pubs[length];
+  valid = (int *)&privs[length];
+  out = (uint8_t *)&valid[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 2);
+    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
+    CHECK(napi_get_buffer_info(env, items[0], (void **)&pubs[i],
+                               &pub_len) == napi_ok);
+    CHECK(napi_get_buffer_info(env, items[1], (void **)&privs[i],
+                               &priv_len) == napi_ok);
+
+    pub_ok &= pub_len == ec->field_size;
+    priv_ok &= priv_len == ec->scalar_size;
+  }
+
+  if (!pub_ok || !priv_ok) {
+    bcrypto_free(pubs);
+
+    if (!pub_ok)
+      JS_THROW(JS_ERR_PUBKEY_SIZE);
+
+    JS_THROW(JS_ERR_PRIVKEY_SIZE);
+  }
+
+  /* A bad key fails only its own item (null). */
+  ecdh_derive_batch(ec->ctx, out, valid, pubs, privs, length);
+
+  for (i = 0; i < length; i++) {
+    if (valid[i]) {
+      CHECK(napi_create_buffer_copy(env, ec->field_size,
+                                    out + i * ec->field_size,
+                                    NULL, &item) == napi_ok);
+    } else {
+      CHECK(napi_get_null(env, &item) == napi_ok);
+    }
+
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  torsion_cleanse(out, length * ec->field_size);
+
+  bcrypto_free(pubs);
+
+  return result;
+}
+
 /*
  * ECDSA
  */
 
+static void
+bcrypto_wei_prepared_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_wei_prepared_t *pre = (bcrypto_wei_prepared_t *)data;
+
+  (void)hint;
+
+  wei_prepared_destroy(pre->ctx, pre->key);
+
+  CHECK(napi_delete_reference(env, pre->ref) == napi_ok);
+
+  bcrypto_free(pre);
+}
+
+static napi_value
+bcrypto_wei_prepared_create(napi_env env,
+                            napi_value curve,
+                            const wei_curve_t *ctx,
+                            wei_prepared_t *key,
+                            const uint8_t *pub,
+                            size_t pub_len,
+                            int schnorr) {
+  /* The key holds a reference to the curve
+     handle so that `ctx` outlives it. The raw
+     key is kept for the signature cache. */
+  bcrypto_wei_prepared_t *pre;
+  napi_value handle;
+
+  CHECK(pub_len <= ECDSA_MAX_PUB_SIZE);
+
+  pre = bcrypto_xmalloc(sizeof(bcrypto_wei_prepared_t));
+  pre->ctx = ctx;
+  pre->key = key;
+  pre->pub_len = pub_len;
+  pre->schnorr = schnorr;
+
+  memcpy(pre->pub, pub, pub_len);
+
+  CHECK(napi_create_reference(env, curve, 1, &pre->ref) == napi_ok);
+
+  CHECK(napi_create_external(env,
+                             pre,
+                             bcrypto_wei_prepared_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static void
+bcrypto_wei_signer_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_wei_signer_t *sig = (bcrypto_wei_signer_t *)data;
+
+  (void)hint;
+
+  wei_signer_destroy(sig->ctx, sig->signer);
+
+  CHECK(napi_delete_reference(env, sig->ref) == napi_ok);
+
+  bcrypto_free(sig);
+}
+
+static void
+bcrypto_wei_pool_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_wei_pool_t *pool = (bcrypto_wei_pool_t *)data;
+
+  (void)hint;
+
+  wei_pool_destroy(pool->ctx, pool->pool);
+
+  CHECK(napi_delete_reference(env, pool->ref) == napi_ok);
+
+  bcrypto_free(pool);
+}
+
 static napi_value
 bcrypto_ecdsa_privkey_generate(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -4698,6 +5743,65 @@ bcrypto_ecdsa_pubkey_create(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdsa_pubkey_create_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t **privs;
+  size_t priv_len, out_len;
+  uint32_t i, length;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &compress) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  privs = bcrypto_malloc(length * (sizeof(uint8_t *) + ECDSA_MAX_PUB_SIZE));
+
+  JS_ASSERT(privs != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&privs[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&privs[i],
+                               &priv_len) == napi_ok);
+
+    ok &= priv_len == ec->scalar_size;
+  }
+
+  if (!ok) {
+    bcrypto_free(privs);
+    JS_THROW(JS_ERR_PRIVKEY_SIZE);
+  }
+
+  ok = ecdsa_pubkey_create_batch(ec->ctx, out, &out_len,
+                                 privs, length, compress);
+
+  for (i = 0; ok && i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, out_len, out + i * out_len,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(privs);
+
+  JS_ASSERT(ok, JS_ERR_PRIVKEY);
+
+  return result;
+}
+
 static napi_value
 bcrypto_ecdsa_pubkey_convert(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -4756,34 +5860,91 @@ bcrypto_ecdsa_pubkey_from_uniform(napi_env env, napi_callback_info info) {
 }
 
 static napi_value
-bcrypto_ecdsa_pubkey_to_uniform(napi_env env, napi_callback_info info) {
+bcrypto_ecdsa_pubkey_from_uniform_batch(napi_env env, napi_callback_info info) {
   napi_value argv[3];
   size_t argc = 3;
-  uint8_t out[WEI_MAX_FIELD_SIZE];
-  const uint8_t *pub;
-  size_t pub_len;
-  uint32_t hint;
+  const uint8_t **items;
+  size_t item_len, out_len;
+  uint32_t i, length;
+  bool compress;
   bcrypto_wei_curve_t *ec;
-  napi_value result;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 3);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub,
-                             &pub_len) == napi_ok);
-  CHECK(napi_get_value_uint32(env, argv[2], &hint) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &compress) == napi_ok);
 
-  JS_ASSERT(ecdsa_pubkey_to_uniform(ec->ctx, out, pub, pub_len, hint),
-            JS_ERR_PUBKEY);
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
 
-  CHECK(napi_create_buffer_copy(env, ec->field_size,
-                                out, NULL, &result) == napi_ok);
+  if (length == 0)
+    return result;
 
-  return result;
-}
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + ECDSA_MAX_PUB_SIZE));
 
-static napi_value
-bcrypto_ecdsa_pubkey_from_hash(napi_env env, napi_callback_info info) {
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
+
+  ecdsa_pubkey_from_uniform_batch(ec->ctx, out, &out_len,
+                                  items, length, compress);
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, out_len, out + i * out_len,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(items);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_pubkey_to_uniform(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[WEI_MAX_FIELD_SIZE];
+  const uint8_t *pub;
+  size_t pub_len;
+  uint32_t hint;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub,
+                             &pub_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &hint) == napi_ok);
+
+  JS_ASSERT(ecdsa_pubkey_to_uniform(ec->ctx, out, pub, pub_len, hint),
+            JS_ERR_PUBKEY);
+
+  CHECK(napi_create_buffer_copy(env, ec->field_size,
+                                out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_pubkey_from_hash(napi_env env, napi_callback_info info) {
   napi_value argv[3];
   size_t argc = 3;
   uint8_t out[ECDSA_MAX_PUB_SIZE];
@@ -4810,6 +5971,65 @@ bcrypto_ecdsa_pubkey_from_hash(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdsa_pubkey_from_hash_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t **items;
+  size_t item_len, out_len;
+  uint32_t i, length;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &compress) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + ECDSA_MAX_PUB_SIZE));
+
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size * 2;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
+
+  ok = ecdsa_pubkey_from_hash_batch(ec->ctx, out, &out_len,
+                                    items, length, compress);
+
+  for (i = 0; ok && i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, out_len, out + i * out_len,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(items);
+
+  JS_ASSERT(ok, JS_ERR_PREIMAGE);
+
+  return result;
+}
+
 static napi_value
 bcrypto_ecdsa_pubkey_to_hash(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -4959,6 +6179,75 @@ bcrypto_ecdsa_pubkey_tweak_add(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_ecdsa_pubkey_tweak_add_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t **pubs, **tweaks;
+  size_t *pub_lens, tweak_len, out_len;
+  uint32_t i, length, item_len;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value item, items[2], result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &compress) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  pubs = bcrypto_malloc(length * (2 * sizeof(uint8_t *)
+                                + sizeof(size_t)
+                                + ECDSA_MAX_PUB_SIZE));
+
+  JS_ASSERT(pubs != NULL, JS_ERR_ALLOC);
+
+  tweaks = &pubs[length];
+  pub_lens = (size_t *)&tweaks[length];
+  out = (uint8_t *)&pub_lens[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 2);
+    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
+    CHECK(napi_get_buffer_info(env, items[0], (void **)&pubs[i],
+                               &pub_lens[i]) == napi_ok);
+    CHECK(napi_get_buffer_info(env, items[1], (void **)&tweaks[i],
+                               &tweak_len) == napi_ok);
+
+    ok &= tweak_len == ec->scalar_size;
+  }
+
+  if (!ok) {
+    bcrypto_free(pubs);
+    JS_THROW(JS_ERR_SCALAR_SIZE);
+  }
+
+  ok = ecdsa_pubkey_tweak_add_batch(ec->ctx, out, &out_len, pubs,
+                                    pub_lens, tweaks, length, compress);
+
+  for (i = 0; ok && i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, out_len, out + i * out_len,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(pubs);
+
+  JS_ASSERT(ok, JS_ERR_PUBKEY);
+
+  return result;
+}
+
 static napi_value
 bcrypto_ecdsa_pubkey_tweak_mul(napi_env env, napi_callback_info info) {
   napi_value argv[4];
@@ -5359,7 +6648,8 @@ bcrypto_ecdsa_verify(napi_env env, napi_callback_info info) {
   size_t msg_len, sig_len, pub_len;
   bcrypto_wei_curve_t *ec;
   napi_value result;
-  int ok;
+  uint8_t key[32];
+  int ok, cache;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 4);
@@ -5368,9 +6658,20 @@ bcrypto_ecdsa_verify(napi_env env, napi_callback_info info) {
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[3], (void **)&pub, &pub_len) == napi_ok);
 
-  ok = sig_len == ec->sig_size
-    && ecdsa_sig_normalize(ec->ctx, tmp, sig)
-    && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+  cache = bcrypto_sigcache_has(key, SIGCACHE_ECDSA, ec->type,
+                               msg, msg_len, sig, sig_len,
+                               pub, pub_len, NULL, 0);
+
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->sig_size
+      && ecdsa_sig_normalize(ec->ctx, tmp, sig)
+      && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
 
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
@@ -5378,150 +6679,586 @@ bcrypto_ecdsa_verify(napi_env env, napi_callback_info info) {
 }
 
 static napi_value
-bcrypto_ecdsa_verify_der(napi_env env, napi_callback_info info) {
-  napi_value argv[4];
-  size_t argc = 4;
-  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
-  const uint8_t *msg, *sig, *pub;
-  size_t msg_len, sig_len, pub_len;
+bcrypto_ecdsa_pubkey_prepare(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *pub;
+  size_t pub_len;
+  uint32_t width;
   bcrypto_wei_curve_t *ec;
-  napi_value result;
-  int ok;
+  wei_prepared_t *key;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 4);
+  CHECK(argc == 3);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[3], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &width) == napi_ok);
 
-  ok = ecdsa_sig_import_lax(ec->ctx, tmp, sig, sig_len)
-    && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
-    && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+  JS_ASSERT(width == 0 || (width >= 2 && width <= 12), JS_ERR_PARAMS);
 
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  key = ecdsa_pubkey_prepare(ec->ctx, pub, pub_len, width);
 
-  return result;
+  JS_ASSERT(key != NULL, JS_ERR_PUBKEY);
+
+  return bcrypto_wei_prepared_create(env, argv[0], ec->ctx,
+                                     key, pub, pub_len, 0);
 }
 
 static napi_value
-bcrypto_ecdsa_recover(napi_env env, napi_callback_info info) {
-  napi_value argv[5];
-  size_t argc = 5;
+bcrypto_ecdsa_verify_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
   uint8_t tmp[ECDSA_MAX_SIG_SIZE];
-  uint8_t out[ECDSA_MAX_PUB_SIZE];
-  size_t out_len = ECDSA_MAX_PUB_SIZE;
   const uint8_t *msg, *sig;
   size_t msg_len, sig_len;
-  uint32_t parm;
-  bool compress;
   bcrypto_wei_curve_t *ec;
+  bcrypto_wei_prepared_t *pre;
   napi_value result;
-  int ok;
+  uint8_t key[32];
+  int ok, cache;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 5);
+  CHECK(argc == 4);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
-  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
-  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[3], (void **)&pre) == napi_ok);
 
-  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+  JS_ASSERT(pre->ctx == ec->ctx && !pre->schnorr, JS_ERR_PUBKEY);
 
-  ok = sig_len == ec->sig_size
-    && ecdsa_sig_normalize(ec->ctx, tmp, sig)
-    && ecdsa_recover(ec->ctx, out, &out_len, msg, msg_len, tmp, parm, compress);
+  /* Shares entries with bcrypto_ecdsa_verify. */
+  cache = bcrypto_sigcache_has(key, SIGCACHE_ECDSA, ec->type,
+                               msg, msg_len, sig, sig_len,
+                               pre->pub, pre->pub_len, NULL, 0);
 
-  if (ok)
-    CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
-  else
-    CHECK(napi_get_null(env, &result) == napi_ok);
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->sig_size
+      && ecdsa_sig_normalize(ec->ctx, tmp, sig)
+      && ecdsa_verify_prepared(ec->ctx, msg, msg_len, tmp, pre->key);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
   return result;
 }
 
 static napi_value
-bcrypto_ecdsa_recover_der(napi_env env, napi_callback_info info) {
-  napi_value argv[5];
-  size_t argc = 5;
-  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
-  uint8_t out[ECDSA_MAX_PUB_SIZE];
-  size_t out_len = ECDSA_MAX_PUB_SIZE;
-  const uint8_t *msg, *sig;
-  size_t msg_len, sig_len;
-  uint32_t parm;
-  bool compress;
+bcrypto_ecdsa_pool_create(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint32_t size;
   bcrypto_wei_curve_t *ec;
-  napi_value result;
-  int ok;
+  bcrypto_wei_pool_t *pool;
+  napi_value handle;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 5);
+  CHECK(argc == 2);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
-  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
-  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &size) == napi_ok);
 
-  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+  JS_ASSERT(size > 0 && size <= (1 << 20), JS_ERR_PARAMS);
 
-  ok = ecdsa_sig_import_lax(ec->ctx, tmp, sig, sig_len)
-    && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
-    && ecdsa_recover(ec->ctx, out, &out_len, msg, msg_len, tmp, parm, compress);
+  pool = bcrypto_xmalloc(sizeof(bcrypto_wei_pool_t));
+  pool->ctx = ec->ctx;
+  pool->pool = ecdsa_pool_create(ec->ctx, size);
+  pool->size = size;
 
-  if (ok)
-    CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
-  else
-    CHECK(napi_get_null(env, &result) == napi_ok);
+  /* See bcrypto_wei_prepared_create. */
+  CHECK(napi_create_reference(env, argv[0], 1, &pool->ref) == napi_ok);
 
-  return result;
+  CHECK(napi_create_external(env,
+                             pool,
+                             bcrypto_wei_pool_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
 }
 
 static napi_value
-bcrypto_ecdsa_derive(napi_env env, napi_callback_info info) {
-  napi_value argv[4];
-  size_t argc = 4;
-  uint8_t out[ECDSA_MAX_PUB_SIZE];
-  size_t out_len = ECDSA_MAX_PUB_SIZE;
-  const uint8_t *pub, *priv;
-  size_t pub_len, priv_len;
-  bool compress;
+bcrypto_ecdsa_pool_size(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
   bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pool_t *pool;
   napi_value result;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 4);
+  CHECK(argc == 2);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
-                             &priv_len) == napi_ok);
-  CHECK(napi_get_value_bool(env, argv[3], &compress) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&pool) == napi_ok);
 
-  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
-  JS_ASSERT(ecdsa_derive(ec->ctx, out, &out_len, pub, pub_len, priv, compress),
-            JS_ERR_PUBKEY);
+  JS_ASSERT(pool->ctx == ec->ctx, JS_ERR_PARAMS);
 
-  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  CHECK(napi_create_uint32(env, ecdsa_pool_size(ec->ctx, pool->pool),
+                           &result) == napi_ok);
 
   return result;
 }
 
-/*
- * EdDSA
- */
-
 static napi_value
-bcrypto_eddsa_pubkey_size(napi_env env, napi_callback_info info) {
-  napi_value argv[1];
-  size_t argc = 1;
-  bcrypto_edwards_curve_t *ec;
+bcrypto_ecdsa_pool_fill(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *entropy;
+  size_t entropy_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pool_t *pool;
   napi_value result;
+  size_t len;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 1);
+  CHECK(argc == 3);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_create_uint32(env, ec->pub_size, &result) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&pool) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+
+  JS_ASSERT(pool->ctx == ec->ctx, JS_ERR_PARAMS);
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+
+  len = ecdsa_pool_fill(ec->ctx, pool->pool, entropy);
+
+  torsion_cleanse((void *)entropy, entropy_len);
+
+  CHECK(napi_create_uint32(env, len, &result) == napi_ok);
+
+  return result;
+}
+
+typedef struct bcrypto_pool_worker_s {
+  const wei_curve_t *ctx;
+  bcrypto_wei_pool_t *dst;
+  wei_pool_t *src;
+  uint8_t entropy[ENTROPY_SIZE];
+  napi_ref curve_ref;
+  napi_ref pool_ref;
+  napi_async_work work;
+  napi_deferred deferred;
+} bcrypto_pool_worker_t;
+
+static void
+bcrypto_pool_execute_(napi_env env, void *data) {
+  bcrypto_pool_worker_t *w = (bcrypto_pool_worker_t *)data;
+
+  (void)env;
+
+  ecdsa_pool_fill(w->ctx, w->src, w->entropy);
+
+  torsion_cleanse(w->entropy, ENTROPY_SIZE);
+}
+
+static void
+bcrypto_pool_complete_(napi_env env, napi_status status, void *data) {
+  /* Nonces are generated into a private pool
+   * off-thread and only moved into the live
+   * one here, on the main thread, so signing
+   * never races with a refill.
+   */
+  bcrypto_pool_worker_t *w = (bcrypto_pool_worker_t *)data;
+  napi_value result, strval, errval;
+  size_t len = 0;
+
+  if (status == napi_ok)
+    len = ecdsa_pool_move(w->ctx, w->dst->pool, w->src);
+
+  if (status == napi_ok)
+    status = napi_create_uint32(env, len, &result);
+
+  if (status == napi_ok) {
+    CHECK(napi_resolve_deferred(env, w->deferred, result) == napi_ok);
+  } else {
+    CHECK(napi_create_string_latin1(env, JS_ERR_GENERATE, NAPI_AUTO_LENGTH,
+                                    &strval) == napi_ok);
+    CHECK(napi_create_error(env, NULL, strval, &errval) == napi_ok);
+    CHECK(napi_reject_deferred(env, w->deferred, errval) == napi_ok);
+  }
+
+  CHECK(napi_delete_async_work(env, w->work) == napi_ok);
+
+  wei_pool_destroy(w->ctx, w->src);
+
+  CHECK(napi_delete_reference(env, w->pool_ref) == napi_ok);
+  CHECK(napi_delete_reference(env, w->curve_ref) == napi_ok);
+
+  bcrypto_free(w);
+}
+
+static napi_value
+bcrypto_ecdsa_pool_fill_async(napi_env env, napi_callback_info info) {
+  bcrypto_pool_worker_t *worker;
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *entropy;
+  size_t entropy_len, want;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pool_t *pool;
+  napi_value workname, result, zero;
+  napi_deferred deferred;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&pool) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&entropy,
+                             &entropy_len) == napi_ok);
+
+  JS_ASSERT(pool->ctx == ec->ctx, JS_ERR_PARAMS);
+  JS_ASSERT(entropy_len == ENTROPY_SIZE, JS_ERR_ENTROPY_SIZE);
+
+  want = pool->size - ecdsa_pool_size(ec->ctx, pool->pool);
+
+  if (want == 0) {
+    torsion_cleanse((void *)entropy, entropy_len);
+
+    CHECK(napi_create_promise(env, &deferred, &result) == napi_ok);
+    CHECK(napi_create_uint32(env, 0, &zero) == napi_ok);
+    CHECK(napi_resolve_deferred(env, deferred, zero) == napi_ok);
+
+    return result;
+  }
+
+  worker = bcrypto_xmalloc(sizeof(bcrypto_pool_worker_t));
+  worker->ctx = ec->ctx;
+  worker->dst = pool;
+  worker->src = ecdsa_pool_create(ec->ctx, want);
+
+  memcpy(worker->entropy, entropy, ENTROPY_SIZE);
+
+  torsion_cleanse((void *)entropy, entropy_len);
+
+  /* Keep the curve and the pool alive until the work completes. */
+  CHECK(napi_create_reference(env, argv[0], 1, &worker->curve_ref) == napi_ok);
+  CHECK(napi_create_reference(env, argv[1], 1, &worker->pool_ref) == napi_ok);
+
+  CHECK(napi_create_string_latin1(env, "bcrypto:ecdsa_pool_fill",
+                                  NAPI_AUTO_LENGTH, &workname) == napi_ok);
+
+  CHECK(napi_create_promise(env, &worker->deferred, &result) == napi_ok);
+
+  CHECK(napi_create_async_work(env,
+                               NULL,
+                               workname,
+                               bcrypto_pool_execute_,
+                               bcrypto_pool_complete_,
+                               worker,
+                               &worker->work) == napi_ok);
+
+  CHECK(napi_queue_async_work(env, worker->work) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_pool_clear(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pool_t *pool;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&pool) == napi_ok);
+
+  JS_ASSERT(pool->ctx == ec->ctx, JS_ERR_PARAMS);
+
+  ecdsa_pool_clear(ec->ctx, pool->pool);
+
+  return argv[0];
+}
+
+static napi_value
+bcrypto_ecdsa_sign_pooled(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t out[ECDSA_MAX_SIG_SIZE];
+  unsigned int param;
+  const uint8_t *msg, *priv;
+  size_t msg_len, priv_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_pool_t *pool;
+  napi_value sigval, paramval, result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[3], (void **)&pool) == napi_ok);
+
+  JS_ASSERT(pool->ctx == ec->ctx, JS_ERR_PARAMS);
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+  JS_ASSERT(ecdsa_sign_pooled(ec->ctx, out, &param, msg, msg_len,
+                              priv, pool->pool), JS_ERR_SIGN);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->sig_size,
+                                out,
+                                NULL,
+                                &sigval) == napi_ok);
+
+  CHECK(napi_create_uint32(env, param, &paramval) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, 2, &result) == napi_ok);
+  CHECK(napi_set_element(env, result, 0, sigval) == napi_ok);
+  CHECK(napi_set_element(env, result, 1, paramval) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_signer_create(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *priv;
+  size_t priv_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_signer_t *sig;
+  wei_signer_t *signer;
+  napi_value handle;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+
+  signer = ecdsa_signer_create(ec->ctx, priv);
+
+  JS_ASSERT(signer != NULL, JS_ERR_PRIVKEY);
+
+  sig = bcrypto_xmalloc(sizeof(bcrypto_wei_signer_t));
+  sig->ctx = ec->ctx;
+  sig->signer = signer;
+
+  CHECK(napi_create_reference(env, argv[0], 1, &sig->ref) == napi_ok);
+
+  CHECK(napi_create_external(env,
+                             sig,
+                             bcrypto_wei_signer_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_ecdsa_sign_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[ECDSA_MAX_SIG_SIZE];
+  unsigned int param;
+  const uint8_t *msg;
+  size_t msg_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_signer_t *sig;
+  napi_value sigval, paramval, result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[2], (void **)&sig) == napi_ok);
+
+  JS_ASSERT(sig->ctx == ec->ctx, JS_ERR_PRIVKEY);
+
+  ecdsa_sign_prepared(ec->ctx, out, &param, msg, msg_len, sig->signer);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->sig_size,
+                                out,
+                                NULL,
+                                &sigval) == napi_ok);
+
+  CHECK(napi_create_uint32(env, param, &paramval) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, 2, &result) == napi_ok);
+  CHECK(napi_set_element(env, result, 0, sigval) == napi_ok);
+  CHECK(napi_set_element(env, result, 1, paramval) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_verify_der(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+  const uint8_t *msg, *sig, *pub;
+  size_t msg_len, sig_len, pub_len;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&pub, &pub_len) == napi_ok);
+
+  ok = ecdsa_sig_import_lax(ec->ctx, tmp, sig, sig_len)
+    && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
+    && ecdsa_verify(ec->ctx, msg, msg_len, tmp, pub, pub_len);
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_recover(napi_env env, napi_callback_info info) {
+  napi_value argv[5];
+  size_t argc = 5;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+  uint8_t out[ECDSA_MAX_PUB_SIZE];
+  size_t out_len = ECDSA_MAX_PUB_SIZE;
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  uint32_t parm;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  ok = sig_len == ec->sig_size
+    && ecdsa_sig_normalize(ec->ctx, tmp, sig)
+    && ecdsa_recover(ec->ctx, out, &out_len, msg, msg_len, tmp, parm, compress);
+
+  if (ok)
+    CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  else
+    CHECK(napi_get_null(env, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_recover_der(napi_env env, napi_callback_info info) {
+  napi_value argv[5];
+  size_t argc = 5;
+  uint8_t tmp[ECDSA_MAX_SIG_SIZE];
+  uint8_t out[ECDSA_MAX_PUB_SIZE];
+  size_t out_len = ECDSA_MAX_PUB_SIZE;
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  uint32_t parm;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+  int ok;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[3], &parm) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[4], &compress) == napi_ok);
+
+  JS_ASSERT((parm & 3) == parm, JS_ERR_RECOVERY_PARAM);
+
+  ok = ecdsa_sig_import_lax(ec->ctx, tmp, sig, sig_len)
+    && ecdsa_sig_normalize(ec->ctx, tmp, tmp)
+    && ecdsa_recover(ec->ctx, out, &out_len, msg, msg_len, tmp, parm, compress);
+
+  if (ok)
+    CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+  else
+    CHECK(napi_get_null(env, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_ecdsa_derive(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint8_t out[ECDSA_MAX_PUB_SIZE];
+  size_t out_len = ECDSA_MAX_PUB_SIZE;
+  const uint8_t *pub, *priv;
+  size_t pub_len, priv_len;
+  bool compress;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&priv,
+                             &priv_len) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[3], &compress) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->scalar_size, JS_ERR_PRIVKEY_SIZE);
+  JS_ASSERT(ecdsa_derive(ec->ctx, out, &out_len, pub, pub_len, priv, compress),
+            JS_ERR_PUBKEY);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+/*
+ * EdDSA
+ */
+
+static void
+bcrypto_edwards_prepared_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_edwards_prepared_t *pre = (bcrypto_edwards_prepared_t *)data;
+
+  (void)hint;
+
+  edwards_prepared_destroy(pre->ctx, pre->key);
+
+  CHECK(napi_delete_reference(env, pre->ref) == napi_ok);
+
+  bcrypto_free(pre);
+}
+
+static void
+bcrypto_edwards_signer_destroy(napi_env env, void *data, void *hint) {
+  bcrypto_edwards_signer_t *sig = (bcrypto_edwards_signer_t *)data;
+
+  (void)hint;
+
+  edwards_signer_destroy(sig->ctx, sig->signer);
+
+  CHECK(napi_delete_reference(env, sig->ref) == napi_ok);
+
+  bcrypto_free(sig);
+}
+
+static napi_value
+bcrypto_eddsa_pubkey_size(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  bcrypto_edwards_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_create_uint32(env, ec->pub_size, &result) == napi_ok);
 
   return result;
 }
@@ -6074,6 +7811,60 @@ bcrypto_eddsa_pubkey_from_uniform(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_eddsa_pubkey_from_uniform_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t **items;
+  size_t item_len;
+  uint32_t i, length;
+  bcrypto_edwards_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + EDDSA_MAX_PUB_SIZE));
+
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
+
+  eddsa_pubkey_from_uniform_batch(ec->ctx, out, items, length);
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, ec->pub_size, out + i * ec->pub_size,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
+
+  bcrypto_free(items);
+
+  return result;
+}
+
 static napi_value
 bcrypto_eddsa_pubkey_to_uniform(napi_env env, napi_callback_info info) {
   napi_value argv[3];
@@ -6112,22 +7903,78 @@ bcrypto_eddsa_pubkey_from_hash(napi_env env, napi_callback_info info) {
   bcrypto_edwards_curve_t *ec;
   napi_value result;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 3);
-  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_buffer_info(env, argv[1], (void **)&data,
-                             &data_len) == napi_ok);
-  CHECK(napi_get_value_bool(env, argv[2], &pake) == napi_ok);
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&data,
+                             &data_len) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &pake) == napi_ok);
+
+  JS_ASSERT(data_len == ec->field_size * 2, JS_ERR_PREIMAGE_SIZE);
+
+  eddsa_pubkey_from_hash(ec->ctx, out, data, pake);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->pub_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_eddsa_pubkey_from_hash_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t **items;
+  size_t item_len;
+  uint32_t i, length;
+  bool pake;
+  bcrypto_edwards_curve_t *ec;
+  napi_value item, result;
+  uint8_t *out;
+  int ok = 1;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_bool(env, argv[2], &pake) == napi_ok);
+
+  CHECK(napi_create_array_with_length(env, length, &result) == napi_ok);
+
+  if (length == 0)
+    return result;
+
+  items = bcrypto_malloc(length * (sizeof(uint8_t *) + EDDSA_MAX_PUB_SIZE));
+
+  JS_ASSERT(items != NULL, JS_ERR_ALLOC);
+
+  out = (uint8_t *)&items[length];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_buffer_info(env, item, (void **)&items[i],
+                               &item_len) == napi_ok);
+
+    ok &= item_len == ec->field_size * 2;
+  }
+
+  if (!ok) {
+    bcrypto_free(items);
+    JS_THROW(JS_ERR_PREIMAGE_SIZE);
+  }
 
-  JS_ASSERT(data_len == ec->field_size * 2, JS_ERR_PREIMAGE_SIZE);
+  eddsa_pubkey_from_hash_batch(ec->ctx, out, items, length, pake);
 
-  eddsa_pubkey_from_hash(ec->ctx, out, data, pake);
+  for (i = 0; i < length; i++) {
+    CHECK(napi_create_buffer_copy(env, ec->pub_size, out + i * ec->pub_size,
+                                  NULL, &item) == napi_ok);
+    CHECK(napi_set_element(env, result, i, item) == napi_ok);
+  }
 
-  CHECK(napi_create_buffer_copy(env,
-                                ec->pub_size,
-                                out,
-                                NULL,
-                                &result) == napi_ok);
+  bcrypto_free(items);
 
   return result;
 }
@@ -6598,6 +8445,99 @@ bcrypto_eddsa_sign_tweak_mul(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_eddsa_signer_create(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  const uint8_t *priv, *ctx;
+  size_t priv_len, ctx_len;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_signer_t *sig;
+  napi_value handle;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&priv,
+                             &priv_len) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&ctx, &ctx_len) == napi_ok);
+
+  JS_ASSERT(priv_len == ec->priv_size, JS_ERR_PRIVKEY_SIZE);
+
+  sig = bcrypto_xmalloc(sizeof(bcrypto_edwards_signer_t));
+  sig->ctx = ec->ctx;
+  sig->signer = eddsa_signer_create(ec->ctx, priv, ph, ctx, ctx_len);
+
+  CHECK(napi_create_reference(env, argv[0], 1, &sig->ref) == napi_ok);
+
+  CHECK(napi_create_external(env,
+                             sig,
+                             bcrypto_edwards_signer_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_eddsa_signer_pubkey(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint8_t out[EDDSA_MAX_PUB_SIZE];
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_signer_t *sig;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[1], (void **)&sig) == napi_ok);
+
+  JS_ASSERT(sig->ctx == ec->ctx, JS_ERR_PRIVKEY);
+
+  eddsa_signer_pubkey(ec->ctx, out, sig->signer);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->pub_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_eddsa_sign_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint8_t out[EDDSA_MAX_SIG_SIZE];
+  const uint8_t *msg;
+  size_t msg_len;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_signer_t *sig;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[2], (void **)&sig) == napi_ok);
+
+  JS_ASSERT(sig->ctx == ec->ctx, JS_ERR_PRIVKEY);
+
+  eddsa_sign_prepared(ec->ctx, out, msg, msg_len, sig->signer);
+
+  CHECK(napi_create_buffer_copy(env,
+                                ec->sig_size,
+                                out,
+                                NULL,
+                                &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_eddsa_verify(napi_env env, napi_callback_info info) {
   napi_value argv[6];
@@ -6607,7 +8547,8 @@ bcrypto_eddsa_verify(napi_env env, napi_callback_info info) {
   int32_t ph;
   bcrypto_edwards_curve_t *ec;
   napi_value result;
-  int ok;
+  uint8_t key[32];
+  int ok, cache;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 6);
@@ -6618,9 +8559,109 @@ bcrypto_eddsa_verify(napi_env env, napi_callback_info info) {
   CHECK(napi_get_value_int32(env, argv[4], &ph) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[5], (void **)&ctx, &ctx_len) == napi_ok);
 
-  ok = sig_len == ec->sig_size
-    && pub_len == ec->pub_size
-    && eddsa_verify(ec->ctx, msg, msg_len, sig, pub, ph, ctx, ctx_len);
+  /* The prehash flag selects a different scheme. */
+  cache = bcrypto_sigcache_has(key, SIGCACHE_EDDSA + 0x100 * (ph + 1),
+                               ec->type, msg, msg_len, sig, sig_len,
+                               pub, pub_len, ctx, ctx_len);
+
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->sig_size
+      && pub_len == ec->pub_size
+      && eddsa_verify(ec->ctx, msg, msg_len, sig, pub, ph, ctx, ctx_len);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_eddsa_pubkey_prepare(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *pub;
+  size_t pub_len;
+  uint32_t width;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_prepared_t *pre;
+  edwards_prepared_t *key;
+  napi_value handle;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &width) == napi_ok);
+
+  JS_ASSERT(pub_len == ec->pub_size, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(width == 0 || (width >= 2 && width <= 12), JS_ERR_PARAMS);
+
+  key = eddsa_pubkey_prepare(ec->ctx, pub, width);
+
+  JS_ASSERT(key != NULL, JS_ERR_PUBKEY);
+
+  pre = bcrypto_xmalloc(sizeof(bcrypto_edwards_prepared_t));
+  pre->ctx = ec->ctx;
+  pre->key = key;
+
+  memcpy(pre->pub, pub, pub_len);
+
+  /* See bcrypto_wei_prepared_create. */
+  CHECK(napi_create_reference(env, argv[0], 1, &pre->ref) == napi_ok);
+
+  CHECK(napi_create_external(env,
+                             pre,
+                             bcrypto_edwards_prepared_destroy,
+                             NULL,
+                             &handle) == napi_ok);
+
+  return handle;
+}
+
+static napi_value
+bcrypto_eddsa_verify_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[6];
+  size_t argc = 6;
+  const uint8_t *msg, *sig, *ctx;
+  size_t msg_len, sig_len, ctx_len;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+  bcrypto_edwards_prepared_t *pre;
+  napi_value result;
+  uint8_t key[32];
+  int ok, cache;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 6);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[3], (void **)&pre) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[4], &ph) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[5], (void **)&ctx, &ctx_len) == napi_ok);
+
+  JS_ASSERT(pre->ctx == ec->ctx, JS_ERR_PUBKEY);
+
+  /* Shares entries with bcrypto_eddsa_verify. */
+  cache = bcrypto_sigcache_has(key, SIGCACHE_EDDSA + 0x100 * (ph + 1),
+                               ec->type, msg, msg_len, sig, sig_len,
+                               pre->pub, ec->pub_size, ctx, ctx_len);
+
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->sig_size
+      && eddsa_verify_prepared(ec->ctx, msg, msg_len, sig,
+                               pre->key, ph, ctx, ctx_len);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
 
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
@@ -6653,83 +8694,198 @@ bcrypto_eddsa_verify_single(napi_env env, napi_callback_info info) {
 
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
-  return result;
+  return result;
+}
+
+static napi_value
+bcrypto_eddsa_verify_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  uint32_t i, length, item_len;
+  const uint8_t *ctx;
+  const uint8_t **ptrs, **msgs, **pubs, **sigs;
+  size_t *lens, *msg_lens;
+  size_t sig_len, pub_len, ctx_len;
+  int32_t ph;
+  bcrypto_edwards_curve_t *ec;
+  napi_value item, result;
+  napi_value items[3];
+  int ok = 0;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&ctx, &ctx_len) == napi_ok);
+
+  if (length == 0) {
+    CHECK(napi_get_boolean(env, true, &result) == napi_ok);
+    return result;
+  }
+
+  ptrs = bcrypto_malloc(3 * length * sizeof(uint8_t *));
+  lens = bcrypto_malloc(1 * length * sizeof(size_t));
+
+  if (ptrs == NULL || lens == NULL)
+    goto fail;
+
+  msgs = &ptrs[length * 0];
+  pubs = &ptrs[length * 1];
+  sigs = &ptrs[length * 2];
+  msg_lens = &lens[length * 0];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 3);
+
+    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
+    CHECK(napi_get_element(env, item, 2, &items[2]) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[0], (void **)&msgs[i],
+                               &msg_lens[i]) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
+                               &sig_len) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
+                               &pub_len) == napi_ok);
+
+    if (sig_len != ec->sig_size || pub_len != ec->pub_size)
+      goto fail;
+  }
+
+  if (ec->scratch == NULL)
+    ec->scratch = edwards_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(ec->scratch != NULL);
+
+  ok = eddsa_verify_batch(ec->ctx, msgs, msg_lens, sigs,
+                          pubs, length, ph, ctx, ctx_len,
+                          ec->scratch);
+
+fail:
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  bcrypto_free((void *)ptrs);
+  bcrypto_free(lens);
+
+  return result;
+}
+
+static int
+bcrypto_eddsa_verify_batch_worker_(void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_edwards_curve_t *ec = w->job->curve;
+  bcrypto_batch_t *batch = &w->batch;
+  edwards_scratch_t *scratch;
+  uint32_t i;
+  int ok;
+
+  for (i = 0; i < batch->length; i++) {
+    if (batch->sig_lens[i] != ec->sig_size
+        || batch->pub_lens[i] != ec->pub_size) {
+      return 0;
+    }
+  }
+
+  scratch = edwards_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(scratch != NULL);
+
+  ok = eddsa_verify_batch(ec->ctx, batch->msgs, batch->msg_lens, batch->sigs,
+                          batch->pubs, batch->length, w->job->ph,
+                          w->job->ctx, w->job->ctx_len, scratch);
+
+  edwards_scratch_destroy(ec->ctx, scratch);
+
+  return ok;
+}
+
+static napi_value
+bcrypto_eddsa_verify_batch_async(napi_env env, napi_callback_info info) {
+  napi_value argv[5];
+  size_t argc = 5;
+  const uint8_t *ctx;
+  size_t ctx_len;
+  int32_t ph;
+  uint32_t threads;
+  bcrypto_verify_job_t *job;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 5);
+  CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[3], (void **)&ctx, &ctx_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[4], &threads) == napi_ok);
+
+  job = bcrypto_verify_job_create(env, argv[1], ph, ctx, ctx_len);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->verify = bcrypto_eddsa_verify_batch_worker_;
+
+  return bcrypto_verify_job_queue(env, job, argv[0], threads,
+                                  "bcrypto:eddsa_verify_batch");
 }
 
 static napi_value
-bcrypto_eddsa_verify_batch(napi_env env, napi_callback_info info) {
+bcrypto_eddsa_verify_batch_invalid(napi_env env, napi_callback_info info) {
   napi_value argv[4];
   size_t argc = 4;
-  uint32_t i, length, item_len;
+  bcrypto_batch_t batch;
+  bcrypto_edwards_curve_t *ec;
   const uint8_t *ctx;
-  const uint8_t **ptrs, **msgs, **pubs, **sigs;
-  size_t *lens, *msg_lens;
-  size_t sig_len, pub_len, ctx_len;
+  size_t ctx_len;
   int32_t ph;
-  bcrypto_edwards_curve_t *ec;
-  napi_value item, result;
-  napi_value items[3];
-  int ok = 0;
+  uint32_t length, *map;
+  size_t count, *invalid;
+  napi_value result;
+  uint8_t *bad;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 4);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
   CHECK(napi_get_value_int32(env, argv[2], &ph) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[3], (void **)&ctx, &ctx_len) == napi_ok);
 
+  JS_ASSERT(bcrypto_batch_init(env, &batch, argv[1]), JS_ERR_ALLOC);
+
+  length = batch.length;
+
   if (length == 0) {
-    CHECK(napi_get_boolean(env, true, &result) == napi_ok);
+    CHECK(napi_create_array(env, &result) == napi_ok);
     return result;
   }
 
-  ptrs = bcrypto_malloc(3 * length * sizeof(uint8_t *));
-  lens = bcrypto_malloc(1 * length * sizeof(size_t));
-
-  if (ptrs == NULL || lens == NULL)
-    goto fail;
-
-  msgs = &ptrs[length * 0];
-  pubs = &ptrs[length * 1];
-  sigs = &ptrs[length * 2];
-  msg_lens = &lens[length * 0];
-
-  for (i = 0; i < length; i++) {
-    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
-    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
-    CHECK(item_len == 3);
-
-    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
-    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
-    CHECK(napi_get_element(env, item, 2, &items[2]) == napi_ok);
-
-    CHECK(napi_get_buffer_info(env, items[0], (void **)&msgs[i],
-                               &msg_lens[i]) == napi_ok);
+  invalid = bcrypto_malloc(length * (sizeof(size_t)
+                                   + sizeof(uint32_t)
+                                   + sizeof(uint8_t)));
 
-    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
-                               &sig_len) == napi_ok);
+  if (invalid == NULL) {
+    bcrypto_batch_clear(&batch);
+    JS_THROW(JS_ERR_ALLOC);
+  }
 
-    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
-                               &pub_len) == napi_ok);
+  map = (uint32_t *)&invalid[length];
+  bad = (uint8_t *)&map[length];
 
-    if (sig_len != ec->sig_size || pub_len != ec->pub_size)
-      goto fail;
-  }
+  length = bcrypto_batch_filter(&batch, map, bad, ec->sig_size, ec->pub_size);
 
   if (ec->scratch == NULL)
     ec->scratch = edwards_scratch_create(ec->ctx, SCRATCH_SIZE);
 
   CHECK(ec->scratch != NULL);
 
-  ok = eddsa_verify_batch(ec->ctx, msgs, msg_lens, sigs,
-                          pubs, length, ph, ctx, ctx_len,
-                          ec->scratch);
+  count = eddsa_verify_batch_invalid(ec->ctx, invalid, batch.msgs,
+                                     batch.msg_lens, batch.sigs, batch.pubs,
+                                     length, ph, ctx, ctx_len, ec->scratch);
 
-fail:
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  result = bcrypto_batch_invalid(env, bad, map, invalid, count, batch.length);
 
-  bcrypto_free((void *)ptrs);
-  bcrypto_free(lens);
+  bcrypto_free(invalid);
+  bcrypto_batch_clear(&batch);
 
   return result;
 }
@@ -6814,18 +8970,19 @@ bcrypto_edwards_curve_destroy(napi_env env, void *data, void *hint) {
 
 static napi_value
 bcrypto_edwards_curve_create(napi_env env, napi_callback_info info) {
-  napi_value argv[1];
-  size_t argc = 1;
-  uint32_t type;
+  napi_value argv[2];
+  size_t argc = 2;
+  uint32_t type, flags;
   bcrypto_edwards_curve_t *ec;
   edwards_curve_t *ctx;
   napi_value handle;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 1);
+  CHECK(argc == 2);
   CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &flags) == napi_ok);
 
-  JS_ASSERT(ctx = edwards_curve_create(type), JS_ERR_CONTEXT);
+  JS_ASSERT(ctx = edwards_curve_create_ex(type, flags), JS_ERR_CONTEXT);
 
   ec = bcrypto_xmalloc(sizeof(bcrypto_edwards_curve_t));
   ec->ctx = ctx;
@@ -6837,6 +8994,7 @@ bcrypto_edwards_curve_create(napi_env env, napi_callback_info info) {
   ec->priv_size = eddsa_privkey_size(ec->ctx);
   ec->pub_size = eddsa_pubkey_size(ec->ctx);
   ec->sig_size = eddsa_sig_size(ec->ctx);
+  ec->type = type;
 
   CHECK(napi_create_external(env,
                              ec,
@@ -6877,6 +9035,22 @@ bcrypto_edwards_curve_field_bits(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_edwards_curve_table_size(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  bcrypto_edwards_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_create_uint32(env, edwards_curve_table_size(ec->ctx),
+                           &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_edwards_curve_randomize(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -7000,6 +9174,58 @@ bcrypto_hash_final(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_hash_export(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  uint8_t out[HASH_MAX_MIDSTATE_SIZE];
+  size_t out_len;
+  bcrypto_hash_t *hash;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+
+  JS_ASSERT(hash->started, JS_ERR_INIT);
+
+  out_len = hash_midstate_size(hash->type);
+
+  JS_ASSERT(out_len != 0, JS_ERR_ARG);
+  JS_ASSERT(hash_export(&hash->ctx, out), JS_ERR_STATE);
+
+  CHECK(napi_create_buffer_copy(env, out_len, out, NULL, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_hash_import(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  const uint8_t *in;
+  size_t in_len;
+  bcrypto_hash_t *hash;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&hash) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&in, &in_len) == napi_ok);
+
+  JS_ASSERT(hash_midstate_size(hash->type) != 0, JS_ERR_ARG);
+  JS_ASSERT(in_len == hash_midstate_size(hash->type), JS_ERR_STATE);
+
+  /* The trailing byte counter must fit in 53 bits,
+     matching what the JS backend can represent. */
+  JS_ASSERT(in[in_len - 8] == 0 && in[in_len - 7] < 0x20, JS_ERR_STATE);
+
+  JS_ASSERT(hash_import(&hash->ctx, hash->type, in), JS_ERR_STATE);
+
+  hash->started = 1;
+
+  return argv[0];
+}
+
 static napi_value
 bcrypto_hash_digest(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -9773,7 +11999,8 @@ bcrypto_schnorr_verify(napi_env env, napi_callback_info info) {
   size_t msg_len, sig_len, pub_len;
   bcrypto_wei_curve_t *ec;
   napi_value result;
-  int ok;
+  uint8_t key[32];
+  int ok, cache;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 4);
@@ -9782,84 +12009,269 @@ bcrypto_schnorr_verify(napi_env env, napi_callback_info info) {
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[3], (void **)&pub, &pub_len) == napi_ok);
 
-  ok = sig_len == ec->schnorr_size
-    && pub_len == ec->field_size
-    && schnorr_verify(ec->ctx, msg, msg_len, sig, pub);
+  cache = bcrypto_sigcache_has(key, SIGCACHE_SCHNORR, ec->type,
+                               msg, msg_len, sig, sig_len,
+                               pub, pub_len, NULL, 0);
+
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->schnorr_size
+      && pub_len == ec->field_size
+      && schnorr_verify(ec->ctx, msg, msg_len, sig, pub);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_schnorr_pubkey_prepare(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  const uint8_t *pub;
+  size_t pub_len;
+  uint32_t width;
+  bcrypto_wei_curve_t *ec;
+  wei_prepared_t *key;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&pub, &pub_len) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[2], &width) == napi_ok);
+
+  JS_ASSERT(pub_len == ec->field_size, JS_ERR_PUBKEY_SIZE);
+  JS_ASSERT(width == 0 || (width >= 2 && width <= 12), JS_ERR_PARAMS);
+
+  key = schnorr_pubkey_prepare(ec->ctx, pub, width);
+
+  JS_ASSERT(key != NULL, JS_ERR_PUBKEY);
+
+  return bcrypto_wei_prepared_create(env, argv[0], ec->ctx,
+                                     key, pub, pub_len, 1);
+}
+
+static napi_value
+bcrypto_schnorr_verify_prepared(napi_env env, napi_callback_info info) {
+  napi_value argv[4];
+  size_t argc = 4;
+  const uint8_t *msg, *sig;
+  size_t msg_len, sig_len;
+  bcrypto_wei_curve_t *ec;
+  bcrypto_wei_prepared_t *pre;
+  napi_value result;
+  uint8_t key[32];
+  int ok, cache;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 4);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[1], (void **)&msg, &msg_len) == napi_ok);
+  CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
+  CHECK(napi_get_value_external(env, argv[3], (void **)&pre) == napi_ok);
+
+  JS_ASSERT(pre->ctx == ec->ctx && pre->schnorr, JS_ERR_PUBKEY);
+
+  /* Shares entries with bcrypto_schnorr_verify. */
+  cache = bcrypto_sigcache_has(key, SIGCACHE_SCHNORR, ec->type,
+                               msg, msg_len, sig, sig_len,
+                               pre->pub, pre->pub_len, NULL, 0);
+
+  ok = cache > 0;
+
+  if (!ok) {
+    ok = sig_len == ec->schnorr_size
+      && schnorr_verify_prepared(ec->ctx, msg, msg_len, sig, pre->key);
+
+    if (ok && cache == 0)
+      bcrypto_sigcache_add(key);
+  }
+
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  return result;
+}
+
+static napi_value
+bcrypto_schnorr_verify_batch(napi_env env, napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  uint32_t i, length, item_len;
+  const uint8_t **ptrs, **msgs, **pubs, **sigs;
+  size_t *lens, *msg_lens;
+  size_t sig_len, pub_len;
+  bcrypto_wei_curve_t *ec;
+  napi_value item, result;
+  napi_value items[3];
+  int ok = 0;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  if (length == 0) {
+    CHECK(napi_get_boolean(env, true, &result) == napi_ok);
+    return result;
+  }
+
+  ptrs = bcrypto_malloc(3 * length * sizeof(uint8_t *));
+  lens = bcrypto_malloc(1 * length * sizeof(size_t));
+
+  if (ptrs == NULL || lens == NULL)
+    goto fail;
+
+  msgs = &ptrs[length * 0];
+  pubs = &ptrs[length * 1];
+  sigs = &ptrs[length * 2];
+  msg_lens = &lens[length * 0];
+
+  for (i = 0; i < length; i++) {
+    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
+    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
+    CHECK(item_len == 3);
+
+    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
+    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
+    CHECK(napi_get_element(env, item, 2, &items[2]) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[0], (void **)&msgs[i],
+                               &msg_lens[i]) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
+                               &sig_len) == napi_ok);
+
+    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
+                               &pub_len) == napi_ok);
+
+    if (sig_len != ec->schnorr_size || pub_len != ec->field_size)
+      goto fail;
+  }
+
+  if (ec->scratch == NULL)
+    ec->scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(ec->scratch != NULL);
+
+  ok = schnorr_verify_batch(ec->ctx, msgs, msg_lens, sigs,
+                            pubs, length, ec->scratch);
+
+fail:
+  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+
+  bcrypto_free((void *)ptrs);
+  bcrypto_free(lens);
+
+  return result;
+}
+
+static int
+bcrypto_schnorr_verify_batch_worker_(void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_wei_curve_t *ec = w->job->curve;
+  bcrypto_batch_t *batch = &w->batch;
+  wei_scratch_t *scratch;
+  uint32_t i;
+  int ok;
+
+  for (i = 0; i < batch->length; i++) {
+    if (batch->sig_lens[i] != ec->schnorr_size
+        || batch->pub_lens[i] != ec->field_size) {
+      return 0;
+    }
+  }
+
+  scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(scratch != NULL);
+
+  ok = schnorr_verify_batch(ec->ctx, batch->msgs, batch->msg_lens,
+                            batch->sigs, batch->pubs, batch->length,
+                            scratch);
+
+  wei_scratch_destroy(ec->ctx, scratch);
+
+  return ok;
+}
+
+static napi_value
+bcrypto_schnorr_verify_batch_async(napi_env env, napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint32_t threads;
+  bcrypto_verify_job_t *job;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[2], &threads) == napi_ok);
 
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  job = bcrypto_verify_job_create(env, argv[1], -1, NULL, 0);
 
-  return result;
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->verify = bcrypto_schnorr_verify_batch_worker_;
+
+  return bcrypto_verify_job_queue(env, job, argv[0], threads,
+                                  "bcrypto:schnorr_verify_batch");
 }
 
 static napi_value
-bcrypto_schnorr_verify_batch(napi_env env, napi_callback_info info) {
+bcrypto_schnorr_verify_batch_invalid(napi_env env,
+                                     napi_callback_info info) {
   napi_value argv[2];
   size_t argc = 2;
-  uint32_t i, length, item_len;
-  const uint8_t **ptrs, **msgs, **pubs, **sigs;
-  size_t *lens, *msg_lens;
-  size_t sig_len, pub_len;
+  bcrypto_batch_t batch;
   bcrypto_wei_curve_t *ec;
-  napi_value item, result;
-  napi_value items[3];
-  int ok = 0;
+  uint32_t length, *map;
+  size_t count, *invalid;
+  napi_value result;
+  uint8_t *bad;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 2);
   CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
-  CHECK(napi_get_array_length(env, argv[1], &length) == napi_ok);
+
+  JS_ASSERT(bcrypto_batch_init(env, &batch, argv[1]), JS_ERR_ALLOC);
+
+  length = batch.length;
 
   if (length == 0) {
-    CHECK(napi_get_boolean(env, true, &result) == napi_ok);
+    CHECK(napi_create_array(env, &result) == napi_ok);
     return result;
   }
 
-  ptrs = bcrypto_malloc(3 * length * sizeof(uint8_t *));
-  lens = bcrypto_malloc(1 * length * sizeof(size_t));
-
-  if (ptrs == NULL || lens == NULL)
-    goto fail;
-
-  msgs = &ptrs[length * 0];
-  pubs = &ptrs[length * 1];
-  sigs = &ptrs[length * 2];
-  msg_lens = &lens[length * 0];
-
-  for (i = 0; i < length; i++) {
-    CHECK(napi_get_element(env, argv[1], i, &item) == napi_ok);
-    CHECK(napi_get_array_length(env, item, &item_len) == napi_ok);
-    CHECK(item_len == 3);
-
-    CHECK(napi_get_element(env, item, 0, &items[0]) == napi_ok);
-    CHECK(napi_get_element(env, item, 1, &items[1]) == napi_ok);
-    CHECK(napi_get_element(env, item, 2, &items[2]) == napi_ok);
-
-    CHECK(napi_get_buffer_info(env, items[0], (void **)&msgs[i],
-                               &msg_lens[i]) == napi_ok);
+  invalid = bcrypto_malloc(length * (sizeof(size_t)
+                                   + sizeof(uint32_t)
+                                   + sizeof(uint8_t)));
 
-    CHECK(napi_get_buffer_info(env, items[1], (void **)&sigs[i],
-                               &sig_len) == napi_ok);
+  if (invalid == NULL) {
+    bcrypto_batch_clear(&batch);
+    JS_THROW(JS_ERR_ALLOC);
+  }
 
-    CHECK(napi_get_buffer_info(env, items[2], (void **)&pubs[i],
-                               &pub_len) == napi_ok);
+  map = (uint32_t *)&invalid[length];
+  bad = (uint8_t *)&map[length];
 
-    if (sig_len != ec->schnorr_size || pub_len != ec->field_size)
-      goto fail;
-  }
+  length = bcrypto_batch_filter(&batch, map, bad, ec->schnorr_size, ec->field_size);
 
   if (ec->scratch == NULL)
     ec->scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
 
   CHECK(ec->scratch != NULL);
 
-  ok = schnorr_verify_batch(ec->ctx, msgs, msg_lens, sigs,
-                            pubs, length, ec->scratch);
+  count = schnorr_verify_batch_invalid(ec->ctx, invalid, batch.msgs,
+                                       batch.msg_lens, batch.sigs,
+                                       batch.pubs, length, ec->scratch);
 
-fail:
-  CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
+  result = bcrypto_batch_invalid(env, bad, map, invalid, count, batch.length);
 
-  bcrypto_free((void *)ptrs);
-  bcrypto_free(lens);
+  bcrypto_free(invalid);
+  bcrypto_batch_clear(&batch);
 
   return result;
 }
@@ -10031,6 +12443,114 @@ fail:
   return result;
 }
 
+static int
+bcrypto_schnorr_legacy_verify_batch_worker_(void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_wei_curve_t *ec = w->job->curve;
+  bcrypto_batch_t *batch = &w->batch;
+  wei_scratch_t *scratch;
+  uint32_t i;
+  int ok;
+
+  for (i = 0; i < batch->length; i++) {
+    if (batch->sig_lens[i] != ec->legacy_size)
+      return 0;
+  }
+
+  scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(scratch != NULL);
+
+  ok = schnorr_legacy_verify_batch(ec->ctx, batch->msgs, batch->msg_lens,
+                                   batch->sigs, batch->pubs, batch->pub_lens,
+                                   batch->length, scratch);
+
+  wei_scratch_destroy(ec->ctx, scratch);
+
+  return ok;
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_batch_async(napi_env env,
+                                          napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint32_t threads;
+  bcrypto_verify_job_t *job;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[2], &threads) == napi_ok);
+
+  job = bcrypto_verify_job_create(env, argv[1], -1, NULL, 0);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->verify = bcrypto_schnorr_legacy_verify_batch_worker_;
+
+  return bcrypto_verify_job_queue(env, job, argv[0], threads,
+                                  "bcrypto:schnorr_legacy_verify_batch");
+}
+
+static napi_value
+bcrypto_schnorr_legacy_verify_batch_invalid(napi_env env,
+                                            napi_callback_info info) {
+  napi_value argv[2];
+  size_t argc = 2;
+  bcrypto_batch_t batch;
+  bcrypto_wei_curve_t *ec;
+  uint32_t length, *map;
+  size_t count, *invalid;
+  napi_value result;
+  uint8_t *bad;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 2);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+
+  JS_ASSERT(schnorr_legacy_support(ec->ctx), JS_ERR_NO_SCHNORR);
+
+  JS_ASSERT(bcrypto_batch_init(env, &batch, argv[1]), JS_ERR_ALLOC);
+
+  length = batch.length;
+
+  if (length == 0) {
+    CHECK(napi_create_array(env, &result) == napi_ok);
+    return result;
+  }
+
+  invalid = bcrypto_malloc(length * (sizeof(size_t)
+                                   + sizeof(uint32_t)
+                                   + sizeof(uint8_t)));
+
+  if (invalid == NULL) {
+    bcrypto_batch_clear(&batch);
+    JS_THROW(JS_ERR_ALLOC);
+  }
+
+  map = (uint32_t *)&invalid[length];
+  bad = (uint8_t *)&map[length];
+
+  length = bcrypto_batch_filter(&batch, map, bad, ec->legacy_size, 0);
+
+  if (ec->scratch == NULL)
+    ec->scratch = wei_scratch_create(ec->ctx, SCRATCH_SIZE);
+
+  CHECK(ec->scratch != NULL);
+
+  count = schnorr_legacy_verify_batch_invalid(ec->ctx, invalid, batch.msgs,
+                                              batch.msg_lens, batch.sigs,
+                                              batch.pubs, batch.pub_lens,
+                                              length, ec->scratch);
+
+  result = bcrypto_batch_invalid(env, bad, map, invalid, count, batch.length);
+
+  bcrypto_free(invalid);
+  bcrypto_batch_clear(&batch);
+
+  return result;
+}
+
 /*
  * Scrypt
  */
@@ -11315,7 +13835,8 @@ bcrypto_secp256k1_verify(napi_env env, napi_callback_info info) {
   size_t msg_len, sig_len, pub_len;
   bcrypto_secp256k1_t *ec;
   napi_value result;
-  int ok;
+  uint8_t key[32];
+  int ok, cache;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
   CHECK(argc == 4);
@@ -11324,6 +13845,15 @@ bcrypto_secp256k1_verify(napi_env env, napi_callback_info info) {
   CHECK(napi_get_buffer_info(env, argv[2], (void **)&sig, &sig_len) == napi_ok);
   CHECK(napi_get_buffer_info(env, argv[3], (void **)&pub, &pub_len) == napi_ok);
 
+  cache = bcrypto_sigcache_has(key, SIGCACHE_SECP256K1, 0,
+                               msg, msg_len, sig, sig_len,
+                               pub, pub_len, NULL, 0);
+
+  ok = cache > 0;
+
+  if (ok)
+    goto done;
+
   ok = sig_len == 64 && pub_len > 0
     && secp256k1_ecdsa_signature_parse_compact(ec->ctx, &sigin, sig)
     && secp256k1_ec_pubkey_parse(ec->ctx, &pubkey, pub, pub_len);
@@ -11335,6 +13865,10 @@ bcrypto_secp256k1_verify(napi_env env, napi_callback_info info) {
     ok = secp256k1_ecdsa_verify(ec->ctx, &sigin, msg32, &pubkey);
   }
 
+  if (ok && cache == 0)
+    bcrypto_sigcache_add(key);
+
+done:
   CHECK(napi_get_boolean(env, ok, &result) == napi_ok);
 
   return result;
@@ -11718,6 +14252,92 @@ fail:
   return result;
 }
 
+static int
+bcrypto_secp256k1_schnorr_legacy_verify_batch_worker_(void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_secp256k1_t *ec = w->job->curve;
+  bcrypto_batch_t *batch = &w->batch;
+  uint32_t i, length = batch->length;
+  const secp256k1_schnorrleg **sigs;
+  secp256k1_schnorrleg *sig_data;
+  const secp256k1_pubkey **pubkeys;
+  secp256k1_pubkey *pubkey_data;
+  secp256k1_scratch_space *scratch = NULL;
+  int ok = 0;
+
+  sigs = bcrypto_malloc(length * sizeof(secp256k1_schnorrleg *));
+  sig_data = bcrypto_malloc(length * sizeof(secp256k1_schnorrleg));
+  pubkeys = bcrypto_malloc(length * sizeof(secp256k1_pubkey *));
+  pubkey_data = bcrypto_malloc(length * sizeof(secp256k1_pubkey));
+
+  if (sigs == NULL || sig_data == NULL
+      || pubkeys == NULL || pubkey_data == NULL) {
+    goto fail;
+  }
+
+  for (i = 0; i < length; i++) {
+    const uint8_t *sig = batch->sigs[i];
+    const uint8_t *pub = batch->pubs[i];
+    size_t pub_len = batch->pub_lens[i];
+
+    if (batch->sig_lens[i] != 64 || pub_len == 0)
+      goto fail;
+
+    if (!secp256k1_schnorrleg_parse(ec->ctx, &sig_data[i], sig))
+      goto fail;
+
+    if (!secp256k1_ec_pubkey_parse(ec->ctx, &pubkey_data[i], pub, pub_len))
+      goto fail;
+
+    sigs[i] = &sig_data[i];
+    pubkeys[i] = &pubkey_data[i];
+  }
+
+  scratch = secp256k1_scratch_space_create(ec->ctx, 1024 * 1024);
+
+  CHECK(scratch != NULL);
+
+  ok = secp256k1_schnorrleg_verify_batch(ec->ctx,
+                                         scratch,
+                                         sigs,
+                                         batch->msgs,
+                                         batch->msg_lens,
+                                         pubkeys,
+                                         length);
+
+  secp256k1_scratch_space_destroy(ec->ctx, scratch);
+
+fail:
+  bcrypto_free((void *)sigs);
+  bcrypto_free(sig_data);
+  bcrypto_free((void *)pubkeys);
+  bcrypto_free(pubkey_data);
+
+  return ok;
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_legacy_verify_batch_async(napi_env env,
+                                                    napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint32_t threads;
+  bcrypto_verify_job_t *job;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[2], &threads) == napi_ok);
+
+  job = bcrypto_verify_job_create(env, argv[1], -1, NULL, 0);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->verify = bcrypto_secp256k1_schnorr_legacy_verify_batch_worker_;
+
+  return bcrypto_verify_job_queue(env, job, argv[0], threads,
+                                  "bcrypto:secp256k1_schnorrleg_batch");
+}
+
 #ifdef BCRYPTO_USE_SECP256K1_LATEST
 static napi_value
 bcrypto_secp256k1_xonly_seckey_export(napi_env env, napi_callback_info info) {
@@ -12415,6 +15035,94 @@ fail:
   return result;
 }
 
+static int
+bcrypto_secp256k1_schnorr_verify_batch_worker_(void *data) {
+  bcrypto_verify_worker_t *w = (bcrypto_verify_worker_t *)data;
+  bcrypto_secp256k1_t *ec = w->job->curve;
+  bcrypto_batch_t *batch = &w->batch;
+  uint32_t i, length = batch->length;
+  const secp256k1_schnorrsig **sigs;
+  secp256k1_schnorrsig *sig_data;
+  const secp256k1_xonly_pubkey **pubkeys;
+  secp256k1_xonly_pubkey *pubkey_data;
+  secp256k1_scratch_space *scratch = NULL;
+  int ok = 0;
+
+  sigs = bcrypto_malloc(length * sizeof(secp256k1_schnorrsig *));
+  sig_data = bcrypto_malloc(length * sizeof(secp256k1_schnorrsig));
+  pubkeys = bcrypto_malloc(length * sizeof(secp256k1_xonly_pubkey *));
+  pubkey_data = bcrypto_malloc(length * sizeof(secp256k1_xonly_pubkey));
+
+  if (sigs == NULL
+      || sig_data == NULL
+      || pubkeys == NULL
+      || pubkey_data == NULL) {
+    goto fail;
+  }
+
+  for (i = 0; i < length; i++) {
+    if (batch->msg_lens[i] != 32
+        || batch->sig_lens[i] != 64
+        || batch->pub_lens[i] != 32) {
+      goto fail;
+    }
+
+    if (!secp256k1_schnorrsig_parse(ec->ctx, &sig_data[i], batch->sigs[i]))
+      goto fail;
+
+    if (!secp256k1_xonly_pubkey_parse(ec->ctx, &pubkey_data[i],
+                                      batch->pubs[i])) {
+      goto fail;
+    }
+
+    sigs[i] = &sig_data[i];
+    pubkeys[i] = &pubkey_data[i];
+  }
+
+  scratch = secp256k1_scratch_space_create(ec->ctx, 1024 * 1024);
+
+  CHECK(scratch != NULL);
+
+  ok = secp256k1_schnorrsig_verify_batch(ec->ctx,
+                                         scratch,
+                                         sigs,
+                                         batch->msgs,
+                                         pubkeys,
+                                         length);
+
+  secp256k1_scratch_space_destroy(ec->ctx, scratch);
+
+fail:
+  bcrypto_free((void *)sigs);
+  bcrypto_free(sig_data);
+  bcrypto_free((void *)pubkeys);
+  bcrypto_free(pubkey_data);
+
+  return ok;
+}
+
+static napi_value
+bcrypto_secp256k1_schnorr_verify_batch_async(napi_env env,
+                                             napi_callback_info info) {
+  napi_value argv[3];
+  size_t argc = 3;
+  uint32_t threads;
+  bcrypto_verify_job_t *job;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 3);
+  CHECK(napi_get_value_uint32(env, argv[2], &threads) == napi_ok);
+
+  job = bcrypto_verify_job_create(env, argv[1], -1, NULL, 0);
+
+  JS_ASSERT(job != NULL, JS_ERR_ALLOC);
+
+  job->verify = bcrypto_secp256k1_schnorr_verify_batch_worker_;
+
+  return bcrypto_verify_job_queue(env, job, argv[0], threads,
+                                  "bcrypto:secp256k1_schnorrsig_batch");
+}
+
 static int
 ecdh_hash_function_xonly(unsigned char *out,
                          const unsigned char *x,
@@ -12702,18 +15410,19 @@ bcrypto_wei_curve_destroy(napi_env env, void *data, void *hint) {
 
 static napi_value
 bcrypto_wei_curve_create(napi_env env, napi_callback_info info) {
-  napi_value argv[1];
-  size_t argc = 1;
-  uint32_t type;
+  napi_value argv[2];
+  size_t argc = 2;
+  uint32_t type, flags;
   bcrypto_wei_curve_t *ec;
   wei_curve_t *ctx;
   napi_value handle;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
-  CHECK(argc == 1);
+  CHECK(argc == 2);
   CHECK(napi_get_value_uint32(env, argv[0], &type) == napi_ok);
+  CHECK(napi_get_value_uint32(env, argv[1], &flags) == napi_ok);
 
-  JS_ASSERT(ctx = wei_curve_create(type), JS_ERR_CONTEXT);
+  JS_ASSERT(ctx = wei_curve_create_ex(type, flags), JS_ERR_CONTEXT);
 
   ec = bcrypto_xmalloc(sizeof(bcrypto_wei_curve_t));
   ec->ctx = ctx;
@@ -12725,6 +15434,7 @@ bcrypto_wei_curve_create(napi_env env, napi_callback_info info) {
   ec->sig_size = ecdsa_sig_size(ec->ctx);
   ec->legacy_size = schnorr_legacy_sig_size(ec->ctx);
   ec->schnorr_size = schnorr_sig_size(ec->ctx);
+  ec->type = type;
 
   CHECK(napi_create_external(env,
                              ec,
@@ -12765,6 +15475,22 @@ bcrypto_wei_curve_field_bits(napi_env env, napi_callback_info info) {
   return result;
 }
 
+static napi_value
+bcrypto_wei_curve_table_size(napi_env env, napi_callback_info info) {
+  napi_value argv[1];
+  size_t argc = 1;
+  bcrypto_wei_curve_t *ec;
+  napi_value result;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, NULL, NULL) == napi_ok);
+  CHECK(argc == 1);
+  CHECK(napi_get_value_external(env, argv[0], (void **)&ec) == napi_ok);
+  CHECK(napi_create_uint32(env, wei_curve_table_size(ec->ctx),
+                           &result) == napi_ok);
+
+  return result;
+}
+
 static napi_value
 bcrypto_wei_curve_randomize(napi_env env, napi_callback_info info) {
   napi_value argv[2];
@@ -12964,6 +15690,8 @@ NAPI_MODULE_INIT() {
     F(dsa_signature_import),
     F(dsa_sign),
     F(dsa_sign_der),
+    F(dsa_signer_create),
+    F(dsa_sign_prepared),
     F(dsa_verify),
     F(dsa_verify_der),
     F(dsa_derive),
@@ -12979,8 +15707,10 @@ NAPI_MODULE_INIT() {
     F(ecdh_pubkey_create),
     F(ecdh_pubkey_convert),
     F(ecdh_pubkey_from_uniform),
+    F(ecdh_pubkey_from_uniform_batch),
     F(ecdh_pubkey_to_uniform),
     F(ecdh_pubkey_from_hash),
+    F(ecdh_pubkey_from_hash_batch),
     F(ecdh_pubkey_to_hash),
     F(ecdh_pubkey_verify),
     F(ecdh_pubkey_export),
@@ -12988,6 +15718,7 @@ NAPI_MODULE_INIT() {
     F(ecdh_pubkey_is_small),
     F(ecdh_pubkey_has_torsion),
     F(ecdh_derive),
+    F(ecdh_derive_batch),
 
     /* ECDSA */
     F(ecdsa_privkey_generate),
@@ -13000,15 +15731,19 @@ NAPI_MODULE_INIT() {
     F(ecdsa_privkey_negate),
     F(ecdsa_privkey_invert),
     F(ecdsa_pubkey_create),
+    F(ecdsa_pubkey_create_batch),
     F(ecdsa_pubkey_convert),
     F(ecdsa_pubkey_from_uniform),
+    F(ecdsa_pubkey_from_uniform_batch),
     F(ecdsa_pubkey_to_uniform),
     F(ecdsa_pubkey_from_hash),
+    F(ecdsa_pubkey_from_hash_batch),
     F(ecdsa_pubkey_to_hash),
     F(ecdsa_pubkey_verify),
     F(ecdsa_pubkey_export),
     F(ecdsa_pubkey_import),
     F(ecdsa_pubkey_tweak_add),
+    F(ecdsa_pubkey_tweak_add_batch),
     F(ecdsa_pubkey_tweak_mul),
     F(ecdsa_pubkey_combine),
     F(ecdsa_pubkey_negate),
@@ -13024,6 +15759,16 @@ NAPI_MODULE_INIT() {
     F(ecdsa_sign_recoverable_der),
     F(ecdsa_verify),
     F(ecdsa_verify_der),
+    F(ecdsa_pubkey_prepare),
+    F(ecdsa_verify_prepared),
+    F(ecdsa_pool_create),
+    F(ecdsa_pool_size),
+    F(ecdsa_pool_fill),
+    F(ecdsa_pool_fill_async),
+    F(ecdsa_pool_clear),
+    F(ecdsa_sign_pooled),
+    F(ecdsa_signer_create),
+    F(ecdsa_sign_prepared),
     F(ecdsa_recover),
     F(ecdsa_recover_der),
     F(ecdsa_derive),
@@ -13049,8 +15794,10 @@ NAPI_MODULE_INIT() {
     F(eddsa_pubkey_from_scalar),
     F(eddsa_pubkey_convert),
     F(eddsa_pubkey_from_uniform),
+    F(eddsa_pubkey_from_uniform_batch),
     F(eddsa_pubkey_to_uniform),
     F(eddsa_pubkey_from_hash),
+    F(eddsa_pubkey_from_hash_batch),
     F(eddsa_pubkey_to_hash),
     F(eddsa_pubkey_verify),
     F(eddsa_pubkey_export),
@@ -13066,9 +15813,16 @@ NAPI_MODULE_INIT() {
     F(eddsa_sign_with_scalar),
     F(eddsa_sign_tweak_add),
     F(eddsa_sign_tweak_mul),
+    F(eddsa_signer_create),
+    F(eddsa_signer_pubkey),
+    F(eddsa_sign_prepared),
     F(eddsa_verify),
+    F(eddsa_pubkey_prepare),
+    F(eddsa_verify_prepared),
     F(eddsa_verify_single),
     F(eddsa_verify_batch),
+    F(eddsa_verify_batch_async),
+    F(eddsa_verify_batch_invalid),
     F(eddsa_derive),
     F(eddsa_derive_with_scalar),
 
@@ -13076,6 +15830,7 @@ NAPI_MODULE_INIT() {
     F(edwards_curve_create),
     F(edwards_curve_field_size),
     F(edwards_curve_field_bits),
+    F(edwards_curve_table_size),
     F(edwards_curve_randomize),
 
     /* Hash */
@@ -13083,6 +15838,8 @@ NAPI_MODULE_INIT() {
     F(hash_init),
     F(hash_update),
     F(hash_final),
+    F(hash_export),
+    F(hash_import),
     F(hash_digest),
     F(hash_root),
     F(hash_multi),
@@ -13205,13 +15962,19 @@ NAPI_MODULE_INIT() {
     F(schnorr_pubkey_combine),
     F(schnorr_sign),
     F(schnorr_verify),
+    F(schnorr_pubkey_prepare),
+    F(schnorr_verify_prepared),
     F(schnorr_verify_batch),
+    F(schnorr_verify_batch_async),
+    F(schnorr_verify_batch_invalid),
     F(schnorr_derive),
 
     /* Schnorr Legacy */
     F(schnorr_legacy_sign),
     F(schnorr_legacy_verify),
     F(schnorr_legacy_verify_batch),
+    F(schnorr_legacy_verify_batch_async),
+    F(schnorr_legacy_verify_batch_invalid),
 
     /* Scrypt */
     F(scrypt_derive),
@@ -13261,6 +16024,7 @@ NAPI_MODULE_INIT() {
     F(secp256k1_schnorr_legacy_sign),
     F(secp256k1_schnorr_legacy_verify),
     F(secp256k1_schnorr_legacy_verify_batch),
+    F(secp256k1_schnorr_legacy_verify_batch_async),
 #ifdef BCRYPTO_USE_SECP256K1_LATEST
     F(secp256k1_xonly_seckey_export),
     F(secp256k1_xonly_seckey_tweak_add),
@@ -13280,6 +16044,7 @@ NAPI_MODULE_INIT() {
     F(secp256k1_schnorr_sign),
     F(secp256k1_schnorr_verify),
     F(secp256k1_schnorr_verify_batch),
+    F(secp256k1_schnorr_verify_batch_async),
     F(secp256k1_xonly_derive),
 #endif
 #endif
@@ -13289,6 +16054,11 @@ NAPI_MODULE_INIT() {
     F(secretbox_open),
     F(secretbox_derive),
 
+    /* Signature Cache */
+    F(sigcache_init),
+    F(sigcache_clear),
+    F(sigcache_stats),
+
     /* Siphash */
     F(siphash_sum),
     F(siphash_mod),
@@ -13299,6 +16069,7 @@ NAPI_MODULE_INIT() {
     F(wei_curve_create),
     F(wei_curve_field_size),
     F(wei_curve_field_bits),
+    F(wei_curve_table_size),
     F(wei_curve_randomize)
 #undef F
   };
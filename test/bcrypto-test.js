@@ -110,6 +110,7 @@ describe('Bcrypto', function() {
         assert.strictEqual(bcrypto.SHAKE.native, 0);
         assert.strictEqual(bcrypto.SHAKE128.native, 0);
         assert.strictEqual(bcrypto.SHAKE256.native, 0);
+        assert.strictEqual(bcrypto.sigcache.native, 0);
         assert.strictEqual(bcrypto.siphash.native, 0);
         assert.strictEqual(bcrypto.Whirlpool.native, 0);
         assert.strictEqual(bcrypto.x25519.native, 0);
@@ -208,6 +209,7 @@ describe('Bcrypto', function() {
         assert.strictEqual(bcrypto.SHAKE.native, 2);
         assert.strictEqual(bcrypto.SHAKE128.native, 2);
         assert.strictEqual(bcrypto.SHAKE256.native, 2);
+        assert.strictEqual(bcrypto.sigcache.native, 2);
         assert.strictEqual(bcrypto.siphash.native, 2);
         assert.strictEqual(bcrypto.Whirlpool.native, 2);
         assert.strictEqual(bcrypto.x25519.native, 2);
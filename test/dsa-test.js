@@ -182,6 +182,24 @@ describe('DSA', function() {
     });
   }
 
+  it('should sign with keyed signer', () => {
+    const params = createParams(P1024_160);
+    const priv = dsa.privateKeyCreate(params);
+    const pub = dsa.publicKeyCreate(priv);
+    const signer = dsa.signerCreate(priv);
+
+    for (let i = 0; i < 4; i++) {
+      const msg = Buffer.alloc(20 + i, i);
+      const sig = dsa.signPrepared(msg, signer);
+
+      // RFC6979 nonces: blinding does not change the result.
+      assert.bufferEqual(sig, dsa.sign(msg, priv));
+      assert.strictEqual(dsa.verify(msg, sig, pub), true);
+    }
+
+    assert.throws(() => dsa.signerCreate(priv.slice(0, -1)));
+  });
+
   it('should sign zero-length message', () => {
     const msg = Buffer.alloc(0);
     const params = createParams(P2048_256);
@@ -102,6 +102,138 @@ describe('ECDSA', function() {
         assert(ec.verify(msg, sig, pubu));
       });
 
+      it(`should create and tweak public keys in batch (${ec.id})`, () => {
+        const keys = [];
+        const tweaks = [];
+
+        for (let i = 0; i < 40; i++) {
+          keys.push(ec.privateKeyGenerate());
+          tweaks.push(ec.privateKeyGenerate());
+        }
+
+        for (const compress of [true, false]) {
+          const pubs = ec.publicKeyCreateBatch(keys, compress);
+
+          assert.strictEqual(pubs.length, keys.length);
+
+          for (let i = 0; i < keys.length; i++)
+            assert.bufferEqual(pubs[i], ec.publicKeyCreate(keys[i], compress));
+
+          const batch = pubs.map((pub, i) => [pub, tweaks[i]]);
+          const children = ec.publicKeyTweakAddBatch(batch, compress);
+
+          assert.strictEqual(children.length, batch.length);
+
+          for (let i = 0; i < batch.length; i++) {
+            const [pub, tweak] = batch[i];
+            const child = ec.publicKeyTweakAdd(pub, tweak, compress);
+
+            assert.bufferEqual(children[i], child);
+          }
+        }
+
+        assert.deepStrictEqual(ec.publicKeyCreateBatch([]), []);
+        assert.deepStrictEqual(ec.publicKeyTweakAddBatch([]), []);
+
+        const zero = Buffer.alloc(ec.size, 0x00);
+        const pub = ec.publicKeyCreate(keys[0]);
+        const neg = ec.privateKeyNegate(keys[0]);
+
+        assert.throws(() => ec.publicKeyCreateBatch([...keys, zero]));
+        assert.throws(() => ec.publicKeyTweakAddBatch([[pub, neg]]));
+      });
+
+      it(`should verify with prepared key (${ec.id})`, () => {
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const pubu = ec.publicKeyConvert(pub, false);
+
+        for (const width of [0, 2, 5, 8]) {
+          for (const key of [pub, pubu]) {
+            const prepared = ec.publicKeyPrepare(key, width);
+
+            for (let i = 0; i < 4; i++) {
+              const msg = rng.randomBytes(ec.size);
+              const sig = ec.sign(msg, priv);
+
+              assert(ec.verify(msg, sig, prepared));
+
+              msg[0] ^= 1;
+
+              assert(!ec.verify(msg, sig, prepared));
+            }
+          }
+        }
+
+        pub[2] ^= 1;
+
+        if (!ec.publicKeyVerify(pub))
+          assert.throws(() => ec.publicKeyPrepare(pub));
+      });
+
+      it(`should sign with nonce pool (${ec.id})`, async () => {
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const pool = ec.noncePoolCreate(8, 2);
+        const seen = new Set();
+
+        assert.strictEqual(ec.noncePoolSize(pool), 0);
+        assert.strictEqual(ec.noncePoolFill(pool), 8);
+        assert.strictEqual(ec.noncePoolFill(pool), 0);
+        assert.strictEqual(ec.noncePoolSize(pool), 8);
+
+        for (let i = 0; i < 6; i++) {
+          const msg = rng.randomBytes(ec.size);
+          const [sig, param] = ec.signRecoverablePooled(msg, priv, pool);
+
+          assert(ec.isLowS(sig));
+          assert(ec.verify(msg, sig, pub));
+          assert.bufferEqual(ec.recover(msg, sig, param), pub);
+          assert.notBufferEqual(sig, ec.sign(msg, priv));
+
+          seen.add(sig.slice(0, ec.size).toString('hex'));
+        }
+
+        assert.strictEqual(seen.size, 6);
+
+        // Crossed the watermark: a refill is pending.
+        assert(pool.pending);
+
+        await ec.noncePoolRefill(pool);
+
+        assert.strictEqual(ec.noncePoolSize(pool), 8);
+
+        ec.noncePoolClear(pool);
+
+        assert.strictEqual(ec.noncePoolSize(pool), 0);
+
+        // Empty pools fall back to RFC6979.
+        const msg = rng.randomBytes(ec.size);
+
+        assert.bufferEqual(ec.signPooled(msg, priv, pool), ec.sign(msg, priv));
+        assert.throws(() => ec.signPooled(msg, Buffer.alloc(ec.size), pool));
+
+        await ec.noncePoolRefill(pool);
+      });
+
+      it(`should sign with keyed signer (${ec.id})`, () => {
+        const priv = ec.privateKeyGenerate();
+        const pub = ec.publicKeyCreate(priv);
+        const signer = ec.signerCreate(priv);
+
+        for (let i = 0; i < 4; i++) {
+          const msg = rng.randomBytes(ec.size - i);
+          const [sig, param] = ec.signRecoverablePrepared(msg, signer);
+
+          assert.bufferEqual(sig, ec.sign(msg, priv));
+          assert.bufferEqual(ec.signPrepared(msg, signer), sig);
+          assert.bufferEqual(ec.recover(msg, sig, param), pub);
+        }
+
+        assert.throws(() => ec.signerCreate(Buffer.alloc(ec.size)));
+        assert.throws(() => ec.signerCreate(Buffer.alloc(ec.size, 0xff)));
+      });
+
       it(`should fail with padded key (${ec.id})`, () => {
         const msg = rng.randomBytes(ec.size);
         const priv = ec.privateKeyGenerate();
@@ -1500,6 +1632,42 @@ describe('ECDSA', function() {
         assert.bufferEqual(out, pub);
       }
     });
+
+    it('should map to curve in batch', () => {
+      for (const curve of curves) {
+        const uniforms = [];
+        const hashes = [];
+
+        for (let i = 0; i < 40; i++) {
+          uniforms.push(rng.randomBytes(curve.size));
+          hashes.push(rng.randomBytes(curve.size * 2));
+        }
+
+        // Exercise the doubling case.
+        hashes.push(Buffer.concat([uniforms[0], uniforms[0]]));
+
+        for (const compress of [true, false]) {
+          const pubs1 = curve.publicKeyFromUniformBatch(uniforms, compress);
+          const pubs2 = curve.publicKeyFromHashBatch(hashes, compress);
+
+          assert.strictEqual(pubs1.length, uniforms.length);
+          assert.strictEqual(pubs2.length, hashes.length);
+
+          for (let i = 0; i < uniforms.length; i++) {
+            const pub = curve.publicKeyFromUniform(uniforms[i], compress);
+            assert.bufferEqual(pubs1[i], pub);
+          }
+
+          for (let i = 0; i < hashes.length; i++) {
+            const pub = curve.publicKeyFromHash(hashes[i], compress);
+            assert.bufferEqual(pubs2[i], pub);
+          }
+        }
+
+        assert.deepStrictEqual(curve.publicKeyFromUniformBatch([]), []);
+        assert.deepStrictEqual(curve.publicKeyFromHashBatch([]), []);
+      }
+    });
   });
 
   describe('Canonical', () => {
@@ -1663,4 +1831,51 @@ describe('ECDSA', function() {
       }
     });
   });
+
+  if (p256.native === 2) {
+    describe('Compact', () => {
+      for (const ec of [p256, p521]) {
+        it(`should sign and verify with compact tables (${ec.id})`, () => {
+          const compact = new ec.constructor(ec.id, true);
+          const msg = rng.randomBytes(ec.size);
+          const priv = ec.privateKeyGenerate();
+          const pub = ec.publicKeyCreate(priv);
+
+          assert(compact.tableSize < ec.tableSize);
+          assert.bufferEqual(compact.publicKeyCreate(priv), pub);
+
+          const sig = compact.sign(msg, priv);
+
+          assert.bufferEqual(sig, ec.sign(msg, priv));
+          assert(compact.verify(msg, sig, pub));
+          assert(ec.verify(msg, sig, pub));
+        });
+      }
+    });
+
+    describe('Inverter', () => {
+      for (const ec of [p256, p384, p521]) {
+        it(`should agree across inverters (${ec.id})`, () => {
+          const chain = new ec.constructor(ec.id, false, 'chain');
+          const safe = new ec.constructor(ec.id, false, 'safegcd');
+          const msg = rng.randomBytes(ec.size);
+          const priv = ec.privateKeyGenerate();
+          const pub = ec.publicKeyCreate(priv);
+          const bytes = rng.randomBytes(ec.size);
+
+          for (const other of [chain, safe]) {
+            const sig = other.sign(msg, priv);
+
+            assert.bufferEqual(other.publicKeyCreate(priv), pub);
+            assert.bufferEqual(other.privateKeyInvert(priv),
+                               ec.privateKeyInvert(priv));
+            assert.bufferEqual(other.publicKeyFromUniform(bytes),
+                               ec.publicKeyFromUniform(bytes));
+            assert.bufferEqual(sig, ec.sign(msg, priv));
+            assert(other.verify(msg, sig, pub));
+          }
+        });
+      }
+    });
+  }
 });
@@ -35,6 +35,51 @@ describe('Ed25519', function() {
       secret);
   });
 
+  it('should verify with prepared key', () => {
+    const secret = ed25519.privateKeyGenerate();
+    const pub = ed25519.publicKeyCreate(secret);
+    const ctx = random.randomBytes(16);
+
+    for (const width of [0, 2, 5, 8]) {
+      const key = ed25519.publicKeyPrepare(pub, width);
+
+      for (const ph of [null, false, true]) {
+        const msg = random.randomBytes(ed25519.size);
+        const sig = ed25519.sign(msg, secret, ph, ctx);
+
+        assert(ed25519.verify(msg, sig, key, ph, ctx));
+
+        msg[0] ^= 1;
+
+        assert(!ed25519.verify(msg, sig, key, ph, ctx));
+      }
+    }
+
+    assert.throws(() => ed25519.publicKeyPrepare(pub.slice(1)));
+  });
+
+  it('should sign with prepared signer', () => {
+    const secret = ed25519.privateKeyGenerate();
+    const pub = ed25519.publicKeyCreate(secret);
+    const ctx = random.randomBytes(16);
+
+    for (const [ph, c] of [[null, null], [false, ctx], [true, ctx]]) {
+      const signer = ed25519.signerCreate(secret, ph, c);
+
+      assert.bufferEqual(signer.publicKey, pub);
+
+      for (let i = 0; i < 3; i++) {
+        const msg = random.randomBytes(ed25519.size);
+        const sig = ed25519.signPrepared(msg, signer);
+
+        assert.bufferEqual(sig, ed25519.sign(msg, secret, ph, c));
+        assert(ed25519.verify(msg, sig, pub, ph, c));
+      }
+    }
+
+    assert.throws(() => ed25519.signerCreate(secret.slice(1)));
+  });
+
   it('should allow points at infinity', () => {
     // Fun fact about edwards curves: points
     // at infinity can actually be serialized.
@@ -442,6 +487,12 @@ describe('Ed25519', function() {
       assert(!ed25519.publicKeyIsSmall(pub));
       assert(ed25519.publicKeyHasTorsion(pub));
 
+      for (const width of [0, 5]) {
+        const key = ed25519.publicKeyPrepare(pub, width);
+
+        assert.strictEqual(ed25519.verify(msg, sig, key), res1);
+      }
+
       batch.push([msg, sig, pub]);
     }
 
@@ -1093,6 +1144,42 @@ describe('Ed25519', function() {
     assert.bufferEqual(x25519.publicKeyConvert(point, false), pub);
   });
 
+  it('should map to curve in batch', () => {
+    const uniforms = [];
+    const hashes = [];
+
+    for (let i = 0; i < 40; i++) {
+      uniforms.push(random.randomBytes(32));
+      hashes.push(random.randomBytes(64));
+    }
+
+    // Exercise the doubling case.
+    hashes.push(Buffer.concat([uniforms[0], uniforms[0]]));
+
+    for (const curve of [ed25519, x25519]) {
+      const pubs = curve.publicKeyFromUniformBatch(uniforms);
+
+      assert.strictEqual(pubs.length, uniforms.length);
+
+      for (let i = 0; i < uniforms.length; i++)
+        assert.bufferEqual(pubs[i], curve.publicKeyFromUniform(uniforms[i]));
+
+      for (const pake of [false, true]) {
+        const pubs = curve.publicKeyFromHashBatch(hashes, pake);
+
+        assert.strictEqual(pubs.length, hashes.length);
+
+        for (let i = 0; i < hashes.length; i++) {
+          const pub = curve.publicKeyFromHash(hashes[i], pake);
+          assert.bufferEqual(pubs[i], pub);
+        }
+      }
+
+      assert.deepStrictEqual(curve.publicKeyFromUniformBatch([]), []);
+      assert.deepStrictEqual(curve.publicKeyFromHashBatch([]), []);
+    }
+  });
+
   if (x25519.native === 2) {
     const native = ed25519;
     const curve = require('../lib/js/ed25519');
@@ -1223,6 +1310,55 @@ describe('Ed25519', function() {
         msg[0] ^= 1;
       }
     });
+
+    it('should do batch verification (async)', async () => {
+      const [msg] = batch[0];
+
+      assert.strictEqual(await ed25519.verifyBatchAsync([]), true);
+      assert.strictEqual(await ed25519.verifyBatchAsync(batch), true);
+
+      if (msg.length > 0) {
+        const promise = ed25519.verifyBatchAsync(batch);
+
+        // Inputs are copied before the promise is returned.
+        msg[0] ^= 1;
+        assert.strictEqual(await promise, true);
+        assert.strictEqual(await ed25519.verifyBatchAsync(batch), false);
+        msg[0] ^= 1;
+      }
+    });
+
+    it('should find invalid signatures in batch', () => {
+      const n = batch.length;
+      const bad = [1, 2, n >>> 2, (n >>> 1) + 1, n - 1];
+
+      assert.deepStrictEqual(ed25519.verifyBatchInvalid([]), []);
+      assert.deepStrictEqual(ed25519.verifyBatchInvalid(batch), []);
+
+      for (const i of bad)
+        batch[i][i & 1][0] ^= 1;
+
+      assert.deepStrictEqual(ed25519.verifyBatchInvalid(batch), bad);
+
+      for (const i of bad)
+        batch[i][i & 1][0] ^= 1;
+
+      assert.deepStrictEqual(ed25519.verifyBatchInvalid(batch), []);
+    });
+
+    it('should do parallel batch verification', async () => {
+      const [msg] = batch[batch.length - 1];
+
+      assert.strictEqual(await ed25519.verifyBatchAsync(batch, null, null, 8),
+                         true);
+
+      if (msg.length > 0) {
+        msg[0] ^= 1;
+        assert.strictEqual(await ed25519.verifyBatchAsync(batch, null, null, 8),
+                           false);
+        msg[0] ^= 1;
+      }
+    });
   });
 
   describe('RFC 8032 vectors', () => {
@@ -1319,6 +1455,37 @@ describe('Ed25519', function() {
     assert.bufferEqual(bobSecret, bobSecret2);
   });
 
+  if (ed25519.native === 2) {
+    it('should sign and verify with compact tables', () => {
+      const compact = new ed25519.constructor(ed25519.id, true);
+      const msg = random.randomBytes(ed25519.size);
+      const secret = ed25519.privateKeyGenerate();
+      const pub = ed25519.publicKeyCreate(secret);
+
+      assert(compact.tableSize < ed25519.tableSize);
+      assert.bufferEqual(compact.publicKeyCreate(secret), pub);
+
+      const sig = compact.sign(msg, secret);
+
+      assert.bufferEqual(sig, ed25519.sign(msg, secret));
+      assert(compact.verify(msg, sig, pub));
+    });
+
+    it('should agree across inverters', () => {
+      const scalar = ed25519.scalarGenerate();
+      const pub = ed25519.publicKeyCreate(ed25519.privateKeyGenerate());
+
+      for (const invert of ['chain', 'safegcd']) {
+        const other = new ed25519.constructor(ed25519.id, false, invert);
+
+        assert.bufferEqual(other.scalarInvert(scalar),
+                           ed25519.scalarInvert(scalar));
+        assert.bufferEqual(other.publicKeyConvert(pub),
+                           ed25519.publicKeyConvert(pub));
+      }
+    });
+  }
+
   it('should test serialization formats', () => {
     const priv = ed25519.privateKeyGenerate();
     const pub = ed25519.publicKeyCreate(priv);
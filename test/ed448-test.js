@@ -30,6 +30,51 @@ describe('Ed448', function() {
       secret);
   });
 
+  it('should verify with prepared key', () => {
+    const secret = ed448.privateKeyGenerate();
+    const pub = ed448.publicKeyCreate(secret);
+    const ctx = random.randomBytes(16);
+
+    for (const width of [0, 2, 5, 8]) {
+      const key = ed448.publicKeyPrepare(pub, width);
+
+      for (const ph of [null, false, true]) {
+        const msg = random.randomBytes(ed448.size);
+        const sig = ed448.sign(msg, secret, ph, ctx);
+
+        assert(ed448.verify(msg, sig, key, ph, ctx));
+
+        msg[0] ^= 1;
+
+        assert(!ed448.verify(msg, sig, key, ph, ctx));
+      }
+    }
+
+    assert.throws(() => ed448.publicKeyPrepare(pub.slice(1)));
+  });
+
+  it('should sign with prepared signer', () => {
+    const secret = ed448.privateKeyGenerate();
+    const pub = ed448.publicKeyCreate(secret);
+    const ctx = random.randomBytes(16);
+
+    for (const [ph, c] of [[null, null], [false, ctx], [true, ctx]]) {
+      const signer = ed448.signerCreate(secret, ph, c);
+
+      assert.bufferEqual(signer.publicKey, pub);
+
+      for (let i = 0; i < 3; i++) {
+        const msg = random.randomBytes(ed448.size);
+        const sig = ed448.signPrepared(msg, signer);
+
+        assert.bufferEqual(sig, ed448.sign(msg, secret, ph, c));
+        assert(ed448.verify(msg, sig, pub, ph, c));
+      }
+    }
+
+    assert.throws(() => ed448.signerCreate(secret.slice(1)));
+  });
+
   it('should allow points at infinity', () => {
     // Fun fact about edwards curves: points
     // at infinity can actually be serialized.
@@ -1193,6 +1238,27 @@ describe('Ed448', function() {
     });
   });
 
+  it('should do large batch verification', () => {
+    const batch = [];
+
+    for (let i = 0; i < 300; i++) {
+      const key = ed448.privateKeyGenerate();
+      const pub = ed448.publicKeyCreate(key);
+      const msg = random.randomBytes(32);
+      const sig = ed448.sign(msg, key);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    assert.strictEqual(ed448.verifyBatch(batch), true);
+
+    const [msg] = batch[150];
+
+    msg[0] ^= 1;
+    assert.strictEqual(ed448.verifyBatch(batch), false);
+    msg[0] ^= 1;
+  });
+
   it('should do covert ecdh', () => {
     const alicePriv = ed448.privateKeyGenerate();
     const alicePub = ed448.publicKeyCreate(alicePriv);
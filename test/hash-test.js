@@ -165,4 +165,91 @@ describe('Hash', function() {
       }
     });
   }
+
+  describe('Midstate', () => {
+    for (const hash of [SHA224, SHA256, SHA384, SHA512]) {
+      it(`should export and import ${hash.id} midstate`, () => {
+        const msg = rng.randomBytes(hash.blockSize * 3 + 17);
+        const pre = msg.slice(0, hash.blockSize * 2);
+        const ctx = hash.hash().init().update(pre);
+        const raw = ctx.export();
+        const expect = hash.digest(msg);
+
+        assert.strictEqual(raw.length, hash.blockSize === 64 ? 40 : 72);
+
+        ctx.update(msg.slice(pre.length));
+
+        assert.bufferEqual(ctx.final(), expect);
+
+        for (let i = 0; i < 2; i++) {
+          const ctx = hash.hash().import(raw);
+
+          ctx.update(msg.slice(pre.length));
+
+          assert.bufferEqual(ctx.final(), expect);
+        }
+
+        assert.throws(() => hash.hash().init().update(msg).export());
+        assert.throws(() => hash.hash().import(raw.slice(1)));
+      });
+    }
+
+    if (SHA256.native === 2) {
+      const hashes = [
+        [SHA224, require('../lib/js/sha224')],
+        [SHA256, require('../lib/js/sha256')],
+        [SHA384, require('../lib/js/sha384')],
+        [SHA512, require('../lib/js/sha512')]
+      ];
+
+      for (const [native, js] of hashes) {
+        it(`should move ${native.id} midstate across backends`, () => {
+          const msg = rng.randomBytes(native.blockSize * 3 + 17);
+          const pre = msg.slice(0, native.blockSize * 2);
+          const rest = msg.slice(pre.length);
+          const expect = native.digest(msg);
+
+          const raw1 = native.hash().init().update(pre).export();
+          const raw2 = js.hash().init().update(pre).export();
+
+          assert.bufferEqual(raw1, raw2);
+          assert.bufferEqual(js.hash().import(raw1).update(rest).final(),
+                             expect);
+          assert.bufferEqual(native.hash().import(raw2).update(rest).final(),
+                             expect);
+
+          // Byte counters up to 2^53 are accepted by both.
+          const max = Buffer.from(raw1);
+          const pos = max.length - 8;
+
+          max.writeUInt32BE(0x1fffff, pos);
+          max.writeUInt32BE(0xffff0000, pos + 4);
+
+          assert.bufferEqual(js.hash().import(max).update(rest).final(),
+                             native.hash().import(max).update(rest).final());
+
+          max.writeUInt32BE(0x200000, pos);
+          max.writeUInt32BE(0, pos + 4);
+
+          assert.throws(() => js.hash().import(max));
+          assert.throws(() => native.hash().import(max));
+        });
+      }
+    }
+
+    it('should compute tagged hash midstate', () => {
+      const tag = Buffer.from('TapSighash', 'binary');
+      const msg = rng.randomBytes(100);
+      const raw = SHA256.tag(tag);
+      const tagged = SHA256.digest(tag);
+      const expect = SHA256.multi(tagged, tagged, msg);
+
+      assert.strictEqual(raw.length, 40);
+
+      for (let i = 0; i < 2; i++) {
+        const ctx = SHA256.hash().import(raw);
+        assert.bufferEqual(ctx.update(msg).final(), expect);
+      }
+    });
+  });
 });
@@ -57,6 +57,42 @@ describe('Secp256k1+Schnorr Legacy', function() {
     }
   });
 
+  it('should do batch verification (async)', async () => {
+    assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync([]), true);
+    assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync(valid), true);
+
+    for (const item of invalid) {
+      const batch = [item, ...valid];
+      assert.strictEqual(await secp256k1.schnorrVerifyBatchAsync(batch), false);
+    }
+  });
+
+  it('should do large batch verification', () => {
+    for (const curve of [secp256k1, p256]) {
+      const batch = [];
+
+      for (let i = 0; i < 300; i++) {
+        const key = curve.privateKeyGenerate();
+        const pub = curve.publicKeyCreate(key);
+        const msg = Buffer.alloc(32, i & 0xff);
+        const sig = curve.schnorrSign(msg, key);
+
+        batch.push([msg, sig, pub]);
+      }
+
+      assert.strictEqual(curve.schnorrVerifyBatch(batch), true);
+
+      const [msg] = batch[150];
+
+      msg[0] ^= 1;
+      assert.strictEqual(curve.schnorrVerifyBatch(batch), false);
+      assert.deepStrictEqual(curve.schnorrVerifyBatchInvalid(batch), [150]);
+      msg[0] ^= 1;
+
+      assert.deepStrictEqual(curve.schnorrVerifyBatchInvalid(batch), []);
+    }
+  });
+
   it('should handle uncompressed key properly', () => {
     // See: https://github.com/bcoin-org/bcrypto/issues/17
     const msg = Buffer.from(
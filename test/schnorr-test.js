@@ -33,6 +33,23 @@ describe('Schnorr', function() {
     });
   }
 
+  it('should verify with prepared keys', () => {
+    for (const [msg, sig, pub] of [...valid, ...invalid]) {
+      const result = schnorr.verify(msg, sig, pub);
+
+      if (!schnorr.publicKeyVerify(pub)) {
+        assert.throws(() => schnorr.publicKeyPrepare(pub));
+        continue;
+      }
+
+      for (const width of [0, 2, 5, 8]) {
+        const key = schnorr.publicKeyPrepare(pub, width);
+
+        assert.strictEqual(schnorr.verify(msg, sig, key), result);
+      }
+    }
+  });
+
   it('should do batch verification', () => {
     assert.strictEqual(schnorr.verifyBatch([]), true);
     assert.strictEqual(schnorr.verifyBatch(valid), true);
@@ -49,6 +66,95 @@ describe('Schnorr', function() {
     }
   });
 
+  it('should do batch verification (async)', async () => {
+    assert.strictEqual(await schnorr.verifyBatchAsync([]), true);
+    assert.strictEqual(await schnorr.verifyBatchAsync(valid), true);
+
+    for (const item of invalid) {
+      assert.strictEqual(await schnorr.verifyBatchAsync([item, ...valid]),
+                         false);
+    }
+  });
+
+  it('should do large batch verification', () => {
+    const batch = [];
+
+    for (let i = 0; i < 300; i++) {
+      const key = schnorr.privateKeyGenerate();
+      const pub = schnorr.publicKeyCreate(key);
+      const msg = rng.randomBytes(32);
+      const sig = schnorr.sign(msg, key);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    assert.strictEqual(schnorr.verifyBatch(batch), true);
+
+    const [msg] = batch[150];
+
+    msg[0] ^= 1;
+    assert.strictEqual(schnorr.verifyBatch(batch), false);
+    msg[0] ^= 1;
+  });
+
+  it('should find invalid signatures in batch', () => {
+    const batch = [];
+    const bad = [0, 7, 42, 150, 151, 299];
+
+    for (let i = 0; i < 300; i++) {
+      const key = schnorr.privateKeyGenerate();
+      const pub = schnorr.publicKeyCreate(key);
+      const msg = rng.randomBytes(32);
+      const sig = schnorr.sign(msg, key);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    assert.deepStrictEqual(schnorr.verifyBatchInvalid([]), []);
+    assert.deepStrictEqual(schnorr.verifyBatchInvalid(batch), []);
+
+    for (const i of bad)
+      batch[i][0][0] ^= 1;
+
+    // Malformed signature.
+    batch[42][1] = batch[42][1].slice(0, 63);
+
+    assert.deepStrictEqual(schnorr.verifyBatchInvalid(batch), bad);
+
+    for (const [i, item] of invalid.entries()) {
+      const expect = [i & 1 ? valid.length : 0];
+      const batch = i & 1 ? [...valid, item] : [item, ...valid];
+
+      assert.deepStrictEqual(schnorr.verifyBatchInvalid(batch), expect);
+    }
+  });
+
+  it('should do parallel batch verification', async () => {
+    const batch = [];
+
+    for (let i = 0; i < 300; i++) {
+      const key = schnorr.privateKeyGenerate();
+      const pub = schnorr.publicKeyCreate(key);
+      const msg = rng.randomBytes(32);
+      const sig = schnorr.sign(msg, key);
+
+      batch.push([msg, sig, pub]);
+    }
+
+    for (const threads of [1, 2, 4, 32]) {
+      assert.strictEqual(await schnorr.verifyBatchAsync(batch, threads), true);
+
+      for (const i of [0, 150, 299]) {
+        const [msg] = batch[i];
+
+        msg[0] ^= 1;
+        assert.strictEqual(await schnorr.verifyBatchAsync(batch, threads),
+                           false);
+        msg[0] ^= 1;
+      }
+    }
+  });
+
   it('should do HD derivation (additive)', () => {
     const priv = schnorr.privateKeyGenerate();
     const pub = schnorr.publicKeyCreate(priv);
@@ -0,0 +1,219 @@
+'use strict';
+
+const assert = require('bsert');
+const sigcache = require('../lib/sigcache');
+const secp256k1 = require('../lib/secp256k1');
+const p256 = require('../lib/p256');
+const schnorr = require('../lib/schnorr');
+const ed25519 = require('../lib/ed25519');
+const rng = require('../lib/random');
+
+describe('SigCache', function() {
+  const schemes = [
+    ['secp256k1', secp256k1],
+    ['p256', p256],
+    ['schnorr', schnorr],
+    ['ed25519', ed25519]
+  ];
+
+  function create(curve) {
+    const key = curve.privateKeyGenerate();
+    const pub = curve.publicKeyCreate(key);
+    const msg = rng.randomBytes(32);
+    const sig = curve.sign(msg, key);
+
+    return [msg, sig, pub];
+  }
+
+  after(() => {
+    sigcache.init(0);
+  });
+
+  if (sigcache.native !== 2) {
+    it('should not cache (js)', () => {
+      sigcache.init(1 << 16);
+
+      const [msg, sig, pub] = create(secp256k1);
+
+      assert(secp256k1.verify(msg, sig, pub));
+      assert(secp256k1.verify(msg, sig, pub));
+
+      assert.deepStrictEqual(sigcache.stats(), {
+        capacity: 0,
+        size: 0,
+        hits: 0,
+        misses: 0
+      });
+    });
+
+    return;
+  }
+
+  it('should be disabled by default', () => {
+    const [msg, sig, pub] = create(secp256k1);
+
+    assert(secp256k1.verify(msg, sig, pub));
+
+    assert.deepStrictEqual(sigcache.stats(), {
+      capacity: 0,
+      size: 0,
+      hits: 0,
+      misses: 0
+    });
+  });
+
+  it('should round size down to a power of two', () => {
+    sigcache.init(100 * 32);
+    assert.strictEqual(sigcache.stats().capacity, 64 * 32);
+
+    // Never below one bucket (two slots).
+    sigcache.init(32);
+    assert.strictEqual(sigcache.stats().capacity, 64);
+
+    sigcache.init(1);
+    assert.strictEqual(sigcache.stats().capacity, 64);
+
+    sigcache.init(1 << 16);
+    assert.strictEqual(sigcache.stats().capacity, 1 << 16);
+  });
+
+  for (const [name, curve] of schemes) {
+    it(`should cache valid signatures (${name})`, () => {
+      const [msg, sig, pub] = create(curve);
+
+      sigcache.clear();
+
+      assert(curve.verify(msg, sig, pub));
+      assert.deepStrictEqual(sigcache.stats(), {
+        capacity: 1 << 16,
+        size: 1,
+        hits: 0,
+        misses: 1
+      });
+
+      assert(curve.verify(msg, sig, pub));
+      assert(curve.verify(msg, sig, pub));
+      assert.strictEqual(sigcache.stats().hits, 2);
+      assert.strictEqual(sigcache.stats().size, 1);
+    });
+
+    it(`should share entries with prepared keys (${name})`, () => {
+      const [msg, sig, pub] = create(curve);
+      const key = curve.publicKeyPrepare(pub);
+
+      sigcache.clear();
+
+      assert(curve.verify(msg, sig, key));
+      assert(curve.verify(msg, sig, pub));
+      assert(curve.verify(msg, sig, key));
+
+      assert.deepStrictEqual(sigcache.stats(), {
+        capacity: 1 << 16,
+        size: 1,
+        hits: 2,
+        misses: 1
+      });
+    });
+
+    it(`should not cache invalid signatures (${name})`, () => {
+      const [msg, sig, pub] = create(curve);
+
+      sigcache.clear();
+
+      msg[0] ^= 1;
+
+      assert(!curve.verify(msg, sig, pub));
+      assert(!curve.verify(msg, sig, pub));
+
+      assert.deepStrictEqual(sigcache.stats(), {
+        capacity: 1 << 16,
+        size: 0,
+        hits: 0,
+        misses: 2
+      });
+    });
+  }
+
+  it('should separate schemes and curves', () => {
+    const key = secp256k1.privateKeyGenerate();
+    const pub = secp256k1.publicKeyCreate(key);
+    const msg = rng.randomBytes(32);
+    const sig = secp256k1.sign(msg, key);
+
+    sigcache.clear();
+
+    assert(secp256k1.verify(msg, sig, pub));
+    assert(!p256.verify(msg, sig, pub));
+    assert.strictEqual(sigcache.stats().hits, 0);
+  });
+
+  it('should separate eddsa prehash and context', () => {
+    const [msg, sig, pub] = create(ed25519);
+    const ctx = Buffer.from('ctx');
+
+    sigcache.clear();
+
+    assert(ed25519.verify(msg, sig, pub));
+    assert(!ed25519.verify(msg, sig, pub, true));
+    assert(!ed25519.verify(msg, sig, pub, false, ctx));
+    assert.strictEqual(sigcache.stats().hits, 0);
+  });
+
+  it('should be bypassed by batch verification', () => {
+    const [msg, sig, pub] = create(schnorr);
+
+    sigcache.clear();
+
+    assert(schnorr.verifyBatch([[msg, sig, pub]]));
+    assert(schnorr.verifyBatch([[msg, sig, pub]]));
+
+    assert.deepStrictEqual(sigcache.stats(), {
+      capacity: 1 << 16,
+      size: 0,
+      hits: 0,
+      misses: 0
+    });
+  });
+
+  it('should stay bounded', () => {
+    const items = [];
+
+    sigcache.init(64 * 32);
+
+    for (let i = 0; i < 256; i++) {
+      const key = schnorr.privateKeyGenerate();
+      const pub = schnorr.publicKeyCreate(key);
+      const msg = Buffer.alloc(32, i);
+      const sig = schnorr.sign(msg, key);
+
+      items.push([msg, sig, pub]);
+
+      assert(schnorr.verify(msg, sig, pub));
+    }
+
+    const {capacity, size} = sigcache.stats();
+
+    assert.strictEqual(capacity, 64 * 32);
+    assert(size > 32 && size <= 64);
+
+    for (const [msg, sig, pub] of items)
+      assert(schnorr.verify(msg, sig, pub));
+
+    const {hits, misses} = sigcache.stats();
+
+    assert(hits > 0 && hits <= 64);
+    assert.strictEqual(hits + misses, 512);
+  });
+
+  it('should disable', () => {
+    const [msg, sig, pub] = create(ed25519);
+
+    sigcache.init(0);
+
+    assert(ed25519.verify(msg, sig, pub));
+    assert(ed25519.verify(msg, sig, pub));
+    assert.strictEqual(sigcache.stats().hits, 0);
+
+    sigcache.init(1 << 16);
+  });
+});
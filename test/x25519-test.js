@@ -466,4 +466,62 @@ describe('X25519', function() {
     assert.bufferEqual(x25519.privateKeyImport(rawPriv), alicePriv);
     assert.bufferEqual(x25519.publicKeyImport(rawPub), alicePub);
   });
+
+  it('should derive in batch', () => {
+    const batch = [];
+
+    for (let i = 0; i < 11; i++) {
+      const priv = x25519.privateKeyGenerate();
+      const pub = x25519.publicKeyCreate(x25519.privateKeyGenerate());
+
+      batch.push([pub, priv]);
+    }
+
+    const secrets = x25519.deriveBatch(batch);
+
+    assert.strictEqual(secrets.length, batch.length);
+
+    for (let i = 0; i < batch.length; i++) {
+      const [pub, priv] = batch[i];
+
+      assert.bufferEqual(secrets[i], x25519.derive(pub, priv));
+    }
+
+    assert.deepStrictEqual(x25519.deriveBatch([]), []);
+
+    assert.throws(() => x25519.deriveBatch([[batch[0][0].slice(1),
+                                             batch[0][1]]]));
+  });
+
+  it('should fail only bad items when deriving in batch', () => {
+    const zero = Buffer.alloc(32, 0x00);
+    const small = x25519.publicKeyFromUniform(Buffer.alloc(32, 0x00));
+    const batch = [];
+
+    for (let i = 0; i < 9; i++) {
+      const priv = x25519.privateKeyGenerate();
+      const pub = x25519.publicKeyCreate(x25519.privateKeyGenerate());
+
+      batch.push([pub, priv]);
+    }
+
+    batch[2] = [zero, batch[2][1]];
+    batch[7] = [small, batch[7][1]];
+
+    const secrets = x25519.deriveBatch(batch);
+
+    assert.strictEqual(secrets.length, batch.length);
+
+    for (let i = 0; i < batch.length; i++) {
+      const [pub, priv] = batch[i];
+
+      if (i === 2 || i === 7) {
+        assert.strictEqual(secrets[i], null);
+        assert.throws(() => x25519.derive(pub, priv));
+        continue;
+      }
+
+      assert.bufferEqual(secrets[i], x25519.derive(pub, priv));
+    }
+  });
 });